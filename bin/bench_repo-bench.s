@@ -0,0 +1,51 @@
+	.file	"bench.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"--json"
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB11:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	cmpl	$1, %edi
+	jle	.L2
+	movq	8(%rsi), %rdi
+	leaq	.LC0(%rip), %rsi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L6
+.L2:
+	xorl	%edi, %edi
+	call	wavefrontMaterialCorpusBench@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialBench@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialCompactBench@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialParserBench@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialWriterBench@PLT
+	xorl	%eax, %eax
+	call	wavefrontNumberBench@PLT
+	xorl	%eax, %eax
+	call	wavefrontScanBench@PLT
+.L3:
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L6:
+	.cfi_restore_state
+	movl	$1, %edi
+	call	wavefrontMaterialCorpusBench@PLT
+	jmp	.L3
+	.cfi_endproc
+.LFE11:
+	.size	main, .-main
+	.section	.note.GNU-stack,"",@progbits
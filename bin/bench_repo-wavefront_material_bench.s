@@ -0,0 +1,667 @@
+	.file	"wavefront_material_bench.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"asset%u_material%u"
+.LC5:
+	.string	"textures/diffuse_%u.png"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC8:
+	.string	"wavefrontMTLMerge %.0f into %u"
+	.section	.rodata.str1.1
+.LC9:
+	.string	"%-44s %12.0f materials/sec\n"
+	.text
+	.p2align 4
+	.globl	wavefrontMaterialBench
+	.type	wavefrontMaterialBench, @function
+wavefrontMaterialBench:
+.LFB24:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$11200, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	call	malloc@PLT
+	testq	%rax, %rax
+	je	.L2
+	movq	%rax, %r14
+	leaq	11200(%rax), %r13
+	movq	%rax, %rbx
+	movq	%rax, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	call	wavefrontMTLCompose@PLT
+	movl	$1, -20(%rbx)
+	cmpq	%r13, %rbx
+	jne	.L3
+	xorl	%edi, %edi
+	movq	%rbp, 24(%rsp)
+	movq	%r14, %r12
+	movl	$9, %r15d
+	leaq	.LC1(%rip), %rax
+	movl	%edi, 20(%rsp)
+	leaq	144(%rsp), %rbx
+	movq	%rax, (%rsp)
+	movq	%r14, 32(%rsp)
+	movq	%r13, 40(%rsp)
+.L4:
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	jmp	.L6
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	movq	(%r12), %r8
+	movl	%ebp, %ecx
+	pxor	%xmm0, %xmm0
+	movl	$64, %esi
+	cvtsi2ssl	%ebp, %xmm0
+	leaq	.LC5(%rip), %rdx
+	movq	%rbx, %rdi
+	movabsq	$4575657222456999936, %rax
+	addq	%r14, %r8
+	divss	.LC2(%rip), %xmm0
+	movq	%rax, 32(%r8)
+	movl	%ebp, %eax
+	leaq	80(%rsp), %rbp
+	imulq	$274877907, %rax, %rax
+	movq	%r8, 8(%rsp)
+	movl	$0x3f000000, 28(%r8)
+	movl	$0x42c02828, 88(%r8)
+	shrq	$37, %rax
+	movss	%xmm0, 24(%r8)
+	imull	$500, %eax, %eax
+	movl	$2, 128(%r8)
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	testl	%eax, %eax
+	jne	.L63
+	movl	80(%rsp), %eax
+	movq	32(%r12), %rdx
+	addl	$1, %r13d
+	addq	$456, %r14
+	movq	8(%rsp), %r8
+	leal	-1(%rax), %ecx
+	movq	(%rdx,%rcx,8), %rdx
+	movl	%eax, 160(%r8)
+	movq	%rdx, 152(%r8)
+	cmpl	$100, %r13d
+	je	.L70
+.L6:
+	movl	$3518437209, %esi
+	movl	20(%rsp), %ecx
+	movl	%r13d, %r8d
+	movq	%rbx, %rdi
+	imull	$1103515245, %r15d, %r15d
+	addl	$12345, %r15d
+	movl	%r15d, %eax
+	shrl	$8, %eax
+	movl	%eax, %ebp
+	imulq	%rsi, %rbp
+	movl	$64, %esi
+	shrq	$44, %rbp
+	imull	$5000, %ebp, %edx
+	subl	%edx, %eax
+	movq	(%rsp), %rdx
+	movl	%eax, %ebp
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	testl	%eax, %eax
+	je	.L71
+.L63:
+	movq	24(%rsp), %rbx
+	movq	32(%rsp), %r14
+	movq	40(%rsp), %r13
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	call	wavefrontMTLRelease@PLT
+	cmpq	%r13, %rbx
+	jne	.L13
+	movq	%r14, %rdi
+	call	free@PLT
+.L2:
+	movl	$112000, %edi
+	call	malloc@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L14
+	leaq	112000(%rax), %r13
+	movq	%rax, %rbx
+	movq	%rax, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	call	wavefrontMTLCompose@PLT
+	movl	$1, -20(%rbx)
+	cmpq	%rbx, %r13
+	jne	.L15
+	xorl	%edi, %edi
+	movq	%r13, 24(%rsp)
+	movq	%r14, %r12
+	movl	$9, %r15d
+	leaq	.LC1(%rip), %rax
+	movq	%r14, 32(%rsp)
+	leaq	144(%rsp), %rbx
+	movq	%rax, (%rsp)
+	movl	%edi, 20(%rsp)
+	movq	%rbp, 40(%rsp)
+.L16:
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	movq	(%r12), %r8
+	movl	%ebp, %ecx
+	pxor	%xmm0, %xmm0
+	movl	$64, %esi
+	cvtsi2ssl	%ebp, %xmm0
+	leaq	.LC5(%rip), %rdx
+	movq	%rbx, %rdi
+	movabsq	$4575657222456999936, %rax
+	addq	%r14, %r8
+	divss	.LC2(%rip), %xmm0
+	movq	%rax, 32(%r8)
+	movl	%ebp, %eax
+	leaq	80(%rsp), %rbp
+	imulq	$274877907, %rax, %rax
+	movq	%r8, 8(%rsp)
+	movl	$0x3f000000, 28(%r8)
+	movl	$0x42c02828, 88(%r8)
+	shrq	$37, %rax
+	movss	%xmm0, 24(%r8)
+	imull	$500, %eax, %eax
+	movl	$2, 128(%r8)
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	testl	%eax, %eax
+	jne	.L65
+	movl	80(%rsp), %eax
+	movq	32(%r12), %rdx
+	addl	$1, %r13d
+	addq	$456, %r14
+	movq	8(%rsp), %r8
+	leal	-1(%rax), %ecx
+	movq	(%rdx,%rcx,8), %rdx
+	movl	%eax, 160(%r8)
+	movq	%rdx, 152(%r8)
+	cmpl	$100, %r13d
+	je	.L72
+.L18:
+	movl	$3518437209, %esi
+	movl	20(%rsp), %ecx
+	movl	%r13d, %r8d
+	movq	%rbx, %rdi
+	imull	$1103515245, %r15d, %r15d
+	addl	$12345, %r15d
+	movl	%r15d, %eax
+	shrl	$8, %eax
+	movl	%eax, %ebp
+	imulq	%rsi, %rbp
+	movl	$64, %esi
+	shrq	$44, %rbp
+	imull	$5000, %ebp, %edx
+	subl	%edx, %eax
+	movq	(%rsp), %rdx
+	movl	%eax, %ebp
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	testl	%eax, %eax
+	je	.L73
+.L65:
+	movq	24(%rsp), %r13
+	movq	32(%rsp), %r14
+	movq	40(%rsp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	call	wavefrontMTLRelease@PLT
+	cmpq	%rbx, %r13
+	jne	.L25
+	movq	%r14, %rdi
+	call	free@PLT
+.L14:
+	movl	$448000, %edi
+	call	malloc@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L1
+	leaq	448000(%rax), %r13
+	movq	%rax, %rbx
+	movq	%rax, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	call	wavefrontMTLCompose@PLT
+	movl	$1, -20(%rbx)
+	cmpq	%rbx, %r13
+	jne	.L27
+	xorl	%edi, %edi
+	movq	%r14, 24(%rsp)
+	movq	%r14, %r12
+	movl	$9, %r15d
+	leaq	.LC1(%rip), %rax
+	movl	%edi, 20(%rsp)
+	leaq	144(%rsp), %rbx
+	movq	%rax, (%rsp)
+	movq	%r13, 32(%rsp)
+	movq	%rbp, 40(%rsp)
+.L28:
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	jmp	.L30
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	movq	(%r12), %r8
+	movl	%ebp, %ecx
+	pxor	%xmm0, %xmm0
+	movl	$64, %esi
+	cvtsi2ssl	%ebp, %xmm0
+	leaq	.LC5(%rip), %rdx
+	movq	%rbx, %rdi
+	movabsq	$4575657222456999936, %rax
+	addq	%r14, %r8
+	divss	.LC2(%rip), %xmm0
+	movq	%rax, 32(%r8)
+	movl	%ebp, %eax
+	leaq	80(%rsp), %rbp
+	imulq	$274877907, %rax, %rax
+	movq	%r8, 8(%rsp)
+	movl	$0x3f000000, 28(%r8)
+	movl	$0x42c02828, 88(%r8)
+	shrq	$37, %rax
+	movss	%xmm0, 24(%r8)
+	imull	$500, %eax, %eax
+	movl	$2, 128(%r8)
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	testl	%eax, %eax
+	jne	.L67
+	movl	80(%rsp), %eax
+	movq	32(%r12), %rdx
+	addl	$1, %r13d
+	addq	$456, %r14
+	movq	8(%rsp), %r8
+	leal	-1(%rax), %ecx
+	movq	(%rdx,%rcx,8), %rdx
+	movl	%eax, 160(%r8)
+	movq	%rdx, 152(%r8)
+	cmpl	$100, %r13d
+	je	.L74
+.L30:
+	movl	$3518437209, %esi
+	movl	20(%rsp), %ecx
+	movl	%r13d, %r8d
+	movq	%rbx, %rdi
+	imull	$1103515245, %r15d, %r15d
+	addl	$12345, %r15d
+	movl	%r15d, %eax
+	shrl	$8, %eax
+	movl	%eax, %ebp
+	imulq	%rsi, %rbp
+	movl	$64, %esi
+	shrq	$44, %rbp
+	imull	$5000, %ebp, %edx
+	subl	%edx, %eax
+	movq	(%rsp), %rdx
+	movl	%eax, %ebp
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	testl	%eax, %eax
+	je	.L75
+.L67:
+	movq	24(%rsp), %r14
+	movq	32(%rsp), %r13
+	movq	40(%rsp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	call	wavefrontMTLRelease@PLT
+	cmpq	%rbx, %r13
+	jne	.L37
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+.L70:
+	.cfi_restore_state
+	addl	$1, 20(%rsp)
+	movl	20(%rsp), %eax
+	addq	$112, %r12
+	cmpl	$100, %eax
+	jne	.L4
+	movq	24(%rsp), %r8
+	movq	32(%rsp), %r14
+	movq	%rbx, %rdi
+	leaq	48(%rsp), %r12
+	movq	40(%rsp), %r13
+	movq	%r8, 8(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movl	$1, 236(%rsp)
+	call	clock@PLT
+	movl	$100, %edx
+	movq	%r12, %rcx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %r15
+	call	wavefrontMTLMerge@PLT
+	movl	%eax, (%rsp)
+	call	clock@PLT
+	movl	(%rsp), %edx
+	movq	8(%rsp), %r8
+	testl	%edx, %edx
+	je	.L76
+.L10:
+	movq	%rbx, %rdi
+	movq	%r8, (%rsp)
+	call	wavefrontMTLRelease@PLT
+	movq	(%rsp), %rbx
+	jmp	.L13
+.L72:
+	addl	$1, 20(%rsp)
+	movl	20(%rsp), %eax
+	addq	$112, %r12
+	cmpl	$1000, %eax
+	jne	.L16
+	movq	40(%rsp), %r8
+	movq	32(%rsp), %r14
+	movq	%rbx, %rdi
+	leaq	48(%rsp), %r12
+	movq	24(%rsp), %r13
+	movq	%r8, 8(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movl	$1, 236(%rsp)
+	call	clock@PLT
+	movl	$1000, %edx
+	movq	%r12, %rcx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %r15
+	call	wavefrontMTLMerge@PLT
+	movl	%eax, (%rsp)
+	call	clock@PLT
+	movl	(%rsp), %edx
+	movq	8(%rsp), %r8
+	testl	%edx, %edx
+	je	.L77
+.L22:
+	movq	%rbx, %rdi
+	movq	%r8, (%rsp)
+	call	wavefrontMTLRelease@PLT
+	movq	(%rsp), %rbx
+	jmp	.L25
+.L74:
+	addl	$1, 20(%rsp)
+	movl	20(%rsp), %eax
+	addq	$112, %r12
+	cmpl	$4000, %eax
+	jne	.L28
+	movq	40(%rsp), %r8
+	movq	24(%rsp), %r14
+	movq	%rbx, %rdi
+	leaq	48(%rsp), %r12
+	movq	32(%rsp), %r13
+	movq	%r8, 8(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movl	$1, 236(%rsp)
+	call	clock@PLT
+	movl	$4000, %edx
+	movq	%r12, %rcx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %r15
+	call	wavefrontMTLMerge@PLT
+	movl	%eax, (%rsp)
+	call	clock@PLT
+	movl	(%rsp), %edx
+	movq	8(%rsp), %r8
+	testl	%edx, %edx
+	je	.L78
+.L34:
+	movq	%rbx, %rdi
+	movq	%r8, (%rsp)
+	call	wavefrontMTLRelease@PLT
+	movq	(%rsp), %rbx
+	jmp	.L37
+.L76:
+	subq	%r15, %rax
+	pxor	%xmm1, %xmm1
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	cvtsi2sdq	%rax, %xmm1
+	movq	.LC7(%rip), %rax
+	movl	152(%rsp), %ecx
+	leaq	.LC8(%rip), %rdx
+	divsd	.LC6(%rip), %xmm1
+	movsd	%xmm1, (%rsp)
+	movq	%rax, %xmm0
+	movl	$1, %eax
+	call	snprintf@PLT
+	movsd	(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	8(%rsp), %r8
+	comisd	%xmm0, %xmm1
+	jbe	.L59
+	movsd	.LC7(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L11:
+	movq	%rbp, %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$1, %eax
+	movq	%r8, (%rsp)
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	movq	(%rsp), %r8
+	jmp	.L10
+.L77:
+	subq	%r15, %rax
+	pxor	%xmm1, %xmm1
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	cvtsi2sdq	%rax, %xmm1
+	movq	.LC10(%rip), %rax
+	movl	152(%rsp), %ecx
+	leaq	.LC8(%rip), %rdx
+	divsd	.LC6(%rip), %xmm1
+	movsd	%xmm1, (%rsp)
+	movq	%rax, %xmm0
+	movl	$1, %eax
+	call	snprintf@PLT
+	movsd	(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	8(%rsp), %r8
+	comisd	%xmm0, %xmm1
+	jbe	.L60
+	movsd	.LC10(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L23:
+	movq	%rbp, %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$1, %eax
+	movq	%r8, (%rsp)
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	movq	(%rsp), %r8
+	jmp	.L22
+.L78:
+	subq	%r15, %rax
+	pxor	%xmm1, %xmm1
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	cvtsi2sdq	%rax, %xmm1
+	movq	.LC11(%rip), %rax
+	movl	152(%rsp), %ecx
+	leaq	.LC8(%rip), %rdx
+	divsd	.LC6(%rip), %xmm1
+	movsd	%xmm1, (%rsp)
+	movq	%rax, %xmm0
+	movl	$1, %eax
+	call	snprintf@PLT
+	movsd	(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	8(%rsp), %r8
+	comisd	%xmm0, %xmm1
+	jbe	.L61
+	movsd	.LC11(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L35:
+	movq	%rbp, %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$1, %eax
+	movq	%r8, (%rsp)
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	movq	(%rsp), %r8
+	jmp	.L34
+.L59:
+	pxor	%xmm0, %xmm0
+	jmp	.L11
+.L61:
+	pxor	%xmm0, %xmm0
+	jmp	.L35
+.L60:
+	pxor	%xmm0, %xmm0
+	jmp	.L23
+.L1:
+	addq	$264, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	wavefrontMaterialBench, .-wavefrontMaterialBench
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC2:
+	.long	1167867904
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC6:
+	.long	0
+	.long	1093567616
+	.align 8
+.LC7:
+	.long	0
+	.long	1086556160
+	.align 8
+.LC10:
+	.long	0
+	.long	1090021888
+	.align 8
+.LC11:
+	.long	0
+	.long	1092119040
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,400 @@
+	.file	"wavefront_material_compact_bench.c"
+	.text
+	.p2align 4
+	.type	liveRelease, @function
+liveRelease:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$8, %edx
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	leaq	-16(%rsi), %rbx
+	movq	%rbx, %rsi
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	leaq	8(%rsp), %rdi
+	call	memcpy@PLT
+	movq	8(%rsp), %rax
+	subq	%rax, 0(%rbp)
+	movq	%rbx, %rdi
+	call	free@PLT
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	liveRelease, .-liveRelease
+	.p2align 4
+	.type	liveReallocate, @function
+liveReallocate:
+.LFB23:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	leaq	-16(%rsi), %rbx
+	movq	%rbx, %rsi
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rdx, 8(%rsp)
+	leaq	24(%rsp), %rdi
+	movl	$8, %edx
+	call	memcpy@PLT
+	movq	8(%rsp), %rax
+	movq	%rbx, %rdi
+	leaq	16(%rax), %rsi
+	call	realloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L4
+	leaq	8(%rsp), %rsi
+	movl	$8, %edx
+	movq	%rax, %rdi
+	addq	$16, %rbx
+	call	memcpy@PLT
+	movq	8(%rsp), %rax
+	subq	24(%rsp), %rax
+	addq	%rax, 0(%rbp)
+.L4:
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	liveReallocate, .-liveReallocate
+	.p2align 4
+	.type	liveAllocate, @function
+liveAllocate:
+.LFB22:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	movq	%rsi, %rdi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	addq	$16, %rdi
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%rsi, 8(%rsp)
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L10
+	leaq	8(%rsp), %rsi
+	movl	$8, %edx
+	movq	%rax, %rdi
+	addq	$16, %rbx
+	call	memcpy@PLT
+	movq	8(%rsp), %rax
+	addq	%rax, 0(%rbp)
+.L10:
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	liveAllocate, .-liveAllocate
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"WavefrontMTL"
+.LC2:
+	.string	"WavefrontMTL arena"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC6:
+	.string	"newmtl Material_%06u\nNs 96.078431\nKa 1.000000 1.000000 1.000000\nKd %f %f %f\nKs 0.500000 0.500000 0.500000\nKe 0.000000 0.000000 0.000000\nNi 1.450000\nd 1.000000\nillum 2\nmap_Kd textures/diffuse_%02u.png\nmap_Bump -bm 0.5 textures/normal_%02u.png\n\n"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"%-44s %12.1f bytes/material\n"
+.LC10:
+	.string	"WavefrontCompactMTL"
+.LC11:
+	.string	"wavefrontCompactMTLCompose"
+.LC12:
+	.string	"%-44s %12.0f materials/sec\n"
+	.text
+	.p2align 4
+	.globl	wavefrontMaterialCompactBench
+	.type	wavefrontMaterialCompactBench, @function
+wavefrontMaterialCompactBench:
+.LFB27:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$32000000, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 400
+	call	malloc@PLT
+	testq	%rax, %rax
+	je	.L16
+	movq	%rax, %rbx
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$32000000, %ebp
+	leaq	.LC6(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	movl	%r13d, %r8d
+	movl	%r13d, %edx
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rsi
+	imulq	$274877907, %r8, %rax
+	subq	%r14, %rsi
+	leaq	(%rbx,%r14), %rdi
+	movl	%r13d, %ecx
+	imulq	$1374389535, %r8, %r8
+	movss	.LC4(%rip), %xmm2
+	shrq	$38, %rax
+	imull	$1000, %eax, %eax
+	shrq	$37, %r8
+	subl	%eax, %edx
+	imull	$100, %r8d, %eax
+	movl	%r13d, %r8d
+	addl	$1, %r13d
+	cvtsi2ssl	%edx, %xmm0
+	divss	.LC3(%rip), %xmm0
+	subss	%xmm0, %xmm2
+	movq	%r12, %rdx
+	movaps	%xmm0, %xmm1
+	cvtss2sd	%xmm0, %xmm0
+	divss	.LC5(%rip), %xmm1
+	cvtss2sd	%xmm1, %xmm1
+	subl	%eax, %r8d
+	movl	$3, %eax
+	movl	%r8d, %r9d
+	cvtss2sd	%xmm2, %xmm2
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	cmpl	$100000, %r13d
+	jne	.L18
+	leaq	liveAllocate(%rip), %rcx
+	leaq	80(%rsp), %r13
+	xorl	%esi, %esi
+	xorl	%ebp, %ebp
+	leaq	liveReallocate(%rip), %rax
+	movq	%rcx, %xmm0
+	movl	$40, %edx
+	movq	%r13, %rdi
+	movq	%rax, %xmm3
+	leaq	liveRelease(%rip), %rax
+	movq	$0, 16(%rsp)
+	leaq	24(%rsp), %r15
+	punpcklqdq	%xmm3, %xmm0
+	movq	%rax, 64(%rsp)
+	leaq	16(%rsp), %rax
+	leaq	224(%rsp), %r12
+	movaps	%xmm0, 48(%rsp)
+	movq	%rax, 72(%rsp)
+	call	memset@PLT
+	leaq	48(%rsp), %rax
+	leaq	.LC1(%rip), %rcx
+	movq	%rax, 104(%rsp)
+	movq	.LC7(%rip), %rax
+	movq	%rcx, %xmm0
+	movq	%rax, 24(%rsp)
+	leaq	.LC2(%rip), %rax
+	movq	%rax, %xmm4
+	punpcklqdq	%xmm4, %xmm0
+	movaps	%xmm0, 32(%rsp)
+.L36:
+	movl	(%r15,%rbp,4), %eax
+	movq	%r13, %rcx
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	%eax, 84(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	jne	.L19
+	movq	%r12, %rdi
+	call	wavefrontMTLShrinkToFit@PLT
+	movl	232(%rsp), %eax
+	movq	16(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movq	32(%rsp,%rbp,8), %rsi
+	testl	%eax, %eax
+	je	.L20
+	testq	%rdx, %rdx
+	js	.L21
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rdx, %xmm0
+.L22:
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rax, %xmm1
+	divsd	%xmm1, %xmm0
+.L20:
+	leaq	.LC8(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	cmpq	$1, %rbp
+	je	.L49
+	movq	%r12, %rdi
+	movl	$1, %ebp
+	call	wavefrontMTLRelease@PLT
+	jmp	.L36
+.L49:
+	movq	16(%rsp), %r8
+	leaq	128(%rsp), %rbp
+	movq	%r8, 8(%rsp)
+	call	clock@PLT
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %r13
+	call	wavefrontCompactMTLCompose@PLT
+	movl	%eax, %r15d
+	call	clock@PLT
+	movq	%rax, %rcx
+	testl	%r15d, %r15d
+	jne	.L26
+	movl	136(%rsp), %edx
+	movq	16(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	testl	%edx, %edx
+	je	.L27
+	movq	8(%rsp), %r8
+	subq	%r8, %rax
+	js	.L28
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L29:
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rdx, %xmm1
+	divsd	%xmm1, %xmm0
+.L27:
+	movq	%rcx, %rax
+	pxor	%xmm1, %xmm1
+	leaq	.LC10(%rip), %rsi
+	subq	%r13, %rax
+	leaq	.LC8(%rip), %rdi
+	cvtsi2sdq	%rax, %xmm1
+	movl	$1, %eax
+	divsd	.LC9(%rip), %xmm1
+	movsd	%xmm1, 8(%rsp)
+	call	printf@PLT
+	movsd	8(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm1
+	jbe	.L47
+	movl	136(%rsp), %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+	divsd	%xmm1, %xmm0
+.L32:
+	leaq	.LC12(%rip), %rdi
+	leaq	.LC11(%rip), %rsi
+	movl	$1, %eax
+	call	printf@PLT
+	movq	%rbp, %rdi
+	call	wavefrontCompactMTLRelease@PLT
+.L26:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+.L19:
+	movq	%rbx, %rdi
+	call	free@PLT
+.L16:
+	addq	$344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L21:
+	.cfi_restore_state
+	movq	%rdx, %rcx
+	andl	$1, %edx
+	pxor	%xmm0, %xmm0
+	shrq	%rcx
+	orq	%rdx, %rcx
+	cvtsi2sdq	%rcx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L22
+.L47:
+	pxor	%xmm0, %xmm0
+	jmp	.L32
+.L28:
+	movq	%rax, %rsi
+	andl	$1, %eax
+	pxor	%xmm0, %xmm0
+	shrq	%rsi
+	orq	%rax, %rsi
+	cvtsi2sdq	%rsi, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L29
+	.cfi_endproc
+.LFE27:
+	.size	wavefrontMaterialCompactBench, .-wavefrontMaterialCompactBench
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC3:
+	.long	1148829696
+	.align 4
+.LC4:
+	.long	1065353216
+	.align 4
+.LC5:
+	.long	1077936128
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC7:
+	.long	0
+	.long	1
+	.align 8
+.LC9:
+	.long	0
+	.long	1093567616
+	.section	.note.GNU-stack,"",@progbits
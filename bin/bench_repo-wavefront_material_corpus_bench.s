@@ -0,0 +1,686 @@
+	.file	"wavefront_material_corpus_bench.c"
+	.text
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC8:
+	.string	"newmtl colored_%06u\nKa %.9g %.9g %.9g\nKd %.9g %.9g %.9g\nKs %.9g %.9g %.9g\nKe %.9g %.9g %.9g\nTf %.9g %.9g %.9g\n\n"
+	.text
+	.p2align 4
+	.type	writeColorMaterial, @function
+writeColorMaterial:
+.LFB29:
+	.cfi_startproc
+	movl	%edx, %eax
+	pxor	%xmm0, %xmm0
+	pxor	%xmm10, %xmm10
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rax, %rcx
+	imulq	$274877907, %rax, %rax
+	movss	.LC2(%rip), %xmm2
+	movss	.LC3(%rip), %xmm8
+	movl	%ecx, %edx
+	movaps	%xmm8, %xmm7
+	movaps	%xmm8, %xmm3
+	shrq	$38, %rax
+	imull	$1000, %eax, %eax
+	subl	%eax, %edx
+	movl	$8, %eax
+	cvtsi2ssl	%edx, %xmm0
+	divss	.LC0(%rip), %xmm0
+	mulss	%xmm0, %xmm2
+	movaps	%xmm0, %xmm1
+	subss	%xmm0, %xmm3
+	cvtss2sd	%xmm0, %xmm10
+	movaps	%xmm0, %xmm6
+	movaps	%xmm0, %xmm5
+	divss	.LC1(%rip), %xmm1
+	subss	%xmm1, %xmm8
+	movaps	%xmm0, %xmm4
+	movaps	%xmm0, %xmm9
+	leaq	.LC8(%rip), %rdx
+	divss	.LC4(%rip), %xmm6
+	cvtss2sd	%xmm1, %xmm1
+	divss	.LC9(%rip), %xmm9
+	cvtss2sd	%xmm9, %xmm9
+	movsd	%xmm9, 48(%rsp)
+	movaps	%xmm0, %xmm9
+	cvtss2sd	%xmm6, %xmm6
+	subss	%xmm2, %xmm7
+	cvtss2sd	%xmm8, %xmm8
+	movaps	%xmm0, %xmm2
+	movsd	%xmm8, 32(%rsp)
+	movaps	%xmm0, %xmm8
+	divss	.LC5(%rip), %xmm5
+	cvtss2sd	%xmm3, %xmm3
+	divss	.LC11(%rip), %xmm8
+	cvtss2sd	%xmm8, %xmm8
+	movsd	%xmm8, 24(%rsp)
+	movaps	%xmm0, %xmm8
+	divss	.LC12(%rip), %xmm8
+	cvtss2sd	%xmm8, %xmm8
+	movsd	%xmm8, 16(%rsp)
+	movaps	%xmm0, %xmm8
+	divss	.LC14(%rip), %xmm0
+	cvtss2sd	%xmm0, %xmm0
+	movsd	%xmm0, (%rsp)
+	movapd	%xmm10, %xmm0
+	divss	.LC6(%rip), %xmm4
+	divss	.LC7(%rip), %xmm2
+	cvtss2sd	%xmm7, %xmm7
+	cvtss2sd	%xmm5, %xmm5
+	cvtss2sd	%xmm4, %xmm4
+	divss	.LC10(%rip), %xmm9
+	cvtss2sd	%xmm2, %xmm2
+	cvtss2sd	%xmm9, %xmm9
+	divss	.LC13(%rip), %xmm8
+	movsd	%xmm9, 40(%rsp)
+	cvtss2sd	%xmm8, %xmm8
+	movsd	%xmm8, 8(%rsp)
+	call	snprintf@PLT
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 8
+	cltq
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	writeColorMaterial, .-writeColorMaterial
+	.section	.rodata.str1.8
+	.align 8
+.LC15:
+	.ascii	"newmtl textured_%06u\nmap_Ka -clamp on textures/%06u_ambient"
+	.ascii	".png\nmap_Kd -o 0.5 0.5 -s 2 2 textures/%06u_diff"
+	.string	"use.png\nmap_Ks -blendu off -blendv off textures/%06u_specular.png\nmap_Ns textures/%06u_highlight.png\nmap_d -imfchan m textures/%06u_alpha.png\nbump -bm 0.8 textures/%06u_bump.png\nmap_Pr textures/%06u_roughness.png\nmap_Pm -mm 0 1 textures/%06u_metallic.png\n\n"
+	.text
+	.p2align 4
+	.type	writeTextureMaterial, @function
+writeTextureMaterial:
+.LFB28:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	movl	%edx, %ecx
+	movl	%edx, %r9d
+	movl	%edx, %r8d
+	pushq	%rdx
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	pushq	%rdx
+	.cfi_def_cfa_offset 32
+	pushq	%rdx
+	.cfi_def_cfa_offset 40
+	pushq	%rdx
+	.cfi_def_cfa_offset 48
+	pushq	%rdx
+	.cfi_def_cfa_offset 56
+	pushq	%rdx
+	.cfi_def_cfa_offset 64
+	leaq	.LC15(%rip), %rdx
+	call	snprintf@PLT
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 8
+	cltq
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	writeTextureMaterial, .-writeTextureMaterial
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC16:
+	.string	"newmtl heavy_%05u\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC17:
+	.ascii	"# pass %u\nNs 96.078431\nNi 1.450000\nd 1.000000\nTr 0.00000"
+	.ascii	"0\nillum 2\nKa 1.000000 1.000000 1.000000\nKd 0.640000 0.640"
+	.ascii	"000 0.640000\nKs 0.500000 0.500000 0.500000\nKe 0.000000 0.0"
+	.ascii	"00000 0.000000\nTf 1.000000 1.000000 1.000000\nPr 0.500000\n"
+	.ascii	"Pm 0.000000\nPs 0.000000\nPc 0.000000\nPcr 0.030000\naniso 0"
+	.ascii	".000000\nanisor 0.000000\nmap_Ka ambient.png\n"
+	.string	"map_Kd -s 1 1 1 diffuse.png\nmap_Ks specular.png\nmap_Ke emission.png\nmap_Ns highlight.png\nmap_d alpha.png\nmap_Bump -bm 0.5 normal.png\ndisp displacement.png\ndecal decal.png\nmap_Pr roughness.png\nmap_Pm metallic.png\nmap_Ps sheen.png\nrefl -type sphere sky.png\n\n"
+	.text
+	.p2align 4
+	.type	writeHeavyMaterial, @function
+writeHeavyMaterial:
+.LFB27:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	%edx, %ecx
+	xorl	%eax, %eax
+	leaq	.LC16(%rip), %rdx
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	call	snprintf@PLT
+	movslq	%eax, %rbx
+	cmpq	%r12, %rbx
+	jnb	.L6
+	xorl	%ebp, %ebp
+	leaq	.LC17(%rip), %r14
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	movq	%r12, %rsi
+	leaq	0(%r13,%rbx), %rdi
+	movl	%ebp, %ecx
+	movq	%r14, %rdx
+	subq	%rbx, %rsi
+	xorl	%eax, %eax
+	addl	$1, %ebp
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbx
+	cmpl	$7, %ebp
+	ja	.L6
+	cmpq	%r12, %rbx
+	jb	.L8
+.L6:
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	writeHeavyMaterial, .-writeHeavyMaterial
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"newmtl tiny_%07u\nKd 0.5 0.5 0.5\n"
+	.text
+	.p2align 4
+	.type	writeTinyMaterial, @function
+writeTinyMaterial:
+.LFB26:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	movl	%edx, %ecx
+	leaq	.LC18(%rip), %rdx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	cltq
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	writeTinyMaterial, .-writeTinyMaterial
+	.p2align 4
+	.globl	__wrap_malloc
+	.type	__wrap_malloc, @function
+__wrap_malloc:
+.LFB22:
+	.cfi_startproc
+	movl	counting(%rip), %eax
+	testl	%eax, %eax
+	je	.L18
+	addq	$1, allocations(%rip)
+	addq	%rdi, allocatedBytes(%rip)
+.L18:
+	jmp	__real_malloc@PLT
+	.cfi_endproc
+.LFE22:
+	.size	__wrap_malloc, .-__wrap_malloc
+	.p2align 4
+	.globl	__wrap_calloc
+	.type	__wrap_calloc, @function
+__wrap_calloc:
+.LFB23:
+	.cfi_startproc
+	movl	counting(%rip), %eax
+	testl	%eax, %eax
+	je	.L20
+	movq	%rdi, %rax
+	addq	$1, allocations(%rip)
+	imulq	%rsi, %rax
+	addq	%rax, allocatedBytes(%rip)
+.L20:
+	jmp	__real_calloc@PLT
+	.cfi_endproc
+.LFE23:
+	.size	__wrap_calloc, .-__wrap_calloc
+	.p2align 4
+	.globl	__wrap_realloc
+	.type	__wrap_realloc, @function
+__wrap_realloc:
+.LFB24:
+	.cfi_startproc
+	movl	counting(%rip), %eax
+	testl	%eax, %eax
+	je	.L22
+	addq	$1, allocations(%rip)
+	addq	%rsi, allocatedBytes(%rip)
+.L22:
+	jmp	__real_realloc@PLT
+	.cfi_endproc
+.LFE24:
+	.size	__wrap_realloc, .-__wrap_realloc
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"{\"corpus\":\"%s\",\"bytes\":%lu,\"materials\":%u,\"parse_mb_per_sec\":%.3f,\"parse_materials_per_sec\":%.0f,\"release_materials_per_sec\":%.0f,"
+	.align 8
+.LC23:
+	.string	"\"allocations_per_material\":%.3f,\"allocated_bytes_per_material\":%.1f,"
+	.section	.rodata.str1.1
+.LC24:
+	.string	"\"peak_rss_kib\":%llu}\n"
+.LC25:
+	.string	"corpus %s %lu KiB"
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"%-28s %8.1f MB/sec %10.0f materials/sec %10.0f released/sec"
+	.section	.rodata.str1.1
+.LC27:
+	.string	" %6.2f allocs/material"
+.LC28:
+	.string	" %8llu KiB peak RSS\n"
+	.text
+	.p2align 4
+	.globl	wavefrontMaterialCorpusBench
+	.type	wavefrontMaterialCorpusBench, @function
+wavefrontMaterialCorpusBench:
+.LFB33:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	corpora(%rip), %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 432
+	movq	%rax, 24(%rsp)
+	leaq	48(%rsp), %rax
+	movl	%edi, 44(%rsp)
+	movq	%rax, 32(%rsp)
+.L24:
+	leaq	corpusSizes(%rip), %rax
+	movq	%rax, 16(%rsp)
+.L53:
+	movq	16(%rsp), %rax
+	movq	(%rax), %rbp
+	movq	24(%rsp), %rax
+	leaq	16384(%rbp), %r12
+	movq	8(%rax), %r13
+	movq	%r12, %rdi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L23
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	testq	%rbp, %rbp
+	je	.L27
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	movq	%r12, %rsi
+	leaq	(%rbx,%r15), %rdi
+	movl	%r14d, %edx
+	addl	$1, %r14d
+	subq	%r15, %rsi
+	call	*%r13
+	addq	%rax, %r15
+	cmpq	%rbp, %r15
+	jb	.L26
+.L27:
+	movq	32(%rsp), %rdi
+	movl	$64, %edx
+	xorl	%esi, %esi
+	leaq	112(%rsp), %r12
+	call	memset@PLT
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%r15, 48(%rsp)
+	movq	$0, allocatedBytes(%rip)
+	movq	$0, allocations(%rip)
+	movl	$1, counting(%rip)
+	call	parseWavefrontMTLFromString@PLT
+	movl	$0, counting(%rip)
+	testl	%eax, %eax
+	jne	.L52
+	movl	120(%rsp), %eax
+	movq	%r12, %rdi
+	movl	%eax, 56(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	56(%rsp), %eax
+	testl	%eax, %eax
+	je	.L30
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rax, %xmm1
+	movq	allocations(%rip), %rax
+	testq	%rax, %rax
+	js	.L33
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+	movq	allocatedBytes(%rip), %rax
+	testq	%rax, %rax
+	js	.L35
+.L72:
+	pxor	%xmm2, %xmm2
+	cvtsi2sdq	%rax, %xmm2
+.L36:
+	unpcklpd	%xmm2, %xmm0
+	unpcklpd	%xmm1, %xmm1
+	divpd	%xmm1, %xmm0
+	movups	%xmm0, 88(%rsp)
+.L30:
+	call	clock@PLT
+	xorl	%r14d, %r14d
+	xorl	%ebp, %ebp
+	xorl	%r13d, %r13d
+	movq	%rax, 8(%rsp)
+	jmp	.L38
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	call	clock@PLT
+	movq	%r12, %rdi
+	addl	$1, %r13d
+	movq	%rax, %rbp
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	subq	%rbp, %rax
+	addq	%rax, %r14
+	call	clock@PLT
+	movq	8(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movsd	.LC19(%rip), %xmm5
+	subq	%rcx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbp
+	comisd	%xmm0, %xmm5
+	jbe	.L37
+.L38:
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L70
+.L37:
+	movl	56(%rsp), %eax
+	pxor	%xmm4, %xmm4
+	pxor	%xmm2, %xmm2
+	subq	%r14, %rbp
+	cvtsi2sdq	%r13, %xmm4
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rax, %xmm2
+	pxor	%xmm3, %xmm3
+	cvtsi2sdq	%rbp, %xmm0
+	divsd	.LC20(%rip), %xmm0
+	comisd	%xmm1, %xmm0
+	cvtsi2sdq	%r14, %xmm3
+	divsd	.LC20(%rip), %xmm3
+	mulsd	%xmm4, %xmm2
+	jbe	.L43
+	testq	%r15, %r15
+	js	.L45
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%r15, %xmm1
+.L46:
+	mulsd	%xmm4, %xmm1
+	unpcklpd	%xmm0, %xmm0
+	unpcklpd	%xmm2, %xmm1
+	divpd	%xmm0, %xmm1
+	movaps	%xmm1, 64(%rsp)
+.L43:
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm3
+	jbe	.L47
+	divsd	%xmm3, %xmm2
+	movsd	%xmm2, 80(%rsp)
+.L47:
+	leaq	224(%rsp), %rbp
+	xorl	%edi, %edi
+	movq	%rbp, %rsi
+	call	getrusage@PLT
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	testl	%edx, %edx
+	jne	.L49
+	movq	256(%rsp), %rax
+.L49:
+	movq	%rax, 104(%rsp)
+	movq	24(%rsp), %rax
+	movq	48(%rsp), %r8
+	movq	(%rax), %rsi
+	movl	44(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L71
+	movq	%rsi, %rcx
+	shrq	$10, %r8
+	leaq	.LC25(%rip), %rdx
+	xorl	%eax, %eax
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	call	snprintf@PLT
+	movsd	80(%rsp), %xmm2
+	movq	%rbp, %rsi
+	movsd	72(%rsp), %xmm1
+	leaq	.LC26(%rip), %rdi
+	movl	$3, %eax
+	movsd	64(%rsp), %xmm0
+	divsd	.LC20(%rip), %xmm0
+	call	printf@PLT
+	movsd	88(%rsp), %xmm0
+	movl	$1, %eax
+	leaq	.LC27(%rip), %rdi
+	call	printf@PLT
+	movq	104(%rsp), %rsi
+	leaq	.LC28(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.L52:
+	movq	%rbx, %rdi
+	call	free@PLT
+	addq	$8, 16(%rsp)
+	movq	16(%rsp), %rax
+	leaq	16+corpusSizes(%rip), %rcx
+	cmpq	%rax, %rcx
+	jne	.L53
+	addq	$16, 24(%rsp)
+	movq	24(%rsp), %rax
+	leaq	64+corpora(%rip), %rcx
+	cmpq	%rcx, %rax
+	jne	.L24
+.L23:
+	addq	$376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+	movq	%r15, %rax
+	movq	%r15, %rcx
+	pxor	%xmm1, %xmm1
+	shrq	%rax
+	andl	$1, %ecx
+	orq	%rcx, %rax
+	cvtsi2sdq	%rax, %xmm1
+	addsd	%xmm1, %xmm1
+	jmp	.L46
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	movsd	80(%rsp), %xmm2
+	movl	56(%rsp), %ecx
+	movq	%r8, %rdx
+	movl	$3, %eax
+	movsd	72(%rsp), %xmm1
+	leaq	.LC22(%rip), %rdi
+	movsd	64(%rsp), %xmm0
+	divsd	.LC20(%rip), %xmm0
+	call	printf@PLT
+	movsd	96(%rsp), %xmm1
+	movsd	88(%rsp), %xmm0
+	leaq	.LC23(%rip), %rdi
+	movl	$2, %eax
+	call	printf@PLT
+	movq	104(%rsp), %rsi
+	leaq	.LC24(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	jmp	.L52
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	movq	%rax, %rdx
+	andl	$1, %eax
+	pxor	%xmm0, %xmm0
+	shrq	%rdx
+	orq	%rax, %rdx
+	movq	allocatedBytes(%rip), %rax
+	cvtsi2sdq	%rdx, %xmm0
+	addsd	%xmm0, %xmm0
+	testq	%rax, %rax
+	jns	.L72
+.L35:
+	movq	%rax, %rdx
+	andl	$1, %eax
+	pxor	%xmm2, %xmm2
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm2
+	addsd	%xmm2, %xmm2
+	jmp	.L36
+	.cfi_endproc
+.LFE33:
+	.size	wavefrontMaterialCorpusBench, .-wavefrontMaterialCorpusBench
+	.section	.rodata
+	.align 16
+	.type	corpusSizes, @object
+	.size	corpusSizes, 16
+corpusSizes:
+	.quad	65536
+	.quad	1048576
+	.section	.rodata.str1.1
+.LC29:
+	.string	"tiny"
+.LC30:
+	.string	"heavy"
+.LC31:
+	.string	"textures"
+.LC32:
+	.string	"colors"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	corpora, @object
+	.size	corpora, 64
+corpora:
+	.quad	.LC29
+	.quad	writeTinyMaterial
+	.quad	.LC30
+	.quad	writeHeavyMaterial
+	.quad	.LC31
+	.quad	writeTextureMaterial
+	.quad	.LC32
+	.quad	writeColorMaterial
+	.local	allocatedBytes
+	.comm	allocatedBytes,8,8
+	.local	allocations
+	.comm	allocations,8,8
+	.local	counting
+	.comm	counting,4,4
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	1148829696
+	.align 4
+.LC1:
+	.long	1077936128
+	.align 4
+.LC2:
+	.long	1056964608
+	.align 4
+.LC3:
+	.long	1065353216
+	.align 4
+.LC4:
+	.long	1099431936
+	.align 4
+.LC5:
+	.long	1095761920
+	.align 4
+.LC6:
+	.long	1093664768
+	.align 4
+.LC7:
+	.long	1088421888
+	.align 4
+.LC9:
+	.long	1109655552
+	.align 4
+.LC10:
+	.long	1108606976
+	.align 4
+.LC11:
+	.long	1106771968
+	.align 4
+.LC12:
+	.long	1105723392
+	.align 4
+.LC13:
+	.long	1102577664
+	.align 4
+.LC14:
+	.long	1100480512
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC19:
+	.long	0
+	.long	1092519040
+	.align 8
+.LC20:
+	.long	0
+	.long	1093567616
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2715 @@
+	.file	"wavefront_material_parser_bench.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"%-44s %12.0f materials/sec\n"
+	.text
+	.p2align 4
+	.type	benchRelease, @function
+benchRelease:
+.LFB23:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1896, %rsp
+	.cfi_def_cfa_offset 1952
+	leaq	96(%rsp), %rax
+	movaps	%xmm0, 48(%rsp)
+	leaq	48(%rsp), %r14
+	movq	%rdi, 40(%rsp)
+	movq	$0, 80(%rsp)
+	movl	%edx, 52(%rsp)
+	movl	$4, 36(%rsp)
+	movq	$0, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	movaps	%xmm0, 64(%rsp)
+.L2:
+	movq	8(%rsp), %rbx
+	xorl	%r15d, %r15d
+	movq	%rbx, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movq	%r12, %rdi
+	call	strlen@PLT
+	movq	%r14, %rcx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	jne	.L3
+	addl	$1, %r15d
+	addl	8(%rbx), %r13d
+	addq	$112, %rbx
+	cmpl	$16, %r15d
+	jne	.L4
+	call	clock@PLT
+	movq	%rax, 16(%rsp)
+.L13:
+	movl	%r15d, %r8d
+	movq	8(%rsp), %rax
+	leaq	0(,%r8,8), %rbx
+	subq	%r8, %rbx
+	salq	$4, %rbx
+	addq	%rax, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	movq	%rbp, %rdi
+	addq	$112, %rbp
+	call	wavefrontMTLRelease@PLT
+	cmpq	%rbp, %rbx
+	jne	.L7
+.L6:
+	call	clock@PLT
+	movq	16(%rsp), %rsi
+	subq	%rsi, %rax
+	addq	%rax, 24(%rsp)
+	subl	$1, 36(%rsp)
+	jne	.L2
+	pxor	%xmm1, %xmm1
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	24(%rsp), %xmm1
+	divsd	.LC1(%rip), %xmm1
+	comisd	%xmm0, %xmm1
+	jbe	.L22
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r13, %xmm0
+	divsd	%xmm1, %xmm0
+.L9:
+	movq	40(%rsp), %rsi
+	leaq	.LC2(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	addq	$1896, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.cfi_restore_state
+	call	clock@PLT
+	movq	%rax, 16(%rsp)
+	testl	%r15d, %r15d
+	jne	.L13
+	jmp	.L6
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	pxor	%xmm0, %xmm0
+	jmp	.L9
+	.cfi_endproc
+.LFE23:
+	.size	benchRelease, .-benchRelease
+	.section	.rodata.str1.1
+.LC4:
+	.string	"bin/bench_library.mtl"
+.LC5:
+	.string	"rb"
+.LC7:
+	.string	"parseWavefrontMTLFromFile"
+.LC8:
+	.string	"%s %u materials"
+.LC9:
+	.string	"%-44s %12.0f files/sec\n"
+.LC10:
+	.string	"fread + parseFromString"
+	.text
+	.p2align 4
+	.type	benchParseFile.part.0, @function
+benchParseFile.part.0:
+.LFB40:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+	movl	$0, 8(%rsp)
+	leaq	32(%rsp), %r14
+	movl	%edi, 28(%rsp)
+.L43:
+	call	clock@PLT
+	xorl	%ebx, %ebx
+	xorl	%r13d, %r13d
+	movq	%rax, 16(%rsp)
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	xorl	%edx, %edx
+	leaq	.LC4(%rip), %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	movl	%eax, %r12d
+	testl	%r12d, %r12d
+	jne	.L34
+.L60:
+	movq	%r14, %rdi
+	addl	$1, %r13d
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	movq	16(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm2
+	subq	%rcx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbx
+	comisd	%xmm0, %xmm2
+	jbe	.L36
+.L35:
+	movl	8(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L57
+	leaq	.LC5(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	fopen@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L29
+	movl	$2, %edx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	fseek@PLT
+	movq	%r12, %rdi
+	call	ftell@PLT
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	movq	%rax, %rbp
+	call	fseek@PLT
+	leaq	1(%rbp), %rdi
+	call	malloc@PLT
+	movq	%rax, %r15
+	testq	%rax, %rax
+	je	.L32
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movl	$1, %esi
+	movq	%rax, %rdi
+	call	fread@PLT
+	cmpq	%rax, %rbp
+	je	.L58
+.L32:
+	movq	%r12, %rdi
+	call	fclose@PLT
+	movq	%r15, %rdi
+	call	free@PLT
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+	divsd	.LC1(%rip), %xmm0
+.L33:
+	movl	28(%rsp), %r8d
+	xorl	%eax, %eax
+	movl	$64, %esi
+	movq	%r14, %rdi
+	leaq	.LC10(%rip), %rcx
+	leaq	.LC8(%rip), %rdx
+	movsd	%xmm0, 8(%rsp)
+	call	snprintf@PLT
+	movsd	8(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	jbe	.L59
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%r13, %xmm1
+	divsd	%xmm0, %xmm1
+	movapd	%xmm1, %xmm0
+.L56:
+	movq	%r14, %rsi
+	leaq	.LC9(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	movl	$1, 8(%rsp)
+	jmp	.L43
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	movq	%r12, %rdi
+	call	fclose@PLT
+	movb	$0, (%r15,%rbp)
+	movq	%r14, %rdi
+	movq	%r15, %rsi
+	call	parseWavefrontMTLFromString@PLT
+	movq	%r15, %rdi
+	movl	%eax, %r12d
+	call	free@PLT
+	testl	%r12d, %r12d
+	je	.L60
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	movl	8(%rsp), %eax
+	divsd	.LC1(%rip), %xmm0
+	testl	%eax, %eax
+	je	.L33
+	movl	28(%rsp), %r8d
+	xorl	%eax, %eax
+	movl	$64, %esi
+	movq	%r14, %rdi
+	leaq	.LC7(%rip), %rcx
+	leaq	.LC8(%rip), %rdx
+	movsd	%xmm0, 8(%rsp)
+	call	snprintf@PLT
+	movsd	8(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	jbe	.L53
+	pxor	%xmm1, %xmm1
+	movq	%r14, %rsi
+	movl	$1, %eax
+	cvtsi2sdq	%r13, %xmm1
+	leaq	.LC9(%rip), %rdi
+	divsd	%xmm0, %xmm1
+	movapd	%xmm1, %xmm0
+	call	printf@PLT
+.L41:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	leaq	.LC4(%rip), %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	remove@PLT
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.cfi_restore_state
+	pxor	%xmm0, %xmm0
+	movq	%r14, %rsi
+	movl	$1, %eax
+	leaq	.LC9(%rip), %rdi
+	call	printf@PLT
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	pxor	%xmm0, %xmm0
+	jmp	.L56
+.L29:
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+	divsd	.LC1(%rip), %xmm0
+	jmp	.L33
+	.cfi_endproc
+.LFE40:
+	.size	benchParseFile.part.0, .-benchParseFile.part.0
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC11:
+	.string	"newmtl Material_%06u\nNs 96.078431\nKa 1.000000 1.000000 1.000000\nKd 0.640000 0.640000 0.640000\nKs 0.500000 0.500000 0.500000\nNi 1.000000\nd 1.000000\nillum 2\nmap_Kd textures/diffuse_%03u.png\n\n"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"tolerant"
+.LC13:
+	.string	"%s %u materials %s"
+.LC14:
+	.string	"%-44s %12.1f MB/sec\n"
+.LC15:
+	.string	"wavefrontMTLParserFeed"
+.LC16:
+	.string	"parseWavefrontMTLFromBuffer"
+.LC17:
+	.string	"strict"
+	.text
+	.p2align 4
+	.type	benchParseTolerant.constprop.0, @function
+benchParseTolerant.constprop.0:
+.LFB42:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$25600001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1016, %rsp
+	.cfi_def_cfa_offset 1072
+	call	malloc@PLT
+	testq	%rax, %rax
+	je	.L61
+	movq	%rax, %r14
+	xorl	%r13d, %r13d
+	xorl	%r12d, %r12d
+	movl	$25600001, %ebx
+	leaq	.LC11(%rip), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	movl	%r12d, %eax
+	movl	%r12d, %r8d
+	movq	%rbx, %rsi
+	movl	%r12d, %ecx
+	subq	%r13, %rsi
+	leaq	(%r14,%r13), %rdi
+	movq	%rbp, %rdx
+	addl	$1, %r12d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r13
+	cmpl	$100000, %r12d
+	jne	.L63
+	movq	%r14, %rdi
+	leaq	240(%rsp), %rbp
+	call	strlen@PLT
+	movl	$0, 68(%rsp)
+	movq	%rax, %rbx
+	leaq	368(%rsp), %rax
+	movq	$0, 60(%rsp)
+	movq	%rax, 48(%rsp)
+	leaq	80(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	leaq	128(%rsp), %rax
+	movl	$16, 56(%rsp)
+	movl	$0, 32(%rsp)
+	movq	%rax, 8(%rsp)
+.L64:
+	movl	32(%rsp), %eax
+	leaq	.LC16(%rip), %rcx
+	pxor	%xmm0, %xmm0
+	movq	$0, 112(%rsp)
+	movl	$0, 36(%rsp)
+	testl	%eax, %eax
+	leaq	.LC15(%rip), %rax
+	movaps	%xmm0, 80(%rsp)
+	cmovne	%rax, %rcx
+	movaps	%xmm0, 96(%rsp)
+	movq	%rcx, 40(%rsp)
+.L84:
+	call	clock@PLT
+	xorl	%r12d, %r12d
+	xorl	%r13d, %r13d
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	movl	32(%rsp), %esi
+	testl	%esi, %esi
+	je	.L65
+	movq	24(%rsp), %rdx
+	movq	8(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLParserCompose@PLT
+	testq	%rbx, %rbx
+	je	.L66
+	testl	%eax, %eax
+	jne	.L70
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	movq	%rbx, %rdx
+	movl	$65536, %eax
+	leaq	(%r14,%r15), %rsi
+	movq	%rbp, %rdi
+	subq	%r15, %rdx
+	cmpq	%rax, %rdx
+	cmova	%rax, %rdx
+	addq	$65536, %r15
+	call	wavefrontMTLParserFeed@PLT
+	testl	%eax, %eax
+	jne	.L70
+	cmpq	%rbx, %r15
+	jb	.L67
+.L66:
+	testl	%eax, %eax
+	jne	.L70
+	movq	%rbp, %rdi
+	call	wavefrontMTLParserFinish@PLT
+	testl	%eax, %eax
+	jne	.L70
+.L114:
+	movq	8(%rsp), %rdi
+	addl	$1, %r13d
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	movq	16(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm3
+	subq	%rcx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %r12
+	comisd	%xmm0, %xmm3
+	ja	.L72
+.L73:
+	movl	36(%rsp), %ecx
+	divsd	.LC1(%rip), %xmm0
+	movsd	%xmm0, 16(%rsp)
+	testl	%ecx, %ecx
+	je	.L74
+	movq	40(%rsp), %rcx
+	xorl	%eax, %eax
+	movl	$100000, %r8d
+	movq	%rbp, %rdi
+	leaq	.LC12(%rip), %r9
+	leaq	.LC13(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movsd	16(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	jbe	.L107
+	testq	%rbx, %rbx
+	js	.L77
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rbx, %xmm1
+.L78:
+	pxor	%xmm2, %xmm2
+	movq	%rbp, %rsi
+	divsd	.LC1(%rip), %xmm1
+	leaq	.LC14(%rip), %rdi
+	cvtsi2sdq	%r13, %xmm2
+	movl	$1, %eax
+	mulsd	%xmm2, %xmm1
+	divsd	%xmm0, %xmm1
+	movapd	%xmm1, %xmm0
+	call	printf@PLT
+.L81:
+	movl	32(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L83
+	movl	36(%rsp), %eax
+	movl	%eax, 32(%rsp)
+	jmp	.L64
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	movq	24(%rsp), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	je	.L114
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r12, %xmm0
+	jmp	.L73
+.L74:
+	movq	40(%rsp), %rcx
+	xorl	%eax, %eax
+	movl	$100000, %r8d
+	movq	%rbp, %rdi
+	leaq	.LC17(%rip), %r9
+	leaq	.LC13(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movsd	16(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	jbe	.L115
+	testq	%rbx, %rbx
+	js	.L85
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rbx, %xmm1
+.L86:
+	pxor	%xmm2, %xmm2
+	movq	%rbp, %rsi
+	divsd	.LC1(%rip), %xmm1
+	leaq	.LC14(%rip), %rdi
+	cvtsi2sdq	%r13, %xmm2
+	movl	$1, %eax
+	mulsd	%xmm2, %xmm1
+	divsd	%xmm0, %xmm1
+	movapd	%xmm1, %xmm0
+	call	printf@PLT
+.L82:
+	pxor	%xmm0, %xmm0
+	leaq	48(%rsp), %rax
+	movl	$1, 36(%rsp)
+	movq	%rax, 112(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	jmp	.L84
+.L83:
+	movq	%r14, %rdi
+	call	free@PLT
+.L61:
+	addq	$1016, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L107:
+	.cfi_restore_state
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rsi
+	movl	$1, %eax
+	leaq	.LC14(%rip), %rdi
+	call	printf@PLT
+	jmp	.L81
+.L77:
+	movq	%rbx, %rax
+	movq	%rbx, %rdx
+	pxor	%xmm1, %xmm1
+	shrq	%rax
+	andl	$1, %edx
+	orq	%rdx, %rax
+	cvtsi2sdq	%rax, %xmm1
+	addsd	%xmm1, %xmm1
+	jmp	.L78
+.L85:
+	movq	%rbx, %rax
+	movq	%rbx, %rdx
+	pxor	%xmm1, %xmm1
+	shrq	%rax
+	andl	$1, %edx
+	orq	%rdx, %rax
+	cvtsi2sdq	%rax, %xmm1
+	addsd	%xmm1, %xmm1
+	jmp	.L86
+.L115:
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rsi
+	movl	$1, %eax
+	leaq	.LC14(%rip), %rdi
+	call	printf@PLT
+	jmp	.L82
+	.cfi_endproc
+.LFE42:
+	.size	benchParseTolerant.constprop.0, .-benchParseTolerant.constprop.0
+	.section	.rodata.str1.1
+.LC18:
+	.string	"Material_%06u"
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"wavefrontMTLIndex %u materials 1/%u used"
+	.align 8
+.LC20:
+	.string	"parseWavefrontMTLFromBuffer %u materials"
+	.section	.rodata.str1.1
+.LC21:
+	.string	"%-44s %12.0f libraries/sec\n"
+	.text
+	.p2align 4
+	.type	benchIndex.constprop.0, @function
+benchIndex.constprop.0:
+.LFB45:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$5120001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$280, %rsp
+	.cfi_def_cfa_offset 336
+	call	malloc@PLT
+	movq	%rax, 16(%rsp)
+	testq	%rax, %rax
+	je	.L116
+	movq	%rax, %r14
+	xorl	%r13d, %r13d
+	xorl	%r12d, %r12d
+	movl	$5120001, %ebx
+	leaq	.LC11(%rip), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	movl	%r12d, %eax
+	movl	%r12d, %r8d
+	movq	%rbx, %rsi
+	movl	%r12d, %ecx
+	subq	%r13, %rsi
+	leaq	(%r14,%r13), %rdi
+	movq	%rbp, %rdx
+	addl	$1, %r12d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r13
+	cmpl	$20000, %r12d
+	jne	.L118
+	movq	16(%rsp), %rdi
+	leaq	96(%rsp), %rbp
+	leaq	.LC18(%rip), %r15
+	call	strlen@PLT
+	movl	$0, (%rsp)
+	movq	%rax, 32(%rsp)
+.L138:
+	call	clock@PLT
+	xorl	%r12d, %r12d
+	movl	$0, 28(%rsp)
+	leaq	64(%rsp), %rbx
+	movq	%rax, 40(%rsp)
+	leaq	60(%rsp), %r13
+	jmp	.L127
+	.p2align 4,,10
+	.p2align 3
+.L119:
+	call	parseWavefrontMTLFromBuffer@PLT
+	movq	%rbp, %rdi
+	movl	%eax, 8(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	8(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L126
+.L156:
+	addl	$1, 28(%rsp)
+	call	clock@PLT
+	movq	40(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm2
+	subq	%rcx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %r12
+	comisd	%xmm0, %xmm2
+	jbe	.L128
+.L127:
+	movl	(%rsp), %r8d
+	movq	32(%rsp), %rdx
+	xorl	%ecx, %ecx
+	movq	%rbp, %rdi
+	movq	16(%rsp), %rsi
+	testl	%r8d, %r8d
+	je	.L119
+	call	wavefrontMTLIndexCompose@PLT
+	testl	%eax, %eax
+	jne	.L120
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	movl	%r14d, %ecx
+	movq	%r15, %rdx
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	addl	$100, %r14d
+	call	snprintf@PLT
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexFind@PLT
+	cmpl	$19999, %r14d
+	ja	.L123
+	testl	%eax, %eax
+	je	.L121
+.L123:
+	movq	%rbp, %rdi
+	movl	%eax, 8(%rsp)
+	call	wavefrontMTLIndexRelease@PLT
+	movl	8(%rsp), %eax
+	testl	%eax, %eax
+	je	.L156
+.L126:
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r12, %xmm0
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	movl	(%rsp), %eax
+	divsd	.LC1(%rip), %xmm0
+	testl	%eax, %eax
+	jne	.L124
+	xorl	%eax, %eax
+	movl	$20000, %ecx
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	leaq	.LC20(%rip), %rdx
+	movsd	%xmm0, (%rsp)
+	call	snprintf@PLT
+	movsd	(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	jbe	.L157
+	movl	28(%rsp), %r14d
+	pxor	%xmm1, %xmm1
+	movq	%rbp, %rsi
+	leaq	.LC21(%rip), %rdi
+	movl	$1, %eax
+	cvtsi2sdq	%r14, %xmm1
+	divsd	%xmm0, %xmm1
+	movapd	%xmm1, %xmm0
+	call	printf@PLT
+.L136:
+	movl	$1, (%rsp)
+	jmp	.L138
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexRelease@PLT
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r12, %xmm0
+	divsd	.LC1(%rip), %xmm0
+.L124:
+	xorl	%eax, %eax
+	movl	$100, %r8d
+	movl	$20000, %ecx
+	movq	%rbp, %rdi
+	leaq	.LC19(%rip), %rdx
+	movl	$64, %esi
+	movsd	%xmm0, 8(%rsp)
+	call	snprintf@PLT
+	movsd	8(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comisd	%xmm1, %xmm0
+	jbe	.L158
+	movl	28(%rsp), %r14d
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%r14, %xmm1
+	divsd	%xmm0, %xmm1
+	movapd	%xmm1, %xmm0
+.L155:
+	movq	%rbp, %rsi
+	leaq	.LC21(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	cmpl	$1, (%rsp)
+	jne	.L136
+	movq	16(%rsp), %rdi
+	addq	$280, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+.L157:
+	.cfi_restore_state
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rsi
+	movl	$1, %eax
+	leaq	.LC21(%rip), %rdi
+	call	printf@PLT
+	movl	$1, (%rsp)
+	jmp	.L138
+.L158:
+	pxor	%xmm0, %xmm0
+	jmp	.L155
+.L116:
+	addq	$280, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	benchIndex.constprop.0, .-benchIndex.constprop.0
+	.section	.rodata.str1.1
+.LC22:
+	.string	"diffuse copy from arrays"
+.LC24:
+	.string	"diffuse gather from materials"
+	.text
+	.p2align 4
+	.type	benchMaterialArrays.constprop.0, @function
+benchMaterialArrays.constprop.0:
+.LFB47:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$25600001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$696, %rsp
+	.cfi_def_cfa_offset 752
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L192
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$25600001, %ebp
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	movl	%r13d, %eax
+	movl	%r13d, %r8d
+	movq	%rbp, %rsi
+	movl	%r13d, %ecx
+	subq	%r14, %rsi
+	leaq	(%rbx,%r14), %rdi
+	movq	%r12, %rdx
+	addl	$1, %r13d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	cmpl	$100000, %r13d
+	jne	.L160
+	movl	$1600000, %edi
+	call	malloc@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L161
+	leaq	96(%rsp), %r15
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L162
+.L161:
+	movq	%rbx, %rdi
+	call	free@PLT
+	movq	%rbp, %rdi
+	call	free@PLT
+.L159:
+	addq	$696, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	.cfi_restore_state
+	leaq	208(%rsp), %rax
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	movq	%rax, 16(%rsp)
+	call	wavefrontMaterialArraysCompose@PLT
+	movl	%eax, %r13d
+	testl	%eax, %eax
+	jne	.L164
+	leaq	32(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.L175:
+	call	clock@PLT
+	xorl	%r12d, %r12d
+	movq	%rax, %r14
+	jmp	.L168
+	.p2align 4,,10
+	.p2align 3
+.L194:
+	movq	224(%rsp), %rsi
+	movl	$1600000, %edx
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+.L166:
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	addl	$1, %r12d
+	movsd	.LC6(%rip), %xmm3
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm0
+	comisd	%xmm0, %xmm3
+	jbe	.L193
+.L168:
+	testl	%r13d, %r13d
+	jne	.L194
+	movq	96(%rsp), %rcx
+	movq	%rbp, %rdx
+	leaq	24(%rcx), %rax
+	addq	$45600024, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movdqu	(%rax), %xmm2
+	addq	$456, %rax
+	addq	$16, %rdx
+	movups	%xmm2, -16(%rdx)
+	cmpq	%rax, %rcx
+	jne	.L167
+	jmp	.L166
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	movapd	%xmm0, %xmm1
+	movl	$100000, %r8d
+	divsd	.LC1(%rip), %xmm1
+	movsd	%xmm1, 24(%rsp)
+	testl	%r13d, %r13d
+	je	.L169
+	movq	8(%rsp), %r14
+	xorl	%eax, %eax
+	leaq	.LC22(%rip), %rcx
+	leaq	.LC8(%rip), %rdx
+	movl	$64, %esi
+	movq	%r14, %rdi
+	call	snprintf@PLT
+	movsd	24(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm1
+	jbe	.L189
+	pxor	%xmm0, %xmm0
+	movq	%r14, %rsi
+	movl	$1, %eax
+	cvtsi2sdq	%r12, %xmm0
+	mulsd	.LC23(%rip), %xmm0
+	leaq	.LC2(%rip), %rdi
+	divsd	%xmm1, %xmm0
+	call	printf@PLT
+.L174:
+	movq	16(%rsp), %rdi
+	call	wavefrontMaterialArraysRelease@PLT
+.L164:
+	movq	%r15, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	jmp	.L159
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	movq	8(%rsp), %rdi
+	xorl	%eax, %eax
+	leaq	.LC24(%rip), %rcx
+	leaq	.LC8(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movsd	24(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm1
+	jbe	.L195
+	pxor	%xmm0, %xmm0
+	movq	8(%rsp), %rsi
+	movl	$1, %eax
+	leaq	.LC2(%rip), %rdi
+	cvtsi2sdq	%r12, %xmm0
+	mulsd	.LC23(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+	call	printf@PLT
+.L178:
+	movl	$1, %r13d
+	jmp	.L175
+.L189:
+	movq	8(%rsp), %rsi
+	pxor	%xmm0, %xmm0
+	movl	$1, %eax
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L174
+.L195:
+	movq	8(%rsp), %rsi
+	pxor	%xmm0, %xmm0
+	movl	$1, %eax
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L178
+.L192:
+	movl	$1600000, %edi
+	call	malloc@PLT
+	movq	%rax, %rbp
+	jmp	.L161
+	.cfi_endproc
+.LFE47:
+	.size	benchMaterialArrays.constprop.0, .-benchMaterialArrays.constprop.0
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"parseWavefrontMTLFromString %u materials"
+	.section	.rodata.str1.1
+.LC27:
+	.string	"%-44s %12.0f lines/sec\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC28:
+	.string	"wavefrontMTLRelease %u materials"
+	.align 8
+.LC29:
+	.string	"wavefrontMTLRelease %u materials arena"
+	.section	.rodata.str1.1
+.LC30:
+	.string	"wb"
+.LC31:
+	.string	"processors online"
+.LC32:
+	.string	"%-44s %12ld\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"parseWavefrontMTLFromBuffer %u materials %u threads"
+	.align 8
+.LC38:
+	.string	"parseWavefrontMTLBatch %u libraries %u threads"
+	.align 8
+.LC39:
+	.string	"parseWavefrontMTLFromBuffer %u libraries"
+	.section	.rodata.str1.1
+.LC41:
+	.string	"MTL text"
+.LC42:
+	.string	"%-44s %12.1f bytes/material\n"
+.LC43:
+	.string	"wavefrontMTLSerialize"
+.LC44:
+	.string	"wavefrontMTLDeserialize"
+.LC45:
+	.string	"newmtl keyword_mix\n"
+.LC46:
+	.string	"%s"
+	.section	.rodata.str1.8
+	.align 8
+.LC48:
+	.string	"parseWavefrontMTLFromString keyword mix"
+	.align 8
+.LC49:
+	.string	"parseWavefrontMTLFromString all keywords"
+	.align 8
+.LC50:
+	.string	"parseWavefrontMTLFromString skipped keywords"
+	.text
+	.p2align 4
+	.globl	wavefrontMaterialParserBench
+	.type	wavefrontMaterialParserBench, @function
+wavefrontMaterialParserBench:
+.LFB39:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$25601, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	call	malloc@PLT
+	testq	%rax, %rax
+	je	.L197
+	movq	%rax, %r13
+	xorl	%ebp, %ebp
+	xorl	%ebx, %ebx
+	movl	$25601, %r14d
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L198:
+	movq	%r14, %rsi
+	leaq	0(%r13,%rbp), %rdi
+	movl	%ebx, %r8d
+	movl	%ebx, %ecx
+	subq	%rbp, %rsi
+	movq	%r12, %rdx
+	xorl	%eax, %eax
+	addl	$1, %ebx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbp
+	cmpl	$100, %ebx
+	jne	.L198
+	movl	$100, %ecx
+	leaq	.LC25(%rip), %rdx
+	xorl	%ebx, %ebx
+	xorl	%ebp, %ebp
+	leaq	128(%rsp), %rax
+	movl	$64, %esi
+	leaq	192(%rsp), %r14
+	movq	%rax, %rdi
+	movq	%rax, 40(%rsp)
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	call	clock@PLT
+	movq	%rax, %r12
+	jmp	.L200
+	.p2align 4,,10
+	.p2align 3
+.L404:
+	movq	%r14, %rdi
+	addl	$1, %ebp
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm3
+	subq	%r12, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbx
+	comisd	%xmm0, %xmm3
+	jbe	.L201
+.L200:
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L404
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+.L201:
+	movsd	.LC1(%rip), %xmm2
+	pxor	%xmm1, %xmm1
+	divsd	%xmm2, %xmm0
+	comisd	%xmm1, %xmm0
+	jbe	.L386
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rbp, %xmm1
+	mulsd	.LC26(%rip), %xmm1
+	divsd	%xmm0, %xmm1
+.L202:
+	movq	40(%rsp), %rbx
+	movapd	%xmm1, %xmm0
+	movl	$1, %eax
+	leaq	.LC27(%rip), %rdi
+	movq	%rbx, %rsi
+	call	printf@PLT
+	movl	$100, %ecx
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	leaq	.LC28(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	xorl	%edx, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	benchRelease
+	movl	$100, %ecx
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	leaq	.LC29(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movq	%r13, %rsi
+	call	benchRelease
+	movq	%r13, %rdi
+	call	free@PLT
+.L197:
+	movl	$2560001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L206
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$2560001, %ebp
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	movl	%r13d, %eax
+	movl	%r13d, %r8d
+	movq	%rbp, %rsi
+	movl	%r13d, %ecx
+	subq	%r14, %rsi
+	leaq	(%rbx,%r14), %rdi
+	movq	%r12, %rdx
+	addl	$1, %r13d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	cmpl	$10000, %r13d
+	jne	.L207
+	movl	$10000, %ecx
+	movl	$64, %esi
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	leaq	128(%rsp), %rax
+	leaq	.LC25(%rip), %rdx
+	movq	%rax, %rdi
+	movq	%rax, 40(%rsp)
+	xorl	%eax, %eax
+	leaq	192(%rsp), %r14
+	call	snprintf@PLT
+	call	clock@PLT
+	movq	%rax, %r13
+	jmp	.L209
+	.p2align 4,,10
+	.p2align 3
+.L405:
+	movq	%r14, %rdi
+	addl	$1, %r12d
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm4
+	subq	%r13, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbp
+	comisd	%xmm0, %xmm4
+	jbe	.L210
+.L209:
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L405
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbp, %xmm0
+.L210:
+	movsd	.LC1(%rip), %xmm2
+	pxor	%xmm1, %xmm1
+	divsd	%xmm2, %xmm0
+	comisd	%xmm1, %xmm0
+	jbe	.L387
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%r12, %xmm1
+	mulsd	.LC23(%rip), %xmm1
+	divsd	%xmm0, %xmm1
+.L211:
+	movq	40(%rsp), %r15
+	movapd	%xmm1, %xmm0
+	movl	$1, %eax
+	leaq	.LC27(%rip), %rdi
+	movq	%r15, %rsi
+	call	printf@PLT
+	movl	$10000, %ecx
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	leaq	.LC28(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	xorl	%edx, %edx
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	call	benchRelease
+	movl	$10000, %ecx
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	leaq	.LC29(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rbx, %rsi
+	call	benchRelease
+	movq	%rbx, %rdi
+	call	free@PLT
+.L206:
+	movl	$25601, %edi
+	call	malloc@PLT
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L215
+	xorl	%ebp, %ebp
+	xorl	%ebx, %ebx
+	leaq	.LC11(%rip), %r12
+	movl	$25601, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	movq	%r14, %rsi
+	leaq	0(%r13,%rbp), %rdi
+	movl	%ebx, %r8d
+	movl	%ebx, %ecx
+	subq	%rbp, %rsi
+	movq	%r12, %rdx
+	xorl	%eax, %eax
+	addl	$1, %ebx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbp
+	cmpl	$100, %ebx
+	jne	.L216
+	leaq	.LC4(%rip), %rdi
+	leaq	.LC30(%rip), %rsi
+	call	fopen@PLT
+	movq	%r13, %rdi
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L217
+	call	strlen@PLT
+	movq	%rbx, %rcx
+	movl	$1, %esi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	call	fclose@PLT
+	movq	%r13, %rdi
+	call	free@PLT
+	movl	$100, %edi
+	call	benchParseFile.part.0
+.L215:
+	movl	$2560001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L218
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$2560001, %ebp
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L219:
+	movl	%r13d, %eax
+	movl	%r13d, %r8d
+	movq	%rbp, %rsi
+	movl	%r13d, %ecx
+	subq	%r14, %rsi
+	leaq	(%rbx,%r14), %rdi
+	movq	%r12, %rdx
+	addl	$1, %r13d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	cmpl	$10000, %r13d
+	jne	.L219
+	leaq	.LC4(%rip), %rdi
+	leaq	.LC30(%rip), %rsi
+	call	fopen@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L220
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	fwrite@PLT
+	movq	%rbp, %rdi
+	call	fclose@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	movl	$10000, %edi
+	call	benchParseFile.part.0
+.L218:
+	movl	$51200001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L221
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$51200001, %ebx
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	movl	%r13d, %eax
+	movl	%r13d, %r8d
+	movq	%rbx, %rsi
+	movl	%r13d, %ecx
+	subq	%r14, %rsi
+	leaq	0(%rbp,%r14), %rdi
+	movq	%r12, %rdx
+	addl	$1, %r13d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	cmpl	$200000, %r13d
+	jne	.L222
+	movq	%rbp, %rdi
+	leaq	96(%rsp), %r15
+	leaq	112(%rsp), %r13
+	call	strlen@PLT
+	movl	$84, %edi
+	leaq	192(%rsp), %r14
+	movq	%rax, %r12
+	call	sysconf@PLT
+	leaq	.LC31(%rip), %rsi
+	leaq	.LC32(%rip), %rdi
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	call	printf@PLT
+	leaq	.LC14(%rip), %rcx
+	movdqa	.LC33(%rip), %xmm0
+	movsd	.LC34(%rip), %xmm5
+	movq	%rcx, 64(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%r15, 32(%rsp)
+	movq	%rax, %r15
+	movaps	%xmm0, 96(%rsp)
+	movsd	%xmm5, 8(%rsp)
+.L234:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movl	$1, %esi
+	xorl	%ebx, %ebx
+	movq	%r14, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movl	(%rax), %eax
+	movaps	%xmm0, 144(%rsp)
+	movq	$0, 160(%rsp)
+	movl	%eax, 40(%rsp)
+	movl	%eax, 136(%rsp)
+	call	timespec_get@PLT
+	pxor	%xmm1, %xmm1
+	pxor	%xmm0, %xmm0
+	movq	$0x000000000, 16(%rsp)
+	cvtsi2sdq	192(%rsp), %xmm1
+	cvtsi2sdq	200(%rsp), %xmm0
+	divsd	8(%rsp), %xmm0
+	addsd	%xmm1, %xmm0
+	movsd	%xmm0, 24(%rsp)
+	jmp	.L224
+	.p2align 4,,10
+	.p2align 3
+.L406:
+	movq	%r14, %rdi
+	addl	$1, %ebx
+	call	wavefrontMTLRelease@PLT
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	timespec_get@PLT
+	pxor	%xmm1, %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC35(%rip), %xmm2
+	cvtsi2sdq	112(%rsp), %xmm1
+	cvtsi2sdq	120(%rsp), %xmm0
+	divsd	8(%rsp), %xmm0
+	addsd	%xmm1, %xmm0
+	subsd	24(%rsp), %xmm0
+	comisd	%xmm0, %xmm2
+	movsd	%xmm0, 16(%rsp)
+	jbe	.L225
+.L224:
+	movq	%r15, %rcx
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	je	.L406
+.L225:
+	movl	40(%rsp), %r8d
+	xorl	%eax, %eax
+	movl	$200000, %ecx
+	movq	%r14, %rdi
+	leaq	.LC36(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movsd	16(%rsp), %xmm3
+	pxor	%xmm4, %xmm4
+	pxor	%xmm0, %xmm0
+	comisd	%xmm4, %xmm3
+	jbe	.L399
+	testq	%r12, %r12
+	js	.L228
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r12, %xmm0
+.L229:
+	pxor	%xmm1, %xmm1
+	divsd	.LC1(%rip), %xmm0
+	cvtsi2sdq	%rbx, %xmm1
+	mulsd	%xmm1, %xmm0
+	divsd	16(%rsp), %xmm0
+.L399:
+	movq	64(%rsp), %rdi
+	movq	%r14, %rsi
+	movl	$1, %eax
+	call	printf@PLT
+	addq	$4, 32(%rsp)
+	movq	32(%rsp), %rax
+	cmpq	%rax, %r13
+	jne	.L234
+	movq	%rbp, %rdi
+	call	free@PLT
+.L221:
+	call	benchParseTolerant.constprop.0
+	movl	$144, %esi
+	movl	$500, %edi
+	call	calloc@PLT
+	movq	%rax, 48(%rsp)
+	testq	%rax, %rax
+	je	.L235
+	movl	$5121, %edi
+	call	malloc@PLT
+	movq	%rax, 80(%rsp)
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L236
+	xorl	%ebp, %ebp
+	xorl	%ebx, %ebx
+	leaq	.LC11(%rip), %r12
+	movl	$5121, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L237:
+	movq	%r13, %rsi
+	leaq	(%r14,%rbp), %rdi
+	movl	%ebx, %r8d
+	movl	%ebx, %ecx
+	subq	%rbp, %rsi
+	movq	%r12, %rdx
+	xorl	%eax, %eax
+	addl	$1, %ebx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbp
+	cmpl	$20, %ebx
+	jne	.L237
+.L236:
+	movl	$5120001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L401
+	xorl	%r13d, %r13d
+	xorl	%r15d, %r15d
+	movl	$5120001, %ebp
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	movl	%r15d, %eax
+	movl	%r15d, %r8d
+	movq	%rbp, %rsi
+	movl	%r15d, %ecx
+	subq	%r13, %rsi
+	leaq	(%rbx,%r13), %rdi
+	movq	%r12, %rdx
+	addl	$1, %r15d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r13
+	cmpl	$20000, %r15d
+	jne	.L239
+	cmpq	$0, 80(%rsp)
+	je	.L401
+	movq	48(%rsp), %rax
+	movq	80(%rsp), %r13
+	xorl	%r15d, %r15d
+	xorl	%r12d, %r12d
+	leaq	8(%rax), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	cmpl	$250, %r12d
+	jne	.L245
+	movq	%rbx, 0(%rbp)
+	movq	%rbx, %rdi
+	addq	$144, %rbp
+	movl	$251, %r12d
+	call	strlen@PLT
+	movq	%rax, -136(%rbp)
+	addq	%rax, %r15
+.L245:
+	movq	%r13, 0(%rbp)
+	movq	%r13, %rdi
+	addl	$1, %r12d
+	addq	$144, %rbp
+	call	strlen@PLT
+	movq	%rax, -136(%rbp)
+	addq	%rax, %r15
+	cmpl	$500, %r12d
+	jne	.L243
+	movl	$84, %edi
+	leaq	192(%rsp), %r14
+	call	sysconf@PLT
+	leaq	.LC31(%rip), %rsi
+	leaq	.LC32(%rip), %rdi
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	call	printf@PLT
+	leaq	112(%rsp), %rax
+	movq	%r14, 16(%rsp)
+	movdqa	.LC37(%rip), %xmm0
+	movq	%rax, 56(%rsp)
+	leaq	128(%rsp), %rax
+	movsd	.LC34(%rip), %xmm2
+	movq	%rax, 40(%rsp)
+	leaq	.LC14(%rip), %rax
+	movq	%rax, 64(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rbx, 88(%rsp)
+	movq	%r15, %rbx
+	movaps	%xmm0, 112(%rsp)
+	leaq	24(%rax), %r13
+	leaq	72024(%rax), %rbp
+	movsd	%xmm2, 8(%rsp)
+.L262:
+	movq	56(%rsp), %rax
+	movq	16(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	xorl	%r12d, %r12d
+	movl	$1, %esi
+	movaps	%xmm0, 128(%rsp)
+	movl	(%rax), %r15d
+	movaps	%xmm0, 144(%rsp)
+	movq	$0, 160(%rsp)
+	movl	%r15d, 136(%rsp)
+	call	timespec_get@PLT
+	pxor	%xmm1, %xmm1
+	pxor	%xmm0, %xmm0
+	movq	$0x000000000, 24(%rsp)
+	cvtsi2sdq	192(%rsp), %xmm1
+	movq	%rbx, 72(%rsp)
+	cvtsi2sdq	200(%rsp), %xmm0
+	divsd	8(%rsp), %xmm0
+	addsd	%xmm1, %xmm0
+	movsd	%xmm0, 32(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L251:
+	testl	%r15d, %r15d
+	jne	.L246
+	movq	%r13, %rbx
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movq	-8(%rbx), %rdx
+	movq	-16(%rbx), %rsi
+	movq	%rbx, %rdi
+	xorl	%ecx, %ecx
+	addq	$144, %rbx
+	call	parseWavefrontMTLFromBuffer@PLT
+	orl	%eax, %r14d
+	cmpq	%rbp, %rbx
+	jne	.L247
+.L248:
+	movq	%r13, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L249:
+	movq	%rbx, %rdi
+	addq	$144, %rbx
+	call	wavefrontMTLRelease@PLT
+	cmpq	%rbp, %rbx
+	jne	.L249
+	testl	%r14d, %r14d
+	jne	.L250
+	movq	16(%rsp), %rdi
+	movl	$1, %esi
+	addl	$1, %r12d
+	call	timespec_get@PLT
+	pxor	%xmm1, %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC35(%rip), %xmm5
+	cvtsi2sdq	192(%rsp), %xmm1
+	cvtsi2sdq	200(%rsp), %xmm0
+	divsd	8(%rsp), %xmm0
+	addsd	%xmm1, %xmm0
+	subsd	32(%rsp), %xmm0
+	comisd	%xmm0, %xmm5
+	movsd	%xmm0, 24(%rsp)
+	ja	.L251
+.L250:
+	movq	72(%rsp), %rbx
+	testl	%r15d, %r15d
+	je	.L252
+	movq	16(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	%r15d, %r8d
+	movl	$500, %ecx
+	leaq	.LC38(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movsd	24(%rsp), %xmm5
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm5
+	jbe	.L390
+.L410:
+	testq	%rbx, %rbx
+	js	.L256
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+.L257:
+	pxor	%xmm1, %xmm1
+	movq	16(%rsp), %rsi
+	movq	64(%rsp), %rdi
+	divsd	.LC1(%rip), %xmm0
+	cvtsi2sdq	%r12, %xmm1
+	movl	$1, %eax
+	mulsd	%xmm1, %xmm0
+	divsd	24(%rsp), %xmm0
+	call	printf@PLT
+	addq	$4, 56(%rsp)
+	movq	56(%rsp), %rax
+	cmpq	%rax, 40(%rsp)
+	jne	.L262
+.L400:
+	movq	88(%rsp), %rbx
+.L401:
+	movq	80(%rsp), %rdi
+	call	free@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	movq	48(%rsp), %rdi
+	call	free@PLT
+.L235:
+	movl	$51200001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L403
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$51200001, %ebp
+	leaq	.LC11(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L264:
+	movl	%r13d, %eax
+	movl	%r13d, %r8d
+	movq	%rbp, %rsi
+	movl	%r13d, %ecx
+	subq	%r14, %rsi
+	leaq	(%rbx,%r14), %rdi
+	movq	%r12, %rdx
+	addl	$1, %r13d
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	cmpl	$200000, %r13d
+	jne	.L264
+	leaq	192(%rsp), %r14
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L265
+.L403:
+	movq	%rbx, %rdi
+	call	free@PLT
+	call	benchMaterialArrays.constprop.0
+	call	benchIndex.constprop.0
+	movl	$3200032, %edi
+	call	malloc@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L285
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rdx
+	movl	$3200032, %esi
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movl	$100000, %ebx
+	movl	$1, %r15d
+	leaq	keywordLines(%rip), %r14
+	movslq	%eax, %r13
+	leaq	.LC46(%rip), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L286:
+	imull	$1103515245, %r15d, %r15d
+	movl	$2290649225, %ecx
+	movl	$3200032, %esi
+	subq	%r13, %rsi
+	leaq	(%r12,%r13), %rdi
+	addl	$12345, %r15d
+	movl	%r15d, %edx
+	shrl	$16, %edx
+	movl	%edx, %eax
+	imulq	%rcx, %rax
+	shrq	$35, %rax
+	movl	%eax, %ecx
+	sall	$4, %ecx
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	subl	%ecx, %edx
+	movq	(%r14,%rdx,8), %rcx
+	movq	%rbp, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r13
+	subl	$1, %ebx
+	jne	.L286
+	call	clock@PLT
+	xorl	%ebp, %ebp
+	leaq	192(%rsp), %r14
+	movq	%rax, %r13
+	jmp	.L288
+	.p2align 4,,10
+	.p2align 3
+.L407:
+	movq	%r14, %rdi
+	addl	$1, %ebx
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm6
+	subq	%r13, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbp
+	comisd	%xmm0, %xmm6
+	jbe	.L289
+.L288:
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L407
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbp, %xmm0
+.L289:
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	divsd	.LC1(%rip), %xmm1
+	comisd	%xmm0, %xmm1
+	jbe	.L393
+	movl	%ebx, %ebx
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+	mulsd	.LC47(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L290:
+	leaq	.LC27(%rip), %rdi
+	leaq	.LC48(%rip), %rsi
+	movl	$1, %eax
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+.L285:
+	movl	$3200032, %edi
+	call	malloc@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L294
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rdx
+	movl	$3200032, %esi
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movl	$100000, %ebx
+	movl	$1, %r15d
+	leaq	.LC46(%rip), %rbp
+	movslq	%eax, %r13
+	leaq	allKeywordLines(%rip), %r14
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	imull	$1103515245, %r15d, %r15d
+	movl	$4042322161, %ecx
+	movl	$3200032, %esi
+	subq	%r13, %rsi
+	leaq	(%r12,%r13), %rdi
+	addl	$12345, %r15d
+	movl	%r15d, %edx
+	shrl	$16, %edx
+	movl	%edx, %eax
+	imulq	%rcx, %rax
+	shrq	$37, %rax
+	imull	$34, %eax, %eax
+	subl	%eax, %edx
+	xorl	%eax, %eax
+	movq	(%r14,%rdx,8), %rcx
+	movq	%rbp, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r13
+	subl	$1, %ebx
+	jne	.L295
+	call	clock@PLT
+	xorl	%ebp, %ebp
+	leaq	192(%rsp), %r14
+	movq	%rax, %r13
+	jmp	.L297
+	.p2align 4,,10
+	.p2align 3
+.L408:
+	movq	%r14, %rdi
+	addl	$1, %ebx
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm7
+	subq	%r13, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbp
+	comisd	%xmm0, %xmm7
+	jbe	.L298
+.L297:
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L408
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbp, %xmm0
+.L298:
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	divsd	.LC1(%rip), %xmm1
+	comisd	%xmm0, %xmm1
+	jbe	.L394
+	movl	%ebx, %ebx
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+	mulsd	.LC47(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L299:
+	leaq	.LC27(%rip), %rdi
+	leaq	.LC49(%rip), %rsi
+	movl	$1, %eax
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+.L294:
+	movl	$3200032, %edi
+	call	malloc@PLT
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L196
+	movq	%rax, %rdi
+	leaq	.LC45(%rip), %rdx
+	movl	$3200032, %esi
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movl	$100000, %ebx
+	movl	$1, %r12d
+	leaq	.LC46(%rip), %rbp
+	movslq	%eax, %r14
+	leaq	skippedLines(%rip), %r15
+	.p2align 4,,10
+	.p2align 3
+.L304:
+	imull	$1103515245, %r12d, %r12d
+	movl	$3200032, %esi
+	leaq	0(%r13,%r14), %rdi
+	movq	%rbp, %rdx
+	subq	%r14, %rsi
+	addl	$12345, %r12d
+	movl	%r12d, %eax
+	shrl	$16, %eax
+	andl	$7, %eax
+	movq	(%r15,%rax,8), %rcx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r14
+	subl	$1, %ebx
+	jne	.L304
+	call	clock@PLT
+	xorl	%ebp, %ebp
+	leaq	192(%rsp), %r14
+	movq	%rax, %r12
+	jmp	.L306
+	.p2align 4,,10
+	.p2align 3
+.L409:
+	movq	%r14, %rdi
+	addl	$1, %ebx
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm2
+	subq	%r12, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %rbp
+	comisd	%xmm0, %xmm2
+	jbe	.L307
+.L306:
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L409
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbp, %xmm0
+.L307:
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	divsd	.LC1(%rip), %xmm1
+	comisd	%xmm0, %xmm1
+	jbe	.L395
+	movl	%ebx, %ebx
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbx, %xmm0
+	mulsd	.LC47(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L308:
+	leaq	.LC27(%rip), %rdi
+	leaq	.LC50(%rip), %rsi
+	movl	$1, %eax
+	call	printf@PLT
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r13, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	.cfi_restore_state
+	movq	40(%rsp), %rdx
+	movq	48(%rsp), %rdi
+	movl	$500, %esi
+	call	parseWavefrontMTLBatch@PLT
+	movl	%eax, %r14d
+	jmp	.L248
+.L252:
+	movq	16(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$500, %ecx
+	leaq	.LC39(%rip), %rdx
+	movl	$64, %esi
+	call	snprintf@PLT
+	movsd	24(%rsp), %xmm5
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm5
+	ja	.L410
+.L390:
+	movq	16(%rsp), %rsi
+	movq	64(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movl	$1, %eax
+	call	printf@PLT
+	addq	$4, 56(%rsp)
+	movq	40(%rsp), %rcx
+	movq	56(%rsp), %rax
+	cmpq	%rcx, %rax
+	jne	.L262
+	jmp	.L400
+.L256:
+	movq	%rbx, %rax
+	movq	%rbx, %rdx
+	pxor	%xmm0, %xmm0
+	shrq	%rax
+	andl	$1, %edx
+	orq	%rdx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L257
+.L228:
+	movq	%r12, %rax
+	movq	%r12, %rdx
+	pxor	%xmm0, %xmm0
+	shrq	%rax
+	andl	$1, %edx
+	orq	%rdx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L229
+.L387:
+	pxor	%xmm1, %xmm1
+	jmp	.L211
+.L386:
+	pxor	%xmm1, %xmm1
+	jmp	.L202
+.L395:
+	pxor	%xmm0, %xmm0
+	jmp	.L308
+.L394:
+	pxor	%xmm0, %xmm0
+	jmp	.L299
+.L393:
+	pxor	%xmm0, %xmm0
+	jmp	.L290
+.L265:
+	leaq	112(%rsp), %rdx
+	leaq	96(%rsp), %rsi
+	movq	%r14, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movq	%r14, %rdi
+	movl	%eax, 8(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	8(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L403
+	movq	%rbx, %rdi
+	movl	%edx, 8(%rsp)
+	call	strlen@PLT
+	movl	8(%rsp), %edx
+	testq	%rax, %rax
+	movq	%rax, %r12
+	js	.L268
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L269:
+	leaq	.LC42(%rip), %rbp
+	leaq	.LC41(%rip), %rsi
+	movl	%edx, 8(%rsp)
+	movl	$1, %eax
+	movq	%rbp, %rdi
+	divsd	.LC40(%rip), %xmm0
+	call	printf@PLT
+	movq	112(%rsp), %rax
+	movl	8(%rsp), %edx
+	testq	%rax, %rax
+	js	.L270
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L271:
+	movq	%rbp, %rdi
+	leaq	.LC43(%rip), %rsi
+	movl	%edx, 8(%rsp)
+	xorl	%ebp, %ebp
+	movl	$1, %eax
+	divsd	.LC40(%rip), %xmm0
+	xorl	%r15d, %r15d
+	call	printf@PLT
+	call	clock@PLT
+	movq	%rax, %r13
+	jmp	.L273
+.L391:
+	movq	%r14, %rdi
+	addl	$1, %ebp
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm7
+	subq	%r13, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %r15
+	comisd	%xmm0, %xmm7
+	jbe	.L411
+.L273:
+	xorl	%ecx, %ecx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	je	.L391
+	leaq	128(%rsp), %rax
+	movl	8(%rsp), %edx
+	movsd	.LC1(%rip), %xmm2
+	leaq	.LC2(%rip), %r13
+	movq	%rax, 40(%rsp)
+	leaq	.LC8(%rip), %rax
+	movq	%rax, 8(%rsp)
+.L272:
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r15, %xmm0
+.L274:
+	movapd	%xmm0, %xmm1
+	divsd	%xmm2, %xmm1
+	testl	%edx, %edx
+	jne	.L276
+	movq	8(%rsp), %rdx
+	movq	40(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$200000, %r8d
+	leaq	.LC16(%rip), %rcx
+	movl	$64, %esi
+	movsd	%xmm2, 24(%rsp)
+	movsd	%xmm1, 16(%rsp)
+	call	snprintf@PLT
+	movsd	16(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	24(%rsp), %xmm2
+	comisd	%xmm0, %xmm1
+	jbe	.L412
+	pxor	%xmm0, %xmm0
+	movsd	%xmm2, 16(%rsp)
+	cvtsi2sdq	%rbp, %xmm0
+	mulsd	.LC40(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+.L402:
+	movq	40(%rsp), %rsi
+	movq	%r13, %rdi
+	movl	$1, %eax
+	xorl	%r15d, %r15d
+	xorl	%ebp, %ebp
+	call	printf@PLT
+	movsd	16(%rsp), %xmm2
+	movsd	%xmm2, 16(%rsp)
+	call	clock@PLT
+	movq	%rax, %r12
+	jmp	.L275
+	.p2align 4,,10
+	.p2align 3
+.L414:
+	movq	%r14, %rdi
+	addl	$1, %ebp
+	call	wavefrontMTLRelease@PLT
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm6
+	subq	%r12, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, %r15
+	comisd	%xmm0, %xmm6
+	jbe	.L413
+.L275:
+	movq	112(%rsp), %rdx
+	movq	96(%rsp), %rsi
+	xorl	%ecx, %ecx
+	movq	%r14, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movl	$1, %edx
+	testl	%eax, %eax
+	je	.L414
+	movsd	16(%rsp), %xmm2
+	jmp	.L272
+.L268:
+	movq	%r12, %rcx
+	shrq	%rax
+	pxor	%xmm0, %xmm0
+	andl	$1, %ecx
+	orq	%rcx, %rax
+	cvtsi2sdq	%rax, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L269
+.L413:
+	movsd	16(%rsp), %xmm2
+	movapd	%xmm0, %xmm1
+	divsd	%xmm2, %xmm1
+.L276:
+	movq	40(%rsp), %r15
+	movq	8(%rsp), %rdx
+	xorl	%eax, %eax
+	movl	$200000, %r8d
+	leaq	.LC44(%rip), %rcx
+	movl	$64, %esi
+	movsd	%xmm1, 16(%rsp)
+	movq	%r15, %rdi
+	call	snprintf@PLT
+	movsd	16(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm1
+	jbe	.L392
+	pxor	%xmm0, %xmm0
+	movq	%r15, %rsi
+	movq	%r13, %rdi
+	movl	$1, %eax
+	cvtsi2sdq	%rbp, %xmm0
+	mulsd	.LC40(%rip), %xmm0
+	divsd	%xmm1, %xmm0
+	call	printf@PLT
+.L282:
+	movq	96(%rsp), %rdi
+	call	wavefrontFree@PLT
+	jmp	.L403
+.L392:
+	movq	40(%rsp), %rsi
+	pxor	%xmm0, %xmm0
+	movq	%r13, %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	jmp	.L282
+.L270:
+	movq	%rax, %rcx
+	andl	$1, %eax
+	pxor	%xmm0, %xmm0
+	shrq	%rcx
+	orq	%rax, %rcx
+	cvtsi2sdq	%rcx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L271
+.L411:
+	leaq	128(%rsp), %rax
+	xorl	%edx, %edx
+	movsd	.LC1(%rip), %xmm2
+	leaq	.LC2(%rip), %r13
+	movq	%rax, 40(%rsp)
+	leaq	.LC8(%rip), %rax
+	movq	%rax, 8(%rsp)
+	jmp	.L274
+.L412:
+	movsd	%xmm2, 16(%rsp)
+	pxor	%xmm0, %xmm0
+	jmp	.L402
+.L196:
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L220:
+	.cfi_restore_state
+	call	free@PLT
+	jmp	.L218
+.L217:
+	call	free@PLT
+	jmp	.L215
+	.cfi_endproc
+.LFE39:
+	.size	wavefrontMaterialParserBench, .-wavefrontMaterialParserBench
+	.section	.rodata.str1.1
+.LC51:
+	.string	"sharpness 60\n"
+.LC52:
+	.string	"map_aat on\n"
+.LC53:
+	.string	"Km 0\n"
+.LC54:
+	.string	"Px 0\n"
+.LC55:
+	.string	"map_Kx x.png\n"
+.LC56:
+	.string	"anisox 0\n"
+.LC57:
+	.string	"decals x.png\n"
+.LC58:
+	.string	"# comment\n"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	skippedLines, @object
+	.size	skippedLines, 64
+skippedLines:
+	.quad	.LC51
+	.quad	.LC52
+	.quad	.LC53
+	.quad	.LC54
+	.quad	.LC55
+	.quad	.LC56
+	.quad	.LC57
+	.quad	.LC58
+	.section	.rodata.str1.1
+.LC59:
+	.string	"Ka 0.1 0.2 0.3\n"
+.LC60:
+	.string	"Kd 0.4 0.5 0.6\n"
+.LC61:
+	.string	"Ks 0.7 0.8 0.9\n"
+.LC62:
+	.string	"Ke 0 0 0\n"
+.LC63:
+	.string	"Tf 1 1 1\n"
+.LC64:
+	.string	"Tr 0\n"
+.LC65:
+	.string	"illum 2\n"
+.LC66:
+	.string	"Ns 32\n"
+.LC67:
+	.string	"Ni 1.5\n"
+.LC68:
+	.string	"d 1\n"
+.LC69:
+	.string	"Pr 0.5\n"
+.LC70:
+	.string	"Pm 0\n"
+.LC71:
+	.string	"Ps 0\n"
+.LC72:
+	.string	"Pc 0\n"
+.LC73:
+	.string	"Pcr 0.03\n"
+.LC74:
+	.string	"aniso 0\n"
+.LC75:
+	.string	"anisor 0\n"
+.LC76:
+	.string	"map_Ka ambient.png\n"
+.LC77:
+	.string	"map_Kd diffuse.png\n"
+.LC78:
+	.string	"map_Ks specular.png\n"
+.LC79:
+	.string	"map_Ke emission.png\n"
+.LC80:
+	.string	"map_Ns highlight.png\n"
+.LC81:
+	.string	"map_d alpha.png\n"
+.LC82:
+	.string	"map_Pr roughness.png\n"
+.LC83:
+	.string	"map_Pm metallic.png\n"
+.LC84:
+	.string	"map_Ps sheen.png\n"
+.LC85:
+	.string	"map_Kn normal.png\n"
+.LC86:
+	.string	"norm normal.png\n"
+.LC87:
+	.string	"map_Bump bump.png\n"
+.LC88:
+	.string	"bump -bm 0.5 bump.png\n"
+.LC89:
+	.string	"disp disp.png\n"
+.LC90:
+	.string	"decal decal.png\n"
+.LC91:
+	.string	"refl -type sphere sphere.png\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC92:
+	.string	"refl -type cube_right right.png\n"
+	.section	.data.rel.local
+	.align 32
+	.type	allKeywordLines, @object
+	.size	allKeywordLines, 272
+allKeywordLines:
+	.quad	.LC59
+	.quad	.LC60
+	.quad	.LC61
+	.quad	.LC62
+	.quad	.LC63
+	.quad	.LC64
+	.quad	.LC65
+	.quad	.LC66
+	.quad	.LC67
+	.quad	.LC68
+	.quad	.LC69
+	.quad	.LC70
+	.quad	.LC71
+	.quad	.LC72
+	.quad	.LC73
+	.quad	.LC74
+	.quad	.LC75
+	.quad	.LC76
+	.quad	.LC77
+	.quad	.LC78
+	.quad	.LC79
+	.quad	.LC80
+	.quad	.LC81
+	.quad	.LC82
+	.quad	.LC83
+	.quad	.LC84
+	.quad	.LC85
+	.quad	.LC86
+	.quad	.LC87
+	.quad	.LC88
+	.quad	.LC89
+	.quad	.LC90
+	.quad	.LC91
+	.quad	.LC92
+	.align 32
+	.type	keywordLines, @object
+	.size	keywordLines, 120
+keywordLines:
+	.quad	.LC59
+	.quad	.LC60
+	.quad	.LC61
+	.quad	.LC63
+	.quad	.LC65
+	.quad	.LC66
+	.quad	.LC67
+	.quad	.LC68
+	.quad	.LC64
+	.quad	.LC58
+	.quad	.LC77
+	.quad	.LC85
+	.quad	.LC78
+	.quad	.LC91
+	.quad	.LC92
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	0
+	.long	1093567616
+	.align 8
+.LC6:
+	.long	0
+	.long	1092519040
+	.align 8
+.LC23:
+	.long	0
+	.long	1090021888
+	.align 8
+.LC26:
+	.long	0
+	.long	1083129856
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC33:
+	.long	1
+	.long	2
+	.long	4
+	.long	8
+	.section	.rodata.cst8
+	.align 8
+.LC34:
+	.long	0
+	.long	1104006501
+	.align 8
+.LC35:
+	.long	0
+	.long	1071644672
+	.section	.rodata.cst16
+	.align 16
+.LC37:
+	.long	0
+	.long	1
+	.long	4
+	.long	8
+	.section	.rodata.cst8
+	.align 8
+.LC40:
+	.long	0
+	.long	1091070464
+	.align 8
+.LC47:
+	.long	0
+	.long	1090021904
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,533 @@
+	.file	"wavefront_material_writer_bench.c"
+	.text
+	.p2align 4
+	.type	discard, @function
+discard:
+.LFB23:
+	.cfi_startproc
+	addq	%rdx, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	discard, .-discard
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"Material_%06u"
+.LC9:
+	.string	"textures/diffuse_%03u.png"
+.LC12:
+	.string	"writeWavefrontMTL"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC13:
+	.string	"%-44s %12.1f MB/sec %12.0f materials/sec\n"
+	.align 8
+.LC14:
+	.string	"newmtl %s\nKa %.9g %.9g %.9g\nKd %.9g %.9g %.9g\nKs %.9g %.9g %.9g\nNs %.9g\nNi %.9g\nd %.9g\nillum %d\nmap_Kd %s\n\n"
+	.section	.rodata.str1.1
+.LC15:
+	.string	"snprintf %.9g loop"
+.LC16:
+	.string	"writeWavefrontMTL round trip"
+	.text
+	.p2align 4
+	.globl	wavefrontMaterialWriterBench
+	.type	wavefrontMaterialWriterBench, @function
+wavefrontMaterialWriterBench:
+.LFB26:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	$5, %ebx
+	subq	$296, %rsp
+	.cfi_def_cfa_offset 352
+	leaq	64(%rsp), %r13
+	leaq	176(%rsp), %rbp
+	movq	%r13, %rdi
+	call	wavefrontMTLCompose@PLT
+	jmp	.L7
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movq	64(%rsp), %r14
+	movl	%r15d, %ecx
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	imull	$1103515245, %ebx, %ebx
+	leaq	.LC9(%rip), %rdx
+	movq	.LC3(%rip), %xmm5
+	movq	.LC4(%rip), %xmm6
+	addq	%r12, %r14
+	movl	$0x3f800000, 20(%r14)
+	leal	12345(%rbx), %eax
+	movd	%ebx, %xmm0
+	movl	$0x3f800000, 36(%r14)
+	imull	$1103515245, %eax, %eax
+	movl	$0x3f800000, 52(%r14)
+	movl	$0x3fb9999a, 96(%r14)
+	movl	$2, 128(%r14)
+	movd	%eax, %xmm4
+	punpckldq	%xmm4, %xmm0
+	paddd	%xmm5, %xmm0
+	pshufd	$0xe5, %xmm0, %xmm7
+	movd	%xmm7, %ebx
+	movdqa	%xmm0, %xmm2
+	pxor	%xmm0, %xmm0
+	imull	$1103515245, %ebx, %ebx
+	psrld	$8, %xmm2
+	cvtdq2ps	%xmm2, %xmm2
+	mulps	%xmm6, %xmm2
+	addl	$12345, %ebx
+	movl	%ebx, %eax
+	imull	$1103515245, %ebx, %ebx
+	shrl	$8, %eax
+	cvtsi2ssl	%eax, %xmm0
+	movlps	%xmm2, 8(%r14)
+	addl	$12345, %ebx
+	movl	%ebx, %eax
+	imull	$1103515245, %ebx, %ebx
+	shrl	$8, %eax
+	mulss	%xmm1, %xmm0
+	addl	$12345, %ebx
+	movss	%xmm0, 16(%r14)
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	imull	$1103515245, %ebx, %ebx
+	mulss	%xmm1, %xmm0
+	addl	$12345, %ebx
+	movss	%xmm0, 24(%r14)
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	imull	$1103515245, %ebx, %ebx
+	mulss	%xmm1, %xmm0
+	addl	$12345, %ebx
+	movss	%xmm0, 28(%r14)
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	imull	$1103515245, %ebx, %ebx
+	mulss	%xmm1, %xmm0
+	addl	$12345, %ebx
+	movss	%xmm0, 32(%r14)
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	imull	$1103515245, %ebx, %ebx
+	mulss	%xmm1, %xmm0
+	addl	$12345, %ebx
+	movss	%xmm0, 40(%r14)
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	mulss	%xmm1, %xmm0
+	movss	%xmm0, 44(%r14)
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	movq	.LC8(%rip), %rax
+	movq	%rax, 88(%r14)
+	movl	%r15d, %eax
+	imulq	$1374389535, %rax, %rax
+	mulss	%xmm1, %xmm0
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	movss	%xmm0, 48(%r14)
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	addl	$1, %r15d
+	addq	$456, %r12
+	movq	%rax, 152(%r14)
+	cmpl	$20000, %r15d
+	je	.L8
+.L7:
+	movl	%r15d, %ecx
+	leaq	.LC2(%rip), %rdx
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	movl	$64, %esi
+	call	snprintf@PLT
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r13, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movss	.LC5(%rip), %xmm1
+	testl	%eax, %eax
+	je	.L4
+.L8:
+	leaq	56(%rsp), %rax
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	movq	%rax, %rcx
+	movq	%rax, 24(%rsp)
+	movq	$0, 56(%rsp)
+	call	writeWavefrontMTLToBuffer@PLT
+	movq	56(%rsp), %rax
+	leaq	(%rax,%rax), %rbx
+	movq	%rbx, %rdi
+	call	malloc@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L56
+	call	clock@PLT
+	pxor	%xmm1, %xmm1
+	xorl	%r15d, %r15d
+	movq	%rax, %r14
+	movsd	%xmm1, (%rsp)
+	movsd	%xmm1, 8(%rsp)
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	pxor	%xmm2, %xmm2
+	cvtsi2sdq	%rax, %xmm2
+.L12:
+	addsd	(%rsp), %xmm2
+	movl	72(%rsp), %eax
+	movsd	%xmm2, (%rsp)
+	pxor	%xmm2, %xmm2
+	cvtsi2sdq	%rax, %xmm2
+	addsd	8(%rsp), %xmm2
+	movsd	%xmm2, 8(%rsp)
+	call	clock@PLT
+	pxor	%xmm2, %xmm2
+	movsd	.LC10(%rip), %xmm4
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm2
+	movq	%rax, %r15
+	comisd	%xmm2, %xmm4
+	jbe	.L57
+.L15:
+	movq	%rbp, %rdx
+	movq	%r13, %rdi
+	leaq	discard(%rip), %rsi
+	movq	$0, 176(%rsp)
+	call	writeWavefrontMTL@PLT
+	testl	%eax, %eax
+	jne	.L10
+	movq	176(%rsp), %rax
+	testq	%rax, %rax
+	jns	.L58
+	movq	%rax, %rdx
+	andl	$1, %eax
+	pxor	%xmm2, %xmm2
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm2
+	addsd	%xmm2, %xmm2
+	jmp	.L12
+.L33:
+	pxor	%xmm3, %xmm3
+	movsd	16(%rsp), %xmm2
+	divsd	.LC11(%rip), %xmm2
+	movsd	(%rsp), %xmm0
+	comisd	%xmm2, %xmm3
+	movsd	8(%rsp), %xmm1
+	jb	.L34
+	movsd	.LC1(%rip), %xmm2
+.L34:
+	divsd	%xmm2, %xmm1
+	leaq	.LC13(%rip), %rdi
+	leaq	.LC16(%rip), %rsi
+	movl	$2, %eax
+	divsd	%xmm2, %xmm0
+	divsd	.LC11(%rip), %xmm0
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+.L56:
+	movq	%r13, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$296, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L10:
+	.cfi_restore_state
+	pxor	%xmm2, %xmm2
+	movsd	(%rsp), %xmm0
+	movsd	8(%rsp), %xmm1
+	cvtsi2sdq	%r15, %xmm2
+.L16:
+	pxor	%xmm3, %xmm3
+	divsd	.LC11(%rip), %xmm2
+	comisd	%xmm2, %xmm3
+	jb	.L17
+	movsd	.LC1(%rip), %xmm2
+.L17:
+	divsd	%xmm2, %xmm1
+	leaq	.LC12(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	leaq	.LC14(%rip), %r14
+	divsd	%xmm2, %xmm0
+	divsd	.LC11(%rip), %xmm0
+	call	printf@PLT
+	call	clock@PLT
+	movq	$0x000000000, (%rsp)
+	testq	%rbx, %rbx
+	movq	$0x000000000, 8(%rsp)
+	movq	%rax, %r15
+	movq	%r13, 32(%rsp)
+	movq	%rbp, 40(%rsp)
+	setne	16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	movl	72(%rsp), %eax
+	testl	%eax, %eax
+	je	.L36
+	cmpb	$0, 16(%rsp)
+	je	.L36
+	xorl	%ebp, %ebp
+	xorl	%r13d, %r13d
+	jmp	.L19
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	cmpq	%rbx, %rbp
+	jnb	.L39
+.L19:
+	movl	%r13d, %eax
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 384
+	pxor	%xmm7, %xmm7
+	movq	%rbx, %rsi
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	pxor	%xmm4, %xmm4
+	subq	%rbp, %rsi
+	pxor	%xmm3, %xmm3
+	pxor	%xmm2, %xmm2
+	pxor	%xmm1, %xmm1
+	movq	%r14, %rdx
+	imulq	$456, %rax, %rax
+	pxor	%xmm0, %xmm0
+	leaq	(%r12,%rbp), %rdi
+	addl	$1, %r13d
+	addq	96(%rsp), %rax
+	pxor	%xmm8, %xmm8
+	cvtss2sd	92(%rax), %xmm8
+	movq	(%rax), %rcx
+	movq	152(%rax), %r9
+	cvtss2sd	44(%rax), %xmm7
+	cvtss2sd	40(%rax), %xmm6
+	cvtss2sd	32(%rax), %xmm5
+	cvtss2sd	28(%rax), %xmm4
+	movl	128(%rax), %r8d
+	cvtss2sd	24(%rax), %xmm3
+	cvtss2sd	16(%rax), %xmm2
+	cvtss2sd	12(%rax), %xmm1
+	cvtss2sd	8(%rax), %xmm0
+	movsd	%xmm8, 24(%rsp)
+	pxor	%xmm8, %xmm8
+	cvtss2sd	96(%rax), %xmm8
+	movsd	%xmm8, 16(%rsp)
+	pxor	%xmm8, %xmm8
+	cvtss2sd	88(%rax), %xmm8
+	movsd	%xmm8, 8(%rsp)
+	pxor	%xmm8, %xmm8
+	cvtss2sd	48(%rax), %xmm8
+	movl	$8, %eax
+	movsd	%xmm8, (%rsp)
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbp
+	movl	104(%rsp), %eax
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 352
+	cmpl	%eax, %r13d
+	jb	.L59
+.L39:
+	testq	%rbp, %rbp
+	js	.L21
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rbp, %xmm0
+.L18:
+	addsd	(%rsp), %xmm0
+	movsd	%xmm0, (%rsp)
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+	addsd	8(%rsp), %xmm0
+	movsd	%xmm0, 8(%rsp)
+	call	clock@PLT
+	pxor	%xmm2, %xmm2
+	movsd	.LC10(%rip), %xmm6
+	subq	%r15, %rax
+	cvtsi2sdq	%rax, %xmm2
+	comisd	%xmm2, %xmm6
+	ja	.L25
+	pxor	%xmm0, %xmm0
+	movapd	%xmm2, %xmm1
+	movq	32(%rsp), %r13
+	divsd	.LC11(%rip), %xmm1
+	comisd	%xmm1, %xmm0
+	movq	40(%rsp), %rbp
+	jb	.L26
+	movsd	.LC1(%rip), %xmm1
+.L26:
+	movsd	8(%rsp), %xmm3
+	movsd	(%rsp), %xmm0
+	leaq	.LC15(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	movsd	%xmm2, 16(%rsp)
+	divsd	%xmm1, %xmm3
+	divsd	%xmm1, %xmm0
+	movapd	%xmm3, %xmm1
+	divsd	.LC11(%rip), %xmm0
+	call	printf@PLT
+	call	clock@PLT
+	pxor	%xmm1, %xmm1
+	movq	24(%rsp), %r15
+	movq	%rax, %r14
+	movsd	%xmm1, (%rsp)
+	movsd	%xmm1, 8(%rsp)
+	jmp	.L32
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	pxor	%xmm2, %xmm2
+	cvtsi2sdq	%rax, %xmm2
+.L29:
+	addsd	(%rsp), %xmm2
+	movl	72(%rsp), %eax
+	movsd	%xmm2, (%rsp)
+	pxor	%xmm2, %xmm2
+	cvtsi2sdq	%rax, %xmm2
+	addsd	8(%rsp), %xmm2
+	movsd	%xmm2, 8(%rsp)
+	call	clock@PLT
+	pxor	%xmm3, %xmm3
+	movsd	.LC10(%rip), %xmm7
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm3
+	comisd	%xmm3, %xmm7
+	movsd	%xmm3, 16(%rsp)
+	jbe	.L33
+.L32:
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	writeWavefrontMTLToBuffer@PLT
+	testl	%eax, %eax
+	jne	.L33
+	movq	56(%rsp), %rdx
+	xorl	%ecx, %ecx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	jne	.L33
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	56(%rsp), %rax
+	testq	%rax, %rax
+	jns	.L60
+	movq	%rax, %rdx
+	andl	$1, %eax
+	pxor	%xmm2, %xmm2
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm2
+	addsd	%xmm2, %xmm2
+	jmp	.L29
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movq	%rbp, %rdx
+	movq	%rbp, %r10
+	pxor	%xmm0, %xmm0
+	shrq	%rdx
+	andl	$1, %r10d
+	orq	%r10, %rdx
+	cvtsi2sdq	%rdx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L18
+.L36:
+	pxor	%xmm0, %xmm0
+	jmp	.L18
+.L57:
+	movsd	(%rsp), %xmm0
+	movsd	8(%rsp), %xmm1
+	jmp	.L16
+	.cfi_endproc
+.LFE26:
+	.size	wavefrontMaterialWriterBench, .-wavefrontMaterialWriterBench
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	-1598689907
+	.long	1051772663
+	.align 8
+.LC3:
+	.long	12345
+	.long	12345
+	.align 8
+.LC4:
+	.long	864026624
+	.long	864026624
+	.set	.LC5,.LC4
+	.align 8
+.LC8:
+	.long	1119889448
+	.long	1065353216
+	.align 8
+.LC10:
+	.long	0
+	.long	1092519040
+	.align 8
+.LC11:
+	.long	0
+	.long	1093567616
+	.section	.note.GNU-stack,"",@progbits
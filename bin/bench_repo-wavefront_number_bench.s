@@ -0,0 +1,353 @@
+	.file	"wavefront_number_bench.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC5:
+	.string	"strtof"
+.LC6:
+	.string	"%s %s"
+.LC7:
+	.string	"%-44s %12.0f numbers/sec\n"
+.LC8:
+	.string	"parseWavefrontFloat"
+	.text
+	.p2align 4
+	.type	benchNumbers.constprop.0, @function
+benchNumbers.constprop.0:
+.LFB25:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	numbers.0(%rip), %rbx
+	leaq	131072(%rbx), %r13
+	movq	%rbx, %rbp
+	subq	$32936, %rsp
+	.cfi_def_cfa_offset 32992
+	leaq	160(%rsp), %rax
+	movq	%rdi, 40(%rsp)
+	movq	%rax, 32(%rsp)
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	movq	%rbp, %rdi
+	addq	$32, %rbp
+	addq	$8, %r12
+	call	strlen@PLT
+	movq	%rax, -8(%r12)
+	cmpq	%r13, %rbp
+	jne	.L2
+	leaq	64(%rsp), %rax
+	movl	$0x00000000, 60(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	96(%rsp), %rbp
+	movq	%rax, 24(%rsp)
+	leaq	80(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	movq	32(%rsp), %rax
+	movq	$0, (%rsp)
+	movaps	%xmm0, 64(%rsp)
+	leaq	32768(%rax), %r12
+	movaps	%xmm0, 80(%rsp)
+.L7:
+	call	clock@PLT
+	movq	%rax, 8(%rsp)
+.L6:
+	cmpq	$0, (%rsp)
+	je	.L12
+	movq	32(%rsp), %r14
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movq	(%r14), %rsi
+	leaq	(%r15,%rbx), %rdi
+	movq	%rbp, %rdx
+	addq	$8, %r14
+	movl	$0x00000000, 96(%rsp)
+	addq	%r15, %rsi
+	addq	$32, %r15
+	addq	%rbx, %rsi
+	call	parseWavefrontFloat@PLT
+	movss	60(%rsp), %xmm0
+	addss	96(%rsp), %xmm0
+	movss	%xmm0, 60(%rsp)
+	cmpq	%r12, %r14
+	jne	.L4
+.L5:
+	movq	(%rsp), %r14
+	movq	24(%rsp), %rax
+	movsd	.LC2(%rip), %xmm0
+	addsd	(%rax,%r14,8), %xmm0
+	movsd	%xmm0, (%rax,%r14,8)
+	call	clock@PLT
+	movq	8(%rsp), %rcx
+	pxor	%xmm0, %xmm0
+	movsd	.LC3(%rip), %xmm2
+	subq	%rcx, %rax
+	movq	16(%rsp), %rcx
+	cvtsi2sdq	%rax, %xmm0
+	movq	%rax, (%rcx,%r14,8)
+	comisd	%xmm0, %xmm2
+	ja	.L6
+	cmpq	$0, (%rsp)
+	jne	.L26
+	movq	$1, (%rsp)
+	jmp	.L7
+.L12:
+	movq	%rbx, %r15
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	movq	%r15, %rdi
+	xorl	%esi, %esi
+	movl	$0x00000000, 96(%rsp)
+	addq	$32, %r15
+	call	strtof@PLT
+	movss	60(%rsp), %xmm1
+	addss	%xmm1, %xmm0
+	movss	%xmm0, 60(%rsp)
+	cmpq	%r13, %r15
+	jne	.L3
+	jmp	.L5
+.L26:
+	movq	40(%rsp), %r8
+	xorl	%eax, %eax
+	pxor	%xmm1, %xmm1
+	movl	$64, %esi
+	leaq	.LC6(%rip), %r12
+	leaq	.LC5(%rip), %rcx
+	movq	%rbp, %rdi
+	movq	%r12, %rdx
+	cvtsi2sdq	80(%rsp), %xmm1
+	divsd	.LC4(%rip), %xmm1
+	movsd	%xmm1, (%rsp)
+	call	snprintf@PLT
+	movsd	(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm1
+	jbe	.L22
+	movsd	64(%rsp), %xmm0
+	divsd	%xmm1, %xmm0
+.L8:
+	leaq	.LC7(%rip), %rbx
+	movq	%rbp, %rsi
+	movl	$1, %eax
+	movq	%rbx, %rdi
+	call	printf@PLT
+	movq	40(%rsp), %r8
+	xorl	%eax, %eax
+	pxor	%xmm1, %xmm1
+	leaq	.LC8(%rip), %rcx
+	movq	%r12, %rdx
+	movl	$64, %esi
+	movq	%rbp, %rdi
+	cvtsi2sdq	88(%rsp), %xmm1
+	divsd	.LC4(%rip), %xmm1
+	movsd	%xmm1, (%rsp)
+	call	snprintf@PLT
+	movsd	(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	comisd	%xmm0, %xmm1
+	jbe	.L23
+	movsd	72(%rsp), %xmm0
+	divsd	%xmm1, %xmm0
+.L10:
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	addq	$32936, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L22:
+	.cfi_restore_state
+	pxor	%xmm0, %xmm0
+	jmp	.L8
+.L23:
+	pxor	%xmm0, %xmm0
+	jmp	.L10
+	.cfi_endproc
+.LFE25:
+	.size	benchNumbers.constprop.0, .-benchNumbers.constprop.0
+	.section	.rodata.str1.1
+.LC12:
+	.string	"%f"
+.LC13:
+	.string	"%.4f"
+.LC14:
+	.string	"%.9g"
+	.text
+	.p2align 4
+	.globl	wavefrontNumberBench
+	.type	wavefrontNumberBench, @function
+wavefrontNumberBench:
+.LFB24:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	.LC12(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	leaq	numbers.0(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	$7, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	imull	$1103515245, %ebx, %ebx
+	pxor	%xmm0, %xmm0
+	addl	$12345, %ebx
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	cvtsi2sdl	%eax, %xmm0
+	mulsd	.LC10(%rip), %xmm0
+	testb	$3, %bpl
+	jne	.L28
+	mulsd	.LC11(%rip), %xmm0
+.L28:
+	movq	%rbp, %rdi
+	movq	%r13, %rdx
+	movl	$32, %esi
+	movl	$1, %eax
+	salq	$5, %rdi
+	addq	$1, %rbp
+	addq	%r12, %rdi
+	call	snprintf@PLT
+	cmpq	$4096, %rbp
+	jne	.L29
+	movq	%r13, %rdi
+	xorl	%ebp, %ebp
+	movl	$7, %ebx
+	call	benchNumbers.constprop.0
+	leaq	.LC13(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	imull	$1103515245, %ebx, %ebx
+	pxor	%xmm0, %xmm0
+	addl	$12345, %ebx
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	cvtsi2sdl	%eax, %xmm0
+	mulsd	.LC10(%rip), %xmm0
+	testb	$3, %bpl
+	jne	.L30
+	mulsd	.LC11(%rip), %xmm0
+.L30:
+	movq	%rbp, %rdi
+	movq	%r13, %rdx
+	movl	$32, %esi
+	movl	$1, %eax
+	salq	$5, %rdi
+	addq	$1, %rbp
+	addq	%r12, %rdi
+	call	snprintf@PLT
+	cmpq	$4096, %rbp
+	jne	.L31
+	movq	%r13, %rdi
+	xorl	%ebp, %ebp
+	movl	$7, %ebx
+	call	benchNumbers.constprop.0
+	leaq	.LC14(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	imull	$1103515245, %ebx, %ebx
+	pxor	%xmm0, %xmm0
+	addl	$12345, %ebx
+	movl	%ebx, %eax
+	shrl	$8, %eax
+	cvtsi2sdl	%eax, %xmm0
+	mulsd	.LC10(%rip), %xmm0
+	testb	$3, %bpl
+	jne	.L32
+	mulsd	.LC11(%rip), %xmm0
+.L32:
+	movq	%rbp, %rdi
+	movq	%r13, %rdx
+	movl	$32, %esi
+	movl	$1, %eax
+	salq	$5, %rdi
+	addq	$1, %rbp
+	addq	%r12, %rdi
+	call	snprintf@PLT
+	cmpq	$4096, %rbp
+	jne	.L33
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	movq	%r13, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	benchNumbers.constprop.0
+	.cfi_endproc
+.LFE24:
+	.size	wavefrontNumberBench, .-wavefrontNumberBench
+	.local	numbers.0
+	.comm	numbers.0,131072,32
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC2:
+	.long	0
+	.long	1085276160
+	.align 8
+.LC3:
+	.long	0
+	.long	1092519040
+	.align 8
+.LC4:
+	.long	0
+	.long	1093567616
+	.align 8
+.LC10:
+	.long	0
+	.long	1047527424
+	.align 8
+.LC11:
+	.long	0
+	.long	1083129856
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,290 @@
+	.file	"wavefront_scan_bench.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC4:
+	.string	"%-44s %12.1f MB/sec\n"
+	.text
+	.p2align 4
+	.type	benchKernel.constprop.0, @function
+benchKernel.constprop.0:
+.LFB25:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$1048576, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	subq	$1064, %rsp
+	.cfi_def_cfa_offset 1120
+	movq	%rdi, 8(%rsp)
+	leaq	32(%rsp), %r13
+	movq	$0, 24(%rsp)
+	call	clock@PLT
+	movq	$0x000000000, (%rsp)
+	movq	%rax, %r14
+	jmp	.L4
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	movsd	.LC1(%rip), %xmm3
+	addsd	(%rsp), %xmm3
+	movsd	%xmm3, (%rsp)
+	call	clock@PLT
+	pxor	%xmm0, %xmm0
+	movsd	.LC2(%rip), %xmm5
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm0
+	comisd	%xmm0, %xmm5
+	jbe	.L14
+.L4:
+	xorl	%r15d, %r15d
+.L3:
+	movq	%r12, %rdx
+	leaq	(%rbx,%r15), %rsi
+	movl	$256, %r8d
+	movq	%r13, %rcx
+	subq	%r15, %rdx
+	movl	%ebp, %edi
+	call	wavefrontFindLineEnds@PLT
+	movq	24(%rsp), %rdx
+	addq	%rax, %rdx
+	movq	%rdx, 24(%rsp)
+	cmpq	$256, %rax
+	jne	.L2
+	movl	1052(%rsp), %eax
+	leaq	1(%r15,%rax), %r15
+	cmpq	$1048575, %r15
+	jbe	.L3
+	jmp	.L2
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	movsd	.LC3(%rip), %xmm2
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	divsd	%xmm2, %xmm1
+	comisd	%xmm0, %xmm1
+	jbe	.L11
+	movsd	(%rsp), %xmm0
+	divsd	%xmm1, %xmm0
+	divsd	%xmm2, %xmm0
+.L5:
+	movq	8(%rsp), %rsi
+	leaq	.LC4(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+	addq	$1064, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L11:
+	.cfi_restore_state
+	pxor	%xmm0, %xmm0
+	jmp	.L5
+	.cfi_endproc
+.LFE25:
+	.size	benchKernel.constprop.0, .-benchKernel.constprop.0
+	.section	.rodata.str1.1
+.LC5:
+	.string	"newmtl material\n"
+.LC6:
+	.string	"wavefrontFindLineEnds scalar"
+.LC7:
+	.string	"wavefrontFindLineEnds sse2"
+.LC8:
+	.string	"wavefrontFindLineEnds avx2"
+	.text
+	.p2align 4
+	.globl	wavefrontScanBench
+	.type	wavefrontScanBench, @function
+wavefrontScanBench:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$1048576, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	call	malloc@PLT
+	testq	%rax, %rax
+	je	.L15
+	movl	$110, %edx
+	movq	%rax, %rbx
+	leaq	.LC5(%rip), %rcx
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	leaq	lines.0(%rip), %rdi
+	testb	%dl, %dl
+	je	.L17
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	cmpq	$1048575, %rax
+	ja	.L17
+	subq	%rax, %rcx
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	cmpq	$1048575, %rax
+	ja	.L20
+.L18:
+	addq	$1, %rax
+	movb	%dl, -1(%rbx,%rax)
+	movzbl	(%rcx,%rax), %edx
+	testb	%dl, %dl
+	jne	.L41
+.L20:
+	addl	$1, %esi
+	cmpq	$1048576, %rax
+	je	.L22
+.L21:
+	movl	%esi, %ecx
+	movl	%esi, %edx
+	imulq	$613566757, %rcx, %rcx
+	shrq	$32, %rcx
+	subl	%ecx, %edx
+	shrl	%edx
+	addl	%ecx, %edx
+	shrl	$2, %edx
+	leal	0(,%rdx,8), %ecx
+	subl	%edx, %ecx
+	movl	%esi, %edx
+	subl	%ecx, %edx
+	movq	(%rdi,%rdx,8), %rcx
+	movzbl	(%rcx), %edx
+	testb	%dl, %dl
+	jne	.L42
+.L17:
+	addl	$1, %esi
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	xorl	%eax, %eax
+	call	wavefrontScanKernel@PLT
+	xorl	%esi, %esi
+	movq	%rbx, %rdx
+	leaq	.LC6(%rip), %rdi
+	movl	%eax, %ebp
+	call	benchKernel.constprop.0
+	testl	%ebp, %ebp
+	jg	.L43
+.L25:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+.L15:
+	.cfi_restore_state
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L43:
+	.cfi_restore_state
+	movq	%rbx, %rdx
+	movl	$1, %esi
+	leaq	.LC7(%rip), %rdi
+	call	benchKernel.constprop.0
+	cmpl	$1, %ebp
+	je	.L25
+	movq	%rbx, %rdx
+	leaq	.LC8(%rip), %rdi
+	movl	$2, %esi
+	call	benchKernel.constprop.0
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.cfi_endproc
+.LFE24:
+	.size	wavefrontScanBench, .-wavefrontScanBench
+	.section	.rodata.str1.1
+.LC9:
+	.string	"Ns 96.078431\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC10:
+	.string	"Ka 1.000000 1.000000 1.000000\n"
+	.align 8
+.LC11:
+	.string	"Kd 0.640000 0.640000 0.640000\n"
+	.section	.rodata.str1.1
+.LC12:
+	.string	"illum 2\n"
+.LC13:
+	.string	"map_Kd diffuse.png\n"
+.LC14:
+	.string	"\n"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	lines.0, @object
+	.size	lines.0, 56
+lines.0:
+	.quad	.LC5
+	.quad	.LC9
+	.quad	.LC10
+	.quad	.LC11
+	.quad	.LC12
+	.quad	.LC13
+	.quad	.LC14
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	0
+	.long	1093664768
+	.align 8
+.LC2:
+	.long	0
+	.long	1092519040
+	.align 8
+.LC3:
+	.long	0
+	.long	1093567616
+	.section	.note.GNU-stack,"",@progbits
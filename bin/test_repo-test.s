@@ -0,0 +1,59 @@
+	.file	"test.c"
+	.text
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Asserts Passed: %d, Failed: %d\n"
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB11:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	wavefrontAllocatorTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialArraysTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialCacheTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialCompactTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialParserTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontMaterialWriterTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontNumberTest@PLT
+	xorl	%eax, %eax
+	call	wavefrontScanTest@PLT
+	movl	asserts_failed(%rip), %edx
+	movl	asserts_passed(%rip), %esi
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+	call	printf@PLT
+	movl	asserts_failed(%rip), %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	main, .-main
+	.globl	asserts_failed
+	.bss
+	.align 4
+	.type	asserts_failed, @object
+	.size	asserts_failed, 4
+asserts_failed:
+	.zero	4
+	.globl	asserts_passed
+	.align 4
+	.type	asserts_passed, @object
+	.size	asserts_passed, 4
+asserts_passed:
+	.zero	4
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1938 @@
+	.file	"wavefront_allocator_test.c"
+	.text
+	.p2align 4
+	.type	trackingRelease, @function
+trackingRelease:
+.LFB25:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	heapLock(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movq	4(%rbx), %xmm0
+	movq	%r12, %rdi
+	movq	.LC0(%rip), %xmm1
+	paddd	%xmm1, %xmm0
+	movq	%xmm0, 4(%rbx)
+	call	pthread_mutex_unlock@PLT
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT
+	.cfi_endproc
+.LFE25:
+	.size	trackingRelease, .-trackingRelease
+	.p2align 4
+	.type	trackingReallocate, @function
+trackingReallocate:
+.LFB24:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	heapLock(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	movq	%r13, %rdi
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	call	pthread_mutex_lock@PLT
+	addl	$1, (%rbx)
+	movq	%r13, %rdi
+	call	pthread_mutex_unlock@PLT
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	jmp	realloc@PLT
+	.cfi_endproc
+.LFE24:
+	.size	trackingReallocate, .-trackingReallocate
+	.p2align 4
+	.type	trackingAllocate, @function
+trackingAllocate:
+.LFB23:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	heapLock(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movl	12(%rbx), %edx
+	movl	8(%rbx), %eax
+	testl	%edx, %edx
+	je	.L8
+	cmpl	%eax, %edx
+	je	.L13
+.L8:
+	addl	$1, (%rbx)
+	addl	$1, %eax
+	movq	%r12, %rdi
+	movl	%eax, 8(%rbx)
+	call	pthread_mutex_unlock@PLT
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	malloc@PLT
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	trackingAllocate, .-trackingAllocate
+	.p2align 4
+	.type	sameLibrary, @function
+sameLibrary:
+.LFB33:
+	.cfi_startproc
+	movl	8(%rdi), %eax
+	cmpl	8(%rsi), %eax
+	je	.L15
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	40(%rdi), %edx
+	cmpl	40(%rsi), %edx
+	jne	.L17
+	testl	%eax, %eax
+	je	.L18
+	xorl	%r13d, %r13d
+	jmp	.L19
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	cmpl	%r13d, %eax
+	jne	.L17
+	movq	(%r12), %rcx
+	movq	0(%rbp), %rsi
+	movq	%r12, %rdx
+	movq	%rbp, %rdi
+	addq	%rbx, %rcx
+	addq	%rbx, %rsi
+	call	wavefrontMaterialEqual@PLT
+	testl	%eax, %eax
+	je	.L17
+	addl	$1, %r13d
+	cmpl	8(%rbp), %r13d
+	jnb	.L33
+.L19:
+	movl	%r13d, %ebx
+	movq	(%r12), %rax
+	imulq	$456, %rbx, %rbx
+	movq	(%rax,%rbx), %r14
+	movq	0(%rbp), %rax
+	movq	(%rax,%rbx), %rdi
+	movq	%r14, %rsi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L34
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	xorl	%eax, %eax
+.L14:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.cfi_restore_state
+	movl	40(%rbp), %edx
+.L18:
+	testl	%edx, %edx
+	je	.L21
+	movq	32(%r12), %rbx
+	movq	32(%rbp), %rbp
+	leaq	(%rbx,%rdx,8), %r12
+	jmp	.L20
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	addq	$8, %rbx
+	addq	$8, %rbp
+	cmpq	%rbx, %r12
+	je	.L21
+.L20:
+	movq	(%rbx), %rsi
+	movq	0(%rbp), %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L35
+	jmp	.L17
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movl	$1, %eax
+	jmp	.L14
+	.cfi_endproc
+.LFE33:
+	.size	sameLibrary, .-sameLibrary
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"src/wavefront_allocator_test.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"%s:%d: %lld != %lld\n"
+	.text
+	.p2align 4
+	.globl	testAllocatorRoutesParse
+	.type	testAllocatorRoutesParse, @function
+testAllocatorRoutesParse:
+.LFB28:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	xorl	%esi, %esi
+	movl	$16, %edx
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	memset@PLT
+	leaq	trackingAllocate(%rip), %rdx
+	movq	%rbx, 40(%rsp)
+	leaq	trackingReallocate(%rip), %rax
+	movq	%rax, %xmm1
+	movq	%rdx, %xmm0
+	leaq	16(%rsp), %rbx
+	punpcklqdq	%xmm1, %xmm0
+	leaq	trackingRelease(%rip), %rax
+	movq	%rbx, %rdi
+	movq	%rax, 32(%rsp)
+	movaps	%xmm0, 16(%rsp)
+	call	wavefrontSetAllocator@PLT
+	leaq	allocatorInput(%rip), %rsi
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L37
+	movl	(%rsp), %edx
+	addl	$1, asserts_passed(%rip)
+	testl	%edx, %edx
+	jle	.L39
+.L46:
+	movl	8(%rsp), %eax
+	addl	$1, asserts_passed(%rip)
+	testl	%eax, %eax
+	jle	.L41
+.L47:
+	addl	$1, asserts_passed(%rip)
+.L42:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	8(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L43
+	xorl	%edi, %edi
+	addl	$1, asserts_passed(%rip)
+	call	wavefrontSetAllocator@PLT
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.cfi_restore_state
+	movl	$76, %edx
+	xorl	%r8d, %r8d
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	(%rsp), %edx
+	testl	%edx, %edx
+	jg	.L46
+.L39:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$77, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	8(%rsp), %eax
+	testl	%eax, %eax
+	jg	.L47
+.L41:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$78, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L42
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	xorl	%r8d, %r8d
+	movl	$81, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	xorl	%edi, %edi
+	call	wavefrontSetAllocator@PLT
+	subq	$-128, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	testAllocatorRoutesParse, .-testAllocatorRoutesParse
+	.p2align 4
+	.globl	testAllocatorFailure
+	.type	testAllocatorFailure, @function
+testAllocatorFailure:
+.LFB29:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	$16, %edx
+	xorl	%esi, %esi
+	leaq	.LC1(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	leaq	.LC2(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	leaq	allocatorInput(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 176
+	movq	%rsp, %rbx
+	leaq	16(%rsp), %rbp
+	movq	%rbx, %rdi
+	call	memset@PLT
+	leaq	trackingReallocate(%rip), %rax
+	movq	%rbp, %rdi
+	leaq	trackingAllocate(%rip), %rdx
+	movq	%rax, %xmm1
+	movq	%rdx, %xmm0
+	movq	%rbx, 40(%rsp)
+	leaq	trackingRelease(%rip), %rax
+	punpcklqdq	%xmm1, %xmm0
+	movq	%rax, 32(%rsp)
+	movl	$1, %ebx
+	movaps	%xmm0, 16(%rsp)
+	call	wavefrontSetAllocator@PLT
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movl	%ebx, 12(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	testl	%eax, %eax
+	je	.L60
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L51
+	addl	$1, asserts_passed(%rip)
+.L50:
+	movslq	8(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L52
+	addl	$1, %ebx
+	addl	$1, asserts_passed(%rip)
+	cmpl	$16, %ebx
+	jne	.L55
+.L54:
+	xorl	%edi, %edi
+	call	wavefrontSetAllocator@PLT
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$95, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, %ebx
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	cmpl	$16, %ebx
+	jne	.L55
+	jmp	.L54
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movl	$1, %r8d
+	movl	$94, %edx
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L50
+	.cfi_endproc
+.LFE29:
+	.size	testAllocatorFailure, .-testAllocatorFailure
+	.p2align 4
+	.globl	testAllocateZeroed
+	.type	testAllocateZeroed, @function
+testAllocateZeroed:
+.LFB30:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	$4, %esi
+	movl	$16, %edi
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 96
+	call	wavefrontAllocateZeroed@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L62
+	addl	$1, asserts_passed(%rip)
+	movq	%rax, %rbx
+	leaq	64(%rax), %rbp
+	leaq	.LC1(%rip), %r14
+	leaq	.LC2(%rip), %r13
+	jmp	.L63
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	addq	$1, %rbx
+	addl	$1, asserts_passed(%rip)
+	cmpq	%rbx, %rbp
+	je	.L64
+.L63:
+	movzbl	(%rbx), %ecx
+	testq	%rcx, %rcx
+	je	.L75
+	xorl	%r8d, %r8d
+	movl	$103, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addq	$1, %rbx
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	cmpq	%rbx, %rbp
+	jne	.L63
+.L64:
+	movq	%r12, %rdi
+	call	wavefrontFree@PLT
+	movl	$2, %esi
+	movq	$-1, %rdi
+	call	wavefrontAllocateZeroed@PLT
+	testq	%rax, %rax
+	je	.L76
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$105, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L68:
+	movq	%rsp, %rbx
+	xorl	%esi, %esi
+	movl	$16, %edx
+	movq	%rbx, %rdi
+	call	memset@PLT
+	leaq	16(%rsp), %rdi
+	movq	%rbx, 40(%rsp)
+	leaq	trackingAllocate(%rip), %rdx
+	leaq	trackingReallocate(%rip), %rax
+	movq	%rdx, %xmm0
+	movq	%rax, %xmm1
+	leaq	trackingRelease(%rip), %rax
+	punpcklqdq	%xmm1, %xmm0
+	movq	%rax, 32(%rsp)
+	movaps	%xmm0, 16(%rsp)
+	call	wavefrontSetAllocator@PLT
+	movl	$8, %esi
+	xorl	%edi, %edi
+	call	wavefrontReallocate@PLT
+	movslq	(%rsp), %rcx
+	movq	%rax, %rbx
+	cmpq	$1, %rcx
+	jne	.L69
+	addl	$1, asserts_passed(%rip)
+.L70:
+	movq	%rbx, %rdi
+	call	wavefrontFree@PLT
+	xorl	%edi, %edi
+	call	wavefrontFree@PLT
+	movslq	4(%rsp), %rcx
+	cmpq	$1, %rcx
+	jne	.L71
+	addl	$1, asserts_passed(%rip)
+.L72:
+	xorl	%edi, %edi
+	call	wavefrontSetAllocator@PLT
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$110, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L70
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	movl	$1, %r8d
+	movl	$113, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L68
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$102, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L64
+	.cfi_endproc
+.LFE30:
+	.size	testAllocateZeroed, .-testAllocateZeroed
+	.section	.rodata.str1.1
+.LC3:
+	.string	"second"
+	.text
+	.p2align 4
+	.globl	testAllocatorPerLibrary
+	.type	testAllocatorPerLibrary, @function
+testAllocatorPerLibrary:
+.LFB31:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	trackingReallocate(%rip), %rax
+	leaq	trackingAllocate(%rip), %rdx
+	xorl	%esi, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rax, %xmm2
+	movq	%rdx, %xmm1
+	movl	$16, %edx
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	punpcklqdq	%xmm2, %xmm1
+	leaq	allocatorInput(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	trackingRelease(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$792, %rsp
+	.cfi_def_cfa_offset 848
+	leaq	48(%rsp), %rbx
+	movaps	%xmm1, (%rsp)
+	leaq	112(%rsp), %r14
+	movq	%rbx, %rdi
+	leaq	608(%rsp), %rbp
+	call	memset@PLT
+	movdqa	(%rsp), %xmm1
+	movq	%rbp, %rdi
+	movq	%rbx, 632(%rsp)
+	leaq	64(%rsp), %rbx
+	movq	%r12, 624(%rsp)
+	movaps	%xmm1, 608(%rsp)
+	call	wavefrontSetAllocator@PLT
+	movq	%rbx, %rdi
+	movl	$16, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	movq	%rbx, 104(%rsp)
+	movq	%r14, %rcx
+	movq	%r13, %rsi
+	movdqa	(%rsp), %xmm1
+	pxor	%xmm0, %xmm0
+	movq	%r12, 96(%rsp)
+	leaq	272(%rsp), %rbx
+	leaq	80(%rsp), %r12
+	movl	$85, %edx
+	movq	%rbx, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movq	$0, 144(%rsp)
+	movq	%r12, 136(%rsp)
+	movaps	%xmm1, 80(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L78
+	addl	$1, asserts_passed(%rip)
+.L79:
+	cmpq	%r12, 376(%rsp)
+	je	.L107
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$126, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L81:
+	movdqa	.LC4(%rip), %xmm0
+	leaq	208(%rsp), %r15
+	movl	$46, %edx
+	movq	%rbx, %rdi
+	movq	%r15, %rcx
+	leaq	160(%rsp), %rsi
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC5(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC6(%rip), %xmm0
+	movups	%xmm0, 191(%rsp)
+	call	wavefrontMTLReload@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L82
+	addl	$1, asserts_passed(%rip)
+.L83:
+	movl	216(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L84
+	addl	$1, asserts_passed(%rip)
+.L85:
+	movq	%r15, %rdi
+	call	wavefrontMTLChangesRelease@PLT
+	leaq	40(%rsp), %rdx
+	leaq	32(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L86
+	addl	$1, asserts_passed(%rip)
+.L87:
+	movq	40(%rsp), %rdx
+	movq	32(%rsp), %rsi
+	leaq	384(%rsp), %r15
+	movq	%r12, %rcx
+	movq	%r15, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L88
+	addl	$1, asserts_passed(%rip)
+.L89:
+	movq	32(%rsp), %rsi
+	movq	%r12, %rdi
+	leaq	496(%rsp), %r12
+	call	wavefrontFreeWith@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLAppend@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L90
+	addl	$1, asserts_passed(%rip)
+.L91:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r15, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r14, %rcx
+	movl	$85, %edx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L92
+	addl	$1, asserts_passed(%rip)
+.L93:
+	leaq	28(%rsp), %rdx
+	leaq	.LC3(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexFind@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L94
+	addl	$1, asserts_passed(%rip)
+.L95:
+	movslq	28(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L96
+	movq	%rbp, %rdi
+	addl	$1, asserts_passed(%rip)
+	call	wavefrontMTLIndexRelease@PLT
+	movl	64(%rsp), %eax
+	testl	%eax, %eax
+	jle	.L98
+.L108:
+	addl	$1, asserts_passed(%rip)
+.L99:
+	movslq	72(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L100
+	addl	$1, asserts_passed(%rip)
+.L101:
+	movslq	56(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L102
+	addl	$1, asserts_passed(%rip)
+.L103:
+	movl	52(%rsp), %eax
+	cmpl	%eax, 48(%rsp)
+	jne	.L104
+	addl	$1, asserts_passed(%rip)
+.L105:
+	xorl	%edi, %edi
+	call	wavefrontSetAllocator@PLT
+	addq	$792, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$133, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L85
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$164, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L105
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	movl	$2, %r8d
+	movl	$146, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L91
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L81
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	xorl	%r8d, %r8d
+	movl	$141, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L89
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	xorl	%r8d, %r8d
+	movl	$138, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L87
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	xorl	%r8d, %r8d
+	movl	$153, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L93
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	xorl	%r8d, %r8d
+	movl	$125, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L79
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	xorl	%r8d, %r8d
+	movl	$132, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L83
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	xorl	%r8d, %r8d
+	movl	$163, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L103
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	xorl	%r8d, %r8d
+	movl	$161, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L101
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	xorl	%r8d, %r8d
+	movl	$157, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexRelease@PLT
+	movl	64(%rsp), %eax
+	testl	%eax, %eax
+	jg	.L108
+.L98:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$160, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L99
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	xorl	%r8d, %r8d
+	movl	$156, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L95
+	.cfi_endproc
+.LFE31:
+	.size	testAllocatorPerLibrary, .-testAllocatorPerLibrary
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"newmtl m%u\nKd 0.5 0.5 0.5\nmap_Kd shared.png\n"
+	.text
+	.p2align 4
+	.globl	testAllocatorPerLibraryParallel
+	.type	testAllocatorPerLibraryParallel, @function
+testAllocatorPerLibraryParallel:
+.LFB32:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	leaq	trackingReallocate(%rip), %rax
+	movl	$1048576, %edi
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	leaq	trackingAllocate(%rip), %rdx
+	movq	%rax, %xmm3
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %xmm1
+	leaq	.LC8(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	punpcklqdq	%xmm3, %xmm1
+	movl	$3518437209, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$240, %rsp
+	.cfi_def_cfa_offset 288
+	movaps	%xmm1, (%rsp)
+	call	malloc@PLT
+	movq	%rax, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	movl	%r14d, %eax
+	movl	%r14d, %ecx
+	movl	$1048576, %esi
+	movq	%r12, %rdx
+	imulq	%rbp, %rax
+	subq	%r13, %rsi
+	leaq	(%rbx,%r13), %rdi
+	addl	$1, %r14d
+	shrq	$44, %rax
+	imull	$5000, %eax, %eax
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r13
+	leaq	64(%r13), %rax
+	cmpq	$1048575, %rax
+	jbe	.L110
+	leaq	16(%rsp), %rbp
+	movl	$16, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	leaq	trackingRelease(%rip), %r14
+	leaq	32(%rsp), %r12
+	call	memset@PLT
+	movdqa	(%rsp), %xmm2
+	movq	%rbp, 152(%rsp)
+	leaq	128(%rsp), %rbp
+	movq	%rbp, %rdi
+	movq	%r14, 144(%rsp)
+	movaps	%xmm2, 128(%rsp)
+	call	wavefrontSetAllocator@PLT
+	movl	$16, %edx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	memset@PLT
+	movdqa	(%rsp), %xmm2
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	pxor	%xmm0, %xmm0
+	leaq	48(%rsp), %rax
+	leaq	80(%rsp), %rcx
+	movq	%rbp, %rdi
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movq	%r14, 64(%rsp)
+	movq	%r12, 72(%rsp)
+	movq	$0, 112(%rsp)
+	movq	%rax, 104(%rsp)
+	movl	$4, 88(%rsp)
+	movaps	%xmm2, 48(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L111
+	addl	$1, asserts_passed(%rip)
+.L112:
+	movl	136(%rsp), %ecx
+	cmpq	$5000, %rcx
+	jne	.L113
+	addl	$1, asserts_passed(%rip)
+.L114:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	40(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L115
+	addl	$1, asserts_passed(%rip)
+.L116:
+	movslq	16(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L117
+	addl	$1, asserts_passed(%rip)
+.L118:
+	xorl	%edi, %edi
+	call	wavefrontSetAllocator@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	addq	$240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	.cfi_restore_state
+	movl	$5000, %r8d
+	movl	$185, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L114
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	xorl	%r8d, %r8d
+	movl	$184, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L112
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	xorl	%r8d, %r8d
+	movl	$188, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L118
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	xorl	%r8d, %r8d
+	movl	$187, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L116
+	.cfi_endproc
+.LFE32:
+	.size	testAllocatorPerLibraryParallel, .-testAllocatorPerLibraryParallel
+	.section	.rodata.str1.1
+.LC9:
+	.string	"(null)"
+.LC10:
+	.string	"first"
+.LC11:
+	.string	"third"
+.LC12:
+	.string	"changed.png"
+.LC13:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+	.text
+	.p2align 4
+	.globl	testAllocatorUpdateFailure
+	.type	testAllocatorUpdateFailure, @function
+testAllocatorUpdateFailure:
+.LFB34:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$16, %edx
+	xorl	%esi, %esi
+	leaq	.LC2(%rip), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC1(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	%edi, %ebx
+	subq	$536, %rsp
+	.cfi_def_cfa_offset 592
+	leaq	32(%rsp), %rbp
+	leaq	128(%rsp), %r14
+	movq	%rbp, %rdi
+	call	memset@PLT
+	leaq	trackingReallocate(%rip), %rax
+	movq	%rbp, 72(%rsp)
+	leaq	trackingAllocate(%rip), %rdx
+	movq	%rax, %xmm1
+	movq	%rdx, %xmm0
+	leaq	trackingRelease(%rip), %rax
+	movq	$0, 112(%rsp)
+	punpcklqdq	%xmm1, %xmm0
+	movq	%rax, 64(%rsp)
+	leaq	48(%rsp), %rax
+	leaq	allocatorInput(%rip), %rsi
+	movaps	%xmm0, 48(%rsp)
+	pxor	%xmm0, %xmm0
+	leaq	416(%rsp), %rbp
+	movaps	%xmm0, 96(%rsp)
+	movq	%rax, 104(%rsp)
+	leaq	304(%rsp), %rax
+	movq	%rax, %rdi
+	movaps	%xmm0, 80(%rsp)
+	movq	%rax, 16(%rsp)
+	movl	%ebx, 84(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movdqa	.LC4(%rip), %xmm0
+	leaq	80(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	192(%rsp), %rax
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC5(%rip), %xmm0
+	movq	%rax, (%rsp)
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC14(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC15(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC16(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC17(%rip), %xmm0
+	movaps	%xmm0, 272(%rsp)
+	movdqa	.LC18(%rip), %xmm0
+	movups	%xmm0, 284(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movq	8(%rsp), %rcx
+	movl	$85, %edx
+	movq	%rbp, %rdi
+	addl	$1, %r12d
+	leaq	allocatorInput(%rip), %rsi
+	movl	$0, 44(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movl	40(%rsp), %eax
+	movq	(%rsp), %rsi
+	movq	%r14, %rcx
+	movl	$107, %edx
+	movq	%rbp, %rdi
+	addl	%r12d, %eax
+	movl	%eax, 44(%rsp)
+	call	wavefrontMTLReload@PLT
+	movl	$0, 44(%rsp)
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	jne	.L122
+	movl	168(%rsp), %ecx
+	addl	152(%rsp), %ecx
+	addl	136(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L123
+	addl	$1, asserts_passed(%rip)
+.L124:
+	leaq	.LC10(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L125
+	addl	$1, asserts_passed(%rip)
+.L126:
+	leaq	.LC11(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L127
+	addl	$1, asserts_passed(%rip)
+.L128:
+	movq	416(%rsp), %rax
+	movq	608(%rax), %rcx
+	testq	%rcx, %rcx
+	je	.L129
+	movq	%rcx, %rdi
+	leaq	.LC12(%rip), %rsi
+	movq	%rcx, 24(%rsp)
+	call	strcmp@PLT
+	movq	24(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L130
+	addl	$1, asserts_passed(%rip)
+.L131:
+	movq	%r14, %rdi
+	call	wavefrontMTLChangesRelease@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	40(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L152
+.L145:
+	xorl	%r8d, %r8d
+	xorl	%eax, %eax
+	movl	$248, %edx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testl	%ebx, %ebx
+	jne	.L140
+	cmpl	$10, %r12d
+	jle	.L141
+.L153:
+	addl	$1, asserts_passed(%rip)
+.L142:
+	movq	16(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$536, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L133
+	addl	$1, asserts_passed(%rip)
+.L134:
+	movl	168(%rsp), %ecx
+	addl	152(%rsp), %ecx
+	addl	136(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L135
+	addl	$1, asserts_passed(%rip)
+.L136:
+	movq	16(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	sameLibrary
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L137
+	addl	$1, asserts_passed(%rip)
+.L138:
+	movq	%r14, %rdi
+	call	wavefrontMTLChangesRelease@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	40(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L145
+	addl	$1, asserts_passed(%rip)
+	jmp	.L140
+	.p2align 4,,10
+	.p2align 3
+.L123:
+	movl	$3, %r8d
+	movl	$237, %edx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movq	%r15, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L124
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	movl	$2, %r8d
+	movl	$239, %edx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movq	%r15, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L128
+	.p2align 4,,10
+	.p2align 3
+.L125:
+	movq	$-1, %r8
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	movl	$238, %edx
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L126
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	movl	$1, %r8d
+	movl	$244, %edx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movq	%r15, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L138
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	movl	$1, %r8d
+	movl	$242, %edx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movq	%r15, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L134
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L132:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC12(%rip), %r8
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movl	$240, %edx
+	leaq	.LC13(%rip), %rdi
+	call	printf@PLT
+	jmp	.L131
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	xorl	%r8d, %r8d
+	movl	$243, %edx
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L136
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC9(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L132
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	addl	$1, asserts_passed(%rip)
+	cmpl	$10, %r12d
+	jg	.L153
+.L141:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$251, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L142
+	.cfi_endproc
+.LFE34:
+	.size	testAllocatorUpdateFailure, .-testAllocatorUpdateFailure
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"newmtl first\nKd 0.5\nmap_Kd first.png\nnewmtl third\nmap_Ks third.png\n"
+	.align 8
+.LC20:
+	.string	"newmtl second\nmap_Kd other.png\nnewmtl fourth\nbump -bm 2 fourth.png\n"
+	.section	.rodata.str1.1
+.LC21:
+	.string	"second.2"
+.LC22:
+	.string	"fourth"
+	.text
+	.p2align 4
+	.globl	testAllocatorMergeFailure
+	.type	testAllocatorMergeFailure, @function
+testAllocatorMergeFailure:
+.LFB35:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$16, %edx
+	xorl	%esi, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	%edi, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC2(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$632, %rsp
+	.cfi_def_cfa_offset 688
+	leaq	48(%rsp), %rbx
+	movl	%edi, 36(%rsp)
+	leaq	96(%rsp), %r15
+	movq	%rbx, %rdi
+	leaq	288(%rsp), %rbp
+	call	memset@PLT
+	leaq	trackingAllocate(%rip), %rdx
+	movq	%rbx, 88(%rsp)
+	leaq	trackingReallocate(%rip), %rax
+	movq	%rax, %xmm1
+	movq	%rdx, %xmm0
+	leaq	trackingRelease(%rip), %rax
+	movq	$0, 160(%rsp)
+	punpcklqdq	%xmm1, %xmm0
+	movq	%rax, 80(%rsp)
+	leaq	64(%rsp), %rax
+	leaq	allocatorInput(%rip), %rsi
+	movaps	%xmm0, 64(%rsp)
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movq	%rax, 152(%rsp)
+	leaq	176(%rsp), %rax
+	movq	%rax, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movq	%rax, 24(%rsp)
+	movl	%r14d, 132(%rsp)
+	leaq	.LC1(%rip), %r14
+	call	parseWavefrontMTLFromString@PLT
+	leaq	400(%rsp), %rax
+	leaq	.LC19(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	leaq	512(%rsp), %rax
+	leaq	.LC20(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, 40(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	leaq	128(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	movq	16(%rsp), %rcx
+	movl	$85, %edx
+	movq	%rbp, %rdi
+	addl	$1, %r12d
+	leaq	allocatorInput(%rip), %rsi
+	movl	$0, 60(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movl	56(%rsp), %eax
+	movq	%r15, %rcx
+	movq	%rbp, %rdi
+	movq	8(%rsp), %rsi
+	movl	$2, %edx
+	addl	%r12d, %eax
+	movl	%eax, 60(%rsp)
+	call	wavefrontMTLMerge@PLT
+	movl	$0, 60(%rsp)
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	jne	.L155
+	movl	296(%rsp), %ecx
+	cmpq	$5, %rcx
+	jne	.L156
+	movq	96(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movslq	(%rax), %rcx
+	testq	%rcx, %rcx
+	jne	.L158
+.L187:
+	addl	$1, asserts_passed(%rip)
+.L159:
+	leaq	.LC21(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L160
+	addl	$1, asserts_passed(%rip)
+.L161:
+	leaq	.LC22(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$4, %eax
+	jne	.L162
+	addl	$1, asserts_passed(%rip)
+.L163:
+	movq	%r15, %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	56(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L185
+.L177:
+	xorl	%r8d, %r8d
+	xorl	%eax, %eax
+	movl	$289, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testl	%ebx, %ebx
+	jne	.L171
+.L170:
+	movl	36(%rsp), %eax
+	andl	$1, %eax
+	cmpl	$1, %eax
+	sbbl	%eax, %eax
+	andl	$4, %eax
+	addl	$4, %eax
+	cmpl	%r12d, %eax
+	jge	.L173
+	addl	$1, asserts_passed(%rip)
+.L174:
+	movq	40(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	8(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	24(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$632, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L164
+	addl	$1, asserts_passed(%rip)
+	cmpq	$0, 96(%rsp)
+	je	.L186
+.L166:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$284, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L167:
+	movq	24(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	sameLibrary
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L168
+	addl	$1, asserts_passed(%rip)
+.L169:
+	movq	%r15, %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	56(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L177
+	addl	$1, asserts_passed(%rip)
+	jmp	.L171
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movl	$5, %r8d
+	movl	$278, %edx
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	96(%rsp), %rax
+	movslq	(%rax), %rcx
+	testq	%rcx, %rcx
+	je	.L187
+.L158:
+	xorl	%r8d, %r8d
+	movl	$279, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L159
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	movl	$1, %r8d
+	movl	$285, %edx
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L169
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$283, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	cmpq	$0, 96(%rsp)
+	jne	.L166
+.L186:
+	cmpq	$0, 104(%rsp)
+	jne	.L166
+	addl	$1, asserts_passed(%rip)
+	jmp	.L167
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	movl	$4, %r8d
+	movl	$281, %edx
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L163
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	movl	$3, %r8d
+	movl	$280, %edx
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L161
+	.p2align 4,,10
+	.p2align 3
+.L185:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L170
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$292, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L174
+	.cfi_endproc
+.LFE35:
+	.size	testAllocatorMergeFailure, .-testAllocatorMergeFailure
+	.p2align 4
+	.globl	wavefrontAllocatorTest
+	.type	wavefrontAllocatorTest, @function
+wavefrontAllocatorTest:
+.LFB36:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testAllocatorRoutesParse
+	xorl	%eax, %eax
+	call	testAllocatorFailure
+	xorl	%eax, %eax
+	call	testAllocateZeroed
+	xorl	%eax, %eax
+	call	testAllocatorPerLibrary
+	xorl	%eax, %eax
+	call	testAllocatorPerLibraryParallel
+	xorl	%edi, %edi
+	call	testAllocatorUpdateFailure
+	movl	$1, %edi
+	call	testAllocatorUpdateFailure
+	xorl	%edi, %edi
+	call	testAllocatorMergeFailure
+	movl	$1, %edi
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testAllocatorMergeFailure
+	.cfi_endproc
+.LFE36:
+	.size	wavefrontAllocatorTest, .-wavefrontAllocatorTest
+	.section	.rodata
+	.align 32
+	.type	allocatorInput, @object
+	.size	allocatorInput, 86
+allocatorInput:
+	.string	"newmtl first\nKd 0.5\nmap_Kd first.png\nnewmtl second\nmap_Kd second.png\nbump second.png\n"
+	.local	heapLock
+	.comm	heapLock,40,32
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	1
+	.long	-1
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC4:
+	.quad	8295749760925001070
+	.quad	7020278820606272357
+	.align 16
+.LC5:
+	.quad	7018969010029682544
+	.quad	7453017777899923310
+	.align 16
+.LC6:
+	.quad	7814991612964899431
+	.quad	2925192324609056
+	.align 16
+.LC14:
+	.quad	7310222287397282314
+	.quad	7453017777900515171
+	.align 16
+.LC15:
+	.quad	2336370320201838090
+	.quad	7020278820672989300
+	.align 16
+.LC16:
+	.quad	7595448454282436464
+	.quad	7857206223927403634
+	.align 16
+.LC17:
+	.quad	8011094991770185825
+	.quad	7595447353728708640
+	.align 16
+.LC18:
+	.quad	7308895168204665632
+	.quad	2928473793262451
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,860 @@
+	.file	"wavefront_material_arrays_test.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"(null)"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"src/wavefront_material_arrays_test.c"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"%s:%d: %lld != %lld\n"
+.LC5:
+	.string	"%s:%d: %f != %f\n"
+.LC11:
+	.string	"b.png"
+.LC12:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+	.text
+	.p2align 4
+	.globl	testMaterialArrays
+	.type	testMaterialArrays, @function
+testMaterialArrays:
+.LFB12:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$768, %rsp
+	.cfi_def_cfa_offset 800
+	movdqa	.LC14(%rip), %xmm0
+	movq	%rsp, %rbx
+	leaq	112(%rsp), %rsi
+	leaq	288(%rsp), %rbp
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC15(%rip), %xmm0
+	movq	%rbx, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC16(%rip), %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC17(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC18(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC19(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC20(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC21(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC22(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC23(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC24(%rip), %xmm0
+	movups	%xmm0, 271(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMaterialArraysCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L2
+	addl	$1, asserts_passed(%rip)
+.L3:
+	movl	288(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L4
+	addl	$1, asserts_passed(%rip)
+.L5:
+	movq	296(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm3
+	cvtss2sd	4(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC3(%rip), %xmm1
+	comisd	%xmm1, %xmm3
+	jbe	.L6
+	movsd	.LC3(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm3
+	ja	.L106
+.L6:
+	movq	.LC3(%rip), %rax
+	movl	$35, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	296(%rsp), %rax
+.L9:
+	movsd	.LC6(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm4
+	cvtss2sd	12(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L10
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	ja	.L107
+.L10:
+	movl	$36, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L13:
+	movq	304(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm5
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC7(%rip), %xmm1
+	comisd	%xmm1, %xmm5
+	jbe	.L14
+	movsd	.LC7(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm5
+	ja	.L108
+.L14:
+	movq	.LC7(%rip), %rax
+	movl	$37, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+.L17:
+	movq	320(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm6
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC8(%rip), %xmm1
+	comisd	%xmm1, %xmm6
+	jbe	.L18
+	movsd	.LC8(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm6
+	ja	.L109
+.L18:
+	movq	.LC8(%rip), %rax
+	movl	$38, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+.L21:
+	movq	336(%rsp), %rax
+	movsd	.LC9(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm7
+	cvtss2sd	(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L22
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm7
+	ja	.L110
+.L22:
+	movl	$39, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L25:
+	movq	344(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm3
+	cvtss2sd	4(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC7(%rip), %xmm1
+	comisd	%xmm1, %xmm3
+	jbe	.L26
+	movsd	.LC7(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm3
+	ja	.L111
+.L26:
+	movq	.LC7(%rip), %rax
+	movl	$40, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+.L29:
+	movq	352(%rsp), %rax
+	movsd	.LC10(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm4
+	cvtss2sd	4(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L30
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	ja	.L112
+.L30:
+	movl	$41, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L33:
+	movq	368(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm5
+	cvtss2sd	4(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC8(%rip), %xmm1
+	comisd	%xmm1, %xmm5
+	jbe	.L34
+	movsd	.LC8(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm5
+	ja	.L113
+.L34:
+	movq	.LC8(%rip), %rax
+	movl	$42, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+.L37:
+	movq	328(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm6
+	cvtss2sd	20(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC3(%rip), %xmm1
+	comisd	%xmm1, %xmm6
+	jbe	.L38
+	movsd	.LC3(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm6
+	ja	.L114
+.L38:
+	movq	.LC3(%rip), %rax
+	movl	$43, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+.L41:
+	movq	416(%rsp), %rax
+	movslq	(%rax), %rcx
+	cmpq	$2, %rcx
+	jne	.L42
+	movslq	8(%rax), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L44
+.L125:
+	movq	432(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movl	(%rax), %ecx
+	cmpq	$1, %rcx
+	jne	.L46
+.L126:
+	movl	4(%rax), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L48
+.L127:
+	movl	8(%rax), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L50
+.L128:
+	addl	$1, asserts_passed(%rip)
+.L51:
+	movq	440(%rsp), %rax
+	movl	4(%rax), %ecx
+	cmpq	$2, %rcx
+	jne	.L52
+	addl	$1, asserts_passed(%rip)
+	movl	$2, %eax
+.L53:
+	leal	-1(%rax), %edx
+	movq	32(%rsp), %rax
+	movq	(%rax,%rdx,8), %r12
+	testq	%r12, %r12
+	je	.L54
+	leaq	.LC11(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L115
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L57:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$53, %edx
+	xorl	%eax, %eax
+	leaq	.LC11(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC12(%rip), %rdi
+	call	printf@PLT
+	movq	592(%rsp), %rax
+	movl	(%rax), %ecx
+	testq	%rcx, %rcx
+	jne	.L58
+.L116:
+	addl	$1, asserts_passed(%rip)
+.L59:
+	movq	600(%rsp), %rax
+	movl	4(%rax), %ecx
+	cmpq	$1, %rcx
+	jne	.L60
+	addl	$1, asserts_passed(%rip)
+	movl	$1, %eax
+.L61:
+	subl	$1, %eax
+	movsd	.LC13(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC4(%rip), %xmm7
+	salq	$6, %rax
+	addq	64(%rsp), %rax
+	cvtss2sd	36(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L62
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L62
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 296(%rsp)
+	jne	.L66
+.L117:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 320(%rsp)
+	jne	.L68
+.L118:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 336(%rsp)
+	jne	.L70
+.L119:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 344(%rsp)
+	jne	.L72
+.L120:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 408(%rsp)
+	jne	.L74
+.L121:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 416(%rsp)
+	jne	.L76
+.L122:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 576(%rsp)
+	jne	.L78
+.L123:
+	addl	$1, asserts_passed(%rip)
+	testb	$15, 736(%rsp)
+	jne	.L80
+.L124:
+	addl	$1, asserts_passed(%rip)
+.L81:
+	movq	%rbp, %rdi
+	call	wavefrontMaterialArraysRelease@PLT
+	movl	288(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L82
+	addl	$1, asserts_passed(%rip)
+.L83:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$768, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.cfi_restore_state
+	movq	592(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movl	(%rax), %ecx
+	testq	%rcx, %rcx
+	je	.L116
+.L58:
+	xorl	%r8d, %r8d
+	movl	$55, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L59
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L37
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L29
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L25
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L108:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L17
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L13
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	movl	$57, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 296(%rsp)
+	je	.L117
+.L66:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$59, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 320(%rsp)
+	je	.L118
+.L68:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$60, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 336(%rsp)
+	je	.L119
+.L70:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$61, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 344(%rsp)
+	je	.L120
+.L72:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$62, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 408(%rsp)
+	je	.L121
+.L74:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$63, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 416(%rsp)
+	je	.L122
+.L76:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$64, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 576(%rsp)
+	je	.L123
+.L78:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$65, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	testb	$15, 736(%rsp)
+	je	.L124
+.L80:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$66, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L81
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movl	$3, %r8d
+	movl	$34, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L5
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	movl	$2, %r8d
+	movl	$44, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	416(%rsp), %rax
+	movslq	8(%rax), %rcx
+	testq	%rcx, %rcx
+	je	.L125
+.L44:
+	xorl	%r8d, %r8d
+	movl	$45, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	432(%rsp), %rax
+	movl	(%rax), %ecx
+	cmpq	$1, %rcx
+	je	.L126
+.L46:
+	movl	$1, %r8d
+	movl	$49, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	432(%rsp), %rax
+	movl	4(%rax), %ecx
+	testq	%rcx, %rcx
+	je	.L127
+.L48:
+	xorl	%r8d, %r8d
+	movl	$50, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	432(%rsp), %rax
+	movl	8(%rax), %ecx
+	cmpq	$2, %rcx
+	je	.L128
+.L50:
+	movl	$2, %r8d
+	movl	$51, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	movl	$1, %r8d
+	movl	$56, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	600(%rsp), %rax
+	movl	4(%rax), %eax
+	jmp	.L61
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movl	$2, %r8d
+	movl	$52, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	440(%rsp), %rax
+	movl	4(%rax), %eax
+	jmp	.L53
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	xorl	%r8d, %r8d
+	movl	$68, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L83
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	xorl	%r8d, %r8d
+	movl	$33, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L3
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r12
+	addl	$1, %eax
+	jmp	.L57
+	.cfi_endproc
+.LFE12:
+	.size	testMaterialArrays, .-testMaterialArrays
+	.p2align 4
+	.globl	testMaterialArraysEmpty
+	.type	testMaterialArraysEmpty, @function
+testMaterialArraysEmpty:
+.LFB13:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$600, %rsp
+	.cfi_def_cfa_offset 624
+	movq	%rsp, %rbp
+	leaq	112(%rsp), %rbx
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialArraysCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L130
+	movl	112(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L132
+.L135:
+	addl	$1, asserts_passed(%rip)
+.L133:
+	movq	%rbx, %rdi
+	call	wavefrontMaterialArraysRelease@PLT
+	addq	$600, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$77, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	112(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L135
+.L132:
+	xorl	%r8d, %r8d
+	movl	$78, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L133
+	.cfi_endproc
+.LFE13:
+	.size	testMaterialArraysEmpty, .-testMaterialArraysEmpty
+	.p2align 4
+	.globl	wavefrontMaterialArraysTest
+	.type	wavefrontMaterialArraysTest, @function
+wavefrontMaterialArraysTest:
+.LFB14:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testMaterialArrays
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testMaterialArraysEmpty
+	.cfi_endproc
+.LFE14:
+	.size	wavefrontMaterialArraysTest, .-wavefrontMaterialArraysTest
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC3:
+	.long	-1717986918
+	.long	1070176665
+	.align 8
+.LC4:
+	.long	-350469331
+	.long	1058682594
+	.align 8
+.LC6:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC7:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC8:
+	.long	0
+	.long	1072168960
+	.align 8
+.LC9:
+	.long	0
+	.long	1076101120
+	.align 8
+.LC10:
+	.long	0
+	.long	1073217536
+	.align 8
+.LC13:
+	.long	0
+	.long	1073741824
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC14:
+	.quad	7359001038431937902
+	.quad	2333228590230106729
+	.align 16
+.LC15:
+	.quad	2319967542282628656
+	.quad	3539956086128979504
+	.align 16
+.LC16:
+	.quad	2336652890210896432
+	.quad	7226974963321604658
+	.align 16
+.LC17:
+	.quad	7929263817965330720
+	.quad	7310222270334334821
+	.align 16
+.LC18:
+	.quad	2334073014891474787
+	.quad	3467884224209825328
+	.align 16
+.LC19:
+	.quad	2320811967213023790
+	.quad	3467881708080541232
+	.align 16
+.LC20:
+	.quad	3328477236256453934
+	.quad	3976168436845775413
+	.align 16
+.LC21:
+	.quad	3543822872483662389
+	.quad	3687938059701989408
+	.align 16
+.LC22:
+	.quad	2336888129931275530
+	.quad	3342269273126822445
+	.align 16
+.LC23:
+	.quad	7887884795658071664
+	.quad	7237963448483605620
+	.align 16
+.LC24:
+	.quad	7226974963321604708
+	.quad	2928473793258016
+	.section	.note.GNU-stack,"",@progbits
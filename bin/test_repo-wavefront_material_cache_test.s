@@ -0,0 +1,1852 @@
+	.file	"wavefront_material_cache_test.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"(null)"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"src/wavefront_material_cache_test.c"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+.LC3:
+	.string	"%s:%d: %lld != %lld\n"
+	.text
+	.p2align 4
+	.type	assertMaterialsMatch, @function
+assertMaterialsMatch:
+.LFB22:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	(%rsi), %rbp
+	movq	(%rcx), %rbx
+	movq	%rdi, 8(%rsp)
+	testq	%rbp, %rbp
+	je	.L2
+	testq	%rbx, %rbx
+	je	.L2
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L3
+	addl	$1, asserts_passed(%rip)
+	jmp	.L4
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	addl	$1, asserts_failed(%rip)
+	testq	%rbx, %rbx
+	jne	.L18
+	leaq	.LC0(%rip), %rbx
+	testq	%rbp, %rbp
+	je	.L19
+.L6:
+	movq	%rbx, %r8
+	movq	%rbp, %rcx
+	movl	$31, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L4:
+	leaq	8(%r13), %rdi
+	leaq	8(%r14), %rsi
+	movl	$124, %edx
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L7
+	addl	$1, asserts_passed(%rip)
+.L8:
+	movq	%r13, 16(%rsp)
+	xorl	%ebp, %ebp
+	movq	%r14, 24(%rsp)
+	jmp	.L17
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	addl	$1, asserts_passed(%rip)
+.L10:
+	movq	(%rbx), %r13
+	xorl	%ecx, %ecx
+	testq	%r13, %r13
+	sete	%cl
+	xorl	%r8d, %r8d
+	cmpq	$0, (%r12)
+	sete	%r8b
+	cmpq	%r8, %rcx
+	jne	.L11
+	addl	$1, asserts_passed(%rip)
+.L12:
+	testq	%r13, %r13
+	je	.L13
+	movq	(%r12), %r14
+	testq	%r14, %r14
+	je	.L13
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L14
+	addl	$1, asserts_passed(%rip)
+.L13:
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	wavefrontMTLMapOptions@PLT
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rsi
+	movq	%rax, %r12
+	call	wavefrontMTLMapOptions@PLT
+	movl	$64, %edx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L15
+	addl	$1, %ebp
+	addl	$1, asserts_passed(%rip)
+	cmpl	$20, %ebp
+	je	.L35
+.L17:
+	movq	16(%rsp), %rdi
+	movl	%ebp, %esi
+	call	wavefrontMaterialMap@PLT
+	movq	24(%rsp), %rdi
+	movl	%ebp, %esi
+	movq	%rax, %rbx
+	call	wavefrontMaterialMap@PLT
+	movl	8(%rbx), %ecx
+	movl	8(%rax), %r8d
+	movq	%rax, %r12
+	cmpq	%r8, %rcx
+	je	.L36
+	movl	$37, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	addl	$1, asserts_failed(%rip)
+	jmp	.L6
+.L18:
+	leaq	.LC0(%rip), %rbp
+	jmp	.L6
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	movl	$38, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rbx), %r13
+	jmp	.L12
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	xorl	%r8d, %r8d
+	movl	$40, %edx
+	xorl	%eax, %eax
+	addl	$1, %ebp
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	cmpl	$20, %ebp
+	jne	.L17
+.L35:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+	movq	%r14, %r8
+	movq	%r13, %rcx
+	movl	$39, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L13
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	xorl	%r8d, %r8d
+	movl	$32, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L8
+.L19:
+	movq	%rbx, %rbp
+	jmp	.L6
+	.cfi_endproc
+.LFE22:
+	.size	assertMaterialsMatch, .-assertMaterialsMatch
+	.section	.rodata.str1.1
+.LC4:
+	.string	"bump.png"
+	.section	.rodata
+.LC6:
+	.string	"WMTL\004"
+	.string	""
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC7:
+	.string	"shared.png"
+.LC8:
+	.string	"second"
+.LC9:
+	.string	"third"
+.LC10:
+	.string	"top.png"
+	.text
+	.p2align 4
+	.globl	testCacheRoundTrip
+	.type	testCacheRoundTrip, @function
+testCacheRoundTrip:
+.LFB23:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	cacheInput(%rip), %rsi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$320, %rsp
+	.cfi_def_cfa_offset 352
+	leaq	96(%rsp), %r12
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L38
+	addl	$1, asserts_passed(%rip)
+.L39:
+	movq	96(%rsp), %rbx
+	movl	$8, %edx
+	leaq	.LC4(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rax, 688(%rbx)
+	leaq	32(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMapOptionsCompose@PLT
+	movq	96(%rsp), %rax
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	$0x40000000, 68(%rsp)
+	leaq	700(%rax), %rdx
+	call	wavefrontMTLInternMapOptions@PLT
+	leaq	24(%rsp), %rdx
+	leaq	16(%rsp), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L40
+	addl	$1, asserts_passed(%rip)
+.L41:
+	movq	16(%rsp), %rbx
+	movl	$8, %edx
+	leaq	.LC6(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L42
+	addl	$1, asserts_passed(%rip)
+.L43:
+	movq	24(%rsp), %rdx
+	leaq	208(%rsp), %rbp
+	xorl	%ecx, %ecx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L44
+	addl	$1, asserts_passed(%rip)
+.L45:
+	movl	300(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L46
+	addl	$1, asserts_passed(%rip)
+.L47:
+	movl	216(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L48
+	addl	$1, asserts_passed(%rip)
+.L49:
+	movl	248(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L50
+	addl	$1, asserts_passed(%rip)
+.L51:
+	movl	280(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L52
+	movq	240(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movq	(%rax), %rbx
+	testq	%rbx, %rbx
+	je	.L54
+.L83:
+	leaq	.LC7(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L80
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L59:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$69, %edx
+	xorl	%eax, %eax
+	leaq	.LC7(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L60:
+	movl	216(%rsp), %eax
+	xorl	%ebx, %ebx
+	testl	%eax, %eax
+	je	.L61
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movl	%ebx, %esi
+	movq	96(%rsp), %rcx
+	movq	%r12, %rdx
+	movq	%rbp, %rdi
+	imulq	$456, %rsi, %rsi
+	addl	$1, %ebx
+	addq	%rsi, %rcx
+	addq	208(%rsp), %rsi
+	call	assertMaterialsMatch
+	cmpl	216(%rsp), %ebx
+	jb	.L56
+.L61:
+	movq	208(%rsp), %rax
+	movq	%rbp, %rdi
+	leaq	752(%rax), %rsi
+	call	wavefrontMTLMapOptions@PLT
+	testb	$8, 60(%rax)
+	je	.L81
+	addl	$1, asserts_passed(%rip)
+.L62:
+	movq	208(%rsp), %rax
+	movq	608(%rax), %rdx
+	cmpq	%rdx, 152(%rax)
+	je	.L82
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$76, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L64:
+	leaq	.LC8(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L65
+	addl	$1, asserts_passed(%rip)
+.L66:
+	leaq	.LC9(%rip), %rbx
+	movq	%rbp, %rdi
+	movq	%rbx, %rsi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L67
+	addl	$1, asserts_passed(%rip)
+.L68:
+	leaq	12(%rsp), %rcx
+	movl	$7, %edx
+	movq	%rbp, %rdi
+	movl	$0, 12(%rsp)
+	leaq	.LC10(%rip), %rsi
+	call	wavefrontMTLInternTexture@PLT
+	movl	12(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L69
+	addl	$1, asserts_passed(%rip)
+.L70:
+	movl	$5, %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L71
+	addl	$1, asserts_passed(%rip)
+.L72:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L73
+	addl	$1, asserts_passed(%rip)
+.L74:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	16(%rsp), %rdi
+	call	wavefrontFree@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$320, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L60
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	movl	$2, %r8d
+	movl	$86, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L74
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	movl	$2, %r8d
+	movl	$83, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L70
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	movq	$-1, %r8
+	movl	$80, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L68
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	movl	$1, %r8d
+	movl	$79, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L66
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	movl	$8, %r8d
+	xorl	%ecx, %ecx
+	movl	$74, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L62
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movl	$2, %r8d
+	movl	$68, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	240(%rsp), %rax
+	movq	(%rax), %rbx
+	testq	%rbx, %rbx
+	jne	.L83
+.L54:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L59
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	movl	$2, %r8d
+	movl	$67, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L51
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	movl	$2, %r8d
+	movl	$66, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L49
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	movl	$1, %r8d
+	movl	$65, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L64
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	xorl	%r8d, %r8d
+	movl	$85, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	xorl	%r8d, %r8d
+	movl	$64, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L45
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	xorl	%r8d, %r8d
+	movl	$60, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	16(%rsp), %rbx
+	jmp	.L43
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	xorl	%r8d, %r8d
+	movl	$59, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	xorl	%r8d, %r8d
+	movl	$48, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L39
+	.cfi_endproc
+.LFE23:
+	.size	testCacheRoundTrip, .-testCacheRoundTrip
+	.section	.rodata.str1.1
+.LC11:
+	.string	"missing"
+	.text
+	.p2align 4
+	.globl	testCacheEmpty
+	.type	testCacheEmpty, @function
+testCacheEmpty:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$240, %rsp
+	.cfi_def_cfa_offset 256
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	leaq	8(%rsp), %rdx
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L85
+	addl	$1, asserts_passed(%rip)
+.L86:
+	movq	8(%rsp), %rdx
+	movq	(%rsp), %rsi
+	leaq	128(%rsp), %rbx
+	xorl	%ecx, %ecx
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L87
+	addl	$1, asserts_passed(%rip)
+.L88:
+	movl	136(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L89
+	addl	$1, asserts_passed(%rip)
+.L90:
+	leaq	.LC11(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L91
+	addl	$1, asserts_passed(%rip)
+.L92:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	(%rsp), %rdi
+	call	wavefrontFree@PLT
+	addq	$240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.cfi_restore_state
+	movq	$-1, %r8
+	movl	$103, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L92
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	xorl	%r8d, %r8d
+	movl	$102, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L90
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	xorl	%r8d, %r8d
+	movl	$101, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L88
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	xorl	%r8d, %r8d
+	movl	$99, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L86
+	.cfi_endproc
+.LFE24:
+	.size	testCacheEmpty, .-testCacheEmpty
+	.p2align 4
+	.globl	testCacheSize
+	.type	testCacheSize, @function
+testCacheSize:
+.LFB26:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	leaq	cacheInput(%rip), %rsi
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 144
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	leaq	8(%rsp), %rdx
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L95
+	addl	$1, asserts_passed(%rip)
+.L96:
+	movl	72(%rsp), %eax
+	movq	8(%rsp), %rcx
+	addl	40(%rsp), %eax
+	leal	440(,%rax,4), %r8d
+	cmpq	%r8, %rcx
+	jne	.L97
+	addl	$1, asserts_passed(%rip)
+.L98:
+	movq	(%rsp), %rdi
+	call	wavefrontFree@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	.cfi_restore_state
+	movl	$130, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L98
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	xorl	%r8d, %r8d
+	movl	$125, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L96
+	.cfi_endproc
+.LFE26:
+	.size	testCacheSize, .-testCacheSize
+	.section	.rodata.str1.1
+.LC12:
+	.string	"first"
+	.text
+	.p2align 4
+	.globl	testCacheRemovedMaterial
+	.type	testCacheRemovedMaterial, @function
+testCacheRemovedMaterial:
+.LFB27:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	cacheInput(%rip), %rsi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 288
+	leaq	32(%rsp), %rbx
+	leaq	144(%rsp), %rbp
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	xorl	%ecx, %ecx
+	leaq	17(%rsp), %rsi
+	movq	%rbx, %rdi
+	movabsq	$8295749760925001070, %rax
+	movl	$14, %edx
+	movq	%rax, 17(%rsp)
+	movabsq	$2925175245071731, %rax
+	movq	%rax, 24(%rsp)
+	call	wavefrontMTLReload@PLT
+	leaq	8(%rsp), %rdx
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movq	8(%rsp), %rdx
+	movq	(%rsp), %rsi
+	xorl	%ecx, %ecx
+	movq	%rbp, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L101
+	addl	$1, asserts_passed(%rip)
+.L102:
+	movl	152(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L103
+	movq	144(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	cmpq	$0, (%rax)
+	je	.L112
+.L105:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$146, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L106:
+	leaq	.LC12(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L107
+	addl	$1, asserts_passed(%rip)
+.L108:
+	leaq	.LC8(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L109
+	addl	$1, asserts_passed(%rip)
+.L110:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	(%rsp), %rdi
+	call	wavefrontFree@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	movl	$2, %r8d
+	movl	$145, %edx
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	call	printf@PLT
+	movq	144(%rsp), %rax
+	cmpq	$0, (%rax)
+	jne	.L105
+.L112:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L106
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	movl	$1, %r8d
+	movl	$148, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L110
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movq	$-1, %r8
+	movl	$147, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L108
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	xorl	%r8d, %r8d
+	movl	$144, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L102
+	.cfi_endproc
+.LFE27:
+	.size	testCacheRemovedMaterial, .-testCacheRemovedMaterial
+	.p2align 4
+	.globl	testCacheRejectsCorruption
+	.type	testCacheRejectsCorruption, @function
+testCacheRejectsCorruption:
+.LFB28:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	cacheInput(%rip), %rsi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$360, %rsp
+	.cfi_def_cfa_offset 416
+	leaq	16(%rsp), %r14
+	leaq	128(%rsp), %rbp
+	movq	%r14, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	leaq	8(%rsp), %rdx
+	movq	%rsp, %rsi
+	movq	%r14, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movq	8(%rsp), %r15
+	testq	%r15, %r15
+	je	.L114
+	xorl	%ebx, %ebx
+	leaq	128(%rsp), %rbp
+	leaq	.LC1(%rip), %r13
+	leaq	.LC3(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	movq	(%rsp), %rsi
+	xorl	%ecx, %ecx
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L115
+	movq	8(%rsp), %r15
+	addq	$1, %rbx
+	addl	$1, asserts_passed(%rip)
+	cmpq	%r15, %rbx
+	jb	.L117
+.L114:
+	movq	(%rsp), %rbx
+	movq	%r15, %rdi
+	call	malloc@PLT
+	movq	%r15, %rdx
+	movq	%rax, %r12
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$88, (%r12)
+	xorl	%ecx, %ecx
+	movq	%r15, %rdx
+	leaq	240(%rsp), %rbx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L118
+	addl	$1, asserts_passed(%rip)
+.L119:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$3, 4(%r12)
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L120
+	addl	$1, asserts_passed(%rip)
+.L121:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$3, 8(%r12)
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L122
+	addl	$1, asserts_passed(%rip)
+.L123:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$3, 96(%r12)
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L124
+	addl	$1, asserts_passed(%rip)
+.L125:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$127, 103(%r12)
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L126
+	addl	$1, asserts_passed(%rip)
+.L127:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movb	$3, 228(%r12)
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L128
+	addl	$1, asserts_passed(%rip)
+.L129:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movb	$9, 236(%r12)
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L130
+	addl	$1, asserts_passed(%rip)
+.L131:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movb	$2, 240(%r12)
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L132
+	addl	$1, asserts_passed(%rip)
+.L133:
+	movq	8(%rsp), %r13
+	movq	(%rsp), %r15
+	movq	%r13, %rdi
+	call	malloc@PLT
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %r12
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$120, -1(%r12,%r13)
+	xorl	%ecx, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%rbx, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	movslq	%r13d, %rcx
+	cmpl	$2, %r13d
+	jne	.L134
+	addl	$1, asserts_passed(%rip)
+.L135:
+	movl	40(%rsp), %eax
+	movq	8(%rsp), %r12
+	movq	%r14, %rdi
+	addl	72(%rsp), %eax
+	leal	0(,%rax,4), %eax
+	subq	%rax, %r12
+	call	wavefrontMTLRelease@PLT
+	movq	8(%rsp), %rdi
+	call	malloc@PLT
+	movq	8(%rsp), %rdx
+	movq	(%rsp), %rsi
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$1, (%rbx,%r12)
+	xorl	%ecx, %ecx
+	movq	%rbx, %rsi
+	movb	$1, 4(%rbx,%r12)
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rdi
+	movb	$1, 8(%rbx,%r12)
+	movb	$1, 12(%rbx,%r12)
+	movb	$1, 16(%rbx,%r12)
+	movb	$1, 20(%rbx,%r12)
+	movb	$1, 24(%rbx,%r12)
+	movb	$1, 28(%rbx,%r12)
+	movb	$1, 32(%rbx,%r12)
+	movb	$1, 36(%rbx,%r12)
+	movb	$1, 40(%rbx,%r12)
+	movb	$1, 44(%rbx,%r12)
+	movb	$1, 48(%rbx,%r12)
+	movb	$1, 52(%rbx,%r12)
+	movb	$1, 56(%rbx,%r12)
+	movb	$1, 60(%rbx,%r12)
+	call	wavefrontMTLDeserialize@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L136
+	addl	$1, asserts_passed(%rip)
+.L137:
+	movq	%rbx, %rdi
+	call	free@PLT
+	movq	(%rsp), %rdi
+	call	wavefrontFree@PLT
+	addq	$360, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.cfi_restore_state
+	movl	$2, %r8d
+	movl	$163, %edx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movq	%r12, %rdi
+	addl	$1, asserts_failed(%rip)
+	addq	$1, %rbx
+	call	printf@PLT
+	movq	8(%rsp), %r15
+	cmpq	%r15, %rbx
+	jb	.L117
+	jmp	.L114
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	movl	$2, %r8d
+	movl	$170, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L119
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	movl	$2, %r8d
+	movl	$185, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L137
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	movl	$2, %r8d
+	movl	$178, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L135
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	movl	$2, %r8d
+	movl	$177, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L133
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	movl	$2, %r8d
+	movl	$176, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L131
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	movl	$2, %r8d
+	movl	$175, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L129
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	movl	$2, %r8d
+	movl	$174, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L127
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	movl	$2, %r8d
+	movl	$173, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L125
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	movl	$2, %r8d
+	movl	$172, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L123
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	movl	$2, %r8d
+	movl	$171, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L121
+	.cfi_endproc
+.LFE28:
+	.size	testCacheRejectsCorruption, .-testCacheRejectsCorruption
+	.p2align 4
+	.globl	testCacheRejectsBadMaterialTable
+	.type	testCacheRejectsBadMaterialTable, @function
+testCacheRejectsBadMaterialTable:
+.LFB30:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	cacheInput(%rip), %rsi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	leaq	32(%rsp), %r12
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	xorl	%ecx, %ecx
+	leaq	17(%rsp), %rsi
+	movq	%r12, %rdi
+	movabsq	$8295749760925001070, %rax
+	movl	$14, %edx
+	movq	%rax, 17(%rsp)
+	movabsq	$2925175245071731, %rax
+	movq	%rax, 24(%rsp)
+	call	wavefrontMTLReload@PLT
+	leaq	8(%rsp), %rdx
+	movq	%rsp, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLSerialize@PLT
+	movq	(%rsp), %rbp
+	movq	8(%rsp), %r15
+	movl	56(%rsp), %ecx
+	movl	32(%rbp), %eax
+	movq	%r15, %rdx
+	subq	%rax, %rdx
+	movl	88(%rsp), %eax
+	addl	%ecx, %eax
+	leal	0(,%rax,4), %eax
+	subq	%rax, %rdx
+	testl	%ecx, %ecx
+	je	.L143
+	xorl	%eax, %eax
+	jmp	.L145
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	addl	$1, %eax
+	cmpl	%eax, %ecx
+	je	.L143
+.L145:
+	leal	0(,%rax,4), %ebx
+	addq	%rdx, %rbx
+	cmpb	$2, 0(%rbp,%rbx)
+	jne	.L158
+	testq	%rbx, %rbx
+	je	.L143
+	addl	$1, asserts_passed(%rip)
+.L147:
+	movq	%r15, %rdi
+	leaq	144(%rsp), %r13
+	call	malloc@PLT
+	movq	%rbp, %rsi
+	movq	%r15, %rdx
+	movq	%rax, %r14
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$1, (%r14,%rbx)
+	xorl	%ecx, %ecx
+	movq	%r15, %rdx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%r13, %rdi
+	movl	%eax, %ebp
+	call	wavefrontMTLRelease@PLT
+	movq	%r14, %rdi
+	call	free@PLT
+	movslq	%ebp, %rcx
+	cmpl	$2, %ebp
+	jne	.L148
+	addl	$1, asserts_passed(%rip)
+.L149:
+	movq	8(%rsp), %r14
+	movq	(%rsp), %r15
+	movq	%r14, %rdi
+	call	malloc@PLT
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rbp
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$0, 0(%rbp,%rbx)
+	xorl	%ecx, %ecx
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%r13, %rdi
+	movl	%eax, %r14d
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	free@PLT
+	movslq	%r14d, %rcx
+	cmpl	$2, %r14d
+	jne	.L150
+	addl	$1, asserts_passed(%rip)
+.L151:
+	movq	8(%rsp), %r14
+	movq	(%rsp), %r15
+	movq	%r14, %rdi
+	call	malloc@PLT
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	%rax, %rbp
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	movb	$2, 0(%rbp,%rbx)
+	xorl	%ecx, %ecx
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	wavefrontMTLDeserialize@PLT
+	movq	%r13, %rdi
+	movl	%eax, %ebx
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	free@PLT
+	movslq	%ebx, %rcx
+	testq	%rcx, %rcx
+	jne	.L152
+	addl	$1, asserts_passed(%rip)
+.L153:
+	movq	(%rsp), %rdi
+	call	wavefrontFree@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.cfi_restore_state
+	movl	$2, %r8d
+	movl	$214, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L149
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	movl	$2, %r8d
+	movl	$216, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L151
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$213, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	xorl	%ebx, %ebx
+	call	printf@PLT
+	movq	8(%rsp), %r15
+	movq	(%rsp), %rbp
+	jmp	.L147
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	xorl	%r8d, %r8d
+	movl	$217, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L153
+	.cfi_endproc
+.LFE30:
+	.size	testCacheRejectsBadMaterialTable, .-testCacheRejectsBadMaterialTable
+	.section	.rodata.str1.1
+.LC13:
+	.string	"bin/test_cache.wmtl"
+.LC14:
+	.string	"bin/does_not_exist.wmtl"
+	.text
+	.p2align 4
+	.globl	testCacheFile
+	.type	testCacheFile, @function
+testCacheFile:
+.LFB31:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	cacheInput(%rip), %rsi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	.LC13(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$224, %rsp
+	.cfi_def_cfa_offset 256
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLSaveCache@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L160
+	addl	$1, asserts_passed(%rip)
+.L161:
+	leaq	112(%rsp), %r12
+	xorl	%edx, %edx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLLoadCache@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L162
+	addl	$1, asserts_passed(%rip)
+.L163:
+	movl	120(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L164
+	addl	$1, asserts_passed(%rip)
+.L165:
+	movq	(%rsp), %rax
+	movq	%rbx, %rdx
+	movq	%r12, %rdi
+	leaq	456(%rax), %rcx
+	movq	112(%rsp), %rax
+	leaq	456(%rax), %rsi
+	call	assertMaterialsMatch
+.L166:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	remove@PLT
+	xorl	%edx, %edx
+	leaq	.LC14(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLLoadCache@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L167
+	movl	120(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L169
+.L172:
+	addl	$1, asserts_passed(%rip)
+	addq	$224, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	movl	$2, %r8d
+	movl	$230, %edx
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	call	printf@PLT
+	cmpl	$2, 120(%rsp)
+	jne	.L166
+	jmp	.L165
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movl	$2, %r8d
+	movl	$237, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	120(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L172
+.L169:
+	xorl	%r8d, %r8d
+	movl	$238, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$224, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$229, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L163
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	xorl	%r8d, %r8d
+	movl	$227, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L161
+	.cfi_endproc
+.LFE31:
+	.size	testCacheFile, .-testCacheFile
+	.p2align 4
+	.globl	wavefrontMaterialCacheTest
+	.type	wavefrontMaterialCacheTest, @function
+wavefrontMaterialCacheTest:
+.LFB32:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testCacheRoundTrip
+	xorl	%eax, %eax
+	call	testCacheEmpty
+	xorl	%eax, %eax
+	call	testCacheSize
+	xorl	%eax, %eax
+	call	testCacheRemovedMaterial
+	xorl	%eax, %eax
+	call	testCacheRejectsCorruption
+	xorl	%eax, %eax
+	call	testCacheRejectsBadMaterialTable
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testCacheFile
+	.cfi_endproc
+.LFE32:
+	.size	wavefrontMaterialCacheTest, .-wavefrontMaterialCacheTest
+	.section	.rodata
+	.align 32
+	.type	cacheInput, @object
+	.size	cacheInput, 186
+cacheInput:
+	.string	"newmtl first\nKa 0.1 0.2 0.3\nKd 0.4 0.5 0.6\nNs 96.078431\nillum 2\nmap_Kd shared.png\nnewmtl second\nd 0.25\nNi 1.45\nPr 0.5\nKe 1 0.5 0\nmap_Kd shared.png\nrefl -type cube_top -clamp on top.png\n"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1532 @@
+	.file	"wavefront_material_compact_test.c"
+	.text
+	.p2align 4
+	.type	materialValues, @function
+materialValues:
+.LFB15:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 96
+	movq	%rsi, %rdi
+	leaq	8(%rax), %rdx
+	addq	$160, %rdi
+	movq	%rdx, (%rsi)
+	leaq	12(%rax), %rdx
+	movq	%rdx, 8(%rsi)
+	leaq	16(%rax), %rdx
+	movq	%rdx, 16(%rsi)
+	leaq	20(%rax), %rdx
+	movq	%rdx, 24(%rsi)
+	leaq	24(%rax), %rdx
+	movq	%rdx, 32(%rsi)
+	leaq	28(%rax), %rdx
+	movq	%rdx, 40(%rsi)
+	leaq	32(%rax), %rdx
+	movq	%rdx, 48(%rsi)
+	leaq	36(%rax), %rdx
+	movq	%rdx, 56(%rsi)
+	leaq	40(%rax), %rdx
+	movq	%rdx, 64(%rsi)
+	leaq	44(%rax), %rdx
+	movq	%rdx, 72(%rsi)
+	leaq	48(%rax), %rdx
+	movq	%rdx, 80(%rsi)
+	leaq	52(%rax), %rdx
+	movq	%rdx, 88(%rsi)
+	leaq	56(%rax), %rdx
+	movq	%rdx, 96(%rsi)
+	leaq	60(%rax), %rdx
+	movq	%rdx, 104(%rsi)
+	leaq	64(%rax), %rdx
+	movq	%rdx, 112(%rsi)
+	leaq	68(%rax), %rdx
+	movq	%rdx, 120(%rsi)
+	leaq	72(%rax), %rdx
+	movq	%rdx, 128(%rsi)
+	leaq	76(%rax), %rdx
+	movq	%rdx, 136(%rsi)
+	leaq	80(%rax), %rdx
+	movq	%rdx, 144(%rsi)
+	leaq	84(%rax), %rdx
+	movq	%rdx, 152(%rsi)
+	leaq	88(%rax), %rdx
+	movq	%rsp, %rsi
+	movq	%rdx, (%rsp)
+	leaq	92(%rax), %rdx
+	movq	%rdx, 8(%rsp)
+	leaq	96(%rax), %rdx
+	movq	%rdx, 16(%rsp)
+	leaq	100(%rax), %rdx
+	movq	%rdx, 24(%rsp)
+	leaq	104(%rax), %rdx
+	movq	%rdx, 32(%rsp)
+	leaq	108(%rax), %rdx
+	movq	%rdx, 40(%rsp)
+	leaq	112(%rax), %rdx
+	movq	%rdx, 48(%rsp)
+	leaq	116(%rax), %rdx
+	movq	%rdx, 56(%rsp)
+	leaq	120(%rax), %rdx
+	addq	$124, %rax
+	movq	%rdx, 64(%rsp)
+	movl	$80, %edx
+	movq	%rax, 72(%rsp)
+	call	memcpy@PLT
+	addq	$88, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	materialValues, .-materialValues
+	.p2align 4
+	.globl	testCompactLayout
+	.type	testCompactLayout, @function
+testCompactLayout:
+.LFB11:
+	.cfi_startproc
+	addl	$2, asserts_passed(%rip)
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	testCompactLayout, .-testCompactLayout
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"(null)"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"src/wavefront_material_compact_test.c"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"%s:%d: %lld != %lld\n"
+.LC3:
+	.string	"first"
+.LC4:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+.LC7:
+	.string	"%s:%d: %f != %f\n"
+.LC11:
+	.string	"bump.png"
+.LC14:
+	.string	"top.png"
+	.text
+	.p2align 4
+	.globl	testCompactRoundTrip
+	.type	testCompactRoundTrip, @function
+testCompactRoundTrip:
+.LFB13:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	leaq	compactInput(%rip), %rsi
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$784, %rsp
+	.cfi_def_cfa_offset 832
+	leaq	96(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L6
+	addl	$1, asserts_passed(%rip)
+.L7:
+	movq	%rsp, %r12
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	wavefrontCompactMTLCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L8
+	addl	$1, asserts_passed(%rip)
+.L9:
+	movl	8(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L10
+	addl	$1, asserts_passed(%rip)
+.L11:
+	movl	24(%rsp), %ecx
+	cmpq	$5, %rcx
+	jne	.L12
+	addl	$1, asserts_passed(%rip)
+.L13:
+	movl	40(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L14
+	addl	$1, asserts_passed(%rip)
+.L15:
+	movl	56(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L16
+	addl	$1, asserts_passed(%rip)
+.L17:
+	movq	(%rsp), %rax
+	movl	8(%rax), %ecx
+	cmpq	$66, %rcx
+	jne	.L18
+	addl	$1, asserts_passed(%rip)
+.L19:
+	leaq	208(%rsp), %r13
+	leaq	320(%rsp), %rbp
+	movq	%r13, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	48(%rsp), %rax
+	movq	%rbp, %rdx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	addq	$64, %rax
+	movq	%rax, 272(%rsp)
+	movl	56(%rsp), %eax
+	subl	$1, %eax
+	movl	%eax, 280(%rsp)
+	call	wavefrontCompactMaterialExpand@PLT
+	movq	320(%rsp), %r14
+	testq	%r14, %r14
+	je	.L20
+	leaq	.LC3(%rip), %rsi
+	movq	%r14, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L89
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L23:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %rcx
+	movl	$57, %edx
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	printf@PLT
+.L22:
+	movsd	.LC5(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm3
+	cvtss2sd	332(%rsp), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L24
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L24
+	addl	$1, asserts_passed(%rip)
+.L27:
+	movsd	.LC8(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm4
+	cvtss2sd	340(%rsp), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L28
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L28
+	addl	$1, asserts_passed(%rip)
+.L31:
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm5
+	cvtss2sd	344(%rsp), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm5
+	jbe	.L32
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm5
+	jbe	.L32
+	addl	$1, asserts_passed(%rip)
+.L35:
+	movsd	.LC6(%rip), %xmm6
+	pxor	%xmm0, %xmm0
+	cvtss2sd	372(%rsp), %xmm0
+	comisd	%xmm0, %xmm6
+	jbe	.L36
+	pxor	%xmm1, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm6
+	jbe	.L36
+	addl	$1, asserts_passed(%rip)
+.L39:
+	movsd	.LC10(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm7
+	cvtss2sd	408(%rsp), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L40
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L40
+	movq	552(%rsp), %r14
+	addl	$1, asserts_passed(%rip)
+	testq	%r14, %r14
+	je	.L44
+.L90:
+	leaq	.LC11(%rip), %rsi
+	movq	%r14, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L45
+	addl	$1, asserts_passed(%rip)
+.L46:
+	movl	560(%rsp), %eax
+	leal	-1(%rax), %edx
+	movq	32(%rsp), %rax
+	movq	(%rax,%rdx,8), %r14
+	testq	%r14, %r14
+	je	.L48
+	leaq	.LC11(%rip), %rsi
+	movq	%r14, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L49
+	addl	$1, asserts_passed(%rip)
+.L50:
+	movl	564(%rsp), %eax
+	movsd	.LC12(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm3
+	salq	$6, %rax
+	addq	48(%rsp), %rax
+	cvtss2sd	36(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L52
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L52
+	addl	$1, asserts_passed(%rip)
+.L55:
+	movq	96(%rsp), %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movl	$0x42c02000, 88(%rcx)
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L56
+	addl	$1, asserts_passed(%rip)
+.L57:
+	movq	%rbp, %rdx
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	wavefrontCompactMaterialExpand@PLT
+	movslq	448(%rsp), %rcx
+	cmpq	$127, %rcx
+	jne	.L58
+	movq	616(%rsp), %r14
+	addl	$1, asserts_passed(%rip)
+	testq	%r14, %r14
+	je	.L60
+.L91:
+	leaq	.LC14(%rip), %rsi
+	movq	%r14, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L61
+	addl	$1, asserts_passed(%rip)
+.L62:
+	movl	628(%rsp), %eax
+	movsd	.LC15(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC6(%rip), %xmm4
+	salq	$6, %rax
+	addq	48(%rsp), %rax
+	cvtss2sd	(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L64
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L64
+	addl	$1, asserts_passed(%rip)
+.L67:
+	movq	96(%rsp), %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movl	$127, 584(%rcx)
+	addq	$456, %rcx
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L68
+	addl	$1, asserts_passed(%rip)
+.L69:
+	movq	%rbp, %rdx
+	movl	$2, %esi
+	movq	%r12, %rdi
+	call	wavefrontCompactMaterialExpand@PLT
+	movq	96(%rsp), %rax
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	leaq	912(%rax), %rcx
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L70
+	addl	$1, asserts_passed(%rip)
+.L71:
+	movq	%r12, %rdi
+	call	wavefrontCompactMTLRelease@PLT
+	movl	8(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L72
+	addl	$1, asserts_passed(%rip)
+.L73:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$784, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	movl	$73, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L67
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movl	$66, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L55
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	movl	$63, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	552(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L90
+.L44:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r14
+	addl	$1, %eax
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	pxor	%xmm1, %xmm1
+	movl	$61, %edx
+	leaq	.LC1(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC7(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L39
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	movl	$60, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movl	$59, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC8(%rip), %rax
+	movq	%rax, %xmm1
+	jmp	.L31
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	movl	$58, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L27
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	movl	$1, %r8d
+	movl	$75, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	movl	$127, %r8d
+	movl	$71, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	616(%rsp), %r14
+	testq	%r14, %r14
+	jne	.L91
+.L60:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r14
+	addl	$1, %eax
+	jmp	.L63
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movl	$1, %r8d
+	movl	$68, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L57
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	movl	$1, %r8d
+	movl	$77, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L71
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	movl	$66, %r8d
+	movl	$51, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L19
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	movl	$3, %r8d
+	movl	$50, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L17
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	movl	$3, %r8d
+	movl	$48, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	movl	$5, %r8d
+	movl	$47, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L13
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	movl	$3, %r8d
+	movl	$46, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L47:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %rcx
+	movl	$64, %edx
+	xorl	%eax, %eax
+	leaq	.LC11(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	printf@PLT
+	jmp	.L46
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L51:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %rcx
+	movl	$65, %edx
+	xorl	%eax, %eax
+	leaq	.LC11(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	printf@PLT
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L63:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %rcx
+	movl	$72, %edx
+	xorl	%eax, %eax
+	leaq	.LC14(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	printf@PLT
+	jmp	.L62
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	xorl	%r8d, %r8d
+	movl	$80, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L73
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	xorl	%r8d, %r8d
+	movl	$45, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	xorl	%r8d, %r8d
+	movl	$42, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L7
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r14
+	addl	$1, %eax
+	jmp	.L23
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r14
+	addl	$1, %eax
+	jmp	.L51
+	.cfi_endproc
+.LFE13:
+	.size	testCompactRoundTrip, .-testCompactRoundTrip
+	.section	.rodata.str1.8
+	.align 8
+.LC16:
+	.string	"newmtl first\nnewmtl third\nmap_Ke -bm 2 -clamp on bump.png\nnewmtl fourth\nKd 0.5\n"
+	.section	.rodata.str1.1
+.LC17:
+	.string	"fourth"
+.LC18:
+	.string	"third"
+	.text
+	.p2align 4
+	.globl	testCompactExpandLibrary
+	.type	testCompactExpandLibrary, @function
+testCompactExpandLibrary:
+.LFB14:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	compactInput(%rip), %rsi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$456, %rsp
+	.cfi_def_cfa_offset 512
+	leaq	112(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L93
+	addl	$1, asserts_passed(%rip)
+.L94:
+	leaq	224(%rsp), %rax
+	leaq	.LC16(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L95
+	addl	$1, asserts_passed(%rip)
+.L96:
+	movq	8(%rsp), %rsi
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	call	wavefrontMTLUpdate@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L97
+	addl	$1, asserts_passed(%rip)
+.L98:
+	movq	112(%rsp), %rax
+	cmpq	$0, 456(%rax)
+	je	.L136
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$94, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L100:
+	leaq	16(%rsp), %r15
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	call	wavefrontCompactMTLCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L101
+	addl	$1, asserts_passed(%rip)
+.L102:
+	movq	16(%rsp), %rax
+	movl	$4294967295, %r8d
+	movl	64(%rax), %ecx
+	cmpq	%r8, %rcx
+	jne	.L103
+	addl	$1, asserts_passed(%rip)
+.L104:
+	leaq	336(%rsp), %rbp
+	xorl	%edx, %edx
+	movq	%r15, %rdi
+	movq	%rbp, %rsi
+	call	wavefrontCompactMTLExpand@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L105
+	addl	$1, asserts_passed(%rip)
+.L106:
+	movl	428(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L107
+	addl	$1, asserts_passed(%rip)
+.L108:
+	movl	344(%rsp), %ecx
+	cmpq	$4, %rcx
+	jne	.L109
+	addl	$1, asserts_passed(%rip)
+.L110:
+	movq	336(%rsp), %rax
+	cmpq	$0, 456(%rax)
+	je	.L137
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$104, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L112:
+	leaq	.LC17(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L113
+	addl	$1, asserts_passed(%rip)
+.L117:
+	movl	120(%rsp), %eax
+	xorl	%r14d, %r14d
+	leaq	.LC1(%rip), %r13
+	leaq	.LC2(%rip), %r12
+	testl	%eax, %eax
+	je	.L120
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	movl	%r14d, %esi
+	movq	112(%rsp), %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	imulq	$456, %rsi, %rsi
+	addq	%rsi, %rcx
+	addq	336(%rsp), %rsi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L118
+	addl	$1, asserts_passed(%rip)
+	addl	$1, %r14d
+	cmpl	120(%rsp), %r14d
+	jb	.L114
+.L120:
+	movq	336(%rsp), %rax
+	movq	80(%rsp), %rdx
+	cmpq	%rdx, 912(%rax)
+	je	.L138
+	addl	$1, asserts_passed(%rip)
+.L121:
+	movq	%r15, %rdi
+	call	wavefrontCompactMTLRelease@PLT
+	movq	336(%rsp), %r12
+	movq	912(%r12), %r13
+	testq	%r13, %r13
+	je	.L122
+	leaq	.LC18(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L139
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L125:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r13, %rcx
+	movl	$112, %edx
+	xorl	%eax, %eax
+	leaq	.LC18(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	printf@PLT
+	movq	336(%rsp), %r12
+	movq	1352(%r12), %r13
+	testq	%r13, %r13
+	je	.L126
+.L140:
+	leaq	.LC11(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L127
+	addl	$1, asserts_passed(%rip)
+.L128:
+	movl	1360(%r12), %ecx
+	cmpq	$1, %rcx
+	jne	.L130
+	addl	$1, asserts_passed(%rip)
+.L131:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	8(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$456, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$107, %edx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	movq	%r12, %rdi
+	addl	$1, asserts_failed(%rip)
+	addl	$1, %r14d
+	call	printf@PLT
+	cmpl	120(%rsp), %r14d
+	jb	.L114
+	jmp	.L120
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movq	1352(%r12), %r13
+	addl	$1, asserts_passed(%rip)
+	testq	%r13, %r13
+	jne	.L140
+.L126:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r13
+	addl	$1, %eax
+	jmp	.L129
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	movl	$1, %r8d
+	movl	$114, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L131
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	movl	$3, %r8d
+	movl	$105, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L117
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	movl	$4, %r8d
+	movl	$103, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L110
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movl	$1, %r8d
+	movl	$102, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L108
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	movl	$99, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L104
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L112
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L100
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L129:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r13, %rcx
+	movl	$113, %edx
+	xorl	%eax, %eax
+	leaq	.LC11(%rip), %r8
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	call	printf@PLT
+	movq	336(%rsp), %r12
+	jmp	.L128
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	xorl	%r8d, %r8d
+	movl	$93, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L98
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	xorl	%r8d, %r8d
+	movl	$98, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L102
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	xorl	%r8d, %r8d
+	movl	$101, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L106
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	xorl	%r8d, %r8d
+	movl	$91, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L96
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	xorl	%r8d, %r8d
+	movl	$87, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L94
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r13
+	addl	$1, %eax
+	jmp	.L125
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$110, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L121
+	.cfi_endproc
+.LFE14:
+	.size	testCompactExpandLibrary, .-testCompactExpandLibrary
+	.section	.rodata.str1.1
+.LC20:
+	.string	"material%d"
+	.text
+	.p2align 4
+	.globl	testCompactPrecision
+	.type	testCompactPrecision, @function
+testCompactPrecision:
+.LFB16:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	$17, %ebx
+	subq	$1208, %rsp
+	.cfi_def_cfa_offset 1264
+	leaq	144(%rsp), %r13
+	leaq	16(%rsp), %rbp
+	movq	%r13, %rdi
+	leaq	736(%rsp), %r15
+	call	wavefrontMTLCompose@PLT
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	movl	%r14d, %ecx
+	leaq	.LC20(%rip), %rdx
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	movl	$32, %esi
+	call	snprintf@PLT
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r13, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	144(%rsp), %rdi
+	movq	%r15, %rsi
+	addq	%r12, %rdi
+	call	materialValues
+	movss	.LC21(%rip), %xmm3
+	movss	.LC23(%rip), %xmm2
+	xorl	%eax, %eax
+	movss	.LC22(%rip), %xmm1
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	imull	$1103515245, %ebx, %ebx
+	movl	%eax, %edx
+	addl	$12345, %ebx
+	cmpq	$19, %rax
+	ja	.L142
+	movl	%eax, %esi
+	andl	$3, %esi
+	cmpl	$3, %esi
+	je	.L170
+.L142:
+	movl	%ebx, %esi
+	pxor	%xmm0, %xmm0
+	shrl	$8, %esi
+	andl	$1, %edx
+	cvtsi2ssl	%esi, %xmm0
+	mulss	%xmm1, %xmm0
+	jne	.L144
+	mulss	%xmm2, %xmm0
+.L144:
+	movq	(%r15,%rax,8), %rdx
+	addq	$1, %rax
+	movss	%xmm0, (%rdx)
+	cmpq	$30, %rax
+	jne	.L146
+	addl	$1, %r14d
+	addq	$456, %r12
+	cmpl	$1000, %r14d
+	jne	.L147
+	leaq	48(%rsp), %rax
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	wavefrontCompactMTLCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L148
+	addl	$1, asserts_passed(%rip)
+.L151:
+	movl	152(%rsp), %eax
+	testl	%eax, %eax
+	je	.L157
+	xorl	%ebp, %ebp
+	xorl	%ebx, %ebx
+	leaq	256(%rsp), %r14
+	leaq	496(%rsp), %r12
+.L149:
+	movq	8(%rsp), %rdi
+	movq	%r15, %rdx
+	movl	%ebp, %esi
+	call	wavefrontCompactMaterialExpand@PLT
+	movl	%ebp, %edi
+	movq	%r14, %rsi
+	imulq	$456, %rdi, %rdi
+	addq	144(%rsp), %rdi
+	call	materialValues
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	materialValues
+	movss	.LC27(%rip), %xmm3
+	xorl	%eax, %eax
+	pxor	%xmm2, %xmm2
+	movss	.LC19(%rip), %xmm4
+	movss	.LC25(%rip), %xmm5
+	jmp	.L156
+	.p2align 4,,10
+	.p2align 3
+.L172:
+	mulss	%xmm3, %xmm1
+.L154:
+	xorl	%edx, %edx
+	comiss	%xmm1, %xmm0
+	seta	%dl
+	addq	$8, %rax
+	addl	%edx, %ebx
+	cmpq	$240, %rax
+	je	.L171
+.L156:
+	movq	(%r14,%rax), %rdx
+	movss	(%rdx), %xmm1
+	movq	(%r12,%rax), %rdx
+	movss	(%rdx), %xmm0
+	subss	%xmm1, %xmm0
+	comiss	%xmm0, %xmm2
+	jbe	.L152
+	xorps	%xmm5, %xmm0
+.L152:
+	comiss	.LC26(%rip), %xmm1
+	ja	.L172
+	movaps	%xmm4, %xmm1
+	jmp	.L154
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	movq	(%r15,%rax,8), %rdx
+	addq	$1, %rax
+	movss	%xmm3, (%rdx)
+	jmp	.L146
+.L171:
+	addl	$1, %ebp
+	cmpl	152(%rsp), %ebp
+	jb	.L149
+	testl	%ebx, %ebx
+	jne	.L173
+.L157:
+	addl	$1, asserts_passed(%rip)
+.L150:
+	movq	8(%rsp), %rdi
+	call	wavefrontCompactMTLRelease@PLT
+	movq	%r13, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$1208, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L148:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$156, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L151
+.L173:
+	movslq	%ebx, %rcx
+	xorl	%r8d, %r8d
+	movl	$172, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L150
+	.cfi_endproc
+.LFE16:
+	.size	testCompactPrecision, .-testCompactPrecision
+	.p2align 4
+	.globl	testCompactEmpty
+	.type	testCompactEmpty, @function
+testCompactEmpty:
+.LFB17:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$328, %rsp
+	.cfi_def_cfa_offset 352
+	leaq	96(%rsp), %rbp
+	movq	%rsp, %rbx
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontCompactMTLCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L175
+	addl	$1, asserts_passed(%rip)
+.L176:
+	movl	8(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L177
+	addl	$1, asserts_passed(%rip)
+.L178:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L179
+	addl	$1, asserts_passed(%rip)
+.L180:
+	leaq	208(%rsp), %rbp
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	movq	%rbp, %rsi
+	call	wavefrontCompactMTLExpand@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L181
+	addl	$1, asserts_passed(%rip)
+.L182:
+	movl	216(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L183
+	addl	$1, asserts_passed(%rip)
+.L184:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontCompactMTLRelease@PLT
+	addq	$328, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$184, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L180
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	xorl	%r8d, %r8d
+	movl	$183, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	xorl	%r8d, %r8d
+	movl	$182, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	xorl	%r8d, %r8d
+	movl	$187, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L184
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	xorl	%r8d, %r8d
+	movl	$186, %edx
+	leaq	.LC1(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L182
+	.cfi_endproc
+.LFE17:
+	.size	testCompactEmpty, .-testCompactEmpty
+	.p2align 4
+	.globl	wavefrontMaterialCompactTest
+	.type	wavefrontMaterialCompactTest, @function
+wavefrontMaterialCompactTest:
+.LFB18:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	addl	$2, asserts_passed(%rip)
+	call	testCompactRoundTrip
+	xorl	%eax, %eax
+	call	testCompactExpandLibrary
+	xorl	%eax, %eax
+	call	testCompactPrecision
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testCompactEmpty
+	.cfi_endproc
+.LFE18:
+	.size	wavefrontMaterialCompactTest, .-wavefrontMaterialCompactTest
+	.section	.rodata
+	.align 32
+	.type	compactInput, @object
+	.size	compactInput, 270
+compactInput:
+	.ascii	"newmtl first\n"
+	.string	"Ka 0.125 0.25 0.5\nKd 1 0.75 0.5\nNs 96.078431\nd 0.5\nillum 2\nmap_Kd shared.png\nmap_Bump -bm 2 -clamp on bump.png\nnewmtl second\nKe 4 2 1\nPr 0.25\nillum 300\nmap_Kd shared.png\nrefl -type cube_top -o 0.5 0.5 0 top.png\nnewmtl third\nmap_Ke -bm 2 -clamp on bump.png\n"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC5:
+	.long	0
+	.long	1070596096
+	.align 8
+.LC6:
+	.long	-350469331
+	.long	1058682594
+	.align 8
+.LC8:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC10:
+	.long	0
+	.long	1079510016
+	.align 8
+.LC12:
+	.long	0
+	.long	1073741824
+	.align 8
+.LC15:
+	.long	0
+	.long	1071644672
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC19:
+	.long	855638016
+	.align 4
+.LC21:
+	.long	1065353216
+	.align 4
+.LC22:
+	.long	864026624
+	.align 4
+.LC23:
+	.long	1148846080
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC25:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst4
+	.align 4
+.LC26:
+	.long	947912704
+	.align 4
+.LC27:
+	.long	973078528
+	.section	.note.GNU-stack,"",@progbits
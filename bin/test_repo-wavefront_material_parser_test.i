@@ -0,0 +1,4277 @@
+# 0 "src/wavefront_material_parser_test.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/wavefront_material_parser_test.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 2 "src/wavefront_material_parser_test.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 3 "src/wavefront_material_parser_test.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 4 "src/wavefront_material_parser_test.c" 2
+# 1 "src/wavefront_material_parser.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 8 "src/wavefront_material_parser.h" 2
+# 1 "src/wavefront_material.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_material.h" 2
+# 1 "src/wavefront_allocator.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_allocator.h" 2
+
+
+
+
+
+# 12 "src/wavefront_allocator.h"
+struct WavefrontAllocator {
+    void *(*allocate)(void *context, size_t size);
+    void *(*reallocate)(void *context, void *pointer, size_t size);
+    void (*release)(void *context, void *pointer);
+    void *context;
+};
+
+struct WavefrontAllocationStats {
+    unsigned long long allocations;
+    unsigned long long bytes;
+};
+
+
+
+
+void wavefrontSetAllocator(const struct WavefrontAllocator *allocator);
+void *wavefrontAllocate(size_t size);
+
+void *wavefrontAllocateZeroed(size_t count, size_t size);
+void *wavefrontReallocate(void *pointer, size_t size);
+void wavefrontFree(void *pointer);
+
+
+void *wavefrontAllocateWith(const struct WavefrontAllocator *allocator, size_t size);
+void *wavefrontAllocateZeroedWith(const struct WavefrontAllocator *allocator, size_t count, size_t size);
+void *wavefrontReallocateWith(const struct WavefrontAllocator *allocator, void *pointer, size_t size);
+void wavefrontFreeWith(const struct WavefrontAllocator *allocator, void *pointer);
+
+
+
+struct WavefrontAllocationStats *wavefrontTrackAllocations(struct WavefrontAllocationStats *stats);
+# 9 "src/wavefront_material.h" 2
+
+struct WavefrontColor {
+    float r, g, b, a;
+};
+# 23 "src/wavefront_material.h"
+struct WavefrontMapOptions {
+    float offset[3];
+    float scale[3];
+    float turbulence[3];
+    float bumpMultiplier;
+    float boost;
+    float base, gain;
+    int resolution;
+    int channel;
+    unsigned int flags;
+};
+
+struct WavefrontMap {
+    char *file;
+
+    unsigned int texture;
+
+    unsigned int options;
+};
+
+struct WavefrontMaterial {
+    char *name;
+    struct WavefrontColor ambient;
+    struct WavefrontColor diffuse;
+    struct WavefrontColor specular;
+    struct WavefrontColor transmission;
+    struct WavefrontColor emission;
+    float specularExponent;
+    float dissolve;
+    float opticalDensity;
+
+    float roughness;
+    float metallic;
+    float sheen;
+    float clearcoatThickness;
+    float clearcoatRoughness;
+    float anisotropy;
+    float anisotropyRotation;
+    int illuminationModel;
+    struct WavefrontMap ambientMap;
+    struct WavefrontMap diffuseMap;
+    struct WavefrontMap normalMap;
+    struct WavefrontMap specularColorMap;
+    struct WavefrontMap specularHighlightMap;
+    struct WavefrontMap alphaMap;
+    struct WavefrontMap bumpMap;
+    struct WavefrontMap displacementMap;
+    struct WavefrontMap decalMap;
+    struct WavefrontMap reflectionMapSphere;
+    struct WavefrontMap reflectionMapCubeTop;
+    struct WavefrontMap reflectionMapCubeBottom;
+    struct WavefrontMap reflectionMapCubeFront;
+    struct WavefrontMap reflectionMapCubeBack;
+    struct WavefrontMap reflectionMapCubeLeft;
+    struct WavefrontMap reflectionMapCubeRight;
+    struct WavefrontMap roughnessMap;
+    struct WavefrontMap metallicMap;
+    struct WavefrontMap sheenMap;
+    struct WavefrontMap emissionMap;
+};
+
+
+
+
+
+
+
+struct WavefrontArenaChunk;
+
+struct WavefrontMTL {
+    struct WavefrontMaterial *materials;
+    unsigned int materialCount;
+    unsigned int materialCapacity;
+
+    unsigned int *materialTable;
+    unsigned int materialTableSize;
+
+    char **textures;
+    unsigned int textureCount;
+    unsigned int textureCapacity;
+    unsigned int *textureTable;
+    unsigned int textureTableSize;
+
+    struct WavefrontMapOptions *mapOptions;
+    unsigned int mapOptionCount;
+    unsigned int mapOptionCapacity;
+    unsigned int *mapOptionTable;
+    unsigned int mapOptionTableSize;
+    unsigned int flags;
+    struct WavefrontArenaChunk *arena;
+
+
+    const struct WavefrontAllocator *allocator;
+};
+
+
+struct WavefrontMTLChanges {
+    unsigned int *added;
+    unsigned int addedCount;
+    unsigned int *removed;
+    unsigned int removedCount;
+    unsigned int *changed;
+    unsigned int changedCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+
+
+
+struct WavefrontMTLRemap {
+    int *indices;
+    unsigned int *offsets;
+    unsigned int sourceCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+void wavefrontMTLCompose(struct WavefrontMTL *mtl);
+void wavefrontMTLRelease(struct WavefrontMTL *mtl);
+
+
+
+int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name);
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length);
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string);
+
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count);
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl);
+
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name);
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length);
+
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture);
+
+
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index);
+
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map);
+
+
+
+
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other);
+
+
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b);
+
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m);
+
+
+
+
+
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes);
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes);
+
+
+
+
+
+
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap);
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap);
+
+unsigned int wavefrontMTLHashName(const char *name, size_t length);
+
+
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options);
+
+
+int wavefrontMaterialCompose(struct WavefrontMaterial *m);
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index);
+# 9 "src/wavefront_material_parser.h" 2
+
+
+enum WavefrontMTLStatement {
+    WAVEFRONT_MTL_STATEMENT_OTHER,
+    WAVEFRONT_MTL_STATEMENT_MATERIAL,
+    WAVEFRONT_MTL_STATEMENT_COLOR,
+    WAVEFRONT_MTL_STATEMENT_SCALAR,
+    WAVEFRONT_MTL_STATEMENT_MAP,
+    WAVEFRONT_MTL_STATEMENT_COUNT
+};
+
+
+
+
+struct WavefrontMTLStats {
+    unsigned long long lines;
+    unsigned long long bytes;
+    unsigned int materials;
+    unsigned int duplicateMaterials;
+    struct WavefrontAllocationStats allocation;
+    unsigned long long statements[WAVEFRONT_MTL_STATEMENT_COUNT];
+    unsigned long long nanoseconds[WAVEFRONT_MTL_STATEMENT_COUNT];
+};
+
+
+enum WavefrontMTLError {
+    WAVEFRONT_MTL_ERROR_MISSING_VALUE,
+    WAVEFRONT_MTL_ERROR_BAD_VALUE,
+    WAVEFRONT_MTL_ERROR_EXTRA_VALUE,
+    WAVEFRONT_MTL_ERROR_MAP_OPTION
+};
+
+
+
+struct WavefrontMTLDiagnostic {
+    unsigned long long line;
+    unsigned long long offset;
+    char keyword[16];
+    enum WavefrontMTLError error;
+};
+
+
+struct WavefrontMTLDiagnostics {
+    struct WavefrontMTLDiagnostic *items;
+    unsigned int capacity;
+    unsigned int count;
+    unsigned long long total;
+};
+
+struct WavefrontMTLOptions {
+
+    unsigned int materialCapacity;
+
+    unsigned int flags;
+
+
+    unsigned int threadCount;
+
+    struct WavefrontMTLStats *stats;
+
+
+    const struct WavefrontAllocator *allocator;
+
+
+
+    struct WavefrontMTLDiagnostics *diagnostics;
+};
+
+
+
+struct WavefrontMTLParser {
+    struct WavefrontMTL *mtl;
+    struct WavefrontMaterial *material;
+    char *pending;
+    size_t pendingLength;
+    size_t pendingCapacity;
+    int result;
+    int selectOnly;
+    struct WavefrontMTLStats *stats;
+    struct WavefrontAllocationStats *trackedBefore;
+    const struct WavefrontAllocator *allocator;
+
+
+    struct WavefrontMTLDiagnostics *diagnostics;
+    enum WavefrontMTLError error;
+    const char *chunk;
+    const char *counted;
+    unsigned long long lines;
+    unsigned long long offset;
+};
+
+int parseWavefrontMTLFromString(struct WavefrontMTL *mtl, const char *input);
+
+
+int parseWavefrontMTLFromBuffer(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options);
+
+int parseWavefrontMTLFromFile(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontMTLOptions *options);
+
+
+
+struct WavefrontMTLBatchItem {
+    const char *path;
+    const char *input;
+    size_t length;
+    struct WavefrontMTL mtl;
+    int result;
+};
+
+
+
+
+int parseWavefrontMTLBatch(
+    struct WavefrontMTLBatchItem *items,
+    unsigned int count,
+    const struct WavefrontMTLOptions *options);
+
+
+
+int wavefrontMTLReload(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    struct WavefrontMTLChanges *changes);
+
+struct WavefrontMTLIndexEntry;
+struct WavefrontMTLIndexBlock;
+
+
+
+
+
+struct WavefrontMTLIndex {
+    const char *input;
+    size_t length;
+    struct WavefrontMTLIndexEntry *entries;
+    unsigned int entryCount;
+    unsigned int entryCapacity;
+    struct WavefrontMTLIndexBlock *blocks;
+    unsigned int blockCount;
+    unsigned int blockCapacity;
+
+    unsigned int *table;
+    unsigned int tableSize;
+    struct WavefrontMTL mtl;
+};
+
+int wavefrontMTLIndexCompose(
+    struct WavefrontMTLIndex *index,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options);
+
+
+int wavefrontMTLIndexFind(struct WavefrontMTLIndex *index, const char *name, int *material);
+void wavefrontMTLIndexRelease(struct WavefrontMTLIndex *index);
+
+
+
+int wavefrontMTLParserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options);
+int wavefrontMTLParserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length);
+int wavefrontMTLParserFinish(struct WavefrontMTLParser *parser);
+# 5 "src/wavefront_material_parser_test.c" 2
+# 1 "../cutil/src/error.h" 1
+# 6 "src/wavefront_material_parser_test.c" 2
+# 1 "../cutil/src/assertion.h" 1
+
+
+
+
+extern int asserts_passed, asserts_failed;
+# 7 "src/wavefront_material_parser_test.c" 2
+
+void testParseNewMaterial() {
+    char input[] = "newmtl new_material";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 12, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 13, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].name), *_b=("new_material"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 14, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseNewMaterialNoName() {
+    char input[] = "newmtl";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 22, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 23, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseNewMaterialGarbage() {
+    char input[] = "newmtl new_material asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 31, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 32, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseAmbientRGB() {
+    char input[] = "newmtl new_material\n"
+                   "Ka 0.1 0.5 0.7";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 41, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 42, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].ambient;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 44, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 45, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 46, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 47, _a, _b);} } while(0);
+}
+
+void testParseAmbientRGBOnlyR() {
+    char input[] = "newmtl new_material\n"
+                   "Ka 0.1";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 55, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 56, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].ambient;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 58, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 59, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 60, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 61, _a, _b);} } while(0);
+}
+
+void testParseAmbientRGBOnlyREmptyG() {
+    char input[] = "newmtl new_material\n"
+                   "Ka 0.1 ";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 69, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 70, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].ambient;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 72, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 73, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 74, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 75, _a, _b);} } while(0);
+}
+
+void testParseAmbientRGBOnlyRG() {
+    char input[] = "newmtl new_material\n"
+                   "Ka 0.1 0.5";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 83, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 84, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].ambient;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 86, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 87, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 88, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 89, _a, _b);} } while(0);
+}
+
+void testParseAmbientRGBOnlyRGEmptyB() {
+    char input[] = "newmtl new_material\n"
+                   "Ka 0.1 0.5 ";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 97, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 98, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].ambient;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 100, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 101, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 102, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 103, _a, _b);} } while(0);
+}
+
+void testParseAmbientRGBGarbage() {
+    char input[] = "newmtl new_material\n"
+                   "Ka 0.1 0.5 0.7 asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 111, _a, _b);} } while(0);
+}
+
+void testParseDiffuseRGB() {
+    char input[] = "newmtl new_material\n"
+                   "Kd 0.1 0.5 0.7";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 119, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 120, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].diffuse;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 122, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 123, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 124, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 125, _a, _b);} } while(0);
+}
+
+void testParseDiffuseRGBOnlyR() {
+    char input[] = "newmtl new_material\n"
+                   "Kd 0.1";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 133, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 134, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].diffuse;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 136, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 137, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 138, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 139, _a, _b);} } while(0);
+}
+
+void testParseDiffuseRGBOnlyRG() {
+    char input[] = "newmtl new_material\n"
+                   "Kd 0.1 0.5";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 147, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 148, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].diffuse;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 150, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 151, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 152, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 153, _a, _b);} } while(0);
+}
+
+void testParseDiffuseRGBGarbage() {
+    char input[] = "newmtl new_material\n"
+                   "Kd 0.1 0.5 0.7 asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 161, _a, _b);} } while(0);
+}
+
+void testParseSpecularRGB() {
+    char input[] = "newmtl new_material\n"
+                   "Ks 0.1 0.5 0.7";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 169, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 170, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].specular;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 172, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 173, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 174, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 175, _a, _b);} } while(0);
+}
+
+void testParseSpecularRGBOnlyR() {
+    char input[] = "newmtl new_material\n"
+                   "Ks 0.1";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 183, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 184, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].specular;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 186, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 187, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 188, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 189, _a, _b);} } while(0);
+}
+
+void testParseSpecularRGBOnlyRG() {
+    char input[] = "newmtl new_material\n"
+                   "Ks 0.1 0.5";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 197, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 198, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].specular;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 200, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 201, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 202, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 203, _a, _b);} } while(0);
+}
+
+void testParseSpecularRGBGarbage() {
+    char input[] = "newmtl new_material\n"
+                   "Ks 0.1 0.5 0.7 asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 211, _a, _b);} } while(0);
+}
+
+
+void testParseTransmissionRGB() {
+    char input[] = "newmtl new_material\n"
+                   "Tf 0.1 0.5 0.7";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 220, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 221, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].transmission;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 223, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 224, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 225, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 226, _a, _b);} } while(0);
+}
+
+void testParseTransmissionRGBOnlyR() {
+    char input[] = "newmtl new_material\n"
+                   "Tf 0.1";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 234, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 235, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].transmission;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 237, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 238, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 239, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 240, _a, _b);} } while(0);
+}
+
+void testParseTransmissionRGBOnlyRG() {
+    char input[] = "newmtl new_material\n"
+                   "Tf 0.1 0.5";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 248, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 249, _a, _b);} } while(0);
+    struct WavefrontColor color = mtl.materials[0].transmission;
+    do { double _a=(color.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 251, _a, _b);} } while(0);
+    do { double _a=(color.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 252, _a, _b);} } while(0);
+    do { double _a=(color.b), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 253, _a, _b);} } while(0);
+    do { double _a=(color.a), _b=(1.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 254, _a, _b);} } while(0);
+}
+
+void testParseTransmissionRGBGarbage() {
+    char input[] = "newmtl new_material\n"
+                   "Tf 0.1 0.5 0.7 asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 262, _a, _b);} } while(0);
+}
+
+void testParseComment() {
+    char input[] = "# A comment.";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 269, _a, _b);} } while(0);
+}
+
+void testParseIllumination() {
+    char input[] = "newmtl new_material\n"
+                   "illum 5";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 277, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 278, _a, _b);} } while(0);
+    int illuminationModel = mtl.materials[0].illuminationModel;
+    do { long long _a=(long long)(illuminationModel), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 280, _a, _b);} } while(0);
+}
+
+void testParseIlluminationMissingNumber() {
+    char input[] = "newmtl new_material\n"
+                   "illum";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 288, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 289, _a, _b);} } while(0);
+    int illuminationModel = mtl.materials[0].illuminationModel;
+    do { long long _a=(long long)(illuminationModel), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 291, _a, _b);} } while(0);
+}
+
+void testParseIlluminationEmptyNumber() {
+    char input[] = "newmtl new_material\n"
+                   "illum ";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 299, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 300, _a, _b);} } while(0);
+    int illuminationModel = mtl.materials[0].illuminationModel;
+    do { long long _a=(long long)(illuminationModel), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 302, _a, _b);} } while(0);
+}
+
+void testParseIlluminationInvalidNumber() {
+    char input[] = "newmtl new_material\n"
+                   "illum asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 310, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 311, _a, _b);} } while(0);
+    int illuminationModel = mtl.materials[0].illuminationModel;
+    do { long long _a=(long long)(illuminationModel), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 313, _a, _b);} } while(0);
+}
+
+void testParseIlluminationIgnoresGarbage() {
+    char input[] = "newmtl new_material\n"
+                   "illum 10 asdf";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 321, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 322, _a, _b);} } while(0);
+    int illuminationModel = mtl.materials[0].illuminationModel;
+    do { long long _a=(long long)(illuminationModel), _b=(long long)(10); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 324, _a, _b);} } while(0);
+}
+
+void testParseSpecularExponent() {
+    char input[] = "newmtl new_material\n"
+                   "Ns 0.5";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 332, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 333, _a, _b);} } while(0);
+    float specularExponent = mtl.materials[0].specularExponent;
+    do { double _a=(specularExponent), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 335, _a, _b);} } while(0);
+}
+
+void testParseReflectionMapSphere() {
+    char input[] = "newmtl new_material\n"
+                   "refl -type sphere sphere.png";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 343, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 344, _a, _b);} } while(0);
+    char *reflectionMapSphere = mtl.materials[0].reflectionMapSphere.file;
+    do { const char *_a=(reflectionMapSphere), *_b=("sphere.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 346, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+}
+
+void testParseReflectionMapCube() {
+    char input[] = "newmtl new_material\n"
+                   "refl -type cube_top ../skybox/up.png\n"
+                   "refl -type cube_bottom ../skybox/dn.png\n"
+                   "refl -type cube_front ../skybox/ft.png\n"
+                   "refl -type cube_back ../skybox/bk.png\n"
+                   "refl -type cube_left ../skybox/lf.png\n"
+                   "refl -type cube_right ../skybox/rt.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 359, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 360, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].reflectionMapCubeTop.file), *_b=("../skybox/up.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 361, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[0].reflectionMapCubeBottom.file), *_b=("../skybox/dn.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 362, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[0].reflectionMapCubeLeft.file), *_b=("../skybox/lf.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 363, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[0].reflectionMapCubeRight.file), *_b=("../skybox/rt.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 364, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[0].reflectionMapCubeFront.file), *_b=("../skybox/ft.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 365, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[0].reflectionMapCubeBack.file), *_b=("../skybox/bk.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 366, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+
+}
+
+void testParseMapOptions() {
+    char input[] = "newmtl new_material\n"
+                   "map_Kd -o 0.5 0.25 -s 2 -t 0.1 0.2 0.3 -mm 0.2 0.8 -blendu off -clamp on "
+                   "-imfchan l -texres 512 -boost 1.5 -cc on textures/diffuse map.png \n"
+                   "map_Kn -bm 0.3 -unknown value normal.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 377, _a, _b);} } while(0);
+    const struct WavefrontMapOptions *options = wavefrontMTLMapOptions(&mtl, &mtl.materials[0].diffuseMap);
+    do { const char *_a=(mtl.materials[0].diffuseMap.file), *_b=("textures/diffuse map.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 379, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(options->offset[0]), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 380, _a, _b);} } while(0);
+    do { double _a=(options->offset[1]), _b=(0.25); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 381, _a, _b);} } while(0);
+    do { double _a=(options->offset[2]), _b=(0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 382, _a, _b);} } while(0);
+
+    do { double _a=(options->scale[0]), _b=(2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 384, _a, _b);} } while(0);
+    do { double _a=(options->scale[1]), _b=(1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 385, _a, _b);} } while(0);
+    do { double _a=(options->scale[2]), _b=(1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 386, _a, _b);} } while(0);
+    do { double _a=(options->turbulence[2]), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 387, _a, _b);} } while(0);
+    do { double _a=(options->base), _b=(0.2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 388, _a, _b);} } while(0);
+    do { double _a=(options->gain), _b=(0.8); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 389, _a, _b);} } while(0);
+    do { double _a=(options->boost), _b=(1.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 390, _a, _b);} } while(0);
+    do { double _a=(options->bumpMultiplier), _b=(1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 391, _a, _b);} } while(0);
+    do { long long _a=(long long)(options->resolution), _b=(long long)(512); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 392, _a, _b);} } while(0);
+    do { long long _a=(long long)(options->channel), _b=(long long)('l'); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 393, _a, _b);} } while(0);
+    do { long long _a=(long long)(options->flags), _b=(long long)(0x2 | 0x8 | 0x4); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 394, _a, _b);} } while(0)
+                                                                                    ;
+
+    options = wavefrontMTLMapOptions(&mtl, &mtl.materials[0].normalMap);
+    do { const char *_a=(mtl.materials[0].normalMap.file), *_b=("normal.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 398, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(options->bumpMultiplier), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 399, _a, _b);} } while(0);
+    do { double _a=(options->scale[0]), _b=(1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 400, _a, _b);} } while(0);
+    do { long long _a=(long long)(options->flags), _b=(long long)(0x1 | 0x2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 401, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.mapOptionCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 402, _a, _b);} } while(0);
+
+    struct WavefrontMapOptions defaults;
+    wavefrontMapOptionsCompose(&defaults);
+    do { long long _a=(long long)(mtl.materials[0].bumpMap.options), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 406, _a, _b);} } while(0);
+    do { long long _a=(long long)(memcmp(wavefrontMTLMapOptions(&mtl, &mtl.materials[0].bumpMap), &defaults, sizeof(defaults))), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 407, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseMapOptionsReplaced() {
+    char input[] = "newmtl new_material\n"
+                   "map_Kd -clamp on -s 3 first.png\n"
+                   "map_Kd second.png\n"
+                   "refl -s 4 -type sphere -blendv off sphere.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 418, _a, _b);} } while(0);
+    struct WavefrontMap *map = &mtl.materials[0].diffuseMap;
+    do { const char *_a=(map->file), *_b=("second.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 420, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { long long _a=(long long)(map->options), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 421, _a, _b);} } while(0);
+    map = &mtl.materials[0].reflectionMapSphere;
+    do { const char *_a=(map->file), *_b=("sphere.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 423, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    const struct WavefrontMapOptions *options = wavefrontMTLMapOptions(&mtl, map);
+    do { long long _a=(long long)(options->flags), _b=(long long)(0x1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 425, _a, _b);} } while(0);
+    do { double _a=(options->scale[0]), _b=(4); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 426, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseMapOptionsGarbage() {
+    const char *inputs[] = {
+        "newmtl m\nmap_Kd -s file.png\n",
+        "newmtl m\nmap_Kd -mm 1 file.png\n",
+        "newmtl m\nmap_Kd -clamp yes file.png\n",
+        "newmtl m\nmap_Kd -imfchan x file.png\n",
+        "newmtl m\nmap_Kd -texres 1.5 file.png\n",
+        "newmtl m\nrefl -type sphere -bm\n"
+    };
+
+
+    for(unsigned int i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        struct WavefrontMTL mtl;
+        int result = parseWavefrontMTLFromString(&mtl, inputs[i]);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 444, _a, _b);} } while(0);
+        do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 445, _a, _b);} } while(0);
+        do { long long _a=(long long)(mtl.mapOptionCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 446, _a, _b);} } while(0);
+        const char *file = mtl.materials[0].diffuseMap.file;
+        if(i < 5) do { const char *_a=(file), *_b=("file.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 448, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+        do { long long _a=(long long)(mtl.materials[0].reflectionMapSphere.file == 
+# 449 "src/wavefront_material_parser_test.c" 3 4
+       ((void *)0)
+# 449 "src/wavefront_material_parser_test.c"
+       ), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 449, _a, _b);} } while(0);
+        wavefrontMTLRelease(&mtl);
+
+
+        struct WavefrontMTLDiagnostic item;
+        struct WavefrontMTLDiagnostics diagnostics = {&item, 1};
+        struct WavefrontMTLOptions options = {0};
+        options.diagnostics = &diagnostics;
+        result = parseWavefrontMTLFromBuffer(&mtl, inputs[i], strlen(inputs[i]), &options);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 458, _a, _b);} } while(0);
+        do { long long _a=(long long)(diagnostics.total), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 459, _a, _b);} } while(0);
+        do { long long _a=(long long)(item.error), _b=(long long)(WAVEFRONT_MTL_ERROR_MAP_OPTION); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 460, _a, _b);} } while(0);
+        if(i < 5) do { const char *_a=(mtl.materials[0].diffuseMap.file), *_b=("file.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 461, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+        wavefrontMTLRelease(&mtl);
+    }
+}
+
+void testParseAllMaps() {
+    char input[] = "newmtl new_material\n"
+                   "map_Ka ka.png\n"
+                   "map_Kd kd.png\n"
+                   "map_Ks ks.png\n"
+                   "map_Ke ke.png\n"
+                   "map_Ns ns.png\n"
+                   "map_d d.png\n"
+                   "map_bump -bm 0.5 bump.png\n"
+                   "disp disp.png\n"
+                   "decal decal.png\n"
+                   "map_Pr pr.png\n"
+                   "map_Pm pm.png\n"
+                   "map_Ps ps.png\n"
+                   "norm norm.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 483, _a, _b);} } while(0);
+    struct WavefrontMaterial *m = mtl.materials;
+    do { const char *_a=(m->ambientMap.file), *_b=("ka.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 485, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->diffuseMap.file), *_b=("kd.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 486, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->specularColorMap.file), *_b=("ks.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 487, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->emissionMap.file), *_b=("ke.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 488, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->specularHighlightMap.file), *_b=("ns.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 489, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->alphaMap.file), *_b=("d.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 490, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->bumpMap.file), *_b=("bump.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 491, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(wavefrontMTLMapOptions(&mtl, &m->bumpMap)->bumpMultiplier), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 492, _a, _b);} } while(0);
+    do { const char *_a=(m->displacementMap.file), *_b=("disp.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 493, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->decalMap.file), *_b=("decal.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 494, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->roughnessMap.file), *_b=("pr.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 495, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->metallicMap.file), *_b=("pm.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 496, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->sheenMap.file), *_b=("ps.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 497, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(m->normalMap.file), *_b=("norm.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 498, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseBumpSpellings() {
+    char input[] = "newmtl a\nbump a.png\n"
+                   "newmtl b\nmap_Bump b.png\n"
+                   "newmtl c\nmap_bumps c.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 508, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].bumpMap.file), *_b=("a.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 509, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[1].bumpMap.file), *_b=("b.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 510, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { long long _a=(long long)(!mtl.materials[2].bumpMap.file), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 511, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParsePhysicallyBased() {
+    char input[] = "newmtl new_material\n"
+                   "Pr 0.25\n"
+                   "Pm 1\n"
+                   "Ps 0.5\n"
+                   "Pc 0.125\n"
+                   "Pcr 0.75\n"
+                   "aniso 0.3\n"
+                   "anisor 0.6\n"
+                   "Ke 0.1 0.2 0.3\n"
+                   "Tr 0.25\n"
+                   "Pq 9\n"
+                   "anisox 9\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 530, _a, _b);} } while(0);
+    struct WavefrontMaterial *m = mtl.materials;
+    do { double _a=(m->roughness), _b=(0.25); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 532, _a, _b);} } while(0);
+    do { double _a=(m->metallic), _b=(1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 533, _a, _b);} } while(0);
+    do { double _a=(m->sheen), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 534, _a, _b);} } while(0);
+    do { double _a=(m->clearcoatThickness), _b=(0.125); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 535, _a, _b);} } while(0);
+    do { double _a=(m->clearcoatRoughness), _b=(0.75); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 536, _a, _b);} } while(0);
+    do { double _a=(m->anisotropy), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 537, _a, _b);} } while(0);
+    do { double _a=(m->anisotropyRotation), _b=(0.6); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 538, _a, _b);} } while(0);
+    do { double _a=(m->emission.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 539, _a, _b);} } while(0);
+    do { double _a=(m->emission.b), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 540, _a, _b);} } while(0);
+    do { double _a=(m->emission.a), _b=(1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 541, _a, _b);} } while(0);
+
+    do { double _a=(m->dissolve), _b=(0.75); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 543, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseBlenderWavefrontMaterial() {
+    char input[] = "# Blender MTL File: 'test.xyz'\n"
+                   "# Material Count: 1 \n"
+                   "\n"
+                   "newmtl Material_001.001\n"
+                   "Ns 3.920000\n"
+                   "Ka 0.100000 0.200000 0.300000\n"
+                   "Kd 0.400000 0.500000 0.600000\n"
+                   "Ks 0.700000 0.800000 0.900000\n"
+                   "Ni 0.500000\n"
+                   "d 0.200000\n"
+                   "illum 2\n"
+                   "map_Kd test.png\n";
+    struct WavefrontMTL mtl;
+    mtl.materials = 
+# 561 "src/wavefront_material_parser_test.c" 3 4
+                   ((void *)0)
+# 561 "src/wavefront_material_parser_test.c"
+                       ;
+    mtl.materialCount = 0;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 564, _a, _b);} } while(0);
+    struct WavefrontMaterial *m = mtl.materials;
+    do { const char *_a=(m->name), *_b=("Material_001.001"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 566, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(m->specularExponent), _b=(3.92); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 567, _a, _b);} } while(0);
+    do { double _a=(m->ambient.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 568, _a, _b);} } while(0);
+    do { double _a=(m->ambient.g), _b=(0.2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 569, _a, _b);} } while(0);
+    do { double _a=(m->ambient.b), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 570, _a, _b);} } while(0);
+    do { double _a=(m->diffuse.r), _b=(0.4); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 571, _a, _b);} } while(0);
+    do { double _a=(m->diffuse.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 572, _a, _b);} } while(0);
+    do { double _a=(m->diffuse.b), _b=(0.6); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 573, _a, _b);} } while(0);
+    do { double _a=(m->specular.r), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 574, _a, _b);} } while(0);
+    do { double _a=(m->specular.g), _b=(0.8); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 575, _a, _b);} } while(0);
+    do { double _a=(m->specular.b), _b=(0.9); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 576, _a, _b);} } while(0);
+    do { double _a=(m->dissolve), _b=(0.2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 577, _a, _b);} } while(0);
+    do { double _a=(m->opticalDensity), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 578, _a, _b);} } while(0);
+    do { long long _a=(long long)(m->illuminationModel), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 579, _a, _b);} } while(0);
+    do { const char *_a=(m->diffuseMap.file), *_b=("test.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 580, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseGuruWavefrontMaterial() {
+    char input[] = "# Guru\n"
+                   "# File Created: 09.01.2016 12:00:00\n\n"
+                   "newmtl Material_Test\n"
+                   "\tNs 32\n"
+                   "\td 1\n"
+                   "\tTr 0\n"
+                   "\tTf 1 1 1\n"
+                   "\tillum 2\n"
+                   "\tKa 0.1000 0.2000 0.3000\n"
+                   "\tKd 0.4000 0.5000 0.6000\n"
+                   "\tKs 0.7000 0.8000 0.9000\n";
+    struct WavefrontMTL mtl;
+    mtl.materials = 
+# 597 "src/wavefront_material_parser_test.c" 3 4
+                   ((void *)0)
+# 597 "src/wavefront_material_parser_test.c"
+                       ;
+    mtl.materialCount = 0;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 600, _a, _b);} } while(0);
+    struct WavefrontMaterial *m = mtl.materials;
+    do { const char *_a=(m->name), *_b=("Material_Test"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 602, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(m->specularExponent), _b=(32.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 603, _a, _b);} } while(0);
+    do { double _a=(m->ambient.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 604, _a, _b);} } while(0);
+    do { double _a=(m->ambient.g), _b=(0.2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 605, _a, _b);} } while(0);
+    do { double _a=(m->ambient.b), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 606, _a, _b);} } while(0);
+    do { double _a=(m->diffuse.r), _b=(0.4); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 607, _a, _b);} } while(0);
+    do { double _a=(m->diffuse.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 608, _a, _b);} } while(0);
+    do { double _a=(m->diffuse.b), _b=(0.6); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 609, _a, _b);} } while(0);
+    do { double _a=(m->specular.r), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 610, _a, _b);} } while(0);
+    do { double _a=(m->specular.g), _b=(0.8); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 611, _a, _b);} } while(0);
+    do { double _a=(m->specular.b), _b=(0.9); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 612, _a, _b);} } while(0);
+    do { long long _a=(long long)(m->illuminationModel), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 613, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseBufferNotTerminated() {
+    char input[] = "newmtl first\nKd 0.1 0.5 0.7\nnewmtl second_is_cut";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 5, 
+# 620 "src/wavefront_material_parser_test.c" 3 4
+                                                                            ((void *)0)
+# 620 "src/wavefront_material_parser_test.c"
+                                                                                );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 621, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 622, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].name), *_b=("first"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 623, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[1].name), *_b=("second_is"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 624, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(mtl.materials[0].diffuse.b), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 625, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseReservesMaterials() {
+    char input[] = "newmtl first\nnewmtl second\n";
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLOptions options = {0};
+    options.materialCapacity = 64;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 1, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 635, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 636, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCapacity), _b=(long long)(64); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 637, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseArena() {
+    char input[] = "newmtl first\n"
+                   "map_Kd first.png\n"
+                   "map_Kd replaced.png\n"
+                   "newmtl second\n"
+                   "refl -type sphere sphere.png\n";
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLOptions options = {0};
+    options.flags = 0x1;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 1, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 651, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.flags), _b=(long long)(0x1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 652, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 653, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].name), *_b=("first"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 654, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[0].diffuseMap.file), *_b=("replaced.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 655, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[1].reflectionMapSphere.file), *_b=("sphere.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 656, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseSharedTextures() {
+    char input[] = "newmtl first\n"
+                   "map_Kd shared.png\n"
+                   "map_Kn normal.png\n"
+                   "newmtl second\n"
+                   "map_Kd shared.png\n"
+                   "refl -type sphere normal.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 669, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.textureCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 670, _a, _b);} } while(0);
+    do { const char *_a=(mtl.textures[0]), *_b=("shared.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 671, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.textures[1]), *_b=("normal.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 672, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    struct WavefrontMaterial *first = mtl.materials, *second = mtl.materials + 1;
+    do { long long _a=(long long)(first->diffuseMap.texture), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 674, _a, _b);} } while(0);
+    do { long long _a=(long long)(second->diffuseMap.texture), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 675, _a, _b);} } while(0);
+    do { long long _a=(long long)(first->diffuseMap.file == second->diffuseMap.file), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 676, _a, _b);} } while(0);
+    do { long long _a=(long long)(first->normalMap.texture), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 677, _a, _b);} } while(0);
+    do { long long _a=(long long)(second->reflectionMapSphere.texture), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 678, _a, _b);} } while(0);
+    do { long long _a=(long long)(second->normalMap.texture), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 679, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseCarriageReturns() {
+    char input[] = "newmtl new_material\r\n"
+                   "Ka 0.1 0.5 0.7\r\n"
+                   "map_Kd test.png\r\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 689, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 690, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[0].ambient.b), _b=(0.7); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 691, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].diffuseMap.file), *_b=("test.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 692, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+
+
+void testParseLongLines() {
+    size_t capacity = 300000, length = 0;
+    char *input = malloc(capacity);
+    for(unsigned int i = 0; i < 1000; i++) {
+        length += snprintf(input + length, capacity - length, "newmtl m%u\r\nKd 0.5 0.5 0.5\n", i);
+    }
+    input[length++] = '#';
+    for(unsigned int i = 0; i < 200000; i++) input[length++] = i % 64 ? 'x' : ' ';
+    length += snprintf(input + length, capacity - length, "\nnewmtl last\nmap_Kd last.png");
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, length, 
+# 708 "src/wavefront_material_parser_test.c" 3 4
+                                                                 ((void *)0)
+# 708 "src/wavefront_material_parser_test.c"
+                                                                     );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 709, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1001); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 710, _a, _b);} } while(0);
+    if(mtl.materialCount == 1001) {
+        do { double _a=(mtl.materials[999].diffuse.g), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 712, _a, _b);} } while(0);
+        do { const char *_a=(mtl.materials[1000].diffuseMap.file), *_b=("last.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 713, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    }
+    wavefrontMTLRelease(&mtl);
+
+    struct WavefrontMTLIndex index;
+    wavefrontMTLIndexCompose(&index, input, length, 
+# 718 "src/wavefront_material_parser_test.c" 3 4
+                                                   ((void *)0)
+# 718 "src/wavefront_material_parser_test.c"
+                                                       );
+    int material;
+    result = wavefrontMTLIndexFind(&index, "last", &material);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 721, _a, _b);} } while(0);
+    do { long long _a=(long long)(material), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 722, _a, _b);} } while(0);
+    do { long long _a=(long long)(index.entryCount), _b=(long long)(1001); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 723, _a, _b);} } while(0);
+    wavefrontMTLIndexRelease(&index);
+    free(input);
+}
+
+void testParseDuplicateMaterial() {
+    char input[] = "newmtl first\n"
+                   "Ka 0.1 0.5 0.7\n"
+                   "newmtl second\n"
+                   "Ka 0.2\n"
+                   "newmtl first\n"
+                   "Kd 0.3\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 737, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 738, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[0].ambient.r), _b=(0.1); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 739, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[0].diffuse.r), _b=(0.3); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 740, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[1].ambient.r), _b=(0.2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 741, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[1].diffuse.r), _b=(0.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 742, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParsePropertyBeforeMaterial() {
+    char input[] = "Ka 0.1 0.5 0.7\n"
+                   "newmtl new_material\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 751, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 752, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[0].ambient.r), _b=(0.0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 753, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+static const char libraryInput[] =
+    "# Library\n"
+    "newmtl first\n"
+    "\tKa 0.1 0.2 0.3\n"
+    "\tKd 0.4 0.5 0.6\r\n"
+    "\tNs 96.078431\n"
+    "\tillum 2\n"
+    "\tmap_Kd textures/first_diffuse.png\n"
+    "\n"
+    "newmtl second\n"
+    "Ks 0.7\n"
+    "d 0.25\n"
+    "refl -type cube_left left.png\n"
+    "map_Kn textures/first_diffuse.png\n"
+    "newmtl first\n"
+    "Tf 1 1 1\n"
+    "Ni 1.45";
+
+void assertMTLsEqual(struct WavefrontMTL *a, struct WavefrontMTL *b) {
+    do { long long _a=(long long)(a->materialCount), _b=(long long)(b->materialCount); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 776, _a, _b);} } while(0);
+    do { long long _a=(long long)(a->textureCount), _b=(long long)(b->textureCount); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 777, _a, _b);} } while(0);
+    for(unsigned int i = 0; i < a->textureCount && i < b->textureCount; i++) {
+        do { const char *_a=(a->textures[i]), *_b=(b->textures[i]); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 779, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    }
+    if(a->materialCount != b->materialCount) return;
+    for(unsigned int i = 0; i < a->materialCount; i++) {
+        struct WavefrontMaterial *x = a->materials + i, *y = b->materials + i;
+        do { const char *_a=(x->name), *_b=(y->name); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 784, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+        do { long long _a=(long long)(memcmp(&x->ambient, &y->ambient, (char*)&x->ambientMap - (char*)&x->ambient)), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 785, _a, _b);} } while(0)
+                                                           ;
+        for(unsigned int map = 0; map < 20; map++) {
+            struct WavefrontMap *xMap = wavefrontMaterialMap(x, map);
+            struct WavefrontMap *yMap = wavefrontMaterialMap(y, map);
+            do { long long _a=(long long)(xMap->texture), _b=(long long)(yMap->texture); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 790, _a, _b);} } while(0);
+            if(xMap->file || yMap->file) do { const char *_a=(xMap->file), *_b=(yMap->file); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 791, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+        }
+    }
+}
+
+void testParseChunked() {
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromString(&expected, libraryInput);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 799, _a, _b);} } while(0);
+    do { long long _a=(long long)(expected.materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 800, _a, _b);} } while(0);
+
+    size_t length = sizeof(libraryInput) - 1;
+    for(size_t chunkSize = 1; chunkSize <= length; chunkSize++) {
+        struct WavefrontMTL mtl;
+        struct WavefrontMTLParser parser;
+        result = wavefrontMTLParserCompose(&parser, &mtl, 
+# 806 "src/wavefront_material_parser_test.c" 3 4
+                                                         ((void *)0)
+# 806 "src/wavefront_material_parser_test.c"
+                                                             );
+        for(size_t offset = 0; !result && offset < length; offset += chunkSize) {
+            size_t size = length - offset < chunkSize ? length - offset : chunkSize;
+            result = wavefrontMTLParserFeed(&parser, libraryInput + offset, size);
+
+            if(parser.pendingCapacity > 2 * 34) result = 1;
+        }
+        if(!result) result = wavefrontMTLParserFinish(&parser);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 814, _a, _b);} } while(0);
+        assertMTLsEqual(&mtl, &expected);
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+}
+
+void testParseChunkedError() {
+    const char *chunks[] = {"newmtl first\nKa 0.1 0.", "2 0.3 asdf\n", "Kd 1\n"};
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLParser parser;
+    int result = wavefrontMTLParserCompose(&parser, &mtl, 
+# 825 "src/wavefront_material_parser_test.c" 3 4
+                                                         ((void *)0)
+# 825 "src/wavefront_material_parser_test.c"
+                                                             );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 826, _a, _b);} } while(0);
+    result = wavefrontMTLParserFeed(&parser, chunks[0], strlen(chunks[0]));
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 828, _a, _b);} } while(0);
+    result = wavefrontMTLParserFeed(&parser, chunks[1], strlen(chunks[1]));
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 830, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 831, _a, _b);} } while(0);
+    result = wavefrontMTLParserFeed(&parser, chunks[2], strlen(chunks[2]));
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 833, _a, _b);} } while(0);
+    result = wavefrontMTLParserFinish(&parser);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 835, _a, _b);} } while(0);
+}
+
+static int writeFile(const char *path, const char *data, size_t length) {
+    FILE *file = fopen(path, "wb");
+    if(!file) return 2;
+    size_t written = fwrite(data, 1, length, file);
+    fclose(file);
+    return written == length ? 0 : 2;
+}
+
+void testParseFile() {
+    const char *path = "bin/test_parse_file.mtl";
+    int result = writeFile(path, libraryInput, sizeof(libraryInput) - 1);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 849, _a, _b);} } while(0);
+
+    struct WavefrontMTL expected, mtl;
+    parseWavefrontMTLFromString(&expected, libraryInput);
+    result = parseWavefrontMTLFromFile(&mtl, path, 
+# 853 "src/wavefront_material_parser_test.c" 3 4
+                                                  ((void *)0)
+# 853 "src/wavefront_material_parser_test.c"
+                                                      );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 854, _a, _b);} } while(0);
+    assertMTLsEqual(&mtl, &expected);
+    wavefrontMTLRelease(&mtl);
+    wavefrontMTLRelease(&expected);
+    remove(path);
+}
+
+void testParseFilePageSized() {
+
+    const char *path = "bin/test_parse_file.mtl";
+    char input[8192];
+    size_t length = sizeof(input);
+    memset(input, '#', length);
+    const char tail[] = "\nnewmtl last\nNs 12.5";
+    memcpy(input + length - (sizeof(tail) - 1), tail, sizeof(tail) - 1);
+    int result = writeFile(path, input, length);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 870, _a, _b);} } while(0);
+
+    struct WavefrontMTL mtl;
+    result = parseWavefrontMTLFromFile(&mtl, path, 
+# 873 "src/wavefront_material_parser_test.c" 3 4
+                                                  ((void *)0)
+# 873 "src/wavefront_material_parser_test.c"
+                                                      );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 874, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 875, _a, _b);} } while(0);
+    if(mtl.materialCount) do { double _a=(mtl.materials[0].specularExponent), _b=(12.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 876, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+    remove(path);
+}
+
+void testParseFileEmpty() {
+    const char *path = "bin/test_parse_file.mtl";
+    int result = writeFile(path, "", 0);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 884, _a, _b);} } while(0);
+    struct WavefrontMTL mtl;
+    result = parseWavefrontMTLFromFile(&mtl, path, 
+# 886 "src/wavefront_material_parser_test.c" 3 4
+                                                  ((void *)0)
+# 886 "src/wavefront_material_parser_test.c"
+                                                      );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 887, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 888, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+    remove(path);
+}
+
+void testParseFileMissing() {
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromFile(&mtl, "bin/does_not_exist.mtl", 
+# 895 "src/wavefront_material_parser_test.c" 3 4
+                                                                          ((void *)0)
+# 895 "src/wavefront_material_parser_test.c"
+                                                                              );
+    do { long long _a=(long long)(result), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 896, _a, _b);} } while(0);
+}
+
+
+static char *generateLibrary(unsigned int materialCount) {
+    size_t capacity = (size_t)materialCount * 128 + 1;
+    char *output = malloc(capacity);
+    size_t length = 0;
+    for(unsigned int i = 0; output && i < materialCount; i++) {
+        unsigned int name = i % 7 == 6 ? i / 3 : i;
+        length += snprintf(output + length, capacity - length,
+            "newmtl material_%u\n"
+            "Kd %u.25 0.5 0.75\n"
+            "Ns %u\n"
+            "newmtl invalid name\n"
+            "map_Kd textures/diffuse_%u.png\n",
+            name, i % 10, i, i % 50);
+    }
+    return output;
+}
+
+void testParseParallel(unsigned int flags) {
+    char *input = generateLibrary(8000);
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromBuffer(&expected, input, strlen(input), &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 923, _a, _b);} } while(0);
+
+    unsigned int threadCounts[] = {2, 3, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTL mtl;
+        options.threadCount = threadCounts[i];
+        result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 930, _a, _b);} } while(0);
+        do { long long _a=(long long)(mtl.flags), _b=(long long)(flags); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 931, _a, _b);} } while(0);
+        assertMTLsEqual(&mtl, &expected);
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+
+
+void testParseParallelTextureOrder() {
+    size_t capacity = 20000 * 48 + 256;
+    char *input = malloc(capacity);
+    size_t length = 0;
+    for(unsigned int i = 0; i < 20000; i++) {
+        length += snprintf(input + length, capacity - length, "newmtl m%u\nmap_Kd common.png\n", i);
+    }
+    snprintf(input + length, capacity - length,
+        "newmtl late\nmap_Kd first_new.png\n"
+        "newmtl m5\nmap_Ks second_new.png\n"
+        "newmtl last\nmap_Ka replaced.png\nmap_Ka third_new.png\n");
+    struct WavefrontMTLOptions options = {0};
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromBuffer(&expected, input, strlen(input), &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 955, _a, _b);} } while(0);
+    do { long long _a=(long long)(expected.textureCount), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 956, _a, _b);} } while(0);
+    do { long long _a=(long long)(expected.materials[wavefrontMTLFindMaterial(&expected, "late")].diffuseMap.texture), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 957, _a, _b);} } while(0);
+
+    unsigned int threadCounts[] = {2, 4, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTL mtl;
+        options.threadCount = threadCounts[i];
+        result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 964, _a, _b);} } while(0);
+        assertMTLsEqual(&mtl, &expected);
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+void testParseParallelError() {
+    char *input = generateLibrary(8000);
+
+    char *line = strstr(input + strlen(input) / 2, "Kd ");
+    line[3] = 'x';
+    struct WavefrontMTLOptions options = {0};
+    options.threadCount = 4;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 981, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 982, _a, _b);} } while(0);
+    free(input);
+}
+
+
+static const char tolerantInput[] =
+    "# tolerant\n"
+    "newmtl first\n"
+    "Ka 0.1 0.2 0.3\n"
+    "Ka 0.5 x 0.5\n"
+    "Kd 0.4\r\n"
+    "map_Kd -bm abc diffuse.png\n"
+    "newmtl second\n"
+    "  Ks 1 2 3 4\n"
+    "Ns 10\n"
+    "refl -type sphere -o sphere.png\n"
+    "anisotropically_long_keyword\n"
+    "Tf ";
+
+static void assertDiagnostic(
+    const struct WavefrontMTLDiagnostic *diagnostic,
+    unsigned long long line,
+    const char *keyword,
+    enum WavefrontMTLError error
+) {
+    do { long long _a=(long long)(diagnostic->line), _b=(long long)(line); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1007, _a, _b);} } while(0);
+    do { const char *_a=(diagnostic->keyword), *_b=(keyword); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1008, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { long long _a=(long long)(diagnostic->error), _b=(long long)(error); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1009, _a, _b);} } while(0);
+
+    const char *start = tolerantInput + diagnostic->offset;
+    unsigned long long lines = 1;
+    for(const char *c = tolerantInput; c < start; c++) lines += *c == '\n';
+    do { long long _a=(long long)(lines), _b=(long long)(line); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1014, _a, _b);} } while(0);
+    do { long long _a=(long long)(diagnostic->offset == 0 || start[-1] == '\n'), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1015, _a, _b);} } while(0);
+}
+
+static void assertTolerantDiagnostics(const struct WavefrontMTLDiagnostics *diagnostics) {
+    do { long long _a=(long long)(diagnostics->total), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1019, _a, _b);} } while(0);
+    do { long long _a=(long long)(diagnostics->count), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1020, _a, _b);} } while(0);
+    assertDiagnostic(diagnostics->items + 0, 4, "Ka", WAVEFRONT_MTL_ERROR_BAD_VALUE);
+    assertDiagnostic(diagnostics->items + 1, 6, "map_Kd", WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    assertDiagnostic(diagnostics->items + 2, 8, "Ks", WAVEFRONT_MTL_ERROR_EXTRA_VALUE);
+    assertDiagnostic(diagnostics->items + 3, 10, "refl", WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    assertDiagnostic(diagnostics->items + 4, 12, "Tf", WAVEFRONT_MTL_ERROR_MISSING_VALUE);
+}
+
+static void assertTolerantLibrary(struct WavefrontMTL *mtl) {
+    do { long long _a=(long long)(mtl->materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1029, _a, _b);} } while(0);
+    if(mtl->materialCount != 2) return;
+
+
+    do { double _a=(mtl->materials[0].ambient.g), _b=(0.2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1033, _a, _b);} } while(0);
+    do { double _a=(mtl->materials[0].diffuse.b), _b=(0.4); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1034, _a, _b);} } while(0);
+    do { const char *_a=(mtl->materials[0].diffuseMap.file), *_b=("diffuse.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1035, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { long long _a=(long long)(mtl->materials[0].diffuseMap.options), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1036, _a, _b);} } while(0);
+    do { const char *_a=(mtl->materials[1].reflectionMapSphere.file), *_b=("sphere.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1037, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(mtl->materials[1].specular.a), _b=(0); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1038, _a, _b);} } while(0);
+    do { double _a=(mtl->materials[1].specularExponent), _b=(10); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1039, _a, _b);} } while(0);
+}
+
+void testParseTolerant() {
+    struct WavefrontMTLDiagnostic items[8];
+    struct WavefrontMTLDiagnostics diagnostics = {items, 8, 3, 3};
+    struct WavefrontMTLOptions options = {0};
+    options.diagnostics = &diagnostics;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, tolerantInput, sizeof(tolerantInput) - 1, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1049, _a, _b);} } while(0);
+    assertTolerantDiagnostics(&diagnostics);
+    assertTolerantLibrary(&mtl);
+    wavefrontMTLRelease(&mtl);
+
+
+    result = parseWavefrontMTLFromString(&mtl, tolerantInput);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1056, _a, _b);} } while(0);
+}
+
+void testParseTolerantFull() {
+    struct WavefrontMTLDiagnostic items[2];
+    struct WavefrontMTLDiagnostics diagnostics = {items, 2};
+    struct WavefrontMTLOptions options = {0};
+    options.diagnostics = &diagnostics;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, tolerantInput, sizeof(tolerantInput) - 1, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1066, _a, _b);} } while(0);
+    do { long long _a=(long long)(diagnostics.count), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1067, _a, _b);} } while(0);
+    do { long long _a=(long long)(diagnostics.total), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1068, _a, _b);} } while(0);
+    assertDiagnostic(items + 1, 6, "map_Kd", WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    wavefrontMTLRelease(&mtl);
+
+
+    struct WavefrontMTLDiagnostics counted = {
+# 1073 "src/wavefront_material_parser_test.c" 3 4
+                                             ((void *)0)
+# 1073 "src/wavefront_material_parser_test.c"
+                                                 , 0};
+    options.diagnostics = &counted;
+    result = parseWavefrontMTLFromBuffer(&mtl, tolerantInput, sizeof(tolerantInput) - 1, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1076, _a, _b);} } while(0);
+    do { long long _a=(long long)(counted.count), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1077, _a, _b);} } while(0);
+    do { long long _a=(long long)(counted.total), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1078, _a, _b);} } while(0);
+    assertTolerantLibrary(&mtl);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseTolerantChunked() {
+    size_t length = sizeof(tolerantInput) - 1;
+    for(size_t chunkSize = 1; chunkSize <= length; chunkSize++) {
+        struct WavefrontMTLDiagnostic items[8];
+        struct WavefrontMTLDiagnostics diagnostics = {items, 8};
+        struct WavefrontMTLOptions options = {0};
+        options.diagnostics = &diagnostics;
+        struct WavefrontMTL mtl;
+        struct WavefrontMTLParser parser;
+        int result = wavefrontMTLParserCompose(&parser, &mtl, &options);
+        for(size_t offset = 0; !result && offset < length; offset += chunkSize) {
+            size_t size = length - offset < chunkSize ? length - offset : chunkSize;
+            result = wavefrontMTLParserFeed(&parser, tolerantInput + offset, size);
+        }
+        if(!result) result = wavefrontMTLParserFinish(&parser);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1098, _a, _b);} } while(0);
+        assertTolerantDiagnostics(&diagnostics);
+        assertTolerantLibrary(&mtl);
+        wavefrontMTLRelease(&mtl);
+    }
+}
+
+void testParseTolerantParallel() {
+    char *input = generateLibrary(8000);
+
+    unsigned int broken = 0;
+    for(char *line = strstr(input, "\nKd "); line; line = strstr(line + 1, "\nKd ")) {
+        if(broken++ % 97 == 0) line[4] = 'x';
+    }
+    struct WavefrontMTLDiagnostic expectedItems[64], items[64];
+    struct WavefrontMTLDiagnostics expectedDiagnostics = {expectedItems, 64};
+    struct WavefrontMTLOptions options = {0};
+    options.diagnostics = &expectedDiagnostics;
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromBuffer(&expected, input, strlen(input), &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1118, _a, _b);} } while(0);
+    do { long long _a=(long long)(expectedDiagnostics.count), _b=(long long)(64); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1119, _a, _b);} } while(0);
+    do { long long _a=(long long)(expectedDiagnostics.total), _b=(long long)((broken + 96) / 97); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1120, _a, _b);} } while(0);
+
+    unsigned int threadCounts[] = {2, 3, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTLDiagnostics diagnostics = {items, 64};
+        struct WavefrontMTL mtl;
+        options.threadCount = threadCounts[i];
+        options.diagnostics = &diagnostics;
+        result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1129, _a, _b);} } while(0);
+        assertMTLsEqual(&mtl, &expected);
+        do { long long _a=(long long)(diagnostics.total), _b=(long long)(expectedDiagnostics.total); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1131, _a, _b);} } while(0);
+        do { long long _a=(long long)(diagnostics.count), _b=(long long)(64); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1132, _a, _b);} } while(0);
+        for(unsigned int j = 0; j < diagnostics.count; j++) {
+            do { long long _a=(long long)(items[j].line), _b=(long long)(expectedItems[j].line); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1134, _a, _b);} } while(0);
+            do { long long _a=(long long)(items[j].offset), _b=(long long)(expectedItems[j].offset); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1135, _a, _b);} } while(0);
+            do { const char *_a=(items[j].keyword), *_b=("Kd"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1136, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+        }
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+void testParseStats() {
+    char input[] = "# stats\n"
+                   "newmtl first\n"
+                   "Kd 0.5\n"
+                   "\n"
+                   "Ns 10\n"
+                   "map_Kd first.png\n"
+                   "newmtl second\n"
+                   "newmtl first\n"
+                   "Ka 1 1 1";
+    struct WavefrontMTLStats stats;
+    memset(&stats, 0xff, sizeof(stats));
+    struct WavefrontMTLOptions options = {0};
+    options.stats = &stats;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 1, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1160, _a, _b);} } while(0);
+# 1175 "src/wavefront_material_parser_test.c"
+    do { long long _a=(long long)(stats.lines), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1175, _a, _b);} } while(0);
+    do { long long _a=(long long)(stats.allocation.allocations), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1176, _a, _b);} } while(0);
+
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseStatsParallel() {
+    char *input = generateLibrary(40000);
+    size_t length = strlen(input);
+    struct WavefrontMTLStats expected, stats;
+    struct WavefrontMTLOptions options = {0};
+    options.stats = &expected;
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromBuffer(&mtl, input, length, &options);
+    unsigned int materialCount = mtl.materialCount;
+    wavefrontMTLRelease(&mtl);
+
+    options.stats = &stats;
+    options.threadCount = 4;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, length, &options);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1195, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(materialCount); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1196, _a, _b);} } while(0);
+    do { long long _a=(long long)(stats.lines), _b=(long long)(expected.lines); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1197, _a, _b);} } while(0);
+    do { long long _a=(long long)(stats.bytes), _b=(long long)(expected.bytes); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1198, _a, _b);} } while(0);
+    do { long long _a=(long long)(stats.duplicateMaterials), _b=(long long)(expected.duplicateMaterials); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1199, _a, _b);} } while(0);
+    for(unsigned int i = 0; i < WAVEFRONT_MTL_STATEMENT_COUNT; i++) {
+        do { long long _a=(long long)(stats.statements[i]), _b=(long long)(expected.statements[i]); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1201, _a, _b);} } while(0);
+    }
+
+
+
+
+
+    wavefrontMTLRelease(&mtl);
+    free(input);
+}
+
+void testParseBatch() {
+    const char *path = "bin/test_parse_batch.mtl";
+    int result = writeFile(path, libraryInput, sizeof(libraryInput) - 1);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1215, _a, _b);} } while(0);
+    char *large = generateLibrary(2000);
+
+    struct WavefrontMTLBatchItem items[6] = {{0}};
+    items[0].input = "newmtl a\nNs 2";
+    items[0].length = strlen(items[0].input);
+    items[1].path = path;
+    items[2].input = large;
+    items[2].length = strlen(large);
+    items[3].path = "bin/does_not_exist.mtl";
+    items[4].input = "newmtl b\nKa x";
+    items[4].length = strlen(items[4].input);
+
+    items[5].input = "newmtl c\nnewmtl d";
+    items[5].length = 8;
+
+    struct WavefrontMTLOptions options = {0};
+    options.threadCount = 4;
+    result = parseWavefrontMTLBatch(items, 6, &options);
+    do { long long _a=(long long)(result), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1234, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[0].result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1235, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[0].mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1236, _a, _b);} } while(0);
+    do { double _a=(items[0].mtl.materials[0].specularExponent), _b=(2); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1237, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[1].result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1238, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[1].mtl.materialCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1239, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[2].result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1240, _a, _b);} } while(0);
+    struct WavefrontMTL expected;
+    parseWavefrontMTLFromString(&expected, large);
+    assertMTLsEqual(&items[2].mtl, &expected);
+    wavefrontMTLRelease(&expected);
+    do { long long _a=(long long)(items[3].result), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1245, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[3].mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1246, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[4].result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1247, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[4].mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1248, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[5].result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1249, _a, _b);} } while(0);
+    do { long long _a=(long long)(items[5].mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1250, _a, _b);} } while(0);
+    for(unsigned int i = 0; i < 6; i++) {
+        wavefrontMTLRelease(&items[i].mtl);
+    }
+    free(large);
+    remove(path);
+}
+
+void testIndex() {
+    char *input = generateLibrary(3000);
+    struct WavefrontMTL expected;
+    parseWavefrontMTLFromString(&expected, input);
+
+    struct WavefrontMTLIndex index;
+    int result = wavefrontMTLIndexCompose(&index, input, strlen(input), 
+# 1264 "src/wavefront_material_parser_test.c" 3 4
+                                                                       ((void *)0)
+# 1264 "src/wavefront_material_parser_test.c"
+                                                                           );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1265, _a, _b);} } while(0);
+    do { long long _a=(long long)(index.entryCount), _b=(long long)(expected.materialCount); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1266, _a, _b);} } while(0);
+    do { long long _a=(long long)(index.mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1267, _a, _b);} } while(0);
+
+
+    int material = 0;
+    for(unsigned int i = expected.materialCount; i-- > 0;) {
+        struct WavefrontMaterial *m = expected.materials + i;
+        result = wavefrontMTLIndexFind(&index, m->name, &material);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1274, _a, _b);} } while(0);
+        do { long long _a=(long long)(material), _b=(long long)(expected.materialCount - 1 - i); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1275, _a, _b);} } while(0);
+        if(material < 0) break;
+        struct WavefrontMaterial *found = index.mtl.materials + material;
+        do { const char *_a=(found->name), *_b=(m->name); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1278, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+        do { long long _a=(long long)(wavefrontMaterialEqual(&index.mtl, found, &expected, m)), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1279, _a, _b);} } while(0);
+        if(i == expected.materialCount / 2) break;
+    }
+
+    unsigned int parsed = index.mtl.materialCount;
+    result = wavefrontMTLIndexFind(&index, expected.materials[expected.materialCount - 1].name, &material);
+    do { long long _a=(long long)(material), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1285, _a, _b);} } while(0);
+    do { long long _a=(long long)(index.mtl.materialCount), _b=(long long)(parsed); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1286, _a, _b);} } while(0);
+    do { long long _a=(long long)(parsed < expected.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1287, _a, _b);} } while(0);
+
+    result = wavefrontMTLIndexFind(&index, "missing", &material);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1290, _a, _b);} } while(0);
+    do { long long _a=(long long)(material), _b=(long long)(-1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1291, _a, _b);} } while(0);
+    wavefrontMTLIndexRelease(&index);
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+void testIndexParseError() {
+    char input[] =
+        "Kd 0.5\n"
+        "newmtl good\n"
+        "Kd 0.5\n"
+        "newmtl bad\n"
+        "Kd x\n"
+        "newmtl good\n"
+        "Ns 4";
+    struct WavefrontMTLIndex index;
+    int result = wavefrontMTLIndexCompose(&index, input, sizeof(input) - 1, 
+# 1307 "src/wavefront_material_parser_test.c" 3 4
+                                                                           ((void *)0)
+# 1307 "src/wavefront_material_parser_test.c"
+                                                                               );
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1308, _a, _b);} } while(0);
+    do { long long _a=(long long)(index.entryCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1309, _a, _b);} } while(0);
+
+    int material = 0;
+    result = wavefrontMTLIndexFind(&index, "bad", &material);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1313, _a, _b);} } while(0);
+    do { long long _a=(long long)(material), _b=(long long)(-1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1314, _a, _b);} } while(0);
+    do { long long _a=(long long)(index.mtl.materialCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1315, _a, _b);} } while(0);
+
+    result = wavefrontMTLIndexFind(&index, "good", &material);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1318, _a, _b);} } while(0);
+    do { long long _a=(long long)(material), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1319, _a, _b);} } while(0);
+    do { double _a=(index.mtl.materials[0].diffuse.r), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1320, _a, _b);} } while(0);
+    do { double _a=(index.mtl.materials[0].specularExponent), _b=(4); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1321, _a, _b);} } while(0);
+    wavefrontMTLIndexRelease(&index);
+}
+
+void testReload(unsigned int flags) {
+    char before[] =
+        "newmtl kept\n"
+        "Kd 0.5\n"
+        "map_Kd kept.png\n"
+        "newmtl changed\n"
+        "Kd 0.5\n"
+        "newmtl removed\n"
+        "newmtl renamed\n"
+        "map_Kn normal.png\n";
+    char after[] =
+        "newmtl added\n"
+        "map_Kd added.png\n"
+        "newmtl renamed_new\n"
+        "map_Kn normal.png\n"
+        "newmtl changed\n"
+        "Kd 0.75\n"
+        "map_Kd kept.png\n"
+        "newmtl kept\n"
+        "Kd 0.5\n"
+        "map_Kd kept.png\n";
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromBuffer(&mtl, before, sizeof(before) - 1, &options);
+
+    struct WavefrontMTLChanges changes;
+    int result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1353, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(6); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1354, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[0].name), *_b=("kept"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1355, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { const char *_a=(mtl.materials[1].name), *_b=("changed"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1356, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { double _a=(mtl.materials[1].diffuse.r), _b=(0.75); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1357, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[1].diffuseMap.file), *_b=("kept.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1358, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+    do { long long _a=(long long)(mtl.materials[1].diffuseMap.texture), _b=(long long)(mtl.materials[0].diffuseMap.texture); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1359, _a, _b);} } while(0);
+
+    do { long long _a=(long long)(mtl.materials[2].name == 
+# 1361 "src/wavefront_material_parser_test.c" 3 4
+   ((void *)0)
+# 1361 "src/wavefront_material_parser_test.c"
+   ), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1361, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materials[3].normalMap.file == 
+# 1362 "src/wavefront_material_parser_test.c" 3 4
+   ((void *)0)
+# 1362 "src/wavefront_material_parser_test.c"
+   ), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1362, _a, _b);} } while(0);
+    do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "removed")), _b=(long long)(-1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1363, _a, _b);} } while(0);
+    do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "renamed")), _b=(long long)(-1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1364, _a, _b);} } while(0);
+    do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "kept")), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1365, _a, _b);} } while(0);
+    do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "added")), _b=(long long)(4); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1366, _a, _b);} } while(0);
+    do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "renamed_new")), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1367, _a, _b);} } while(0);
+    do { const char *_a=(mtl.materials[4].diffuseMap.file), *_b=("added.png"); if(_a && _b && strcmp(_a,_b)==0) asserts_passed++; else { asserts_failed++; printf("%s:%d: \"%s\" != \"%s\"\n", "src/wavefront_material_parser_test.c", 1368, _a?_a:"(null)", _b?_b:"(null)");} } while(0);
+
+    do { long long _a=(long long)(changes.changedCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1370, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.changed[0]), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1371, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.removedCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1372, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.removed[0]), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1373, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.removed[1]), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1374, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.addedCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1375, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.added[0]), _b=(long long)(4); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1376, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.added[1]), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1377, _a, _b);} } while(0);
+    wavefrontMTLChangesRelease(&changes);
+
+
+    result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+    do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1382, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.addedCount + changes.removedCount + changes.changedCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1383, _a, _b);} } while(0);
+    wavefrontMTLChangesRelease(&changes);
+
+
+
+    for(unsigned int i = 0; i < 4; i++) {
+        result = wavefrontMTLReload(&mtl, before, sizeof(before) - 1, &changes);
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1390, _a, _b);} } while(0);
+        do { long long _a=(long long)(mtl.materialCount), _b=(long long)(6); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1391, _a, _b);} } while(0);
+        do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "kept")), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1392, _a, _b);} } while(0);
+        do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "removed")), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1393, _a, _b);} } while(0);
+        do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "renamed")), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1394, _a, _b);} } while(0);
+        do { long long _a=(long long)(changes.addedCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1395, _a, _b);} } while(0);
+        do { long long _a=(long long)(changes.added[0]), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1396, _a, _b);} } while(0);
+        do { long long _a=(long long)(changes.added[1]), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1397, _a, _b);} } while(0);
+        do { long long _a=(long long)(changes.removedCount), _b=(long long)(2); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1398, _a, _b);} } while(0);
+        do { long long _a=(long long)(changes.removed[0]), _b=(long long)(4); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1399, _a, _b);} } while(0);
+        do { long long _a=(long long)(changes.removed[1]), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1400, _a, _b);} } while(0);
+        wavefrontMTLChangesRelease(&changes);
+        result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, 
+# 1402 "src/wavefront_material_parser_test.c" 3 4
+                                                                   ((void *)0)
+# 1402 "src/wavefront_material_parser_test.c"
+                                                                       );
+        do { long long _a=(long long)(result), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1403, _a, _b);} } while(0);
+        do { long long _a=(long long)(mtl.materialCount), _b=(long long)(6); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1404, _a, _b);} } while(0);
+        do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "added")), _b=(long long)(4); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1405, _a, _b);} } while(0);
+        do { long long _a=(long long)(wavefrontMTLFindMaterial(&mtl, "renamed_new")), _b=(long long)(5); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1406, _a, _b);} } while(0);
+    }
+    wavefrontMTLRelease(&mtl);
+}
+
+void testReloadParseError() {
+    char before[] = "newmtl kept\nKd 0.5\n";
+    char after[] = "newmtl kept\nKd x\n";
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromString(&mtl, before);
+    struct WavefrontMTLChanges changes;
+    int result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+    do { long long _a=(long long)(result), _b=(long long)(3); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1418, _a, _b);} } while(0);
+    do { long long _a=(long long)(changes.changedCount), _b=(long long)(0); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1419, _a, _b);} } while(0);
+    do { long long _a=(long long)(mtl.materialCount), _b=(long long)(1); if(_a==_b) asserts_passed++; else { asserts_failed++; printf("%s:%d: %lld != %lld\n", "src/wavefront_material_parser_test.c", 1420, _a, _b);} } while(0);
+    do { double _a=(mtl.materials[0].diffuse.r), _b=(0.5); if((_a-_b) < 0.0001 && (_b-_a) < 0.0001) asserts_passed++; else { asserts_failed++; printf("%s:%d: %f != %f\n", "src/wavefront_material_parser_test.c", 1421, _a, _b);} } while(0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void wavefrontMaterialParserTest() {
+    testParseNewMaterial();
+    testParseNewMaterialNoName();
+    testParseNewMaterialGarbage();
+
+    testParseAmbientRGB();
+    testParseAmbientRGBOnlyR();
+    testParseAmbientRGBOnlyREmptyG();
+    testParseAmbientRGBOnlyRG();
+    testParseAmbientRGBOnlyRGEmptyB();
+    testParseAmbientRGBGarbage();
+
+    testParseDiffuseRGB();
+    testParseDiffuseRGBOnlyR();
+    testParseDiffuseRGBOnlyRG();
+    testParseDiffuseRGBGarbage();
+
+    testParseSpecularRGB();
+    testParseSpecularRGBOnlyR();
+    testParseSpecularRGBOnlyRG();
+    testParseSpecularRGBGarbage();
+
+    testParseTransmissionRGB();
+    testParseTransmissionRGBOnlyR();
+    testParseTransmissionRGBOnlyRG();
+    testParseTransmissionRGBGarbage();
+
+    testParseComment();
+
+    testParseIllumination();
+    testParseIlluminationMissingNumber();
+    testParseIlluminationEmptyNumber();
+    testParseIlluminationInvalidNumber();
+    testParseIlluminationIgnoresGarbage();
+
+    testParseSpecularExponent();
+
+    testParseReflectionMapSphere();
+    testParseReflectionMapCube();
+    testParseMapOptions();
+    testParseMapOptionsReplaced();
+    testParseMapOptionsGarbage();
+    testParseAllMaps();
+    testParseBumpSpellings();
+    testParsePhysicallyBased();
+
+    testParseBlenderWavefrontMaterial();
+    testParseGuruWavefrontMaterial();
+
+    testParseBufferNotTerminated();
+    testParseReservesMaterials();
+    testParseArena();
+    testParseSharedTextures();
+    testParseCarriageReturns();
+    testParseLongLines();
+    testParseChunked();
+    testParseChunkedError();
+    testParseFile();
+    testParseFilePageSized();
+    testParseFileEmpty();
+    testParseFileMissing();
+    testParseParallel(0);
+    testParseParallel(0x1);
+    testParseParallelTextureOrder();
+    testParseParallelError();
+    testParseTolerant();
+    testParseTolerantFull();
+    testParseTolerantChunked();
+    testParseTolerantParallel();
+    testParseStats();
+    testParseStatsParallel();
+    testParseBatch();
+    testIndex();
+    testIndexParseError();
+    testReload(0);
+    testReload(0x1);
+    testReloadParseError();
+    testParseDuplicateMaterial();
+    testParsePropertyBeforeMaterial();
+}
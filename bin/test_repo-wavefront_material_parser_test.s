@@ -0,0 +1,14954 @@
+	.file	"wavefront_material_parser_test.c"
+	.text
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"src/wavefront_material_parser_test.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"%s:%d: %lld != %lld\n"
+.LC2:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+	.text
+	.p2align 4
+	.type	assertDiagnostic, @function
+assertDiagnostic:
+.LFB80:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%ecx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	(%rdi), %rcx
+	movq	%rdi, %rbx
+	cmpq	%rsi, %rcx
+	jne	.L2
+	addl	$1, asserts_passed(%rip)
+.L3:
+	leaq	16(%rbx), %r14
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L25
+	movq	%r13, %r8
+	movq	%r14, %rcx
+	movl	$1008, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	32(%rbx), %ecx
+	movl	%r12d, %r8d
+	cmpq	%r8, %rcx
+	jne	.L6
+.L27:
+	addl	$1, asserts_passed(%rip)
+.L7:
+	movq	8(%rbx), %rdi
+	leaq	tolerantInput(%rip), %rsi
+	leaq	(%rsi,%rdi), %r12
+	cmpq	%r12, %rsi
+	jnb	.L14
+	leaq	1(%rsi), %rcx
+	movq	%r12, %rdx
+	movq	%rsi, %rax
+	subq	%rcx, %rdx
+	cmpq	$14, %rdx
+	jbe	.L15
+	pxor	%xmm4, %xmm4
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	movq	%rdi, %rdx
+	andq	$-16, %rdx
+	movdqa	.LC4(%rip), %xmm7
+	pxor	%xmm3, %xmm3
+	movdqa	.LC3(%rip), %xmm8
+	addq	%rsi, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	movdqa	%xmm8, %xmm0
+	addq	$16, %rax
+	pcmpeqb	-16(%rax), %xmm0
+	pand	%xmm7, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm5, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm5, %xmm2
+	punpcklwd	%xmm5, %xmm9
+	punpcklwd	%xmm5, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckhdq	%xmm3, %xmm2
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckhdq	%xmm3, %xmm9
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rax, %rdx
+	jne	.L10
+	movdqa	%xmm4, %xmm0
+	movq	%rdi, %rax
+	psrldq	$8, %xmm0
+	andq	$-16, %rax
+	paddq	%xmm0, %xmm4
+	addq	%rsi, %rax
+	movq	%xmm4, %rcx
+	addq	$1, %rcx
+	testb	$15, %dil
+	je	.L11
+.L9:
+	xorl	%edx, %edx
+	cmpb	$10, (%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	1(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 1(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	2(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 2(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	3(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 3(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	4(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 4(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	5(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 5(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	6(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 6(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	7(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 7(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	8(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 8(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	9(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 9(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	10(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 10(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	11(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 11(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	12(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 12(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	13(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	xorl	%edx, %edx
+	cmpb	$10, 13(%rax)
+	sete	%dl
+	addq	%rdx, %rcx
+	leaq	14(%rax), %rdx
+	cmpq	%r12, %rdx
+	jnb	.L11
+	cmpb	$10, 14(%rax)
+	sete	%al
+	movzbl	%al, %eax
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	cmpq	%rcx, %rbp
+	jne	.L8
+	addl	$1, asserts_passed(%rip)
+.L12:
+	testq	%rdi, %rdi
+	je	.L13
+	cmpb	$10, -1(%r12)
+	jne	.L26
+.L13:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addl	$1, asserts_passed(%rip)
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.cfi_restore_state
+	movl	32(%rbx), %ecx
+	movl	%r12d, %r8d
+	addl	$1, asserts_passed(%rip)
+	cmpq	%r8, %rcx
+	je	.L27
+.L6:
+	movl	$1009, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L7
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	addl	$1, asserts_failed(%rip)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	movl	$1015, %edx
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	jmp	printf@PLT
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+	movl	$1, %ecx
+.L8:
+	leaq	.LC1(%rip), %rdi
+	movq	%rbp, %r8
+	movl	$1014, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	8(%rbx), %rdi
+	jmp	.L12
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	movq	%rsi, %r8
+	movl	$1007, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L3
+.L15:
+	movl	$1, %ecx
+	jmp	.L9
+	.cfi_endproc
+.LFE80:
+	.size	assertDiagnostic, .-assertDiagnostic
+	.section	.rodata.str1.1
+.LC5:
+	.string	"Ka"
+.LC6:
+	.string	"map_Kd"
+.LC7:
+	.string	"Ks"
+.LC8:
+	.string	"refl"
+.LC9:
+	.string	"Tf"
+	.text
+	.p2align 4
+	.type	assertTolerantDiagnostics, @function
+assertTolerantDiagnostics:
+.LFB81:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	16(%rdi), %rcx
+	movq	%rdi, %rbx
+	cmpq	$5, %rcx
+	jne	.L29
+	movl	12(%rbx), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$5, %rcx
+	jne	.L31
+.L34:
+	addl	$1, asserts_passed(%rip)
+.L32:
+	movq	(%rbx), %rdi
+	movl	$1, %ecx
+	movl	$4, %esi
+	leaq	.LC5(%rip), %rdx
+	call	assertDiagnostic
+	movq	(%rbx), %rax
+	movl	$3, %ecx
+	leaq	.LC6(%rip), %rdx
+	movl	$6, %esi
+	leaq	40(%rax), %rdi
+	call	assertDiagnostic
+	movq	(%rbx), %rax
+	movl	$2, %ecx
+	leaq	.LC7(%rip), %rdx
+	movl	$8, %esi
+	leaq	80(%rax), %rdi
+	call	assertDiagnostic
+	movq	(%rbx), %rax
+	movl	$3, %ecx
+	leaq	.LC8(%rip), %rdx
+	movl	$10, %esi
+	leaq	120(%rax), %rdi
+	call	assertDiagnostic
+	movq	(%rbx), %rdi
+	xorl	%ecx, %ecx
+	movl	$12, %esi
+	leaq	.LC9(%rip), %rdx
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	addq	$160, %rdi
+	jmp	assertDiagnostic
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore_state
+	movl	$5, %r8d
+	movl	$1019, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	12(%rbx), %ecx
+	cmpq	$5, %rcx
+	je	.L34
+.L31:
+	movl	$5, %r8d
+	movl	$1020, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L32
+	.cfi_endproc
+.LFE81:
+	.size	assertTolerantDiagnostics, .-assertTolerantDiagnostics
+	.section	.rodata.str1.1
+.LC10:
+	.string	"(null)"
+.LC13:
+	.string	"%s:%d: %f != %f\n"
+.LC15:
+	.string	"diffuse.png"
+.LC16:
+	.string	"sphere.png"
+	.text
+	.p2align 4
+	.type	assertTolerantLibrary.part.0, @function
+assertTolerantLibrary.part.0:
+.LFB95:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movsd	.LC11(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movsd	.LC12(%rip), %xmm3
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	(%rdi), %rbx
+	cvtss2sd	12(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L36
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm3
+	ja	.L72
+.L36:
+	movl	$1033, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	0(%rbp), %rbx
+.L39:
+	movsd	.LC14(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm4
+	cvtss2sd	32(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L40
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	ja	.L73
+.L40:
+	movl	$1034, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	0(%rbp), %rbx
+	movq	152(%rbx), %r12
+	testq	%r12, %r12
+	je	.L44
+.L77:
+	leaq	.LC15(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L74
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L47:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$1035, %edx
+	xorl	%eax, %eax
+	leaq	.LC15(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	0(%rbp), %rbx
+	movl	164(%rbx), %ecx
+	testq	%rcx, %rcx
+	jne	.L48
+.L75:
+	movq	736(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L50
+.L76:
+	leaq	.LC16(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L51
+	addl	$1, asserts_passed(%rip)
+.L52:
+	movsd	.LC12(%rip), %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	508(%rbx), %xmm0
+	comisd	%xmm0, %xmm5
+	jbe	.L54
+	pxor	%xmm1, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm5
+	jbe	.L54
+	addl	$1, asserts_passed(%rip)
+.L57:
+	movsd	.LC18(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm6
+	cvtss2sd	544(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L58
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L58
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	addl	$1, asserts_passed(%rip)
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.cfi_restore_state
+	movl	164(%rbx), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	je	.L75
+.L48:
+	xorl	%r8d, %r8d
+	movl	$1036, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	0(%rbp), %rbx
+	movq	736(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L76
+.L50:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L53
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	movq	152(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	jne	.L77
+.L44:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L47
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L39
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	addl	$1, asserts_failed(%rip)
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movl	$1039, %edx
+	movl	$2, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	printf@PLT
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.cfi_restore_state
+	pxor	%xmm1, %xmm1
+	movl	$1038, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	0(%rbp), %rbx
+	jmp	.L57
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L53:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$1037, %edx
+	xorl	%eax, %eax
+	leaq	.LC16(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	0(%rbp), %rbx
+	jmp	.L52
+	.cfi_endproc
+.LFE95:
+	.size	assertTolerantLibrary.part.0, .-assertTolerantLibrary.part.0
+	.section	.rodata.str1.1
+.LC19:
+	.string	"new_material"
+	.text
+	.p2align 4
+	.globl	testParseNewMaterial
+	.type	testParseNewMaterial, @function
+testParseNewMaterial:
+.LFB22:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC20(%rip), %xmm0
+	leaq	32(%rsp), %rbp
+	movq	%rsp, %rsi
+	movl	$7102825, 16(%rsp)
+	movq	%rbp, %rdi
+	movaps	%xmm0, (%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L79
+	addl	$1, asserts_passed(%rip)
+.L80:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L81
+	movq	32(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movq	(%rax), %rbx
+	testq	%rbx, %rbx
+	je	.L83
+.L89:
+	leaq	.LC19(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L88
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L86:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$14, %edx
+	xorl	%eax, %eax
+	leaq	.LC19(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L85:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L85
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	movl	$1, %r8d
+	movl	$13, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	32(%rsp), %rax
+	movq	(%rax), %rbx
+	testq	%rbx, %rbx
+	jne	.L89
+.L83:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L86
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	xorl	%r8d, %r8d
+	movl	$12, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L80
+	.cfi_endproc
+.LFE22:
+	.size	testParseNewMaterial, .-testParseNewMaterial
+	.p2align 4
+	.globl	testParseNewMaterialNoName
+	.type	testParseNewMaterialNoName, @function
+testParseNewMaterialNoName:
+.LFB23:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 144
+	leaq	16(%rsp), %rbx
+	leaq	9(%rsp), %rsi
+	movl	$1836541294, 9(%rsp)
+	movq	%rbx, %rdi
+	movl	$7107693, 12(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L91
+	movl	24(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L93
+.L96:
+	movq	%rbx, %rdi
+	addl	$1, asserts_passed(%rip)
+	call	wavefrontMTLRelease@PLT
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$22, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	24(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L96
+.L93:
+	xorl	%r8d, %r8d
+	movl	$23, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	subq	$-128, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	testParseNewMaterialNoName, .-testParseNewMaterialNoName
+	.p2align 4
+	.globl	testParseNewMaterialGarbage
+	.type	testParseNewMaterialGarbage, @function
+testParseNewMaterialGarbage:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$144, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm0
+	leaq	32(%rsp), %rbx
+	movq	%rsp, %rsi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC21(%rip), %xmm0
+	movq	%rbx, %rdi
+	movups	%xmm0, 9(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L98
+	movl	40(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L100
+.L103:
+	addl	$1, asserts_passed(%rip)
+.L101:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$144, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$31, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	40(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L103
+.L100:
+	xorl	%r8d, %r8d
+	movl	$32, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L101
+	.cfi_endproc
+.LFE24:
+	.size	testParseNewMaterialGarbage, .-testParseNewMaterialGarbage
+	.p2align 4
+	.globl	testParseAmbientRGB
+	.type	testParseAmbientRGB, @function
+testParseAmbientRGB:
+.LFB25:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	64(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC26(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movl	$3616304, 47(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L105
+	addl	$1, asserts_passed(%rip)
+.L106:
+	movl	72(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L107
+	addl	$1, asserts_passed(%rip)
+.L108:
+	movq	64(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	8(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	16(%rax), %xmm5
+	movss	20(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	12(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L109
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L134
+.L109:
+	movl	$44, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+.L112:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L113
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L135
+.L113:
+	movl	$45, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L116:
+	movsd	.LC24(%rip), %xmm1
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L117
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L136
+.L117:
+	movl	$46, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L120:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L121
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L137
+.L121:
+	movl	$47, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L120
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L116
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L112
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movl	$1, %r8d
+	movl	$42, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L108
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	xorl	%r8d, %r8d
+	movl	$41, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L106
+	.cfi_endproc
+.LFE25:
+	.size	testParseAmbientRGB, .-testParseAmbientRGB
+	.p2align 4
+	.globl	testParseAmbientRGBOnlyR
+	.type	testParseAmbientRGBOnlyR, @function
+testParseAmbientRGBOnlyR:
+.LFB26:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC27(%rip), %xmm0
+	movups	%xmm0, 27(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L139
+	addl	$1, asserts_passed(%rip)
+.L140:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L141
+	addl	$1, asserts_passed(%rip)
+.L142:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	8(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	16(%rax), %xmm5
+	movss	20(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	12(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L143
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L168
+.L143:
+	movl	$58, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L146:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L147
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L169
+.L147:
+	movl	$59, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L150:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L151
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L170
+.L151:
+	movl	$60, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L154:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L155
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L171
+.L155:
+	movl	$61, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L154
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L146
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	movl	$1, %r8d
+	movl	$56, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L142
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	xorl	%r8d, %r8d
+	movl	$55, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L140
+	.cfi_endproc
+.LFE26:
+	.size	testParseAmbientRGBOnlyR, .-testParseAmbientRGBOnlyR
+	.p2align 4
+	.globl	testParseAmbientRGBOnlyREmptyG
+	.type	testParseAmbientRGBOnlyREmptyG, @function
+testParseAmbientRGBOnlyREmptyG:
+.LFB27:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC28(%rip), %xmm0
+	movups	%xmm0, 28(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L173
+	addl	$1, asserts_passed(%rip)
+.L174:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L175
+	addl	$1, asserts_passed(%rip)
+.L176:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	8(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	16(%rax), %xmm5
+	movss	20(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	12(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L177
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L202
+.L177:
+	movl	$72, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L180:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L181
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L203
+.L181:
+	movl	$73, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L184:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L185
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L204
+.L185:
+	movl	$74, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L188:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L189
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L205
+.L189:
+	movl	$75, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L188
+	.p2align 4,,10
+	.p2align 3
+.L203:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L184
+	.p2align 4,,10
+	.p2align 3
+.L202:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L180
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movl	$1, %r8d
+	movl	$70, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	xorl	%r8d, %r8d
+	movl	$69, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L174
+	.cfi_endproc
+.LFE27:
+	.size	testParseAmbientRGBOnlyREmptyG, .-testParseAmbientRGBOnlyREmptyG
+	.p2align 4
+	.globl	testParseAmbientRGBOnlyRG
+	.type	testParseAmbientRGBOnlyRG, @function
+testParseAmbientRGBOnlyRG:
+.LFB28:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC29(%rip), %xmm0
+	movups	%xmm0, 31(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L207
+	addl	$1, asserts_passed(%rip)
+.L208:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L209
+	addl	$1, asserts_passed(%rip)
+.L210:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm3
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	8(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	movss	16(%rax), %xmm5
+	movss	20(%rax), %xmm6
+	subsd	%xmm3, %xmm1
+	movss	12(%rax), %xmm4
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm1, %xmm2
+	jbe	.L211
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L236
+.L211:
+	movapd	%xmm3, %xmm1
+	movl	$86, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	movss	%xmm4, 12(%rsp)
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm4
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+.L214:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm4, %xmm0
+	movapd	%xmm0, %xmm4
+	subsd	%xmm1, %xmm4
+	comisd	%xmm4, %xmm2
+	jbe	.L215
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L237
+.L215:
+	movl	$87, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L218:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	%xmm3, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L219
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L238
+.L219:
+	movapd	%xmm3, %xmm1
+	movl	$88, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L222:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L223
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L239
+.L223:
+	movl	$89, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L222
+	.p2align 4,,10
+	.p2align 3
+.L237:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L218
+	.p2align 4,,10
+	.p2align 3
+.L236:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L214
+	.p2align 4,,10
+	.p2align 3
+.L209:
+	movl	$1, %r8d
+	movl	$84, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L210
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	xorl	%r8d, %r8d
+	movl	$83, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L208
+	.cfi_endproc
+.LFE28:
+	.size	testParseAmbientRGBOnlyRG, .-testParseAmbientRGBOnlyRG
+	.p2align 4
+	.globl	testParseAmbientRGBOnlyRGEmptyB
+	.type	testParseAmbientRGBOnlyRGEmptyB, @function
+testParseAmbientRGBOnlyRGEmptyB:
+.LFB29:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC30(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L241
+	addl	$1, asserts_passed(%rip)
+.L242:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L243
+	addl	$1, asserts_passed(%rip)
+.L244:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm3
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	8(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	movss	16(%rax), %xmm5
+	movss	20(%rax), %xmm6
+	subsd	%xmm3, %xmm1
+	movss	12(%rax), %xmm4
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm1, %xmm2
+	jbe	.L245
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L270
+.L245:
+	movapd	%xmm3, %xmm1
+	movl	$100, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	movss	%xmm4, 12(%rsp)
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm4
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+.L248:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm4, %xmm0
+	movapd	%xmm0, %xmm4
+	subsd	%xmm1, %xmm4
+	comisd	%xmm4, %xmm2
+	jbe	.L249
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L271
+.L249:
+	movl	$101, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L252:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	%xmm3, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L253
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L272
+.L253:
+	movapd	%xmm3, %xmm1
+	movl	$102, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L256:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L257
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L273
+.L257:
+	movl	$103, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L273:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L272:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L256
+	.p2align 4,,10
+	.p2align 3
+.L271:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L252
+	.p2align 4,,10
+	.p2align 3
+.L270:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L248
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	movl	$1, %r8d
+	movl	$98, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L244
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	xorl	%r8d, %r8d
+	movl	$97, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L242
+	.cfi_endproc
+.LFE29:
+	.size	testParseAmbientRGBOnlyRGEmptyB, .-testParseAmbientRGBOnlyRGEmptyB
+	.p2align 4
+	.globl	testParseAmbientRGBGarbage
+	.type	testParseAmbientRGBGarbage, @function
+testParseAmbientRGBGarbage:
+.LFB30:
+	.cfi_startproc
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC20(%rip), %xmm0
+	movabsq	$28820894338004782, %rax
+	movq	%rsp, %rsi
+	leaq	48(%rsp), %rdi
+	movq	%rax, 32(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC26(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	cmpl	$3, %eax
+	jne	.L275
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L275:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$3, %r8d
+	xorl	%eax, %eax
+	movl	$111, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	testParseAmbientRGBGarbage, .-testParseAmbientRGBGarbage
+	.p2align 4
+	.globl	testParseDiffuseRGB
+	.type	testParseDiffuseRGB, @function
+testParseDiffuseRGB:
+.LFB31:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	64(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC31(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movl	$3616304, 47(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L279
+	addl	$1, asserts_passed(%rip)
+.L280:
+	movl	72(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L281
+	addl	$1, asserts_passed(%rip)
+.L282:
+	movq	64(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	32(%rax), %xmm5
+	movss	36(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	28(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L283
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L308
+.L283:
+	movl	$122, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+.L286:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L287
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L309
+.L287:
+	movl	$123, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L290:
+	movsd	.LC24(%rip), %xmm1
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L291
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L310
+.L291:
+	movl	$124, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L294:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L295
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L311
+.L295:
+	movl	$125, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L311:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L310:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L294
+	.p2align 4,,10
+	.p2align 3
+.L309:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L290
+	.p2align 4,,10
+	.p2align 3
+.L308:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L286
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	movl	$1, %r8d
+	movl	$120, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L282
+	.p2align 4,,10
+	.p2align 3
+.L279:
+	xorl	%r8d, %r8d
+	movl	$119, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L280
+	.cfi_endproc
+.LFE31:
+	.size	testParseDiffuseRGB, .-testParseDiffuseRGB
+	.p2align 4
+	.globl	testParseDiffuseRGBOnlyR
+	.type	testParseDiffuseRGBOnlyR, @function
+testParseDiffuseRGBOnlyR:
+.LFB32:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC32(%rip), %xmm0
+	movups	%xmm0, 27(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L313
+	addl	$1, asserts_passed(%rip)
+.L314:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L315
+	addl	$1, asserts_passed(%rip)
+.L316:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	32(%rax), %xmm5
+	movss	36(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	28(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L317
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L342
+.L317:
+	movl	$136, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L320:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L321
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L343
+.L321:
+	movl	$137, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L324:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L325
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L344
+.L325:
+	movl	$138, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L328:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L329
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L345
+.L329:
+	movl	$139, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L345:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L344:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L328
+	.p2align 4,,10
+	.p2align 3
+.L343:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L324
+	.p2align 4,,10
+	.p2align 3
+.L342:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L320
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	movl	$1, %r8d
+	movl	$134, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L316
+	.p2align 4,,10
+	.p2align 3
+.L313:
+	xorl	%r8d, %r8d
+	movl	$133, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L314
+	.cfi_endproc
+.LFE32:
+	.size	testParseDiffuseRGBOnlyR, .-testParseDiffuseRGBOnlyR
+	.p2align 4
+	.globl	testParseDiffuseRGBOnlyRG
+	.type	testParseDiffuseRGBOnlyRG, @function
+testParseDiffuseRGBOnlyRG:
+.LFB33:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC33(%rip), %xmm0
+	movups	%xmm0, 31(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L347
+	addl	$1, asserts_passed(%rip)
+.L348:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L349
+	addl	$1, asserts_passed(%rip)
+.L350:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm3
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	movss	32(%rax), %xmm5
+	movss	36(%rax), %xmm6
+	subsd	%xmm3, %xmm1
+	movss	28(%rax), %xmm4
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm1, %xmm2
+	jbe	.L351
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L376
+.L351:
+	movapd	%xmm3, %xmm1
+	movl	$150, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	movss	%xmm4, 12(%rsp)
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm4
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+.L354:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm4, %xmm0
+	movapd	%xmm0, %xmm4
+	subsd	%xmm1, %xmm4
+	comisd	%xmm4, %xmm2
+	jbe	.L355
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L377
+.L355:
+	movl	$151, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L358:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	%xmm3, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L359
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L378
+.L359:
+	movapd	%xmm3, %xmm1
+	movl	$152, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L362:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L363
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L379
+.L363:
+	movl	$153, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L378:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L362
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L358
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L354
+	.p2align 4,,10
+	.p2align 3
+.L349:
+	movl	$1, %r8d
+	movl	$148, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L350
+	.p2align 4,,10
+	.p2align 3
+.L347:
+	xorl	%r8d, %r8d
+	movl	$147, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L348
+	.cfi_endproc
+.LFE33:
+	.size	testParseDiffuseRGBOnlyRG, .-testParseDiffuseRGBOnlyRG
+	.p2align 4
+	.globl	testParseDiffuseRGBGarbage
+	.type	testParseDiffuseRGBGarbage, @function
+testParseDiffuseRGBGarbage:
+.LFB34:
+	.cfi_startproc
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC20(%rip), %xmm0
+	movabsq	$28820894338004782, %rax
+	movq	%rsp, %rsi
+	leaq	48(%rsp), %rdi
+	movq	%rax, 32(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC31(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	cmpl	$3, %eax
+	jne	.L381
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$3, %r8d
+	xorl	%eax, %eax
+	movl	$161, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	testParseDiffuseRGBGarbage, .-testParseDiffuseRGBGarbage
+	.p2align 4
+	.globl	testParseSpecularRGB
+	.type	testParseSpecularRGB, @function
+testParseSpecularRGB:
+.LFB35:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	64(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC34(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movl	$3616304, 47(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L385
+	addl	$1, asserts_passed(%rip)
+.L386:
+	movl	72(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L387
+	addl	$1, asserts_passed(%rip)
+.L388:
+	movq	64(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	40(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	48(%rax), %xmm5
+	movss	52(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	44(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L389
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L414
+.L389:
+	movl	$172, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+.L392:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L393
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L415
+.L393:
+	movl	$173, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L396:
+	movsd	.LC24(%rip), %xmm1
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L397
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L416
+.L397:
+	movl	$174, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L400:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L401
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L417
+.L401:
+	movl	$175, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L417:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L416:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L400
+	.p2align 4,,10
+	.p2align 3
+.L415:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L396
+	.p2align 4,,10
+	.p2align 3
+.L414:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L392
+	.p2align 4,,10
+	.p2align 3
+.L387:
+	movl	$1, %r8d
+	movl	$170, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L388
+	.p2align 4,,10
+	.p2align 3
+.L385:
+	xorl	%r8d, %r8d
+	movl	$169, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L386
+	.cfi_endproc
+.LFE35:
+	.size	testParseSpecularRGB, .-testParseSpecularRGB
+	.p2align 4
+	.globl	testParseSpecularRGBOnlyR
+	.type	testParseSpecularRGBOnlyR, @function
+testParseSpecularRGBOnlyR:
+.LFB36:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC35(%rip), %xmm0
+	movups	%xmm0, 27(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L419
+	addl	$1, asserts_passed(%rip)
+.L420:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L421
+	addl	$1, asserts_passed(%rip)
+.L422:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	40(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	48(%rax), %xmm5
+	movss	52(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	44(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L423
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L448
+.L423:
+	movl	$186, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L426:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L427
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L449
+.L427:
+	movl	$187, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L430:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L431
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L450
+.L431:
+	movl	$188, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L434:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L435
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L451
+.L435:
+	movl	$189, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L451:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L450:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L434
+	.p2align 4,,10
+	.p2align 3
+.L449:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L430
+	.p2align 4,,10
+	.p2align 3
+.L448:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L426
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	movl	$1, %r8d
+	movl	$184, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L422
+	.p2align 4,,10
+	.p2align 3
+.L419:
+	xorl	%r8d, %r8d
+	movl	$183, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L420
+	.cfi_endproc
+.LFE36:
+	.size	testParseSpecularRGBOnlyR, .-testParseSpecularRGBOnlyR
+	.p2align 4
+	.globl	testParseSpecularRGBOnlyRG
+	.type	testParseSpecularRGBOnlyRG, @function
+testParseSpecularRGBOnlyRG:
+.LFB37:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC36(%rip), %xmm0
+	movups	%xmm0, 31(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L453
+	addl	$1, asserts_passed(%rip)
+.L454:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L455
+	addl	$1, asserts_passed(%rip)
+.L456:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm3
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	40(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	movss	48(%rax), %xmm5
+	movss	52(%rax), %xmm6
+	subsd	%xmm3, %xmm1
+	movss	44(%rax), %xmm4
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm1, %xmm2
+	jbe	.L457
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L482
+.L457:
+	movapd	%xmm3, %xmm1
+	movl	$200, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	movss	%xmm4, 12(%rsp)
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm4
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+.L460:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm4, %xmm0
+	movapd	%xmm0, %xmm4
+	subsd	%xmm1, %xmm4
+	comisd	%xmm4, %xmm2
+	jbe	.L461
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L483
+.L461:
+	movl	$201, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L464:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	%xmm3, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L465
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L484
+.L465:
+	movapd	%xmm3, %xmm1
+	movl	$202, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L468:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L469
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L485
+.L469:
+	movl	$203, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L485:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L484:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L468
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L464
+	.p2align 4,,10
+	.p2align 3
+.L482:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L460
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	movl	$1, %r8d
+	movl	$198, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L456
+	.p2align 4,,10
+	.p2align 3
+.L453:
+	xorl	%r8d, %r8d
+	movl	$197, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L454
+	.cfi_endproc
+.LFE37:
+	.size	testParseSpecularRGBOnlyRG, .-testParseSpecularRGBOnlyRG
+	.p2align 4
+	.globl	testParseSpecularRGBGarbage
+	.type	testParseSpecularRGBGarbage, @function
+testParseSpecularRGBGarbage:
+.LFB38:
+	.cfi_startproc
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC20(%rip), %xmm0
+	movabsq	$28820894338004782, %rax
+	movq	%rsp, %rsi
+	leaq	48(%rsp), %rdi
+	movq	%rax, 32(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC34(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	cmpl	$3, %eax
+	jne	.L487
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L487:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$3, %r8d
+	xorl	%eax, %eax
+	movl	$211, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	testParseSpecularRGBGarbage, .-testParseSpecularRGBGarbage
+	.p2align 4
+	.globl	testParseTransmissionRGB
+	.type	testParseTransmissionRGB, @function
+testParseTransmissionRGB:
+.LFB39:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	64(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC37(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movl	$3616304, 47(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L491
+	addl	$1, asserts_passed(%rip)
+.L492:
+	movl	72(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L493
+	addl	$1, asserts_passed(%rip)
+.L494:
+	movq	64(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	56(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	64(%rax), %xmm5
+	movss	68(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	60(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L495
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L520
+.L495:
+	movl	$223, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+.L498:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L499
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L521
+.L499:
+	movl	$224, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L502:
+	movsd	.LC24(%rip), %xmm1
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L503
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L522
+.L503:
+	movl	$225, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L506:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L507
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L523
+.L507:
+	movl	$226, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L523:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L522:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L506
+	.p2align 4,,10
+	.p2align 3
+.L521:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L502
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L498
+	.p2align 4,,10
+	.p2align 3
+.L493:
+	movl	$1, %r8d
+	movl	$221, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L494
+	.p2align 4,,10
+	.p2align 3
+.L491:
+	xorl	%r8d, %r8d
+	movl	$220, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L492
+	.cfi_endproc
+.LFE39:
+	.size	testParseTransmissionRGB, .-testParseTransmissionRGB
+	.p2align 4
+	.globl	testParseTransmissionRGBOnlyR
+	.type	testParseTransmissionRGBOnlyR, @function
+testParseTransmissionRGBOnlyR:
+.LFB40:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC38(%rip), %xmm0
+	movups	%xmm0, 27(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L525
+	addl	$1, asserts_passed(%rip)
+.L526:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L527
+	addl	$1, asserts_passed(%rip)
+.L528:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	56(%rax), %xmm0
+	movapd	%xmm0, %xmm4
+	movss	64(%rax), %xmm5
+	movss	68(%rax), %xmm6
+	subsd	%xmm1, %xmm4
+	movss	60(%rax), %xmm3
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm4, %xmm2
+	jbe	.L529
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L554
+.L529:
+	movl	$237, %edx
+	movl	$2, %eax
+	leaq	.LC0(%rip), %rsi
+	movss	%xmm3, 12(%rsp)
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm3
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L532:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L533
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L555
+.L533:
+	movl	$238, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm1
+.L536:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L537
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L556
+.L537:
+	movl	$239, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L540:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L541
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L557
+.L541:
+	movl	$240, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L557:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L556:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L540
+	.p2align 4,,10
+	.p2align 3
+.L555:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L536
+	.p2align 4,,10
+	.p2align 3
+.L554:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L532
+	.p2align 4,,10
+	.p2align 3
+.L527:
+	movl	$1, %r8d
+	movl	$235, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L528
+	.p2align 4,,10
+	.p2align 3
+.L525:
+	xorl	%r8d, %r8d
+	movl	$234, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L526
+	.cfi_endproc
+.LFE40:
+	.size	testParseTransmissionRGBOnlyR, .-testParseTransmissionRGBOnlyR
+	.p2align 4
+	.globl	testParseTransmissionRGBOnlyRG
+	.type	testParseTransmissionRGBOnlyRG, @function
+testParseTransmissionRGBOnlyRG:
+.LFB41:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	leaq	16(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC39(%rip), %xmm0
+	movups	%xmm0, 31(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L559
+	addl	$1, asserts_passed(%rip)
+.L560:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L561
+	addl	$1, asserts_passed(%rip)
+.L562:
+	movq	48(%rsp), %rax
+	movsd	.LC22(%rip), %xmm3
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	56(%rax), %xmm0
+	movapd	%xmm0, %xmm1
+	movss	64(%rax), %xmm5
+	movss	68(%rax), %xmm6
+	subsd	%xmm3, %xmm1
+	movss	60(%rax), %xmm4
+	movd	%xmm5, %ebx
+	movd	%xmm6, %r14d
+	comisd	%xmm1, %xmm2
+	jbe	.L563
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L588
+.L563:
+	movapd	%xmm3, %xmm1
+	movl	$251, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	movss	%xmm4, 12(%rsp)
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movss	12(%rsp), %xmm4
+	movq	%rax, %xmm2
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+.L566:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm4, %xmm0
+	movapd	%xmm0, %xmm4
+	subsd	%xmm1, %xmm4
+	comisd	%xmm4, %xmm2
+	jbe	.L567
+	movapd	%xmm1, %xmm4
+	subsd	%xmm0, %xmm4
+	comisd	%xmm4, %xmm2
+	ja	.L589
+.L567:
+	movl	$252, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC22(%rip), %rax
+	movq	%rax, %xmm3
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L570:
+	movd	%ebx, %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm5, %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	%xmm3, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L571
+	movapd	%xmm3, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L590
+.L571:
+	movapd	%xmm3, %xmm1
+	movl	$253, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L574:
+	movsd	.LC25(%rip), %xmm1
+	movd	%r14d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L575
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L591
+.L575:
+	movl	$254, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L591:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L590:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L574
+	.p2align 4,,10
+	.p2align 3
+.L589:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L570
+	.p2align 4,,10
+	.p2align 3
+.L588:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L566
+	.p2align 4,,10
+	.p2align 3
+.L561:
+	movl	$1, %r8d
+	movl	$249, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L562
+	.p2align 4,,10
+	.p2align 3
+.L559:
+	xorl	%r8d, %r8d
+	movl	$248, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L560
+	.cfi_endproc
+.LFE41:
+	.size	testParseTransmissionRGBOnlyRG, .-testParseTransmissionRGBOnlyRG
+	.p2align 4
+	.globl	testParseTransmissionRGBGarbage
+	.type	testParseTransmissionRGBGarbage, @function
+testParseTransmissionRGBGarbage:
+.LFB42:
+	.cfi_startproc
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC20(%rip), %xmm0
+	movabsq	$28820894338004782, %rax
+	movq	%rsp, %rsi
+	leaq	48(%rsp), %rdi
+	movq	%rax, 32(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC37(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	cmpl	$3, %eax
+	jne	.L593
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L593:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$3, %r8d
+	xorl	%eax, %eax
+	movl	$262, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	testParseTransmissionRGBGarbage, .-testParseTransmissionRGBGarbage
+	.p2align 4
+	.globl	testParseComment
+	.type	testParseComment, @function
+testParseComment:
+.LFB43:
+	.cfi_startproc
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 144
+	movabsq	$7885080994129190947, %rax
+	movq	%rax, 3(%rsp)
+	leaq	3(%rsp), %rsi
+	leaq	16(%rsp), %rdi
+	movabsq	$13075866425585007, %rax
+	movq	%rax, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L597
+	addl	$1, asserts_passed(%rip)
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L597:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$269, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$136, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	testParseComment, .-testParseComment
+	.p2align 4
+	.globl	testParseIllumination
+	.type	testParseIllumination, @function
+testParseIllumination:
+.LFB44:
+	.cfi_startproc
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rsi
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC40(%rip), %xmm0
+	movups	%xmm0, 12(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L601
+	addl	$1, asserts_passed(%rip)
+.L602:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L603
+	addl	$1, asserts_passed(%rip)
+.L604:
+	movq	32(%rsp), %rax
+	movslq	128(%rax), %rcx
+	cmpq	$5, %rcx
+	jne	.L605
+	addl	$1, asserts_passed(%rip)
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L603:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$278, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L604
+	.p2align 4,,10
+	.p2align 3
+.L605:
+	movl	$5, %r8d
+	movl	$280, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L601:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$277, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L602
+	.cfi_endproc
+.LFE44:
+	.size	testParseIllumination, .-testParseIllumination
+	.p2align 4
+	.globl	testParseIlluminationMissingNumber
+	.type	testParseIlluminationMissingNumber, @function
+testParseIlluminationMissingNumber:
+.LFB45:
+	.cfi_startproc
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rsi
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC41(%rip), %xmm0
+	movups	%xmm0, 10(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L609
+	addl	$1, asserts_passed(%rip)
+.L610:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L611
+	addl	$1, asserts_passed(%rip)
+.L612:
+	movq	32(%rsp), %rax
+	movslq	128(%rax), %rcx
+	testq	%rcx, %rcx
+	jne	.L613
+	addl	$1, asserts_passed(%rip)
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L611:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$289, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L612
+	.p2align 4,,10
+	.p2align 3
+.L609:
+	xorl	%r8d, %r8d
+	movl	$288, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L610
+	.p2align 4,,10
+	.p2align 3
+.L613:
+	xorl	%r8d, %r8d
+	movl	$291, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$152, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	testParseIlluminationMissingNumber, .-testParseIlluminationMissingNumber
+	.p2align 4
+	.globl	testParseIlluminationEmptyNumber
+	.type	testParseIlluminationEmptyNumber, @function
+testParseIlluminationEmptyNumber:
+.LFB46:
+	.cfi_startproc
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rsi
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC42(%rip), %xmm0
+	movups	%xmm0, 11(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L617
+	addl	$1, asserts_passed(%rip)
+.L618:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L619
+	addl	$1, asserts_passed(%rip)
+.L620:
+	movq	32(%rsp), %rax
+	movslq	128(%rax), %rcx
+	testq	%rcx, %rcx
+	jne	.L621
+	addl	$1, asserts_passed(%rip)
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L619:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$300, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L620
+	.p2align 4,,10
+	.p2align 3
+.L617:
+	xorl	%r8d, %r8d
+	movl	$299, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L618
+	.p2align 4,,10
+	.p2align 3
+.L621:
+	xorl	%r8d, %r8d
+	movl	$302, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$152, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	testParseIlluminationEmptyNumber, .-testParseIlluminationEmptyNumber
+	.p2align 4
+	.globl	testParseIlluminationInvalidNumber
+	.type	testParseIlluminationInvalidNumber, @function
+testParseIlluminationInvalidNumber:
+.LFB47:
+	.cfi_startproc
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rsi
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC43(%rip), %xmm0
+	movups	%xmm0, 15(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L625
+	addl	$1, asserts_passed(%rip)
+.L626:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L627
+	addl	$1, asserts_passed(%rip)
+.L628:
+	movq	32(%rsp), %rax
+	movslq	128(%rax), %rcx
+	testq	%rcx, %rcx
+	jne	.L629
+	addl	$1, asserts_passed(%rip)
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L627:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$311, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L628
+	.p2align 4,,10
+	.p2align 3
+.L625:
+	xorl	%r8d, %r8d
+	movl	$310, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L626
+	.p2align 4,,10
+	.p2align 3
+.L629:
+	xorl	%r8d, %r8d
+	movl	$313, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$152, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE47:
+	.size	testParseIlluminationInvalidNumber, .-testParseIlluminationInvalidNumber
+	.p2align 4
+	.globl	testParseIlluminationIgnoresGarbage
+	.type	testParseIlluminationIgnoresGarbage, @function
+testParseIlluminationIgnoresGarbage:
+.LFB48:
+	.cfi_startproc
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC20(%rip), %xmm0
+	movl	$102, %eax
+	movq	%rsp, %rsi
+	leaq	48(%rsp), %rdi
+	movw	%ax, 32(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC44(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L633
+	addl	$1, asserts_passed(%rip)
+.L634:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L635
+	addl	$1, asserts_passed(%rip)
+.L636:
+	movq	48(%rsp), %rax
+	movslq	128(%rax), %rcx
+	cmpq	$10, %rcx
+	jne	.L637
+	addl	$1, asserts_passed(%rip)
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L635:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$322, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L636
+	.p2align 4,,10
+	.p2align 3
+.L637:
+	movl	$10, %r8d
+	movl	$324, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L633:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$321, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L634
+	.cfi_endproc
+.LFE48:
+	.size	testParseIlluminationIgnoresGarbage, .-testParseIlluminationIgnoresGarbage
+	.p2align 4
+	.globl	testParseSpecularExponent
+	.type	testParseSpecularExponent, @function
+testParseSpecularExponent:
+.LFB49:
+	.cfi_startproc
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 160
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rsi
+	leaq	32(%rsp), %rdi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC45(%rip), %xmm0
+	movups	%xmm0, 11(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L641
+	addl	$1, asserts_passed(%rip)
+.L642:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L643
+	addl	$1, asserts_passed(%rip)
+.L644:
+	movq	32(%rsp), %rax
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	88(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L645
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L652
+.L645:
+	movl	$335, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L652:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L643:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$333, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L644
+	.p2align 4,,10
+	.p2align 3
+.L641:
+	xorl	%r8d, %r8d
+	movl	$332, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L642
+	.cfi_endproc
+.LFE49:
+	.size	testParseSpecularExponent, .-testParseSpecularExponent
+	.p2align 4
+	.globl	testParseReflectionMapSphere
+	.type	testParseReflectionMapSphere, @function
+testParseReflectionMapSphere:
+.LFB50:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$176, %rsp
+	.cfi_def_cfa_offset 192
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rsi
+	leaq	64(%rsp), %rdi
+	movb	$0, 48(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC46(%rip), %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC47(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L654
+	addl	$1, asserts_passed(%rip)
+.L655:
+	movl	72(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L656
+	addl	$1, asserts_passed(%rip)
+.L657:
+	movq	64(%rsp), %rax
+	movq	280(%rax), %rbx
+	testq	%rbx, %rbx
+	je	.L658
+	leaq	.LC16(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L663
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L661:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$346, %edx
+	xorl	%eax, %eax
+	leaq	.LC16(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	addq	$176, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L663:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$176, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L656:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$344, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L657
+	.p2align 4,,10
+	.p2align 3
+.L654:
+	xorl	%r8d, %r8d
+	movl	$343, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L655
+	.p2align 4,,10
+	.p2align 3
+.L658:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L661
+	.cfi_endproc
+.LFE50:
+	.size	testParseReflectionMapSphere, .-testParseReflectionMapSphere
+	.section	.rodata.str1.1
+.LC48:
+	.string	"../skybox/up.png"
+.LC49:
+	.string	"../skybox/dn.png"
+.LC50:
+	.string	"../skybox/lf.png"
+.LC51:
+	.string	"../skybox/rt.png"
+.LC52:
+	.string	"../skybox/ft.png"
+.LC53:
+	.string	"../skybox/bk.png"
+	.text
+	.p2align 4
+	.globl	testParseReflectionMapCube
+	.type	testParseReflectionMapCube, @function
+testParseReflectionMapCube:
+.LFB51:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 400
+	movdqa	.LC20(%rip), %xmm0
+	leaq	112(%rsp), %rsi
+	movq	%rsp, %rdi
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC54(%rip), %xmm0
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC55(%rip), %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC56(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC57(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC58(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC59(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC60(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC61(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC62(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC63(%rip), %xmm0
+	movaps	%xmm0, 272(%rsp)
+	movdqa	.LC64(%rip), %xmm0
+	movaps	%xmm0, 288(%rsp)
+	movdqa	.LC65(%rip), %xmm0
+	movaps	%xmm0, 304(%rsp)
+	movdqa	.LC66(%rip), %xmm0
+	movaps	%xmm0, 320(%rsp)
+	movdqa	.LC67(%rip), %xmm0
+	movaps	%xmm0, 336(%rsp)
+	movdqa	.LC68(%rip), %xmm0
+	movups	%xmm0, 348(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L665
+	addl	$1, asserts_passed(%rip)
+.L666:
+	movl	8(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L667
+	movq	(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	296(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L669
+.L696:
+	leaq	.LC48(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L694
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L672:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$361, %edx
+	xorl	%eax, %eax
+	leaq	.LC48(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	312(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L673
+.L695:
+	leaq	.LC49(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L674
+	movq	360(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	je	.L677
+.L700:
+	leaq	.LC50(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L678
+	movq	376(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	je	.L681
+.L699:
+	leaq	.LC51(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L682
+	movq	328(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	je	.L685
+.L698:
+	leaq	.LC52(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L686
+	movq	344(%rbx), %rbx
+	addl	$1, asserts_passed(%rip)
+	testq	%rbx, %rbx
+	je	.L689
+.L697:
+	leaq	.LC53(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L690
+	addl	$1, asserts_passed(%rip)
+	addq	$376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L694:
+	.cfi_restore_state
+	movq	312(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	jne	.L695
+.L673:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L676
+	.p2align 4,,10
+	.p2align 3
+.L667:
+	movl	$1, %r8d
+	movl	$360, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	296(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L696
+.L669:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L672
+	.p2align 4,,10
+	.p2align 3
+.L690:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L692:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$366, %edx
+	xorl	%eax, %eax
+	leaq	.LC53(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	addq	$376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L686:
+	.cfi_restore_state
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L688:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$365, %edx
+	xorl	%eax, %eax
+	leaq	.LC52(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	344(%rbx), %rbx
+	testq	%rbx, %rbx
+	jne	.L697
+.L689:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L692
+	.p2align 4,,10
+	.p2align 3
+.L682:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L684:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$364, %edx
+	xorl	%eax, %eax
+	leaq	.LC51(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	328(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L698
+.L685:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L688
+	.p2align 4,,10
+	.p2align 3
+.L678:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L680:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$363, %edx
+	xorl	%eax, %eax
+	leaq	.LC50(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	376(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L699
+.L681:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L684
+	.p2align 4,,10
+	.p2align 3
+.L674:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L676:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$362, %edx
+	xorl	%eax, %eax
+	leaq	.LC49(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	360(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L700
+.L677:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L680
+	.p2align 4,,10
+	.p2align 3
+.L665:
+	xorl	%r8d, %r8d
+	movl	$359, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L666
+	.cfi_endproc
+.LFE51:
+	.size	testParseReflectionMapCube, .-testParseReflectionMapCube
+	.section	.rodata.str1.1
+.LC69:
+	.string	"textures/diffuse map.png"
+.LC75:
+	.string	"normal.png"
+	.text
+	.p2align 4
+	.globl	testParseMapOptions
+	.type	testParseMapOptions, @function
+testParseMapOptions:
+.LFB52:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$384, %rsp
+	.cfi_def_cfa_offset 416
+	movdqa	.LC20(%rip), %xmm0
+	leaq	64(%rsp), %rbp
+	leaq	176(%rsp), %rsi
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC76(%rip), %xmm0
+	movq	%rbp, %rdi
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC77(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC78(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC79(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC80(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC81(%rip), %xmm0
+	movaps	%xmm0, 272(%rsp)
+	movdqa	.LC82(%rip), %xmm0
+	movaps	%xmm0, 288(%rsp)
+	movdqa	.LC83(%rip), %xmm0
+	movaps	%xmm0, 304(%rsp)
+	movdqa	.LC84(%rip), %xmm0
+	movaps	%xmm0, 320(%rsp)
+	movdqa	.LC85(%rip), %xmm0
+	movaps	%xmm0, 336(%rsp)
+	movdqa	.LC86(%rip), %xmm0
+	movaps	%xmm0, 352(%rsp)
+	movdqa	.LC87(%rip), %xmm0
+	movups	%xmm0, 362(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L702
+	addl	$1, asserts_passed(%rip)
+.L703:
+	movq	64(%rsp), %rax
+	movq	%rbp, %rdi
+	leaq	152(%rax), %rsi
+	call	wavefrontMTLMapOptions@PLT
+	movq	%rax, %rbx
+	movq	64(%rsp), %rax
+	movq	152(%rax), %r12
+	testq	%r12, %r12
+	je	.L704
+	leaq	.LC69(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L805
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L707:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$379, %edx
+	xorl	%eax, %eax
+	leaq	.LC69(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L706:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm3
+	cvtss2sd	(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L708
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L708
+	addl	$1, asserts_passed(%rip)
+.L711:
+	movsd	.LC70(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm4
+	cvtss2sd	4(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L712
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L712
+	addl	$1, asserts_passed(%rip)
+.L715:
+	movsd	.LC12(%rip), %xmm5
+	pxor	%xmm0, %xmm0
+	cvtss2sd	8(%rbx), %xmm0
+	comisd	%xmm0, %xmm5
+	jbe	.L716
+	pxor	%xmm1, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm5
+	jbe	.L716
+	addl	$1, asserts_passed(%rip)
+.L719:
+	movsd	.LC71(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm6
+	cvtss2sd	12(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L720
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L720
+	addl	$1, asserts_passed(%rip)
+.L723:
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm7
+	cvtss2sd	16(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC25(%rip), %xmm1
+	comisd	%xmm1, %xmm7
+	jbe	.L724
+	movsd	.LC25(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm7
+	jbe	.L724
+	addl	$1, asserts_passed(%rip)
+.L727:
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm3
+	cvtss2sd	20(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC25(%rip), %xmm1
+	comisd	%xmm1, %xmm3
+	jbe	.L728
+	movsd	.LC25(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm3
+	jbe	.L728
+	addl	$1, asserts_passed(%rip)
+.L731:
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm4
+	cvtss2sd	32(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC72(%rip), %xmm1
+	comisd	%xmm1, %xmm4
+	jbe	.L732
+	movsd	.LC72(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm4
+	jbe	.L732
+	addl	$1, asserts_passed(%rip)
+.L735:
+	movsd	.LC11(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm5
+	cvtss2sd	44(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm5
+	jbe	.L736
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm5
+	jbe	.L736
+	addl	$1, asserts_passed(%rip)
+.L739:
+	movsd	.LC73(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm6
+	cvtss2sd	48(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L740
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L740
+	addl	$1, asserts_passed(%rip)
+.L743:
+	movsd	.LC74(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm7
+	cvtss2sd	40(%rbx), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L744
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm7
+	jbe	.L744
+	addl	$1, asserts_passed(%rip)
+.L747:
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm3
+	cvtss2sd	36(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC25(%rip), %xmm1
+	comisd	%xmm1, %xmm3
+	jbe	.L748
+	movsd	.LC25(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm3
+	jbe	.L748
+	movslq	52(%rbx), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$512, %rcx
+	jne	.L752
+.L808:
+	movslq	56(%rbx), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$108, %rcx
+	jne	.L754
+.L809:
+	movl	60(%rbx), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$14, %rcx
+	jne	.L756
+.L810:
+	addl	$1, asserts_passed(%rip)
+.L757:
+	movq	64(%rsp), %rax
+	movq	%rbp, %rdi
+	leaq	168(%rax), %rsi
+	call	wavefrontMTLMapOptions@PLT
+	movq	%rax, %rbx
+	movq	64(%rsp), %rax
+	movq	168(%rax), %r12
+	testq	%r12, %r12
+	je	.L758
+	leaq	.LC75(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L759
+	addl	$1, asserts_passed(%rip)
+.L760:
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm4
+	cvtss2sd	36(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC72(%rip), %xmm1
+	comisd	%xmm1, %xmm4
+	jbe	.L762
+	movsd	.LC72(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm4
+	jbe	.L762
+	addl	$1, asserts_passed(%rip)
+.L765:
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm5
+	cvtss2sd	12(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC25(%rip), %xmm1
+	comisd	%xmm1, %xmm5
+	jbe	.L766
+	movsd	.LC25(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm5
+	jbe	.L766
+	movl	60(%rbx), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$3, %rcx
+	jne	.L770
+.L806:
+	movl	136(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L772
+.L807:
+	addl	$1, asserts_passed(%rip)
+.L773:
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMapOptionsCompose@PLT
+	movq	64(%rsp), %rsi
+	movl	244(%rsi), %ecx
+	testq	%rcx, %rcx
+	jne	.L774
+	addl	$1, asserts_passed(%rip)
+.L775:
+	addq	$232, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLMapOptions@PLT
+	movl	$64, %edx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L776
+	addl	$1, asserts_passed(%rip)
+.L777:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$384, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L805:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L706
+	.p2align 4,,10
+	.p2align 3
+.L766:
+	movq	.LC25(%rip), %rax
+	movl	$400, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movl	60(%rbx), %ecx
+	cmpq	$3, %rcx
+	je	.L806
+.L770:
+	movl	$3, %r8d
+	movl	$401, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	136(%rsp), %ecx
+	cmpq	$2, %rcx
+	je	.L807
+.L772:
+	movl	$2, %r8d
+	movl	$402, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L773
+	.p2align 4,,10
+	.p2align 3
+.L762:
+	movq	.LC72(%rip), %rax
+	movl	$399, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	jmp	.L765
+	.p2align 4,,10
+	.p2align 3
+.L748:
+	movq	.LC25(%rip), %rax
+	movl	$391, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movslq	52(%rbx), %rcx
+	cmpq	$512, %rcx
+	je	.L808
+.L752:
+	movl	$512, %r8d
+	movl	$392, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	56(%rbx), %rcx
+	cmpq	$108, %rcx
+	je	.L809
+.L754:
+	movl	$108, %r8d
+	movl	$393, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	60(%rbx), %ecx
+	cmpq	$14, %rcx
+	je	.L810
+.L756:
+	movl	$14, %r8d
+	movl	$394, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L757
+	.p2align 4,,10
+	.p2align 3
+.L744:
+	movl	$390, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L747
+	.p2align 4,,10
+	.p2align 3
+.L740:
+	movl	$389, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L743
+	.p2align 4,,10
+	.p2align 3
+.L736:
+	movl	$388, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L739
+	.p2align 4,,10
+	.p2align 3
+.L732:
+	movq	.LC72(%rip), %rax
+	movl	$387, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	jmp	.L735
+	.p2align 4,,10
+	.p2align 3
+.L728:
+	movq	.LC25(%rip), %rax
+	movl	$386, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	jmp	.L731
+	.p2align 4,,10
+	.p2align 3
+.L724:
+	movq	.LC25(%rip), %rax
+	movl	$385, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	jmp	.L727
+	.p2align 4,,10
+	.p2align 3
+.L720:
+	movl	$384, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L723
+	.p2align 4,,10
+	.p2align 3
+.L716:
+	pxor	%xmm1, %xmm1
+	movl	$382, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L719
+	.p2align 4,,10
+	.p2align 3
+.L712:
+	movl	$381, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L715
+	.p2align 4,,10
+	.p2align 3
+.L708:
+	movl	$380, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L711
+	.p2align 4,,10
+	.p2align 3
+.L759:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L761:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$398, %edx
+	xorl	%eax, %eax
+	leaq	.LC75(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L760
+	.p2align 4,,10
+	.p2align 3
+.L702:
+	xorl	%r8d, %r8d
+	movl	$377, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L703
+	.p2align 4,,10
+	.p2align 3
+.L776:
+	xorl	%r8d, %r8d
+	movl	$407, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L777
+	.p2align 4,,10
+	.p2align 3
+.L774:
+	leaq	.LC0(%rip), %rsi
+	xorl	%r8d, %r8d
+	movl	$406, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	64(%rsp), %rsi
+	jmp	.L775
+	.p2align 4,,10
+	.p2align 3
+.L758:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L761
+	.p2align 4,,10
+	.p2align 3
+.L704:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L707
+	.cfi_endproc
+.LFE52:
+	.size	testParseMapOptions, .-testParseMapOptions
+	.section	.rodata.str1.1
+.LC88:
+	.string	"second.png"
+	.text
+	.p2align 4
+	.globl	testParseMapOptionsReplaced
+	.type	testParseMapOptionsReplaced, @function
+testParseMapOptionsReplaced:
+.LFB53:
+	.cfi_startproc
+	movabsq	$2928473793258866, %rax
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$240, %rsp
+	.cfi_def_cfa_offset 272
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rbp
+	leaq	112(%rsp), %rsi
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC90(%rip), %xmm0
+	movq	%rbp, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC91(%rip), %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC92(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC93(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC94(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC95(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movq	%rax, 221(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L812
+	addl	$1, asserts_passed(%rip)
+.L813:
+	movq	(%rsp), %r12
+	movq	152(%r12), %rbx
+	testq	%rbx, %rbx
+	je	.L814
+	leaq	.LC88(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L833
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L817:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$420, %edx
+	xorl	%eax, %eax
+	leaq	.LC88(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movl	164(%r12), %ecx
+	testq	%rcx, %rcx
+	jne	.L818
+.L834:
+	addl	$1, asserts_passed(%rip)
+.L819:
+	movq	(%rsp), %rax
+	movq	280(%rax), %rbx
+	leaq	280(%rax), %r12
+	testq	%rbx, %rbx
+	je	.L820
+	leaq	.LC16(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L821
+	addl	$1, asserts_passed(%rip)
+.L822:
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLMapOptions@PLT
+	movl	60(%rax), %ecx
+	movq	%rax, %rbx
+	cmpq	$1, %rcx
+	jne	.L824
+	addl	$1, asserts_passed(%rip)
+.L825:
+	movsd	.LC89(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	12(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L826
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L826
+	addl	$1, asserts_passed(%rip)
+.L829:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L833:
+	.cfi_restore_state
+	movl	164(%r12), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	je	.L834
+.L818:
+	xorl	%r8d, %r8d
+	movl	$421, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L819
+	.p2align 4,,10
+	.p2align 3
+.L826:
+	movl	$426, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L829
+	.p2align 4,,10
+	.p2align 3
+.L824:
+	movl	$1, %r8d
+	movl	$425, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L825
+	.p2align 4,,10
+	.p2align 3
+.L821:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L823:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$423, %edx
+	xorl	%eax, %eax
+	leaq	.LC16(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L822
+	.p2align 4,,10
+	.p2align 3
+.L812:
+	xorl	%r8d, %r8d
+	movl	$418, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L813
+	.p2align 4,,10
+	.p2align 3
+.L820:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L823
+	.p2align 4,,10
+	.p2align 3
+.L814:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L817
+	.cfi_endproc
+.LFE53:
+	.size	testParseMapOptionsReplaced, .-testParseMapOptionsReplaced
+	.section	.rodata.str1.1
+.LC96:
+	.string	"newmtl m\nmap_Kd -s file.png\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC97:
+	.string	"newmtl m\nmap_Kd -mm 1 file.png\n"
+	.align 8
+.LC98:
+	.string	"newmtl m\nmap_Kd -clamp yes file.png\n"
+	.align 8
+.LC99:
+	.string	"newmtl m\nmap_Kd -imfchan x file.png\n"
+	.align 8
+.LC100:
+	.string	"newmtl m\nmap_Kd -texres 1.5 file.png\n"
+	.align 8
+.LC101:
+	.string	"newmtl m\nrefl -type sphere -bm\n"
+	.section	.rodata.str1.1
+.LC102:
+	.string	"file.png"
+	.text
+	.p2align 4
+	.globl	testParseMapOptionsGarbage
+	.type	testParseMapOptionsGarbage, @function
+testParseMapOptionsGarbage:
+.LFB54:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC97(%rip), %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rax, %xmm1
+	leaq	.LC99(%rip), %rax
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rax, %xmm2
+	leaq	.LC101(%rip), %rax
+	leaq	.LC1(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rax, %xmm3
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	.LC0(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	.LC96(%rip), %rbx
+	movq	%rbx, %xmm0
+	leaq	.LC98(%rip), %rbx
+	punpcklqdq	%xmm1, %xmm0
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 400
+	leaq	80(%rsp), %rax
+	movaps	%xmm0, 176(%rsp)
+	movq	%rbx, %xmm0
+	leaq	.LC100(%rip), %rbx
+	movq	%rax, 24(%rsp)
+	leaq	48(%rsp), %rax
+	punpcklqdq	%xmm2, %xmm0
+	leaq	176(%rsp), %r15
+	movq	%rax, 8(%rsp)
+	leaq	128(%rsp), %rax
+	leaq	224(%rsp), %r14
+	movaps	%xmm0, 192(%rsp)
+	movq	%rbx, %xmm0
+	xorl	%ebx, %ebx
+	movq	%rax, 16(%rsp)
+	punpcklqdq	%xmm3, %xmm0
+	movaps	%xmm0, 208(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L861:
+	movq	(%r15,%rbx,8), %r12
+	movq	%r14, %rdi
+	movq	%r12, %rsi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L836
+	addl	$1, asserts_passed(%rip)
+.L837:
+	movl	232(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L838
+	movl	296(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L840
+.L866:
+	addl	$1, asserts_passed(%rip)
+.L841:
+	movq	224(%rsp), %rdx
+	cmpq	$5, %rbx
+	je	.L843
+	movq	152(%rdx), %rcx
+	movq	%rdx, 40(%rsp)
+	testq	%rcx, %rcx
+	je	.L844
+	movq	%rcx, %rdi
+	leaq	.LC102(%rip), %rsi
+	movq	%rcx, 32(%rsp)
+	call	strcmp@PLT
+	movq	32(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L845
+	addl	$1, asserts_passed(%rip)
+	movq	40(%rsp), %rdx
+.L843:
+	cmpq	$0, 280(%rdx)
+	je	.L864
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$449, %edx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L849:
+	movq	%r14, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	24(%rsp), %rax
+	movq	%r12, %rdi
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 128(%rsp)
+	movq	%rax, 48(%rsp)
+	movq	8(%rsp), %rax
+	movaps	%xmm0, 144(%rsp)
+	movq	$0, 60(%rsp)
+	movl	$0, 68(%rsp)
+	movl	$1, 56(%rsp)
+	movq	%rax, 160(%rsp)
+	call	strlen@PLT
+	movq	16(%rsp), %rcx
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L850
+	addl	$1, asserts_passed(%rip)
+.L851:
+	movq	64(%rsp), %rcx
+	cmpq	$1, %rcx
+	jne	.L852
+	addl	$1, asserts_passed(%rip)
+.L853:
+	movl	112(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L854
+	addl	$1, asserts_passed(%rip)
+	cmpq	$5, %rbx
+	je	.L865
+.L856:
+	movq	224(%rsp), %rax
+	movq	152(%rax), %r12
+	testq	%r12, %r12
+	je	.L857
+	leaq	.LC102(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L858
+	addl	$1, asserts_passed(%rip)
+.L859:
+	movq	%r14, %rdi
+	addq	$1, %rbx
+	call	wavefrontMTLRelease@PLT
+	jmp	.L861
+	.p2align 4,,10
+	.p2align 3
+.L838:
+	movl	$1, %r8d
+	movl	$445, %edx
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	296(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L866
+.L840:
+	xorl	%r8d, %r8d
+	movl	$446, %edx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L841
+	.p2align 4,,10
+	.p2align 3
+.L854:
+	xorl	%eax, %eax
+	movl	$3, %r8d
+	movl	$460, %edx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	cmpq	$5, %rbx
+	jne	.L856
+.L865:
+	movq	%r14, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L852:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$459, %edx
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L853
+	.p2align 4,,10
+	.p2align 3
+.L864:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L849
+	.p2align 4,,10
+	.p2align 3
+.L850:
+	xorl	%r8d, %r8d
+	movl	$458, %edx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L851
+	.p2align 4,,10
+	.p2align 3
+.L836:
+	xorl	%r8d, %r8d
+	movl	$444, %edx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L837
+	.p2align 4,,10
+	.p2align 3
+.L858:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L860:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$461, %edx
+	movq	%rbp, %rsi
+	leaq	.LC102(%rip), %r8
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	jmp	.L859
+	.p2align 4,,10
+	.p2align 3
+.L845:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L847:
+	movl	%eax, asserts_failed(%rip)
+	movl	$448, %edx
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	leaq	.LC102(%rip), %r8
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	224(%rsp), %rdx
+	jmp	.L843
+	.p2align 4,,10
+	.p2align 3
+.L844:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L847
+	.p2align 4,,10
+	.p2align 3
+.L857:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L860
+	.cfi_endproc
+.LFE54:
+	.size	testParseMapOptionsGarbage, .-testParseMapOptionsGarbage
+	.section	.rodata.str1.1
+.LC103:
+	.string	"ka.png"
+.LC104:
+	.string	"kd.png"
+.LC105:
+	.string	"ks.png"
+.LC106:
+	.string	"ke.png"
+.LC107:
+	.string	"ns.png"
+.LC108:
+	.string	"d.png"
+.LC109:
+	.string	"bump.png"
+.LC110:
+	.string	"disp.png"
+.LC111:
+	.string	"decal.png"
+.LC112:
+	.string	"pr.png"
+.LC113:
+	.string	"pm.png"
+.LC114:
+	.string	"ps.png"
+.LC115:
+	.string	"norm.png"
+	.text
+	.p2align 4
+	.globl	testParseAllMaps
+	.type	testParseAllMaps, @function
+testParseAllMaps:
+.LFB55:
+	.cfi_startproc
+	movabsq	$2928473793260914, %rax
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$336, %rsp
+	.cfi_def_cfa_offset 368
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rbp
+	leaq	112(%rsp), %rsi
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC116(%rip), %xmm0
+	movq	%rbp, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC117(%rip), %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC118(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC119(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC120(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC121(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC122(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC123(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC124(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC125(%rip), %xmm0
+	movaps	%xmm0, 272(%rsp)
+	movdqa	.LC126(%rip), %xmm0
+	movaps	%xmm0, 288(%rsp)
+	movdqa	.LC127(%rip), %xmm0
+	movaps	%xmm0, 304(%rsp)
+	movq	%rax, 319(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L868
+	movq	(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	136(%rbx), %r12
+	testq	%r12, %r12
+	je	.L870
+.L942:
+	leaq	.LC103(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L929
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L873:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$485, %edx
+	xorl	%eax, %eax
+	leaq	.LC103(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	152(%rbx), %r12
+	testq	%r12, %r12
+	je	.L874
+.L930:
+	leaq	.LC104(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L875
+	movq	184(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L878
+.L941:
+	leaq	.LC105(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L879
+	movq	440(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L882
+.L940:
+	leaq	.LC106(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L883
+	movq	200(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L886
+.L939:
+	leaq	.LC107(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L887
+	movq	216(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L890
+.L938:
+	leaq	.LC108(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L891
+	movq	232(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L894
+.L937:
+	leaq	.LC109(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L895
+	addl	$1, asserts_passed(%rip)
+.L896:
+	leaq	232(%rbx), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLMapOptions@PLT
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	36(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L898
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L898
+	movq	248(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L902
+.L931:
+	leaq	.LC110(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L903
+	movq	264(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L906
+.L936:
+	leaq	.LC111(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L907
+	movq	392(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L910
+.L935:
+	leaq	.LC112(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L911
+	movq	408(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L914
+.L934:
+	leaq	.LC113(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L915
+	movq	424(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L918
+.L933:
+	leaq	.LC114(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L919
+	movq	168(%rbx), %rbx
+	addl	$1, asserts_passed(%rip)
+	testq	%rbx, %rbx
+	je	.L922
+.L932:
+	leaq	.LC115(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L923
+	addl	$1, asserts_passed(%rip)
+.L924:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$336, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L929:
+	.cfi_restore_state
+	movq	152(%rbx), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	jne	.L930
+.L874:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L877
+	.p2align 4,,10
+	.p2align 3
+.L898:
+	movl	$492, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	248(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L931
+.L902:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L905
+	.p2align 4,,10
+	.p2align 3
+.L919:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L921:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$497, %edx
+	xorl	%eax, %eax
+	leaq	.LC114(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	168(%rbx), %rbx
+	testq	%rbx, %rbx
+	jne	.L932
+.L922:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L925
+	.p2align 4,,10
+	.p2align 3
+.L915:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L917:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$496, %edx
+	xorl	%eax, %eax
+	leaq	.LC113(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	424(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L933
+.L918:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L921
+	.p2align 4,,10
+	.p2align 3
+.L911:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L913:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$495, %edx
+	xorl	%eax, %eax
+	leaq	.LC112(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	408(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L934
+.L914:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L917
+	.p2align 4,,10
+	.p2align 3
+.L907:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L909:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$494, %edx
+	xorl	%eax, %eax
+	leaq	.LC111(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	392(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L935
+.L910:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L913
+	.p2align 4,,10
+	.p2align 3
+.L903:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L905:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$493, %edx
+	xorl	%eax, %eax
+	leaq	.LC110(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	264(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L936
+.L906:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L909
+	.p2align 4,,10
+	.p2align 3
+.L923:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L925:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$498, %edx
+	xorl	%eax, %eax
+	leaq	.LC115(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L924
+	.p2align 4,,10
+	.p2align 3
+.L895:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L897:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$491, %edx
+	xorl	%eax, %eax
+	leaq	.LC109(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L896
+	.p2align 4,,10
+	.p2align 3
+.L891:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L893:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$490, %edx
+	xorl	%eax, %eax
+	leaq	.LC108(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	232(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L937
+.L894:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L897
+	.p2align 4,,10
+	.p2align 3
+.L887:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L889:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$489, %edx
+	xorl	%eax, %eax
+	leaq	.LC107(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	216(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L938
+.L890:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L893
+	.p2align 4,,10
+	.p2align 3
+.L883:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L885:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$488, %edx
+	xorl	%eax, %eax
+	leaq	.LC106(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	200(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L939
+.L886:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L889
+	.p2align 4,,10
+	.p2align 3
+.L879:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L881:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$487, %edx
+	xorl	%eax, %eax
+	leaq	.LC105(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	440(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L940
+.L882:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L885
+	.p2align 4,,10
+	.p2align 3
+.L875:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L877:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$486, %edx
+	xorl	%eax, %eax
+	leaq	.LC104(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	184(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L941
+.L878:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L881
+	.p2align 4,,10
+	.p2align 3
+.L868:
+	xorl	%r8d, %r8d
+	movl	$483, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	136(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L942
+.L870:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L873
+	.cfi_endproc
+.LFE55:
+	.size	testParseAllMaps, .-testParseAllMaps
+	.section	.rodata.str1.1
+.LC128:
+	.string	"a.png"
+.LC129:
+	.string	"b.png"
+	.text
+	.p2align 4
+	.globl	testParseBumpSpellings
+	.type	testParseBumpSpellings, @function
+testParseBumpSpellings:
+.LFB56:
+	.cfi_startproc
+	movabsq	$2928473793258272, %rax
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$192, %rsp
+	.cfi_def_cfa_offset 224
+	movdqa	.LC130(%rip), %xmm0
+	leaq	80(%rsp), %r12
+	movq	%rsp, %rsi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC131(%rip), %xmm0
+	movq	%r12, %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC132(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movdqa	.LC133(%rip), %xmm0
+	movaps	%xmm0, 48(%rsp)
+	movq	%rax, 62(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L944
+	addl	$1, asserts_passed(%rip)
+.L945:
+	movq	80(%rsp), %rbx
+	movq	232(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L946
+	leaq	.LC128(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L957
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L949:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$509, %edx
+	xorl	%eax, %eax
+	leaq	.LC128(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	80(%rsp), %rbx
+	movq	688(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L950
+.L959:
+	leaq	.LC129(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L951
+	addl	$1, asserts_passed(%rip)
+.L952:
+	cmpq	$0, 1144(%rbx)
+	je	.L958
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$511, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L955:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$192, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L957:
+	.cfi_restore_state
+	movq	688(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	jne	.L959
+.L950:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L953
+	.p2align 4,,10
+	.p2align 3
+.L958:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L955
+	.p2align 4,,10
+	.p2align 3
+.L951:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L953:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$510, %edx
+	xorl	%eax, %eax
+	leaq	.LC129(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	80(%rsp), %rbx
+	jmp	.L952
+	.p2align 4,,10
+	.p2align 3
+.L944:
+	xorl	%r8d, %r8d
+	movl	$508, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L945
+	.p2align 4,,10
+	.p2align 3
+.L946:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L949
+	.cfi_endproc
+.LFE56:
+	.size	testParseBumpSpellings, .-testParseBumpSpellings
+	.p2align 4
+	.globl	testParsePhysicallyBased
+	.type	testParsePhysicallyBased, @function
+testParsePhysicallyBased:
+.LFB57:
+	.cfi_startproc
+	movabsq	$2877561389413225, %rax
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 272
+	movdqa	.LC20(%rip), %xmm0
+	movq	%rsp, %rbp
+	leaq	112(%rsp), %rsi
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC137(%rip), %xmm0
+	movq	%rbp, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC138(%rip), %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC139(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC140(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC141(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC142(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movq	%rax, 221(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L961
+	addl	$1, asserts_passed(%rip)
+.L962:
+	movq	(%rsp), %rbx
+	movsd	.LC70(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	100(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L963
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1030
+.L963:
+	movl	$532, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L966:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	104(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC25(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L967
+	movsd	.LC25(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1031
+.L967:
+	movq	.LC25(%rip), %rax
+	movl	$533, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L970:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	108(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L971
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1032
+.L971:
+	movl	$534, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L974:
+	movsd	.LC134(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	112(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L975
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1033
+.L975:
+	movl	$535, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L978:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	116(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC135(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L979
+	movsd	.LC135(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1034
+.L979:
+	movq	.LC135(%rip), %rax
+	movl	$536, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L982:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	120(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC72(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L983
+	movsd	.LC72(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1035
+.L983:
+	movq	.LC72(%rip), %rax
+	movl	$537, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L986:
+	movsd	.LC136(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	124(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L987
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1036
+.L987:
+	movl	$538, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L990:
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	72(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L991
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1037
+.L991:
+	movl	$539, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L994:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	80(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC72(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L995
+	movsd	.LC72(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1038
+.L995:
+	movq	.LC72(%rip), %rax
+	movl	$540, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L998:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	84(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC25(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L999
+	movsd	.LC25(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1039
+.L999:
+	movq	.LC25(%rip), %rax
+	movl	$541, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+.L1002:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	92(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC135(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1003
+	movsd	.LC135(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1040
+.L1003:
+	movq	.LC135(%rip), %rax
+	movl	$543, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+.L1006:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1040:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1006
+	.p2align 4,,10
+	.p2align 3
+.L1039:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1002
+	.p2align 4,,10
+	.p2align 3
+.L1038:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L998
+	.p2align 4,,10
+	.p2align 3
+.L1037:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L994
+	.p2align 4,,10
+	.p2align 3
+.L1036:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L990
+	.p2align 4,,10
+	.p2align 3
+.L1035:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L986
+	.p2align 4,,10
+	.p2align 3
+.L1034:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L982
+	.p2align 4,,10
+	.p2align 3
+.L1033:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L978
+	.p2align 4,,10
+	.p2align 3
+.L1032:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L974
+	.p2align 4,,10
+	.p2align 3
+.L1031:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L970
+	.p2align 4,,10
+	.p2align 3
+.L1030:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L966
+	.p2align 4,,10
+	.p2align 3
+.L961:
+	xorl	%r8d, %r8d
+	movl	$530, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L962
+	.cfi_endproc
+.LFE57:
+	.size	testParsePhysicallyBased, .-testParsePhysicallyBased
+	.section	.rodata.str1.1
+.LC143:
+	.string	"Material_001.001"
+.LC146:
+	.string	"test.png"
+	.text
+	.p2align 4
+	.globl	testParseBlenderWavefrontMaterial
+	.type	testParseBlenderWavefrontMaterial, @function
+testParseBlenderWavefrontMaterial:
+.LFB58:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$352, %rsp
+	.cfi_def_cfa_offset 384
+	movdqa	.LC147(%rip), %xmm0
+	movq	%rsp, %r12
+	leaq	112(%rsp), %rsi
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC148(%rip), %xmm0
+	movq	%r12, %rdi
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC149(%rip), %xmm0
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC150(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC151(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC152(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC153(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC154(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC155(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC156(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC157(%rip), %xmm0
+	movaps	%xmm0, 272(%rsp)
+	movdqa	.LC158(%rip), %xmm0
+	movaps	%xmm0, 288(%rsp)
+	movdqa	.LC159(%rip), %xmm0
+	movaps	%xmm0, 304(%rsp)
+	movdqa	.LC160(%rip), %xmm0
+	movaps	%xmm0, 320(%rsp)
+	movl	$681838, 335(%rsp)
+	movq	$0, (%rsp)
+	movl	$0, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1042
+	movq	(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L1044
+.L1130:
+	leaq	.LC143(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1127
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1047:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$566, %edx
+	xorl	%eax, %eax
+	leaq	.LC143(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L1046:
+	movsd	.LC144(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	88(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1048
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1048
+	addl	$1, asserts_passed(%rip)
+.L1051:
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	8(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1052
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1052
+	addl	$1, asserts_passed(%rip)
+.L1055:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	12(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC11(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1056
+	movsd	.LC11(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1056
+	addl	$1, asserts_passed(%rip)
+.L1059:
+	movsd	.LC72(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	16(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1060
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1060
+	addl	$1, asserts_passed(%rip)
+.L1063:
+	movsd	.LC14(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	24(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1064
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1064
+	addl	$1, asserts_passed(%rip)
+.L1067:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	28(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC23(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1068
+	movsd	.LC23(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1068
+	addl	$1, asserts_passed(%rip)
+.L1071:
+	movsd	.LC136(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	32(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1072
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1072
+	addl	$1, asserts_passed(%rip)
+.L1075:
+	movsd	.LC24(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	40(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1076
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1076
+	addl	$1, asserts_passed(%rip)
+.L1079:
+	movsd	.LC73(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	44(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1080
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1080
+	addl	$1, asserts_passed(%rip)
+.L1083:
+	movsd	.LC145(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	48(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1084
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1084
+	addl	$1, asserts_passed(%rip)
+.L1087:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	92(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC11(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1088
+	movsd	.LC11(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1088
+	addl	$1, asserts_passed(%rip)
+.L1091:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	96(%rbx), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC23(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1092
+	movsd	.LC23(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L1092
+	movslq	128(%rbx), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L1096
+.L1128:
+	movq	152(%rbx), %rbx
+	addl	$1, asserts_passed(%rip)
+	testq	%rbx, %rbx
+	je	.L1098
+.L1129:
+	leaq	.LC146(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1099
+	addl	$1, asserts_passed(%rip)
+.L1100:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$352, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1127:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1046
+	.p2align 4,,10
+	.p2align 3
+.L1092:
+	movq	.LC23(%rip), %rax
+	movl	$578, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movslq	128(%rbx), %rcx
+	cmpq	$2, %rcx
+	je	.L1128
+.L1096:
+	movl	$2, %r8d
+	movl	$579, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	152(%rbx), %rbx
+	testq	%rbx, %rbx
+	jne	.L1129
+.L1098:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L1101
+	.p2align 4,,10
+	.p2align 3
+.L1088:
+	movq	.LC11(%rip), %rax
+	movl	$577, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1091
+	.p2align 4,,10
+	.p2align 3
+.L1084:
+	movl	$576, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1087
+	.p2align 4,,10
+	.p2align 3
+.L1080:
+	movl	$575, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1083
+	.p2align 4,,10
+	.p2align 3
+.L1076:
+	movl	$574, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1079
+	.p2align 4,,10
+	.p2align 3
+.L1072:
+	movl	$573, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1075
+	.p2align 4,,10
+	.p2align 3
+.L1068:
+	movq	.LC23(%rip), %rax
+	movl	$572, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1071
+	.p2align 4,,10
+	.p2align 3
+.L1064:
+	movl	$571, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1067
+	.p2align 4,,10
+	.p2align 3
+.L1060:
+	movl	$570, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1063
+	.p2align 4,,10
+	.p2align 3
+.L1056:
+	movq	.LC11(%rip), %rax
+	movl	$569, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1059
+	.p2align 4,,10
+	.p2align 3
+.L1052:
+	movl	$568, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1055
+	.p2align 4,,10
+	.p2align 3
+.L1048:
+	movl	$567, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1051
+	.p2align 4,,10
+	.p2align 3
+.L1099:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1101:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$580, %edx
+	xorl	%eax, %eax
+	leaq	.LC146(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L1100
+	.p2align 4,,10
+	.p2align 3
+.L1042:
+	xorl	%r8d, %r8d
+	movl	$564, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L1130
+.L1044:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1047
+	.cfi_endproc
+.LFE58:
+	.size	testParseBlenderWavefrontMaterial, .-testParseBlenderWavefrontMaterial
+	.section	.rodata.str1.1
+.LC161:
+	.string	"Material_Test"
+	.text
+	.p2align 4
+	.globl	testParseGuruWavefrontMaterial
+	.type	testParseGuruWavefrontMaterial, @function
+testParseGuruWavefrontMaterial:
+.LFB59:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$10, %eax
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$304, %rsp
+	.cfi_def_cfa_offset 336
+	movdqa	.LC163(%rip), %xmm0
+	movq	%rsp, %r12
+	leaq	112(%rsp), %rsi
+	movw	%ax, 288(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC164(%rip), %xmm0
+	movq	%r12, %rdi
+	movq	$0, (%rsp)
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC165(%rip), %xmm0
+	movl	$0, 8(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC166(%rip), %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movdqa	.LC167(%rip), %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movdqa	.LC168(%rip), %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movdqa	.LC169(%rip), %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movdqa	.LC170(%rip), %xmm0
+	movaps	%xmm0, 224(%rsp)
+	movdqa	.LC171(%rip), %xmm0
+	movaps	%xmm0, 240(%rsp)
+	movdqa	.LC172(%rip), %xmm0
+	movaps	%xmm0, 256(%rsp)
+	movdqa	.LC173(%rip), %xmm0
+	movaps	%xmm0, 272(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1132
+	movq	(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L1134
+.L1203:
+	leaq	.LC161(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1201
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1137:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$602, %edx
+	xorl	%eax, %eax
+	leaq	.LC161(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L1136:
+	movsd	.LC162(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	88(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1138
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1138
+	addl	$1, asserts_passed(%rip)
+.L1141:
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	8(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1142
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1142
+	addl	$1, asserts_passed(%rip)
+.L1145:
+	movsd	.LC11(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	12(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1146
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1146
+	addl	$1, asserts_passed(%rip)
+.L1149:
+	movsd	.LC72(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	16(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1150
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1150
+	addl	$1, asserts_passed(%rip)
+.L1153:
+	movsd	.LC14(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	24(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1154
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1154
+	addl	$1, asserts_passed(%rip)
+.L1157:
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	28(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1158
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1158
+	addl	$1, asserts_passed(%rip)
+.L1161:
+	movsd	.LC136(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	32(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1162
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1162
+	addl	$1, asserts_passed(%rip)
+.L1165:
+	movsd	.LC24(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	40(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1166
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1166
+	addl	$1, asserts_passed(%rip)
+.L1169:
+	movsd	.LC73(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	44(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1170
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1170
+	addl	$1, asserts_passed(%rip)
+.L1173:
+	movsd	.LC145(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	48(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1174
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1174
+	movslq	128(%rbx), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L1178
+.L1202:
+	addl	$1, asserts_passed(%rip)
+.L1179:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1201:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1136
+	.p2align 4,,10
+	.p2align 3
+.L1174:
+	movl	$612, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	128(%rbx), %rcx
+	cmpq	$2, %rcx
+	je	.L1202
+.L1178:
+	movl	$2, %r8d
+	movl	$613, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1179
+	.p2align 4,,10
+	.p2align 3
+.L1170:
+	movl	$611, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1173
+	.p2align 4,,10
+	.p2align 3
+.L1166:
+	movl	$610, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1169
+	.p2align 4,,10
+	.p2align 3
+.L1162:
+	movl	$609, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1165
+	.p2align 4,,10
+	.p2align 3
+.L1158:
+	movl	$608, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1161
+	.p2align 4,,10
+	.p2align 3
+.L1154:
+	movl	$607, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1157
+	.p2align 4,,10
+	.p2align 3
+.L1150:
+	movl	$606, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1153
+	.p2align 4,,10
+	.p2align 3
+.L1146:
+	movl	$605, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1149
+	.p2align 4,,10
+	.p2align 3
+.L1142:
+	movl	$604, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1145
+	.p2align 4,,10
+	.p2align 3
+.L1138:
+	movl	$603, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rax
+	movq	%rax, %xmm2
+	jmp	.L1141
+	.p2align 4,,10
+	.p2align 3
+.L1132:
+	xorl	%r8d, %r8d
+	movl	$600, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rbx
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L1203
+.L1134:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1137
+	.cfi_endproc
+.LFE59:
+	.size	testParseGuruWavefrontMaterial, .-testParseGuruWavefrontMaterial
+	.section	.rodata.str1.1
+.LC174:
+	.string	"first"
+.LC175:
+	.string	"second_is"
+	.text
+	.p2align 4
+	.globl	testParseBufferNotTerminated
+	.type	testParseBufferNotTerminated, @function
+testParseBufferNotTerminated:
+.LFB60:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	xorl	%ecx, %ecx
+	movl	$44, %edx
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$176, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC176(%rip), %xmm0
+	leaq	64(%rsp), %r12
+	movq	%rsp, %rsi
+	movb	$0, 48(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC177(%rip), %xmm0
+	movq	%r12, %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC178(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1205
+	addl	$1, asserts_passed(%rip)
+.L1206:
+	movl	72(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1207
+	movq	64(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L1209
+.L1226:
+	leaq	.LC174(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1224
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1212:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$623, %edx
+	xorl	%eax, %eax
+	leaq	.LC174(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	64(%rsp), %rbx
+	movq	456(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L1213
+.L1225:
+	leaq	.LC175(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1214
+	addl	$1, asserts_passed(%rip)
+.L1215:
+	movsd	.LC24(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	32(%rbx), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1217
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1217
+	addl	$1, asserts_passed(%rip)
+.L1220:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$176, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1224:
+	.cfi_restore_state
+	movq	456(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	jne	.L1225
+.L1213:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1216
+	.p2align 4,,10
+	.p2align 3
+.L1217:
+	movl	$625, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1220
+	.p2align 4,,10
+	.p2align 3
+.L1207:
+	movl	$2, %r8d
+	movl	$622, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	64(%rsp), %rbx
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L1226
+.L1209:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1212
+	.p2align 4,,10
+	.p2align 3
+.L1214:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1216:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$624, %edx
+	xorl	%eax, %eax
+	leaq	.LC175(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	64(%rsp), %rbx
+	jmp	.L1215
+	.p2align 4,,10
+	.p2align 3
+.L1205:
+	xorl	%r8d, %r8d
+	movl	$621, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1206
+	.cfi_endproc
+.LFE60:
+	.size	testParseBufferNotTerminated, .-testParseBufferNotTerminated
+	.p2align 4
+	.globl	testParseReservesMaterials
+	.type	testParseReservesMaterials, @function
+testParseReservesMaterials:
+.LFB61:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	$27, %edx
+	subq	$192, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC179(%rip), %xmm0
+	leaq	80(%rsp), %rbx
+	leaq	32(%rsp), %rcx
+	movq	%rsp, %rsi
+	movl	$0, 68(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC180(%rip), %xmm0
+	movq	%rbx, %rdi
+	movl	$64, 32(%rsp)
+	movups	%xmm0, 12(%rsp)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 36(%rsp)
+	movups	%xmm0, 52(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1228
+	addl	$1, asserts_passed(%rip)
+.L1229:
+	movl	88(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1230
+	movl	92(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$64, %rcx
+	jne	.L1232
+.L1235:
+	addl	$1, asserts_passed(%rip)
+.L1233:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$192, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1230:
+	.cfi_restore_state
+	movl	$2, %r8d
+	movl	$636, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	92(%rsp), %ecx
+	cmpq	$64, %rcx
+	je	.L1235
+.L1232:
+	movl	$64, %r8d
+	movl	$637, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1233
+	.p2align 4,,10
+	.p2align 3
+.L1228:
+	xorl	%r8d, %r8d
+	movl	$635, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1229
+	.cfi_endproc
+.LFE61:
+	.size	testParseReservesMaterials, .-testParseReservesMaterials
+	.section	.rodata.str1.1
+.LC182:
+	.string	"replaced.png"
+	.text
+	.p2align 4
+	.globl	testParseArena
+	.type	testParseArena, @function
+testParseArena:
+.LFB62:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$93, %edx
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$256, %rsp
+	.cfi_def_cfa_offset 288
+	movdqa	.LC183(%rip), %xmm0
+	leaq	144(%rsp), %r12
+	movq	%rsp, %rcx
+	leaq	48(%rsp), %rsi
+	movq	$0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movdqa	.LC184(%rip), %xmm0
+	movq	%r12, %rdi
+	movaps	%xmm0, 64(%rsp)
+	movdqa	.LC185(%rip), %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movdqa	.LC186(%rip), %xmm0
+	movaps	%xmm0, 96(%rsp)
+	movdqa	.LC187(%rip), %xmm0
+	movaps	%xmm0, 112(%rsp)
+	movdqa	.LC188(%rip), %xmm0
+	movups	%xmm0, 126(%rsp)
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, (%rsp)
+	movaps	%xmm0, 16(%rsp)
+	movl	$1, 4(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1237
+	addl	$1, asserts_passed(%rip)
+.L1238:
+	movl	236(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1239
+	addl	$1, asserts_passed(%rip)
+.L1240:
+	movl	152(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1241
+	movq	144(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L1243
+.L1258:
+	leaq	.LC174(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1256
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1246:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$654, %edx
+	xorl	%eax, %eax
+	leaq	.LC174(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	144(%rsp), %rbx
+	movq	152(%rbx), %rbp
+	testq	%rbp, %rbp
+	je	.L1247
+.L1257:
+	leaq	.LC182(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1248
+	movq	736(%rbx), %rbx
+	addl	$1, asserts_passed(%rip)
+	testq	%rbx, %rbx
+	je	.L1251
+.L1259:
+	leaq	.LC16(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1252
+	addl	$1, asserts_passed(%rip)
+.L1253:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$256, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1256:
+	.cfi_restore_state
+	movq	152(%rbx), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	jne	.L1257
+.L1247:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1250
+	.p2align 4,,10
+	.p2align 3
+.L1241:
+	movl	$2, %r8d
+	movl	$653, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	144(%rsp), %rbx
+	movq	(%rbx), %rbp
+	testq	%rbp, %rbp
+	jne	.L1258
+.L1243:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1246
+	.p2align 4,,10
+	.p2align 3
+.L1239:
+	movl	$1, %r8d
+	movl	$652, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1240
+	.p2align 4,,10
+	.p2align 3
+.L1252:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1254:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$656, %edx
+	xorl	%eax, %eax
+	leaq	.LC16(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L1253
+	.p2align 4,,10
+	.p2align 3
+.L1248:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1250:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$655, %edx
+	xorl	%eax, %eax
+	leaq	.LC182(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	144(%rsp), %rbx
+	movq	736(%rbx), %rbx
+	testq	%rbx, %rbx
+	jne	.L1259
+.L1251:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L1254
+	.p2align 4,,10
+	.p2align 3
+.L1237:
+	xorl	%r8d, %r8d
+	movl	$651, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1238
+	.cfi_endproc
+.LFE62:
+	.size	testParseArena, .-testParseArena
+	.section	.rodata.str1.1
+.LC189:
+	.string	"shared.png"
+	.text
+	.p2align 4
+	.globl	testParseSharedTextures
+	.type	testParseSharedTextures, @function
+testParseSharedTextures:
+.LFB63:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$224, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC183(%rip), %xmm0
+	leaq	112(%rsp), %rbp
+	movq	%rsp, %rsi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC190(%rip), %xmm0
+	movq	%rbp, %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC191(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movdqa	.LC192(%rip), %xmm0
+	movaps	%xmm0, 48(%rsp)
+	movdqa	.LC193(%rip), %xmm0
+	movaps	%xmm0, 64(%rsp)
+	movdqa	.LC194(%rip), %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movdqa	.LC195(%rip), %xmm0
+	movups	%xmm0, 95(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1261
+	addl	$1, asserts_passed(%rip)
+.L1262:
+	movl	152(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1263
+	movq	144(%rsp), %rbx
+	addl	$1, asserts_passed(%rip)
+	movq	(%rbx), %r12
+	testq	%r12, %r12
+	je	.L1265
+.L1289:
+	leaq	.LC189(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1286
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1268:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$671, %edx
+	xorl	%eax, %eax
+	leaq	.LC189(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	144(%rsp), %rbx
+	movq	8(%rbx), %rbx
+	testq	%rbx, %rbx
+	je	.L1269
+.L1288:
+	leaq	.LC75(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1270
+	addl	$1, asserts_passed(%rip)
+.L1271:
+	movq	112(%rsp), %rbx
+	movl	160(%rbx), %ecx
+	cmpq	$1, %rcx
+	jne	.L1273
+	addl	$1, asserts_passed(%rip)
+.L1274:
+	movl	616(%rbx), %ecx
+	cmpq	$1, %rcx
+	jne	.L1275
+	addl	$1, asserts_passed(%rip)
+	movq	608(%rbx), %rax
+	cmpq	%rax, 152(%rbx)
+	je	.L1287
+.L1277:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$676, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1278:
+	movl	176(%rbx), %ecx
+	cmpq	$2, %rcx
+	jne	.L1279
+	addl	$1, asserts_passed(%rip)
+.L1280:
+	movl	744(%rbx), %ecx
+	cmpq	$2, %rcx
+	jne	.L1281
+	movl	632(%rbx), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1283
+.L1290:
+	addl	$1, asserts_passed(%rip)
+.L1284:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$224, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1286:
+	.cfi_restore_state
+	movq	8(%rbx), %rbx
+	addl	$1, asserts_passed(%rip)
+	testq	%rbx, %rbx
+	jne	.L1288
+.L1269:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L1272
+	.p2align 4,,10
+	.p2align 3
+.L1263:
+	movl	$2, %r8d
+	movl	$670, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	144(%rsp), %rbx
+	movq	(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L1289
+.L1265:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L1268
+	.p2align 4,,10
+	.p2align 3
+.L1281:
+	movl	$2, %r8d
+	movl	$678, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	632(%rbx), %ecx
+	testq	%rcx, %rcx
+	je	.L1290
+.L1283:
+	xorl	%r8d, %r8d
+	movl	$679, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1284
+	.p2align 4,,10
+	.p2align 3
+.L1279:
+	movl	$2, %r8d
+	movl	$677, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1280
+	.p2align 4,,10
+	.p2align 3
+.L1275:
+	movl	$1, %r8d
+	movl	$675, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	608(%rbx), %rax
+	cmpq	%rax, 152(%rbx)
+	jne	.L1277
+.L1287:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1278
+	.p2align 4,,10
+	.p2align 3
+.L1273:
+	movl	$1, %r8d
+	movl	$674, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1274
+	.p2align 4,,10
+	.p2align 3
+.L1270:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1272:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$672, %edx
+	xorl	%eax, %eax
+	leaq	.LC75(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L1271
+	.p2align 4,,10
+	.p2align 3
+.L1261:
+	xorl	%r8d, %r8d
+	movl	$669, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1262
+	.cfi_endproc
+.LFE63:
+	.size	testParseSharedTextures, .-testParseSharedTextures
+	.p2align 4
+	.globl	testParseCarriageReturns
+	.type	testParseCarriageReturns, @function
+testParseCarriageReturns:
+.LFB64:
+	.cfi_startproc
+	movabsq	$2829487652744820, %rax
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC20(%rip), %xmm0
+	leaq	64(%rsp), %rbp
+	movq	%rsp, %rsi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC196(%rip), %xmm0
+	movq	%rbp, %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC197(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movq	%rax, 47(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1292
+	addl	$1, asserts_passed(%rip)
+.L1293:
+	movl	72(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1294
+	addl	$1, asserts_passed(%rip)
+.L1295:
+	movq	64(%rsp), %rax
+	movsd	.LC24(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	16(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1296
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1307
+.L1296:
+	movl	$691, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	64(%rsp), %rax
+	movq	152(%rax), %rbx
+	testq	%rbx, %rbx
+	je	.L1300
+.L1309:
+	leaq	.LC146(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1308
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1303:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$692, %edx
+	xorl	%eax, %eax
+	leaq	.LC146(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+.L1302:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1308:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1302
+	.p2align 4,,10
+	.p2align 3
+.L1307:
+	movq	152(%rax), %rbx
+	addl	$1, asserts_passed(%rip)
+	testq	%rbx, %rbx
+	jne	.L1309
+.L1300:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L1303
+	.p2align 4,,10
+	.p2align 3
+.L1294:
+	movl	$1, %r8d
+	movl	$690, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1295
+	.p2align 4,,10
+	.p2align 3
+.L1292:
+	xorl	%r8d, %r8d
+	movl	$689, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1293
+	.cfi_endproc
+.LFE64:
+	.size	testParseCarriageReturns, .-testParseCarriageReturns
+	.section	.rodata.str1.1
+.LC199:
+	.string	"newmtl m%u\r\nKd 0.5 0.5 0.5\n"
+.LC208:
+	.string	"\nnewmtl last\nmap_Kd last.png"
+.LC209:
+	.string	"last.png"
+.LC210:
+	.string	"last"
+	.text
+	.p2align 4
+	.globl	testParseLongLines
+	.type	testParseLongLines, @function
+testParseLongLines:
+.LFB65:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	$300000, %edi
+	leaq	.LC199(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	$300000, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	xorl	%ebx, %ebx
+	subq	$304, %rsp
+	.cfi_def_cfa_offset 352
+	call	malloc@PLT
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1311:
+	movq	%r13, %rsi
+	leaq	(%r12,%rbx), %rdi
+	movl	%ebp, %ecx
+	movq	%r14, %rdx
+	subq	%rbx, %rsi
+	xorl	%eax, %eax
+	addl	$1, %ebp
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbx
+	cmpl	$1000, %ebp
+	jne	.L1311
+	movb	$35, (%r12,%rbx)
+	leaq	1(%r12,%rbx), %rax
+	movdqa	.LC198(%rip), %xmm8
+	pxor	%xmm4, %xmm4
+	movdqa	.LC200(%rip), %xmm13
+	movdqa	.LC201(%rip), %xmm7
+	leaq	200000(%rax), %rdx
+	movdqa	.LC202(%rip), %xmm6
+	movdqa	.LC203(%rip), %xmm5
+	movdqa	.LC204(%rip), %xmm12
+	movdqa	.LC205(%rip), %xmm11
+	movdqa	.LC206(%rip), %xmm10
+	movdqa	.LC207(%rip), %xmm9
+	.p2align 4,,10
+	.p2align 3
+.L1312:
+	movdqa	%xmm8, %xmm2
+	movdqa	%xmm5, %xmm1
+	movdqa	%xmm5, %xmm14
+	addq	$16, %rax
+	movdqa	%xmm2, %xmm0
+	movdqa	%xmm2, %xmm3
+	paddd	%xmm13, %xmm8
+	pand	%xmm7, %xmm0
+	paddd	%xmm12, %xmm3
+	pcmpeqd	%xmm4, %xmm0
+	pand	%xmm7, %xmm3
+	pcmpeqd	%xmm4, %xmm3
+	pand	%xmm0, %xmm1
+	pandn	%xmm6, %xmm0
+	por	%xmm1, %xmm0
+	movdqa	%xmm5, %xmm1
+	pand	%xmm3, %xmm1
+	pandn	%xmm6, %xmm3
+	por	%xmm1, %xmm3
+	movdqa	%xmm2, %xmm1
+	paddd	%xmm10, %xmm2
+	paddd	%xmm11, %xmm1
+	pand	%xmm7, %xmm2
+	pand	%xmm7, %xmm1
+	pcmpeqd	%xmm4, %xmm2
+	pcmpeqd	%xmm4, %xmm1
+	pand	%xmm1, %xmm14
+	pandn	%xmm6, %xmm1
+	por	%xmm14, %xmm1
+	movdqa	%xmm5, %xmm14
+	pand	%xmm2, %xmm14
+	pandn	%xmm6, %xmm2
+	por	%xmm14, %xmm2
+	movdqa	%xmm0, %xmm14
+	punpcklwd	%xmm3, %xmm0
+	punpckhwd	%xmm3, %xmm14
+	movdqa	%xmm0, %xmm3
+	punpckhwd	%xmm14, %xmm3
+	punpcklwd	%xmm14, %xmm0
+	punpcklwd	%xmm3, %xmm0
+	movdqa	%xmm1, %xmm3
+	punpcklwd	%xmm2, %xmm1
+	punpckhwd	%xmm2, %xmm3
+	movdqa	%xmm1, %xmm2
+	pand	%xmm9, %xmm0
+	punpckhwd	%xmm3, %xmm2
+	punpcklwd	%xmm3, %xmm1
+	punpcklwd	%xmm2, %xmm1
+	pand	%xmm9, %xmm1
+	packuswb	%xmm1, %xmm0
+	movups	%xmm0, -16(%rax)
+	cmpq	%rax, %rdx
+	jne	.L1312
+	addq	$200001, %rbx
+	movl	$300000, %esi
+	leaq	.LC208(%rip), %rdx
+	xorl	%eax, %eax
+	subq	%rbx, %rsi
+	leaq	(%r12,%rbx), %rdi
+	leaq	16(%rsp), %rbp
+	call	snprintf@PLT
+	xorl	%ecx, %ecx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	cltq
+	addq	%rax, %rbx
+	movq	%rbx, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1313
+	addl	$1, asserts_passed(%rip)
+.L1314:
+	movl	24(%rsp), %ecx
+	cmpq	$1001, %rcx
+	jne	.L1315
+	addl	$1, asserts_passed(%rip)
+.L1316:
+	movq	16(%rsp), %rax
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	455572(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1318
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1336
+.L1318:
+	movl	$712, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	16(%rsp), %rax
+	movq	456152(%rax), %r13
+	testq	%r13, %r13
+	je	.L1322
+.L1338:
+	leaq	.LC209(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1337
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1324:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r13, %rcx
+	movl	$713, %edx
+	xorl	%eax, %eax
+	leaq	.LC209(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L1317
+.L1315:
+	xorl	%eax, %eax
+	movl	$1001, %r8d
+	movl	$710, %edx
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	call	printf@PLT
+	cmpl	$1001, 24(%rsp)
+	je	.L1316
+.L1317:
+	movq	%rbp, %rdi
+	leaq	128(%rsp), %rbp
+	call	wavefrontMTLRelease@PLT
+	xorl	%ecx, %ecx
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexCompose@PLT
+	leaq	12(%rsp), %rdx
+	leaq	.LC210(%rip), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexFind@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1325
+	addl	$1, asserts_passed(%rip)
+.L1326:
+	movslq	12(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L1327
+	addl	$1, asserts_passed(%rip)
+.L1328:
+	movl	152(%rsp), %ecx
+	cmpq	$1001, %rcx
+	jne	.L1329
+	addl	$1, asserts_passed(%rip)
+.L1330:
+	movq	%rbp, %rdi
+	call	wavefrontMTLIndexRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	addq	$304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L1329:
+	.cfi_restore_state
+	movl	$1001, %r8d
+	movl	$723, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1330
+.L1327:
+	xorl	%r8d, %r8d
+	movl	$722, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1328
+.L1313:
+	xorl	%r8d, %r8d
+	movl	$709, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1314
+.L1325:
+	xorl	%r8d, %r8d
+	movl	$721, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1326
+.L1337:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1317
+.L1336:
+	movq	456152(%rax), %r13
+	addl	$1, asserts_passed(%rip)
+	testq	%r13, %r13
+	jne	.L1338
+.L1322:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r13
+	addl	$1, %eax
+	jmp	.L1324
+	.cfi_endproc
+.LFE65:
+	.size	testParseLongLines, .-testParseLongLines
+	.p2align 4
+	.globl	testParseDuplicateMaterial
+	.type	testParseDuplicateMaterial, @function
+testParseDuplicateMaterial:
+.LFB66:
+	.cfi_startproc
+	movabsq	$2871023236047947, %rax
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$192, %rsp
+	.cfi_def_cfa_offset 208
+	movdqa	.LC211(%rip), %xmm0
+	leaq	80(%rsp), %rbx
+	movq	%rsp, %rsi
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC177(%rip), %xmm0
+	movq	%rbx, %rdi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC212(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	movdqa	.LC213(%rip), %xmm0
+	movaps	%xmm0, 48(%rsp)
+	movq	%rax, 62(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1340
+	addl	$1, asserts_passed(%rip)
+.L1341:
+	movl	88(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1342
+	addl	$1, asserts_passed(%rip)
+.L1343:
+	movq	80(%rsp), %rax
+	movsd	.LC22(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	8(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1344
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1369
+.L1344:
+	movl	$739, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rcx
+	movq	80(%rsp), %rax
+	movq	%rcx, %xmm2
+.L1347:
+	movsd	.LC72(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1348
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1370
+.L1348:
+	movl	$740, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rdx
+	movq	80(%rsp), %rax
+	movq	%rdx, %xmm2
+.L1351:
+	movsd	.LC11(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	464(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1352
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1371
+.L1352:
+	movl	$741, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rdx
+	movq	80(%rsp), %rax
+	movq	%rdx, %xmm2
+.L1355:
+	pxor	%xmm0, %xmm0
+	cvtss2sd	480(%rax), %xmm0
+	comisd	%xmm0, %xmm2
+	jbe	.L1356
+	pxor	%xmm1, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1372
+.L1356:
+	pxor	%xmm1, %xmm1
+	movl	$742, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1359:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$192, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1372:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1359
+	.p2align 4,,10
+	.p2align 3
+.L1371:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1355
+	.p2align 4,,10
+	.p2align 3
+.L1370:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1351
+	.p2align 4,,10
+	.p2align 3
+.L1369:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1347
+	.p2align 4,,10
+	.p2align 3
+.L1342:
+	movl	$2, %r8d
+	movl	$738, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1343
+	.p2align 4,,10
+	.p2align 3
+.L1340:
+	xorl	%r8d, %r8d
+	movl	$737, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1341
+	.cfi_endproc
+.LFE66:
+	.size	testParseDuplicateMaterial, .-testParseDuplicateMaterial
+	.p2align 4
+	.globl	testParsePropertyBeforeMaterial
+	.type	testParsePropertyBeforeMaterial, @function
+testParsePropertyBeforeMaterial:
+.LFB67:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$160, %rsp
+	.cfi_def_cfa_offset 176
+	movdqa	.LC214(%rip), %xmm0
+	leaq	48(%rsp), %rbx
+	movq	%rsp, %rsi
+	movl	$683105, 32(%rsp)
+	movaps	%xmm0, (%rsp)
+	movdqa	.LC215(%rip), %xmm0
+	movq	%rbx, %rdi
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1374
+	addl	$1, asserts_passed(%rip)
+.L1375:
+	movl	56(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1376
+	addl	$1, asserts_passed(%rip)
+.L1377:
+	movq	48(%rsp), %rax
+	movsd	.LC12(%rip), %xmm2
+	pxor	%xmm0, %xmm0
+	cvtss2sd	8(%rax), %xmm0
+	comisd	%xmm0, %xmm2
+	jbe	.L1378
+	pxor	%xmm1, %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	ja	.L1385
+.L1378:
+	pxor	%xmm1, %xmm1
+	movl	$753, %edx
+	leaq	.LC0(%rip), %rsi
+	movl	$2, %eax
+	leaq	.LC13(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1381:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$160, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1385:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1381
+	.p2align 4,,10
+	.p2align 3
+.L1376:
+	movl	$1, %r8d
+	movl	$752, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1377
+	.p2align 4,,10
+	.p2align 3
+.L1374:
+	xorl	%r8d, %r8d
+	movl	$751, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1375
+	.cfi_endproc
+.LFE67:
+	.size	testParsePropertyBeforeMaterial, .-testParsePropertyBeforeMaterial
+	.p2align 4
+	.globl	assertMTLsEqual
+	.type	assertMTLsEqual, @function
+assertMTLsEqual:
+.LFB68:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r11
+	movq	%rsi, %r10
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movl	8(%rdi), %ecx
+	movl	8(%rsi), %r8d
+	cmpq	%r8, %rcx
+	jne	.L1387
+	addl	$1, asserts_passed(%rip)
+.L1388:
+	movl	40(%r11), %ecx
+	movl	40(%r10), %r8d
+	movq	%rcx, %rax
+	cmpq	%r8, %rcx
+	jne	.L1389
+	addl	$1, asserts_passed(%rip)
+.L1393:
+	xorl	%ebx, %ebx
+	leaq	.LC0(%rip), %r12
+	movq	%r10, %r15
+	leaq	.LC2(%rip), %rbp
+	leaq	.LC10(%rip), %r13
+	testl	%eax, %eax
+	jne	.L1390
+	jmp	.L1399
+	.p2align 4,,10
+	.p2align 3
+.L1447:
+	testq	%r14, %r14
+	je	.L1394
+	movq	%rcx, %rdi
+	movq	%r14, %rsi
+	movq	%r11, 16(%rsp)
+	movq	%rcx, 8(%rsp)
+	call	strcmp@PLT
+	movq	8(%rsp), %rcx
+	movq	16(%rsp), %r11
+	testl	%eax, %eax
+	jne	.L1395
+	addl	$1, asserts_passed(%rip)
+	addl	$1, %ebx
+	cmpl	40(%r11), %ebx
+	jnb	.L1445
+.L1390:
+	cmpl	40(%r15), %ebx
+	jnb	.L1445
+	movq	32(%r11), %rdx
+	movl	%ebx, %eax
+	movq	(%rdx,%rax,8), %rcx
+	movq	32(%r15), %rdx
+	movq	(%rdx,%rax,8), %r14
+	testq	%rcx, %rcx
+	jne	.L1447
+.L1394:
+	addl	$1, asserts_failed(%rip)
+	testq	%r14, %r14
+	jne	.L1418
+	movq	%r13, %r14
+	testq	%rcx, %rcx
+	je	.L1448
+.L1398:
+	movq	%r14, %r8
+	movl	$779, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	movq	%r11, 8(%rsp)
+	addl	$1, %ebx
+	call	printf@PLT
+	movq	8(%rsp), %r11
+	cmpl	40(%r11), %ebx
+	jb	.L1390
+.L1445:
+	movq	%r15, %r10
+.L1399:
+	movl	8(%r11), %eax
+	cmpl	8(%r10), %eax
+	jne	.L1386
+	testl	%eax, %eax
+	je	.L1386
+	movq	%r11, 8(%rsp)
+	xorl	%r15d, %r15d
+	leaq	.LC0(%rip), %r12
+	movq	%r10, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1416:
+	movq	8(%rsp), %rax
+	movl	%r15d, %ebp
+	imulq	$456, %rbp, %rbp
+	movq	(%rax), %r13
+	movq	24(%rsp), %rax
+	addq	%rbp, %r13
+	addq	(%rax), %rbp
+	movq	0(%r13), %rbx
+	movq	0(%rbp), %r14
+	testq	%rbx, %rbx
+	je	.L1401
+	testq	%r14, %r14
+	je	.L1401
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1402
+	addl	$1, asserts_passed(%rip)
+.L1403:
+	leaq	8(%rbp), %rsi
+	leaq	8(%r13), %rdi
+	movl	$128, %edx
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1405
+	addl	$1, asserts_passed(%rip)
+.L1406:
+	movl	%r15d, 16(%rsp)
+	xorl	%ebx, %ebx
+	jmp	.L1415
+	.p2align 4,,10
+	.p2align 3
+.L1451:
+	movq	(%r15), %r15
+	addl	$1, asserts_passed(%rip)
+	movq	(%r14), %r14
+	testq	%r15, %r15
+	je	.L1449
+.L1409:
+	testq	%r14, %r14
+	je	.L1412
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1413
+	addl	$1, asserts_passed(%rip)
+.L1410:
+	addl	$1, %ebx
+	cmpl	$20, %ebx
+	je	.L1450
+.L1415:
+	movl	%ebx, %esi
+	movq	%r13, %rdi
+	call	wavefrontMaterialMap@PLT
+	movl	%ebx, %esi
+	movq	%rbp, %rdi
+	movq	%rax, %r15
+	call	wavefrontMaterialMap@PLT
+	movl	8(%r15), %ecx
+	movl	8(%rax), %r8d
+	movq	%rax, %r14
+	cmpq	%r8, %rcx
+	je	.L1451
+	movl	$790, %edx
+	movq	%r12, %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%r15), %r15
+	movq	(%r14), %r14
+	testq	%r15, %r15
+	jne	.L1409
+.L1449:
+	testq	%r14, %r14
+	je	.L1410
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r15
+	addl	$1, %eax
+.L1411:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %r8
+	movq	%r15, %rcx
+	movq	%r12, %rsi
+	movl	$791, %edx
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, %ebx
+	call	printf@PLT
+	cmpl	$20, %ebx
+	jne	.L1415
+.L1450:
+	movl	16(%rsp), %r15d
+	movq	8(%rsp), %rax
+	addl	$1, %r15d
+	cmpl	8(%rax), %r15d
+	jb	.L1416
+.L1386:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1395:
+	.cfi_restore_state
+	addl	$1, asserts_failed(%rip)
+	jmp	.L1398
+	.p2align 4,,10
+	.p2align 3
+.L1418:
+	movq	%r13, %rcx
+	jmp	.L1398
+.L1448:
+	leaq	.LC10(%rip), %r14
+	movq	%r14, %rcx
+	jmp	.L1398
+	.p2align 4,,10
+	.p2align 3
+.L1413:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+	jmp	.L1411
+	.p2align 4,,10
+	.p2align 3
+.L1412:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r14
+	addl	$1, %eax
+	jmp	.L1411
+	.p2align 4,,10
+	.p2align 3
+.L1401:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+	testq	%r14, %r14
+	je	.L1452
+	leaq	.LC10(%rip), %rbx
+.L1404:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %r8
+	movq	%rbx, %rcx
+	movq	%r12, %rsi
+	movl	$784, %edx
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	jmp	.L1403
+	.p2align 4,,10
+	.p2align 3
+.L1405:
+	xorl	%r8d, %r8d
+	movl	$785, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1406
+	.p2align 4,,10
+	.p2align 3
+.L1402:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+	jmp	.L1404
+.L1452:
+	leaq	.LC10(%rip), %r14
+	testq	%rbx, %rbx
+	jne	.L1404
+	movq	%r14, %rbx
+	jmp	.L1404
+	.p2align 4,,10
+	.p2align 3
+.L1389:
+	movl	$777, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	movq	%r10, 16(%rsp)
+	leaq	.LC1(%rip), %rdi
+	movq	%r11, 8(%rsp)
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	8(%rsp), %r11
+	movq	16(%rsp), %r10
+	movl	40(%r11), %eax
+	jmp	.L1393
+.L1387:
+	movq	%rsi, 16(%rsp)
+	movl	$776, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	movq	%rdi, 8(%rsp)
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	16(%rsp), %r10
+	movq	8(%rsp), %r11
+	jmp	.L1388
+	.cfi_endproc
+.LFE68:
+	.size	assertMTLsEqual, .-assertMTLsEqual
+	.p2align 4
+	.globl	testParseChunked
+	.type	testParseChunked, @function
+testParseChunked:
+.LFB69:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	libraryInput(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rbp, %rsi
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 432
+	leaq	16(%rsp), %rdi
+	movq	%rdi, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1454
+	addl	$1, asserts_passed(%rip)
+.L1455:
+	movl	24(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1456
+	addl	$1, asserts_passed(%rip)
+.L1457:
+	movl	$1, %r14d
+	leaq	128(%rsp), %r12
+	leaq	240(%rsp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L1464:
+	xorl	%edx, %edx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movl	$236, %r13d
+	call	wavefrontMTLParserCompose@PLT
+	xorl	%r15d, %r15d
+	testl	%eax, %eax
+	jne	.L1475
+	.p2align 4,,10
+	.p2align 3
+.L1458:
+	cmpq	%r14, %r13
+	movq	%r14, %rdx
+	leaq	0(%rbp,%r15), %rsi
+	movq	%rbx, %rdi
+	cmovbe	%r13, %rdx
+	call	wavefrontMTLParserFeed@PLT
+	cmpq	$68, 272(%rsp)
+	ja	.L1466
+	addq	%r14, %r15
+	subq	%r14, %r13
+	testl	%eax, %eax
+	jne	.L1475
+	cmpq	$235, %r15
+	jbe	.L1458
+	testl	%eax, %eax
+	jne	.L1475
+	movq	%rbx, %rdi
+	call	wavefrontMTLParserFinish@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1462
+	addl	$1, asserts_passed(%rip)
+	.p2align 4,,10
+	.p2align 3
+.L1463:
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdi
+	addq	$1, %r14
+	call	assertMTLsEqual
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	cmpq	$237, %r14
+	jne	.L1464
+	movq	8(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$376, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1466:
+	.cfi_restore_state
+	movl	$1, %ecx
+.L1462:
+	xorl	%r8d, %r8d
+	movl	$814, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1463
+	.p2align 4,,10
+	.p2align 3
+.L1475:
+	movslq	%eax, %rcx
+	jmp	.L1462
+.L1456:
+	movl	$2, %r8d
+	movl	$800, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1457
+.L1454:
+	xorl	%r8d, %r8d
+	movl	$799, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1455
+	.cfi_endproc
+.LFE69:
+	.size	testParseChunked, .-testParseChunked
+	.section	.rodata.str1.1
+.LC216:
+	.string	"newmtl first\nKa 0.1 0."
+.LC217:
+	.string	"2 0.3 asdf\n"
+.LC218:
+	.string	"Kd 1\n"
+	.text
+	.p2align 4
+	.globl	testParseChunkedError
+	.type	testParseChunkedError, @function
+testParseChunkedError:
+.LFB70:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%edx, %edx
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 272
+	leaq	112(%rsp), %rbx
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLParserCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1478
+	addl	$1, asserts_passed(%rip)
+.L1479:
+	leaq	.LC216(%rip), %rbp
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLParserFeed@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1480
+	addl	$1, asserts_passed(%rip)
+.L1481:
+	leaq	.LC217(%rip), %rbp
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLParserFeed@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1482
+	movl	8(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1484
+.L1491:
+	addl	$1, asserts_passed(%rip)
+.L1485:
+	leaq	.LC218(%rip), %rbp
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLParserFeed@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1486
+	addl	$1, asserts_passed(%rip)
+.L1487:
+	movq	%rbx, %rdi
+	call	wavefrontMTLParserFinish@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1488
+	addl	$1, asserts_passed(%rip)
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1482:
+	.cfi_restore_state
+	movl	$3, %r8d
+	movl	$830, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	8(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1491
+.L1484:
+	xorl	%r8d, %r8d
+	movl	$831, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1485
+	.p2align 4,,10
+	.p2align 3
+.L1488:
+	movl	$3, %r8d
+	movl	$835, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1486:
+	.cfi_restore_state
+	movl	$3, %r8d
+	movl	$833, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1487
+	.p2align 4,,10
+	.p2align 3
+.L1480:
+	xorl	%r8d, %r8d
+	movl	$828, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1481
+	.p2align 4,,10
+	.p2align 3
+.L1478:
+	xorl	%r8d, %r8d
+	movl	$826, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1479
+	.cfi_endproc
+.LFE70:
+	.size	testParseChunkedError, .-testParseChunkedError
+	.section	.rodata.str1.1
+.LC219:
+	.string	"wb"
+.LC220:
+	.string	"bin/test_parse_file.mtl"
+	.text
+	.p2align 4
+	.globl	testParseFile
+	.type	testParseFile, @function
+testParseFile:
+.LFB72:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	.LC219(%rip), %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	leaq	.LC220(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rbp, %rdi
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 272
+	call	fopen@PLT
+	testq	%rax, %rax
+	je	.L1501
+	movq	%rax, %rcx
+	movl	$236, %edx
+	movl	$1, %esi
+	movq	%rax, %rbx
+	leaq	libraryInput(%rip), %r13
+	movq	%r13, %rdi
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %r12
+	call	fclose@PLT
+	cmpq	$236, %r12
+	je	.L1502
+.L1493:
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$849, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1494:
+	movq	%rsp, %rbx
+	movq	%r13, %rsi
+	leaq	112(%rsp), %r12
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	xorl	%edx, %edx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1495
+	addl	$1, asserts_passed(%rip)
+.L1496:
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	assertMTLsEqual
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	remove@PLT
+	addq	$232, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1502:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1494
+	.p2align 4,,10
+	.p2align 3
+.L1495:
+	xorl	%r8d, %r8d
+	movl	$854, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1496
+.L1501:
+	leaq	libraryInput(%rip), %r13
+	jmp	.L1493
+	.cfi_endproc
+.LFE72:
+	.size	testParseFile, .-testParseFile
+	.p2align 4
+	.globl	testParseFilePageSized
+	.type	testParseFilePageSized, @function
+testParseFilePageSized:
+.LFB73:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	$8192, %edx
+	movl	$35, %esi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	.LC220(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$8336, %rsp
+	.cfi_def_cfa_offset 8368
+	leaq	144(%rsp), %r12
+	movq	%r12, %rdi
+	call	memset@PLT
+	movdqa	.LC222(%rip), %xmm0
+	movq	%rsp, %rsi
+	movabsq	$14968966873117518, %rax
+	leaq	8316(%rsp), %rdi
+	movl	$20, %edx
+	movaps	%xmm0, (%rsp)
+	movq	%rax, 13(%rsp)
+	call	memcpy@PLT
+	leaq	.LC219(%rip), %rsi
+	movq	%rbp, %rdi
+	call	fopen@PLT
+	testq	%rax, %rax
+	je	.L1504
+	movq	%r12, %rdi
+	movq	%rax, %rcx
+	movl	$8192, %edx
+	movl	$1, %esi
+	movq	%rax, %rbx
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %r12
+	call	fclose@PLT
+	cmpq	$8192, %r12
+	je	.L1520
+.L1504:
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$870, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1505:
+	leaq	32(%rsp), %rbx
+	xorl	%edx, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1506
+	addl	$1, asserts_passed(%rip)
+.L1507:
+	movl	40(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1508
+	addl	$1, asserts_passed(%rip)
+.L1509:
+	movq	32(%rsp), %rax
+	movsd	.LC221(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	88(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1511
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1511
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1510
+	.p2align 4,,10
+	.p2align 3
+.L1520:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1505
+	.p2align 4,,10
+	.p2align 3
+.L1508:
+	movl	$1, %r8d
+	movl	$875, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	40(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1509
+.L1510:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	remove@PLT
+	addq	$8336, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1511:
+	.cfi_restore_state
+	movl	$876, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1510
+	.p2align 4,,10
+	.p2align 3
+.L1506:
+	xorl	%r8d, %r8d
+	movl	$874, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1507
+	.cfi_endproc
+.LFE73:
+	.size	testParseFilePageSized, .-testParseFilePageSized
+	.section	.rodata.str1.1
+.LC223:
+	.string	""
+	.text
+	.p2align 4
+	.globl	testParseFileEmpty
+	.type	testParseFileEmpty, @function
+testParseFileEmpty:
+.LFB74:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	.LC219(%rip), %rsi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	.LC220(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rbp, %rdi
+	subq	$112, %rsp
+	.cfi_def_cfa_offset 144
+	call	fopen@PLT
+	testq	%rax, %rax
+	je	.L1522
+	xorl	%edx, %edx
+	leaq	.LC223(%rip), %rdi
+	movq	%rax, %rcx
+	movq	%rax, %rbx
+	movl	$1, %esi
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %r12
+	call	fclose@PLT
+	testq	%r12, %r12
+	je	.L1532
+.L1522:
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$884, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1523:
+	movq	%rsp, %rbx
+	xorl	%edx, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1524
+	movl	8(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1526
+.L1533:
+	addl	$1, asserts_passed(%rip)
+.L1527:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	remove@PLT
+	addq	$112, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1532:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1523
+	.p2align 4,,10
+	.p2align 3
+.L1524:
+	xorl	%r8d, %r8d
+	movl	$887, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	8(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1533
+.L1526:
+	xorl	%r8d, %r8d
+	movl	$888, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1527
+	.cfi_endproc
+.LFE74:
+	.size	testParseFileEmpty, .-testParseFileEmpty
+	.section	.rodata.str1.1
+.LC224:
+	.string	"bin/does_not_exist.mtl"
+	.text
+	.p2align 4
+	.globl	testParseFileMissing
+	.type	testParseFileMissing, @function
+testParseFileMissing:
+.LFB75:
+	.cfi_startproc
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 128
+	xorl	%edx, %edx
+	leaq	.LC224(%rip), %rsi
+	movq	%rsp, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	cmpl	$2, %eax
+	jne	.L1535
+	addl	$1, asserts_passed(%rip)
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1535:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$2, %r8d
+	xorl	%eax, %eax
+	movl	$896, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$120, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE75:
+	.size	testParseFileMissing, .-testParseFileMissing
+	.section	.rodata.str1.8
+	.align 8
+.LC225:
+	.string	"newmtl material_%u\nKd %u.25 0.5 0.75\nNs %u\nnewmtl invalid name\nmap_Kd textures/diffuse_%u.png\n"
+	.text
+	.p2align 4
+	.globl	testParseParallel
+	.type	testParseParallel, @function
+testParseParallel:
+.LFB77:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	movl	%edi, 8(%rsp)
+	movl	$1024001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1543
+	xorl	%r15d, %r15d
+	xorl	%ebp, %ebp
+	leaq	.LC225(%rip), %r14
+	movl	$3435973837, %r13d
+	movl	$1024001, %r12d
+	.p2align 4,,10
+	.p2align 3
+.L1539:
+	imull	$-1227133513, %ebp, %edx
+	movl	%ebp, %ecx
+	movl	%ebp, %eax
+	subl	$1227133514, %edx
+	cmpl	$613566755, %edx
+	ja	.L1542
+	movl	$2863311531, %ecx
+	imulq	%rax, %rcx
+	shrq	$33, %rcx
+.L1542:
+	movq	%rax, %rdx
+	imulq	$1374389535, %rax, %rax
+	movl	%ebp, %r8d
+	movq	%r12, %rsi
+	imulq	%r13, %rdx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 376
+	subq	%r15, %rsi
+	movl	%ebp, %r9d
+	leaq	(%rbx,%r15), %rdi
+	shrq	$36, %rax
+	imull	$50, %eax, %eax
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	pushq	%r8
+	.cfi_def_cfa_offset 384
+	movl	%ebp, %r8d
+	addl	$1, %ebp
+	subl	%edx, %r8d
+	movq	%r14, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r15
+	popq	%rax
+	.cfi_def_cfa_offset 376
+	popq	%rdx
+	.cfi_def_cfa_offset 368
+	cmpl	$8000, %ebp
+	jne	.L1539
+.L1543:
+	movl	8(%rsp), %eax
+	pxor	%xmm0, %xmm0
+	movq	%rbx, %rdi
+	leaq	32(%rsp), %r14
+	movaps	%xmm0, 32(%rsp)
+	leaq	80(%rsp), %r13
+	movaps	%xmm0, 48(%rsp)
+	movq	$0, 64(%rsp)
+	movl	%eax, 36(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rcx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1559
+	addl	$1, asserts_passed(%rip)
+.L1544:
+	movq	.LC226(%rip), %rax
+	movl	8(%rsp), %ebp
+	movl	$8, 24(%rsp)
+	leaq	16(%rsp), %r15
+	leaq	192(%rsp), %r12
+	movq	%rax, 16(%rsp)
+	leaq	28(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.L1550:
+	movl	(%r15), %eax
+	movq	%rbx, %rdi
+	movl	%eax, 40(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rcx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1545
+	addl	$1, asserts_passed(%rip)
+.L1546:
+	movl	284(%rsp), %ecx
+	cmpq	%rbp, %rcx
+	jne	.L1547
+	addl	$1, asserts_passed(%rip)
+.L1558:
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	addq	$4, %r15
+	call	assertMTLsEqual
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	cmpq	%r15, 8(%rsp)
+	jne	.L1550
+	movq	%r13, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1547:
+	.cfi_restore_state
+	movq	%rbp, %r8
+	movl	$931, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1558
+	.p2align 4,,10
+	.p2align 3
+.L1545:
+	xorl	%r8d, %r8d
+	movl	$930, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1546
+	.p2align 4,,10
+	.p2align 3
+.L1559:
+	xorl	%r8d, %r8d
+	movl	$923, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1544
+	.cfi_endproc
+.LFE77:
+	.size	testParseParallel, .-testParseParallel
+	.section	.rodata.str1.1
+.LC227:
+	.string	"newmtl m%u\nmap_Kd common.png\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC228:
+	.string	"newmtl late\nmap_Kd first_new.png\nnewmtl m5\nmap_Ks second_new.png\nnewmtl last\nmap_Ka replaced.png\nmap_Ka third_new.png\n"
+	.section	.rodata.str1.1
+.LC229:
+	.string	"late"
+	.text
+	.p2align 4
+	.globl	testParseParallelTextureOrder
+	.type	testParseParallelTextureOrder, @function
+testParseParallelTextureOrder:
+.LFB78:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$960256, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC227(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	$960256, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	xorl	%ebx, %ebx
+	subq	$296, %rsp
+	.cfi_def_cfa_offset 352
+	call	malloc@PLT
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L1561:
+	movq	%r13, %rsi
+	leaq	(%r12,%rbx), %rdi
+	movl	%ebp, %ecx
+	movq	%r14, %rdx
+	subq	%rbx, %rsi
+	xorl	%eax, %eax
+	addl	$1, %ebp
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %rbx
+	cmpl	$20000, %ebp
+	jne	.L1561
+	movq	%r13, %rsi
+	leaq	.LC228(%rip), %rdx
+	leaq	(%r12,%rbx), %rdi
+	xorl	%eax, %eax
+	subq	%rbx, %rsi
+	leaq	16(%rsp), %r13
+	leaq	64(%rsp), %rbp
+	call	snprintf@PLT
+	pxor	%xmm0, %xmm0
+	movq	%r12, %rdi
+	movq	$0, 48(%rsp)
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rcx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1562
+	addl	$1, asserts_passed(%rip)
+.L1563:
+	movl	104(%rsp), %ecx
+	cmpq	$5, %rcx
+	jne	.L1564
+	addl	$1, asserts_passed(%rip)
+.L1565:
+	leaq	.LC229(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	64(%rsp), %rbx
+	call	wavefrontMTLFindMaterial@PLT
+	cltq
+	imulq	$456, %rax, %rax
+	movl	160(%rbx,%rax), %ecx
+	cmpq	$2, %rcx
+	jne	.L1566
+	addl	$1, asserts_passed(%rip)
+.L1567:
+	movq	.LC230(%rip), %rax
+	movl	$8, 8(%rsp)
+	movq	%rsp, %r15
+	leaq	12(%rsp), %r14
+	leaq	176(%rsp), %rbx
+	movq	%rax, (%rsp)
+.L1571:
+	movl	(%r15), %eax
+	movq	%r12, %rdi
+	movl	%eax, 24(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rcx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1568
+	addl	$1, asserts_passed(%rip)
+.L1574:
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	addq	$4, %r15
+	call	assertMTLsEqual
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	cmpq	%r14, %r15
+	jne	.L1571
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	free@PLT
+	addq	$296, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1568:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$964, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1574
+.L1564:
+	movl	$5, %r8d
+	movl	$956, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1565
+.L1566:
+	movl	$2, %r8d
+	movl	$957, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1567
+.L1562:
+	xorl	%r8d, %r8d
+	movl	$955, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1563
+	.cfi_endproc
+.LFE78:
+	.size	testParseParallelTextureOrder, .-testParseParallelTextureOrder
+	.section	.rodata.str1.1
+.LC231:
+	.string	"Kd "
+	.text
+	.p2align 4
+	.globl	testParseParallelError
+	.type	testParseParallelError, @function
+testParseParallelError:
+.LFB79:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$1024001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1576
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	movl	$1024001, %ebp
+	movl	$3435973837, %r12d
+	leaq	.LC225(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1578:
+	imull	$-1227133513, %r14d, %edx
+	movl	%r14d, %ecx
+	movl	%r14d, %eax
+	subl	$1227133514, %edx
+	cmpl	$613566755, %edx
+	ja	.L1577
+	movl	$2863311531, %ecx
+	imulq	%rax, %rcx
+	shrq	$33, %rcx
+.L1577:
+	movq	%rax, %rdx
+	imulq	$1374389535, %rax, %rax
+	movl	%r14d, %r8d
+	movq	%rbp, %rsi
+	imulq	%r12, %rdx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 232
+	subq	%r15, %rsi
+	movl	%r14d, %r9d
+	leaq	(%rbx,%r15), %rdi
+	shrq	$36, %rax
+	imull	$50, %eax, %eax
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	pushq	%r8
+	.cfi_def_cfa_offset 240
+	movl	%r14d, %r8d
+	addl	$1, %r14d
+	subl	%edx, %r8d
+	movq	%r13, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r15
+	popq	%rax
+	.cfi_def_cfa_offset 232
+	popq	%rdx
+	.cfi_def_cfa_offset 224
+	cmpl	$8000, %r14d
+	jne	.L1578
+.L1576:
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	leaq	.LC231(%rip), %rsi
+	shrq	%rax
+	leaq	(%rbx,%rax), %rdi
+	call	strstr@PLT
+	pxor	%xmm0, %xmm0
+	movq	%rbx, %rdi
+	movb	$120, 3(%rax)
+	movaps	%xmm0, (%rsp)
+	movaps	%xmm0, 16(%rsp)
+	movq	$0, 32(%rsp)
+	movl	$4, 8(%rsp)
+	call	strlen@PLT
+	movq	%rsp, %rcx
+	leaq	48(%rsp), %rdi
+	movq	%rbx, %rsi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1579
+	movl	56(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1581
+.L1589:
+	addl	$1, asserts_passed(%rip)
+.L1582:
+	movq	%rbx, %rdi
+	call	free@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1579:
+	.cfi_restore_state
+	movl	$3, %r8d
+	movl	$981, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	56(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1589
+.L1581:
+	xorl	%r8d, %r8d
+	movl	$982, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1582
+	.cfi_endproc
+.LFE79:
+	.size	testParseParallelError, .-testParseParallelError
+	.p2align 4
+	.globl	testParseTolerant
+	.type	testParseTolerant, @function
+testParseTolerant:
+.LFB83:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pxor	%xmm0, %xmm0
+	movl	$184, %edx
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	tolerantInput(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rbp, %rsi
+	subq	$512, %rsp
+	.cfi_def_cfa_offset 544
+	leaq	192(%rsp), %rax
+	leaq	80(%rsp), %rbx
+	movq	%rsp, %r12
+	movaps	%xmm0, 32(%rsp)
+	movq	%rax, (%rsp)
+	movq	.LC232(%rip), %rax
+	movq	%rbx, %rdi
+	leaq	32(%rsp), %rcx
+	movq	$3, 16(%rsp)
+	movq	%rax, 8(%rsp)
+	movq	%r12, 64(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1591
+	addl	$1, asserts_passed(%rip)
+.L1592:
+	movq	%r12, %rdi
+	call	assertTolerantDiagnostics
+	movl	88(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1593
+	addl	$1, asserts_passed(%rip)
+.L1594:
+	movq	%rbx, %rdi
+	call	assertTolerantLibrary.part.0
+.L1595:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1596
+	addl	$1, asserts_passed(%rip)
+	addq	$512, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1593:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	movl	$2, %r8d
+	movl	$1029, %edx
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	call	printf@PLT
+	cmpl	$2, 88(%rsp)
+	jne	.L1595
+	jmp	.L1594
+	.p2align 4,,10
+	.p2align 3
+.L1596:
+	movl	$3, %r8d
+	movl	$1056, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$512, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1591:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$1049, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1592
+	.cfi_endproc
+.LFE83:
+	.size	testParseTolerant, .-testParseTolerant
+	.p2align 4
+	.globl	testParseTolerantFull
+	.type	testParseTolerantFull, @function
+testParseTolerantFull:
+.LFB84:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pxor	%xmm0, %xmm0
+	movl	$184, %edx
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	tolerantInput(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rbp, %rsi
+	subq	$304, %rsp
+	.cfi_def_cfa_offset 336
+	leaq	112(%rsp), %rax
+	leaq	64(%rsp), %r12
+	movq	$0, 12(%rsp)
+	leaq	192(%rsp), %rbx
+	movq	%rax, (%rsp)
+	movq	%r12, %rcx
+	movq	%rsp, %rax
+	movq	%rbx, %rdi
+	movl	$0, 20(%rsp)
+	movl	$2, 8(%rsp)
+	movq	%rax, 96(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1600
+	addl	$1, asserts_passed(%rip)
+.L1601:
+	movl	12(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1602
+	movq	16(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$5, %rcx
+	jne	.L1604
+.L1616:
+	addl	$1, asserts_passed(%rip)
+.L1605:
+	movl	$3, %ecx
+	leaq	.LC6(%rip), %rdx
+	movl	$6, %esi
+	leaq	152(%rsp), %rdi
+	call	assertDiagnostic
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	pxor	%xmm0, %xmm0
+	movq	%r12, %rcx
+	movq	%rbp, %rsi
+	leaq	32(%rsp), %rax
+	movl	$184, %edx
+	movq	%rbx, %rdi
+	movq	$0, 48(%rsp)
+	movq	%rax, 96(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1606
+	movl	44(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1608
+.L1617:
+	addl	$1, asserts_passed(%rip)
+.L1609:
+	movq	48(%rsp), %rcx
+	cmpq	$5, %rcx
+	jne	.L1610
+	addl	$1, asserts_passed(%rip)
+.L1611:
+	movl	200(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1612
+	addl	$1, asserts_passed(%rip)
+.L1613:
+	movq	%rbx, %rdi
+	call	assertTolerantLibrary.part.0
+.L1614:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$304, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1612:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	movl	$2, %r8d
+	movl	$1029, %edx
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	call	printf@PLT
+	cmpl	$2, 200(%rsp)
+	jne	.L1614
+	jmp	.L1613
+	.p2align 4,,10
+	.p2align 3
+.L1602:
+	movl	$2, %r8d
+	movl	$1067, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	16(%rsp), %rcx
+	cmpq	$5, %rcx
+	je	.L1616
+.L1604:
+	movl	$5, %r8d
+	movl	$1068, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1605
+	.p2align 4,,10
+	.p2align 3
+.L1610:
+	movl	$5, %r8d
+	movl	$1078, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1611
+	.p2align 4,,10
+	.p2align 3
+.L1606:
+	xorl	%r8d, %r8d
+	movl	$1076, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	44(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1617
+.L1608:
+	xorl	%r8d, %r8d
+	movl	$1077, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1609
+	.p2align 4,,10
+	.p2align 3
+.L1600:
+	xorl	%r8d, %r8d
+	movl	$1066, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1601
+	.cfi_endproc
+.LFE84:
+	.size	testParseTolerantFull, .-testParseTolerantFull
+	.p2align 4
+	.globl	testParseTolerantChunked
+	.type	testParseTolerantChunked, @function
+testParseTolerantChunked:
+.LFB85:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	$1, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	tolerantInput(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$680, %rsp
+	.cfi_def_cfa_offset 736
+	leaq	352(%rsp), %rax
+	leaq	32(%rsp), %r13
+	movq	%rax, 24(%rsp)
+	leaq	64(%rsp), %rax
+	leaq	224(%rsp), %rbx
+	movq	%rax, 16(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1628:
+	movq	24(%rsp), %rax
+	movq	16(%rsp), %rdx
+	pxor	%xmm0, %xmm0
+	movq	%rbx, %rdi
+	movq	8(%rsp), %rsi
+	movl	$0, 52(%rsp)
+	movq	$0, 44(%rsp)
+	movq	%rax, 32(%rsp)
+	movl	$8, 40(%rsp)
+	movq	%r13, 96(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	call	wavefrontMTLParserCompose@PLT
+	testl	%eax, %eax
+	jne	.L1619
+	movl	$184, %r12d
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L1620:
+	cmpq	%r14, %r12
+	movq	%r14, %rdx
+	leaq	0(%rbp,%r15), %rsi
+	movq	%rbx, %rdi
+	cmovbe	%r12, %rdx
+	addq	%r14, %r15
+	subq	%r14, %r12
+	call	wavefrontMTLParserFeed@PLT
+	testl	%eax, %eax
+	jne	.L1619
+	cmpq	$183, %r15
+	jbe	.L1620
+	testl	%eax, %eax
+	jne	.L1619
+	movq	%rbx, %rdi
+	call	wavefrontMTLParserFinish@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1623
+	addl	$1, asserts_passed(%rip)
+	.p2align 4,,10
+	.p2align 3
+.L1624:
+	movq	%r13, %rdi
+	call	assertTolerantDiagnostics
+	movl	120(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1625
+	addl	$1, asserts_passed(%rip)
+.L1626:
+	movq	8(%rsp), %rdi
+	call	assertTolerantLibrary.part.0
+.L1627:
+	movq	8(%rsp), %rdi
+	addq	$1, %r14
+	call	wavefrontMTLRelease@PLT
+	cmpq	$185, %r14
+	jne	.L1628
+	addq	$680, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1619:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+.L1623:
+	xorl	%r8d, %r8d
+	movl	$1098, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1624
+	.p2align 4,,10
+	.p2align 3
+.L1625:
+	xorl	%eax, %eax
+	movl	$2, %r8d
+	movl	$1029, %edx
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	call	printf@PLT
+	cmpl	$2, 120(%rsp)
+	jne	.L1627
+	jmp	.L1626
+	.cfi_endproc
+.LFE85:
+	.size	testParseTolerantChunked, .-testParseTolerantChunked
+	.section	.rodata.str1.1
+.LC233:
+	.string	"\nKd "
+.LC234:
+	.string	"Kd"
+	.text
+	.p2align 4
+	.globl	testParseTolerantParallel
+	.type	testParseTolerantParallel, @function
+testParseTolerantParallel:
+.LFB86:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$1024001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$5560, %rsp
+	.cfi_def_cfa_offset 5616
+	call	malloc@PLT
+	movq	%rax, 8(%rsp)
+	testq	%rax, %rax
+	je	.L1641
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	movl	$3435973837, %ebp
+	movl	$1024001, %ebx
+	leaq	.LC225(%rip), %r12
+	movl	$2863311531, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L1637:
+	imull	$-1227133513, %r13d, %edx
+	movl	%r13d, %ecx
+	movl	%r13d, %eax
+	subl	$1227133514, %edx
+	cmpl	$613566755, %edx
+	ja	.L1640
+	movq	%rax, %rcx
+	imulq	%r15, %rcx
+	shrq	$33, %rcx
+.L1640:
+	movq	%rax, %rdx
+	imulq	$1374389535, %rax, %rax
+	movl	%r13d, %r8d
+	movq	%rbx, %rsi
+	imulq	%rbp, %rdx
+	movq	8(%rsp), %rdi
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 5624
+	subq	%r14, %rsi
+	movl	%r13d, %r9d
+	shrq	$36, %rax
+	addq	%r14, %rdi
+	imull	$50, %eax, %eax
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	pushq	%r8
+	.cfi_def_cfa_offset 5632
+	movl	%r13d, %r8d
+	addl	$1, %r13d
+	subl	%edx, %r8d
+	movq	%r12, %rdx
+	call	snprintf@PLT
+	popq	%rdx
+	.cfi_def_cfa_offset 5624
+	popq	%rcx
+	.cfi_def_cfa_offset 5616
+	cltq
+	addq	%rax, %r14
+	cmpl	$8000, %r13d
+	jne	.L1637
+.L1641:
+	movq	8(%rsp), %rdi
+	leaq	.LC233(%rip), %rbp
+	xorl	%r12d, %r12d
+	xorl	%ebx, %ebx
+	movq	%rbp, %rsi
+	call	strstr@PLT
+	testq	%rax, %rax
+	jne	.L1638
+	jmp	.L1639
+	.p2align 4,,10
+	.p2align 3
+.L1685:
+	movl	%ebx, %r12d
+.L1638:
+	imull	$1594008481, %r12d, %edx
+	leal	1(%r12), %ebx
+	cmpl	$44278013, %edx
+	ja	.L1642
+	movb	$120, 4(%rax)
+.L1642:
+	leaq	1(%rax), %rdi
+	movq	%rbp, %rsi
+	call	strstr@PLT
+	testq	%rax, %rax
+	jne	.L1685
+	leal	97(%r12), %eax
+	movq	%rax, %r12
+	imulq	$1372618415, %rax, %rax
+	shrq	$32, %rax
+	subl	%eax, %r12d
+	shrl	%r12d
+	leal	(%r12,%rax), %ebx
+	shrl	$6, %ebx
+.L1639:
+	movq	8(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	leaq	432(%rsp), %rax
+	movq	$0, 108(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, 96(%rsp)
+	movq	%r14, %rdi
+	leaq	96(%rsp), %rax
+	movaps	%xmm0, 160(%rsp)
+	movaps	%xmm0, 176(%rsp)
+	movl	$0, 116(%rsp)
+	movl	$64, 104(%rsp)
+	movq	%rax, 192(%rsp)
+	call	strlen@PLT
+	leaq	160(%rsp), %rcx
+	movq	%r14, %rsi
+	movq	%rax, %rdx
+	leaq	208(%rsp), %rax
+	movq	%rcx, 56(%rsp)
+	movq	%rax, %rdi
+	movq	%rax, 32(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1645
+	addl	$1, asserts_passed(%rip)
+.L1646:
+	movl	108(%rsp), %ecx
+	cmpq	$64, %rcx
+	jne	.L1647
+	movq	112(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	%rbx, %rcx
+	jne	.L1649
+.L1689:
+	addl	$1, asserts_passed(%rip)
+.L1650:
+	movq	.LC226(%rip), %rax
+	movl	$8, 88(%rsp)
+	leaq	.LC0(%rip), %r12
+	leaq	.LC1(%rip), %r13
+	movq	%rax, 80(%rsp)
+	leaq	80(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	leaq	92(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	leaq	2992(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	leaq	320(%rsp), %rax
+	movq	%rax, 24(%rsp)
+.L1657:
+	movq	64(%rsp), %rax
+	movq	8(%rsp), %rbx
+	movq	$0, 140(%rsp)
+	movl	$0, 148(%rsp)
+	movq	%rax, 128(%rsp)
+	movq	16(%rsp), %rax
+	movq	%rbx, %rdi
+	movl	$64, 136(%rsp)
+	movl	(%rax), %eax
+	movl	%eax, 168(%rsp)
+	movq	48(%rsp), %rax
+	movq	%rax, 192(%rsp)
+	call	strlen@PLT
+	movq	56(%rsp), %rcx
+	movq	24(%rsp), %rdi
+	movq	%rbx, %rsi
+	movq	%rax, %rdx
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1651
+	addl	$1, asserts_passed(%rip)
+.L1652:
+	movq	32(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	call	assertMTLsEqual
+	movq	144(%rsp), %rcx
+	movq	112(%rsp), %r8
+	cmpq	%r8, %rcx
+	jne	.L1653
+	addl	$1, asserts_passed(%rip)
+.L1654:
+	movl	140(%rsp), %ecx
+	cmpq	$64, %rcx
+	jne	.L1655
+	addl	$1, asserts_passed(%rip)
+.L1656:
+	movq	72(%rsp), %rbx
+	xorl	%ebp, %ebp
+	leaq	3008(%rsp), %r15
+	leaq	.LC234(%rip), %r14
+	jmp	.L1666
+	.p2align 4,,10
+	.p2align 3
+.L1686:
+	movq	-8(%r15), %rcx
+	movq	8(%rbx), %r8
+	addl	$1, asserts_passed(%rip)
+	cmpq	%r8, %rcx
+	jne	.L1662
+.L1687:
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	addl	$1, asserts_passed(%rip)
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1664
+.L1688:
+	addl	$1, asserts_passed(%rip)
+.L1684:
+	addl	$1, %ebp
+	addq	$40, %rbx
+	addq	$40, %r15
+	cmpl	140(%rsp), %ebp
+	jnb	.L1659
+.L1666:
+	movq	-16(%r15), %rcx
+	movq	(%rbx), %r8
+	cmpq	%r8, %rcx
+	je	.L1686
+	movl	$1134, %edx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	-8(%r15), %rcx
+	movq	8(%rbx), %r8
+	cmpq	%r8, %rcx
+	je	.L1687
+.L1662:
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	movl	$1135, %edx
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1688
+.L1664:
+	leaq	.LC234(%rip), %r8
+	movq	%r15, %rcx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movl	$1136, %edx
+	leaq	.LC2(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1684
+	.p2align 4,,10
+	.p2align 3
+.L1655:
+	movl	$64, %r8d
+	movl	$1132, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	140(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1656
+	.p2align 4,,10
+	.p2align 3
+.L1659:
+	movq	24(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$4, 16(%rsp)
+	movq	40(%rsp), %rbx
+	movq	16(%rsp), %rax
+	cmpq	%rbx, %rax
+	jne	.L1657
+	movq	32(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	8(%rsp), %rdi
+	call	free@PLT
+	addq	$5560, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1653:
+	.cfi_restore_state
+	movl	$1131, %edx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1654
+	.p2align 4,,10
+	.p2align 3
+.L1651:
+	xorl	%r8d, %r8d
+	movl	$1129, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1652
+	.p2align 4,,10
+	.p2align 3
+.L1647:
+	movl	$64, %r8d
+	movl	$1119, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	112(%rsp), %rcx
+	cmpq	%rbx, %rcx
+	je	.L1689
+.L1649:
+	movq	%rbx, %r8
+	movl	$1120, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1650
+	.p2align 4,,10
+	.p2align 3
+.L1645:
+	xorl	%r8d, %r8d
+	movl	$1118, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1646
+	.cfi_endproc
+.LFE86:
+	.size	testParseTolerantParallel, .-testParseTolerantParallel
+	.p2align 4
+	.globl	testParseStats
+	.type	testParseStats, @function
+testParseStats:
+.LFB87:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	$120, %edx
+	movl	$255, %esi
+	movabsq	$13827669224398945, %rax
+	subq	$384, %rsp
+	.cfi_def_cfa_offset 400
+	movdqa	.LC235(%rip), %xmm0
+	leaq	256(%rsp), %rbx
+	movq	%rax, 128(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movdqa	.LC236(%rip), %xmm0
+	movq	%rbx, %rdi
+	movaps	%xmm0, 64(%rsp)
+	movdqa	.LC237(%rip), %xmm0
+	movaps	%xmm0, 80(%rsp)
+	movdqa	.LC238(%rip), %xmm0
+	movaps	%xmm0, 96(%rsp)
+	movdqa	.LC239(%rip), %xmm0
+	movaps	%xmm0, 112(%rsp)
+	call	memset@PLT
+	pxor	%xmm0, %xmm0
+	movq	%rsp, %rcx
+	leaq	48(%rsp), %rsi
+	movaps	%xmm0, 16(%rsp)
+	movl	$87, %edx
+	movq	%rbx, 16(%rsp)
+	leaq	144(%rsp), %rbx
+	movq	%rbx, %rdi
+	movaps	%xmm0, (%rsp)
+	movq	$0, 32(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1691
+	movq	256(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1693
+.L1698:
+	movq	280(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1695
+.L1699:
+	addl	$1, asserts_passed(%rip)
+.L1696:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$384, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1691:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$1160, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	256(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L1698
+.L1693:
+	xorl	%r8d, %r8d
+	movl	$1175, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	280(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L1699
+.L1695:
+	xorl	%r8d, %r8d
+	movl	$1176, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1696
+	.cfi_endproc
+.LFE87:
+	.size	testParseStats, .-testParseStats
+	.p2align 4
+	.globl	testParseStatsParallel
+	.type	testParseStatsParallel, @function
+testParseStatsParallel:
+.LFB88:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$5120001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$424, %rsp
+	.cfi_def_cfa_offset 480
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1701
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	movl	$5120001, %ebp
+	movl	$3435973837, %r12d
+	leaq	.LC225(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1703:
+	imull	$-1227133513, %r14d, %edx
+	movl	%r14d, %ecx
+	movl	%r14d, %eax
+	subl	$1227133514, %edx
+	cmpl	$613566755, %edx
+	ja	.L1702
+	movl	$2863311531, %ecx
+	imulq	%rax, %rcx
+	shrq	$33, %rcx
+.L1702:
+	movq	%rax, %rdx
+	imulq	$1374389535, %rax, %rax
+	movl	%r14d, %r8d
+	movq	%rbp, %rsi
+	imulq	%r12, %rdx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 488
+	subq	%r15, %rsi
+	movl	%r14d, %r9d
+	leaq	(%rbx,%r15), %rdi
+	shrq	$36, %rax
+	imull	$50, %eax, %eax
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	pushq	%r8
+	.cfi_def_cfa_offset 496
+	movl	%r14d, %r8d
+	addl	$1, %r14d
+	subl	%edx, %r8d
+	movq	%r13, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r15
+	popq	%rax
+	.cfi_def_cfa_offset 488
+	popq	%rdx
+	.cfi_def_cfa_offset 480
+	cmpl	$40000, %r14d
+	jne	.L1703
+.L1701:
+	movq	%rbx, %rdi
+	leaq	48(%rsp), %rbp
+	movq	%rsp, %r14
+	call	strlen@PLT
+	pxor	%xmm0, %xmm0
+	movq	%r14, %rcx
+	movq	%rbx, %rsi
+	movq	%rax, %r12
+	movq	%rbp, %rdi
+	leaq	160(%rsp), %rax
+	movaps	%xmm0, (%rsp)
+	movq	%r12, %rdx
+	movaps	%xmm0, 16(%rsp)
+	movq	$0, 32(%rsp)
+	movq	%rax, 16(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movq	%rbp, %rdi
+	movl	56(%rsp), %r13d
+	call	wavefrontMTLRelease@PLT
+	movq	%r14, %rcx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	leaq	288(%rsp), %rax
+	movq	%rbp, %rdi
+	movl	$4, 8(%rsp)
+	movq	%rax, 16(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1704
+	addl	$1, asserts_passed(%rip)
+.L1705:
+	movl	56(%rsp), %ecx
+	movl	%r13d, %r8d
+	cmpq	%r8, %rcx
+	jne	.L1706
+	addl	$1, asserts_passed(%rip)
+.L1707:
+	movq	288(%rsp), %rcx
+	movq	160(%rsp), %r8
+	cmpq	%r8, %rcx
+	jne	.L1708
+	addl	$1, asserts_passed(%rip)
+.L1709:
+	movq	296(%rsp), %rcx
+	movq	168(%rsp), %r8
+	cmpq	%r8, %rcx
+	jne	.L1710
+	addl	$1, asserts_passed(%rip)
+.L1711:
+	movl	308(%rsp), %ecx
+	movl	180(%rsp), %r8d
+	cmpq	%r8, %rcx
+	jne	.L1712
+	addl	$1, asserts_passed(%rip)
+.L1713:
+	movq	328(%rsp), %rcx
+	movq	200(%rsp), %r8
+	cmpq	%rcx, %r8
+	jne	.L1730
+	addl	$1, asserts_passed(%rip)
+.L1715:
+	movq	336(%rsp), %rcx
+	movq	208(%rsp), %r8
+	cmpq	%rcx, %r8
+	je	.L1716
+	movl	$1201, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1717:
+	movq	344(%rsp), %rcx
+	movq	216(%rsp), %r8
+	cmpq	%rcx, %r8
+	je	.L1718
+	movl	$1201, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1719:
+	movq	352(%rsp), %rcx
+	movq	224(%rsp), %r8
+	cmpq	%rcx, %r8
+	je	.L1720
+	movl	$1201, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1721:
+	movq	360(%rsp), %rcx
+	movq	232(%rsp), %r8
+	cmpq	%r8, %rcx
+	jne	.L1722
+	addl	$1, asserts_passed(%rip)
+.L1723:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	free@PLT
+	addq	$424, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1730:
+	.cfi_restore_state
+	movl	$1201, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1715
+	.p2align 4,,10
+	.p2align 3
+.L1712:
+	movl	$1199, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1713
+	.p2align 4,,10
+	.p2align 3
+.L1710:
+	movl	$1198, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1711
+	.p2align 4,,10
+	.p2align 3
+.L1708:
+	movl	$1197, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1709
+	.p2align 4,,10
+	.p2align 3
+.L1706:
+	movl	$1196, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1707
+	.p2align 4,,10
+	.p2align 3
+.L1720:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1721
+	.p2align 4,,10
+	.p2align 3
+.L1718:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1719
+	.p2align 4,,10
+	.p2align 3
+.L1716:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1717
+	.p2align 4,,10
+	.p2align 3
+.L1722:
+	movl	$1201, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1723
+	.p2align 4,,10
+	.p2align 3
+.L1704:
+	xorl	%r8d, %r8d
+	movl	$1195, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1705
+	.cfi_endproc
+.LFE88:
+	.size	testParseStatsParallel, .-testParseStatsParallel
+	.section	.rodata.str1.1
+.LC240:
+	.string	"bin/test_parse_batch.mtl"
+.LC241:
+	.string	"newmtl a\nNs 2"
+.LC242:
+	.string	"newmtl b\nKa x"
+.LC243:
+	.string	"newmtl c\nnewmtl d"
+	.text
+	.p2align 4
+	.globl	testParseBatch
+	.type	testParseBatch, @function
+testParseBatch:
+.LFB89:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC219(%rip), %rsi
+	leaq	.LC240(%rip), %rdi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1032, %rsp
+	.cfi_def_cfa_offset 1088
+	call	fopen@PLT
+	testq	%rax, %rax
+	je	.L1732
+	movq	%rax, %rcx
+	movl	$236, %edx
+	movl	$1, %esi
+	movq	%rax, %rbx
+	leaq	libraryInput(%rip), %rdi
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rbp
+	call	fclose@PLT
+	cmpq	$236, %rbp
+	je	.L1778
+.L1732:
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	movl	$1215, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1733:
+	movl	$256001, %edi
+	call	malloc@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L1734
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	movl	$256001, %ebp
+	movl	$3435973837, %r12d
+	leaq	.LC225(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L1736:
+	imull	$-1227133513, %r14d, %edx
+	movl	%r14d, %ecx
+	movl	%r14d, %eax
+	subl	$1227133514, %edx
+	cmpl	$613566755, %edx
+	ja	.L1735
+	movl	$2863311531, %ecx
+	imulq	%rax, %rcx
+	shrq	$33, %rcx
+.L1735:
+	movq	%rax, %rdx
+	imulq	$1374389535, %rax, %rax
+	movl	%r14d, %r8d
+	movq	%rbp, %rsi
+	imulq	%r12, %rdx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 1096
+	subq	%r15, %rsi
+	movl	%r14d, %r9d
+	leaq	(%rbx,%r15), %rdi
+	shrq	$36, %rax
+	imull	$50, %eax, %eax
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	pushq	%r8
+	.cfi_def_cfa_offset 1104
+	movl	%r14d, %r8d
+	addl	$1, %r14d
+	subl	%edx, %r8d
+	movq	%r13, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r15
+	popq	%rax
+	.cfi_def_cfa_offset 1096
+	popq	%rdx
+	.cfi_def_cfa_offset 1088
+	cmpl	$2000, %r14d
+	jne	.L1736
+.L1734:
+	xorl	%eax, %eax
+	leaq	160(%rsp), %rdi
+	movl	$108, %ecx
+	rep stosq
+	leaq	.LC241(%rip), %rdi
+	movq	%rdi, 168(%rsp)
+	call	strlen@PLT
+	movq	%rbx, %rdi
+	movq	%rbx, 456(%rsp)
+	movq	%rax, 176(%rsp)
+	leaq	.LC240(%rip), %rax
+	movq	%rax, 304(%rsp)
+	call	strlen@PLT
+	leaq	.LC242(%rip), %rdi
+	movq	%rax, 464(%rsp)
+	leaq	.LC224(%rip), %rax
+	movq	%rdi, 744(%rsp)
+	movq	%rax, 592(%rsp)
+	call	strlen@PLT
+	pxor	%xmm0, %xmm0
+	movq	%rsp, %rdx
+	leaq	160(%rsp), %rdi
+	movq	%rax, 752(%rsp)
+	movl	$6, %esi
+	leaq	.LC243(%rip), %rax
+	movaps	%xmm0, (%rsp)
+	movq	%rax, 888(%rsp)
+	movq	$8, 896(%rsp)
+	movq	$0, 32(%rsp)
+	movl	$4, 8(%rsp)
+	movaps	%xmm0, 16(%rsp)
+	call	parseWavefrontMTLBatch@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L1737
+	movslq	296(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1739
+.L1783:
+	addl	$1, asserts_passed(%rip)
+.L1740:
+	movl	192(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1741
+	addl	$1, asserts_passed(%rip)
+.L1742:
+	movq	184(%rsp), %rax
+	movsd	.LC71(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	88(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1743
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1779
+.L1743:
+	movl	$1237, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	440(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L1747
+.L1780:
+	movl	336(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L1749
+.L1781:
+	movslq	584(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1751
+.L1782:
+	addl	$1, asserts_passed(%rip)
+.L1752:
+	leaq	48(%rsp), %rbp
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	leaq	472(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	assertMTLsEqual
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movslq	728(%rsp), %rcx
+	cmpq	$2, %rcx
+	jne	.L1753
+	movl	624(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1755
+.L1786:
+	addl	$1, asserts_passed(%rip)
+.L1756:
+	movslq	872(%rsp), %rcx
+	cmpq	$3, %rcx
+	jne	.L1757
+	movl	768(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1759
+.L1784:
+	movslq	1016(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1761
+.L1785:
+	addl	$1, asserts_passed(%rip)
+.L1762:
+	movl	912(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1763
+	addl	$1, asserts_passed(%rip)
+.L1764:
+	leaq	184(%rsp), %rbp
+	leaq	1048(%rsp), %r12
+	.p2align 4,,10
+	.p2align 3
+.L1765:
+	movq	%rbp, %rdi
+	addq	$144, %rbp
+	call	wavefrontMTLRelease@PLT
+	cmpq	%r12, %rbp
+	jne	.L1765
+	movq	%rbx, %rdi
+	call	free@PLT
+	leaq	.LC240(%rip), %rdi
+	call	remove@PLT
+	addq	$1032, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1778:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1733
+	.p2align 4,,10
+	.p2align 3
+.L1779:
+	movslq	440(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	je	.L1780
+.L1747:
+	xorl	%r8d, %r8d
+	movl	$1238, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	336(%rsp), %ecx
+	cmpq	$2, %rcx
+	je	.L1781
+.L1749:
+	movl	$2, %r8d
+	movl	$1239, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	584(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L1782
+.L1751:
+	xorl	%r8d, %r8d
+	movl	$1240, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1752
+	.p2align 4,,10
+	.p2align 3
+.L1741:
+	movl	$1, %r8d
+	movl	$1236, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1742
+	.p2align 4,,10
+	.p2align 3
+.L1737:
+	movl	$2, %r8d
+	movl	$1234, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	296(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L1783
+.L1739:
+	xorl	%r8d, %r8d
+	movl	$1235, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1740
+	.p2align 4,,10
+	.p2align 3
+.L1763:
+	movl	$1, %r8d
+	movl	$1250, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1764
+	.p2align 4,,10
+	.p2align 3
+.L1757:
+	movl	$3, %r8d
+	movl	$1247, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	768(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1784
+.L1759:
+	xorl	%r8d, %r8d
+	movl	$1248, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	1016(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L1785
+.L1761:
+	xorl	%r8d, %r8d
+	movl	$1249, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1762
+	.p2align 4,,10
+	.p2align 3
+.L1753:
+	movl	$2, %r8d
+	movl	$1245, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	624(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1786
+.L1755:
+	xorl	%r8d, %r8d
+	movl	$1246, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1756
+	.cfi_endproc
+.LFE89:
+	.size	testParseBatch, .-testParseBatch
+	.section	.rodata.str1.1
+.LC244:
+	.string	"missing"
+	.text
+	.p2align 4
+	.globl	testIndex
+	.type	testIndex, @function
+testIndex:
+.LFB90:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$384001, %edi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 400
+	call	malloc@PLT
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L1792
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	movl	$3435973837, %ebp
+	movl	$384001, %ebx
+	leaq	.LC225(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L1788:
+	imull	$-1227133513, %r14d, %edx
+	movl	%r14d, %ecx
+	movl	%r14d, %eax
+	subl	$1227133514, %edx
+	cmpl	$613566755, %edx
+	ja	.L1791
+	movl	$2863311531, %ecx
+	imulq	%rax, %rcx
+	shrq	$33, %rcx
+.L1791:
+	movq	%rax, %rdx
+	imulq	$1374389535, %rax, %rax
+	movl	%r14d, %r8d
+	movq	%rbx, %rsi
+	imulq	%rbp, %rdx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 408
+	subq	%r15, %rsi
+	movl	%r14d, %r9d
+	leaq	0(%r13,%r15), %rdi
+	shrq	$36, %rax
+	imull	$50, %eax, %eax
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%eax, %r8d
+	xorl	%eax, %eax
+	pushq	%r8
+	.cfi_def_cfa_offset 416
+	movl	%r14d, %r8d
+	addl	$1, %r14d
+	subl	%edx, %r8d
+	movq	%r12, %rdx
+	call	snprintf@PLT
+	cltq
+	addq	%rax, %r15
+	popq	%rax
+	.cfi_def_cfa_offset 408
+	popq	%rdx
+	.cfi_def_cfa_offset 400
+	cmpl	$3000, %r14d
+	jne	.L1788
+.L1792:
+	leaq	48(%rsp), %rax
+	movq	%r13, %rsi
+	leaq	160(%rsp), %r14
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	xorl	%ecx, %ecx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLIndexCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1843
+	addl	$1, asserts_passed(%rip)
+.L1793:
+	movl	184(%rsp), %ecx
+	movl	56(%rsp), %r8d
+	cmpq	%r8, %rcx
+	jne	.L1794
+	movl	232(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1796
+.L1847:
+	addl	$1, asserts_passed(%rip)
+.L1797:
+	movl	56(%rsp), %r15d
+	leaq	44(%rsp), %rax
+	movq	%r13, 24(%rsp)
+	leaq	.LC0(%rip), %r12
+	movl	$0, 44(%rsp)
+	movq	%rax, (%rsp)
+	movl	%r15d, %edx
+	movl	%r15d, %r13d
+	jmp	.L1798
+	.p2align 4,,10
+	.p2align 3
+.L1845:
+	addl	$1, asserts_passed(%rip)
+.L1802:
+	imulq	$456, %rcx, %r9
+	addq	224(%rsp), %r9
+	movq	(%rbx), %r8
+	movq	(%r9), %r15
+	movq	%r9, %r13
+	testq	%r15, %r15
+	je	.L1804
+	testq	%r8, %r8
+	je	.L1804
+	movq	%r8, %rsi
+	movq	%r15, %rdi
+	movq	%r8, 16(%rsp)
+	call	strcmp@PLT
+	movq	16(%rsp), %r8
+	testl	%eax, %eax
+	jne	.L1805
+	addl	$1, asserts_passed(%rip)
+.L1806:
+	movq	8(%rsp), %rdx
+	movq	%rbx, %rcx
+	leaq	224(%rsp), %rdi
+	movq	%r13, %rsi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L1809
+	movl	56(%rsp), %edx
+	addl	$1, asserts_passed(%rip)
+	movl	%edx, %eax
+	shrl	%eax
+	cmpl	%eax, %ebp
+	je	.L1842
+.L1810:
+	movl	%ebp, %r13d
+.L1798:
+	movq	48(%rsp), %rbx
+	leal	-1(%r13), %ebp
+	testl	%r13d, %r13d
+	je	.L1844
+	movl	%ebp, %eax
+	movq	(%rsp), %rdx
+	movq	%r14, %rdi
+	imulq	$456, %rax, %rax
+	addq	%rax, %rbx
+	movq	(%rbx), %rsi
+	call	wavefrontMTLIndexFind@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1799
+	addl	$1, asserts_passed(%rip)
+.L1800:
+	movl	56(%rsp), %r8d
+	movslq	44(%rsp), %rcx
+	subl	%r13d, %r8d
+	cmpq	%r8, %rcx
+	je	.L1845
+	movl	$1275, %edx
+	movq	%r12, %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	44(%rsp), %rcx
+	testl	%ecx, %ecx
+	jns	.L1802
+	movq	24(%rsp), %r13
+	movl	56(%rsp), %edx
+	movq	48(%rsp), %rax
+.L1803:
+	subl	$1, %edx
+	movq	%r14, %rdi
+	movl	232(%rsp), %ebx
+	imulq	$456, %rdx, %rdx
+	movq	(%rax,%rdx), %rsi
+	movq	(%rsp), %rdx
+	call	wavefrontMTLIndexFind@PLT
+	movslq	44(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L1812
+	addl	$1, asserts_passed(%rip)
+.L1813:
+	movl	232(%rsp), %ecx
+	movl	%ebx, %r8d
+	cmpq	%r8, %rcx
+	jne	.L1814
+	addl	$1, asserts_passed(%rip)
+	cmpl	56(%rsp), %ebx
+	jnb	.L1816
+.L1846:
+	addl	$1, asserts_passed(%rip)
+.L1817:
+	movq	(%rsp), %rdx
+	leaq	.LC244(%rip), %rsi
+	movq	%r14, %rdi
+	call	wavefrontMTLIndexFind@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1818
+	addl	$1, asserts_passed(%rip)
+.L1819:
+	movslq	44(%rsp), %rcx
+	cmpq	$-1, %rcx
+	jne	.L1820
+	addl	$1, asserts_passed(%rip)
+.L1821:
+	movq	%r14, %rdi
+	call	wavefrontMTLIndexRelease@PLT
+	movq	8(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r13, %rdi
+	call	free@PLT
+	addq	$344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1804:
+	.cfi_restore_state
+	addl	$1, asserts_failed(%rip)
+	testq	%r8, %r8
+	jne	.L1824
+	leaq	.LC10(%rip), %r8
+	testq	%r15, %r15
+	je	.L1825
+.L1808:
+	movq	%r15, %rcx
+	movl	$1278, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L1806
+	.p2align 4,,10
+	.p2align 3
+.L1809:
+	movl	$1279, %edx
+	movl	$1, %r8d
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	56(%rsp), %edx
+	movl	%edx, %eax
+	shrl	%eax
+	cmpl	%ebp, %eax
+	jne	.L1810
+.L1842:
+	movq	24(%rsp), %r13
+	movq	48(%rsp), %rax
+	jmp	.L1803
+	.p2align 4,,10
+	.p2align 3
+.L1799:
+	xorl	%r8d, %r8d
+	movl	$1274, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1800
+	.p2align 4,,10
+	.p2align 3
+.L1805:
+	addl	$1, asserts_failed(%rip)
+	jmp	.L1808
+	.p2align 4,,10
+	.p2align 3
+.L1824:
+	leaq	.LC10(%rip), %r15
+	jmp	.L1808
+	.p2align 4,,10
+	.p2align 3
+.L1825:
+	movq	%r8, %r15
+	jmp	.L1808
+	.p2align 4,,10
+	.p2align 3
+.L1820:
+	movq	$-1, %r8
+	movl	$1291, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1821
+	.p2align 4,,10
+	.p2align 3
+.L1814:
+	xorl	%eax, %eax
+	movl	$1286, %edx
+	leaq	.LC0(%rip), %rsi
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC1(%rip), %rdi
+	call	printf@PLT
+	cmpl	56(%rsp), %ebx
+	jb	.L1846
+.L1816:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$1287, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1817
+	.p2align 4,,10
+	.p2align 3
+.L1794:
+	movl	$1266, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	232(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1847
+.L1796:
+	xorl	%r8d, %r8d
+	movl	$1267, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1797
+	.p2align 4,,10
+	.p2align 3
+.L1844:
+	movq	24(%rsp), %r13
+	movq	%rbx, %rax
+	jmp	.L1803
+	.p2align 4,,10
+	.p2align 3
+.L1818:
+	xorl	%r8d, %r8d
+	movl	$1290, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1819
+	.p2align 4,,10
+	.p2align 3
+.L1812:
+	xorl	%r8d, %r8d
+	movl	$1285, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1813
+	.p2align 4,,10
+	.p2align 3
+.L1843:
+	xorl	%r8d, %r8d
+	movl	$1265, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1793
+	.cfi_endproc
+.LFE90:
+	.size	testIndex, .-testIndex
+	.section	.rodata.str1.1
+.LC245:
+	.string	"bad"
+.LC246:
+	.string	"good"
+	.text
+	.p2align 4
+	.globl	testIndexParseError
+	.type	testIndexParseError, @function
+testIndexParseError:
+.LFB91:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%ecx, %ecx
+	movl	$58, %edx
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 288
+	movdqa	.LC247(%rip), %xmm0
+	leaq	80(%rsp), %rbx
+	leaq	16(%rsp), %rsi
+	movaps	%xmm0, 16(%rsp)
+	movdqa	.LC248(%rip), %xmm0
+	movq	%rbx, %rdi
+	movaps	%xmm0, 32(%rsp)
+	movdqa	.LC249(%rip), %xmm0
+	movaps	%xmm0, 48(%rsp)
+	movdqa	.LC250(%rip), %xmm0
+	movups	%xmm0, 59(%rsp)
+	call	wavefrontMTLIndexCompose@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1849
+	addl	$1, asserts_passed(%rip)
+.L1850:
+	movl	104(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1851
+	addl	$1, asserts_passed(%rip)
+.L1852:
+	leaq	12(%rsp), %rbp
+	leaq	.LC245(%rip), %rsi
+	movq	%rbx, %rdi
+	movl	$0, 12(%rsp)
+	movq	%rbp, %rdx
+	call	wavefrontMTLIndexFind@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1853
+	addl	$1, asserts_passed(%rip)
+.L1854:
+	movslq	12(%rsp), %rcx
+	cmpq	$-1, %rcx
+	jne	.L1855
+	movl	152(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1857
+.L1878:
+	addl	$1, asserts_passed(%rip)
+.L1858:
+	movq	%rbp, %rdx
+	leaq	.LC246(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLIndexFind@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1859
+	addl	$1, asserts_passed(%rip)
+.L1860:
+	movslq	12(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L1861
+	addl	$1, asserts_passed(%rip)
+.L1862:
+	movq	144(%rsp), %rax
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1863
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1876
+.L1863:
+	movl	$1320, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	.LC12(%rip), %rdx
+	movq	144(%rsp), %rax
+	movq	%rdx, %xmm2
+.L1866:
+	movsd	.LC89(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	cvtss2sd	88(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1867
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1877
+.L1867:
+	movl	$1321, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1870:
+	movq	%rbx, %rdi
+	call	wavefrontMTLIndexRelease@PLT
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1877:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1870
+	.p2align 4,,10
+	.p2align 3
+.L1876:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1866
+	.p2align 4,,10
+	.p2align 3
+.L1855:
+	movq	$-1, %r8
+	movl	$1314, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	152(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1878
+.L1857:
+	xorl	%r8d, %r8d
+	movl	$1315, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1858
+	.p2align 4,,10
+	.p2align 3
+.L1853:
+	movl	$3, %r8d
+	movl	$1313, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1854
+	.p2align 4,,10
+	.p2align 3
+.L1851:
+	movl	$2, %r8d
+	movl	$1309, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1852
+	.p2align 4,,10
+	.p2align 3
+.L1861:
+	xorl	%r8d, %r8d
+	movl	$1319, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1862
+	.p2align 4,,10
+	.p2align 3
+.L1849:
+	xorl	%r8d, %r8d
+	movl	$1308, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1850
+	.p2align 4,,10
+	.p2align 3
+.L1859:
+	xorl	%r8d, %r8d
+	movl	$1318, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1860
+	.cfi_endproc
+.LFE91:
+	.size	testIndexParseError, .-testIndexParseError
+	.section	.rodata.str1.1
+.LC251:
+	.string	"kept"
+.LC252:
+	.string	"changed"
+.LC253:
+	.string	"kept.png"
+.LC254:
+	.string	"removed"
+.LC255:
+	.string	"renamed"
+.LC256:
+	.string	"added"
+.LC257:
+	.string	"renamed_new"
+.LC258:
+	.string	"added.png"
+	.text
+	.p2align 4
+	.globl	testReload
+	.type	testReload, @function
+testReload:
+.LFB92:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$105, %edx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$504, %rsp
+	.cfi_def_cfa_offset 560
+	movdqa	.LC262(%rip), %xmm1
+	movdqa	.LC259(%rip), %xmm0
+	leaq	128(%rsp), %rax
+	leaq	240(%rsp), %rbx
+	movaps	%xmm1, 176(%rsp)
+	leaq	16(%rsp), %rcx
+	movq	%rax, %rsi
+	leaq	64(%rsp), %r14
+	movdqa	.LC263(%rip), %xmm1
+	movaps	%xmm0, 128(%rsp)
+	movdqa	.LC260(%rip), %xmm0
+	leaq	352(%rsp), %r15
+	movaps	%xmm1, 192(%rsp)
+	movdqa	.LC264(%rip), %xmm1
+	movaps	%xmm0, 144(%rsp)
+	movdqa	.LC261(%rip), %xmm0
+	movaps	%xmm1, 208(%rsp)
+	movdqa	.LC265(%rip), %xmm1
+	movaps	%xmm0, 160(%rsp)
+	movups	%xmm1, 218(%rsp)
+	movdqa	.LC266(%rip), %xmm1
+	movaps	%xmm0, 416(%rsp)
+	movdqa	.LC270(%rip), %xmm0
+	movaps	%xmm1, 352(%rsp)
+	movdqa	.LC267(%rip), %xmm1
+	movaps	%xmm0, 432(%rsp)
+	movaps	%xmm1, 368(%rsp)
+	movdqa	.LC268(%rip), %xmm1
+	movaps	%xmm1, 384(%rsp)
+	movdqa	.LC269(%rip), %xmm1
+	movaps	%xmm1, 400(%rsp)
+	movdqa	.LC271(%rip), %xmm0
+	movq	$0, 48(%rsp)
+	movaps	%xmm0, 448(%rsp)
+	movdqa	.LC272(%rip), %xmm0
+	movq	%rax, 8(%rsp)
+	movaps	%xmm0, 464(%rsp)
+	movdqa	.LC273(%rip), %xmm0
+	movups	%xmm0, 478(%rsp)
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movl	%edi, 20(%rsp)
+	movq	%rbx, %rdi
+	movaps	%xmm0, 32(%rsp)
+	call	parseWavefrontMTLFromBuffer@PLT
+	movq	%r14, %rcx
+	movl	$141, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLReload@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1880
+	addl	$1, asserts_passed(%rip)
+.L1881:
+	movl	248(%rsp), %ecx
+	cmpq	$6, %rcx
+	jne	.L1882
+	addl	$1, asserts_passed(%rip)
+.L1883:
+	movq	240(%rsp), %rbp
+	movq	0(%rbp), %r12
+	testq	%r12, %r12
+	je	.L1884
+	leaq	.LC251(%rip), %rax
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	movq	%rax, (%rsp)
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L1975
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1887:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$1355, %edx
+	xorl	%eax, %eax
+	leaq	.LC251(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	240(%rsp), %rbp
+	movq	456(%rbp), %r12
+	testq	%r12, %r12
+	je	.L1888
+.L1978:
+	leaq	.LC252(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1889
+	addl	$1, asserts_passed(%rip)
+.L1890:
+	movsd	.LC135(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	480(%rbp), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1892
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1892
+	movq	608(%rbp), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	je	.L1896
+.L1979:
+	leaq	.LC253(%rip), %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1897
+	addl	$1, asserts_passed(%rip)
+.L1898:
+	movl	616(%rbp), %ecx
+	movl	160(%rbp), %r8d
+	cmpq	%r8, %rcx
+	jne	.L1900
+	addl	$1, asserts_passed(%rip)
+	cmpq	$0, 912(%rbp)
+	je	.L1976
+.L1902:
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	movl	$1361, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	240(%rsp), %rbp
+	cmpq	$0, 1536(%rbp)
+	je	.L1977
+.L1904:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$1362, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1905:
+	leaq	.LC254(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L1906
+	addl	$1, asserts_passed(%rip)
+.L1907:
+	leaq	.LC255(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L1908
+	addl	$1, asserts_passed(%rip)
+.L1909:
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1910
+	addl	$1, asserts_passed(%rip)
+.L1911:
+	leaq	.LC256(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$4, %eax
+	jne	.L1912
+	addl	$1, asserts_passed(%rip)
+.L1913:
+	leaq	.LC257(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$5, %eax
+	jne	.L1914
+	addl	$1, asserts_passed(%rip)
+.L1915:
+	movq	240(%rsp), %rax
+	movq	1976(%rax), %rbp
+	testq	%rbp, %rbp
+	je	.L1916
+	leaq	.LC258(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L1917
+	addl	$1, asserts_passed(%rip)
+.L1918:
+	movl	104(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1920
+	addl	$1, asserts_passed(%rip)
+.L1921:
+	movq	96(%rsp), %rax
+	movl	(%rax), %ecx
+	cmpq	$1, %rcx
+	jne	.L1922
+	addl	$1, asserts_passed(%rip)
+.L1923:
+	movl	88(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1924
+	addl	$1, asserts_passed(%rip)
+.L1925:
+	movq	80(%rsp), %rax
+	movl	(%rax), %ecx
+	cmpq	$2, %rcx
+	jne	.L1926
+	addl	$1, asserts_passed(%rip)
+.L1927:
+	movl	4(%rax), %ecx
+	cmpq	$3, %rcx
+	jne	.L1928
+	movl	72(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L1930
+.L1980:
+	movq	64(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movl	(%rax), %ecx
+	cmpq	$4, %rcx
+	jne	.L1932
+.L1981:
+	movl	4(%rax), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$5, %rcx
+	jne	.L1934
+.L1982:
+	addl	$1, asserts_passed(%rip)
+.L1935:
+	movq	%r14, %rdi
+	call	wavefrontMTLChangesRelease@PLT
+	movq	%r14, %rcx
+	movl	$141, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLReload@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1936
+	addl	$1, asserts_passed(%rip)
+.L1937:
+	movl	88(%rsp), %ecx
+	addl	72(%rsp), %ecx
+	addl	104(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L1938
+	addl	$1, asserts_passed(%rip)
+.L1939:
+	movq	%r14, %rdi
+	movl	$4, %r13d
+	leaq	.LC0(%rip), %r12
+	call	wavefrontMTLChangesRelease@PLT
+	leaq	.LC1(%rip), %rbp
+.L1970:
+	movq	8(%rsp), %rsi
+	movq	%r14, %rcx
+	movl	$105, %edx
+	movq	%rbx, %rdi
+	call	wavefrontMTLReload@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1940
+	addl	$1, asserts_passed(%rip)
+.L1941:
+	movl	248(%rsp), %ecx
+	cmpq	$6, %rcx
+	jne	.L1942
+	addl	$1, asserts_passed(%rip)
+.L1943:
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1944
+	addl	$1, asserts_passed(%rip)
+.L1945:
+	leaq	.LC254(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L1946
+	addl	$1, asserts_passed(%rip)
+.L1947:
+	leaq	.LC255(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L1948
+	addl	$1, asserts_passed(%rip)
+.L1949:
+	movl	72(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1950
+	addl	$1, asserts_passed(%rip)
+.L1951:
+	movq	64(%rsp), %rax
+	movl	(%rax), %ecx
+	cmpq	$2, %rcx
+	jne	.L1952
+	addl	$1, asserts_passed(%rip)
+.L1953:
+	movl	4(%rax), %ecx
+	cmpq	$3, %rcx
+	jne	.L1954
+	addl	$1, asserts_passed(%rip)
+.L1955:
+	movl	88(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L1956
+	addl	$1, asserts_passed(%rip)
+.L1957:
+	movq	80(%rsp), %rax
+	movl	(%rax), %ecx
+	cmpq	$4, %rcx
+	jne	.L1958
+	addl	$1, asserts_passed(%rip)
+.L1959:
+	movl	4(%rax), %ecx
+	cmpq	$5, %rcx
+	jne	.L1960
+	addl	$1, asserts_passed(%rip)
+.L1961:
+	movq	%r14, %rdi
+	call	wavefrontMTLChangesRelease@PLT
+	xorl	%ecx, %ecx
+	movl	$141, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLReload@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L1962
+	addl	$1, asserts_passed(%rip)
+.L1963:
+	movl	248(%rsp), %ecx
+	cmpq	$6, %rcx
+	jne	.L1964
+	addl	$1, asserts_passed(%rip)
+.L1965:
+	leaq	.LC256(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$4, %eax
+	jne	.L1966
+	addl	$1, asserts_passed(%rip)
+.L1967:
+	leaq	.LC257(%rip), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$5, %eax
+	jne	.L1968
+	addl	$1, asserts_passed(%rip)
+.L1969:
+	subl	$1, %r13d
+	jne	.L1970
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$504, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1975:
+	.cfi_restore_state
+	movq	456(%rbp), %r12
+	addl	$1, asserts_passed(%rip)
+	testq	%r12, %r12
+	jne	.L1978
+.L1888:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L1891
+	.p2align 4,,10
+	.p2align 3
+.L1960:
+	movl	$5, %r8d
+	movl	$1400, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1961
+	.p2align 4,,10
+	.p2align 3
+.L1958:
+	movl	$4, %r8d
+	movl	$1399, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	80(%rsp), %rax
+	jmp	.L1959
+	.p2align 4,,10
+	.p2align 3
+.L1956:
+	movl	$2, %r8d
+	movl	$1398, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1957
+	.p2align 4,,10
+	.p2align 3
+.L1954:
+	movl	$3, %r8d
+	movl	$1397, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1955
+	.p2align 4,,10
+	.p2align 3
+.L1952:
+	movl	$2, %r8d
+	movl	$1396, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	64(%rsp), %rax
+	jmp	.L1953
+	.p2align 4,,10
+	.p2align 3
+.L1950:
+	movl	$2, %r8d
+	movl	$1395, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1951
+	.p2align 4,,10
+	.p2align 3
+.L1948:
+	movl	$3, %r8d
+	movl	$1394, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1949
+	.p2align 4,,10
+	.p2align 3
+.L1946:
+	movl	$2, %r8d
+	movl	$1393, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1947
+	.p2align 4,,10
+	.p2align 3
+.L1968:
+	movl	$5, %r8d
+	movl	$1406, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1969
+	.p2align 4,,10
+	.p2align 3
+.L1966:
+	movl	$4, %r8d
+	movl	$1405, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1967
+	.p2align 4,,10
+	.p2align 3
+.L1964:
+	movl	$6, %r8d
+	movl	$1404, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1965
+	.p2align 4,,10
+	.p2align 3
+.L1942:
+	movl	$6, %r8d
+	movl	$1391, %edx
+	movq	%r12, %rsi
+	xorl	%eax, %eax
+	movq	%rbp, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1943
+	.p2align 4,,10
+	.p2align 3
+.L1944:
+	xorl	%r8d, %r8d
+	movl	$1392, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1945
+	.p2align 4,,10
+	.p2align 3
+.L1940:
+	xorl	%r8d, %r8d
+	movl	$1390, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1941
+	.p2align 4,,10
+	.p2align 3
+.L1962:
+	xorl	%r8d, %r8d
+	movl	$1403, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1963
+	.p2align 4,,10
+	.p2align 3
+.L1892:
+	movl	$1357, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	240(%rsp), %rbp
+	movq	608(%rbp), %r12
+	testq	%r12, %r12
+	jne	.L1979
+.L1896:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %r12
+	addl	$1, %eax
+	jmp	.L1899
+	.p2align 4,,10
+	.p2align 3
+.L1928:
+	movl	$3, %r8d
+	movl	$1374, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	72(%rsp), %ecx
+	cmpq	$2, %rcx
+	je	.L1980
+.L1930:
+	movl	$2, %r8d
+	movl	$1375, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	64(%rsp), %rax
+	movl	(%rax), %ecx
+	cmpq	$4, %rcx
+	je	.L1981
+.L1932:
+	movl	$4, %r8d
+	movl	$1376, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	64(%rsp), %rax
+	movl	4(%rax), %ecx
+	cmpq	$5, %rcx
+	je	.L1982
+.L1934:
+	movl	$5, %r8d
+	movl	$1377, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1935
+	.p2align 4,,10
+	.p2align 3
+.L1926:
+	movl	$2, %r8d
+	movl	$1373, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	80(%rsp), %rax
+	jmp	.L1927
+	.p2align 4,,10
+	.p2align 3
+.L1924:
+	movl	$2, %r8d
+	movl	$1372, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1925
+	.p2align 4,,10
+	.p2align 3
+.L1922:
+	movl	$1, %r8d
+	movl	$1371, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1923
+	.p2align 4,,10
+	.p2align 3
+.L1920:
+	movl	$1, %r8d
+	movl	$1370, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1921
+	.p2align 4,,10
+	.p2align 3
+.L1914:
+	movl	$5, %r8d
+	movl	$1367, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1915
+	.p2align 4,,10
+	.p2align 3
+.L1882:
+	movl	$6, %r8d
+	movl	$1354, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1883
+	.p2align 4,,10
+	.p2align 3
+.L1912:
+	movl	$4, %r8d
+	movl	$1366, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1913
+	.p2align 4,,10
+	.p2align 3
+.L1908:
+	movq	$-1, %r8
+	movl	$1364, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1909
+	.p2align 4,,10
+	.p2align 3
+.L1906:
+	movq	$-1, %r8
+	movl	$1363, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1907
+	.p2align 4,,10
+	.p2align 3
+.L1900:
+	xorl	%eax, %eax
+	movl	$1359, %edx
+	leaq	.LC0(%rip), %rsi
+	addl	$1, asserts_failed(%rip)
+	leaq	.LC1(%rip), %rdi
+	call	printf@PLT
+	movq	240(%rsp), %rbp
+	cmpq	$0, 912(%rbp)
+	jne	.L1902
+.L1976:
+	addl	$1, asserts_passed(%rip)
+	cmpq	$0, 1536(%rbp)
+	jne	.L1904
+.L1977:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1905
+	.p2align 4,,10
+	.p2align 3
+.L1897:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1899:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$1358, %edx
+	xorl	%eax, %eax
+	leaq	.LC253(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	240(%rsp), %rbp
+	jmp	.L1898
+	.p2align 4,,10
+	.p2align 3
+.L1889:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1891:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$1356, %edx
+	xorl	%eax, %eax
+	leaq	.LC252(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	movq	240(%rsp), %rbp
+	jmp	.L1890
+	.p2align 4,,10
+	.p2align 3
+.L1917:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L1919:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$1368, %edx
+	xorl	%eax, %eax
+	leaq	.LC258(%rip), %r8
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	printf@PLT
+	jmp	.L1918
+	.p2align 4,,10
+	.p2align 3
+.L1880:
+	xorl	%r8d, %r8d
+	movl	$1353, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1881
+	.p2align 4,,10
+	.p2align 3
+.L1910:
+	xorl	%r8d, %r8d
+	movl	$1365, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1911
+	.p2align 4,,10
+	.p2align 3
+.L1936:
+	xorl	%r8d, %r8d
+	movl	$1382, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1937
+	.p2align 4,,10
+	.p2align 3
+.L1938:
+	xorl	%r8d, %r8d
+	movl	$1383, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1939
+	.p2align 4,,10
+	.p2align 3
+.L1916:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC10(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L1919
+	.p2align 4,,10
+	.p2align 3
+.L1884:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC251(%rip), %rdx
+	leaq	.LC10(%rip), %r12
+	movq	%rdx, (%rsp)
+	addl	$1, %eax
+	jmp	.L1887
+	.cfi_endproc
+.LFE92:
+	.size	testReload, .-testReload
+	.p2align 4
+	.globl	testReloadParseError
+	.type	testReloadParseError, @function
+testReloadParseError:
+.LFB93:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	$10, %eax
+	subq	$240, %rsp
+	.cfi_def_cfa_offset 256
+	movdqa	.LC259(%rip), %xmm0
+	leaq	128(%rsp), %rbx
+	leaq	32(%rsp), %rsi
+	movw	%ax, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movdqa	.LC274(%rip), %xmm0
+	movq	%rbx, %rdi
+	movl	$668974, 48(%rsp)
+	movaps	%xmm0, (%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	leaq	64(%rsp), %rcx
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	movl	$17, %edx
+	call	wavefrontMTLReload@PLT
+	cmpl	$3, %eax
+	jne	.L1984
+	movl	104(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L1986
+.L1998:
+	addl	$1, asserts_passed(%rip)
+.L1987:
+	movl	136(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L1988
+	addl	$1, asserts_passed(%rip)
+.L1989:
+	movq	128(%rsp), %rax
+	movsd	.LC23(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC12(%rip), %xmm2
+	cvtss2sd	24(%rax), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L1990
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L1997
+.L1990:
+	movl	$1421, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L1993:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1997:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L1993
+	.p2align 4,,10
+	.p2align 3
+.L1988:
+	movl	$1, %r8d
+	movl	$1420, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1989
+	.p2align 4,,10
+	.p2align 3
+.L1984:
+	movslq	%eax, %rcx
+	movl	$3, %r8d
+	xorl	%eax, %eax
+	movl	$1418, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	104(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L1998
+.L1986:
+	xorl	%r8d, %r8d
+	movl	$1419, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L1987
+	.cfi_endproc
+.LFE93:
+	.size	testReloadParseError, .-testReloadParseError
+	.p2align 4
+	.globl	wavefrontMaterialParserTest
+	.type	wavefrontMaterialParserTest, @function
+wavefrontMaterialParserTest:
+.LFB94:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	xorl	%eax, %eax
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 144
+	call	testParseNewMaterial
+	xorl	%eax, %eax
+	leaq	16(%rsp), %rbx
+	call	testParseNewMaterialNoName
+	xorl	%eax, %eax
+	call	testParseNewMaterialGarbage
+	xorl	%eax, %eax
+	call	testParseAmbientRGB
+	xorl	%eax, %eax
+	call	testParseAmbientRGBOnlyR
+	xorl	%eax, %eax
+	call	testParseAmbientRGBOnlyREmptyG
+	xorl	%eax, %eax
+	call	testParseAmbientRGBOnlyRG
+	xorl	%eax, %eax
+	call	testParseAmbientRGBOnlyRGEmptyB
+	xorl	%eax, %eax
+	call	testParseAmbientRGBGarbage
+	xorl	%eax, %eax
+	call	testParseDiffuseRGB
+	xorl	%eax, %eax
+	call	testParseDiffuseRGBOnlyR
+	xorl	%eax, %eax
+	call	testParseDiffuseRGBOnlyRG
+	xorl	%eax, %eax
+	call	testParseDiffuseRGBGarbage
+	xorl	%eax, %eax
+	call	testParseSpecularRGB
+	xorl	%eax, %eax
+	call	testParseSpecularRGBOnlyR
+	xorl	%eax, %eax
+	call	testParseSpecularRGBOnlyRG
+	xorl	%eax, %eax
+	call	testParseSpecularRGBGarbage
+	xorl	%eax, %eax
+	call	testParseTransmissionRGB
+	xorl	%eax, %eax
+	call	testParseTransmissionRGBOnlyR
+	xorl	%eax, %eax
+	call	testParseTransmissionRGBOnlyRG
+	xorl	%eax, %eax
+	call	testParseTransmissionRGBGarbage
+	leaq	3(%rsp), %rsi
+	movq	%rbx, %rdi
+	movabsq	$7885080994129190947, %rax
+	movq	%rax, 3(%rsp)
+	movabsq	$13075866425585007, %rax
+	movq	%rax, 8(%rsp)
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L2000
+	addl	$1, asserts_passed(%rip)
+.L2001:
+	xorl	%eax, %eax
+	call	testParseIllumination
+	xorl	%eax, %eax
+	call	testParseIlluminationMissingNumber
+	xorl	%eax, %eax
+	call	testParseIlluminationEmptyNumber
+	xorl	%eax, %eax
+	call	testParseIlluminationInvalidNumber
+	xorl	%eax, %eax
+	call	testParseIlluminationIgnoresGarbage
+	xorl	%eax, %eax
+	call	testParseSpecularExponent
+	xorl	%eax, %eax
+	call	testParseReflectionMapSphere
+	xorl	%eax, %eax
+	call	testParseReflectionMapCube
+	xorl	%eax, %eax
+	call	testParseMapOptions
+	xorl	%eax, %eax
+	call	testParseMapOptionsReplaced
+	xorl	%eax, %eax
+	call	testParseMapOptionsGarbage
+	xorl	%eax, %eax
+	call	testParseAllMaps
+	xorl	%eax, %eax
+	call	testParseBumpSpellings
+	xorl	%eax, %eax
+	call	testParsePhysicallyBased
+	xorl	%eax, %eax
+	call	testParseBlenderWavefrontMaterial
+	xorl	%eax, %eax
+	call	testParseGuruWavefrontMaterial
+	xorl	%eax, %eax
+	call	testParseBufferNotTerminated
+	xorl	%eax, %eax
+	call	testParseReservesMaterials
+	xorl	%eax, %eax
+	call	testParseArena
+	xorl	%eax, %eax
+	call	testParseSharedTextures
+	xorl	%eax, %eax
+	call	testParseCarriageReturns
+	xorl	%eax, %eax
+	call	testParseLongLines
+	xorl	%eax, %eax
+	call	testParseChunked
+	xorl	%eax, %eax
+	call	testParseChunkedError
+	xorl	%eax, %eax
+	call	testParseFile
+	xorl	%eax, %eax
+	call	testParseFilePageSized
+	xorl	%eax, %eax
+	call	testParseFileEmpty
+	xorl	%edx, %edx
+	leaq	.LC224(%rip), %rsi
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L2002
+	addl	$1, asserts_passed(%rip)
+.L2003:
+	xorl	%edi, %edi
+	call	testParseParallel
+	movl	$1, %edi
+	call	testParseParallel
+	xorl	%eax, %eax
+	call	testParseParallelTextureOrder
+	xorl	%eax, %eax
+	call	testParseParallelError
+	xorl	%eax, %eax
+	call	testParseTolerant
+	xorl	%eax, %eax
+	call	testParseTolerantFull
+	xorl	%eax, %eax
+	call	testParseTolerantChunked
+	xorl	%eax, %eax
+	call	testParseTolerantParallel
+	xorl	%eax, %eax
+	call	testParseStats
+	xorl	%eax, %eax
+	call	testParseStatsParallel
+	xorl	%eax, %eax
+	call	testParseBatch
+	xorl	%eax, %eax
+	call	testIndex
+	xorl	%eax, %eax
+	call	testIndexParseError
+	xorl	%edi, %edi
+	call	testReload
+	movl	$1, %edi
+	call	testReload
+	xorl	%eax, %eax
+	call	testReloadParseError
+	xorl	%eax, %eax
+	call	testParseDuplicateMaterial
+	xorl	%eax, %eax
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	testParsePropertyBeforeMaterial
+	.p2align 4,,10
+	.p2align 3
+.L2002:
+	.cfi_restore_state
+	movl	$2, %r8d
+	movl	$896, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L2003
+	.p2align 4,,10
+	.p2align 3
+.L2000:
+	xorl	%r8d, %r8d
+	movl	$269, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L2001
+	.cfi_endproc
+.LFE94:
+	.size	wavefrontMaterialParserTest, .-wavefrontMaterialParserTest
+	.section	.rodata
+	.align 32
+	.type	tolerantInput, @object
+	.size	tolerantInput, 185
+tolerantInput:
+	.string	"# tolerant\nnewmtl first\nKa 0.1 0.2 0.3\nKa 0.5 x 0.5\nKd 0.4\r\nmap_Kd -bm abc diffuse.png\nnewmtl second\n  Ks 1 2 3 4\nNs 10\nrefl -type sphere -o sphere.png\nanisotropically_long_keyword\nTf "
+	.align 32
+	.type	libraryInput, @object
+	.size	libraryInput, 237
+libraryInput:
+	.string	"# Library\nnewmtl first\n\tKa 0.1 0.2 0.3\n\tKd 0.4 0.5 0.6\r\n\tNs 96.078431\n\tillum 2\n\tmap_Kd textures/first_diffuse.png\n\nnewmtl second\nKs 0.7\nd 0.25\nrefl -type cube_left left.png\nmap_Kn textures/first_diffuse.png\nnewmtl first\nTf 1 1 1\nNi 1.45"
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC3:
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.align 16
+.LC4:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.long	-1717986918
+	.long	1070176665
+	.align 8
+.LC12:
+	.long	-350469331
+	.long	1058682594
+	.align 8
+.LC14:
+	.long	-1717986918
+	.long	1071225241
+	.align 8
+.LC18:
+	.long	0
+	.long	1076101120
+	.section	.rodata.cst16
+	.align 16
+.LC20:
+	.quad	7935461790735361390
+	.quad	8243122654767183717
+	.align 16
+.LC21:
+	.quad	7598247071852617591
+	.quad	28820894338018401
+	.section	.rodata.cst8
+	.align 8
+.LC22:
+	.long	-1717986918
+	.long	1069128089
+	.align 8
+.LC23:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC24:
+	.long	1717986918
+	.long	1072064102
+	.align 8
+.LC25:
+	.long	0
+	.long	1072693248
+	.section	.rodata.cst16
+	.align 16
+.LC26:
+	.quad	3467878688000598377
+	.quad	3467830185567465774
+	.align 16
+.LC27:
+	.quad	7809639168886464877
+	.quad	13843058095377162
+	.align 16
+.LC28:
+	.quad	751082343382742113
+	.quad	9061273700426059
+	.align 16
+.LC29:
+	.quad	2333228590094707058
+	.quad	14968957999066672
+	.align 16
+.LC30:
+	.quad	3467878688000598377
+	.quad	9065671746924846
+	.align 16
+.LC31:
+	.quad	3467881986535481705
+	.quad	3467830185567465774
+	.align 16
+.LC32:
+	.quad	7809639168886464877
+	.quad	13843058095573770
+	.align 16
+.LC33:
+	.quad	2334073015024839026
+	.quad	14968957999066672
+	.align 16
+.LC34:
+	.quad	3467898479209898345
+	.quad	3467830185567465774
+	.align 16
+.LC35:
+	.quad	7809639168886464877
+	.quad	13843058096556810
+	.align 16
+.LC36:
+	.quad	2338295139675498866
+	.quad	14968957999066672
+	.align 16
+.LC37:
+	.quad	3467884224213442921
+	.quad	3467830185567465774
+	.align 16
+.LC38:
+	.quad	7809639168886464877
+	.quad	13843058095707146
+	.align 16
+.LC39:
+	.quad	2334645860582910322
+	.quad	14968957999066672
+	.align 16
+.LC40:
+	.quad	751082343382742113
+	.quad	14953828259228777
+	.align 16
+.LC41:
+	.quad	7019267274303434079
+	.quad	30809880997202540
+	.align 16
+.LC42:
+	.quad	7809639168886464877
+	.quad	9127550352386314
+	.align 16
+.LC43:
+	.quad	7812734947069880690
+	.quad	28820894338018677
+	.align 16
+.LC44:
+	.quad	8461256998324560233
+	.quad	7238235816989892717
+	.align 16
+.LC45:
+	.quad	7809639168886464877
+	.quad	14968958003400202
+	.align 16
+.LC46:
+	.quad	7811042144196256105
+	.quad	8295742047364853024
+	.align 16
+.LC47:
+	.quad	8102855774652688496
+	.quad	7453017777917551976
+	.align 16
+.LC54:
+	.quad	7811042144196256105
+	.quad	7142820542758006048
+	.align 16
+.LC55:
+	.quad	2337490752212656757
+	.quad	8026110988328578606
+	.align 16
+.LC56:
+	.quad	7453017778102284152
+	.quad	8371382932298101258
+	.align 16
+.LC57:
+	.quad	7305530614154096761
+	.quad	2336646327635501663
+	.align 16
+.LC58:
+	.quad	8026110988328578606
+	.quad	7453017778067615608
+	.align 16
+.LC59:
+	.quad	8371382932298101258
+	.quad	7305530614154096761
+	.align 16
+.LC60:
+	.quad	3323784542664418911
+	.quad	8678263280599510830
+	.align 16
+.LC61:
+	.quad	749689291075249711
+	.quad	8751669593168569714
+	.align 16
+.LC62:
+	.quad	6874008662564693360
+	.quad	3399705485486809442
+	.align 16
+.LC63:
+	.quad	7075005959411166067
+	.quad	7309916584526491243
+	.align 16
+.LC64:
+	.quad	7309475735102581862
+	.quad	7308321184363668256
+	.align 16
+.LC65:
+	.quad	7742584059768894566
+	.quad	3343478724509000313
+	.align 16
+.LC66:
+	.quad	7811042144195931760
+	.quad	7142820542758006048
+	.align 16
+.LC67:
+	.quad	7523097642493370997
+	.quad	8749213347572752500
+	.align 16
+.LC68:
+	.quad	3420606385722454831
+	.quad	2928473793262706
+	.section	.rodata.cst8
+	.align 8
+.LC70:
+	.long	0
+	.long	1070596096
+	.align 8
+.LC71:
+	.long	0
+	.long	1073741824
+	.align 8
+.LC72:
+	.long	858993459
+	.long	1070805811
+	.align 8
+.LC73:
+	.long	-1717986918
+	.long	1072273817
+	.align 8
+.LC74:
+	.long	0
+	.long	1073217536
+	.section	.rodata.cst16
+	.align 16
+.LC76:
+	.quad	6877103751948951913
+	.quad	3328195786497352779
+	.align 16
+.LC77:
+	.quad	3251657420601040949
+	.quad	3467899450237788275
+	.align 16
+.LC78:
+	.quad	3467826887032582446
+	.quad	3467892028751229742
+	.align 16
+.LC79:
+	.quad	3251660701988565550
+	.quad	8007529211674061922
+	.align 16
+.LC80:
+	.quad	7881699996089738854
+	.quad	7883882240003743856
+	.align 16
+.LC81:
+	.quad	2336277965151167334
+	.quad	2338324173856011309
+	.align 16
+.LC82:
+	.quad	8029744606578094389
+	.quad	3251657403470476403
+	.align 16
+.LC83:
+	.quad	7310503753812042595
+	.quad	7219115607247385720
+	.align 16
+.LC84:
+	.quad	7863396495954175593
+	.quad	729696863660175457
+	.align 16
+.LC85:
+	.quad	3251720200964301165
+	.quad	3251655204430441826
+	.align 16
+.LC86:
+	.quad	2336936577129475701
+	.quad	8029390805781995894
+	.align 16
+.LC87:
+	.quad	7886488416259765612
+	.quad	2928473793260641
+	.section	.rodata.cst8
+	.align 8
+.LC89:
+	.long	0
+	.long	1074790400
+	.section	.rodata.cst16
+	.align 16
+.LC90:
+	.quad	6877103751948951913
+	.quad	7881699996089738315
+	.align 16
+.LC91:
+	.quad	2338262248850399344
+	.quad	3347427358274887731
+	.align 16
+.LC92:
+	.quad	6877103751948627568
+	.quad	7957688353961305163
+	.align 16
+.LC93:
+	.quad	7309916584526491236
+	.quad	2320515387053075558
+	.align 16
+.LC94:
+	.quad	8102855774620447789
+	.quad	7809854320978060648
+	.align 16
+.LC95:
+	.quad	7378707224709066341
+	.quad	3343204078261924640
+	.align 16
+.LC116:
+	.quad	6877103751948951913
+	.quad	7957911537507656011
+	.align 16
+.LC117:
+	.quad	7226974963321604711
+	.quad	749689291074202400
+	.align 16
+.LC118:
+	.quad	7719296528873972077
+	.quad	7020278833491226227
+	.align 16
+.LC119:
+	.quad	3343196085275025264
+	.quad	6877103751948627568
+	.align 16
+.LC120:
+	.quad	7957911614867403598
+	.quad	2334095443160271463
+	.align 16
+.LC121:
+	.quad	7020278833491226212
+	.quad	3251722546384625520
+	.align 16
+.LC122:
+	.quad	7070709887463877986
+	.quad	749689291074989429
+	.align 16
+.LC123:
+	.quad	8316288277404674404
+	.quad	7305975934852542064
+	.align 16
+.LC124:
+	.quad	7017564125088473443
+	.quad	7020278833491226220
+	.align 16
+.LC125:
+	.quad	3346860757748834160
+	.quad	6877103751948627568
+	.align 16
+.LC126:
+	.quad	7957911589131152720
+	.quad	8309246248774077031
+	.align 16
+.LC127:
+	.quad	749689291075186720
+	.quad	8245930528292892526
+	.align 16
+.LC130:
+	.quad	6998713068242298222
+	.quad	3341988065730454026
+	.align 16
+.LC131:
+	.quad	7887884795658071664
+	.quad	8097873496352255092
+	.align 16
+.LC132:
+	.quad	3342269540707156575
+	.quad	7887884795658071664
+	.align 16
+.LC133:
+	.quad	8097873496369032308
+	.quad	7142835935719547487
+	.section	.rodata.cst8
+	.align 8
+.LC134:
+	.long	0
+	.long	1069547520
+	.align 8
+.LC135:
+	.long	0
+	.long	1072168960
+	.align 8
+.LC136:
+	.long	858993459
+	.long	1071854387
+	.section	.rodata.cst16
+	.align 16
+.LC137:
+	.quad	3467897401173107049
+	.quad	3539949497649279534
+	.align 16
+.LC138:
+	.quad	735544898382680074
+	.quad	3833180307291398992
+	.align 16
+.LC139:
+	.quad	3976168436930924554
+	.quad	2337213628289190453
+	.align 16
+.LC140:
+	.quad	8316299549978340912
+	.quad	5407193874615530095
+	.align 16
+.LC141:
+	.quad	3328195520227188837
+	.quad	8238220833301995570
+	.align 16
+.LC142:
+	.quad	8165037348014141472
+	.quad	8030878483327105312
+	.section	.rodata.cst8
+	.align 8
+.LC144:
+	.long	-171798692
+	.long	1074748456
+	.align 8
+.LC145:
+	.long	-858993459
+	.long	1072483532
+	.section	.rodata.cst16
+	.align 16
+.LC147:
+	.quad	7306085877388812323
+	.quad	7585786134556123250
+	.align 16
+.LC148:
+	.quad	8315179998402733420
+	.quad	2524873948071997044
+	.align 16
+.LC149:
+	.quad	7019267274303425824
+	.quad	4212113002155155564
+	.align 16
+.LC150:
+	.quad	8603403652559810848
+	.quad	7310575079013512301
+	.align 16
+.LC151:
+	.quad	3544386093138930034
+	.quad	2338298437217300526
+	.align 16
+.LC152:
+	.quad	3472328296261824051
+	.quad	3472607571915918090
+	.align 16
+.LC153:
+	.quad	3615880465630638128
+	.quad	3328195515965780016
+	.align 16
+.LC154:
+	.quad	5407187286136729651
+	.quad	3472328313373991012
+	.align 16
+.LC155:
+	.quad	3472333785194836016
+	.quad	3474014946796253232
+	.align 16
+.LC156:
+	.quad	2338295138665639984
+	.quad	3472328296228138544
+	.align 16
+.LC157:
+	.quad	3472328296361766944
+	.quad	3472328334848827440
+	.align 16
+.LC158:
+	.quad	3328195761279742000
+	.quad	7208627137084928053
+	.align 16
+.LC159:
+	.quad	3472328296261103648
+	.quad	2336652890210896432
+	.align 16
+.LC160:
+	.quad	7226974963321604658
+	.quad	7957911619250779168
+	.section	.rodata.cst8
+	.align 8
+.LC162:
+	.long	0
+	.long	1077936128
+	.section	.rodata.cst16
+	.align 16
+.LC163:
+	.quad	2524959675548901411
+	.quad	8233460163746022944
+	.align 16
+.LC164:
+	.quad	3467835915948548453
+	.quad	3544388080715705913
+	.align 16
+.LC165:
+	.quad	4192904279590248502
+	.quad	7887884795651960880
+	.align 16
+.LC166:
+	.quad	8243122654226181236
+	.quad	8391161943773962601
+	.align 16
+.LC167:
+	.quad	734705903681276170
+	.quad	8238219557746009097
+	.align 16
+.LC168:
+	.quad	3539941818228158496
+	.quad	7811784968029352224
+	.align 16
+.LC169:
+	.quad	5406864038043678060
+	.quad	3472328300489089121
+	.align 16
+.LC170:
+	.quad	2319406791654256672
+	.quad	651386079633681968
+	.align 16
+.LC171:
+	.quad	3472332685683221579
+	.quad	3472328317668958256
+	.align 16
+.LC172:
+	.quad	734139722886950944
+	.quad	3474296421777361673
+	.align 16
+.LC173:
+	.quad	3472337083729719344
+	.quad	3472328334848827440
+	.align 16
+.LC176:
+	.quad	7359001038431937902
+	.quad	2334073015160238697
+	.align 16
+.LC177:
+	.quad	2320811967212760624
+	.quad	7887884795654909488
+	.align 16
+.LC178:
+	.quad	7957688353961307252
+	.quad	8391722742284115812
+	.align 16
+.LC179:
+	.quad	7359001038431937902
+	.quad	8603403654343651945
+	.align 16
+.LC180:
+	.quad	2336370320201838090
+	.quad	2925175245071731
+	.align 16
+.LC183:
+	.quad	7359001038431937902
+	.quad	8097873496659685993
+	.align 16
+.LC184:
+	.quad	8318827349057751903
+	.quad	7020278833491226228
+	.align 16
+.LC185:
+	.quad	8099004988342886256
+	.quad	7957911550296285548
+	.align 16
+.LC186:
+	.quad	7814991612964899431
+	.quad	748844862738363168
+	.align 16
+.LC187:
+	.quad	8751669593168569714
+	.quad	8243109525148689776
+	.align 16
+.LC188:
+	.quad	7307214035175699045
+	.quad	2928473793258866
+	.align 16
+.LC190:
+	.quad	8241983636738689887
+	.quad	7857206223927403621
+	.align 16
+.LC191:
+	.quad	8029390843731210337
+	.quad	7453017778033880434
+	.align 16
+.LC192:
+	.quad	2336370320201838090
+	.quad	7857202925379216755
+	.align 16
+.LC193:
+	.quad	7526395017399595105
+	.quad	7453017777899926113
+	.align 16
+.LC194:
+	.quad	8371382932298101258
+	.quad	7307214035175698553
+	.align 16
+.LC195:
+	.quad	7886488416259764837
+	.quad	2928473793260641
+	.align 16
+.LC196:
+	.quad	2333228588501590377
+	.quad	2320811967212760624
+	.align 16
+.LC197:
+	.quad	8097873494927683120
+	.quad	8391162080155421535
+	.align 16
+.LC198:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.align 16
+.LC200:
+	.long	16
+	.long	16
+	.long	16
+	.long	16
+	.align 16
+.LC201:
+	.long	63
+	.long	63
+	.long	63
+	.long	63
+	.align 16
+.LC202:
+	.long	120
+	.long	120
+	.long	120
+	.long	120
+	.align 16
+.LC203:
+	.long	32
+	.long	32
+	.long	32
+	.long	32
+	.align 16
+.LC204:
+	.long	4
+	.long	4
+	.long	4
+	.long	4
+	.align 16
+.LC205:
+	.long	8
+	.long	8
+	.long	8
+	.long	8
+	.align 16
+.LC206:
+	.long	12
+	.long	12
+	.long	12
+	.long	12
+	.align 16
+.LC207:
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.align 16
+.LC211:
+	.quad	7359001038431937902
+	.quad	2333228590230106729
+	.align 16
+.LC212:
+	.quad	7957688353961307252
+	.quad	3615880466454481508
+	.align 16
+.LC213:
+	.quad	2336370320201838090
+	.quad	7226881522315454822
+	.align 16
+.LC214:
+	.quad	3467825787520966987
+	.quad	7929210765454619950
+	.align 16
+.LC215:
+	.quad	7308814895450781541
+	.quad	7598247071852617591
+	.section	.rodata.cst8
+	.align 8
+.LC221:
+	.long	0
+	.long	1076428800
+	.section	.rodata.cst16
+	.align 16
+.LC222:
+	.quad	2336370320201838090
+	.quad	2338298438345777516
+	.set	.LC226,.LC198+8
+	.section	.rodata.cst8
+	.align 8
+.LC230:
+	.long	2
+	.long	4
+	.align 8
+.LC232:
+	.long	8
+	.long	3
+	.section	.rodata.cst16
+	.align 16
+.LC235:
+	.quad	753073524615356451
+	.quad	7359001038431937902
+	.align 16
+.LC236:
+	.quad	2334073015160238697
+	.quad	2338298436563316272
+	.align 16
+.LC237:
+	.quad	5431183239375630385
+	.quad	3347427358274887780
+	.align 16
+.LC238:
+	.quad	7887884795658071664
+	.quad	7957688353961307252
+	.align 16
+.LC239:
+	.quad	7814991612964899428
+	.quad	5407262341801272864
+	.align 16
+.LC247:
+	.quad	7929208566431376459
+	.quad	8027420510993086309
+	.align 16
+.LC248:
+	.quad	3328195739754587247
+	.quad	7814991612964899381
+	.align 16
+.LC249:
+	.quad	2334073014890619424
+	.quad	7814991612964899448
+	.align 16
+.LC250:
+	.quad	8027420510993086309
+	.quad	14672378391585903
+	.align 16
+.LC259:
+	.quad	7719289008621577582
+	.quad	3467881986536009829
+	.align 16
+.LC260:
+	.quad	5431183239375631662
+	.quad	8083526407263297636
+	.align 16
+.LC261:
+	.quad	8389492958382679918
+	.quad	7306930285074129004
+	.align 16
+.LC262:
+	.quad	3832053248618596964
+	.quad	2336370320201838090
+	.align 16
+.LC263:
+	.quad	748834997400331634
+	.quad	8223692166887073134
+	.align 16
+.LC264:
+	.quad	7857202886690827877
+	.quad	8029390843731210337
+	.align 16
+.LC265:
+	.quad	7886488416260344671
+	.quad	2928473793260641
+	.align 16
+.LC266:
+	.quad	6998713068242298222
+	.quad	8097873496390329444
+	.align 16
+.LC267:
+	.quad	7306074863819836255
+	.quad	7308790684619648612
+	.align 16
+.LC268:
+	.quad	7954889800403938679
+	.quad	8603404019146517857
+	.align 16
+.LC269:
+	.quad	2336888129931275530
+	.quad	8083517546880462702
+	.align 16
+.LC270:
+	.quad	3976168436694452836
+	.quad	7226974963321604661
+	.align 16
+.LC271:
+	.quad	7957911619200445216
+	.quad	7814991612964899431
+	.align 16
+.LC272:
+	.quad	7226881522264271648
+	.quad	8097873495598182432
+	.align 16
+.LC273:
+	.quad	7307970435472126049
+	.quad	2928473793262704
+	.align 16
+.LC274:
+	.quad	7719289008621577582
+	.quad	8656028757266821221
+	.section	.note.GNU-stack,"",@progbits
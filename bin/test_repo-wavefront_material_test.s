@@ -0,0 +1,3703 @@
+	.file	"wavefront_material_test.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"(null)"
+.LC1:
+	.string	"first"
+.LC2:
+	.string	"src/wavefront_material_test.c"
+.LC3:
+	.string	"%s:%d: %lld != %lld\n"
+.LC4:
+	.string	"second"
+.LC5:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+	.text
+	.p2align 4
+	.globl	testAddMaterial
+	.type	testAddMaterial, @function
+testAddMaterial:
+.LFB22:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$112, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	leaq	.LC1(%rip), %rdi
+	call	strCopy@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L2
+	addl	$1, asserts_passed(%rip)
+.L3:
+	leaq	.LC4(%rip), %rbp
+	movq	%rbp, %rdi
+	call	strCopy@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L4
+	addl	$1, asserts_passed(%rip)
+.L5:
+	movl	8(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L6
+	movq	(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movq	456(%rax), %r12
+	testq	%r12, %r12
+	je	.L8
+.L17:
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L16
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L11:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r12, %rcx
+	movl	$17, %edx
+	xorl	%eax, %eax
+	leaq	.LC4(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+.L10:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movl	8(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L12
+	addl	$1, asserts_passed(%rip)
+	addq	$112, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	movl	$2, %r8d
+	movl	$16, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rax
+	movq	456(%rax), %r12
+	testq	%r12, %r12
+	jne	.L17
+.L8:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r12
+	addl	$1, %eax
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	xorl	%r8d, %r8d
+	movl	$19, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$112, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$15, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L5
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	xorl	%r8d, %r8d
+	movl	$13, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L3
+	.cfi_endproc
+.LFE22:
+	.size	testAddMaterial, .-testAddMaterial
+	.p2align 4
+	.globl	testAddMaterialReusesName
+	.type	testAddMaterialReusesName, @function
+testAddMaterialReusesName:
+.LFB23:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	.LC4(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$112, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	leaq	.LC1(%rip), %rdi
+	call	strCopy@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%rbp, %rdi
+	call	strCopy@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%rbp, %rdi
+	call	strCopy@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	movq	%rax, %r12
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r12, %rdi
+	movl	%eax, %ebp
+	call	free@PLT
+	cmpl	$1, %ebp
+	jne	.L19
+	movl	8(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$2, %rcx
+	jne	.L21
+.L24:
+	addl	$1, asserts_passed(%rip)
+.L22:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$112, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.cfi_restore_state
+	movslq	%ebp, %rcx
+	movl	$1, %r8d
+	movl	$30, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	8(%rsp), %ecx
+	cmpq	$2, %rcx
+	je	.L24
+.L21:
+	movl	$2, %r8d
+	movl	$31, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L22
+	.cfi_endproc
+.LFE23:
+	.size	testAddMaterialReusesName, .-testAddMaterialReusesName
+	.section	.rodata.str1.1
+.LC6:
+	.string	"missing"
+.LC7:
+	.string	"material_%d"
+.LC8:
+	.string	"material_0"
+.LC9:
+	.string	"material_517"
+.LC10:
+	.string	"material_999"
+.LC11:
+	.string	"material_1000"
+.LC12:
+	.string	"material_42_suffix"
+.LC13:
+	.string	"material_4"
+	.text
+	.p2align 4
+	.globl	testFindMaterial
+	.type	testFindMaterial, @function
+testFindMaterial:
+.LFB24:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 192
+	leaq	32(%rsp), %r12
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	leaq	.LC6(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	cmpl	$-1, %eax
+	jne	.L26
+	addl	$1, asserts_passed(%rip)
+.L27:
+	xorl	%ebx, %ebx
+	movq	%rsp, %rbp
+	leaq	.LC7(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movl	%ebx, %edx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	call	sprintf@PLT
+	movq	%rbp, %rdi
+	addl	$1, %ebx
+	call	strCopy@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	cmpl	$1000, %ebx
+	jne	.L28
+	movl	40(%rsp), %ecx
+	cmpq	$1000, %rcx
+	jne	.L29
+	addl	$1, asserts_passed(%rip)
+.L30:
+	leaq	.LC8(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L31
+	addl	$1, asserts_passed(%rip)
+.L32:
+	leaq	.LC9(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$517, %eax
+	jne	.L33
+	addl	$1, asserts_passed(%rip)
+.L34:
+	leaq	.LC10(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$999, %eax
+	jne	.L35
+	addl	$1, asserts_passed(%rip)
+.L36:
+	leaq	.LC11(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L37
+	addl	$1, asserts_passed(%rip)
+.L38:
+	movl	$11, %edx
+	leaq	.LC12(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterialN@PLT
+	movslq	%eax, %rcx
+	cmpl	$42, %eax
+	jne	.L39
+	addl	$1, asserts_passed(%rip)
+.L40:
+	movl	$9, %edx
+	leaq	.LC13(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterialN@PLT
+	movslq	%eax, %rcx
+	cmpl	$-1, %eax
+	jne	.L41
+	addl	$1, asserts_passed(%rip)
+.L42:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L26:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movq	$-1, %r8
+	xorl	%eax, %eax
+	movl	$38, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L27
+.L41:
+	movq	$-1, %r8
+	movl	$51, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L42
+.L39:
+	movl	$42, %r8d
+	movl	$50, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L40
+.L37:
+	movq	$-1, %r8
+	movl	$49, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L38
+.L35:
+	movl	$999, %r8d
+	movl	$48, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L36
+.L33:
+	movl	$517, %r8d
+	movl	$47, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L34
+.L29:
+	movl	$1000, %r8d
+	movl	$45, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L30
+.L31:
+	xorl	%r8d, %r8d
+	movl	$46, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L32
+	.cfi_endproc
+.LFE24:
+	.size	testFindMaterial, .-testFindMaterial
+	.section	.rodata.str1.1
+.LC14:
+	.string	"material_100"
+	.text
+	.p2align 4
+	.globl	testReserveMaterials
+	.type	testReserveMaterials, @function
+testReserveMaterials:
+.LFB25:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$144, %rsp
+	.cfi_def_cfa_offset 192
+	leaq	32(%rsp), %r12
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	movl	$100, %esi
+	movq	%r12, %rdi
+	call	wavefrontMTLReserve@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L46
+	addl	$1, asserts_passed(%rip)
+.L47:
+	movl	44(%rsp), %ecx
+	cmpq	$100, %rcx
+	jne	.L48
+	addl	$1, asserts_passed(%rip)
+.L49:
+	movq	32(%rsp), %r14
+	xorl	%ebx, %ebx
+	movq	%rsp, %rbp
+	leaq	.LC7(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	movl	%ebx, %edx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	call	sprintf@PLT
+	movq	%rbp, %rdi
+	addl	$1, %ebx
+	call	strCopy@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	cmpl	$100, %ebx
+	jne	.L50
+	cmpq	%r14, 32(%rsp)
+	je	.L65
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$68, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L52:
+	movl	44(%rsp), %ecx
+	cmpq	$100, %rcx
+	jne	.L53
+	addl	$1, asserts_passed(%rip)
+.L54:
+	leaq	.LC14(%rip), %rbx
+	movq	%rbx, %rdi
+	call	strCopy@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movl	44(%rsp), %ecx
+	cmpq	$200, %rcx
+	jne	.L55
+	movq	%r12, %rdi
+	addl	$1, asserts_passed(%rip)
+	call	wavefrontMTLShrinkToFit@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L57
+.L66:
+	addl	$1, asserts_passed(%rip)
+.L58:
+	movl	44(%rsp), %ecx
+	cmpq	$101, %rcx
+	jne	.L59
+	addl	$1, asserts_passed(%rip)
+.L60:
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$100, %eax
+	jne	.L61
+	addl	$1, asserts_passed(%rip)
+.L62:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$144, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L48:
+	.cfi_restore_state
+	movl	$100, %r8d
+	movl	$60, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L49
+.L61:
+	movl	$100, %r8d
+	movl	$76, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L62
+.L59:
+	movl	$101, %r8d
+	movl	$75, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L60
+.L55:
+	movl	$200, %r8d
+	movl	$72, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLShrinkToFit@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	je	.L66
+.L57:
+	xorl	%r8d, %r8d
+	movl	$74, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L58
+.L53:
+	movl	$100, %r8d
+	movl	$69, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L54
+.L65:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L52
+.L46:
+	xorl	%r8d, %r8d
+	movl	$59, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L47
+	.cfi_endproc
+.LFE25:
+	.size	testReserveMaterials, .-testReserveMaterials
+	.p2align 4
+	.globl	testShrinkEmpty
+	.type	testShrinkEmpty, @function
+testShrinkEmpty:
+.LFB26:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$112, %rsp
+	.cfi_def_cfa_offset 128
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movl	$10, %esi
+	movq	%rbx, %rdi
+	call	wavefrontMTLReserve@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLShrinkToFit@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L68
+	addl	$1, asserts_passed(%rip)
+.L69:
+	movl	12(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L70
+	addl	$1, asserts_passed(%rip)
+.L71:
+	cmpq	$0, (%rsp)
+	je	.L75
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$87, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$112, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	addl	$1, asserts_passed(%rip)
+	call	wavefrontMTLRelease@PLT
+	addq	$112, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$86, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L71
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	xorl	%r8d, %r8d
+	movl	$85, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L69
+	.cfi_endproc
+.LFE26:
+	.size	testShrinkEmpty, .-testShrinkEmpty
+	.section	.rodata.str1.1
+.LC15:
+	.string	"file.png"
+.LC16:
+	.string	"file"
+.LC17:
+	.string	"material_4999"
+.LC18:
+	.string	"material_2500"
+	.text
+	.p2align 4
+	.globl	testArenaStrings
+	.type	testArenaStrings, @function
+testArenaStrings:
+.LFB27:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	.LC7(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	xorl	%ebx, %ebx
+	subq	$100152, %rsp
+	.cfi_def_cfa_offset 100192
+	leaq	32(%rsp), %r12
+	movq	%rsp, %rbp
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	orl	$1, 124(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	movl	%ebx, %edx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	call	sprintf@PLT
+	movq	%rbp, %rdi
+	addl	$1, %ebx
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	cmpl	$5000, %ebx
+	jne	.L77
+	leaq	144(%rsp), %rbx
+	movl	$100000, %edx
+	movl	$120, %esi
+	movq	%rbx, %rdi
+	call	memset@PLT
+	movq	%r12, %rdi
+	movl	$100000, %edx
+	movq	%rbx, %rsi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rax, %rdi
+	movq	32(%rsp), %rax
+	movq	%rdi, 152(%rax)
+	call	strlen@PLT
+	cmpq	$100000, %rax
+	jne	.L78
+	addl	$1, asserts_passed(%rip)
+.L79:
+	movl	$4, %edx
+	leaq	.LC15(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L80
+	leaq	.LC16(%rip), %rsi
+	movq	%rax, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L96
+	movl	asserts_failed(%rip), %eax
+	movq	%rbx, %rcx
+	addl	$1, %eax
+.L83:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC16(%rip), %r8
+	xorl	%eax, %eax
+	movl	$108, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+.L82:
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFreeString@PLT
+	movl	40(%rsp), %ecx
+	cmpq	$5000, %rcx
+	jne	.L84
+	addl	$1, asserts_passed(%rip)
+.L85:
+	movq	32(%rsp), %rax
+	movq	2279544(%rax), %rbx
+	testq	%rbx, %rbx
+	je	.L86
+	leaq	.LC17(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L87
+	addl	$1, asserts_passed(%rip)
+.L88:
+	leaq	.LC18(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$2500, %eax
+	jne	.L90
+	addl	$1, asserts_passed(%rip)
+.L91:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	cmpq	$0, 128(%rsp)
+	je	.L97
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$115, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$100152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L96:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L82
+.L90:
+	movl	$2500, %r8d
+	movl	$113, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L91
+.L84:
+	movl	$5000, %r8d
+	movl	$111, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L85
+.L78:
+	movq	%rax, %rcx
+	movl	$100000, %r8d
+	xorl	%eax, %eax
+	movl	$106, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L79
+.L97:
+	addl	$1, asserts_passed(%rip)
+	addq	$100152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L87:
+	.cfi_restore_state
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L89:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$112, %edx
+	xorl	%eax, %eax
+	leaq	.LC17(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	jmp	.L88
+.L86:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L89
+.L80:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L83
+	.cfi_endproc
+.LFE27:
+	.size	testArenaStrings, .-testArenaStrings
+	.section	.rodata.str1.1
+.LC19:
+	.string	"material"
+.LC20:
+	.string	"bump.png"
+.LC21:
+	.string	"a.png"
+.LC22:
+	.string	"b.png|"
+.LC23:
+	.string	"b.png"
+.LC24:
+	.string	"texture_%d.png"
+.LC25:
+	.string	"texture_50.png"
+	.text
+	.p2align 4
+	.globl	testInternTexture
+	.type	testInternTexture, @function
+testInternTexture:
+.LFB28:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$160, %rsp
+	.cfi_def_cfa_offset 208
+	leaq	48(%rsp), %r12
+	leaq	4(%rsp), %r13
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	leaq	.LC19(%rip), %rdi
+	call	strCopy@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	48(%rsp), %rbx
+	leaq	.LC20(%rip), %rdi
+	call	strCopy@PLT
+	movq	%r13, %rcx
+	movl	$5, %edx
+	movq	%r12, %rdi
+	movq	%rax, 232(%rbx)
+	leaq	.LC21(%rip), %rbx
+	movq	%rbx, %rsi
+	movl	$0, 4(%rsp)
+	movl	$0, 8(%rsp)
+	movl	$0, 12(%rsp)
+	call	wavefrontMTLInternTexture@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L99
+	addl	$1, asserts_passed(%rip)
+.L100:
+	leaq	8(%rsp), %rcx
+	movl	$5, %edx
+	leaq	.LC22(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLInternTexture@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L101
+	addl	$1, asserts_passed(%rip)
+.L102:
+	leaq	12(%rsp), %rcx
+	movl	$5, %edx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLInternTexture@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L103
+	addl	$1, asserts_passed(%rip)
+.L104:
+	movl	4(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L105
+	addl	$1, asserts_passed(%rip)
+.L106:
+	movl	8(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L107
+	addl	$1, asserts_passed(%rip)
+.L108:
+	movl	12(%rsp), %ecx
+	cmpq	$1, %rcx
+	jne	.L109
+	addl	$1, asserts_passed(%rip)
+.L110:
+	movl	88(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L111
+	movq	80(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movq	8(%rax), %rbx
+	testq	%rbx, %rbx
+	je	.L113
+.L125:
+	leaq	.LC23(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L124
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L116:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbx, %rcx
+	movl	$133, %edx
+	xorl	%eax, %eax
+	leaq	.LC23(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+.L115:
+	xorl	%ebx, %ebx
+	leaq	16(%rsp), %rbp
+	leaq	.LC24(%rip), %r14
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	movl	%ebx, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	call	sprintf@PLT
+	movq	%rbp, %rdi
+	addl	$1, %ebx
+	call	strlen@PLT
+	movq	%r13, %rcx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	cmpl	$100, %ebx
+	jne	.L117
+	movl	88(%rsp), %ecx
+	cmpq	$102, %rcx
+	jne	.L118
+	addl	$1, asserts_passed(%rip)
+.L119:
+	movq	%r13, %rcx
+	movl	$14, %edx
+	leaq	.LC25(%rip), %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLInternTexture@PLT
+	movl	4(%rsp), %ecx
+	cmpq	$53, %rcx
+	jne	.L120
+	addl	$1, asserts_passed(%rip)
+.L121:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$160, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L124:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L115
+.L120:
+	movl	$53, %r8d
+	movl	$142, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L121
+.L118:
+	movl	$102, %r8d
+	movl	$140, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L119
+.L111:
+	movl	$2, %r8d
+	movl	$132, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	80(%rsp), %rax
+	movq	8(%rax), %rbx
+	testq	%rbx, %rbx
+	jne	.L125
+.L113:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rbx
+	addl	$1, %eax
+	jmp	.L116
+.L109:
+	movl	$1, %r8d
+	movl	$131, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L110
+.L107:
+	movl	$2, %r8d
+	movl	$130, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L108
+.L105:
+	movl	$1, %r8d
+	movl	$129, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L106
+.L103:
+	xorl	%r8d, %r8d
+	movl	$128, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L104
+.L101:
+	xorl	%r8d, %r8d
+	movl	$127, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L102
+.L99:
+	xorl	%r8d, %r8d
+	movl	$126, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L100
+	.cfi_endproc
+.LFE28:
+	.size	testInternTexture, .-testInternTexture
+	.section	.rodata.str1.1
+.LC27:
+	.string	"third"
+.LC29:
+	.string	"c.png"
+.LC31:
+	.string	"fourth"
+.LC32:
+	.string	"d.png"
+.LC36:
+	.string	"%s:%d: %f != %f\n"
+	.text
+	.p2align 4
+	.globl	testAppend
+	.type	testAppend, @function
+testAppend:
+.LFB31:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC32(%rip), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC1(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC4(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	leaq	80(%rsp), %r12
+	leaq	192(%rsp), %rbx
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%r14, %rdi
+	movl	%ebp, 284(%rsp)
+	movl	%ebp, 172(%rsp)
+	leaq	16(%rsp), %rbp
+	movl	$0, 16(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	leaq	.LC21(%rip), %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	leaq	.LC21(%rip), %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	88(%rsp), %eax
+	movq	80(%rsp), %rdx
+	movq	%r13, %rdi
+	movq	112(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	16(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	movl	$0, 16(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	leaq	.LC23(%rip), %r13
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	88(%rsp), %eax
+	movq	80(%rsp), %rdx
+	movq	%rbp, %rdi
+	movq	112(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	16(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	call	wavefrontMapOptionsCompose@PLT
+	movl	88(%rsp), %eax
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	movq	80(%rsp), %rdx
+	movl	$0x40000000, 52(%rsp)
+	imulq	$456, %rax, %rax
+	leaq	-292(%rdx,%rax), %rdx
+	call	wavefrontMTLInternMapOptions@PLT
+	leaq	.LC27(%rip), %rdi
+	movl	$0, 16(%rsp)
+	call	strlen@PLT
+	leaq	.LC27(%rip), %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	200(%rsp), %eax
+	movq	192(%rsp), %rdx
+	movq	%rbp, %rdi
+	movq	224(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	16(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	call	wavefrontMapOptionsCompose@PLT
+	movl	200(%rsp), %eax
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	192(%rsp), %rdx
+	movl	$0x40400000, 52(%rsp)
+	imulq	$456, %rax, %rax
+	leaq	-292(%rdx,%rax), %rdx
+	call	wavefrontMTLInternMapOptions@PLT
+	movq	%r14, %rdi
+	movl	$0, 16(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	leaq	.LC29(%rip), %r14
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%rbp, %rcx
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	leaq	.LC31(%rip), %r14
+	call	wavefrontMTLInternTexture@PLT
+	movl	200(%rsp), %eax
+	movq	192(%rsp), %rdx
+	movq	%rbp, %rdi
+	movq	224(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	16(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	call	wavefrontMapOptionsCompose@PLT
+	movl	200(%rsp), %eax
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	192(%rsp), %rdx
+	movl	$0x40800000, 52(%rsp)
+	imulq	$456, %rax, %rax
+	leaq	-292(%rdx,%rax), %rdx
+	call	wavefrontMTLInternMapOptions@PLT
+	movq	%r14, %rdi
+	movl	$0, 16(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r15, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rcx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	200(%rsp), %eax
+	movq	192(%rsp), %rdx
+	movq	%rbp, %rdi
+	movq	224(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	16(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	call	wavefrontMapOptionsCompose@PLT
+	movl	200(%rsp), %eax
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	192(%rsp), %rdx
+	movl	$0x40000000, 52(%rsp)
+	imulq	$456, %rax, %rax
+	leaq	-292(%rdx,%rax), %rdx
+	call	wavefrontMTLInternMapOptions@PLT
+	movq	192(%rsp), %rax
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	$0x3f000000, 92(%rax)
+	call	wavefrontMTLAppend@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L127
+	addl	$1, asserts_passed(%rip)
+.L128:
+	movl	200(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L129
+	addl	$1, asserts_passed(%rip)
+.L130:
+	movl	232(%rsp), %ecx
+	testq	%rcx, %rcx
+	jne	.L131
+	addl	$1, asserts_passed(%rip)
+.L132:
+	movl	88(%rsp), %ecx
+	cmpq	$4, %rcx
+	jne	.L133
+	addl	$1, asserts_passed(%rip)
+.L134:
+	movq	80(%rsp), %rbp
+	movq	912(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L135
+	movq	%rcx, %rdi
+	leaq	.LC27(%rip), %rsi
+	movq	%rcx, 8(%rsp)
+	call	strcmp@PLT
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L188
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L138:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC27(%rip), %r8
+	xorl	%eax, %eax
+	movl	$185, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	80(%rsp), %rbp
+	movq	1368(%rbp), %rcx
+	testq	%rcx, %rcx
+	je	.L139
+.L189:
+	movq	%rcx, %rdi
+	movq	%r14, %rsi
+	movq	%rcx, 8(%rsp)
+	call	strcmp@PLT
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L140
+	addl	$1, asserts_passed(%rip)
+.L141:
+	movsd	.LC34(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC35(%rip), %xmm3
+	cvtss2sd	1004(%rbp), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L143
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm3
+	jbe	.L143
+	movq	152(%rbp), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	je	.L147
+.L190:
+	leaq	.LC21(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L148
+	addl	$1, asserts_passed(%rip)
+.L149:
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$3, %eax
+	jne	.L151
+	addl	$1, asserts_passed(%rip)
+.L152:
+	movl	120(%rsp), %ecx
+	cmpq	$3, %rcx
+	jne	.L153
+	movq	112(%rsp), %rax
+	addl	$1, asserts_passed(%rip)
+	movq	16(%rax), %rbp
+	testq	%rbp, %rbp
+	je	.L155
+.L193:
+	movq	%r15, %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L156
+	addl	$1, asserts_passed(%rip)
+.L157:
+	movq	80(%rsp), %rbp
+	movl	1072(%rbp), %ecx
+	cmpq	$2, %rcx
+	jne	.L159
+	movq	1064(%rbp), %r14
+	addl	$1, asserts_passed(%rip)
+	testq	%r14, %r14
+	je	.L161
+.L192:
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L162
+	addl	$1, asserts_passed(%rip)
+.L163:
+	movl	1528(%rbp), %ecx
+	cmpq	$3, %rcx
+	jne	.L165
+	movq	1520(%rbp), %rbp
+	addl	$1, asserts_passed(%rip)
+	testq	%rbp, %rbp
+	je	.L167
+.L191:
+	movq	%r15, %rsi
+	movq	%rbp, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L168
+	movl	264(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L171
+.L194:
+	addl	$1, asserts_passed(%rip)
+.L172:
+	movl	152(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L173
+	addl	$1, asserts_passed(%rip)
+.L174:
+	movq	80(%rsp), %rax
+	movl	1076(%rax), %ecx
+	cmpq	$2, %rcx
+	jne	.L175
+	addl	$1, asserts_passed(%rip)
+.L176:
+	movq	144(%rsp), %rax
+	movsd	.LC37(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC35(%rip), %xmm4
+	cvtss2sd	100(%rax), %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L177
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L177
+	addl	$1, asserts_passed(%rip)
+.L180:
+	movq	80(%rsp), %rax
+	movl	1532(%rax), %ecx
+	cmpq	$1, %rcx
+	jne	.L181
+	addl	$1, asserts_passed(%rip)
+.L182:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L188:
+	.cfi_restore_state
+	movq	1368(%rbp), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L189
+.L139:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L142
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	movl	$204, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC36(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L180
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	movl	$187, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC36(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	80(%rsp), %rbp
+	movq	152(%rbp), %rbp
+	testq	%rbp, %rbp
+	jne	.L190
+.L147:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	movl	$4, %r8d
+	movl	$184, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L134
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	movl	$1, %r8d
+	movl	$205, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L182
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movl	$2, %r8d
+	movl	$203, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	movl	$2, %r8d
+	movl	$202, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L174
+	.p2align 4,,10
+	.p2align 3
+.L165:
+	movl	$3, %r8d
+	movl	$198, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	80(%rsp), %rbp
+	movq	1520(%rbp), %rbp
+	testq	%rbp, %rbp
+	jne	.L191
+.L167:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L170
+	.p2align 4,,10
+	.p2align 3
+.L159:
+	movl	$2, %r8d
+	movl	$196, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	80(%rsp), %rbp
+	movq	1064(%rbp), %r14
+	testq	%r14, %r14
+	jne	.L192
+.L161:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %r14
+	addl	$1, %eax
+	jmp	.L164
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	movl	$3, %r8d
+	movl	$194, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	112(%rsp), %rax
+	movq	16(%rax), %rbp
+	testq	%rbp, %rbp
+	jne	.L193
+.L155:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rbp
+	addl	$1, %eax
+	jmp	.L158
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	movl	$3, %r8d
+	movl	$190, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L152
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L150:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$189, %edx
+	xorl	%eax, %eax
+	leaq	.LC21(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	jmp	.L149
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L158:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$195, %edx
+	xorl	%eax, %eax
+	leaq	.LC32(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	jmp	.L157
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L142:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC31(%rip), %r8
+	xorl	%eax, %eax
+	movl	$186, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	80(%rsp), %rbp
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L164:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r14, %rcx
+	movl	$197, %edx
+	xorl	%eax, %eax
+	leaq	.LC23(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	80(%rsp), %rbp
+	jmp	.L163
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L170:
+	movl	%eax, asserts_failed(%rip)
+	movq	%rbp, %rcx
+	movl	$199, %edx
+	xorl	%eax, %eax
+	leaq	.LC32(%rip), %r8
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movl	264(%rsp), %ecx
+	testq	%rcx, %rcx
+	je	.L194
+.L171:
+	xorl	%r8d, %r8d
+	movl	$201, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L172
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	xorl	%r8d, %r8d
+	movl	$183, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L132
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	xorl	%r8d, %r8d
+	movl	$182, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L130
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	xorl	%r8d, %r8d
+	movl	$181, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L128
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L138
+	.cfi_endproc
+.LFE31:
+	.size	testAppend, .-testAppend
+	.p2align 4
+	.globl	testAppendFlagsMismatch
+	.type	testAppendFlagsMismatch, @function
+testAppendFlagsMismatch:
+.LFB32:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 256
+	movq	%rsp, %rbx
+	leaq	112(%rsp), %rbp
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$1, 204(%rsp)
+	call	wavefrontMTLAppend@PLT
+	cmpl	$2, %eax
+	jne	.L196
+	addl	$1, asserts_passed(%rip)
+	addq	$232, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$2, %r8d
+	xorl	%eax, %eax
+	movl	$215, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$232, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	testAppendFlagsMismatch, .-testAppendFlagsMismatch
+	.p2align 4
+	.globl	testMaterialEqual
+	.type	testMaterialEqual, @function
+testMaterialEqual:
+.LFB33:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC1(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC21(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	.LC4(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$328, %rsp
+	.cfi_def_cfa_offset 384
+	leaq	96(%rsp), %rbx
+	leaq	208(%rsp), %r12
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%r14, %rdi
+	movl	$0, 208(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	104(%rsp), %eax
+	movq	96(%rsp), %rdx
+	movq	%rbp, %rdi
+	movq	128(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	208(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	movl	$0, 208(%rsp)
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	104(%rsp), %eax
+	movq	96(%rsp), %rbp
+	movq	%rbx, %rdi
+	movl	208(%rsp), %edx
+	movq	128(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	456(%rbp), %r15
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movq	%rbp, %rsi
+	leaq	-456(%rbp,%rax), %rax
+	movq	%rcx, 152(%rax)
+	movq	%r15, %rcx
+	movl	%edx, 160(%rax)
+	movq	%rbx, %rdx
+	call	wavefrontMaterialEqual@PLT
+	cmpl	$1, %eax
+	jne	.L200
+	addl	$1, asserts_passed(%rip)
+.L201:
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$0x3f000000, 548(%rbp)
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L202
+	addl	$1, asserts_passed(%rip)
+.L203:
+	movl	$0x00000000, 548(%rbp)
+	movq	%r13, %rdi
+	call	strCopy@PLT
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, 688(%rbp)
+	movq	%rbx, %rdi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L204
+	addl	$1, asserts_passed(%rip)
+.L205:
+	movq	%r13, %rdi
+	call	strCopy@PLT
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, 232(%rbp)
+	movq	%rbx, %rdi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L206
+	addl	$1, asserts_passed(%rip)
+.L207:
+	leaq	32(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, (%rsp)
+	call	wavefrontMapOptionsCompose@PLT
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdi
+	leaq	700(%rbp), %rdx
+	movl	$0x40000000, 68(%rsp)
+	call	wavefrontMTLInternMapOptions@PLT
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L208
+	addl	$1, asserts_passed(%rip)
+.L209:
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%r14, %rdi
+	movl	$0, 28(%rsp)
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	leaq	28(%rsp), %rcx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	movq	%rcx, 8(%rsp)
+	call	wavefrontMTLInternTexture@PLT
+	movl	216(%rsp), %eax
+	movl	28(%rsp), %edx
+	movq	240(%rsp), %rsi
+	movq	208(%rsp), %r14
+	imulq	$456, %rax, %rax
+	leal	-1(%rdx), %edi
+	movq	(%rsi,%rdi,8), %rsi
+	movq	%r13, %rdi
+	leaq	-456(%r14,%rax), %rax
+	movq	%rsi, 152(%rax)
+	movl	%edx, 160(%rax)
+	call	strCopy@PLT
+	movq	(%rsp), %r13
+	movq	%r12, %rdi
+	movq	8(%rsp), %rdx
+	movq	%rax, 232(%r14)
+	movq	%r13, %rsi
+	movl	$0x40400000, 68(%rsp)
+	call	wavefrontMTLInternMapOptions@PLT
+	leaq	244(%r14), %rdx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movl	$0x40000000, 68(%rsp)
+	call	wavefrontMTLInternMapOptions@PLT
+	movl	244(%r14), %ecx
+	cmpq	$2, %rcx
+	jne	.L210
+	addl	$1, asserts_passed(%rip)
+.L211:
+	movq	%r14, %rcx
+	movq	%r12, %rdx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L212
+	addl	$1, asserts_passed(%rip)
+.L213:
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialHash@PLT
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	movl	%eax, %r13d
+	call	wavefrontMaterialHash@PLT
+	cmpl	%eax, %r13d
+	jne	.L214
+	addl	$1, asserts_passed(%rip)
+.L215:
+	movq	%r14, %rcx
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L216
+	addl	$1, asserts_passed(%rip)
+.L217:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$328, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L200:
+	.cfi_restore_state
+	movslq	%eax, %rcx
+	movl	$1, %r8d
+	xorl	%eax, %eax
+	movl	$224, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L201
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$251, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L215
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	movl	$1, %r8d
+	movl	$250, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L213
+	.p2align 4,,10
+	.p2align 3
+.L210:
+	movl	$2, %r8d
+	movl	$249, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L211
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	movl	$1, %r8d
+	movl	$231, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L207
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	xorl	%r8d, %r8d
+	movl	$252, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L217
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	xorl	%r8d, %r8d
+	movl	$237, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L209
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	xorl	%r8d, %r8d
+	movl	$229, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L205
+	.p2align 4,,10
+	.p2align 3
+.L202:
+	xorl	%r8d, %r8d
+	movl	$226, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L203
+	.cfi_endproc
+.LFE33:
+	.size	testMaterialEqual, .-testMaterialEqual
+	.p2align 4
+	.globl	testMaterialHash
+	.type	testMaterialHash, @function
+testMaterialHash:
+.LFB34:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	.LC4(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	leaq	.LC1(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 176
+	leaq	16(%rsp), %rbx
+	leaq	12(%rsp), %r12
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbp, %rdi
+	movl	$0, 12(%rsp)
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	leaq	.LC21(%rip), %rbp
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	24(%rsp), %eax
+	movq	16(%rsp), %rdx
+	movq	%r13, %rdi
+	movq	48(%rsp), %rcx
+	imulq	$456, %rax, %rax
+	leaq	-456(%rdx,%rax), %rax
+	movl	12(%rsp), %edx
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	movl	%edx, 160(%rax)
+	movq	%rcx, 152(%rax)
+	movl	$0, 12(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	24(%rsp), %eax
+	movl	12(%rsp), %edx
+	movq	%rbx, %rdi
+	movq	48(%rsp), %rcx
+	movq	16(%rsp), %rbp
+	imulq	$456, %rax, %rax
+	leal	-1(%rdx), %esi
+	movq	(%rcx,%rsi,8), %rcx
+	leaq	456(%rbp), %r13
+	movq	%rbp, %rsi
+	leaq	-456(%rbp,%rax), %rax
+	movq	%rcx, 152(%rax)
+	movl	%edx, 160(%rax)
+	call	wavefrontMaterialHash@PLT
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movl	%eax, %r12d
+	call	wavefrontMaterialHash@PLT
+	cmpl	%eax, %r12d
+	jne	.L220
+	addl	$1, asserts_passed(%rip)
+.L221:
+	movl	$0x3f000000, 480(%rbp)
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialHash@PLT
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movl	%eax, %r12d
+	call	wavefrontMaterialHash@PLT
+	cmpl	%eax, %r12d
+	je	.L222
+	addl	$1, asserts_passed(%rip)
+.L223:
+	movq	608(%rbp), %rax
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movl	$0x00000000, 480(%rbp)
+	movq	%rax, 688(%rbp)
+	call	wavefrontMaterialHash@PLT
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	movl	%eax, %r12d
+	call	wavefrontMaterialHash@PLT
+	cmpl	%eax, %r12d
+	je	.L224
+	addl	$1, asserts_passed(%rip)
+.L225:
+	movq	$0, 688(%rbp)
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L220:
+	.cfi_restore_state
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$263, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L221
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	xorl	%r8d, %r8d
+	movl	$1, %ecx
+	movl	$268, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L225
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	xorl	%r8d, %r8d
+	movl	$1, %ecx
+	movl	$265, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L223
+	.cfi_endproc
+.LFE34:
+	.size	testMaterialHash, .-testMaterialHash
+	.section	.rodata.str1.1
+.LC39:
+	.string	"existing"
+.LC43:
+	.string	"copy"
+.LC45:
+	.string	"removed"
+.LC48:
+	.string	"again"
+.LC49:
+	.string	"first.2"
+.LC50:
+	.string	"first.3"
+	.text
+	.p2align 4
+	.globl	testMerge
+	.type	testMerge, @function
+testMerge:
+.LFB36:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC21(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	.LC39(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	%edi, %ebx
+	subq	$568, %rsp
+	.cfi_def_cfa_offset 624
+	leaq	112(%rsp), %r15
+	leaq	336(%rsp), %rbp
+	movq	%r15, %rdi
+	leaq	448(%rsp), %r14
+	call	wavefrontMTLCompose@PLT
+	movl	%ebx, 204(%rsp)
+	leaq	224(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%r14, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%r12, %rdi
+	movl	$0, 80(%rsp)
+	movl	$1, 428(%rsp)
+	call	strlen@PLT
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	leaq	80(%rsp), %r12
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r15, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	movq	%r15, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	120(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	144(%rsp), %rdi
+	movq	112(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC40(%rip), %xmm2
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	leaq	.LC1(%rip), %rdi
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	imulq	$456, %rax, %rax
+	movups	%xmm2, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	leaq	.LC1(%rip), %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	232(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	256(%rsp), %rdi
+	movq	224(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC41(%rip), %xmm1
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	leaq	.LC4(%rip), %rdi
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	imulq	$456, %rax, %rax
+	movups	%xmm1, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	leaq	.LC4(%rip), %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	leaq	.LC23(%rip), %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	leaq	.LC23(%rip), %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	232(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	256(%rsp), %rdi
+	movq	224(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC42(%rip), %xmm0
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	leaq	.LC27(%rip), %rsi
+	imulq	$456, %rax, %rax
+	movq	%rsi, %rdi
+	movups	%xmm0, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	leaq	.LC27(%rip), %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	232(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	256(%rsp), %rdi
+	movq	224(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC40(%rip), %xmm2
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	leaq	.LC43(%rip), %rsi
+	imulq	$456, %rax, %rax
+	movq	%rsi, %rdi
+	movups	%xmm2, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	leaq	.LC43(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	344(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	368(%rsp), %rdi
+	movq	336(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC41(%rip), %xmm1
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	leaq	.LC1(%rip), %rdi
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	imulq	$456, %rax, %rax
+	movups	%xmm1, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	leaq	.LC1(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	leaq	.LC45(%rip), %r13
+	call	wavefrontMTLInternTexture@PLT
+	movl	344(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	368(%rsp), %rdi
+	movq	336(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC44(%rip), %xmm1
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	movq	%r13, %rdi
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	imulq	$456, %rax, %rax
+	movups	%xmm1, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	leaq	.LC29(%rip), %r13
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%r13, %rdi
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	leaq	.LC48(%rip), %r13
+	call	wavefrontMTLInternTexture@PLT
+	movl	344(%rsp), %edx
+	movl	80(%rsp), %esi
+	movq	368(%rsp), %rdi
+	movq	336(%rsp), %rax
+	movq	%rdx, %rcx
+	imulq	$456, %rdx, %rdx
+	leal	-1(%rsi), %r8d
+	movaps	.LC46(%rip), %xmm1
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rax,%rdx), %rdx
+	movq	%rdi, 152(%rdx)
+	leaq	.LC1(%rip), %rdi
+	movl	%esi, 160(%rdx)
+	leal	-1(%rcx), %edx
+	imulq	$456, %rdx, %rdx
+	movups	%xmm1, 24(%rax,%rdx)
+	movq	$0, 912(%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	leaq	.LC1(%rip), %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	leaq	.LC23(%rip), %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	leaq	.LC23(%rip), %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	456(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	480(%rsp), %rdi
+	movq	448(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC47(%rip), %xmm1
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	movq	%r13, %rdi
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	imulq	$456, %rax, %rax
+	movups	%xmm1, 24(%rdx,%rax)
+	movl	$0, 80(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	leaq	.LC23(%rip), %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	leaq	.LC23(%rip), %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	456(%rsp), %eax
+	movl	80(%rsp), %esi
+	movq	480(%rsp), %rdi
+	movq	448(%rsp), %rdx
+	movq	%rax, %rcx
+	imulq	$456, %rax, %rax
+	leal	-1(%rsi), %r8d
+	movaps	.LC42(%rip), %xmm0
+	movq	(%rdi,%r8,8), %rdi
+	leaq	-456(%rdx,%rax), %rax
+	movq	%rdi, 152(%rax)
+	movq	%r15, %rdi
+	movl	%esi, 160(%rax)
+	leal	-1(%rcx), %eax
+	movq	%rbx, %rsi
+	imulq	$456, %rax, %rax
+	movups	%xmm0, 24(%rdx,%rax)
+	leaq	48(%rsp), %rax
+	movl	$3, %edx
+	movq	%rax, %rcx
+	movq	%rax, 16(%rsp)
+	call	wavefrontMTLMerge@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L228
+	addl	$1, asserts_passed(%rip)
+.L229:
+	movl	120(%rsp), %ecx
+	cmpq	$5, %rcx
+	jne	.L230
+	addl	$1, asserts_passed(%rip)
+.L231:
+	movl	152(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L232
+	addl	$1, asserts_passed(%rip)
+.L233:
+	movq	112(%rsp), %r13
+	movq	456(%r13), %rcx
+	testq	%rcx, %rcx
+	je	.L234
+	movq	%rcx, %rdi
+	leaq	.LC1(%rip), %rsi
+	movq	%rcx, 8(%rsp)
+	call	strcmp@PLT
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	je	.L274
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L237:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC1(%rip), %r8
+	xorl	%eax, %eax
+	movl	$301, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	112(%rsp), %r13
+	movq	912(%r13), %rcx
+	testq	%rcx, %rcx
+	je	.L238
+.L276:
+	movq	%rcx, %rdi
+	leaq	.LC4(%rip), %rsi
+	movq	%rcx, 8(%rsp)
+	call	strcmp@PLT
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L239
+	movq	1368(%r13), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	je	.L242
+.L279:
+	movq	%rcx, %rdi
+	leaq	.LC49(%rip), %rsi
+	movq	%rcx, 8(%rsp)
+	call	strcmp@PLT
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L243
+	movq	1824(%r13), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	je	.L246
+.L278:
+	leaq	.LC50(%rip), %rax
+	movq	%rcx, %rdi
+	movq	%rcx, 24(%rsp)
+	movq	%rax, %rsi
+	movq	%rax, 8(%rsp)
+	call	strcmp@PLT
+	movq	24(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L247
+	addl	$1, asserts_passed(%rip)
+.L248:
+	movsd	.LC51(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC35(%rip), %xmm2
+	cvtss2sd	1848(%r13), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L250
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L250
+	movq	1976(%r13), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	je	.L254
+.L277:
+	movq	%rcx, %rdi
+	leaq	.LC23(%rip), %rsi
+	movq	%rcx, 24(%rsp)
+	call	strcmp@PLT
+	movq	24(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L255
+	addl	$1, asserts_passed(%rip)
+.L256:
+	movl	1984(%r13), %ecx
+	cmpq	$2, %rcx
+	jne	.L258
+	addl	$1, asserts_passed(%rip)
+.L259:
+	movq	8(%rsp), %rsi
+	movq	%r15, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	movslq	%eax, %rcx
+	cmpl	$4, %eax
+	jne	.L260
+	addl	$1, asserts_passed(%rip)
+.L261:
+	movdqa	.LC52(%rip), %xmm0
+	movl	64(%rsp), %ecx
+	movaps	%xmm0, 80(%rsp)
+	movdqa	.LC53(%rip), %xmm0
+	movaps	%xmm0, 96(%rsp)
+	movdqa	.LC54(%rip), %xmm0
+	movaps	%xmm0, 32(%rsp)
+	cmpq	$3, %rcx
+	jne	.L262
+	addl	$1, asserts_passed(%rip)
+.L263:
+	movq	56(%rsp), %rdi
+	leaq	32(%rsp), %rsi
+	movl	$16, %edx
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L264
+	addl	$1, asserts_passed(%rip)
+.L265:
+	movq	48(%rsp), %rdi
+	movl	$32, %edx
+	movq	%r12, %rsi
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L266
+	addl	$1, asserts_passed(%rip)
+.L267:
+	movq	16(%rsp), %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	cmpq	$0, 48(%rsp)
+	je	.L275
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$317, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L269:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r14, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%r15, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$568, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	.cfi_restore_state
+	movq	912(%r13), %rcx
+	addl	$1, asserts_passed(%rip)
+	testq	%rcx, %rcx
+	jne	.L276
+.L238:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L241
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	movl	$306, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC36(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	112(%rsp), %r13
+	movq	1976(%r13), %rcx
+	testq	%rcx, %rcx
+	jne	.L277
+.L254:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L257
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	movl	$3, %r8d
+	movl	$313, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L263
+	.p2align 4,,10
+	.p2align 3
+.L260:
+	movl	$4, %r8d
+	movl	$309, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L261
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	movl	$2, %r8d
+	movl	$308, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L259
+	.p2align 4,,10
+	.p2align 3
+.L232:
+	movl	$2, %r8d
+	movl	$300, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L233
+	.p2align 4,,10
+	.p2align 3
+.L230:
+	movl	$5, %r8d
+	movl	$299, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L231
+	.p2align 4,,10
+	.p2align 3
+.L275:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L269
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L249:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC50(%rip), %r8
+	xorl	%eax, %eax
+	movl	$305, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	112(%rsp), %r13
+	jmp	.L248
+	.p2align 4,,10
+	.p2align 3
+.L255:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L257:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC23(%rip), %r8
+	xorl	%eax, %eax
+	movl	$307, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	112(%rsp), %r13
+	jmp	.L256
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L245:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC49(%rip), %r8
+	xorl	%eax, %eax
+	movl	$304, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	112(%rsp), %r13
+	movq	1824(%r13), %rcx
+	testq	%rcx, %rcx
+	jne	.L278
+.L246:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC50(%rip), %rdx
+	leaq	.LC0(%rip), %rcx
+	movq	%rdx, 8(%rsp)
+	addl	$1, %eax
+	jmp	.L249
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L241:
+	movl	%eax, asserts_failed(%rip)
+	leaq	.LC4(%rip), %r8
+	xorl	%eax, %eax
+	movl	$302, %edx
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+	movq	112(%rsp), %r13
+	movq	1368(%r13), %rcx
+	testq	%rcx, %rcx
+	jne	.L279
+.L242:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L245
+	.p2align 4,,10
+	.p2align 3
+.L228:
+	xorl	%r8d, %r8d
+	movl	$298, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L229
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	xorl	%r8d, %r8d
+	movl	$315, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L267
+	.p2align 4,,10
+	.p2align 3
+.L264:
+	xorl	%r8d, %r8d
+	movl	$314, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L265
+	.p2align 4,,10
+	.p2align 3
+.L234:
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC0(%rip), %rcx
+	addl	$1, %eax
+	jmp	.L237
+	.cfi_endproc
+.LFE36:
+	.size	testMerge, .-testMerge
+	.section	.rodata.str1.1
+.LC55:
+	.string	"material%d"
+.LC56:
+	.string	"%d.png"
+	.text
+	.p2align 4
+	.globl	testMergeMany
+	.type	testMergeMany, @function
+testMergeMany:
+.LFB37:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$11432, %rsp
+	.cfi_def_cfa_offset 11488
+	leaq	11424(%rsp), %rax
+	leaq	224(%rsp), %rbx
+	movq	%rax, 24(%rsp)
+	leaq	112(%rsp), %rax
+	leaq	48(%rsp), %r12
+	movq	%rbx, 32(%rsp)
+	leaq	64(%rsp), %rbp
+	movq	%rax, 8(%rsp)
+	movq	%rbx, 40(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L282:
+	movl	%r14d, %r13d
+	xorl	%r15d, %r15d
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movl	%r14d, 16(%rsp)
+	movl	%r15d, %r14d
+	movl	%r13d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	movl	%r15d, %r13d
+	movl	%r14d, %ecx
+	leaq	.LC55(%rip), %rdx
+	movq	%r12, %rdi
+	imulq	$458129845, %r13, %r13
+	movl	$32, %esi
+	addl	$1, %r14d
+	shrq	$37, %r13
+	imull	$300, %r13d, %eax
+	movl	%r15d, %r13d
+	addl	$104729, %r15d
+	subl	%eax, %r13d
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movl	%r13d, %eax
+	movl	%r13d, %ecx
+	movl	$16, %esi
+	imulq	$1374389535, %rax, %rax
+	leaq	.LC56(%rip), %rdx
+	movq	%rbp, %rdi
+	shrq	$36, %rax
+	imull	$50, %eax, %eax
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	pxor	%xmm0, %xmm0
+	movq	%r12, %rdi
+	movl	$0, 112(%rsp)
+	cvtsi2ssl	%r13d, %xmm0
+	movd	%xmm0, %r13d
+	call	strlen@PLT
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movq	%rbp, %rdi
+	call	strlen@PLT
+	movq	8(%rsp), %rcx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	8(%rbx), %edx
+	movl	112(%rsp), %esi
+	movq	32(%rbx), %rdi
+	movq	(%rbx), %rax
+	movq	%rdx, %rcx
+	imulq	$456, %rdx, %rdx
+	leal	-1(%rsi), %r10d
+	movq	(%rdi,%r10,8), %rdi
+	leaq	-456(%rax,%rdx), %rdx
+	movl	%esi, 160(%rdx)
+	movabsq	$4575657221408423936, %rsi
+	movq	%rdi, 152(%rdx)
+	leal	-1(%rcx), %edx
+	imulq	$456, %rdx, %rdx
+	addq	%rdx, %rax
+	movl	%r13d, 24(%rax)
+	movl	$0x00000000, 28(%rax)
+	movq	%rsi, 32(%rax)
+	cmpl	$200, %r14d
+	jne	.L281
+	movl	16(%rsp), %r14d
+	movq	24(%rsp), %rax
+	addq	$112, %rbx
+	addl	$7919, %r14d
+	cmpq	%rax, %rbx
+	jne	.L282
+	movq	8(%rsp), %r14
+	movq	40(%rsp), %r10
+	leaq	80(%rsp), %rbx
+	movq	%r14, %rdi
+	movq	%r10, 16(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movq	32(%rsp), %rsi
+	movq	%rbx, %rcx
+	movq	%r14, %rdi
+	movl	$100, %edx
+	call	wavefrontMTLMerge@PLT
+	movq	16(%rsp), %r10
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L283
+	movl	120(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$300, %rcx
+	jne	.L285
+.L303:
+	movl	152(%rsp), %ecx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$50, %rcx
+	jne	.L287
+.L304:
+	addl	$1, asserts_passed(%rip)
+.L289:
+	movq	24(%rsp), %r13
+	movq	8(%rsp), %r12
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+	movq	%rbx, 16(%rsp)
+	movq	%r10, %rbx
+.L288:
+	movl	8(%rbx), %eax
+	xorl	%r15d, %r15d
+	testl	%eax, %eax
+	je	.L292
+	.p2align 4,,10
+	.p2align 3
+.L290:
+	movq	88(%rsp), %rax
+	movl	%r15d, %edx
+	movl	%r15d, %esi
+	movq	%rbx, %rdi
+	imulq	$456, %rsi, %rsi
+	addq	(%rbx), %rsi
+	addl	(%rax,%rbp), %edx
+	movq	80(%rsp), %rax
+	movslq	(%rax,%rdx,4), %rcx
+	movq	%r12, %rdx
+	imulq	$456, %rcx, %rcx
+	addq	112(%rsp), %rcx
+	call	wavefrontMaterialEqual@PLT
+	cmpl	$1, %eax
+	adcl	$0, %r14d
+	addl	$1, %r15d
+	cmpl	8(%rbx), %r15d
+	jb	.L290
+.L292:
+	movq	%rbx, %rdi
+	addq	$112, %rbx
+	addq	$4, %rbp
+	call	wavefrontMTLRelease@PLT
+	cmpq	%r13, %rbx
+	jne	.L288
+	movq	16(%rsp), %rbx
+	testl	%r14d, %r14d
+	jne	.L293
+	addl	$1, asserts_passed(%rip)
+.L294:
+	movq	88(%rsp), %rax
+	movl	400(%rax), %ecx
+	cmpq	$20000, %rcx
+	jne	.L295
+	addl	$1, asserts_passed(%rip)
+.L296:
+	movq	%rbx, %rdi
+	call	wavefrontMTLRemapRelease@PLT
+	movq	8(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$11432, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L283:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$339, %edx
+	xorl	%eax, %eax
+	movq	%r10, 16(%rsp)
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	120(%rsp), %ecx
+	movq	16(%rsp), %r10
+	cmpq	$300, %rcx
+	je	.L303
+.L285:
+	movl	$300, %r8d
+	movl	$340, %edx
+	xorl	%eax, %eax
+	movq	%r10, 16(%rsp)
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movl	152(%rsp), %ecx
+	movq	16(%rsp), %r10
+	cmpq	$50, %rcx
+	je	.L304
+.L287:
+	movl	$50, %r8d
+	movl	$341, %edx
+	xorl	%eax, %eax
+	movq	%r10, 16(%rsp)
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	16(%rsp), %r10
+	jmp	.L289
+.L295:
+	movl	$20000, %r8d
+	movl	$351, %edx
+	leaq	.LC2(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L296
+.L293:
+	movslq	%r14d, %rcx
+	xorl	%r8d, %r8d
+	movl	$350, %edx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L294
+	.cfi_endproc
+.LFE37:
+	.size	testMergeMany, .-testMergeMany
+	.p2align 4
+	.globl	wavefrontMaterialTest
+	.type	wavefrontMaterialTest, @function
+wavefrontMaterialTest:
+.LFB38:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testAddMaterial
+	xorl	%eax, %eax
+	call	testAddMaterialReusesName
+	xorl	%eax, %eax
+	call	testFindMaterial
+	xorl	%eax, %eax
+	call	testReserveMaterials
+	xorl	%eax, %eax
+	call	testShrinkEmpty
+	xorl	%eax, %eax
+	call	testArenaStrings
+	xorl	%eax, %eax
+	call	testInternTexture
+	xorl	%edi, %edi
+	call	testAppend
+	movl	$1, %edi
+	call	testAppend
+	xorl	%eax, %eax
+	call	testAppendFlagsMismatch
+	xorl	%eax, %eax
+	call	testMaterialEqual
+	xorl	%eax, %eax
+	call	testMaterialHash
+	xorl	%edi, %edi
+	call	testMerge
+	movl	$1, %edi
+	call	testMerge
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testMergeMany
+	.cfi_endproc
+.LFE38:
+	.size	wavefrontMaterialTest, .-wavefrontMaterialTest
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC34:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC35:
+	.long	-350469331
+	.long	1058682594
+	.align 8
+.LC37:
+	.long	0
+	.long	1074266112
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC40:
+	.long	1048576000
+	.long	0
+	.long	0
+	.long	1065353216
+	.align 16
+.LC41:
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	1065353216
+	.align 16
+.LC42:
+	.long	1056964608
+	.long	0
+	.long	0
+	.long	1065353216
+	.align 16
+.LC44:
+	.long	1061158912
+	.long	0
+	.long	0
+	.long	1065353216
+	.align 16
+.LC46:
+	.long	0
+	.long	0
+	.long	0
+	.long	1065353216
+	.align 16
+.LC47:
+	.long	1040187392
+	.long	0
+	.long	0
+	.long	1065353216
+	.section	.rodata.cst8
+	.align 8
+.LC51:
+	.long	0
+	.long	1069547520
+	.section	.rodata.cst16
+	.align 16
+.LC52:
+	.long	1
+	.long	2
+	.long	0
+	.long	1
+	.align 16
+.LC53:
+	.long	3
+	.long	-1
+	.long	4
+	.long	2
+	.align 16
+.LC54:
+	.long	0
+	.long	3
+	.long	6
+	.long	8
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1808 @@
+	.file	"wavefront_material_writer_test.c"
+	.text
+	.p2align 4
+	.type	failWrite, @function
+failWrite:
+.LFB25:
+	.cfi_startproc
+	addl	$1, (%rdi)
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	failWrite, .-failWrite
+	.p2align 4
+	.type	readsBack, @function
+readsBack:
+.LFB22:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%ecx, %ecx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	leaq	16(%rsp), %r12
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromBuffer@PLT
+	testl	%eax, %eax
+	jne	.L3
+	movl	8(%r14), %edx
+	testl	%edx, %edx
+	je	.L12
+	movl	$0, 12(%rsp)
+	movl	%eax, %r13d
+	xorl	%r15d, %r15d
+	xorl	%ebp, %ebp
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	movl	8(%r14), %edx
+.L6:
+	addl	$1, %r15d
+	cmpl	%edx, %r15d
+	jnb	.L19
+.L9:
+	movl	%r15d, %ebx
+	movq	(%r14), %rax
+	imulq	$456, %rbx, %rbx
+	movq	(%rax,%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L6
+	movq	%r12, %rdi
+	addl	$1, %ebp
+	call	wavefrontMTLFindMaterial@PLT
+	testl	%eax, %eax
+	js	.L18
+	addq	(%r14), %rbx
+	movslq	%eax, %rcx
+	movq	%r12, %rdx
+	movq	%r14, %rdi
+	imulq	$456, %rcx, %rcx
+	movq	%rbx, %rsi
+	addq	16(%rsp), %rcx
+	call	wavefrontMaterialEqual@PLT
+	testl	%eax, %eax
+	je	.L18
+	addl	$1, 12(%rsp)
+	jmp	.L18
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	movl	12(%rsp), %eax
+	cmpl	%eax, %ebp
+	je	.L5
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+.L3:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.cfi_restore_state
+	movl	$0, 12(%rsp)
+.L5:
+	movl	12(%rsp), %eax
+	xorl	%r13d, %r13d
+	movq	%r12, %rdi
+	cmpl	%eax, 24(%rsp)
+	sete	%r13b
+	call	wavefrontMTLRelease@PLT
+	jmp	.L3
+	.cfi_endproc
+.LFE22:
+	.size	readsBack, .-readsBack
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"src/wavefront_material_writer_test.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"%s:%d: %lld != %lld\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC2:
+	.ascii	"newmtl first\nKa 0.1 0.2"
+	.string	" 0.3\nKd 0.64 0.64 0.64\nKs 0 0 0\nNs 96.07843\nd 0.75\nillum 2\nmap_Kd -blendu off -o 0.5 0.25 0 -imfchan r diffuse.png\n\nnewmtl second\nKe 1e-7 0.5 12345678\nNi 1.45\nPr 0.5\nmap_Bump -clamp on -texres 512 -bm 2 bump map.png\nrefl -type cube_top -mm 0.1 0.9 top.png\n"
+	.section	.rodata.str1.1
+.LC3:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+	.text
+	.p2align 4
+	.globl	testWriteCanonical
+	.type	testWriteCanonical, @function
+testWriteCanonical:
+.LFB23:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	writerInput(%rip), %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$2296, %rsp
+	.cfi_def_cfa_offset 2336
+	leaq	16(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L21
+	addl	$1, asserts_passed(%rip)
+.L22:
+	leaq	240(%rsp), %rbx
+	movq	%rsp, %rcx
+	movl	$1023, %edx
+	movq	%rbp, %rdi
+	movq	%rbx, %rsi
+	movq	$0, (%rsp)
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L23
+	addl	$1, asserts_passed(%rip)
+.L24:
+	movq	(%rsp), %r12
+	leaq	.LC2(%rip), %r13
+	movq	%rbx, %rdi
+	movq	%r13, %rsi
+	movb	$0, 240(%rsp,%r12)
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L25
+	addl	$1, asserts_passed(%rip)
+.L26:
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	readsBack
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L27
+	addl	$1, asserts_passed(%rip)
+.L28:
+	movq	(%rsp), %rdx
+	leaq	128(%rsp), %r12
+	xorl	%ecx, %ecx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L29
+	addl	$1, asserts_passed(%rip)
+.L30:
+	leaq	1264(%rsp), %r13
+	leaq	8(%rsp), %rcx
+	movl	$1024, %edx
+	movq	%r12, %rdi
+	movq	$0, 8(%rsp)
+	movq	%r13, %rsi
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L31
+	addl	$1, asserts_passed(%rip)
+.L32:
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %rdx
+	cmpq	%rdx, %rcx
+	jne	.L33
+	addl	$1, asserts_passed(%rip)
+.L34:
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	memcmp@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L35
+	addl	$1, asserts_passed(%rip)
+.L36:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$2296, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.cfi_restore_state
+	movl	$1, %r8d
+	movl	$68, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L28
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	movq	%rdx, %r8
+	leaq	.LC0(%rip), %rsi
+	movl	$78, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rdx
+	jmp	.L34
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	xorl	%r8d, %r8d
+	movl	$50, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	xorl	%r8d, %r8d
+	movl	$45, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	movq	%r13, %r8
+	movq	%rbx, %rcx
+	movl	$52, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %r12
+	jmp	.L26
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	xorl	%r8d, %r8d
+	movl	$79, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L36
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	xorl	%r8d, %r8d
+	movl	$77, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L32
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	xorl	%r8d, %r8d
+	movl	$73, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L30
+	.cfi_endproc
+.LFE23:
+	.size	testWriteCanonical, .-testWriteCanonical
+	.p2align 4
+	.globl	testWriteBufferSize
+	.type	testWriteBufferSize, @function
+testWriteBufferSize:
+.LFB24:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	writerInput(%rip), %rsi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$240, %rsp
+	.cfi_def_cfa_offset 272
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L39
+	addl	$1, asserts_passed(%rip)
+.L40:
+	movq	%rsp, %rcx
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	movq	$0, (%rsp)
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L41
+	addl	$1, asserts_passed(%rip)
+.L42:
+	movq	(%rsp), %rdi
+	leaq	8(%rsp), %r12
+	call	malloc@PLT
+	movq	%r12, %rcx
+	movq	%rbx, %rdi
+	movq	$0, 8(%rsp)
+	movq	%rax, %rbp
+	movq	(%rsp), %rax
+	movq	%rbp, %rsi
+	leaq	-1(%rax), %rdx
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L43
+	addl	$1, asserts_passed(%rip)
+.L44:
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %rdx
+	cmpq	%rdx, %rcx
+	jne	.L45
+	addl	$1, asserts_passed(%rip)
+.L46:
+	movq	%r12, %rcx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L47
+	addl	$1, asserts_passed(%rip)
+.L48:
+	movq	8(%rsp), %rcx
+	movq	(%rsp), %rdx
+	cmpq	%rdx, %rcx
+	jne	.L49
+	addl	$1, asserts_passed(%rip)
+.L50:
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	readsBack
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L51
+	addl	$1, asserts_passed(%rip)
+.L52:
+	movq	%rbp, %rdi
+	leaq	128(%rsp), %rbp
+	call	free@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	%r12, %rcx
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L53
+	addl	$1, asserts_passed(%rip)
+.L54:
+	movq	8(%rsp), %rcx
+	testq	%rcx, %rcx
+	jne	.L55
+	addl	$1, asserts_passed(%rip)
+.L56:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	.cfi_restore_state
+	movl	$2, %r8d
+	movl	$91, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L42
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	movl	$1, %r8d
+	movl	$100, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L52
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	movq	%rdx, %r8
+	leaq	.LC0(%rip), %rsi
+	movl	$99, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rdx
+	jmp	.L50
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	movq	%rdx, %r8
+	leaq	.LC0(%rip), %rsi
+	movl	$96, %edx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movq	(%rsp), %rdx
+	jmp	.L46
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	movl	$2, %r8d
+	movl	$95, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L44
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	xorl	%r8d, %r8d
+	movl	$87, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L40
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	xorl	%r8d, %r8d
+	movl	$108, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L56
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	xorl	%r8d, %r8d
+	movl	$107, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L54
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	xorl	%r8d, %r8d
+	movl	$98, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L48
+	.cfi_endproc
+.LFE24:
+	.size	testWriteBufferSize, .-testWriteBufferSize
+	.section	.rodata.str1.1
+.LC4:
+	.string	"material%d"
+	.text
+	.p2align 4
+	.globl	testWriteCallbackError
+	.type	testWriteCallbackError, @function
+testWriteCallbackError:
+.LFB26:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC0(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	.LC4(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	leaq	48(%rsp), %rbp
+	leaq	16(%rsp), %rbx
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	movl	%r15d, %ecx
+	movq	%r12, %rdx
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L59
+	movq	48(%rsp), %rax
+	movaps	.LC5(%rip), %xmm0
+	addl	$1, %r15d
+	addl	$1, asserts_passed(%rip)
+	movups	%xmm0, 24(%rax,%r13)
+	addq	$456, %r13
+	cmpl	$2000, %r15d
+	jne	.L62
+.L61:
+	leaq	12(%rsp), %rdx
+	leaq	failWrite(%rip), %rsi
+	movq	%rbp, %rdi
+	movl	$0, 12(%rsp)
+	call	writeWavefrontMTL@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L63
+	movslq	12(%rsp), %rcx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$1, %rcx
+	jne	.L65
+.L73:
+	addl	$1, asserts_passed(%rip)
+.L66:
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	writeWavefrontMTL@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L67
+	addl	$1, asserts_passed(%rip)
+.L68:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.cfi_restore_state
+	xorl	%r8d, %r8d
+	movl	$127, %edx
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	addl	$1, %r15d
+	call	printf@PLT
+	movq	48(%rsp), %rax
+	movaps	.LC5(%rip), %xmm1
+	movups	%xmm1, 24(%rax,%r13)
+	addq	$456, %r13
+	cmpl	$2000, %r15d
+	jne	.L62
+	jmp	.L61
+.L63:
+	movl	$1, %r8d
+	movl	$132, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	movslq	12(%rsp), %rcx
+	cmpq	$1, %rcx
+	je	.L73
+.L65:
+	movl	$1, %r8d
+	movl	$133, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L66
+.L67:
+	movl	$2, %r8d
+	movl	$134, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L68
+	.cfi_endproc
+.LFE26:
+	.size	testWriteCallbackError, .-testWriteCallbackError
+	.section	.rodata.str1.1
+.LC6:
+	.string	"newmtl second\nNi 1.5\n"
+	.text
+	.p2align 4
+	.globl	testWriteSkipsRemoved
+	.type	testWriteSkipsRemoved, @function
+testWriteSkipsRemoved:
+.LFB27:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	writerInput(%rip), %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$504, %rsp
+	.cfi_def_cfa_offset 544
+	leaq	16(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L75
+	addl	$1, asserts_passed(%rip)
+.L76:
+	leaq	128(%rsp), %rbp
+	leaq	.LC6(%rip), %r12
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L77
+	addl	$1, asserts_passed(%rip)
+.L78:
+	xorl	%edx, %edx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	wavefrontMTLUpdate@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L79
+	addl	$1, asserts_passed(%rip)
+.L80:
+	movq	16(%rsp), %rax
+	cmpq	$0, (%rax)
+	je	.L88
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$146, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L82:
+	leaq	240(%rsp), %r13
+	leaq	8(%rsp), %rcx
+	movl	$255, %edx
+	movq	%rbx, %rdi
+	movq	$0, 8(%rsp)
+	movq	%r13, %rsi
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L83
+	addl	$1, asserts_passed(%rip)
+.L84:
+	movq	8(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	movb	$0, 240(%rsp,%rax)
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L85
+	addl	$1, asserts_passed(%rip)
+.L86:
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$504, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L82
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	xorl	%r8d, %r8d
+	movl	$145, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L80
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	xorl	%r8d, %r8d
+	movl	$143, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L78
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	xorl	%r8d, %r8d
+	movl	$141, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L76
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	leaq	.LC6(%rip), %r8
+	movq	%r13, %rcx
+	xorl	%eax, %eax
+	movl	$153, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L86
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	xorl	%r8d, %r8d
+	movl	$151, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L84
+	.cfi_endproc
+.LFE27:
+	.size	testWriteSkipsRemoved, .-testWriteSkipsRemoved
+	.section	.rodata.str1.1
+.LC8:
+	.string	"random%d"
+.LC11:
+	.string	"dir/map %d.png"
+.LC12:
+	.string	"rgbmlz"
+	.text
+	.p2align 4
+	.globl	testWriteRoundTripRandom
+	.type	testWriteRoundTripRandom, @function
+testWriteRoundTripRandom:
+.LFB29:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	$3, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$584, %rsp
+	.cfi_def_cfa_offset 640
+	leaq	288(%rsp), %rax
+	leaq	296(%rsp), %rdx
+	movq	%rax, %rsi
+	movq	%rax, 24(%rsp)
+	leaq	292(%rsp), %rax
+	leaq	204(%rsp), %r12
+	movq	%rax, %xmm6
+	movq	%rsi, %xmm5
+	leaq	300(%rsp), %rax
+	punpcklqdq	%xmm6, %xmm5
+	movq	%rdx, %xmm6
+	leaq	304(%rsp), %rdx
+	movaps	%xmm5, 64(%rsp)
+	movq	%rax, %xmm5
+	leaq	308(%rsp), %rax
+	movq	%rdx, %xmm7
+	punpcklqdq	%xmm5, %xmm6
+	movq	%rax, %xmm5
+	leaq	312(%rsp), %rdx
+	punpcklqdq	%xmm5, %xmm7
+	leaq	316(%rsp), %rax
+	movq	%rdx, %xmm5
+	movaps	%xmm6, 80(%rsp)
+	movaps	%xmm7, 96(%rsp)
+	leaq	320(%rsp), %rdx
+	movq	%rax, %xmm7
+	leaq	324(%rsp), %rax
+	punpcklqdq	%xmm7, %xmm5
+	movq	%rdx, %xmm6
+	movq	%rax, %xmm7
+	punpcklqdq	%xmm7, %xmm6
+	leaq	328(%rsp), %rdx
+	leaq	332(%rsp), %rax
+	movaps	%xmm5, 112(%rsp)
+	movaps	%xmm6, 128(%rsp)
+	movq	%rdx, %xmm7
+	movq	%rax, %xmm6
+	leaq	464(%rsp), %rax
+	punpcklqdq	%xmm6, %xmm7
+	movq	%rax, %rdi
+	movq	%rax, 16(%rsp)
+	leaq	352(%rsp), %rbp
+	movaps	%xmm7, 144(%rsp)
+	call	wavefrontMTLCompose@PLT
+	leaq	208(%rsp), %rax
+	movq	$0, 168(%rsp)
+	movq	%rax, 56(%rsp)
+	leaq	240(%rsp), %rax
+	movq	%rax, 176(%rsp)
+	leaq	280(%rsp), %rax
+	movq	%rax, 184(%rsp)
+	leaq	336(%rsp), %rax
+	movq	%rax, 160(%rsp)
+	leaq	200(%rsp), %rax
+	movl	$0, 52(%rsp)
+	movq	%rax, 8(%rsp)
+.L127:
+	movq	56(%rsp), %rbx
+	movl	52(%rsp), %ecx
+	movl	$32, %esi
+	xorl	%eax, %eax
+	leaq	.LC8(%rip), %rdx
+	movq	%rbx, %rdi
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	movq	16(%rsp), %rbx
+	movq	%rax, %rdx
+	movq	%rbx, %rdi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	wavefrontMTLAddMaterial@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L90
+	addl	$1, asserts_passed(%rip)
+.L91:
+	movq	168(%rsp), %rdi
+	addq	464(%rsp), %rdi
+	leaq	8(%rdi), %rax
+	movq	%rdi, 40(%rsp)
+	movq	176(%rsp), %rbx
+	movq	%rax, 240(%rsp)
+	leaq	24(%rdi), %rax
+	movq	184(%rsp), %r15
+	movq	%rax, 248(%rsp)
+	leaq	40(%rdi), %rax
+	movq	%rax, 256(%rsp)
+	leaq	56(%rdi), %rax
+	movq	%rax, 264(%rsp)
+	leaq	72(%rdi), %rax
+	movq	%rax, 272(%rsp)
+	jmp	.L98
+	.p2align 4,,10
+	.p2align 3
+.L178:
+	movaps	%xmm0, %xmm1
+	pxor	%xmm5, %xmm5
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm5, %xmm1
+	jp	.L133
+	jne	.L133
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L92
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L92:
+	imull	$1103515245, %r14d, %r14d
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movss	%xmm0, 32(%rsp)
+	leal	12345(%r14), %eax
+	imull	$1103515245, %eax, %r14d
+	addl	$12345, %r14d
+	movl	%r14d, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	32(%rsp), %xmm0
+	movss	352(%rsp), %xmm1
+	ucomiss	%xmm1, %xmm1
+	jp	.L135
+	movaps	%xmm1, %xmm2
+	pxor	%xmm6, %xmm6
+	subss	%xmm1, %xmm2
+	ucomiss	%xmm6, %xmm2
+	jp	.L135
+	jne	.L135
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L94
+	shrl	$8, %eax
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	%eax, %xmm1
+	mulss	.LC9(%rip), %xmm1
+.L94:
+	imull	$1103515245, %r14d, %r14d
+	unpcklps	%xmm1, %xmm0
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movlps	%xmm0, 32(%rsp)
+	leal	12345(%r14), %eax
+	imull	$1103515245, %eax, %r14d
+	addl	$12345, %r14d
+	movl	%r14d, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movq	32(%rsp), %xmm0
+	movss	352(%rsp), %xmm1
+	ucomiss	%xmm1, %xmm1
+	jp	.L137
+	movaps	%xmm1, %xmm2
+	pxor	%xmm7, %xmm7
+	subss	%xmm1, %xmm2
+	ucomiss	%xmm7, %xmm2
+	jp	.L137
+	jne	.L137
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L96
+	shrl	$8, %eax
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	%eax, %xmm1
+	mulss	.LC9(%rip), %xmm1
+.L96:
+	addq	$8, %rbx
+	movl	$0x3f800000, 12(%r13)
+	movlps	%xmm0, 0(%r13)
+	movss	%xmm1, 8(%r13)
+	cmpq	%rbx, %r15
+	je	.L177
+.L98:
+	imull	$1103515245, %r14d, %r14d
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movq	(%rbx), %r13
+	leal	12345(%r14), %eax
+	imull	$1103515245, %eax, %r14d
+	addl	$12345, %r14d
+	movl	%r14d, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	352(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jnp	.L178
+.L133:
+	pxor	%xmm0, %xmm0
+	jmp	.L92
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	pxor	%xmm1, %xmm1
+	jmp	.L96
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	pxor	%xmm1, %xmm1
+	jmp	.L94
+.L177:
+	movq	40(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movl	$0x00000000, 88(%rax)
+	imull	$1103515245, %r14d, %eax
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %ebx
+	addl	$12345, %ebx
+	movl	%ebx, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	352(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L139
+	movaps	%xmm0, %xmm1
+	pxor	%xmm5, %xmm5
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm5, %xmm1
+	jp	.L139
+	jne	.L139
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L103
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L103:
+	movq	40(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movss	%xmm0, 92(%rax)
+	imull	$1103515245, %ebx, %eax
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %ebx
+	addl	$12345, %ebx
+	movl	%ebx, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	352(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L141
+	movaps	%xmm0, %xmm1
+	pxor	%xmm6, %xmm6
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm6, %xmm1
+	jp	.L141
+	jne	.L141
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L101
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L101:
+	movq	40(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movss	%xmm0, 96(%rax)
+	movl	$0x00000000, 100(%rax)
+	imull	$1103515245, %ebx, %eax
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %ebx
+	addl	$12345, %ebx
+	movl	%ebx, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	352(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L143
+	movaps	%xmm0, %xmm1
+	pxor	%xmm7, %xmm7
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm7, %xmm1
+	jp	.L143
+	jne	.L143
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L105
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L105:
+	movq	40(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movss	%xmm0, 104(%rax)
+	imull	$1103515245, %ebx, %eax
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %ebx
+	addl	$12345, %ebx
+	movl	%ebx, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	352(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L145
+	movaps	%xmm0, %xmm1
+	pxor	%xmm5, %xmm5
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm5, %xmm1
+	jp	.L145
+	jne	.L145
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L108
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L108:
+	movq	40(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movss	%xmm0, 108(%rax)
+	movl	$0x00000000, 112(%rax)
+	imull	$1103515245, %ebx, %eax
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %ebx
+	addl	$12345, %ebx
+	movl	%ebx, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movss	352(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L147
+	movaps	%xmm0, %xmm1
+	pxor	%xmm6, %xmm6
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm6, %xmm1
+	jp	.L147
+	jne	.L147
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L111
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L111:
+	movq	40(%rsp), %rax
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movss	%xmm0, 116(%rax)
+	imull	$1103515245, %ebx, %eax
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %r9d
+	leal	12345(%r9), %r14d
+	movl	%r14d, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 204(%rsp)
+	call	memcpy@PLT
+	movl	$3123612579, %edx
+	movl	%r14d, %eax
+	movl	52(%rsp), %r13d
+	movss	352(%rsp), %xmm0
+	imulq	%rdx, %rax
+	movq	%r13, %rsi
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %edx
+	leal	(%rax,%rdx,2), %edx
+	movl	%r14d, %eax
+	subl	%edx, %eax
+	leal	-1(%rax), %edx
+	movl	$2863311531, %eax
+	imulq	%rax, %r13
+	shrq	$33, %r13
+	leal	0(%r13,%r13,2), %eax
+	subl	%eax, %esi
+	ucomiss	%xmm0, %xmm0
+	movl	%esi, %r13d
+	jp	.L148
+	movaps	%xmm0, %xmm1
+	pxor	%xmm7, %xmm7
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm7, %xmm1
+	jp	.L148
+	jne	.L148
+	movl	204(%rsp), %eax
+	testb	$1, %al
+	jne	.L114
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L114:
+	movq	40(%rsp), %rax
+	movl	$0x00000000, 124(%rax)
+	movl	%edx, 128(%rax)
+	movss	%xmm0, 120(%rax)
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	movq	40(%rsp), %rdi
+	movl	%r13d, %esi
+	call	wavefrontMaterialMap@PLT
+	movl	$4042322161, %esi
+	movq	56(%rsp), %r15
+	movq	%rax, %rbx
+	movl	52(%rsp), %eax
+	movq	%r15, %rdi
+	addl	%r13d, %eax
+	movl	%eax, %eax
+	movq	%rax, %rcx
+	imulq	%rsi, %rax
+	movl	$32, %esi
+	shrq	$36, %rax
+	movl	%eax, %edx
+	sall	$4, %edx
+	addl	%edx, %eax
+	leaq	.LC11(%rip), %rdx
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+	movq	%r15, %rdi
+	call	strlen@PLT
+	movq	16(%rsp), %rdi
+	movq	%r15, %rsi
+	xorl	%r15d, %r15d
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	24(%rsp), %rdi
+	movq	%rax, (%rbx)
+	call	wavefrontMapOptionsCompose@PLT
+	movdqa	64(%rsp), %xmm4
+	movq	%rbx, 32(%rsp)
+	movl	%r14d, %ebx
+	movdqa	80(%rsp), %xmm5
+	movdqa	96(%rsp), %xmm6
+	movl	%r13d, %r14d
+	movdqa	112(%rsp), %xmm7
+	movq	160(%rsp), %rax
+	movaps	%xmm4, 352(%rsp)
+	movdqa	128(%rsp), %xmm2
+	movaps	%xmm5, 368(%rsp)
+	movdqa	144(%rsp), %xmm4
+	movq	%rax, 448(%rsp)
+	movaps	%xmm6, 384(%rsp)
+	movaps	%xmm7, 400(%rsp)
+	movaps	%xmm2, 416(%rsp)
+	movaps	%xmm4, 432(%rsp)
+	jmp	.L121
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	addq	$1, %r15
+	cmpq	$13, %r15
+	je	.L179
+.L121:
+	btl	%r15d, %ebx
+	jnc	.L118
+	imull	$1103515245, %ebx, %eax
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdi
+	movq	0(%rbp,%r15,8), %r13
+	addl	$12345, %eax
+	imull	$1103515245, %eax, %ecx
+	leal	12345(%rcx), %ebx
+	movl	%ebx, %edx
+	shrl	$16, %edx
+	xorl	%edx, %eax
+	movl	$4, %edx
+	movl	%eax, 200(%rsp)
+	call	memcpy@PLT
+	movss	204(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L150
+	movaps	%xmm0, %xmm1
+	pxor	%xmm3, %xmm3
+	subss	%xmm0, %xmm1
+	ucomiss	%xmm3, %xmm1
+	jp	.L150
+	jne	.L150
+	movl	200(%rsp), %eax
+	testb	$1, %al
+	jne	.L119
+	shrl	$8, %eax
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC9(%rip), %xmm0
+.L119:
+	addq	$1, %r15
+	movss	%xmm0, 0(%r13)
+	cmpq	$13, %r15
+	jne	.L121
+.L179:
+	movl	%r14d, %r13d
+	movl	%ebx, %r14d
+	xorl	%edx, %edx
+	movq	32(%rsp), %rbx
+	imull	$1103515245, %r14d, %r8d
+	leal	12345(%r8), %r14d
+	movl	%r14d, %eax
+	shrl	$16, %eax
+	andl	$15, %eax
+	movl	%eax, 348(%rsp)
+	movl	%r14d, %eax
+	shrl	$20, %eax
+	testl	$256, %r14d
+	cmove	%edx, %eax
+	movl	%eax, 340(%rsp)
+	testl	$512, %r14d
+	je	.L123
+	movl	%r14d, %edx
+	movl	$2863311531, %ecx
+	shrl	$10, %edx
+	movl	%edx, %eax
+	imulq	%rcx, %rax
+	shrq	$34, %rax
+	leal	(%rax,%rax,2), %eax
+	addl	%eax, %eax
+	subl	%eax, %edx
+	leaq	.LC12(%rip), %rax
+	movsbl	(%rax,%rdx), %eax
+	movl	%eax, 344(%rsp)
+.L176:
+	movq	24(%rsp), %rsi
+	movq	16(%rsp), %rdi
+	leaq	12(%rbx), %rdx
+	addl	$3, %r13d
+	call	wavefrontMTLInternMapOptions@PLT
+	cmpl	$19, %r13d
+	jbe	.L126
+	addl	$1, 52(%rsp)
+	movl	52(%rsp), %eax
+	addq	$456, 168(%rsp)
+	cmpl	$300, %eax
+	jne	.L127
+	movq	16(%rsp), %r14
+	movq	%rbp, %rcx
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	movq	$0, 352(%rsp)
+	movq	%r14, %rdi
+	call	writeWavefrontMTLToBuffer@PLT
+	movq	352(%rsp), %rdi
+	call	malloc@PLT
+	movq	352(%rsp), %rdx
+	movq	%rbp, %rcx
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	movq	%rax, %rbx
+	call	writeWavefrontMTLToBuffer@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L128
+	addl	$1, asserts_passed(%rip)
+.L129:
+	movq	352(%rsp), %rdx
+	movq	16(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	readsBack
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L130
+	addl	$1, asserts_passed(%rip)
+.L131:
+	movq	%rbx, %rdi
+	call	free@PLT
+	movq	16(%rsp), %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$584, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.cfi_restore_state
+	pxor	%xmm0, %xmm0
+	jmp	.L119
+	.p2align 4,,10
+	.p2align 3
+.L123:
+	movl	$0, 344(%rsp)
+	jmp	.L176
+.L148:
+	pxor	%xmm0, %xmm0
+	jmp	.L114
+.L147:
+	pxor	%xmm0, %xmm0
+	jmp	.L111
+.L145:
+	pxor	%xmm0, %xmm0
+	jmp	.L108
+.L143:
+	pxor	%xmm0, %xmm0
+	jmp	.L105
+.L141:
+	pxor	%xmm0, %xmm0
+	jmp	.L101
+.L139:
+	pxor	%xmm0, %xmm0
+	jmp	.L103
+.L90:
+	xorl	%r8d, %r8d
+	movl	$179, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L91
+.L128:
+	xorl	%r8d, %r8d
+	movl	$216, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L129
+.L130:
+	movl	$1, %r8d
+	movl	$217, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L131
+	.cfi_endproc
+.LFE29:
+	.size	testWriteRoundTripRandom, .-testWriteRoundTripRandom
+	.section	.rodata.str1.1
+.LC13:
+	.string	"bin/writer_test.mtl"
+.LC14:
+	.string	"bin/missing/writer_test.mtl"
+	.text
+	.p2align 4
+	.globl	testWriteFile
+	.type	testWriteFile, @function
+testWriteFile:
+.LFB30:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	writerInput(%rip), %rsi
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$224, %rsp
+	.cfi_def_cfa_offset 256
+	movq	%rsp, %rbx
+	movq	%rbx, %rdi
+	call	parseWavefrontMTLFromString@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L181
+	addl	$1, asserts_passed(%rip)
+.L182:
+	leaq	.LC13(%rip), %rbp
+	movq	%rbx, %rdi
+	movq	%rbp, %rsi
+	call	writeWavefrontMTLToFile@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L183
+	addl	$1, asserts_passed(%rip)
+.L184:
+	leaq	112(%rsp), %r12
+	xorl	%edx, %edx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontMTLFromFile@PLT
+	movslq	%eax, %rcx
+	testq	%rcx, %rcx
+	jne	.L185
+	addl	$1, asserts_passed(%rip)
+.L186:
+	movl	120(%rsp), %ecx
+	cmpq	$2, %rcx
+	jne	.L187
+	addl	$1, asserts_passed(%rip)
+.L188:
+	movq	(%rsp), %rax
+	movq	%rbx, %rdx
+	movq	%r12, %rdi
+	leaq	456(%rax), %rcx
+	movq	112(%rsp), %rax
+	leaq	456(%rax), %rsi
+	call	wavefrontMaterialEqual@PLT
+	movslq	%eax, %rcx
+	cmpl	$1, %eax
+	jne	.L189
+	addl	$1, asserts_passed(%rip)
+.L190:
+	movq	%rbp, %rdi
+	call	remove@PLT
+	leaq	.LC14(%rip), %rsi
+	movq	%rbx, %rdi
+	call	writeWavefrontMTLToFile@PLT
+	movslq	%eax, %rcx
+	cmpl	$2, %eax
+	jne	.L191
+	addl	$1, asserts_passed(%rip)
+.L192:
+	movq	%r12, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	call	wavefrontMTLRelease@PLT
+	addq	$224, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L187:
+	.cfi_restore_state
+	movl	$2, %r8d
+	movl	$231, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L188
+	.p2align 4,,10
+	.p2align 3
+.L191:
+	movl	$2, %r8d
+	movl	$234, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L192
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	movl	$1, %r8d
+	movl	$232, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L190
+	.p2align 4,,10
+	.p2align 3
+.L185:
+	xorl	%r8d, %r8d
+	movl	$230, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L186
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	xorl	%r8d, %r8d
+	movl	$228, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L184
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	xorl	%r8d, %r8d
+	movl	$225, %edx
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L182
+	.cfi_endproc
+.LFE30:
+	.size	testWriteFile, .-testWriteFile
+	.p2align 4
+	.globl	wavefrontMaterialWriterTest
+	.type	wavefrontMaterialWriterTest, @function
+wavefrontMaterialWriterTest:
+.LFB31:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testWriteCanonical
+	xorl	%eax, %eax
+	call	testWriteBufferSize
+	xorl	%eax, %eax
+	call	testWriteCallbackError
+	xorl	%eax, %eax
+	call	testWriteSkipsRemoved
+	xorl	%eax, %eax
+	call	testWriteRoundTripRandom
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testWriteFile
+	.cfi_endproc
+.LFE31:
+	.size	wavefrontMaterialWriterTest, .-wavefrontMaterialWriterTest
+	.section	.rodata
+	.align 32
+	.type	writerInput, @object
+	.size	writerInput, 289
+writerInput:
+	.ascii	"newmtl first\nKa 0.1 0.2 0.3\nKd 0"
+	.string	".640000 0.640000 0.640000\nKs 0 0 0\nNs 96.078431\nTr 0.25\nillum 2\nmap_Kd -blendu off -o 0.5 0.25 0 -imfchan r diffuse.png\nnewmtl second\nNi 1.45\nPr 0.5\nKe 1e-7 0.5 12345678\nbump -bm 2 -clamp on -texres 512 bump map.png\nrefl -type cube_top -mm 0.1 0.9 top.png\n"
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC5:
+	.long	1040187392
+	.long	1048576000
+	.long	1056964608
+	.long	1065353216
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC9:
+	.long	864026624
+	.section	.note.GNU-stack,"",@progbits
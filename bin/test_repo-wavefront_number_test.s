@@ -0,0 +1,2105 @@
+	.file	"wavefront_number_test.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC36:
+	.string	"%s: parsed %.9g, strtof %.9g\n"
+	.text
+	.p2align 4
+	.type	matchesStrtof, @function
+matchesStrtof:
+.LFB23:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 80
+	movq	$0, 40(%rsp)
+	leaq	40(%rsp), %rsi
+	call	strtof@PLT
+	movq	%rbx, %rdi
+	movl	$0x00000000, 28(%rsp)
+	movd	%xmm0, %r14d
+	call	strlen@PLT
+	leaq	28(%rsp), %rdx
+	movq	%rbx, %rdi
+	leaq	(%rbx,%rax), %rsi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %rbx
+	je	.L2
+	movss	28(%rsp), %xmm0
+.L3:
+	cmpq	%rax, 40(%rsp)
+	jne	.L6
+	leaq	36(%rsp), %rsi
+	leaq	32(%rsp), %rdi
+	movl	$4, %edx
+	movss	%xmm0, 32(%rsp)
+	movss	%xmm0, 12(%rsp)
+	movl	%r14d, 36(%rsp)
+	call	memcmp@PLT
+	movss	12(%rsp), %xmm0
+	testl	%eax, %eax
+	jne	.L6
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.cfi_restore_state
+	movd	%r14d, %xmm3
+	movq	%rbx, %rsi
+	pxor	%xmm1, %xmm1
+	movl	$2, %eax
+	leaq	.LC36(%rip), %rdi
+	cvtss2sd	%xmm0, %xmm0
+	cvtss2sd	%xmm3, %xmm1
+	call	printf@PLT
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.cfi_restore_state
+	movl	$0x00000000, 28(%rsp)
+	pxor	%xmm0, %xmm0
+	jmp	.L3
+	.cfi_endproc
+.LFE23:
+	.size	matchesStrtof, .-matchesStrtof
+	.section	.rodata.str1.1
+.LC38:
+	.string	"src/wavefront_number_test.c"
+.LC39:
+	.string	"%s:%d: %lld != %lld\n"
+.LC0:
+	.string	"0"
+.LC1:
+	.string	"-0"
+.LC2:
+	.string	"1"
+.LC3:
+	.string	"0.5"
+.LC4:
+	.string	"0.640000"
+.LC5:
+	.string	"96.078431"
+.LC6:
+	.string	"1.000000"
+.LC7:
+	.string	"3.920000"
+.LC8:
+	.string	"+2.5"
+.LC9:
+	.string	"-0.0001"
+.LC10:
+	.string	".5"
+.LC11:
+	.string	"5."
+.LC12:
+	.string	"1e3"
+.LC13:
+	.string	"1E-3"
+.LC14:
+	.string	"2.5e+2"
+.LC15:
+	.string	"1e"
+.LC16:
+	.string	"1e+"
+.LC17:
+	.string	"0.1"
+.LC18:
+	.string	"0.2"
+.LC19:
+	.string	"0.3"
+.LC20:
+	.string	"3.4028235e38"
+.LC21:
+	.string	"3.4028236e38"
+.LC22:
+	.string	"1e39"
+.LC23:
+	.string	"1e-45"
+.LC24:
+	.string	"7e-46"
+.LC25:
+	.string	"8e-46"
+.LC26:
+	.string	"1.17549435e-38"
+.LC27:
+	.string	"1.4e-45"
+.LC28:
+	.string	"inf"
+.LC29:
+	.string	"-Infinity"
+.LC30:
+	.string	"1.5 0.5"
+.LC31:
+	.string	"12abc"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC32:
+	.string	"00000000000000000000000000000123.456"
+	.align 8
+.LC33:
+	.string	"0.000000000000000000000000000000000000000000000000001"
+	.data
+	.align 32
+.LC37:
+	.quad	.LC0
+	.quad	.LC1
+	.quad	.LC2
+	.quad	.LC3
+	.quad	.LC4
+	.quad	.LC5
+	.quad	.LC6
+	.quad	.LC7
+	.quad	.LC8
+	.quad	.LC9
+	.quad	.LC10
+	.quad	.LC11
+	.quad	.LC12
+	.quad	.LC13
+	.quad	.LC14
+	.quad	.LC15
+	.quad	.LC16
+	.quad	.LC17
+	.quad	.LC18
+	.quad	.LC19
+	.quad	.LC20
+	.quad	.LC21
+	.quad	.LC22
+	.quad	.LC23
+	.quad	.LC24
+	.quad	.LC25
+	.quad	.LC26
+	.quad	.LC27
+	.quad	.LC28
+	.quad	.LC29
+	.quad	.LC30
+	.quad	.LC31
+	.quad	.LC32
+	.quad	.LC33
+	.text
+	.p2align 4
+	.globl	testParseFloatSimple
+	.type	testParseFloatSimple, @function
+testParseFloatSimple:
+.LFB24:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC37(%rip), %rsi
+	movl	$34, %ecx
+	xorl	%r15d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$328, %rsp
+	.cfi_def_cfa_offset 384
+	leaq	48(%rsp), %rdi
+	leaq	48(%rsp), %rbp
+	rep movsq
+	leaq	40(%rsp), %r13
+	leaq	28(%rsp), %r12
+	leaq	320(%rsp), %r14
+	jmp	.L14
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movss	8(%rsp), %xmm2
+	leaq	32(%rsp), %rsi
+	leaq	36(%rsp), %rdi
+	movl	$4, %edx
+	movss	%xmm0, 36(%rsp)
+	movss	%xmm0, 12(%rsp)
+	movss	%xmm2, 32(%rsp)
+	call	memcmp@PLT
+	movss	12(%rsp), %xmm0
+	testl	%eax, %eax
+	jne	.L12
+	addq	$8, %rbp
+	addl	$1, %r15d
+	cmpq	%rbp, %r14
+	je	.L20
+.L14:
+	movq	$0, 40(%rsp)
+	movq	0(%rbp), %rbx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	strtof@PLT
+	movq	%rbx, %rdi
+	movl	$0x00000000, 28(%rsp)
+	movss	%xmm0, 8(%rsp)
+	call	strlen@PLT
+	movq	%r12, %rdx
+	movq	%rbx, %rdi
+	leaq	(%rbx,%rax), %rsi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %rbx
+	je	.L10
+	movss	28(%rsp), %xmm0
+.L11:
+	cmpq	40(%rsp), %rax
+	je	.L21
+.L12:
+	pxor	%xmm1, %xmm1
+	movq	%rbx, %rsi
+	movl	$2, %eax
+	addq	$8, %rbp
+	leaq	.LC36(%rip), %rdi
+	cvtss2sd	%xmm0, %xmm0
+	cvtss2sd	8(%rsp), %xmm1
+	call	printf@PLT
+	cmpq	%rbp, %r14
+	jne	.L14
+.L20:
+	cmpl	$34, %r15d
+	jne	.L15
+	addl	$1, asserts_passed(%rip)
+	addq	$328, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+	movl	$0x00000000, 28(%rsp)
+	pxor	%xmm0, %xmm0
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	movslq	%r15d, %rcx
+	movl	$34, %r8d
+	movl	$41, %edx
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	addq	$328, %rsp
+	.cfi_def_cfa_offset 56
+	leaq	.LC38(%rip), %rsi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	leaq	.LC39(%rip), %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	printf@PLT
+	.cfi_endproc
+.LFE24:
+	.size	testParseFloatSimple, .-testParseFloatSimple
+	.section	.rodata.str1.1
+.LC41:
+	.string	""
+.LC42:
+	.string	"-"
+.LC43:
+	.string	"."
+.LC44:
+	.string	"e5"
+.LC45:
+	.string	"abc"
+.LC46:
+	.string	"+.e1"
+.LC50:
+	.string	"%s:%d: %f != %f\n"
+	.text
+	.p2align 4
+	.globl	testParseFloatInvalid
+	.type	testParseFloatInvalid, @function
+testParseFloatInvalid:
+.LFB25:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	.LC42(%rip), %rax
+	leaq	.LC41(%rip), %rcx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %xmm0
+	movq	%rax, %xmm4
+	leaq	.LC43(%rip), %rcx
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	punpcklqdq	%xmm4, %xmm0
+	leaq	.LC44(%rip), %rax
+	leaq	.LC50(%rip), %r14
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rax, %xmm5
+	leaq	.LC46(%rip), %rax
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rax, %xmm6
+	leaq	.LC38(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	movaps	%xmm0, 16(%rsp)
+	movq	%rcx, %xmm0
+	leaq	16(%rsp), %rbx
+	leaq	.LC45(%rip), %rcx
+	punpcklqdq	%xmm5, %xmm0
+	leaq	64(%rsp), %r13
+	leaq	12(%rsp), %r12
+	movaps	%xmm0, 32(%rsp)
+	movq	%rcx, %xmm0
+	punpcklqdq	%xmm6, %xmm0
+	movaps	%xmm0, 48(%rsp)
+	jmp	.L29
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$50, %edx
+	movq	%rbp, %rsi
+	leaq	.LC39(%rip), %rdi
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L24:
+	pxor	%xmm0, %xmm0
+	movsd	.LC49(%rip), %xmm2
+	cvtss2sd	12(%rsp), %xmm0
+	movapd	%xmm0, %xmm1
+	subsd	.LC48(%rip), %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L25
+	movsd	.LC48(%rip), %xmm1
+	subsd	%xmm0, %xmm1
+	comisd	%xmm1, %xmm2
+	jbe	.L25
+	addq	$8, %rbx
+	addl	$1, asserts_passed(%rip)
+	cmpq	%rbx, %r13
+	je	.L34
+.L29:
+	movq	(%rbx), %r15
+	movl	$0x42280000, 12(%rsp)
+	movq	%r15, %rdi
+	call	strlen@PLT
+	movq	%r12, %rdx
+	movq	%r15, %rdi
+	leaq	(%r15,%rax), %rsi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %r15
+	jne	.L23
+	addl	$1, asserts_passed(%rip)
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	movl	$51, %edx
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	addq	$8, %rbx
+	movq	.LC48(%rip), %rax
+	addl	$1, asserts_failed(%rip)
+	movq	%rax, %xmm1
+	movl	$2, %eax
+	call	printf@PLT
+	cmpq	%rbx, %r13
+	jne	.L29
+.L34:
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	testParseFloatInvalid, .-testParseFloatInvalid
+	.p2align 4
+	.globl	testParseFloatBounded
+	.type	testParseFloatBounded, @function
+testParseFloatBounded:
+.LFB26:
+	.cfi_startproc
+	movabsq	$14975568255725104, %rax
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	leaq	8(%rsp), %rbx
+	leaq	4(%rsp), %rdx
+	movq	%rax, 8(%rsp)
+	leaq	12(%rsp), %rsi
+	movq	%rbx, %rdi
+	movl	$0x00000000, 4(%rsp)
+	call	parseWavefrontFloat@PLT
+	subq	%rbx, %rax
+	cmpq	$4, %rax
+	jne	.L36
+	addl	$1, asserts_passed(%rip)
+.L37:
+	movsd	.LC51(%rip), %xmm1
+	pxor	%xmm0, %xmm0
+	movsd	.LC49(%rip), %xmm2
+	cvtss2sd	4(%rsp), %xmm0
+	movapd	%xmm0, %xmm3
+	subsd	%xmm1, %xmm3
+	comisd	%xmm3, %xmm2
+	jbe	.L38
+	movapd	%xmm1, %xmm3
+	subsd	%xmm0, %xmm3
+	comisd	%xmm3, %xmm2
+	ja	.L45
+.L38:
+	movl	$60, %edx
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC50(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.cfi_restore_state
+	movq	%rax, %rcx
+	movl	$4, %r8d
+	xorl	%eax, %eax
+	movl	$59, %edx
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L37
+	.cfi_endproc
+.LFE26:
+	.size	testParseFloatBounded, .-testParseFloatBounded
+	.p2align 4
+	.globl	testParseFloatRoundTrip
+	.type	testParseFloatRoundTrip, @function
+testParseFloatRoundTrip:
+.LFB28:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	40+roundTripFormats(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	leaq	40(%rsp), %rax
+	movl	$0, 12(%rsp)
+	leaq	48(%rsp), %rbx
+	movq	%rax, 16(%rsp)
+	leaq	44(%rsp), %rax
+	movq	%rax, 24(%rsp)
+.L47:
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	movq	16(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	movl	%r14d, %eax
+	xorl	%r15d, %r15d
+	orl	%r13d, %eax
+	movl	$4, %edx
+	leaq	roundTripFormats(%rip), %rbp
+	movl	%eax, 40(%rsp)
+	call	memcpy@PLT
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	movq	0(%rbp), %rdx
+	movl	$128, %esi
+	movq	%rbx, %rdi
+	pxor	%xmm0, %xmm0
+	movl	$1, %eax
+	cvtss2sd	44(%rsp), %xmm0
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	matchesStrtof
+	cmpl	$1, %eax
+	adcl	$0, %r15d
+	addq	$8, %rbp
+	cmpq	%r12, %rbp
+	jne	.L48
+	movl	12(%rsp), %eax
+	movq	16(%rsp), %rsi
+	movl	$4, %edx
+	leaq	roundTripFormats(%rip), %rbp
+	movq	24(%rsp), %rdi
+	addl	%r15d, %eax
+	xorl	%r15d, %r15d
+	movl	%eax, 12(%rsp)
+	movl	$8388607, %eax
+	subl	%r13d, %eax
+	orl	%r14d, %eax
+	movl	%eax, 40(%rsp)
+	call	memcpy@PLT
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	movq	0(%rbp), %rdx
+	movl	$128, %esi
+	movq	%rbx, %rdi
+	pxor	%xmm0, %xmm0
+	movl	$1, %eax
+	cvtss2sd	44(%rsp), %xmm0
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	matchesStrtof
+	cmpl	$1, %eax
+	adcl	$0, %r15d
+	addq	$8, %rbp
+	cmpq	%r12, %rbp
+	jne	.L49
+	movl	12(%rsp), %eax
+	addl	$1, %r13d
+	addl	%r15d, %eax
+	movl	%eax, 12(%rsp)
+	cmpl	$64, %r13d
+	jne	.L50
+	addl	$8388608, %r14d
+	cmpl	$2139095040, %r14d
+	jne	.L47
+	xorl	%ebp, %ebp
+.L51:
+	movq	16(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	movl	%ebp, 40(%rsp)
+	xorl	%r13d, %r13d
+	movl	$4, %edx
+	leaq	roundTripFormats(%rip), %r14
+	call	memcpy@PLT
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movq	(%r14), %rdx
+	movl	$128, %esi
+	movq	%rbx, %rdi
+	pxor	%xmm0, %xmm0
+	movl	$1, %eax
+	cvtss2sd	44(%rsp), %xmm0
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	matchesStrtof
+	cmpl	$1, %eax
+	adcl	$0, %r13d
+	addq	$8, %r14
+	cmpq	%r12, %r14
+	jne	.L52
+	addq	$8191, %rbp
+	addl	%r13d, 12(%rsp)
+	cmpq	$2139096032, %rbp
+	jne	.L51
+	movl	12(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L53
+	addl	$1, asserts_passed(%rip)
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L53:
+	.cfi_restore_state
+	movslq	12(%rsp), %rcx
+	xorl	%r8d, %r8d
+	movl	$96, %edx
+	xorl	%eax, %eax
+	addl	$1, asserts_failed(%rip)
+	addq	$184, %rsp
+	.cfi_def_cfa_offset 56
+	leaq	.LC38(%rip), %rsi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	leaq	.LC39(%rip), %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	printf@PLT
+	.cfi_endproc
+.LFE28:
+	.size	testParseFloatRoundTrip, .-testParseFloatRoundTrip
+	.section	.rodata.str1.1
+.LC53:
+	.string	"%.120e"
+.LC54:
+	.string	"%.120e1"
+.LC55:
+	.string	"%.40e"
+	.text
+	.p2align 4
+	.globl	testParseFloatMidpoints
+	.type	testParseFloatMidpoints, @function
+testParseFloatMidpoints:
+.LFB29:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	leaq	40(%rsp), %rax
+	leaq	32(%rsp), %r14
+	movq	%rax, 16(%rsp)
+	leaq	36(%rsp), %rax
+	leaq	44(%rsp), %r15
+	movq	%rax, 24(%rsp)
+	leaq	48(%rsp), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	movq	16(%rsp), %rdi
+	leal	1(%r12), %eax
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movl	%r12d, 32(%rsp)
+	movl	%eax, 36(%rsp)
+	call	memcpy@PLT
+	movq	24(%rsp), %rsi
+	movl	$4, %edx
+	movq	%r15, %rdi
+	call	memcpy@PLT
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	movq	%rbx, %rdi
+	cvtss2sd	44(%rsp), %xmm1
+	cvtss2sd	40(%rsp), %xmm0
+	addsd	%xmm1, %xmm0
+	mulsd	.LC52(%rip), %xmm0
+	leaq	.LC53(%rip), %rdx
+	movl	$256, %esi
+	movl	$1, %eax
+	movsd	%xmm0, 8(%rsp)
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	matchesStrtof
+	movsd	8(%rsp), %xmm0
+	movl	$256, %esi
+	movq	%rbx, %rdi
+	cmpl	$1, %eax
+	leaq	.LC54(%rip), %rdx
+	movl	$1, %eax
+	adcl	$0, %ebp
+	call	snprintf@PLT
+	movl	$101, %esi
+	movq	%rbx, %rdi
+	call	strchr@PLT
+	movq	%rax, %rdi
+	movq	%rax, %r13
+	call	strlen@PLT
+	movq	%r13, %rsi
+	leaq	-1(%r13), %rdi
+	leaq	1(%rax), %rdx
+	call	memmove@PLT
+	movq	%rbx, %rdi
+	call	matchesStrtof
+	movsd	8(%rsp), %xmm0
+	movl	$256, %esi
+	movq	%rbx, %rdi
+	cmpl	$1, %eax
+	leaq	.LC55(%rip), %rdx
+	movl	$1, %eax
+	adcl	$0, %ebp
+	call	snprintf@PLT
+	movq	%rbx, %rdi
+	call	matchesStrtof
+	cmpl	$1, %eax
+	adcl	$0, %ebp
+	addq	$65521, %r12
+	cmpq	$2139129608, %r12
+	jne	.L64
+	testl	%ebp, %ebp
+	jne	.L65
+	addl	$1, asserts_passed(%rip)
+.L63:
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L65:
+	.cfi_restore_state
+	movslq	%ebp, %rcx
+	xorl	%r8d, %r8d
+	movl	$120, %edx
+	xorl	%eax, %eax
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L63
+	.cfi_endproc
+.LFE29:
+	.size	testParseFloatMidpoints, .-testParseFloatMidpoints
+	.section	.rodata.str1.1
+.LC56:
+	.string	"e%d"
+	.text
+	.p2align 4
+	.globl	testParseFloatRandom
+	.type	testParseFloatRandom, @function
+testParseFloatRandom:
+.LFB30:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$12345, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	$3435973837, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC56(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	$200000, %ebx
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	movq	%rsp, %r12
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	imull	$1103515245, %r15d, %ecx
+	xorl	%edi, %edi
+	addl	$12345, %ecx
+	movl	%ecx, %r10d
+	shrl	$16, %r10d
+	movl	%r10d, %eax
+	imulq	%r14, %rax
+	shrq	$37, %rax
+	leal	(%rax,%rax,4), %eax
+	sall	$3, %eax
+	subl	%eax, %r10d
+	addl	$1, %r10d
+	testb	$1, %cl
+	je	.L70
+	movb	$45, (%rsp)
+	movl	$1, %edi
+.L70:
+	xorl	%esi, %esi
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	addl	$1, %esi
+	movl	%r8d, %edi
+	cmpl	%esi, %r10d
+	jle	.L83
+.L72:
+	imull	$1103515245, %ecx, %ecx
+	movslq	%edi, %r9
+	leal	1(%rdi), %r8d
+	addl	$12345, %ecx
+	movl	%ecx, %eax
+	shrl	$16, %eax
+	movl	%eax, %edx
+	imulq	%r14, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%edx, %eax
+	addl	$48, %eax
+	movb	%al, (%rsp,%r9)
+	testl	%esi, %esi
+	jne	.L78
+	testb	$2, %cl
+	je	.L78
+	movslq	%r8d, %r8
+	addl	$1, %esi
+	addl	$2, %edi
+	movb	$46, (%rsp,%r8)
+	cmpl	%esi, %r10d
+	jg	.L72
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	imull	$1103515245, %ecx, %ecx
+	movslq	%edi, %rdi
+	movl	$256, %esi
+	movq	%r13, %rdx
+	subq	%rdi, %rsi
+	addq	%r12, %rdi
+	leal	12345(%rcx), %r15d
+	movl	%r15d, %ecx
+	shrl	$16, %ecx
+	movl	%ecx, %eax
+	imulq	$1374389535, %rax, %rax
+	shrq	$37, %rax
+	imull	$100, %eax, %eax
+	subl	%eax, %ecx
+	xorl	%eax, %eax
+	subl	$60, %ecx
+	call	snprintf@PLT
+	movq	%r12, %rdi
+	call	matchesStrtof
+	cmpl	$1, %eax
+	adcl	$0, %ebp
+	subl	$1, %ebx
+	jne	.L73
+	testl	%ebp, %ebp
+	jne	.L74
+	addl	$1, asserts_passed(%rip)
+.L69:
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L74:
+	.cfi_restore_state
+	movslq	%ebp, %rcx
+	xorl	%r8d, %r8d
+	movl	$142, %edx
+	xorl	%eax, %eax
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L69
+	.cfi_endproc
+.LFE30:
+	.size	testParseFloatRandom, .-testParseFloatRandom
+	.section	.rodata.str1.1
+.LC57:
+	.string	"(null)"
+.LC65:
+	.string	"-2.5"
+.LC66:
+	.string	"0.64"
+.LC67:
+	.string	"96.07843"
+.LC68:
+	.string	"0.0001"
+.LC69:
+	.string	"9.9e-5"
+.LC70:
+	.string	"123456790"
+.LC71:
+	.string	"1e9"
+.LC72:
+	.string	"1e10"
+.LC73:
+	.string	"1.1754944e-38"
+.LC74:
+	.string	"-inf"
+.LC75:
+	.string	"%s:%d: \"%s\" != \"%s\"\n"
+	.text
+	.p2align 4
+	.globl	testFormatFloat
+	.type	testFormatFloat, @function
+testFormatFloat:
+.LFB31:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm1, %xmm1
+	xorl	%r15d, %r15d
+	leaq	.LC0(%rip), %rdx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	.LC2(%rip), %rcx
+	leaq	.LC38(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 320
+	movaps	.LC58(%rip), %xmm0
+	movq	.LC61(%rip), %rax
+	movl	$0x00800000, 88(%rsp)
+	movq	%rsp, %rbx
+	leaq	32(%rsp), %r12
+	leaq	112(%rsp), %rbp
+	movaps	%xmm0, 32(%rsp)
+	movaps	.LC59(%rip), %xmm0
+	movq	%rax, 80(%rsp)
+	leaq	.LC1(%rip), %rax
+	movaps	%xmm0, 48(%rsp)
+	movaps	.LC60(%rip), %xmm0
+	movq	%rax, %xmm2
+	leaq	.LC65(%rip), %rax
+	movq	%rax, %xmm3
+	leaq	.LC67(%rip), %rax
+	movaps	%xmm0, 64(%rsp)
+	movss	.LC63(%rip), %xmm0
+	movq	%rax, %xmm4
+	leaq	.LC68(%rip), %rax
+	movq	%rax, %xmm5
+	leaq	.LC70(%rip), %rax
+	divss	%xmm1, %xmm0
+	movq	%rax, %xmm6
+	leaq	.LC72(%rip), %rax
+	movq	%rax, %xmm7
+	leaq	.LC23(%rip), %rax
+	movaps	%xmm0, %xmm1
+	xorps	.LC64(%rip), %xmm1
+	unpcklps	%xmm1, %xmm0
+	movlps	%xmm0, 92(%rsp)
+	movq	%rdx, %xmm0
+	leaq	.LC66(%rip), %rdx
+	punpcklqdq	%xmm2, %xmm0
+	movq	%rax, %xmm2
+	leaq	.LC28(%rip), %rax
+	movaps	%xmm0, 112(%rsp)
+	movq	%rcx, %xmm0
+	leaq	.LC17(%rip), %rcx
+	punpcklqdq	%xmm3, %xmm0
+	movq	%rax, %xmm3
+	leaq	.LC74(%rip), %rax
+	movaps	%xmm0, 128(%rsp)
+	movq	%rdx, %xmm0
+	leaq	.LC69(%rip), %rdx
+	punpcklqdq	%xmm4, %xmm0
+	movq	%rax, 240(%rsp)
+	movaps	%xmm0, 144(%rsp)
+	movq	%rcx, %xmm0
+	leaq	.LC71(%rip), %rcx
+	punpcklqdq	%xmm5, %xmm0
+	movaps	%xmm0, 160(%rsp)
+	movq	%rdx, %xmm0
+	leaq	.LC20(%rip), %rdx
+	punpcklqdq	%xmm6, %xmm0
+	movaps	%xmm0, 176(%rsp)
+	movq	%rcx, %xmm0
+	leaq	.LC73(%rip), %rcx
+	punpcklqdq	%xmm7, %xmm0
+	movaps	%xmm0, 192(%rsp)
+	movq	%rdx, %xmm0
+	punpcklqdq	%xmm2, %xmm0
+	movaps	%xmm0, 208(%rsp)
+	movq	%rcx, %xmm0
+	punpcklqdq	%xmm3, %xmm0
+	movaps	%xmm0, 224(%rsp)
+	jmp	.L89
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	addq	$1, %r15
+	addl	$1, asserts_passed(%rip)
+	cmpq	$17, %r15
+	je	.L92
+.L89:
+	movss	(%r12,%r15,4), %xmm0
+	movq	%rbx, %rdi
+	call	formatWavefrontFloat@PLT
+	movq	0(%rbp,%r15,8), %r13
+	movb	$0, (%rsp,%rax)
+	testq	%r13, %r13
+	je	.L85
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+	testl	%eax, %eax
+	je	.L93
+	movl	asserts_failed(%rip), %eax
+	addl	$1, %eax
+.L88:
+	movl	%eax, asserts_failed(%rip)
+	movq	%r13, %r8
+	movq	%rbx, %rcx
+	movq	%r14, %rsi
+	movl	$158, %edx
+	leaq	.LC75(%rip), %rdi
+	xorl	%eax, %eax
+	addq	$1, %r15
+	call	printf@PLT
+	cmpq	$17, %r15
+	jne	.L89
+.L92:
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.cfi_restore_state
+	movl	asserts_failed(%rip), %eax
+	leaq	.LC57(%rip), %r13
+	addl	$1, %eax
+	jmp	.L88
+	.cfi_endproc
+.LFE31:
+	.size	testFormatFloat, .-testFormatFloat
+	.section	.rodata.str1.1
+.LC76:
+	.string	"%.*g"
+.LC77:
+	.string	"%.9g: formatted %s\n"
+	.text
+	.p2align 4
+	.globl	testFormatFloatRoundTrip
+	.type	testFormatFloatRoundTrip, @function
+testFormatFloatRoundTrip:
+.LFB33:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	.LC76(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	xorl	%ebx, %ebx
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	leaq	44(%rsp), %rax
+	movl	$0, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	48(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L106
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	addq	$4093, %rbx
+	movabsq	$4294969085, %rax
+	cmpq	%rax, %rbx
+	je	.L125
+.L106:
+	movq	8(%rsp), %rsi
+	movq	16(%rsp), %rdi
+	movl	%ebx, 44(%rsp)
+	movl	$4, %edx
+	movl	$0x00000000, 52(%rsp)
+	call	memcpy@PLT
+	movss	48(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm0
+	jp	.L95
+	leaq	64(%rsp), %r14
+	movl	$1, %r15d
+	leaq	96(%rsp), %rbp
+	movq	%r14, %rdi
+	call	formatWavefrontFloat@PLT
+	movss	48(%rsp), %xmm0
+	movb	$0, 64(%rsp,%rax)
+	movq	%rax, %r12
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	movl	%r15d, %ecx
+	movq	%r13, %rdx
+	movl	$32, %esi
+	movq	%rbp, %rdi
+	movl	$1, %eax
+	cvtss2sd	%xmm0, %xmm0
+	call	snprintf@PLT
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	strtof@PLT
+	movaps	%xmm0, %xmm1
+	movss	48(%rsp), %xmm0
+	ucomiss	%xmm0, %xmm1
+	jp	.L110
+	je	.L96
+.L110:
+	addl	$1, %r15d
+	cmpl	$9, %r15d
+	jne	.L98
+.L96:
+	addq	%r14, %r12
+	leaq	52(%rsp), %rdx
+	movq	%r14, %rdi
+	movq	%r12, %rsi
+	call	parseWavefrontFloat@PLT
+	movss	48(%rsp), %xmm0
+	cmpq	%rax, %r12
+	je	.L99
+.L100:
+	movq	%r14, %rsi
+	leaq	.LC77(%rip), %rdi
+	movl	$1, %eax
+	cvtss2sd	%xmm0, %xmm0
+	call	printf@PLT
+	addl	$1, 24(%rsp)
+	jmp	.L95
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	movss	52(%rsp), %xmm1
+	leaq	60(%rsp), %rsi
+	leaq	56(%rsp), %rdi
+	movl	$4, %edx
+	movss	%xmm0, 60(%rsp)
+	movss	%xmm0, 28(%rsp)
+	movss	%xmm1, 56(%rsp)
+	call	memcmp@PLT
+	movss	28(%rsp), %xmm0
+	testl	%eax, %eax
+	jne	.L100
+	movzbl	64(%rsp), %eax
+	cmpb	$101, %al
+	je	.L95
+	testb	%al, %al
+	je	.L95
+	xorl	%edi, %edi
+	xorl	%r8d, %r8d
+	movq	%r14, %rdx
+	movl	$1, %r9d
+	jmp	.L104
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	xorl	%r8d, %r8d
+.L103:
+	addl	$1, %edi
+	xorl	%r9d, %r9d
+.L102:
+	movzbl	1(%rdx), %eax
+	addq	$1, %rdx
+	testb	%al, %al
+	je	.L111
+	cmpb	$101, %al
+	je	.L111
+.L104:
+	leal	-48(%rax), %esi
+	cmpb	$9, %sil
+	ja	.L102
+	cmpb	$48, %al
+	jne	.L109
+	testl	%r9d, %r9d
+	jne	.L102
+	addl	$1, %r8d
+	jmp	.L103
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	subl	%r8d, %edi
+	cmpl	%edi, %r15d
+	jl	.L100
+	jmp	.L95
+.L125:
+	movl	24(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L107
+	addl	$1, asserts_passed(%rip)
+.L94:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L107:
+	.cfi_restore_state
+	movslq	24(%rsp), %rcx
+	xorl	%r8d, %r8d
+	movl	$199, %edx
+	xorl	%eax, %eax
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L94
+	.cfi_endproc
+.LFE33:
+	.size	testFormatFloatRoundTrip, .-testFormatFloatRoundTrip
+	.p2align 4
+	.globl	testHalfRoundTrip
+	.type	testHalfRoundTrip, @function
+testHalfRoundTrip:
+.LFB34:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	xorl	%ebx, %ebx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	jmp	.L131
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	movzwl	%ax, %eax
+	cmpl	%ebx, %eax
+	je	.L130
+.L128:
+	addl	$1, %ebp
+.L130:
+	addl	$1, %ebx
+	cmpl	$65536, %ebx
+	je	.L160
+.L131:
+	movl	%ebx, %edi
+	call	wavefrontHalfToFloat@PLT
+	movss	%xmm0, 12(%rsp)
+	call	wavefrontFloatToHalf@PLT
+	movl	%ebx, %edx
+	andl	$31744, %edx
+	cmpl	$31744, %edx
+	jne	.L127
+	testl	$1023, %ebx
+	je	.L127
+	movss	12(%rsp), %xmm3
+	ucomiss	%xmm3, %xmm3
+	jnp	.L128
+	movl	%eax, %edx
+	andw	$31744, %dx
+	cmpw	$31744, %dx
+	jne	.L128
+	testw	$1023, %ax
+	je	.L128
+	addl	$1, %ebx
+	cmpl	$65536, %ebx
+	jne	.L131
+.L160:
+	testl	%ebp, %ebp
+	jne	.L132
+	addl	$1, asserts_passed(%rip)
+.L133:
+	movl	$15360, %edi
+	call	wavefrontHalfToFloat@PLT
+	movsd	.LC78(%rip), %xmm1
+	movsd	.LC49(%rip), %xmm4
+	cvtss2sd	%xmm0, %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm4
+	jbe	.L134
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm4
+	ja	.L161
+.L134:
+	movl	$212, %edx
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC50(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L137:
+	movl	$31743, %edi
+	call	wavefrontHalfToFloat@PLT
+	movsd	.LC79(%rip), %xmm1
+	movsd	.LC49(%rip), %xmm5
+	cvtss2sd	%xmm0, %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm5
+	jbe	.L138
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm5
+	ja	.L162
+.L138:
+	movl	$213, %edx
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC50(%rip), %rdi
+	movl	$2, %eax
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+.L141:
+	movl	$1, %edi
+	call	wavefrontHalfToFloat@PLT
+	movsd	.LC80(%rip), %xmm1
+	movsd	.LC49(%rip), %xmm6
+	cvtss2sd	%xmm0, %xmm0
+	movapd	%xmm0, %xmm2
+	subsd	%xmm1, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L142
+	movapd	%xmm1, %xmm2
+	subsd	%xmm0, %xmm2
+	comisd	%xmm2, %xmm6
+	jbe	.L142
+	addl	$1, asserts_passed(%rip)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L142:
+	.cfi_restore_state
+	addl	$1, asserts_failed(%rip)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movl	$214, %edx
+	movl	$2, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC50(%rip), %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	printf@PLT
+.L162:
+	.cfi_restore_state
+	addl	$1, asserts_passed(%rip)
+	jmp	.L141
+.L161:
+	addl	$1, asserts_passed(%rip)
+	jmp	.L137
+.L132:
+	movslq	%ebp, %rcx
+	xorl	%r8d, %r8d
+	movl	$211, %edx
+	xorl	%eax, %eax
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L133
+	.cfi_endproc
+.LFE34:
+	.size	testHalfRoundTrip, .-testHalfRoundTrip
+	.p2align 4
+	.globl	testFloatToHalfRounding
+	.type	testFloatToHalfRounding, @function
+testFloatToHalfRounding:
+.LFB36:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	leaq	40(%rsp), %r14
+	leaq	44(%rsp), %r13
+	jmp	.L188
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	xorl	%eax, %eax
+	cmpw	$31744, %bx
+	setne	%al
+	addl	%eax, %r12d
+.L166:
+	addq	$997, %rbp
+	cmpq	$2139095404, %rbp
+	je	.L214
+.L188:
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	movl	%ebp, 40(%rsp)
+	call	memcpy@PLT
+	movss	44(%rsp), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movss	44(%rsp), %xmm1
+	comiss	.LC81(%rip), %xmm1
+	movl	%eax, %ebx
+	jnb	.L215
+	movzwl	%ax, %r15d
+	pxor	%xmm4, %xmm4
+	movss	%xmm1, 8(%rsp)
+	movl	%r15d, %edi
+	cvtss2sd	%xmm1, %xmm4
+	movsd	%xmm4, 16(%rsp)
+	call	wavefrontHalfToFloat@PLT
+	movss	8(%rsp), %xmm1
+	pxor	%xmm2, %xmm2
+	cvtss2sd	%xmm0, %xmm2
+	comiss	%xmm1, %xmm0
+	jbe	.L207
+	subsd	16(%rsp), %xmm2
+	movapd	%xmm2, %xmm1
+.L169:
+	leal	-1(%r15), %edi
+	cmpl	$31743, %edi
+	ja	.L175
+	movss	44(%rsp), %xmm2
+	pxor	%xmm5, %xmm5
+	movsd	%xmm1, 16(%rsp)
+	cvtss2sd	%xmm2, %xmm5
+	movss	%xmm2, 8(%rsp)
+	movsd	%xmm5, 24(%rsp)
+	call	wavefrontHalfToFloat@PLT
+	movss	8(%rsp), %xmm2
+	pxor	%xmm3, %xmm3
+	movsd	16(%rsp), %xmm1
+	cvtss2sd	%xmm0, %xmm3
+	comiss	%xmm2, %xmm0
+	jbe	.L216
+	subsd	24(%rsp), %xmm3
+	movapd	%xmm3, %xmm0
+.L178:
+	comisd	%xmm0, %xmm1
+	ja	.L177
+	ucomisd	%xmm0, %xmm1
+	jp	.L175
+	jne	.L175
+	testb	$1, %bl
+	je	.L175
+.L177:
+	addl	$1, %r12d
+.L175:
+	leal	1(%r15), %edi
+	movsd	%xmm1, 8(%rsp)
+	cmpl	$31743, %edi
+	jg	.L166
+	movss	44(%rsp), %xmm2
+	pxor	%xmm6, %xmm6
+	cvtss2sd	%xmm2, %xmm6
+	movss	%xmm2, 16(%rsp)
+	movsd	%xmm6, 24(%rsp)
+	call	wavefrontHalfToFloat@PLT
+	movss	16(%rsp), %xmm2
+	pxor	%xmm3, %xmm3
+	movsd	8(%rsp), %xmm1
+	cvtss2sd	%xmm0, %xmm3
+	comiss	%xmm2, %xmm0
+	jbe	.L217
+	subsd	24(%rsp), %xmm3
+	movapd	%xmm3, %xmm0
+.L187:
+	comisd	%xmm0, %xmm1
+	ja	.L186
+	ucomisd	%xmm0, %xmm1
+	jp	.L166
+	jne	.L166
+	andl	$1, %ebx
+	je	.L166
+.L186:
+	addq	$997, %rbp
+	addl	$1, %r12d
+	cmpq	$2139095404, %rbp
+	jne	.L188
+.L214:
+	testl	%r12d, %r12d
+	jne	.L189
+	addl	$1, asserts_passed(%rip)
+.L190:
+	movss	.LC82(%rip), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movzwl	%ax, %ecx
+	cmpw	$31743, %ax
+	jne	.L191
+	addl	$1, asserts_passed(%rip)
+.L192:
+	movss	.LC81(%rip), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movzwl	%ax, %ecx
+	cmpw	$31744, %ax
+	jne	.L193
+	addl	$1, asserts_passed(%rip)
+.L194:
+	movss	.LC83(%rip), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movzwl	%ax, %ecx
+	cmpw	$-32768, %ax
+	jne	.L195
+	addl	$1, asserts_passed(%rip)
+.L196:
+	movss	.LC84(%rip), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movzwl	%ax, %ecx
+	testq	%rcx, %rcx
+	jne	.L197
+	addl	$1, asserts_passed(%rip)
+.L198:
+	movss	.LC85(%rip), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movzwl	%ax, %ecx
+	cmpw	$1, %ax
+	jne	.L199
+	addl	$1, asserts_passed(%rip)
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	.cfi_restore_state
+	movsd	16(%rsp), %xmm1
+	subsd	%xmm2, %xmm1
+	jmp	.L169
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	movsd	24(%rsp), %xmm0
+	subsd	%xmm3, %xmm0
+	jmp	.L187
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	movsd	24(%rsp), %xmm0
+	subsd	%xmm3, %xmm0
+	jmp	.L178
+.L191:
+	movl	$31743, %r8d
+	movl	$243, %edx
+	leaq	.LC38(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L192
+.L199:
+	addl	$1, asserts_failed(%rip)
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	movl	$1, %r8d
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	movl	$247, %edx
+	leaq	.LC38(%rip), %rsi
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	leaq	.LC39(%rip), %rdi
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	printf@PLT
+.L195:
+	.cfi_restore_state
+	movl	$32768, %r8d
+	movl	$245, %edx
+	leaq	.LC38(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L196
+.L193:
+	movl	$31744, %r8d
+	movl	$244, %edx
+	leaq	.LC38(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L194
+.L189:
+	movslq	%r12d, %rcx
+	xorl	%r8d, %r8d
+	movl	$242, %edx
+	xorl	%eax, %eax
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L190
+.L197:
+	xorl	%r8d, %r8d
+	movl	$246, %edx
+	leaq	.LC38(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L198
+	.cfi_endproc
+.LFE36:
+	.size	testFloatToHalfRounding, .-testFloatToHalfRounding
+	.section	.rodata.str1.1
+.LC86:
+	.string	"x"
+.LC87:
+	.string	"99999999999"
+	.text
+	.p2align 4
+	.globl	testParseInteger
+	.type	testParseInteger, @function
+testParseInteger:
+.LFB37:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	leaq	4(%rsp), %rbp
+	leaq	9(%rsp), %r12
+	movl	$540161069, 9(%rsp)
+	leaq	15(%rsp), %rsi
+	movq	%rbp, %rdx
+	movq	%r12, %rdi
+	movl	$3617056, 12(%rsp)
+	movl	$0, 4(%rsp)
+	call	parseWavefrontInteger@PLT
+	movslq	4(%rsp), %rcx
+	movq	%rax, %rbx
+	cmpq	$-42, %rcx
+	jne	.L219
+	subq	%r12, %rbx
+	addl	$1, asserts_passed(%rip)
+	cmpq	$3, %rbx
+	jne	.L221
+.L228:
+	addl	$1, asserts_passed(%rip)
+.L222:
+	leaq	10(%rsp), %rsi
+	movq	%rbp, %rdx
+	leaq	.LC86(%rip), %rdi
+	call	parseWavefrontInteger@PLT
+	movslq	4(%rsp), %rcx
+	cmpq	$-42, %rcx
+	jne	.L223
+	addl	$1, asserts_passed(%rip)
+.L224:
+	leaq	.LC87(%rip), %rbx
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rdx
+	movq	%rbx, %rdi
+	leaq	(%rbx,%rax), %rsi
+	call	parseWavefrontInteger@PLT
+	movslq	4(%rsp), %rcx
+	cmpq	$2147483647, %rcx
+	jne	.L225
+	addl	$1, asserts_passed(%rip)
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L219:
+	.cfi_restore_state
+	movq	$-42, %r8
+	movl	$254, %edx
+	xorl	%eax, %eax
+	subq	%r12, %rbx
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	cmpq	$3, %rbx
+	je	.L228
+.L221:
+	movl	$3, %r8d
+	movq	%rbx, %rcx
+	movl	$255, %edx
+	xorl	%eax, %eax
+	leaq	.LC38(%rip), %rsi
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L222
+	.p2align 4,,10
+	.p2align 3
+.L225:
+	movl	$2147483647, %r8d
+	movl	$260, %edx
+	leaq	.LC38(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L223:
+	.cfi_restore_state
+	movq	$-42, %r8
+	movl	$257, %edx
+	leaq	.LC38(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC39(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L224
+	.cfi_endproc
+.LFE37:
+	.size	testParseInteger, .-testParseInteger
+	.p2align 4
+	.globl	wavefrontNumberTest
+	.type	wavefrontNumberTest, @function
+wavefrontNumberTest:
+.LFB38:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testParseFloatSimple
+	xorl	%eax, %eax
+	call	testParseFloatInvalid
+	xorl	%eax, %eax
+	call	testParseFloatBounded
+	xorl	%eax, %eax
+	call	testParseFloatRoundTrip
+	xorl	%eax, %eax
+	call	testParseFloatMidpoints
+	xorl	%eax, %eax
+	call	testParseFloatRandom
+	xorl	%eax, %eax
+	call	testParseInteger
+	xorl	%eax, %eax
+	call	testFormatFloat
+	xorl	%eax, %eax
+	call	testFormatFloatRoundTrip
+	xorl	%eax, %eax
+	call	testHalfRoundTrip
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testFloatToHalfRounding
+	.cfi_endproc
+.LFE38:
+	.size	wavefrontNumberTest, .-wavefrontNumberTest
+	.section	.rodata.str1.1
+.LC88:
+	.string	"%.9g"
+.LC89:
+	.string	"%.6g"
+.LC90:
+	.string	"%.3g"
+.LC91:
+	.string	"%.17g"
+.LC92:
+	.string	"%.30e"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	roundTripFormats, @object
+	.size	roundTripFormats, 40
+roundTripFormats:
+	.quad	.LC88
+	.quad	.LC89
+	.quad	.LC90
+	.quad	.LC91
+	.quad	.LC92
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC48:
+	.long	0
+	.long	1078263808
+	.align 8
+.LC49:
+	.long	-350469331
+	.long	1058682594
+	.align 8
+.LC51:
+	.long	-343597384
+	.long	1069463633
+	.align 8
+.LC52:
+	.long	0
+	.long	1071644672
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC58:
+	.long	0
+	.long	-2147483648
+	.long	1065353216
+	.long	-1071644672
+	.align 16
+.LC59:
+	.long	1059313418
+	.long	1119889448
+	.long	1036831949
+	.long	953267991
+	.align 16
+.LC60:
+	.long	953130552
+	.long	1290500515
+	.long	1315859240
+	.long	1343554297
+	.section	.rodata.cst8
+	.align 8
+.LC61:
+	.long	2139095039
+	.long	1
+	.set	.LC63,.LC58+8
+	.section	.rodata.cst16
+	.align 16
+.LC64:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst8
+	.align 8
+.LC78:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC79:
+	.long	0
+	.long	1089469440
+	.align 8
+.LC80:
+	.long	0
+	.long	1047527424
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC81:
+	.long	1199566848
+	.align 4
+.LC82:
+	.long	1199566592
+	.set	.LC83,.LC58+4
+	.align 4
+.LC84:
+	.long	855638016
+	.align 4
+.LC85:
+	.long	855638017
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,451 @@
+	.file	"wavefront_scan_test.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"src/wavefront_scan_test.c"
+.LC1:
+	.string	"%s:%d: %lld != %lld\n"
+	.text
+	.p2align 4
+	.globl	testScanKernel
+	.type	testScanKernel, @function
+testScanKernel:
+.LFB12:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	call	wavefrontScanKernel@PLT
+	cmpl	$2, %eax
+	ja	.L2
+	addl	$1, asserts_passed(%rip)
+.L3:
+	movdqa	.LC2(%rip), %xmm0
+	movl	$667680, 32(%rsp)
+	movq	%rsp, %r13
+	leaq	16(%rsp), %r12
+	leaq	kernels(%rip), %rbx
+	leaq	.LC0(%rip), %r15
+	movaps	%xmm0, 16(%rsp)
+	leaq	.LC1(%rip), %r14
+.L16:
+	movl	(%rbx), %ebp
+	movl	$4, %r8d
+	movq	%r13, %rcx
+	movl	$19, %edx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	wavefrontFindLineEnds@PLT
+	cmpq	$3, %rax
+	jne	.L4
+	addl	$1, asserts_passed(%rip)
+.L5:
+	movl	(%rsp), %ecx
+	cmpq	$8, %rcx
+	jne	.L6
+	addl	$1, asserts_passed(%rip)
+.L7:
+	movl	4(%rsp), %ecx
+	cmpq	$9, %rcx
+	jne	.L8
+	addl	$1, asserts_passed(%rip)
+.L9:
+	movl	8(%rsp), %ecx
+	cmpq	$18, %rcx
+	jne	.L10
+	addl	$1, asserts_passed(%rip)
+.L11:
+	movl	$4, %r8d
+	movq	%r13, %rcx
+	movl	$8, %edx
+	movl	%ebp, %edi
+	movq	%r12, %rsi
+	call	wavefrontFindLineEnds@PLT
+	testq	%rax, %rax
+	jne	.L12
+	addl	$1, asserts_passed(%rip)
+.L13:
+	xorl	%r8d, %r8d
+	movq	%r13, %rcx
+	movl	$19, %edx
+	movq	%r12, %rsi
+	movl	%ebp, %edi
+	call	wavefrontFindLineEnds@PLT
+	testq	%rax, %rax
+	jne	.L14
+	addl	$1, asserts_passed(%rip)
+.L15:
+	addq	$4, %rbx
+	leaq	12+kernels(%rip), %rax
+	cmpq	%rbx, %rax
+	jne	.L16
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+	movl	$18, %r8d
+	movl	$39, %edx
+	movq	%r15, %rsi
+	xorl	%eax, %eax
+	movq	%r14, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	movl	$9, %r8d
+	movl	$38, %edx
+	movq	%r15, %rsi
+	xorl	%eax, %eax
+	movq	%r14, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	movl	$8, %r8d
+	movl	$37, %edx
+	movq	%r15, %rsi
+	xorl	%eax, %eax
+	movq	%r14, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L7
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movq	%rax, %rcx
+	movl	$3, %r8d
+	movl	$36, %edx
+	xorl	%eax, %eax
+	movq	%r15, %rsi
+	movq	%r14, %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L5
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	movq	%rax, %rcx
+	xorl	%r8d, %r8d
+	xorl	%eax, %eax
+	movl	$41, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L15
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	movq	%rax, %rcx
+	xorl	%r8d, %r8d
+	xorl	%eax, %eax
+	movl	$40, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L13
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	movl	$1, %r8d
+	xorl	%ecx, %ecx
+	movl	$32, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L3
+	.cfi_endproc
+.LFE12:
+	.size	testScanKernel, .-testScanKernel
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC3:
+	.string	"kernel %d: %lu of %lu line ends match in %lu bytes\n"
+	.text
+	.p2align 4
+	.globl	testScanEquivalence
+	.type	testScanEquivalence, @function
+testScanEquivalence:
+.LFB13:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%edi, %edi
+	xorl	%esi, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	alphabet(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	$11, %ebx
+	movl	%ebx, %r12d
+	subq	$4760, %rsp
+	.cfi_def_cfa_offset 4816
+	leaq	2704(%rsp), %rax
+	movl	%edi, 44(%rsp)
+	leaq	48(%rsp), %r8
+	movq	%rax, (%rsp)
+	leaq	648(%rsp), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	imull	$1103515245, %r12d, %r12d
+	movq	%r8, %rdi
+	imull	$-1431655765, %esi, %eax
+	addl	$12345, %r12d
+	cmpl	$1431655766, %eax
+	sbbl	%r9d, %r9d
+	andl	$56, %r9d
+	addl	$8, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	imull	$1103515245, %r12d, %r12d
+	xorl	%edx, %edx
+	addl	$12345, %r12d
+	movl	%r12d, %eax
+	shrl	$16, %eax
+	divl	%r9d
+	cmpl	$7, %edx
+	ja	.L22
+	movl	%edx, %edx
+	addq	$1, %rdi
+	movzbl	0(%rbp,%rdx), %eax
+	movb	%al, -1(%rdi)
+	cmpq	%rdi, %rcx
+	jne	.L25
+.L24:
+	movl	%esi, %r9d
+	movl	%r12d, %eax
+	movl	$569, %ebx
+	xorl	%edx, %edx
+	andl	$31, %r9d
+	shrl	$8, %eax
+	movl	$512, %r15d
+	subq	%r9, %rbx
+	divq	%rbx
+	imull	$-858993459, %esi, %eax
+	movq	%rdx, %r13
+	cmpl	$858993459, %eax
+	ja	.L26
+	movl	%r12d, %edx
+	movl	$3435973837, %ebx
+	shrl	$4, %edx
+	movl	%edx, %eax
+	imulq	%rbx, %rax
+	shrq	$37, %rax
+	leal	(%rax,%rax,4), %eax
+	sall	$3, %eax
+	subl	%eax, %edx
+	leal	1(%rdx), %r15d
+.L26:
+	movl	%esi, 20(%rsp)
+	leaq	(%r8,%r9), %rbx
+	leaq	kernels(%rip), %r14
+	movl	%r12d, 40(%rsp)
+	movq	%r8, 24(%rsp)
+	movq	%rcx, 32(%rsp)
+.L34:
+	movl	(%r14), %eax
+	xorl	%r12d, %r12d
+	movl	%eax, 16(%rsp)
+	testq	%r13, %r13
+	je	.L27
+	xorl	%eax, %eax
+	jmp	.L30
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	cmpb	$13, %dl
+	je	.L41
+	addq	$1, %rax
+	cmpq	%r13, %rax
+	jnb	.L27
+.L54:
+	cmpq	%r15, %r12
+	jnb	.L27
+.L30:
+	movzbl	(%rbx,%rax), %edx
+	cmpb	$10, %dl
+	jne	.L53
+.L41:
+	movl	%eax, 656(%rsp,%r12,4)
+	addq	$1, %rax
+	addq	$1, %r12
+	cmpq	%r13, %rax
+	jb	.L54
+.L27:
+	movq	(%rsp), %rcx
+	movl	16(%rsp), %edi
+	movq	%r15, %r8
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	call	wavefrontFindLineEnds@PLT
+	movq	%rax, %r11
+	cmpq	%r12, %rax
+	jne	.L32
+	movq	(%rsp), %rdi
+	leaq	0(,%r12,4), %rdx
+	movq	%rax, 8(%rsp)
+	leaq	656(%rsp), %rsi
+	call	memcmp@PLT
+	movq	8(%rsp), %r11
+	testl	%eax, %eax
+	jne	.L32
+	addl	$1, 44(%rsp)
+.L33:
+	addq	$4, %r14
+	leaq	12+kernels(%rip), %rax
+	cmpq	%rax, %r14
+	jne	.L34
+	movl	20(%rsp), %esi
+	movl	40(%rsp), %r12d
+	movq	24(%rsp), %r8
+	movq	32(%rsp), %rcx
+	addl	$1, %esi
+	cmpl	$4000, %esi
+	jne	.L35
+	movl	44(%rsp), %edi
+	cmpl	$12000, %edi
+	jne	.L36
+	addl	$1, asserts_passed(%rip)
+.L20:
+	addq	$4760, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.cfi_restore_state
+	movb	$120, (%rdi)
+	addq	$1, %rdi
+	cmpq	%rcx, %rdi
+	jne	.L25
+	jmp	.L24
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	movl	16(%rsp), %esi
+	movq	%r13, %r8
+	movq	%r12, %rcx
+	movq	%r11, %rdx
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+	jmp	.L33
+.L36:
+	movslq	%edi, %rcx
+	movl	$12000, %r8d
+	movl	$68, %edx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC1(%rip), %rdi
+	addl	$1, asserts_failed(%rip)
+	call	printf@PLT
+	jmp	.L20
+	.cfi_endproc
+.LFE13:
+	.size	testScanEquivalence, .-testScanEquivalence
+	.p2align 4
+	.globl	wavefrontScanTest
+	.type	wavefrontScanTest, @function
+wavefrontScanTest:
+.LFB14:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	call	testScanKernel
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	jmp	testScanEquivalence
+	.cfi_endproc
+.LFE14:
+	.size	wavefrontScanTest, .-wavefrontScanTest
+	.section	.rodata
+	.align 8
+	.type	alphabet, @object
+	.size	alphabet, 8
+alphabet:
+	.string	"\n\r \ta"
+	.ascii	"\212\215"
+	.align 8
+	.type	kernels, @object
+	.size	kernels, 12
+kernels:
+	.long	0
+	.long	1
+	.long	2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC2:
+	.quad	3539883321446130763
+	.quad	3467824629006666253
+	.section	.note.GNU-stack,"",@progbits
@@ -1,10 +1,45 @@
-SOURCE= src/wavefront_material.c \
-	src/wavefront_material_parser.c
+SOURCE= src/wavefront_allocator.c \
+	src/wavefront_file.c \
+	src/wavefront_material.c \
+	src/wavefront_material_arrays.c \
+	src/wavefront_material_cache.c \
+	src/wavefront_material_compact.c \
+	src/wavefront_material_parser.c \
+	src/wavefront_material_writer.c \
+	src/wavefront_number.c \
+	src/wavefront_scan.c \
+	src/wavefront_thread.c
 TEST_SOURCE= \
 	src/test.c \
-	src/wavefront_material_parser_test.c
-LIBRARIES=-L../cutil/bin -lcutil
+	src/wavefront_allocator_test.c \
+	src/wavefront_material_test.c \
+	src/wavefront_material_arrays_test.c \
+	src/wavefront_material_cache_test.c \
+	src/wavefront_material_compact_test.c \
+	src/wavefront_material_parser_test.c \
+	src/wavefront_material_writer_test.c \
+	src/wavefront_number_test.c \
+	src/wavefront_scan_test.c
+BENCH_SOURCE= \
+	src/bench.c \
+	src/wavefront_material_bench.c \
+	src/wavefront_material_compact_bench.c \
+	src/wavefront_material_corpus_bench.c \
+	src/wavefront_material_parser_bench.c \
+	src/wavefront_material_writer_bench.c \
+	src/wavefront_number_bench.c \
+	src/wavefront_scan_bench.c
+LIBRARIES=-L../cutil/bin -lcutil -lpthread
 INCLUDES=-I../
+# Parser statistics cost a clock read per line, so are left out unless built
+# with make STATS=1 after a clean.
+ifeq ($(STATS),1)
+	DEFINES=-DWAVEFRONT_MTL_STATS
+endif
+
+# GNU ld can wrap malloc and friends so the benchmark counts allocations.
+BENCH_WRAP_CFLAGS=-DWAVEFRONT_BENCH_COUNT_ALLOCATIONS
+BENCH_WRAP_LIBRARIES=-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
 
 COVERAGE_CC=gcc
 ifeq ($(shell uname -s),Darwin)
@@ -12,7 +47,11 @@ ifeq ($(shell uname -s),Darwin)
 endif
 ifeq ($(shell uname -s),Linux)
 	CC=gcc
+	BENCH_CFLAGS=$(BENCH_WRAP_CFLAGS)
+	BENCH_LIBRARIES=$(BENCH_WRAP_LIBRARIES)
 endif
 ifeq ($(OS),Windows_NT)
 	CC=x86_64-w64-mingw32-gcc
+	BENCH_CFLAGS=$(BENCH_WRAP_CFLAGS)
+	BENCH_LIBRARIES=$(BENCH_WRAP_LIBRARIES)
 endif
\ No newline at end of file
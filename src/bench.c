@@ -0,0 +1,26 @@
+#include <stdio.h>
+#include <string.h>
+
+void wavefrontMaterialBench();
+void wavefrontMaterialCompactBench();
+void wavefrontMaterialCorpusBench(int json);
+void wavefrontMaterialParserBench();
+void wavefrontMaterialWriterBench();
+void wavefrontNumberBench();
+void wavefrontScanBench();
+
+// With --json only the corpus bench runs, printing one JSON object per line.
+int main(int argc, char **argv) {
+    if(argc > 1 && strcmp(argv[1], "--json") == 0) {
+        wavefrontMaterialCorpusBench(1);
+        return 0;
+    }
+    wavefrontMaterialCorpusBench(0);
+    wavefrontMaterialBench();
+    wavefrontMaterialCompactBench();
+    wavefrontMaterialParserBench();
+    wavefrontMaterialWriterBench();
+    wavefrontNumberBench();
+    wavefrontScanBench();
+    return 0;
+}
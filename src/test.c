@@ -3,10 +3,26 @@
 int asserts_passed = 0;
 int asserts_failed = 0;
 
+void wavefrontAllocatorTest();
+void wavefrontMaterialTest();
+void wavefrontMaterialArraysTest();
+void wavefrontMaterialCacheTest();
+void wavefrontMaterialCompactTest();
 void wavefrontMaterialParserTest();
+void wavefrontMaterialWriterTest();
+void wavefrontNumberTest();
+void wavefrontScanTest();
 
 int main() {
+    wavefrontAllocatorTest();
+    wavefrontMaterialTest();
+    wavefrontMaterialArraysTest();
+    wavefrontMaterialCacheTest();
+    wavefrontMaterialCompactTest();
     wavefrontMaterialParserTest();
+    wavefrontMaterialWriterTest();
+    wavefrontNumberTest();
+    wavefrontScanTest();
 
     printf("Asserts Passed: %d, Failed: %d\n",
         asserts_passed, asserts_failed);
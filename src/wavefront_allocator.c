@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include <string.h>
+#include "wavefront_allocator.h"
+
+static void *defaultAllocate(void *context, size_t size) {
+    return malloc(size);
+}
+
+static void *defaultReallocate(void *context, void *pointer, size_t size) {
+    return realloc(pointer, size);
+}
+
+static void defaultRelease(void *context, void *pointer) {
+    free(pointer);
+}
+
+static const struct WavefrontAllocator defaultAllocator = {
+    defaultAllocate, defaultReallocate, defaultRelease, NULL
+};
+static struct WavefrontAllocator allocator = {
+    defaultAllocate, defaultReallocate, defaultRelease, NULL
+};
+
+#ifdef WAVEFRONT_MTL_STATS
+static _Thread_local struct WavefrontAllocationStats *tracked = NULL;
+#define TRACK(size) do { \
+    if(tracked) { \
+        tracked->allocations++; \
+        tracked->bytes += (size); \
+    } \
+} while(0)
+#else
+#define TRACK(size) ((void)0)
+#endif
+
+void wavefrontSetAllocator(const struct WavefrontAllocator *replacement) {
+    allocator = replacement ? *replacement : defaultAllocator;
+}
+
+void *wavefrontAllocateWith(const struct WavefrontAllocator *with, size_t size) {
+    if(!with) with = &allocator;
+    TRACK(size);
+    return with->allocate(with->context, size);
+}
+
+void *wavefrontAllocateZeroedWith(const struct WavefrontAllocator *with, size_t count, size_t size) {
+    if(size && count > (size_t)-1 / size) return NULL;
+    void *pointer = wavefrontAllocateWith(with, count * size);
+    if(pointer) memset(pointer, 0, count * size);
+    return pointer;
+}
+
+void *wavefrontReallocateWith(const struct WavefrontAllocator *with, void *pointer, size_t size) {
+    if(!pointer) return wavefrontAllocateWith(with, size);
+    if(!with) with = &allocator;
+    TRACK(size);
+    return with->reallocate(with->context, pointer, size);
+}
+
+void wavefrontFreeWith(const struct WavefrontAllocator *with, void *pointer) {
+    if(!with) with = &allocator;
+    if(pointer) with->release(with->context, pointer);
+}
+
+void *wavefrontAllocate(size_t size) {
+    return wavefrontAllocateWith(NULL, size);
+}
+
+void *wavefrontAllocateZeroed(size_t count, size_t size) {
+    return wavefrontAllocateZeroedWith(NULL, count, size);
+}
+
+void *wavefrontReallocate(void *pointer, size_t size) {
+    return wavefrontReallocateWith(NULL, pointer, size);
+}
+
+void wavefrontFree(void *pointer) {
+    wavefrontFreeWith(NULL, pointer);
+}
+
+struct WavefrontAllocationStats *wavefrontTrackAllocations(struct WavefrontAllocationStats *stats) {
+#ifdef WAVEFRONT_MTL_STATS
+    struct WavefrontAllocationStats *previous = tracked;
+    tracked = stats;
+    return previous;
+#else
+    return NULL;
+#endif
+}
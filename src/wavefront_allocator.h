@@ -0,0 +1,47 @@
+#ifndef __WAVEFRONT_ALLOCATOR_H
+#define __WAVEFRONT_ALLOCATOR_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+
+// Callbacks receiving every allocation the library makes, each passed
+// context. reallocate is never given NULL and release is never given NULL.
+// Parses with a threadCount above 1 call them from several threads at once.
+struct WavefrontAllocator {
+    void *(*allocate)(void *context, size_t size);
+    void *(*reallocate)(void *context, void *pointer, size_t size);
+    void (*release)(void *context, void *pointer);
+    void *context;
+};
+
+struct WavefrontAllocationStats {
+    unsigned long long allocations; // Including reallocations.
+    unsigned long long bytes;       // Requested, not net of releases.
+};
+
+// Route library allocations through allocator, or back to malloc, realloc
+// and free when NULL. Memory must be released by the allocator that made it,
+// so this belongs before anything is allocated and is not thread safe.
+void wavefrontSetAllocator(const struct WavefrontAllocator *allocator);
+void *wavefrontAllocate(size_t size);
+// Allocate count zeroed elements of size bytes, like calloc.
+void *wavefrontAllocateZeroed(size_t count, size_t size);
+void *wavefrontReallocate(void *pointer, size_t size);
+void wavefrontFree(void *pointer);
+// As above through allocator, or the global allocator when NULL. Libraries
+// allocate with their own allocator this way.
+void *wavefrontAllocateWith(const struct WavefrontAllocator *allocator, size_t size);
+void *wavefrontAllocateZeroedWith(const struct WavefrontAllocator *allocator, size_t count, size_t size);
+void *wavefrontReallocateWith(const struct WavefrontAllocator *allocator, void *pointer, size_t size);
+void wavefrontFreeWith(const struct WavefrontAllocator *allocator, void *pointer);
+// Count allocations made on the calling thread into stats, or stop counting
+// when NULL, returning the stats counted into before. Counts nothing unless
+// built with WAVEFRONT_MTL_STATS.
+struct WavefrontAllocationStats *wavefrontTrackAllocations(struct WavefrontAllocationStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,308 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "wavefront_allocator.h"
+#include "wavefront_material_cache.h"
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+#include "cutil/src/assertion.h"
+
+// Heap use seen through the allocator, failing once limit allocations are
+// live when limit is set. Counts are guarded by heapLock for parallel parses.
+struct TrackingHeap {
+    int allocations;
+    int releases;
+    int live;
+    int limit;
+};
+
+static pthread_mutex_t heapLock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *trackingAllocate(void *context, size_t size) {
+    struct TrackingHeap *heap = context;
+    pthread_mutex_lock(&heapLock);
+    int full = heap->limit && heap->live == heap->limit;
+    if(!full) {
+        heap->allocations++;
+        heap->live++;
+    }
+    pthread_mutex_unlock(&heapLock);
+    return full ? NULL : malloc(size);
+}
+
+static void *trackingReallocate(void *context, void *pointer, size_t size) {
+    pthread_mutex_lock(&heapLock);
+    ((struct TrackingHeap*)context)->allocations++;
+    pthread_mutex_unlock(&heapLock);
+    return realloc(pointer, size);
+}
+
+static void trackingRelease(void *context, void *pointer) {
+    struct TrackingHeap *heap = context;
+    pthread_mutex_lock(&heapLock);
+    heap->releases++;
+    heap->live--;
+    pthread_mutex_unlock(&heapLock);
+    free(pointer);
+}
+
+static struct WavefrontAllocator trackingAllocator(struct TrackingHeap *heap) {
+    memset(heap, 0, sizeof(struct TrackingHeap));
+    struct WavefrontAllocator allocator = {
+        trackingAllocate, trackingReallocate, trackingRelease, heap
+    };
+    return allocator;
+}
+
+static void setTrackingAllocator(struct TrackingHeap *heap) {
+    struct WavefrontAllocator allocator = trackingAllocator(heap);
+    wavefrontSetAllocator(&allocator);
+}
+
+static const char allocatorInput[] =
+    "newmtl first\n"
+    "Kd 0.5\n"
+    "map_Kd first.png\n"
+    "newmtl second\n"
+    "map_Kd second.png\n"
+    "bump second.png\n";
+
+void testAllocatorRoutesParse() {
+    struct TrackingHeap heap;
+    setTrackingAllocator(&heap);
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, allocatorInput);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(heap.allocations > 0, 1);
+    assertIntegersEqual(heap.live > 0, 1);
+    wavefrontMTLRelease(&mtl);
+    // Everything allocated was returned to the same allocator.
+    assertIntegersEqual(heap.live, 0);
+    wavefrontSetAllocator(NULL);
+}
+
+void testAllocatorFailure() {
+    struct TrackingHeap heap;
+    setTrackingAllocator(&heap);
+    // Failing at each successive allocation leaves nothing behind.
+    for(int limit = 1; limit < 16; limit++) {
+        heap.limit = limit;
+        struct WavefrontMTL mtl;
+        int result = parseWavefrontMTLFromString(&mtl, allocatorInput);
+        if(result == STATUS_OK) wavefrontMTLRelease(&mtl);
+        else assertIntegersEqual(result, STATUS_ALLOC_ERR);
+        assertIntegersEqual(heap.live, 0);
+    }
+    wavefrontSetAllocator(NULL);
+}
+
+void testAllocateZeroed() {
+    unsigned char *bytes = wavefrontAllocateZeroed(16, 4);
+    assertIntegersEqual(bytes != NULL, 1);
+    for(int i = 0; bytes && i < 64; i++) assertIntegersEqual(bytes[i], 0);
+    wavefrontFree(bytes);
+    assertIntegersEqual(wavefrontAllocateZeroed((size_t)-1, 2) == NULL, 1);
+    // Reallocating NULL allocates and freeing NULL does nothing.
+    struct TrackingHeap heap;
+    setTrackingAllocator(&heap);
+    void *pointer = wavefrontReallocate(NULL, 8);
+    assertIntegersEqual(heap.allocations, 1);
+    wavefrontFree(pointer);
+    wavefrontFree(NULL);
+    assertIntegersEqual(heap.releases, 1);
+    wavefrontSetAllocator(NULL);
+}
+
+void testAllocatorPerLibrary() {
+    struct TrackingHeap global, local;
+    setTrackingAllocator(&global);
+    struct WavefrontAllocator allocator = trackingAllocator(&local);
+    struct WavefrontMTLOptions options = {0};
+    options.allocator = &allocator;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, allocatorInput, sizeof(allocatorInput) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.allocator == &allocator, 1);
+
+    // Libraries built from mtl keep to its allocator.
+    char changed[] = "newmtl second\nmap_Kd changed.png\nnewmtl third\n";
+    struct WavefrontMTLChanges changes;
+    result = wavefrontMTLReload(&mtl, changed, sizeof(changed) - 1, &changes);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(changes.addedCount, 1);
+    wavefrontMTLChangesRelease(&changes);
+    char *blob;
+    size_t length;
+    result = wavefrontMTLSerialize(&mtl, &blob, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    struct WavefrontMTL loaded;
+    result = wavefrontMTLDeserialize(&loaded, blob, length, &allocator);
+    assertIntegersEqual(result, STATUS_OK);
+    wavefrontFreeWith(&allocator, blob);
+    // Libraries with different allocators cannot share strings.
+    struct WavefrontMTL other;
+    parseWavefrontMTLFromString(&other, allocatorInput);
+    assertIntegersEqual(wavefrontMTLAppend(&mtl, &other), STATUS_INPUT_ERR);
+    wavefrontMTLRelease(&other);
+    wavefrontMTLRelease(&loaded);
+    wavefrontMTLRelease(&mtl);
+
+    struct WavefrontMTLIndex index;
+    result = wavefrontMTLIndexCompose(&index, allocatorInput, sizeof(allocatorInput) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    int material;
+    result = wavefrontMTLIndexFind(&index, "second", &material);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(material, 0);
+    wavefrontMTLIndexRelease(&index);
+
+    assertIntegersEqual(local.allocations > 0, 1);
+    assertIntegersEqual(local.live, 0);
+    // The global allocator only saw the library parsed without options.
+    assertIntegersEqual(global.live, 0);
+    assertIntegersEqual(global.allocations == global.releases, 1);
+    wavefrontSetAllocator(NULL);
+}
+
+void testAllocatorPerLibraryParallel() {
+    // Enough materials to split the input between threads.
+    size_t capacity = 1 << 20, length = 0;
+    char *input = malloc(capacity);
+    for(unsigned int i = 0; length + 64 < capacity; i++) {
+        length += snprintf(input + length, capacity - length,
+            "newmtl m%u\nKd 0.5 0.5 0.5\nmap_Kd shared.png\n", i % 5000);
+    }
+    struct TrackingHeap global, local;
+    setTrackingAllocator(&global);
+    struct WavefrontAllocator allocator = trackingAllocator(&local);
+    struct WavefrontMTLOptions options = {0};
+    options.allocator = &allocator;
+    options.threadCount = 4;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, length, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 5000);
+    wavefrontMTLRelease(&mtl);
+    assertIntegersEqual(local.live, 0);
+    assertIntegersEqual(global.allocations, 0);
+    wavefrontSetAllocator(NULL);
+    free(input);
+}
+
+// Whether mtl has the materials and textures of expected, in the same places.
+static int sameLibrary(const struct WavefrontMTL *mtl, const struct WavefrontMTL *expected) {
+    if(mtl->materialCount != expected->materialCount) return 0;
+    if(mtl->textureCount != expected->textureCount) return 0;
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        const char *name = expected->materials[i].name;
+        if(strcmp(mtl->materials[i].name, name) != 0) return 0;
+        if(wavefrontMTLFindMaterial(mtl, name) != (int)i) return 0;
+        if(!wavefrontMaterialEqual(mtl, mtl->materials + i, expected, expected->materials + i)) return 0;
+    }
+    for(unsigned int i = 0; i < mtl->textureCount; i++) {
+        if(strcmp(mtl->textures[i], expected->textures[i]) != 0) return 0;
+    }
+    return 1;
+}
+
+void testAllocatorUpdateFailure(unsigned int flags) {
+    struct TrackingHeap heap;
+    struct WavefrontAllocator allocator = trackingAllocator(&heap);
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    options.allocator = &allocator;
+    struct WavefrontMTL expected;
+    parseWavefrontMTLFromString(&expected, allocatorInput);
+    char after[] =
+        "newmtl second\n"
+        "map_Kd changed.png\n"
+        "bump second.png\n"
+        "newmtl third\n"
+        "map_Ks third.png\n"
+        "map_Ns -o 0.5 shininess.png\n";
+
+    // Failing at each successive allocation leaves the library as it was.
+    int result;
+    int extra = 0;
+    do {
+        struct WavefrontMTL mtl;
+        heap.limit = 0;
+        parseWavefrontMTLFromBuffer(&mtl, allocatorInput, sizeof(allocatorInput) - 1, &options);
+        heap.limit = heap.live + ++extra;
+        struct WavefrontMTLChanges changes;
+        result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+        heap.limit = 0;
+        if(result == STATUS_OK) {
+            assertIntegersEqual(changes.removedCount + changes.changedCount + changes.addedCount, 3);
+            assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "first"), -1);
+            assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "third"), 2);
+            assertStringsEqual(mtl.materials[1].diffuseMap.file, "changed.png");
+        } else {
+            assertIntegersEqual(result, STATUS_ALLOC_ERR);
+            assertIntegersEqual(changes.removedCount + changes.changedCount + changes.addedCount, 0);
+            assertIntegersEqual(sameLibrary(&mtl, &expected), 1);
+        }
+        wavefrontMTLChangesRelease(&changes);
+        wavefrontMTLRelease(&mtl);
+        assertIntegersEqual(heap.live, 0);
+    } while(result != STATUS_OK);
+    // Enough attempts to fail within the update as well as the parse.
+    assertIntegersEqual(extra > 10, 1);
+    wavefrontMTLRelease(&expected);
+}
+
+void testAllocatorMergeFailure(unsigned int flags) {
+    struct TrackingHeap heap;
+    struct WavefrontAllocator allocator = trackingAllocator(&heap);
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    options.allocator = &allocator;
+    struct WavefrontMTL expected, sources[2];
+    parseWavefrontMTLFromString(&expected, allocatorInput);
+    parseWavefrontMTLFromString(&sources[0], "newmtl first\nKd 0.5\nmap_Kd first.png\nnewmtl third\nmap_Ks third.png\n");
+    parseWavefrontMTLFromString(&sources[1], "newmtl second\nmap_Kd other.png\nnewmtl fourth\nbump -bm 2 fourth.png\n");
+
+    // Failing at each successive allocation leaves the library as it was.
+    int result;
+    int extra = 0;
+    do {
+        struct WavefrontMTL mtl;
+        heap.limit = 0;
+        parseWavefrontMTLFromBuffer(&mtl, allocatorInput, sizeof(allocatorInput) - 1, &options);
+        heap.limit = heap.live + ++extra;
+        struct WavefrontMTLRemap remap;
+        result = wavefrontMTLMerge(&mtl, sources, 2, &remap);
+        heap.limit = 0;
+        if(result == STATUS_OK) {
+            assertIntegersEqual(mtl.materialCount, 5);
+            assertIntegersEqual(remap.indices[0], 0);
+            assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "second.2"), 3);
+            assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "fourth"), 4);
+        } else {
+            assertIntegersEqual(result, STATUS_ALLOC_ERR);
+            assertIntegersEqual(remap.indices == NULL && remap.offsets == NULL, 1);
+            assertIntegersEqual(sameLibrary(&mtl, &expected), 1);
+        }
+        wavefrontMTLRemapRelease(&remap);
+        wavefrontMTLRelease(&mtl);
+        assertIntegersEqual(heap.live, 0);
+    } while(result != STATUS_OK);
+    // Past the merge's own buffers, and for separate strings past additions.
+    assertIntegersEqual(extra > (flags & WAVEFRONT_MTL_ARENA ? 4 : 8), 1);
+    wavefrontMTLRelease(&sources[1]);
+    wavefrontMTLRelease(&sources[0]);
+    wavefrontMTLRelease(&expected);
+}
+
+void wavefrontAllocatorTest() {
+    testAllocatorRoutesParse();
+    testAllocatorFailure();
+    testAllocateZeroed();
+    testAllocatorPerLibrary();
+    testAllocatorPerLibraryParallel();
+    testAllocatorUpdateFailure(0);
+    testAllocatorUpdateFailure(WAVEFRONT_MTL_ARENA);
+    testAllocatorMergeFailure(0);
+    testAllocatorMergeFailure(WAVEFRONT_MTL_ARENA);
+}
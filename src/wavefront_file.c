@@ -0,0 +1,90 @@
+#include "cutil/src/error.h"
+#include "wavefront_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+int wavefrontFileMap(struct WavefrontFileView *view, const char *path) {
+    view->data = NULL;
+    view->length = 0;
+    view->handle = NULL;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if(file == INVALID_HANDLE_VALUE) return STATUS_INPUT_ERR;
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return STATUS_INPUT_ERR;
+    }
+    // Empty files cannot be mapped, but are still valid input.
+    if(!size.QuadPart) {
+        CloseHandle(file);
+        view->data = "";
+        return STATUS_OK;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if(!mapping) return STATUS_INPUT_ERR;
+    view->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!view->data) {
+        CloseHandle(mapping);
+        return STATUS_INPUT_ERR;
+    }
+    view->length = (size_t)size.QuadPart;
+    view->handle = mapping;
+    return STATUS_OK;
+}
+
+void wavefrontFileUnmap(struct WavefrontFileView *view) {
+    if(view->handle) {
+        UnmapViewOfFile(view->data);
+        CloseHandle(view->handle);
+    }
+    view->data = NULL;
+    view->length = 0;
+    view->handle = NULL;
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int wavefrontFileMap(struct WavefrontFileView *view, const char *path) {
+    view->data = NULL;
+    view->length = 0;
+    view->handle = NULL;
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return STATUS_INPUT_ERR;
+    struct stat info;
+    if(fstat(fd, &info) || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return STATUS_INPUT_ERR;
+    }
+    // Empty files cannot be mapped, but are still valid input.
+    if(!info.st_size) {
+        close(fd);
+        view->data = "";
+        return STATUS_OK;
+    }
+    void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file.
+    close(fd);
+    if(data == MAP_FAILED) return STATUS_INPUT_ERR;
+    madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+    view->data = data;
+    view->length = (size_t)info.st_size;
+    view->handle = data;
+    return STATUS_OK;
+}
+
+void wavefrontFileUnmap(struct WavefrontFileView *view) {
+    if(view->handle) munmap(view->handle, view->length);
+    view->data = NULL;
+    view->length = 0;
+    view->handle = NULL;
+}
+#endif
@@ -0,0 +1,23 @@
+#ifndef __WAVEFRONT_FILE_H
+#define __WAVEFRONT_FILE_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+
+// Read only view of a whole file mapped into memory. The data is not NUL
+// terminated.
+struct WavefrontFileView {
+    const char *data;
+    size_t length;
+    void *handle; // Platform mapping handle, if any.
+};
+
+int wavefrontFileMap(struct WavefrontFileView *view, const char *path);
+void wavefrontFileUnmap(struct WavefrontFileView *view);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
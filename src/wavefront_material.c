@@ -1,57 +1,896 @@
+#include <stdio.h>
 #include <stdlib.h>
 #include "cutil/src/error.h"
 #include "cutil/src/string.h"
+#include "wavefront_allocator.h"
 #include "wavefront_material.h"
 
-int wavefrontMtlCompose(struct WavefrontMaterial *mtl) {
-    memset(mtl, 0, sizeof(struct WavefrontMaterial));
-    // NOTE: Does defaulting alpha to 1 seem more sane? 
+#define TABLE_MIN_SIZE 16
+#define MATERIAL_MIN_CAPACITY 8
+#define TEXTURE_MIN_CAPACITY 8
+#define MAP_OPTIONS_MIN_CAPACITY 8
+#define ARENA_CHUNK_SIZE 65536
+
+static const size_t mapOffsets[WAVEFRONT_MATERIAL_MAP_COUNT] = {
+    offsetof(struct WavefrontMaterial, ambientMap),
+    offsetof(struct WavefrontMaterial, diffuseMap),
+    offsetof(struct WavefrontMaterial, normalMap),
+    offsetof(struct WavefrontMaterial, specularColorMap),
+    offsetof(struct WavefrontMaterial, specularHighlightMap),
+    offsetof(struct WavefrontMaterial, alphaMap),
+    offsetof(struct WavefrontMaterial, bumpMap),
+    offsetof(struct WavefrontMaterial, displacementMap),
+    offsetof(struct WavefrontMaterial, decalMap),
+    offsetof(struct WavefrontMaterial, reflectionMapSphere),
+    offsetof(struct WavefrontMaterial, reflectionMapCubeTop),
+    offsetof(struct WavefrontMaterial, reflectionMapCubeBottom),
+    offsetof(struct WavefrontMaterial, reflectionMapCubeFront),
+    offsetof(struct WavefrontMaterial, reflectionMapCubeBack),
+    offsetof(struct WavefrontMaterial, reflectionMapCubeLeft),
+    offsetof(struct WavefrontMaterial, reflectionMapCubeRight),
+    offsetof(struct WavefrontMaterial, roughnessMap),
+    offsetof(struct WavefrontMaterial, metallicMap),
+    offsetof(struct WavefrontMaterial, sheenMap),
+    offsetof(struct WavefrontMaterial, emissionMap)
+};
+
+struct WavefrontArenaChunk {
+    struct WavefrontArenaChunk *next;
+    size_t size;
+    size_t used;
+    char data[];
+};
+
+// Options of every map without an entry in WavefrontMTL.mapOptions.
+static const struct WavefrontMapOptions defaultMapOptions = {
+    .scale = {1, 1, 1},
+    .bumpMultiplier = 1,
+    .gain = 1,
+    .flags = WAVEFRONT_MAP_BLENDU | WAVEFRONT_MAP_BLENDV
+};
+
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options) {
+    *options = defaultMapOptions;
+}
+
+int wavefrontMaterialCompose(struct WavefrontMaterial *m) {
+    // Maps start out with the default options.
+    memset(m, 0, sizeof(struct WavefrontMaterial));
+    // NOTE: Does defaulting alpha to 1 seem more sane?
+    return STATUS_OK;
+}
+
+// FNV-1a, continuing from hash.
+static unsigned int hashBytes(unsigned int hash, const void *data, size_t length) {
+    const unsigned char *bytes = data;
+    for(size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+unsigned int wavefrontMTLHashName(const char *name, size_t length) {
+    return hashBytes(2166136261u, name, length);
+}
+
+// Strings indexed by a table are found stride bytes apart from strings.
+static const char *tableString(const void *strings, size_t stride, unsigned int index) {
+    return *(char *const *)((const char*)strings + index * stride);
+}
+
+static void tableInsert(unsigned int *slots, unsigned int size, const char *string, size_t length, unsigned int index) {
+    unsigned int mask = size - 1;
+    unsigned int slot = wavefrontMTLHashName(string, length) & mask;
+    while(slots[slot]) slot = (slot + 1) & mask;
+    slots[slot] = index + 1;
+}
+
+// Fill a table with string index + 1 for each string. NULL strings, such as
+// removed materials, are left out.
+static void tableFill(
+    unsigned int *slots, unsigned int size,
+    const void *strings, size_t stride, unsigned int stringCount
+) {
+    memset(slots, 0, size * sizeof(unsigned int));
+    for(unsigned int i = 0; i < stringCount; i++) {
+        const char *string = tableString(strings, stride, i);
+        if(string) tableInsert(slots, size, string, strlen(string), i);
+    }
+}
+
+// Build a table of string index + 1 with newSize slots.
+static int tableBuild(
+    const struct WavefrontAllocator *allocator,
+    unsigned int **slots, unsigned int *size,
+    const void *strings, size_t stride, unsigned int stringCount,
+    unsigned int newSize
+) {
+    unsigned int *table = wavefrontAllocateWith(allocator, newSize * sizeof(unsigned int));
+    if(!table) return STATUS_ALLOC_ERR;
+    tableFill(table, newSize, strings, stride, stringCount);
+    wavefrontFreeWith(allocator, *slots);
+    *slots = table;
+    *size = newSize;
+    return STATUS_OK;
+}
+
+// Rebuild a table with room for count strings at half load.
+static int tableResize(
+    const struct WavefrontAllocator *allocator,
+    unsigned int **slots, unsigned int *size,
+    const void *strings, size_t stride, unsigned int stringCount,
+    unsigned int count
+) {
+    unsigned int newSize = *size ? *size : TABLE_MIN_SIZE;
+    while(newSize < count * 2) newSize *= 2;
+    if(newSize == *size) return STATUS_OK;
+    return tableBuild(allocator, slots, size, strings, stride, stringCount, newSize);
+}
+
+// Find the slot holding string, or the empty slot where it belongs.
+static unsigned int tableProbe(
+    const unsigned int *slots, unsigned int size,
+    const void *strings, size_t stride,
+    const char *string, size_t length
+) {
+    unsigned int mask = size - 1;
+    unsigned int slot = wavefrontMTLHashName(string, length) & mask;
+    for(; slots[slot]; slot = (slot + 1) & mask) {
+        const char *other = tableString(strings, stride, slots[slot] - 1);
+        if(strncmp(string, other, length) == 0 && other[length] == '\0') break;
+    }
+    return slot;
+}
+
+static int tableFind(
+    const unsigned int *slots, unsigned int size,
+    const void *strings, size_t stride,
+    const char *string, size_t length
+) {
+    if(!size) return -1;
+    unsigned int slot = tableProbe(slots, size, strings, stride, string, length);
+    return (int)slots[slot] - 1;
+}
+
+static int materialTableResize(struct WavefrontMTL *mtl, unsigned int count) {
+    return tableResize(mtl->allocator, &mtl->materialTable, &mtl->materialTableSize,
+        mtl->materials, sizeof(struct WavefrontMaterial), mtl->materialCount, count);
+}
+
+static int materialsResize(struct WavefrontMTL *mtl, unsigned int capacity) {
+    struct WavefrontMaterial *temp = NULL;
+    if(capacity) {
+        temp = (struct WavefrontMaterial*)wavefrontReallocateWith(
+            mtl->allocator, mtl->materials,
+            capacity * sizeof(struct WavefrontMaterial));
+        if(!temp) return STATUS_ALLOC_ERR;
+    } else {
+        wavefrontFreeWith(mtl->allocator, mtl->materials);
+    }
+    mtl->materials = temp;
+    mtl->materialCapacity = capacity;
     return STATUS_OK;
 }
 
+static void *arenaAllocate(struct WavefrontMTL *mtl, size_t size) {
+    struct WavefrontArenaChunk *chunk = mtl->arena;
+    if(chunk && chunk->size - chunk->used >= size) {
+        void *result = chunk->data + chunk->used;
+        chunk->used += size;
+        return result;
+    }
+    // Large allocations get a chunk of their own behind the current one.
+    int dedicated = chunk && size > ARENA_CHUNK_SIZE / 4;
+    size_t chunkSize = dedicated || size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+    struct WavefrontArenaChunk *temp = wavefrontAllocateWith(mtl->allocator, sizeof(struct WavefrontArenaChunk) + chunkSize);
+    if(!temp) return NULL;
+    temp->size = chunkSize;
+    temp->used = size;
+    if(dedicated) {
+        temp->next = chunk->next;
+        chunk->next = temp;
+    } else {
+        temp->next = chunk;
+        mtl->arena = temp;
+    }
+    return temp->data;
+}
+
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length) {
+    char *result = mtl->flags & WAVEFRONT_MTL_ARENA ?
+        arenaAllocate(mtl, length + 1) : wavefrontAllocateWith(mtl->allocator, length + 1);
+    if(result) {
+        memcpy(result, string, length);
+        result[length] = '\0';
+    }
+    return result;
+}
+
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string) {
+    // Arena strings live until the WavefrontMTL is released.
+    if(!(mtl->flags & WAVEFRONT_MTL_ARENA)) wavefrontFreeWith(mtl->allocator, string);
+}
+
+void wavefrontMTLCompose(struct WavefrontMTL *mtl) {
+    mtl->materials = NULL;
+    mtl->materialCount = 0;
+    mtl->materialCapacity = 0;
+    mtl->materialTable = NULL;
+    mtl->materialTableSize = 0;
+    mtl->textures = NULL;
+    mtl->textureCount = 0;
+    mtl->textureCapacity = 0;
+    mtl->textureTable = NULL;
+    mtl->textureTableSize = 0;
+    mtl->mapOptions = NULL;
+    mtl->mapOptionCount = 0;
+    mtl->mapOptionCapacity = 0;
+    mtl->mapOptionTable = NULL;
+    mtl->mapOptionTableSize = 0;
+    mtl->flags = 0;
+    mtl->arena = NULL;
+    mtl->allocator = NULL;
+}
+
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index) {
+    return (struct WavefrontMap*)((char*)m + mapOffsets[index]);
+}
+
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length) {
+    return tableFind(mtl->materialTable, mtl->materialTableSize,
+        mtl->materials, sizeof(struct WavefrontMaterial), name, length);
+}
+
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name) {
+    return wavefrontMTLFindMaterialN(mtl, name, strlen(name));
+}
+
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count) {
+    if(materialTableResize(mtl, count)) return STATUS_ALLOC_ERR;
+    if(count <= mtl->materialCapacity) return STATUS_OK;
+    return materialsResize(mtl, count);
+}
+
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl) {
+    if(mtl->materialCount == mtl->materialCapacity) return STATUS_OK;
+    return materialsResize(mtl, mtl->materialCount);
+}
+
 int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name) {
     // Reuse existing material with same name.
-    for (unsigned int i = 0; i < mtl->materialCount; i++) {
-        if (strcmp(name, mtl->materials[i].name) == 0) {
-            return i;
-        }
-    }
-    // Create new material.
-    struct WavefrontMaterial *temp = (struct WavefrontMaterial*)realloc(
-        mtl->materials,
-        (mtl->materialCount+1) * sizeof(struct WavefrontMaterial));
-    int result = STATUS_ALLOC_ERR;
-    if(temp) {
-        mtl->materials = temp;
-        struct WavefrontMaterial *m = mtl->materialCount++ + mtl->materials;
-        result = wavefrontMtlCompose(m);
-        m->name = name;
+    size_t length = strlen(name);
+    int index = wavefrontMTLFindMaterialN(mtl, name, length);
+    if(index >= 0) return index;
+
+    // Create new material, growing storage geometrically.
+    if(mtl->materialCount == mtl->materialCapacity) {
+        unsigned int capacity = mtl->materialCapacity ?
+            mtl->materialCapacity * 2 : MATERIAL_MIN_CAPACITY;
+        if(materialsResize(mtl, capacity)) return STATUS_ALLOC_ERR;
     }
+    if(materialTableResize(mtl, mtl->materialCount + 1)) return STATUS_ALLOC_ERR;
+    tableInsert(mtl->materialTable, mtl->materialTableSize, name, length, mtl->materialCount);
+
+    struct WavefrontMaterial *m = mtl->materialCount++ + mtl->materials;
+    int result = wavefrontMaterialCompose(m);
+    m->name = name;
     return result;
 }
 
-void wavefrontMTLRelease(struct WavefrontMTL *mtl) {
-    for(unsigned int i = 0; i < mtl->materialCount; i++) {
-        struct WavefrontMaterial *m = mtl->materials + i;
-        free(m->name);
-        free(m->ambientMap.file);
-        free(m->diffuseMap.file);
-        free(m->normalMap.file);
-        free(m->specularColorMap.file);
-        free(m->specularHighlightMap.file);
-        free(m->alphaMap.file);
-        free(m->bumpMap.file);
-        free(m->displacementMap.file);
-        free(m->decalMap.file);
-
-        free(m->reflectionMapSphere.file);
-        free(m->reflectionMapCubeTop.file);
-        free(m->reflectionMapCubeBottom.file);
-        free(m->reflectionMapCubeFront.file);
-        free(m->reflectionMapCubeBack.file);
-        free(m->reflectionMapCubeLeft.file);
-        free(m->reflectionMapCubeRight.file);
-    }
-    free(mtl->materials);
+static int texturesReserve(struct WavefrontMTL *mtl, unsigned int count) {
+    if(count > mtl->textureCapacity) {
+        unsigned int capacity = mtl->textureCapacity ?
+            mtl->textureCapacity * 2 : TEXTURE_MIN_CAPACITY;
+        if(capacity < count) capacity = count;
+        char **temp = wavefrontReallocateWith(mtl->allocator, mtl->textures, capacity * sizeof(char*));
+        if(!temp) return STATUS_ALLOC_ERR;
+        mtl->textures = temp;
+        mtl->textureCapacity = capacity;
+    }
+    return tableResize(mtl->allocator, &mtl->textureTable, &mtl->textureTableSize,
+        mtl->textures, sizeof(char*), mtl->textureCount, count);
+}
+
+// Append an owned file to the texture list, which must have room for it.
+static unsigned int textureAppend(struct WavefrontMTL *mtl, char *file, size_t length) {
+    tableInsert(mtl->textureTable, mtl->textureTableSize, file, length, mtl->textureCount);
+    mtl->textures[mtl->textureCount++] = file;
+    return mtl->textureCount;
+}
+
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture) {
+    int index = tableFind(mtl->textureTable, mtl->textureTableSize,
+        mtl->textures, sizeof(char*), file, length);
+    if(index >= 0) {
+        *texture = index + 1;
+        return STATUS_OK;
+    }
+
+    if(texturesReserve(mtl, mtl->textureCount + 1)) return STATUS_ALLOC_ERR;
+    char *copy = wavefrontMTLCopyString(mtl, file, length);
+    if(!copy) return STATUS_ALLOC_ERR;
+    *texture = textureAppend(mtl, copy, length);
+    return STATUS_OK;
+}
+
+// Find the slot holding options, or the empty slot where they belong.
+static unsigned int mapOptionsProbe(const struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options) {
+    unsigned int mask = mtl->mapOptionTableSize - 1;
+    unsigned int slot = hashBytes(2166136261u, options, sizeof(struct WavefrontMapOptions)) & mask;
+    for(; mtl->mapOptionTable[slot]; slot = (slot + 1) & mask) {
+        const struct WavefrontMapOptions *other = mtl->mapOptions + mtl->mapOptionTable[slot] - 1;
+        if(memcmp(options, other, sizeof(struct WavefrontMapOptions)) == 0) break;
+    }
+    return slot;
+}
+
+// Refill the map option table from the list.
+static void mapOptionsFill(struct WavefrontMTL *mtl) {
+    memset(mtl->mapOptionTable, 0, mtl->mapOptionTableSize * sizeof(unsigned int));
+    for(unsigned int i = 0; i < mtl->mapOptionCount; i++) {
+        mtl->mapOptionTable[mapOptionsProbe(mtl, mtl->mapOptions + i)] = i + 1;
+    }
+}
+
+static int mapOptionsReserve(struct WavefrontMTL *mtl, unsigned int count) {
+    if(count > mtl->mapOptionCapacity) {
+        unsigned int capacity = mtl->mapOptionCapacity ?
+            mtl->mapOptionCapacity * 2 : MAP_OPTIONS_MIN_CAPACITY;
+        if(capacity < count) capacity = count;
+        struct WavefrontMapOptions *temp = wavefrontReallocateWith(mtl->allocator, mtl->mapOptions,
+            capacity * sizeof(struct WavefrontMapOptions));
+        if(!temp) return STATUS_ALLOC_ERR;
+        mtl->mapOptions = temp;
+        mtl->mapOptionCapacity = capacity;
+    }
+    // Keep the table at most half full.
+    unsigned int size = mtl->mapOptionTableSize ? mtl->mapOptionTableSize : TABLE_MIN_SIZE;
+    while(size < count * 2) size *= 2;
+    if(size == mtl->mapOptionTableSize) return STATUS_OK;
+    unsigned int *table = wavefrontAllocateWith(mtl->allocator, size * sizeof(unsigned int));
+    if(!table) return STATUS_ALLOC_ERR;
+    wavefrontFreeWith(mtl->allocator, mtl->mapOptionTable);
+    mtl->mapOptionTable = table;
+    mtl->mapOptionTableSize = size;
+    mapOptionsFill(mtl);
+    return STATUS_OK;
+}
+
+// Append options to the list, which must have room for them.
+static unsigned int mapOptionsAppend(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options) {
+    unsigned int slot = mapOptionsProbe(mtl, options);
+    if(!mtl->mapOptionTable[slot]) {
+        mtl->mapOptions[mtl->mapOptionCount] = *options;
+        mtl->mapOptionTable[slot] = ++mtl->mapOptionCount;
+    }
+    return mtl->mapOptionTable[slot];
+}
+
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index) {
+    *index = 0;
+    if(memcmp(options, &defaultMapOptions, sizeof(struct WavefrontMapOptions)) == 0) return STATUS_OK;
+    if(mtl->mapOptionTableSize) {
+        unsigned int slot = mapOptionsProbe(mtl, options);
+        if(mtl->mapOptionTable[slot]) {
+            *index = mtl->mapOptionTable[slot];
+            return STATUS_OK;
+        }
+    }
+    if(mapOptionsReserve(mtl, mtl->mapOptionCount + 1)) return STATUS_ALLOC_ERR;
+    *index = mapOptionsAppend(mtl, options);
+    return STATUS_OK;
+}
+
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map) {
+    return map->options ? mtl->mapOptions + map->options - 1 : &defaultMapOptions;
+}
+
+static void wavefrontMaterialRelease(struct WavefrontMTL *mtl, struct WavefrontMaterial *m) {
+    wavefrontFreeWith(mtl->allocator, m->name);
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+        // Interned files are released with the texture list.
+        if(!map->texture) wavefrontFreeWith(mtl->allocator, map->file);
+    }
+}
+
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other) {
+    if(mtl->flags != other->flags || mtl->allocator != other->allocator) return STATUS_INPUT_ERR;
+
+    // An empty library takes over storage wholesale.
+    if(!mtl->materialCount && !mtl->textureCount && !mtl->mapOptionCount && !mtl->arena &&
+        other->materialCapacity >= mtl->materialCapacity) {
+        wavefrontFreeWith(mtl->allocator, mtl->materials);
+        wavefrontFreeWith(mtl->allocator, mtl->materialTable);
+        wavefrontFreeWith(mtl->allocator, mtl->textures);
+        wavefrontFreeWith(mtl->allocator, mtl->textureTable);
+        wavefrontFreeWith(mtl->allocator, mtl->mapOptions);
+        wavefrontFreeWith(mtl->allocator, mtl->mapOptionTable);
+        *mtl = *other;
+        wavefrontMTLCompose(other);
+        other->flags = mtl->flags;
+        other->allocator = mtl->allocator;
+        return STATUS_OK;
+    }
+
+    // Allocate everything up front so nothing is left half moved.
+    unsigned int count = mtl->materialCount + other->materialCount;
+    if(count > mtl->materialCapacity) {
+        unsigned int capacity = mtl->materialCapacity * 2;
+        if(materialsResize(mtl, capacity > count ? capacity : count)) return STATUS_ALLOC_ERR;
+    }
+    if(materialTableResize(mtl, count)) return STATUS_ALLOC_ERR;
+    if(texturesReserve(mtl, mtl->textureCount + other->textureCount)) return STATUS_ALLOC_ERR;
+    if(mapOptionsReserve(mtl, mtl->mapOptionCount + other->mapOptionCount)) return STATUS_ALLOC_ERR;
+    unsigned int *remap = wavefrontAllocateZeroedWith(mtl->allocator, other->textureCount + 1, sizeof(unsigned int));
+    unsigned int *optionRemap = wavefrontAllocateZeroedWith(mtl->allocator, other->mapOptionCount + 1, sizeof(unsigned int));
+    if(!remap || !optionRemap) {
+        wavefrontFreeWith(mtl->allocator, remap);
+        wavefrontFreeWith(mtl->allocator, optionRemap);
+        return STATUS_ALLOC_ERR;
+    }
+
+    // Strings are moved rather than copied, arena chunks included.
+    if(other->arena) {
+        struct WavefrontArenaChunk *last = other->arena;
+        while(last->next) last = last->next;
+        if(mtl->arena) {
+            last->next = mtl->arena->next;
+            mtl->arena->next = other->arena;
+        } else {
+            mtl->arena = other->arena;
+        }
+        other->arena = NULL;
+    }
+    int arena = mtl->flags & WAVEFRONT_MTL_ARENA;
+
+    // Only textures and options of the materials moved are kept, marked in
+    // the remaps first.
+    for(unsigned int i = 0; i < other->materialCount; i++) {
+        struct WavefrontMaterial *m = other->materials + i;
+        if(!m->name || wavefrontMTLFindMaterial(mtl, m->name) >= 0) continue;
+        for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+            remap[wavefrontMaterialMap(m, j)->texture] = 1;
+            optionRemap[wavefrontMaterialMap(m, j)->options] = 1;
+        }
+    }
+    remap[0] = 0;
+    optionRemap[0] = 0;
+    for(unsigned int i = 0; i < other->mapOptionCount; i++) {
+        if(optionRemap[i + 1]) optionRemap[i + 1] = mapOptionsAppend(mtl, other->mapOptions + i);
+    }
+    for(unsigned int i = 0; i < other->textureCount; i++) {
+        char *file = other->textures[i];
+        if(!remap[i + 1]) {
+            if(!arena) wavefrontFreeWith(mtl->allocator, file);
+            continue;
+        }
+        size_t length = strlen(file);
+        int index = tableFind(mtl->textureTable, mtl->textureTableSize,
+            mtl->textures, sizeof(char*), file, length);
+        if(index >= 0) {
+            remap[i + 1] = index + 1;
+            if(!arena) wavefrontFreeWith(mtl->allocator, file);
+        } else {
+            remap[i + 1] = textureAppend(mtl, file, length);
+        }
+    }
+
+    for(unsigned int i = 0; i < other->materialCount; i++) {
+        struct WavefrontMaterial *m = other->materials + i;
+        if(!m->name) continue;
+        // Existing materials take precedence, as with wavefrontMTLAddMaterial.
+        unsigned int slot = tableProbe(mtl->materialTable, mtl->materialTableSize,
+            mtl->materials, sizeof(struct WavefrontMaterial), m->name, strlen(m->name));
+        if(mtl->materialTable[slot]) {
+            if(!arena) wavefrontMaterialRelease(mtl, m);
+            continue;
+        }
+        for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+            struct WavefrontMap *map = wavefrontMaterialMap(m, j);
+            map->options = optionRemap[map->options];
+            if(!map->texture) continue;
+            map->texture = remap[map->texture];
+            map->file = mtl->textures[map->texture - 1];
+        }
+        mtl->materials[mtl->materialCount++] = *m;
+        mtl->materialTable[slot] = mtl->materialCount;
+    }
+    wavefrontFreeWith(mtl->allocator, remap);
+    wavefrontFreeWith(mtl->allocator, optionRemap);
+
+    wavefrontFreeWith(mtl->allocator, other->materials);
+    wavefrontFreeWith(mtl->allocator, other->materialTable);
+    wavefrontFreeWith(mtl->allocator, other->textures);
+    wavefrontFreeWith(mtl->allocator, other->textureTable);
+    wavefrontFreeWith(mtl->allocator, other->mapOptions);
+    wavefrontFreeWith(mtl->allocator, other->mapOptionTable);
+    wavefrontMTLCompose(other);
+    other->flags = mtl->flags;
+    other->allocator = mtl->allocator;
+    return STATUS_OK;
+}
+
+static int stringsEqual(const char *a, const char *b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b
+) {
+    // Colors and scalars are compared bitwise.
+    size_t begin = offsetof(struct WavefrontMaterial, ambient);
+    size_t end = offsetof(struct WavefrontMaterial, illuminationModel) + sizeof(int);
+    if(memcmp((const char*)a + begin, (const char*)b + begin, end - begin) != 0) return 0;
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        const struct WavefrontMap *mapA = (const struct WavefrontMap*)((const char*)a + mapOffsets[i]);
+        const struct WavefrontMap *mapB = (const struct WavefrontMap*)((const char*)b + mapOffsets[i]);
+        if(!stringsEqual(mapA->file, mapB->file)) return 0;
+        // Options are unique within a library.
+        if(x == y ? mapA->options != mapB->options :
+            memcmp(wavefrontMTLMapOptions(x, mapA), wavefrontMTLMapOptions(y, mapB),
+                sizeof(struct WavefrontMapOptions)) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m) {
+    // Covers what wavefrontMaterialEqual compares, less maps without a file.
+    size_t begin = offsetof(struct WavefrontMaterial, ambient);
+    size_t end = offsetof(struct WavefrontMaterial, illuminationModel) + sizeof(int);
+    unsigned int hash = hashBytes(2166136261u, (const char*)m + begin, end - begin);
+    for(unsigned char i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        const struct WavefrontMap *map = (const struct WavefrontMap*)((const char*)m + mapOffsets[i]);
+        if(!map->file) continue;
+        hash = hashBytes(hash, &i, 1);
+        hash = hashBytes(hash, map->file, strlen(map->file) + 1);
+        hash = hashBytes(hash, wavefrontMTLMapOptions(mtl, map), sizeof(struct WavefrontMapOptions));
+    }
+    return hash;
+}
+
+// Copy the properties of source from library from into m, with strings and
+// map options copied into mtl and no name. After a failure m holds the files
+// copied so far.
+static int materialCopy(
+    struct WavefrontMTL *mtl,
+    struct WavefrontMaterial *m,
+    const struct WavefrontMTL *from,
+    const struct WavefrontMaterial *source
+) {
+    *m = *source;
+    m->name = NULL;
+
+    int result = STATUS_OK;
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+        if(map->options && !result) {
+            result = wavefrontMTLInternMapOptions(mtl, wavefrontMTLMapOptions(from, map), &map->options);
+        }
+        if(result) map->options = 0;
+        const char *file = map->file;
+        // After a failure drop the remaining files rather than share them.
+        map->file = NULL;
+        if(!file || result) {
+            map->texture = 0;
+        } else if(map->texture) {
+            result = wavefrontMTLInternTexture(mtl, file, strlen(file), &map->texture);
+            if(!result) map->file = mtl->textures[map->texture - 1];
+        } else {
+            map->file = wavefrontMTLCopyString(mtl, file, strlen(file));
+            if(!map->file) result = STATUS_ALLOC_ERR;
+        }
+        if(!map->file) map->texture = 0;
+    }
+    return result;
+}
+
+// Replace the properties of m with those of source from library from,
+// copying strings and map options into mtl. The name of m is kept.
+static int materialAssign(
+    struct WavefrontMTL *mtl,
+    struct WavefrontMaterial *m,
+    const struct WavefrontMTL *from,
+    const struct WavefrontMaterial *source
+) {
+    char *name = m->name;
+    m->name = NULL;
+    if(!(mtl->flags & WAVEFRONT_MTL_ARENA)) wavefrontMaterialRelease(mtl, m);
+    int result = materialCopy(mtl, m, from, source);
+    m->name = name;
+    return result;
+}
+
+// Drop the materials, textures and map options added since mtl had
+// materialCount, textureCount and mapOptionCount, undoing a failed update or
+// merge.
+static void mtlTruncate(
+    struct WavefrontMTL *mtl,
+    unsigned int materialCount,
+    unsigned int textureCount,
+    unsigned int mapOptionCount
+) {
+    if(!(mtl->flags & WAVEFRONT_MTL_ARENA)) {
+        for(unsigned int i = materialCount; i < mtl->materialCount; i++) {
+            wavefrontMaterialRelease(mtl, mtl->materials + i);
+        }
+        for(unsigned int i = textureCount; i < mtl->textureCount; i++) {
+            wavefrontFreeWith(mtl->allocator, mtl->textures[i]);
+        }
+    }
+    if(materialCount < mtl->materialCount) {
+        mtl->materialCount = materialCount;
+        tableFill(mtl->materialTable, mtl->materialTableSize,
+            mtl->materials, sizeof(struct WavefrontMaterial), materialCount);
+    }
+    if(textureCount < mtl->textureCount) {
+        mtl->textureCount = textureCount;
+        tableFill(mtl->textureTable, mtl->textureTableSize, mtl->textures, sizeof(char*), textureCount);
+    }
+    if(mapOptionCount < mtl->mapOptionCount) {
+        mtl->mapOptionCount = mapOptionCount;
+        mapOptionsFill(mtl);
+    }
+}
+
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes) {
+    struct WavefrontMTLChanges local;
+    if(!changes) changes = &local;
+    memset(changes, 0, sizeof(struct WavefrontMTLChanges));
+    changes->allocator = mtl->allocator;
+
+    // Index in next of each material of mtl, -1 if removed and -2 for slots
+    // emptied by earlier updates, and whether each material of next is
+    // matched (1) or matched with different properties (2).
+    unsigned int count = mtl->materialCount;
+    int *matches = wavefrontAllocateWith(mtl->allocator, (count + 1) * sizeof(int));
+    unsigned char *matched = wavefrontAllocateZeroedWith(mtl->allocator, next->materialCount + 1, 1);
+    if(!matches || !matched) {
+        wavefrontFreeWith(mtl->allocator, matches);
+        wavefrontFreeWith(mtl->allocator, matched);
+        return STATUS_ALLOC_ERR;
+    }
+    unsigned int empty = 0, removed = 0, changed = 0, added = 0;
+    for(unsigned int i = 0; i < count; i++) {
+        const struct WavefrontMaterial *m = mtl->materials + i;
+        int j = m->name ? wavefrontMTLFindMaterial(next, m->name) : -2;
+        matches[i] = j;
+        if(j == -2) {
+            empty++;
+        } else if(j < 0) {
+            removed++;
+        } else if(wavefrontMaterialEqual(mtl, m, next, next->materials + j)) {
+            matched[j] = 1;
+        } else {
+            matched[j] = 2;
+            changed++;
+        }
+    }
+    for(unsigned int j = 0; j < next->materialCount; j++) {
+        if(!matched[j] && next->materials[j].name) added++;
+    }
+
+    // Allocate everything and copy changed and new materials aside first, so
+    // a failure leaves mtl as it was. New materials take the empty slots
+    // before the library grows.
+    unsigned int textureCount = mtl->textureCount;
+    unsigned int mapOptionCount = mtl->mapOptionCount;
+    unsigned int staged = 0;
+    struct WavefrontMaterial *copies = wavefrontAllocateWith(mtl->allocator,
+        (changed + added + 1) * sizeof(struct WavefrontMaterial));
+    changes->added = wavefrontAllocateWith(mtl->allocator, (added + 1) * sizeof(unsigned int));
+    changes->removed = wavefrontAllocateWith(mtl->allocator, (removed + 1) * sizeof(unsigned int));
+    changes->changed = wavefrontAllocateWith(mtl->allocator, (changed + 1) * sizeof(unsigned int));
+    int result = copies && changes->added && changes->removed && changes->changed ?
+        STATUS_OK : STATUS_ALLOC_ERR;
+    if(!result) result = wavefrontMTLReserve(mtl, count + (added > empty ? added - empty : 0));
+    for(unsigned int i = 0; i < count && !result; i++) {
+        if(matches[i] < 0 || matched[matches[i]] != 2) continue;
+        result = materialCopy(mtl, copies + staged++, next, next->materials + matches[i]);
+    }
+    for(unsigned int j = 0; j < next->materialCount && !result; j++) {
+        const char *name = next->materials[j].name;
+        if(matched[j] || !name) continue;
+        struct WavefrontMaterial *m = copies + staged++;
+        result = materialCopy(mtl, m, next, next->materials + j);
+        if(!result) {
+            m->name = wavefrontMTLCopyString(mtl, name, strlen(name));
+            if(!m->name) result = STATUS_ALLOC_ERR;
+        }
+    }
+
+    if(result) {
+        if(!(mtl->flags & WAVEFRONT_MTL_ARENA)) {
+            for(unsigned int i = 0; i < staged; i++) wavefrontMaterialRelease(mtl, copies + i);
+        }
+        mtlTruncate(mtl, count, textureCount, mapOptionCount);
+        wavefrontMTLChangesRelease(changes);
+    } else {
+        // Nothing below fails.
+        staged = 0;
+        for(unsigned int i = 0; i < count; i++) {
+            struct WavefrontMaterial *m = mtl->materials + i;
+            int j = matches[i];
+            if(j == -2 || (j >= 0 && matched[j] == 1)) continue;
+            char *name = m->name;
+            if(j >= 0) m->name = NULL;
+            if(!(mtl->flags & WAVEFRONT_MTL_ARENA)) wavefrontMaterialRelease(mtl, m);
+            if(j < 0) {
+                // Removed materials keep their slot so later indices hold.
+                wavefrontMaterialCompose(m);
+                changes->removed[changes->removedCount++] = i;
+            } else {
+                *m = copies[staged++];
+                m->name = name;
+                changes->changed[changes->changedCount++] = i;
+            }
+        }
+        unsigned int slot = 0;
+        for(unsigned int k = 0; k < added; k++) {
+            while(slot < count && matches[slot] != -2) slot++;
+            unsigned int index = slot < count ? slot++ : mtl->materialCount++;
+            mtl->materials[index] = copies[staged++];
+            changes->added[changes->addedCount++] = index;
+        }
+        if(removed || added) {
+            tableFill(mtl->materialTable, mtl->materialTableSize,
+                mtl->materials, sizeof(struct WavefrontMaterial), mtl->materialCount);
+        }
+    }
+    wavefrontFreeWith(mtl->allocator, copies);
+    wavefrontFreeWith(mtl->allocator, matches);
+    wavefrontFreeWith(mtl->allocator, matched);
+    if(changes == &local) wavefrontMTLChangesRelease(&local);
+    return result;
+}
+
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes) {
+    wavefrontFreeWith(changes->allocator, changes->added);
+    wavefrontFreeWith(changes->allocator, changes->removed);
+    wavefrontFreeWith(changes->allocator, changes->changed);
+    memset(changes, 0, sizeof(struct WavefrontMTLChanges));
+}
+
+// Add a material called name, or name.N for the first free N from suffix up
+// when name is taken, and return its index through index.
+static int addUniqueMaterial(struct WavefrontMTL *mtl, const char *name, unsigned int suffix, unsigned int *index) {
+    size_t length = strlen(name);
+    char *copy = NULL;
+    if(wavefrontMTLFindMaterialN(mtl, name, length) < 0) {
+        copy = wavefrontMTLCopyString(mtl, name, length);
+    } else {
+        // Room for a dot, ten digits and the terminator.
+        char *candidate = wavefrontAllocateWith(mtl->allocator, length + 12);
+        if(!candidate) return STATUS_ALLOC_ERR;
+        memcpy(candidate, name, length);
+        size_t candidateLength;
+        do {
+            candidateLength = length + snprintf(candidate + length, 12, ".%u", suffix++);
+        } while(wavefrontMTLFindMaterialN(mtl, candidate, candidateLength) >= 0);
+        copy = wavefrontMTLCopyString(mtl, candidate, candidateLength);
+        wavefrontFreeWith(mtl->allocator, candidate);
+    }
+    if(!copy) return STATUS_ALLOC_ERR;
+    int result = wavefrontMTLAddMaterial(mtl, copy);
+    if(result) {
+        wavefrontMTLFreeString(mtl, copy);
+        return result;
+    }
+    *index = mtl->materialCount - 1;
+    return STATUS_OK;
 }
 
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap
+) {
+    memset(remap, 0, sizeof(struct WavefrontMTLRemap));
+    remap->allocator = mtl->allocator;
+    // Additions go at the end of mtl and are dropped again on failure.
+    unsigned int materialCount = mtl->materialCount;
+    unsigned int textureCount = mtl->textureCount;
+    unsigned int mapOptionCount = mtl->mapOptionCount;
+    unsigned int total = 0;
+    for(unsigned int s = 0; s < sourceCount; s++) total += sources[s].materialCount;
+
+    // Materials of mtl by content, at half load once every source is added.
+    unsigned int capacity = mtl->materialCount + total;
+    unsigned int size = TABLE_MIN_SIZE;
+    while(size < capacity * 2) size *= 2;
+    unsigned int mask = size - 1;
+    unsigned int *slots = wavefrontAllocateZeroedWith(mtl->allocator, size, sizeof(unsigned int));
+    unsigned int *hashes = wavefrontAllocateWith(mtl->allocator, (capacity + 1) * sizeof(unsigned int));
+    remap->offsets = wavefrontAllocateWith(mtl->allocator, (sourceCount + 1) * sizeof(unsigned int));
+    remap->indices = wavefrontAllocateWith(mtl->allocator, (total + 1) * sizeof(int));
+    int result = slots && hashes && remap->offsets && remap->indices ? STATUS_OK : STATUS_ALLOC_ERR;
+    remap->sourceCount = sourceCount;
+
+    // Materials already in mtl are matched first, the earliest of equals.
+    for(unsigned int i = 0; i < mtl->materialCount && !result; i++) {
+        const struct WavefrontMaterial *m = mtl->materials + i;
+        if(!m->name) continue;
+        unsigned int hash = wavefrontMaterialHash(mtl, m);
+        unsigned int slot = hash & mask;
+        for(; slots[slot]; slot = (slot + 1) & mask) {
+            unsigned int j = slots[slot] - 1;
+            if(hashes[j] == hash && wavefrontMaterialEqual(mtl, mtl->materials + j, mtl, m)) break;
+        }
+        if(slots[slot]) continue;
+        hashes[i] = hash;
+        slots[slot] = i + 1;
+    }
+
+    unsigned int position = 0;
+    for(unsigned int s = 0; s < sourceCount && !result; s++) {
+        remap->offsets[s] = position;
+        for(unsigned int i = 0; i < sources[s].materialCount && !result; i++) {
+            const struct WavefrontMaterial *m = sources[s].materials + i;
+            if(!m->name) {
+                remap->indices[position++] = -1;
+                continue;
+            }
+            unsigned int hash = wavefrontMaterialHash(sources + s, m);
+            unsigned int slot = hash & mask;
+            for(; slots[slot]; slot = (slot + 1) & mask) {
+                unsigned int j = slots[slot] - 1;
+                if(hashes[j] == hash && wavefrontMaterialEqual(mtl, mtl->materials + j, sources + s, m)) break;
+            }
+            if(slots[slot]) {
+                remap->indices[position++] = slots[slot] - 1;
+                continue;
+            }
+            unsigned int index;
+            result = addUniqueMaterial(mtl, m->name, s + 1, &index);
+            if(!result) result = materialAssign(mtl, mtl->materials + index, sources + s, m);
+            if(result) break;
+            hashes[index] = hash;
+            slots[slot] = index + 1;
+            remap->indices[position++] = index;
+        }
+    }
+    if(!result) remap->offsets[sourceCount] = position;
+    wavefrontFreeWith(mtl->allocator, slots);
+    wavefrontFreeWith(mtl->allocator, hashes);
+    if(result) {
+        mtlTruncate(mtl, materialCount, textureCount, mapOptionCount);
+        wavefrontMTLRemapRelease(remap);
+    }
+    return result;
+}
+
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap) {
+    wavefrontFreeWith(remap->allocator, remap->indices);
+    wavefrontFreeWith(remap->allocator, remap->offsets);
+    memset(remap, 0, sizeof(struct WavefrontMTLRemap));
+}
+
+void wavefrontMTLRelease(struct WavefrontMTL *mtl) {
+    if(mtl->flags & WAVEFRONT_MTL_ARENA) {
+        while(mtl->arena) {
+            struct WavefrontArenaChunk *next = mtl->arena->next;
+            wavefrontFreeWith(mtl->allocator, mtl->arena);
+            mtl->arena = next;
+        }
+    } else {
+        for(unsigned int i = 0; i < mtl->materialCount; i++) {
+            wavefrontMaterialRelease(mtl, mtl->materials + i);
+        }
+        for(unsigned int i = 0; i < mtl->textureCount; i++) {
+            wavefrontFreeWith(mtl->allocator, mtl->textures[i]);
+        }
+    }
+    wavefrontFreeWith(mtl->allocator, mtl->materials);
+    wavefrontFreeWith(mtl->allocator, mtl->materialTable);
+    wavefrontFreeWith(mtl->allocator, mtl->textures);
+    wavefrontFreeWith(mtl->allocator, mtl->textureTable);
+    wavefrontFreeWith(mtl->allocator, mtl->mapOptions);
+    wavefrontFreeWith(mtl->allocator, mtl->mapOptionTable);
+    wavefrontMTLCompose(mtl);
+}
@@ -4,13 +4,40 @@
 extern "C"{
 #endif
 
+#include <stddef.h>
+#include "wavefront_allocator.h"
+
 struct WavefrontColor {
     float r, g, b, a;
 };
 
+// Flags of WavefrontMapOptions.
+#define WAVEFRONT_MAP_BLENDU 0x1
+#define WAVEFRONT_MAP_BLENDV 0x2
+#define WAVEFRONT_MAP_COLOR_CORRECTION 0x4
+#define WAVEFRONT_MAP_CLAMP 0x8
+
+// Options preceding the file of a map statement. Every member is four bytes
+// so instances compare bytewise. Interned per library, see
+// wavefrontMTLInternMapOptions.
+struct WavefrontMapOptions {
+    float offset[3];     // -o u v w
+    float scale[3];      // -s u v w
+    float turbulence[3]; // -t u v w
+    float bumpMultiplier; // -bm
+    float boost;         // -boost
+    float base, gain;    // -mm base gain
+    int resolution;      // -texres, 0 if unspecified
+    int channel;         // -imfchan r, g, b, m, l or z, 0 if unspecified
+    unsigned int flags;  // -blendu, -blendv, -cc and -clamp
+};
+
 struct WavefrontMap {
     char *file;
-    char *options;
+    // Index + 1 into WavefrontMTL.textures when file is interned, otherwise 0.
+    unsigned int texture;
+    // Index + 1 into WavefrontMTL.mapOptions, 0 for the defaults.
+    unsigned int options;
 };
 
 struct WavefrontMaterial {
@@ -19,9 +46,18 @@ struct WavefrontMaterial {
     struct WavefrontColor diffuse;
     struct WavefrontColor specular;
     struct WavefrontColor transmission;
+    struct WavefrontColor emission;
     float specularExponent;
     float dissolve;
     float opticalDensity;
+    // Physically based rendering extension.
+    float roughness;
+    float metallic;
+    float sheen;
+    float clearcoatThickness;
+    float clearcoatRoughness;
+    float anisotropy;
+    float anisotropyRotation;
     int illuminationModel;
     struct WavefrontMap ambientMap;
     struct WavefrontMap diffuseMap;
@@ -39,15 +75,130 @@ struct WavefrontMaterial {
     struct WavefrontMap reflectionMapCubeBack;
     struct WavefrontMap reflectionMapCubeLeft;
     struct WavefrontMap reflectionMapCubeRight;
+    struct WavefrontMap roughnessMap;
+    struct WavefrontMap metallicMap;
+    struct WavefrontMap sheenMap;
+    struct WavefrontMap emissionMap;
 };
 
+// Number of WavefrontMap members of WavefrontMaterial.
+#define WAVEFRONT_MATERIAL_MAP_COUNT 20
+
+// Strings are allocated from chunks owned by the WavefrontMTL.
+#define WAVEFRONT_MTL_ARENA 0x1
+
+struct WavefrontArenaChunk;
+
 struct WavefrontMTL {
     struct WavefrontMaterial *materials;
     unsigned int materialCount;
+    unsigned int materialCapacity;
+    // Open addressing table of material index + 1 keyed by name, 0 if empty.
+    unsigned int *materialTable;
+    unsigned int materialTableSize;
+    // Unique map files shared by every map referencing them.
+    char **textures;
+    unsigned int textureCount;
+    unsigned int textureCapacity;
+    unsigned int *textureTable;
+    unsigned int textureTableSize;
+    // Unique map options other than the defaults, shared like textures.
+    struct WavefrontMapOptions *mapOptions;
+    unsigned int mapOptionCount;
+    unsigned int mapOptionCapacity;
+    unsigned int *mapOptionTable;
+    unsigned int mapOptionTableSize;
+    unsigned int flags;
+    struct WavefrontArenaChunk *arena;
+    // Makes every allocation of the library, the global allocator when NULL.
+    // Must outlive the library.
+    const struct WavefrontAllocator *allocator;
+};
+
+// Indices of materials touched by wavefrontMTLUpdate.
+struct WavefrontMTLChanges {
+    unsigned int *added;
+    unsigned int addedCount;
+    unsigned int *removed;
+    unsigned int removedCount;
+    unsigned int *changed;
+    unsigned int changedCount;
+    const struct WavefrontAllocator *allocator; // That of the updated library.
+};
+
+// Where the materials of each source of wavefrontMTLMerge ended up. Material
+// i of source s is at indices[offsets[s] + i] in the merged library, -1 if
+// it was removed.
+struct WavefrontMTLRemap {
+    int *indices;
+    unsigned int *offsets; // sourceCount + 1 entries.
+    unsigned int sourceCount;
+    const struct WavefrontAllocator *allocator; // That of the merged library.
 };
 
+void wavefrontMTLCompose(struct WavefrontMTL *mtl);
 void wavefrontMTLRelease(struct WavefrontMTL *mtl);
+// Names and map files belong to the WavefrontMTL. Without WAVEFRONT_MTL_ARENA
+// each is a separate allocation from the library's allocator, otherwise they
+// must come from wavefrontMTLCopyString.
 int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name);
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length);
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string);
+// Ensure capacity for at least count materials without further allocation.
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count);
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl);
+// Return the index of the named material or -1 if there is none.
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name);
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length);
+// Add file to the texture list unless present and return its index + 1.
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture);
+// Add options to the map option list unless present and return their index
+// + 1, or 0 for the defaults, which are never added.
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index);
+// Options of a map of mtl.
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map);
+// Move the materials of other whose names are not already in mtl onto the end
+// of mtl, leaving other empty. Their textures and map options are interned in
+// the order of other, and those used only by materials left behind are
+// dropped. Both must have the same flags and allocator.
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other);
+// Whether material a of library x and b of y have the same properties and map
+// files, ignoring names.
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b);
+// Hash of the properties and map files, equal for materials that are.
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m);
+// Bring mtl in line with next, matching materials by name. Materials keep
+// their index; removed ones stay behind as empty slots with a NULL name, which
+// new ones fill in later updates before being appended, so an index is in one
+// list of changes at most. On failure mtl is left as it was. Changes may be
+// NULL.
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes);
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes);
+// Copy the materials of sources into mtl, keeping one of each set of equal
+// materials: the first, under its own name. A material whose name is taken by
+// one with different content is renamed name.N for the first free N from its
+// source number, counting from 1. Materials already in mtl take part, and
+// sources may have any flags or allocator but must not include mtl. Runs in
+// time linear in the number of materials. On failure mtl is left as it was.
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap);
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap);
+// Hash used by the lookup tables.
+unsigned int wavefrontMTLHashName(const char *name, size_t length);
+// Set the defaults of the MTL specification: unit scale, bump multiplier and
+// gain, with blending on in both directions.
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options);
+// Set an unnamed material without maps and with every property zero, as
+// newmtl starts it.
+int wavefrontMaterialCompose(struct WavefrontMaterial *m);
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index);
 
 #ifdef __cplusplus
 }
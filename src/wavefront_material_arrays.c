@@ -0,0 +1,84 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cutil/src/error.h"
+#include "wavefront_allocator.h"
+#include "wavefront_material_arrays.h"
+
+#define ALIGN(size) \
+    (((size) + WAVEFRONT_MATERIAL_ARRAYS_ALIGNMENT - 1) & ~(size_t)(WAVEFRONT_MATERIAL_ARRAYS_ALIGNMENT - 1))
+
+// Hand out the next aligned array of size bytes from a block.
+static void *take(char **next, size_t size) {
+    void *result = *next;
+    *next += ALIGN(size);
+    return result;
+}
+
+int wavefrontMaterialArraysCompose(struct WavefrontMaterialArrays *arrays, const struct WavefrontMTL *mtl) {
+    memset(arrays, 0, sizeof(struct WavefrontMaterialArrays));
+    unsigned int count = mtl->materialCount;
+    size_t colorSize = ALIGN(count * sizeof(struct WavefrontColor));
+    size_t scalarSize = ALIGN(count * sizeof(float));
+    size_t size = 5 * colorSize + 11 * scalarSize + 2 * WAVEFRONT_MATERIAL_MAP_COUNT * ALIGN(count * sizeof(unsigned int));
+
+    // Allocations are only aligned for standard types, so over allocate.
+    arrays->allocator = mtl->allocator;
+    arrays->storage = wavefrontAllocateWith(arrays->allocator, size + WAVEFRONT_MATERIAL_ARRAYS_ALIGNMENT);
+    if(!arrays->storage) return STATUS_ALLOC_ERR;
+    char *next = (char*)ALIGN((uintptr_t)arrays->storage);
+
+    arrays->count = count;
+    arrays->ambient = take(&next, count * sizeof(struct WavefrontColor));
+    arrays->diffuse = take(&next, count * sizeof(struct WavefrontColor));
+    arrays->specular = take(&next, count * sizeof(struct WavefrontColor));
+    arrays->transmission = take(&next, count * sizeof(struct WavefrontColor));
+    arrays->emission = take(&next, count * sizeof(struct WavefrontColor));
+    arrays->specularExponent = take(&next, count * sizeof(float));
+    arrays->dissolve = take(&next, count * sizeof(float));
+    arrays->opticalDensity = take(&next, count * sizeof(float));
+    arrays->roughness = take(&next, count * sizeof(float));
+    arrays->metallic = take(&next, count * sizeof(float));
+    arrays->sheen = take(&next, count * sizeof(float));
+    arrays->clearcoatThickness = take(&next, count * sizeof(float));
+    arrays->clearcoatRoughness = take(&next, count * sizeof(float));
+    arrays->anisotropy = take(&next, count * sizeof(float));
+    arrays->anisotropyRotation = take(&next, count * sizeof(float));
+    arrays->illuminationModel = take(&next, count * sizeof(int));
+    for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+        arrays->maps[j] = take(&next, count * sizeof(unsigned int));
+    }
+    for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+        arrays->mapOptions[j] = take(&next, count * sizeof(unsigned int));
+    }
+
+    for(unsigned int i = 0; i < count; i++) {
+        struct WavefrontMaterial *m = mtl->materials + i;
+        arrays->ambient[i] = m->ambient;
+        arrays->diffuse[i] = m->diffuse;
+        arrays->specular[i] = m->specular;
+        arrays->transmission[i] = m->transmission;
+        arrays->emission[i] = m->emission;
+        arrays->specularExponent[i] = m->specularExponent;
+        arrays->dissolve[i] = m->dissolve;
+        arrays->opticalDensity[i] = m->opticalDensity;
+        arrays->roughness[i] = m->roughness;
+        arrays->metallic[i] = m->metallic;
+        arrays->sheen[i] = m->sheen;
+        arrays->clearcoatThickness[i] = m->clearcoatThickness;
+        arrays->clearcoatRoughness[i] = m->clearcoatRoughness;
+        arrays->anisotropy[i] = m->anisotropy;
+        arrays->anisotropyRotation[i] = m->anisotropyRotation;
+        arrays->illuminationModel[i] = m->illuminationModel;
+        for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+            arrays->maps[j][i] = wavefrontMaterialMap(m, j)->texture;
+            arrays->mapOptions[j][i] = wavefrontMaterialMap(m, j)->options;
+        }
+    }
+    return STATUS_OK;
+}
+
+void wavefrontMaterialArraysRelease(struct WavefrontMaterialArrays *arrays) {
+    wavefrontFreeWith(arrays->allocator, arrays->storage);
+    memset(arrays, 0, sizeof(struct WavefrontMaterialArrays));
+}
@@ -0,0 +1,49 @@
+#ifndef __WAVEFRONT_MATERIAL_ARRAYS_H
+#define __WAVEFRONT_MATERIAL_ARRAYS_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "wavefront_material.h"
+
+// Alignment of every array, enough for direct upload as vec4/float arrays.
+#define WAVEFRONT_MATERIAL_ARRAYS_ALIGNMENT 16
+
+// Material properties of a WavefrontMTL as one array per property, indexed
+// like WavefrontMTL.materials.
+struct WavefrontMaterialArrays {
+    unsigned int count;
+    struct WavefrontColor *ambient;
+    struct WavefrontColor *diffuse;
+    struct WavefrontColor *specular;
+    struct WavefrontColor *transmission;
+    struct WavefrontColor *emission;
+    float *specularExponent;
+    float *dissolve;
+    float *opticalDensity;
+    float *roughness;
+    float *metallic;
+    float *sheen;
+    float *clearcoatThickness;
+    float *clearcoatRoughness;
+    float *anisotropy;
+    float *anisotropyRotation;
+    int *illuminationModel;
+    // Per map, in wavefrontMaterialMap order, the index + 1 into
+    // WavefrontMTL.textures or 0. Files that were not interned read as 0.
+    unsigned int *maps[WAVEFRONT_MATERIAL_MAP_COUNT];
+    // Per map, the index + 1 into WavefrontMTL.mapOptions or 0 for defaults.
+    unsigned int *mapOptions[WAVEFRONT_MATERIAL_MAP_COUNT];
+    void *storage; // Single allocation holding every array.
+    const struct WavefrontAllocator *allocator; // That of the source library.
+};
+
+// Copy the materials of mtl into freshly allocated arrays. The arrays are a
+// snapshot and do not follow later changes to mtl.
+int wavefrontMaterialArraysCompose(struct WavefrontMaterialArrays *arrays, const struct WavefrontMTL *mtl);
+void wavefrontMaterialArraysRelease(struct WavefrontMaterialArrays *arrays);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,85 @@
+#include <stdint.h>
+#include "wavefront_material_arrays.h"
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+#include "cutil/src/assertion.h"
+
+static int aligned(const void *pointer) {
+    return (uintptr_t)pointer % WAVEFRONT_MATERIAL_ARRAYS_ALIGNMENT == 0;
+}
+
+void testMaterialArrays() {
+    char input[] =
+        "newmtl first\n"
+        "Ka 0.1 0.2 0.3\n"
+        "Ns 10\n"
+        "illum 2\n"
+        "map_Kd a.png\n"
+        "newmtl second\n"
+        "Kd 0.5\n"
+        "Tf 0.25 0.5 0.75\n"
+        "d 0.5\n"
+        "Ni 1.5\n"
+        "Pm 0.75\n"
+        "Ke 0.1 0.2 0.3\n"
+        "map_Kn -bm 2 b.png\n"
+        "newmtl third\n"
+        "map_Kd b.png\n";
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromString(&mtl, input);
+
+    struct WavefrontMaterialArrays arrays;
+    int result = wavefrontMaterialArraysCompose(&arrays, &mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(arrays.count, 3);
+    assertFloatsEqual(arrays.ambient[0].g, 0.2);
+    assertFloatsEqual(arrays.ambient[0].a, 1.0);
+    assertFloatsEqual(arrays.diffuse[1].b, 0.5);
+    assertFloatsEqual(arrays.transmission[1].b, 0.75);
+    assertFloatsEqual(arrays.specularExponent[0], 10);
+    assertFloatsEqual(arrays.dissolve[1], 0.5);
+    assertFloatsEqual(arrays.opticalDensity[1], 1.5);
+    assertFloatsEqual(arrays.metallic[1], 0.75);
+    assertFloatsEqual(arrays.emission[1].g, 0.2);
+    assertIntegersEqual(arrays.illuminationModel[0], 2);
+    assertIntegersEqual(arrays.illuminationModel[2], 0);
+
+    // Maps index the interned texture list.
+    unsigned int diffuse = 1, normal = 2;
+    assertIntegersEqual(arrays.maps[diffuse][0], 1);
+    assertIntegersEqual(arrays.maps[diffuse][1], 0);
+    assertIntegersEqual(arrays.maps[diffuse][2], 2);
+    assertIntegersEqual(arrays.maps[normal][1], 2);
+    assertStringsEqual(mtl.textures[arrays.maps[normal][1] - 1], "b.png");
+    // And map options the interned option list.
+    assertIntegersEqual(arrays.mapOptions[diffuse][0], 0);
+    assertIntegersEqual(arrays.mapOptions[normal][1], 1);
+    assertFloatsEqual(mtl.mapOptions[arrays.mapOptions[normal][1] - 1].bumpMultiplier, 2);
+
+    assertIntegersEqual(aligned(arrays.ambient), 1);
+    assertIntegersEqual(aligned(arrays.transmission), 1);
+    assertIntegersEqual(aligned(arrays.specularExponent), 1);
+    assertIntegersEqual(aligned(arrays.dissolve), 1);
+    assertIntegersEqual(aligned(arrays.anisotropyRotation), 1);
+    assertIntegersEqual(aligned(arrays.illuminationModel), 1);
+    assertIntegersEqual(aligned(arrays.maps[WAVEFRONT_MATERIAL_MAP_COUNT - 1]), 1);
+    assertIntegersEqual(aligned(arrays.mapOptions[WAVEFRONT_MATERIAL_MAP_COUNT - 1]), 1);
+    wavefrontMaterialArraysRelease(&arrays);
+    assertIntegersEqual(arrays.count, 0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testMaterialArraysEmpty() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    struct WavefrontMaterialArrays arrays;
+    int result = wavefrontMaterialArraysCompose(&arrays, &mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(arrays.count, 0);
+    wavefrontMaterialArraysRelease(&arrays);
+}
+
+void wavefrontMaterialArraysTest() {
+    testMaterialArrays();
+    testMaterialArraysEmpty();
+}
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wavefront_material.h"
+#include "cutil/src/error.h"
+
+// Materials in each source library and distinct materials among all sources.
+#define BENCH_SOURCE_MATERIALS 100
+#define BENCH_DISTINCT 5000
+
+// Per-asset libraries whose materials repeat across assets under other names.
+static int generateSources(struct WavefrontMTL *sources, unsigned int sourceCount) {
+    char text[64];
+    unsigned int seed = 9;
+    for(unsigned int s = 0; s < sourceCount; s++) {
+        wavefrontMTLCompose(sources + s);
+        sources[s].flags = WAVEFRONT_MTL_ARENA;
+    }
+    for(unsigned int s = 0; s < sourceCount; s++) {
+        for(unsigned int i = 0; i < BENCH_SOURCE_MATERIALS; i++) {
+            seed = seed * 1103515245u + 12345u;
+            unsigned int content = (seed >> 8) % BENCH_DISTINCT;
+            snprintf(text, sizeof(text), "asset%u_material%u", s, i);
+            if(wavefrontMTLAddMaterial(sources + s, wavefrontMTLCopyString(sources + s, text, strlen(text)))) {
+                return STATUS_ALLOC_ERR;
+            }
+            struct WavefrontMaterial *m = sources[s].materials + i;
+            m->diffuse = (struct WavefrontColor){content / (float)BENCH_DISTINCT, 0.5f, 0.25f, 1};
+            m->specularExponent = 96.078431f;
+            m->illuminationModel = 2;
+            unsigned int texture;
+            snprintf(text, sizeof(text), "textures/diffuse_%u.png", content % 500);
+            if(wavefrontMTLInternTexture(sources + s, text, strlen(text), &texture)) return STATUS_ALLOC_ERR;
+            m->diffuseMap.file = sources[s].textures[texture - 1];
+            m->diffuseMap.texture = texture;
+        }
+    }
+    return STATUS_OK;
+}
+
+static void benchMerge(unsigned int sourceCount) {
+    struct WavefrontMTL *sources = malloc(sourceCount * sizeof(struct WavefrontMTL));
+    if(!sources) return;
+    if(generateSources(sources, sourceCount) == STATUS_OK) {
+        struct WavefrontMTL mtl;
+        struct WavefrontMTLRemap remap;
+        wavefrontMTLCompose(&mtl);
+        mtl.flags = WAVEFRONT_MTL_ARENA;
+        clock_t start = clock();
+        int result = wavefrontMTLMerge(&mtl, sources, sourceCount, &remap);
+        double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if(result == STATUS_OK) {
+            double materials = (double)sourceCount * BENCH_SOURCE_MATERIALS;
+            char label[64];
+            snprintf(label, sizeof(label), "wavefrontMTLMerge %.0f into %u", materials, mtl.materialCount);
+            printf("%-44s %12.0f materials/sec\n", label, seconds > 0 ? materials / seconds : 0);
+            wavefrontMTLRemapRelease(&remap);
+        }
+        wavefrontMTLRelease(&mtl);
+    }
+    for(unsigned int s = 0; s < sourceCount; s++) wavefrontMTLRelease(sources + s);
+    free(sources);
+}
+
+// Rates should hold steady as the merge grows.
+void wavefrontMaterialBench() {
+    benchMerge(100);
+    benchMerge(1000);
+    benchMerge(4000);
+}
@@ -0,0 +1,447 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cutil/src/error.h"
+#include "wavefront_allocator.h"
+#include "wavefront_material_cache.h"
+#include "wavefront_file.h"
+
+#define HEADER_SIZE 36
+// Offset, scale and turbulence vectors, four scalars, resolution, channel and
+// flags.
+#define MAP_OPTIONS_SIZE (9 * 4 + 4 * 4 + 3 * 4)
+// File, texture and options index of a map with a file.
+#define MAP_SIZE 12
+#define COLOR_COUNT (sizeof(colorOffsets) / sizeof(colorOffsets[0]))
+#define SCALAR_COUNT (sizeof(scalarOffsets) / sizeof(scalarOffsets[0]))
+// Name, colors, scalars, illumination model and map mask, before the maps.
+#define MATERIAL_SIZE (4 + COLOR_COUNT * 16 + SCALAR_COUNT * 4 + 4 + 4)
+
+static const unsigned char magic[4] = {'W', 'M', 'T', 'L'};
+
+// Record order of the colors and float properties of WavefrontMaterial.
+static const size_t colorOffsets[] = {
+    offsetof(struct WavefrontMaterial, ambient),
+    offsetof(struct WavefrontMaterial, diffuse),
+    offsetof(struct WavefrontMaterial, specular),
+    offsetof(struct WavefrontMaterial, transmission),
+    offsetof(struct WavefrontMaterial, emission)
+};
+static const size_t scalarOffsets[] = {
+    offsetof(struct WavefrontMaterial, specularExponent),
+    offsetof(struct WavefrontMaterial, dissolve),
+    offsetof(struct WavefrontMaterial, opticalDensity),
+    offsetof(struct WavefrontMaterial, roughness),
+    offsetof(struct WavefrontMaterial, metallic),
+    offsetof(struct WavefrontMaterial, sheen),
+    offsetof(struct WavefrontMaterial, clearcoatThickness),
+    offsetof(struct WavefrontMaterial, clearcoatRoughness),
+    offsetof(struct WavefrontMaterial, anisotropy),
+    offsetof(struct WavefrontMaterial, anisotropyRotation)
+};
+
+static void writeU32(unsigned char *output, uint32_t value) {
+    output[0] = value;
+    output[1] = value >> 8;
+    output[2] = value >> 16;
+    output[3] = value >> 24;
+}
+
+static void writeFloat(unsigned char *output, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    writeU32(output, bits);
+}
+
+static uint32_t readU32(const unsigned char *input) {
+    return (uint32_t)input[0] | (uint32_t)input[1] << 8 |
+        (uint32_t)input[2] << 16 | (uint32_t)input[3] << 24;
+}
+
+static float readFloat(const unsigned char *input) {
+    uint32_t bits = readU32(input);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static void writeFloats(unsigned char *output, const float *values, unsigned int count) {
+    for(unsigned int i = 0; i < count; i++) writeFloat(output + i * 4, values[i]);
+}
+
+static void readFloats(const unsigned char *input, float *values, unsigned int count) {
+    for(unsigned int i = 0; i < count; i++) values[i] = readFloat(input + i * 4);
+}
+
+static void writeMapOptions(unsigned char *output, const struct WavefrontMapOptions *options) {
+    writeFloats(output, options->offset, 3);
+    writeFloats(output + 12, options->scale, 3);
+    writeFloats(output + 24, options->turbulence, 3);
+    writeFloat(output + 36, options->bumpMultiplier);
+    writeFloat(output + 40, options->boost);
+    writeFloat(output + 44, options->base);
+    writeFloat(output + 48, options->gain);
+    writeU32(output + 52, (uint32_t)options->resolution);
+    writeU32(output + 56, (uint32_t)options->channel);
+    writeU32(output + 60, options->flags);
+}
+
+static void readMapOptions(const unsigned char *input, struct WavefrontMapOptions *options) {
+    readFloats(input, options->offset, 3);
+    readFloats(input + 12, options->scale, 3);
+    readFloats(input + 24, options->turbulence, 3);
+    options->bumpMultiplier = readFloat(input + 36);
+    options->boost = readFloat(input + 40);
+    options->base = readFloat(input + 44);
+    options->gain = readFloat(input + 48);
+    options->resolution = (int)readU32(input + 52);
+    options->channel = (int)readU32(input + 56);
+    options->flags = readU32(input + 60);
+}
+
+// Bit i set when map i of m has a file.
+static uint32_t mapMask(const struct WavefrontMaterial *m) {
+    uint32_t mask = 0;
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        if(wavefrontMaterialMap((struct WavefrontMaterial*)m, i)->file) mask |= 1u << i;
+    }
+    return mask;
+}
+
+static unsigned int bitCount(uint32_t mask) {
+    unsigned int count = 0;
+    for(; mask; mask &= mask - 1) count++;
+    return count;
+}
+
+static size_t stringSize(const char *string) {
+    return string ? strlen(string) + 1 : 0;
+}
+
+struct Pool {
+    unsigned char *data;
+    size_t used;
+};
+
+static uint32_t poolAdd(struct Pool *pool, const char *string) {
+    if(!string) return WAVEFRONT_MTL_CACHE_NONE;
+    uint32_t offset = pool->used;
+    size_t size = strlen(string) + 1;
+    memcpy(pool->data + pool->used, string, size);
+    pool->used += size;
+    return offset;
+}
+
+int wavefrontMTLSerialize(const struct WavefrontMTL *mtl, char **output, size_t *length) {
+    // Interned files are stored once, everything else where it is used.
+    size_t poolSize = 0;
+    size_t recordsSize = (size_t)mtl->materialCount * MATERIAL_SIZE;
+    for(unsigned int i = 0; i < mtl->textureCount; i++) {
+        poolSize += stringSize(mtl->textures[i]);
+    }
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        struct WavefrontMaterial *m = mtl->materials + i;
+        poolSize += stringSize(m->name);
+        for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+            struct WavefrontMap *map = wavefrontMaterialMap(m, j);
+            if(!map->file) continue;
+            recordsSize += MAP_SIZE;
+            if(!map->texture) poolSize += stringSize(map->file);
+        }
+    }
+    if(poolSize >= WAVEFRONT_MTL_CACHE_NONE || recordsSize > UINT32_MAX) return STATUS_INPUT_ERR;
+
+    size_t size = HEADER_SIZE +
+        (size_t)mtl->mapOptionCount * MAP_OPTIONS_SIZE +
+        recordsSize +
+        ((size_t)mtl->textureCount + mtl->materialTableSize + mtl->textureTableSize) * 4 +
+        poolSize;
+    unsigned char *blob = wavefrontAllocateWith(mtl->allocator, size);
+    uint32_t *textureOffsets = wavefrontAllocateWith(mtl->allocator, (mtl->textureCount + 1) * sizeof(uint32_t));
+    if(!blob || !textureOffsets) {
+        wavefrontFreeWith(mtl->allocator, blob);
+        wavefrontFreeWith(mtl->allocator, textureOffsets);
+        return STATUS_ALLOC_ERR;
+    }
+
+    unsigned char *out = blob;
+    memcpy(out, magic, sizeof(magic));
+    writeU32(out + 4, WAVEFRONT_MTL_CACHE_VERSION);
+    writeU32(out + 8, mtl->materialCount);
+    writeU32(out + 12, mtl->textureCount);
+    writeU32(out + 16, mtl->mapOptionCount);
+    writeU32(out + 20, mtl->materialTableSize);
+    writeU32(out + 24, mtl->textureTableSize);
+    writeU32(out + 28, recordsSize);
+    writeU32(out + 32, poolSize);
+    out += HEADER_SIZE;
+    for(unsigned int i = 0; i < mtl->mapOptionCount; i++, out += MAP_OPTIONS_SIZE) {
+        writeMapOptions(out, mtl->mapOptions + i);
+    }
+
+    struct Pool pool = {blob + size - poolSize, 0};
+    for(unsigned int i = 0; i < mtl->textureCount; i++) {
+        textureOffsets[i] = poolAdd(&pool, mtl->textures[i]);
+    }
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        struct WavefrontMaterial *m = mtl->materials + i;
+        writeU32(out, poolAdd(&pool, m->name));
+        out += 4;
+        for(unsigned int j = 0; j < COLOR_COUNT; j++, out += 16) {
+            const struct WavefrontColor *color = (const struct WavefrontColor*)((const char*)m + colorOffsets[j]);
+            writeFloat(out, color->r);
+            writeFloat(out + 4, color->g);
+            writeFloat(out + 8, color->b);
+            writeFloat(out + 12, color->a);
+        }
+        for(unsigned int j = 0; j < SCALAR_COUNT; j++, out += 4) {
+            writeFloat(out, *(const float*)((const char*)m + scalarOffsets[j]));
+        }
+        writeU32(out, (uint32_t)m->illuminationModel);
+        uint32_t mask = mapMask(m);
+        writeU32(out + 4, mask);
+        out += 8;
+        for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+            if(!(mask & 1u << j)) continue;
+            struct WavefrontMap *map = wavefrontMaterialMap(m, j);
+            writeU32(out, map->texture ? WAVEFRONT_MTL_CACHE_NONE : poolAdd(&pool, map->file));
+            writeU32(out + 4, map->texture);
+            writeU32(out + 8, map->options);
+            out += MAP_SIZE;
+        }
+    }
+    for(unsigned int i = 0; i < mtl->textureCount; i++, out += 4) {
+        writeU32(out, textureOffsets[i]);
+    }
+    for(unsigned int i = 0; i < mtl->materialTableSize; i++, out += 4) {
+        writeU32(out, mtl->materialTable[i]);
+    }
+    for(unsigned int i = 0; i < mtl->textureTableSize; i++, out += 4) {
+        writeU32(out, mtl->textureTable[i]);
+    }
+    wavefrontFreeWith(mtl->allocator, textureOffsets);
+
+    *output = (char*)blob;
+    *length = size;
+    return STATUS_OK;
+}
+
+// Tables must be empty or a power of two at most half full of valid indices,
+// so that lookups always reach an empty slot.
+static int validTable(const unsigned char *input, uint32_t size, uint32_t count) {
+    if(!size) return !count;
+    if(size & (size - 1) || size / 2 < count) return 0;
+    uint32_t used = 0;
+    for(uint32_t i = 0; i < size; i++) {
+        uint32_t index = readU32(input + i * 4);
+        if(index > count) return 0;
+        used += index != 0;
+    }
+    return used <= count;
+}
+
+static uint32_t *readTable(const struct WavefrontMTL *mtl, const unsigned char *input, uint32_t size) {
+    uint32_t *table = wavefrontAllocateWith(mtl->allocator, size * sizeof(uint32_t));
+    for(uint32_t i = 0; table && i < size; i++) {
+        table[i] = readU32(input + i * 4);
+    }
+    return table;
+}
+
+// Resolve a pool offset, which must land inside the pool.
+static int readString(const unsigned char *input, const char *pool, uint32_t poolSize, char **output) {
+    uint32_t offset = readU32(input);
+    if(offset == WAVEFRONT_MTL_CACHE_NONE) {
+        *output = NULL;
+        return STATUS_OK;
+    }
+    if(offset >= poolSize) return STATUS_INPUT_ERR;
+    *output = (char*)pool + offset;
+    return STATUS_OK;
+}
+
+// Read the record at input, of at most available bytes, into m and set size
+// to the bytes it takes.
+static int readMaterial(
+    struct WavefrontMTL *mtl,
+    struct WavefrontMaterial *m,
+    const unsigned char *input,
+    size_t available,
+    size_t *size,
+    const char *pool,
+    uint32_t poolSize
+) {
+    if(available < MATERIAL_SIZE) return STATUS_INPUT_ERR;
+    uint32_t mask = readU32(input + MATERIAL_SIZE - 4);
+    if(WAVEFRONT_MATERIAL_MAP_COUNT < 32 && mask >> WAVEFRONT_MATERIAL_MAP_COUNT) return STATUS_INPUT_ERR;
+    *size = MATERIAL_SIZE + (size_t)bitCount(mask) * MAP_SIZE;
+    if(available < *size) return STATUS_INPUT_ERR;
+
+    wavefrontMaterialCompose(m);
+    // Removed materials have no name.
+    if(readString(input, pool, poolSize, &m->name)) return STATUS_INPUT_ERR;
+    input += 4;
+    for(unsigned int j = 0; j < COLOR_COUNT; j++, input += 16) {
+        struct WavefrontColor *color = (struct WavefrontColor*)((char*)m + colorOffsets[j]);
+        color->r = readFloat(input);
+        color->g = readFloat(input + 4);
+        color->b = readFloat(input + 8);
+        color->a = readFloat(input + 12);
+    }
+    for(unsigned int j = 0; j < SCALAR_COUNT; j++, input += 4) {
+        *(float*)((char*)m + scalarOffsets[j]) = readFloat(input);
+    }
+    m->illuminationModel = (int)readU32(input);
+    input += 8;
+    for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+        if(!(mask & 1u << j)) continue;
+        struct WavefrontMap *map = wavefrontMaterialMap(m, j);
+        map->texture = readU32(input + 4);
+        map->options = readU32(input + 8);
+        if(map->texture > mtl->textureCount || map->options > mtl->mapOptionCount) return STATUS_INPUT_ERR;
+        if(map->texture) {
+            if(readU32(input) != WAVEFRONT_MTL_CACHE_NONE) return STATUS_INPUT_ERR;
+            map->file = mtl->textures[map->texture - 1];
+        } else if(readString(input, pool, poolSize, &map->file) || !map->file) {
+            return STATUS_INPUT_ERR;
+        }
+        input += MAP_SIZE;
+    }
+    return STATUS_OK;
+}
+
+static int deserialize(struct WavefrontMTL *mtl, const unsigned char *input, size_t length) {
+    if(length < HEADER_SIZE || memcmp(input, magic, sizeof(magic)) != 0) return STATUS_INPUT_ERR;
+    if(readU32(input + 4) != WAVEFRONT_MTL_CACHE_VERSION) return STATUS_INPUT_ERR;
+    uint32_t materialCount = readU32(input + 8);
+    uint32_t textureCount = readU32(input + 12);
+    uint32_t optionCount = readU32(input + 16);
+    uint32_t materialTableSize = readU32(input + 20);
+    uint32_t textureTableSize = readU32(input + 24);
+    uint32_t recordsSize = readU32(input + 28);
+    uint32_t poolSize = readU32(input + 32);
+    unsigned long long size = HEADER_SIZE +
+        (unsigned long long)optionCount * MAP_OPTIONS_SIZE +
+        recordsSize +
+        ((unsigned long long)textureCount + materialTableSize + textureTableSize) * 4 +
+        poolSize;
+    if(size != length || recordsSize / MATERIAL_SIZE < materialCount) return STATUS_INPUT_ERR;
+
+    const unsigned char *options = input + HEADER_SIZE;
+    const unsigned char *materials = options + (size_t)optionCount * MAP_OPTIONS_SIZE;
+    const unsigned char *textures = materials + recordsSize;
+    const unsigned char *materialTable = textures + (size_t)textureCount * 4;
+    const unsigned char *textureTable = materialTable + (size_t)materialTableSize * 4;
+    const unsigned char *strings = textureTable + (size_t)textureTableSize * 4;
+    // Every string ends inside the pool once its last byte is a terminator.
+    if(poolSize && strings[poolSize - 1] != '\0') return STATUS_INPUT_ERR;
+    if(!validTable(materialTable, materialTableSize, materialCount) ||
+        !validTable(textureTable, textureTableSize, textureCount)) {
+        return STATUS_INPUT_ERR;
+    }
+
+    mtl->flags = WAVEFRONT_MTL_ARENA;
+    const char *pool = NULL;
+    if(poolSize) {
+        pool = wavefrontMTLCopyString(mtl, (const char*)strings, poolSize - 1);
+        if(!pool) return STATUS_ALLOC_ERR;
+    }
+
+    mtl->textures = wavefrontAllocateWith(mtl->allocator, textureCount * sizeof(char*));
+    mtl->materials = wavefrontAllocateWith(mtl->allocator, materialCount * sizeof(struct WavefrontMaterial));
+    mtl->materialTable = readTable(mtl, materialTable, materialTableSize);
+    mtl->textureTable = readTable(mtl, textureTable, textureTableSize);
+    if((textureCount && !mtl->textures) || (materialCount && !mtl->materials) ||
+        (materialTableSize && !mtl->materialTable) || (textureTableSize && !mtl->textureTable)) {
+        return STATUS_ALLOC_ERR;
+    }
+    mtl->materialTableSize = materialTableSize;
+    mtl->textureTableSize = textureTableSize;
+
+    // Options are stored unique and without the defaults, so each must be
+    // interned at its own index.
+    for(uint32_t i = 0; i < optionCount; i++) {
+        struct WavefrontMapOptions mapOptions;
+        readMapOptions(options + (size_t)i * MAP_OPTIONS_SIZE, &mapOptions);
+        unsigned int index;
+        if(wavefrontMTLInternMapOptions(mtl, &mapOptions, &index)) return STATUS_ALLOC_ERR;
+        if(index != i + 1) return STATUS_INPUT_ERR;
+    }
+
+    mtl->textureCapacity = textureCount;
+    for(; mtl->textureCount < textureCount; mtl->textureCount++) {
+        char **texture = mtl->textures + mtl->textureCount;
+        if(readString(textures + mtl->textureCount * 4, pool, poolSize, texture) || !*texture) {
+            return STATUS_INPUT_ERR;
+        }
+    }
+    mtl->materialCapacity = materialCount;
+    size_t offset = 0;
+    for(; mtl->materialCount < materialCount; mtl->materialCount++) {
+        struct WavefrontMaterial *m = mtl->materials + mtl->materialCount;
+        size_t recordSize;
+        int result = readMaterial(mtl, m, materials + offset, recordsSize - offset, &recordSize, pool, poolSize);
+        if(result) return result;
+        offset += recordSize;
+    }
+    if(offset != recordsSize) return STATUS_INPUT_ERR;
+    // Lookups compare names, so table entries must reach named materials,
+    // and each named material must be found where it is.
+    for(uint32_t i = 0; i < materialTableSize; i++) {
+        uint32_t index = mtl->materialTable[i];
+        if(index && !mtl->materials[index - 1].name) return STATUS_INPUT_ERR;
+    }
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        const char *name = mtl->materials[i].name;
+        if(name && wavefrontMTLFindMaterial(mtl, name) != (int)i) return STATUS_INPUT_ERR;
+    }
+    return STATUS_OK;
+}
+
+int wavefrontMTLDeserialize(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontAllocator *allocator
+) {
+    wavefrontMTLCompose(mtl);
+    mtl->allocator = allocator;
+    if(!input) return STATUS_INPUT_ERR;
+    int result = deserialize(mtl, (const unsigned char*)input, length);
+    if(result) wavefrontMTLRelease(mtl);
+    return result;
+}
+
+int wavefrontMTLSaveCache(const struct WavefrontMTL *mtl, const char *path) {
+    char *blob;
+    size_t length;
+    int result = wavefrontMTLSerialize(mtl, &blob, &length);
+    if(result) return result;
+    FILE *file = fopen(path, "wb");
+    if(file) {
+        if(fwrite(blob, 1, length, file) != length) result = STATUS_INPUT_ERR;
+        if(fclose(file)) result = STATUS_INPUT_ERR;
+    } else {
+        result = STATUS_INPUT_ERR;
+    }
+    wavefrontFreeWith(mtl->allocator, blob);
+    return result;
+}
+
+int wavefrontMTLLoadCache(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontAllocator *allocator
+) {
+    struct WavefrontFileView view;
+    int result = wavefrontFileMap(&view, path);
+    if(result) {
+        wavefrontMTLCompose(mtl);
+        return result;
+    }
+    result = wavefrontMTLDeserialize(mtl, view.data, view.length, allocator);
+    wavefrontFileUnmap(&view);
+    return result;
+}
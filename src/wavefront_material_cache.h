@@ -0,0 +1,48 @@
+#ifndef __WAVEFRONT_MATERIAL_CACHE_H
+#define __WAVEFRONT_MATERIAL_CACHE_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+#include "wavefront_material.h"
+
+// Binary cache layout, all fields little endian 32 bit:
+//   header       magic "WMTL", version, material count, texture count, map
+//                option count, material table size, texture table size,
+//                material records size, string pool size
+//   options      WavefrontMTL.mapOptions in order
+//   materials    name, colors, scalars, illumination model and a mask with
+//                bit i set when map i has a file, then file, texture and
+//                options index of each of those maps in bit order
+//   textures     pool offset of each interned file
+//   tables       material then texture lookup tables as stored in memory
+//   strings      NUL terminated strings
+// Absent strings have the offset WAVEFRONT_MTL_CACHE_NONE, as do the files of
+// maps with a texture.
+#define WAVEFRONT_MTL_CACHE_VERSION 4
+#define WAVEFRONT_MTL_CACHE_NONE 0xffffffffu
+
+// Write mtl to a blob allocated with the allocator of mtl, which the caller
+// releases with wavefrontFreeWith.
+int wavefrontMTLSerialize(const struct WavefrontMTL *mtl, char **output, size_t *length);
+// Rebuild a WavefrontMTL from a blob. Strings are copied into a single
+// WAVEFRONT_MTL_ARENA chunk and lookup tables are used as stored, so nothing
+// is parsed. Names are hashed only to check that each material is found
+// through the table. Blobs failing any check give STATUS_INPUT_ERR.
+// Allocator may be NULL, as in WavefrontMTLOptions.
+int wavefrontMTLDeserialize(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontAllocator *allocator);
+int wavefrontMTLSaveCache(const struct WavefrontMTL *mtl, const char *path);
+int wavefrontMTLLoadCache(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontAllocator *allocator);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wavefront_material_cache.h"
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+#include "cutil/src/assertion.h"
+
+static const char cacheInput[] =
+    "newmtl first\n"
+    "Ka 0.1 0.2 0.3\n"
+    "Kd 0.4 0.5 0.6\n"
+    "Ns 96.078431\n"
+    "illum 2\n"
+    "map_Kd shared.png\n"
+    "newmtl second\n"
+    "d 0.25\n"
+    "Ni 1.45\n"
+    "Pr 0.5\n"
+    "Ke 1 0.5 0\n"
+    "map_Kd shared.png\n"
+    "refl -type cube_top -clamp on top.png\n";
+
+// Material x of library a against y of b.
+static void assertMaterialsMatch(
+    const struct WavefrontMTL *a,
+    struct WavefrontMaterial *x,
+    const struct WavefrontMTL *b,
+    struct WavefrontMaterial *y
+) {
+    assertStringsEqual(x->name, y->name);
+    assertIntegersEqual(memcmp(&x->ambient, &y->ambient,
+        (char*)(&x->illuminationModel + 1) - (char*)&x->ambient), 0);
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        struct WavefrontMap *xMap = wavefrontMaterialMap(x, i);
+        struct WavefrontMap *yMap = wavefrontMaterialMap(y, i);
+        assertIntegersEqual(xMap->texture, yMap->texture);
+        assertIntegersEqual(!xMap->file, !yMap->file);
+        if(xMap->file && yMap->file) assertStringsEqual(xMap->file, yMap->file);
+        assertIntegersEqual(memcmp(wavefrontMTLMapOptions(a, xMap), wavefrontMTLMapOptions(b, yMap),
+            sizeof(struct WavefrontMapOptions)), 0);
+    }
+}
+
+void testCacheRoundTrip() {
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, cacheInput);
+    assertIntegersEqual(result, STATUS_OK);
+    // Files assigned directly are not interned.
+    mtl.materials[1].bumpMap.file = wavefrontMTLCopyString(&mtl, "bump.png", 8);
+    struct WavefrontMapOptions options;
+    wavefrontMapOptionsCompose(&options);
+    options.bumpMultiplier = 2;
+    wavefrontMTLInternMapOptions(&mtl, &options, &mtl.materials[1].bumpMap.options);
+
+    char *blob;
+    size_t length;
+    result = wavefrontMTLSerialize(&mtl, &blob, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(memcmp(blob, "WMTL\4\0\0\0", 8), 0);
+
+    struct WavefrontMTL loaded;
+    result = wavefrontMTLDeserialize(&loaded, blob, length, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(loaded.flags, WAVEFRONT_MTL_ARENA);
+    assertIntegersEqual(loaded.materialCount, 2);
+    assertIntegersEqual(loaded.textureCount, 2);
+    assertIntegersEqual(loaded.mapOptionCount, 2);
+    assertStringsEqual(loaded.textures[0], "shared.png");
+    for(unsigned int i = 0; i < loaded.materialCount; i++) {
+        assertMaterialsMatch(&loaded, loaded.materials + i, &mtl, mtl.materials + i);
+    }
+    const struct WavefrontMapOptions *top = wavefrontMTLMapOptions(&loaded, &loaded.materials[1].reflectionMapCubeTop);
+    assertIntegersEqual(top->flags & WAVEFRONT_MAP_CLAMP, WAVEFRONT_MAP_CLAMP);
+    // Interned files stay shared.
+    assertIntegersEqual(loaded.materials[0].diffuseMap.file == loaded.materials[1].diffuseMap.file, 1);
+
+    // Stored lookup tables still find materials and files.
+    assertIntegersEqual(wavefrontMTLFindMaterial(&loaded, "second"), 1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&loaded, "third"), -1);
+    unsigned int texture = 0;
+    wavefrontMTLInternTexture(&loaded, "top.png", 7, &texture);
+    assertIntegersEqual(texture, 2);
+    char *name = wavefrontMTLCopyString(&loaded, "third", 5);
+    assertIntegersEqual(wavefrontMTLAddMaterial(&loaded, name), STATUS_OK);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&loaded, "third"), 2);
+
+    wavefrontMTLRelease(&loaded);
+    wavefrontFree(blob);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testCacheEmpty() {
+    struct WavefrontMTL mtl, loaded;
+    wavefrontMTLCompose(&mtl);
+    char *blob;
+    size_t length;
+    int result = wavefrontMTLSerialize(&mtl, &blob, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLDeserialize(&loaded, blob, length, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(loaded.materialCount, 0);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&loaded, "missing"), -1);
+    wavefrontMTLRelease(&loaded);
+    wavefrontFree(blob);
+}
+
+static int deserializeModified(const char *blob, size_t length, size_t offset, unsigned char value) {
+    char *copy = malloc(length);
+    memcpy(copy, blob, length);
+    copy[offset] = value;
+    struct WavefrontMTL loaded;
+    int result = wavefrontMTLDeserialize(&loaded, copy, length, NULL);
+    wavefrontMTLRelease(&loaded);
+    free(copy);
+    return result;
+}
+
+void testCacheSize() {
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromString(&mtl, cacheInput);
+    char *blob;
+    size_t length;
+    int result = wavefrontMTLSerialize(&mtl, &blob, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    // Header, the -clamp on options, records with one and two maps, textures,
+    // tables and "first", "second", "shared.png" and "top.png".
+    size_t expected = 36 + 64 + (132 + 12) + (132 + 2 * 12) + 2 * 4 +
+        (mtl.materialTableSize + mtl.textureTableSize) * 4 + 32;
+    assertIntegersEqual(length, expected);
+    wavefrontFree(blob);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testCacheRemovedMaterial() {
+    struct WavefrontMTL mtl, loaded;
+    parseWavefrontMTLFromString(&mtl, cacheInput);
+    char after[] = "newmtl second\n";
+    wavefrontMTLReload(&mtl, after, sizeof(after) - 1, NULL);
+    char *blob;
+    size_t length;
+    wavefrontMTLSerialize(&mtl, &blob, &length);
+    int result = wavefrontMTLDeserialize(&loaded, blob, length, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(loaded.materialCount, 2);
+    assertIntegersEqual(loaded.materials[0].name == NULL, 1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&loaded, "first"), -1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&loaded, "second"), 1);
+    wavefrontMTLRelease(&loaded);
+    wavefrontFree(blob);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testCacheRejectsCorruption() {
+    struct WavefrontMTL mtl, loaded;
+    parseWavefrontMTLFromString(&mtl, cacheInput);
+    char *blob;
+    size_t length;
+    wavefrontMTLSerialize(&mtl, &blob, &length);
+
+    for(size_t i = 0; i < length; i++) {
+        int result = wavefrontMTLDeserialize(&loaded, blob, i, NULL);
+        assertIntegersEqual(result, STATUS_INPUT_ERR);
+    }
+    // Magic, an older version, material count, the stored options turned into
+    // the defaults, name offset, map mask, texture index, options index and
+    // the final string terminator. The first record follows the header and
+    // one set of options.
+    size_t record = 36 + 64;
+    assertIntegersEqual(deserializeModified(blob, length, 0, 'X'), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, 4, 3), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, 8, 3), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, 36 + 60, 3), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, record + 3, 0x7f), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, record + 128, 3), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, record + 132 + 4, 9), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, record + 132 + 8, 2), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, length - 1, 'x'), STATUS_INPUT_ERR);
+    // A lookup table without free slots.
+    size_t table = length - (mtl.textureTableSize + mtl.materialTableSize) * 4;
+    wavefrontMTLRelease(&mtl);
+    char *full = malloc(length);
+    memcpy(full, blob, length);
+    for(unsigned int i = 0; i < 16; i++) full[table + i * 4] = 1;
+    assertIntegersEqual(wavefrontMTLDeserialize(&loaded, full, length, NULL), STATUS_INPUT_ERR);
+    free(full);
+    wavefrontFree(blob);
+}
+
+// Offset of the first material table slot holding value, or 0 if none.
+static size_t findTableSlot(const char *blob, size_t length, const struct WavefrontMTL *mtl, unsigned char value) {
+    const unsigned char *header = (const unsigned char*)blob;
+    size_t poolSize = header[32] | header[33] << 8 | header[34] << 16 | (size_t)header[35] << 24;
+    size_t table = length - poolSize - (mtl->materialTableSize + mtl->textureTableSize) * 4;
+    for(unsigned int i = 0; i < mtl->materialTableSize; i++) {
+        if(header[table + i * 4] == value) return table + i * 4;
+    }
+    return 0;
+}
+
+void testCacheRejectsBadMaterialTable() {
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromString(&mtl, cacheInput);
+    char after[] = "newmtl second\n";
+    wavefrontMTLReload(&mtl, after, sizeof(after) - 1, NULL);
+    char *blob;
+    size_t length;
+    wavefrontMTLSerialize(&mtl, &blob, &length);
+
+    // Pointing the slot of second at the removed material would have lookups
+    // compare against a NULL name.
+    size_t slot = findTableSlot(blob, length, &mtl, 2);
+    assertIntegersEqual(slot != 0, 1);
+    assertIntegersEqual(deserializeModified(blob, length, slot, 1), STATUS_INPUT_ERR);
+    // Emptying it leaves second unreachable.
+    assertIntegersEqual(deserializeModified(blob, length, slot, 0), STATUS_INPUT_ERR);
+    assertIntegersEqual(deserializeModified(blob, length, slot, 2), STATUS_OK);
+    wavefrontFree(blob);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testCacheFile() {
+    const char *path = "bin/test_cache.wmtl";
+    struct WavefrontMTL mtl, loaded;
+    parseWavefrontMTLFromString(&mtl, cacheInput);
+    int result = wavefrontMTLSaveCache(&mtl, path);
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLLoadCache(&loaded, path, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(loaded.materialCount, 2);
+    if(loaded.materialCount == 2) assertMaterialsMatch(&loaded, loaded.materials + 1, &mtl, mtl.materials + 1);
+    wavefrontMTLRelease(&loaded);
+    wavefrontMTLRelease(&mtl);
+    remove(path);
+
+    result = wavefrontMTLLoadCache(&loaded, "bin/does_not_exist.wmtl", NULL);
+    assertIntegersEqual(result, STATUS_INPUT_ERR);
+    assertIntegersEqual(loaded.materialCount, 0);
+}
+
+void wavefrontMaterialCacheTest() {
+    testCacheRoundTrip();
+    testCacheEmpty();
+    testCacheSize();
+    testCacheRemovedMaterial();
+    testCacheRejectsCorruption();
+    testCacheRejectsBadMaterialTable();
+    testCacheFile();
+}
@@ -0,0 +1,289 @@
+#include <stddef.h>
+#include <string.h>
+#include "cutil/src/error.h"
+#include "wavefront_allocator.h"
+#include "wavefront_material_compact.h"
+#include "wavefront_number.h"
+
+#define COLOR_COUNT (sizeof(colorOffsets) / sizeof(colorOffsets[0]))
+#define SCALAR_COUNT (sizeof(scalarOffsets) / sizeof(scalarOffsets[0]))
+
+// Order of WavefrontCompactMaterial.colors and scalars within
+// WavefrontMaterial.
+static const size_t colorOffsets[] = {
+    offsetof(struct WavefrontMaterial, ambient),
+    offsetof(struct WavefrontMaterial, diffuse),
+    offsetof(struct WavefrontMaterial, specular),
+    offsetof(struct WavefrontMaterial, transmission),
+    offsetof(struct WavefrontMaterial, emission)
+};
+static const size_t scalarOffsets[] = {
+    offsetof(struct WavefrontMaterial, specularExponent),
+    offsetof(struct WavefrontMaterial, dissolve),
+    offsetof(struct WavefrontMaterial, opticalDensity),
+    offsetof(struct WavefrontMaterial, roughness),
+    offsetof(struct WavefrontMaterial, metallic),
+    offsetof(struct WavefrontMaterial, sheen),
+    offsetof(struct WavefrontMaterial, clearcoatThickness),
+    offsetof(struct WavefrontMaterial, clearcoatRoughness),
+    offsetof(struct WavefrontMaterial, anisotropy),
+    offsetof(struct WavefrontMaterial, anisotropyRotation)
+};
+
+// Distinct map files or options gathered while packing, found through an
+// open addressing table of index + 1.
+struct Interner {
+    const void **items;
+    unsigned int count;
+    unsigned int *slots;
+    unsigned int mask;
+    size_t bytes; // Of the strings, terminators included.
+};
+
+static int internerCompose(struct Interner *interner, const struct WavefrontAllocator *allocator, unsigned int capacity) {
+    unsigned int size = 16;
+    while(size < capacity * 2) size *= 2;
+    interner->items = wavefrontAllocateWith(allocator, (capacity + 1) * sizeof(void*));
+    interner->slots = wavefrontAllocateZeroedWith(allocator, size, sizeof(unsigned int));
+    interner->count = 0;
+    interner->mask = size - 1;
+    interner->bytes = 0;
+    return interner->items && interner->slots ? STATUS_OK : STATUS_ALLOC_ERR;
+}
+
+static void internerRelease(struct Interner *interner, const struct WavefrontAllocator *allocator) {
+    wavefrontFreeWith(allocator, interner->items);
+    wavefrontFreeWith(allocator, interner->slots);
+}
+
+// Return the index of file, adding it if new.
+static unsigned int internFile(struct Interner *interner, const char *file) {
+    size_t length = strlen(file);
+    unsigned int slot = wavefrontMTLHashName(file, length) & interner->mask;
+    for(; interner->slots[slot]; slot = (slot + 1) & interner->mask) {
+        unsigned int index = interner->slots[slot] - 1;
+        if(strcmp(interner->items[index], file) == 0) return index;
+    }
+    interner->items[interner->count] = file;
+    interner->slots[slot] = ++interner->count;
+    interner->bytes += length + 1;
+    return interner->count - 1;
+}
+
+static unsigned int internOptions(struct Interner *interner, const struct WavefrontMapOptions *options) {
+    unsigned int slot = wavefrontMTLHashName((const char*)options, sizeof(struct WavefrontMapOptions)) & interner->mask;
+    for(; interner->slots[slot]; slot = (slot + 1) & interner->mask) {
+        unsigned int index = interner->slots[slot] - 1;
+        if(memcmp(interner->items[index], options, sizeof(struct WavefrontMapOptions)) == 0) return index;
+    }
+    interner->items[interner->count] = options;
+    interner->slots[slot] = ++interner->count;
+    return interner->count - 1;
+}
+
+static void packMaterial(
+    struct WavefrontCompactMTL *compact,
+    struct WavefrontCompactMaterial *packed,
+    const struct WavefrontMTL *mtl,
+    const struct WavefrontMaterial *m,
+    struct Interner *files,
+    struct Interner *options,
+    size_t *nameOffset
+) {
+    if(m->name) {
+        size_t length = strlen(m->name) + 1;
+        memcpy(compact->names + *nameOffset, m->name, length);
+        packed->name = (uint32_t)*nameOffset;
+        *nameOffset += length;
+    } else {
+        packed->name = WAVEFRONT_COMPACT_NONE;
+    }
+    packed->alphaMask = 0;
+    for(unsigned int i = 0; i < COLOR_COUNT; i++) {
+        const struct WavefrontColor *color = (const struct WavefrontColor*)((const char*)m + colorOffsets[i]);
+        packed->colors[i][0] = wavefrontFloatToHalf(color->r);
+        packed->colors[i][1] = wavefrontFloatToHalf(color->g);
+        packed->colors[i][2] = wavefrontFloatToHalf(color->b);
+        if(color->a != 0) packed->alphaMask |= 1 << i;
+    }
+    for(unsigned int i = 0; i < SCALAR_COUNT; i++) {
+        packed->scalars[i] = wavefrontFloatToHalf(*(const float*)((const char*)m + scalarOffsets[i]));
+    }
+    int illuminationModel = m->illuminationModel;
+    if(illuminationModel < -128) illuminationModel = -128;
+    if(illuminationModel > 127) illuminationModel = 127;
+    packed->illuminationModel = (int8_t)illuminationModel;
+
+    packed->maps = compact->mapCount;
+    packed->mapMask = 0;
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        const struct WavefrontMap *map = wavefrontMaterialMap((struct WavefrontMaterial*)m, i);
+        if(!map->file) continue;
+        packed->mapMask |= 1u << i;
+        struct WavefrontCompactMap *compactMap = compact->maps + compact->mapCount++;
+        compactMap->texture = internFile(files, map->file);
+        compactMap->options = internOptions(options, wavefrontMTLMapOptions(mtl, map));
+    }
+}
+
+int wavefrontCompactMTLCompose(struct WavefrontCompactMTL *compact, const struct WavefrontMTL *mtl) {
+    memset(compact, 0, sizeof(struct WavefrontCompactMTL));
+    compact->allocator = mtl->allocator;
+    unsigned int mapCount = 0;
+    size_t nameBytes = 0;
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        struct WavefrontMaterial *m = mtl->materials + i;
+        if(m->name) nameBytes += strlen(m->name) + 1;
+        for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+            mapCount += wavefrontMaterialMap(m, j)->file != NULL;
+        }
+    }
+
+    // Gather distinct files and options first to size the single allocation.
+    struct Interner files, options;
+    memset(&files, 0, sizeof(struct Interner));
+    memset(&options, 0, sizeof(struct Interner));
+    struct WavefrontMapOptions defaults;
+    wavefrontMapOptionsCompose(&defaults);
+    int result = internerCompose(&files, compact->allocator, mapCount);
+    if(!result) result = internerCompose(&options, compact->allocator, mapCount + 1);
+    if(!result) {
+        internOptions(&options, &defaults);
+        for(unsigned int i = 0; i < mtl->materialCount; i++) {
+            for(unsigned int j = 0; j < WAVEFRONT_MATERIAL_MAP_COUNT; j++) {
+                const struct WavefrontMap *map = wavefrontMaterialMap(mtl->materials + i, j);
+                if(!map->file) continue;
+                internFile(&files, map->file);
+                internOptions(&options, wavefrontMTLMapOptions(mtl, map));
+            }
+        }
+        // Pointers first keeps every array aligned.
+        compact->size = files.count * sizeof(char*) +
+            mtl->materialCount * sizeof(struct WavefrontCompactMaterial) +
+            mapCount * sizeof(struct WavefrontCompactMap) +
+            options.count * sizeof(struct WavefrontMapOptions) +
+            nameBytes + files.bytes;
+        compact->storage = wavefrontAllocateWith(compact->allocator, compact->size ? compact->size : 1);
+        if(!compact->storage) result = STATUS_ALLOC_ERR;
+    }
+    if(!result) {
+        char *next = compact->storage;
+        compact->textures = (char**)next;
+        next += files.count * sizeof(char*);
+        compact->materials = (struct WavefrontCompactMaterial*)next;
+        next += mtl->materialCount * sizeof(struct WavefrontCompactMaterial);
+        compact->maps = (struct WavefrontCompactMap*)next;
+        next += mapCount * sizeof(struct WavefrontCompactMap);
+        compact->options = (struct WavefrontMapOptions*)next;
+        next += options.count * sizeof(struct WavefrontMapOptions);
+        compact->names = next;
+        next += nameBytes;
+
+        compact->textureCount = files.count;
+        for(unsigned int i = 0; i < files.count; i++) {
+            size_t length = strlen(files.items[i]) + 1;
+            memcpy(next, files.items[i], length);
+            compact->textures[i] = next;
+            next += length;
+        }
+        compact->optionCount = options.count;
+        for(unsigned int i = 0; i < options.count; i++) {
+            compact->options[i] = *(const struct WavefrontMapOptions*)options.items[i];
+        }
+        size_t nameOffset = 0;
+        for(unsigned int i = 0; i < mtl->materialCount; i++) {
+            packMaterial(compact, compact->materials + i, mtl, mtl->materials + i, &files, &options, &nameOffset);
+        }
+        compact->materialCount = mtl->materialCount;
+    }
+    internerRelease(&files, compact->allocator);
+    internerRelease(&options, compact->allocator);
+    if(result) wavefrontCompactMTLRelease(compact);
+    return result;
+}
+
+void wavefrontCompactMTLRelease(struct WavefrontCompactMTL *compact) {
+    wavefrontFreeWith(compact->allocator, compact->storage);
+    memset(compact, 0, sizeof(struct WavefrontCompactMTL));
+}
+
+void wavefrontCompactMaterialExpand(const struct WavefrontCompactMTL *compact, unsigned int index, struct WavefrontMaterial *m) {
+    const struct WavefrontCompactMaterial *packed = compact->materials + index;
+    m->name = packed->name == WAVEFRONT_COMPACT_NONE ? NULL : compact->names + packed->name;
+    for(unsigned int i = 0; i < COLOR_COUNT; i++) {
+        struct WavefrontColor *color = (struct WavefrontColor*)((char*)m + colorOffsets[i]);
+        color->r = wavefrontHalfToFloat(packed->colors[i][0]);
+        color->g = wavefrontHalfToFloat(packed->colors[i][1]);
+        color->b = wavefrontHalfToFloat(packed->colors[i][2]);
+        color->a = packed->alphaMask & (1 << i) ? 1.0f : 0.0f;
+    }
+    for(unsigned int i = 0; i < SCALAR_COUNT; i++) {
+        *(float*)((char*)m + scalarOffsets[i]) = wavefrontHalfToFloat(packed->scalars[i]);
+    }
+    m->illuminationModel = packed->illuminationModel;
+
+    const struct WavefrontCompactMap *compactMap = compact->maps + packed->maps;
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+        if(packed->mapMask & (1u << i)) {
+            map->file = compact->textures[compactMap->texture];
+            map->texture = compactMap->texture + 1;
+            map->options = compactMap->options;
+            compactMap++;
+        } else {
+            map->file = NULL;
+            map->texture = 0;
+            map->options = 0;
+        }
+    }
+}
+
+// Unpack material index of compact onto the end of mtl, which has room.
+static void expandInto(const struct WavefrontCompactMTL *compact, unsigned int index, struct WavefrontMTL *mtl) {
+    struct WavefrontMaterial *m = mtl->materials + mtl->materialCount - 1;
+    char *name = m->name;
+    wavefrontCompactMaterialExpand(compact, index, m);
+    m->name = name;
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+        // Textures and options were interned in order.
+        if(map->file) map->file = mtl->textures[map->texture - 1];
+    }
+}
+
+int wavefrontCompactMTLExpand(
+    const struct WavefrontCompactMTL *compact,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontAllocator *allocator
+) {
+    wavefrontMTLCompose(mtl);
+    mtl->flags = WAVEFRONT_MTL_ARENA;
+    mtl->allocator = allocator;
+    int result = wavefrontMTLReserve(mtl, compact->materialCount);
+    for(unsigned int i = 0; i < compact->textureCount && !result; i++) {
+        unsigned int texture;
+        const char *file = compact->textures[i];
+        result = wavefrontMTLInternTexture(mtl, file, strlen(file), &texture);
+    }
+    // Options after the defaults are distinct, so each gets its own index.
+    for(unsigned int i = 1; i < compact->optionCount && !result; i++) {
+        unsigned int index;
+        result = wavefrontMTLInternMapOptions(mtl, compact->options + i, &index);
+    }
+    for(unsigned int i = 0; i < compact->materialCount && !result; i++) {
+        uint32_t name = compact->materials[i].name;
+        if(name == WAVEFRONT_COMPACT_NONE) {
+            // Removed materials keep their slot but stay out of the table,
+            // and Reserve left room.
+            mtl->materials[mtl->materialCount++].name = NULL;
+        } else {
+            const char *source = compact->names + name;
+            char *copy = wavefrontMTLCopyString(mtl, source, strlen(source));
+            result = copy ? wavefrontMTLAddMaterial(mtl, copy) : STATUS_ALLOC_ERR;
+            if(result) break;
+        }
+        expandInto(compact, i, mtl);
+    }
+    if(result) wavefrontMTLRelease(mtl);
+    return result;
+}
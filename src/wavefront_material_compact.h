@@ -0,0 +1,76 @@
+#ifndef __WAVEFRONT_MATERIAL_COMPACT_H
+#define __WAVEFRONT_MATERIAL_COMPACT_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "wavefront_material.h"
+
+// Name offset of removed materials.
+#define WAVEFRONT_COMPACT_NONE 0xFFFFFFFFu
+
+// A map with a file, found through WavefrontCompactMaterial.maps.
+struct WavefrontCompactMap {
+    uint32_t texture; // Index into WavefrontCompactMTL.textures.
+    uint32_t options; // Index into WavefrontCompactMTL.options, 0 for defaults.
+};
+
+// A WavefrontMaterial in 64 bytes. Colors and scalars are half floats, see
+// wavefrontFloatToHalf, and only maps with a file take space.
+struct WavefrontCompactMaterial {
+    uint32_t name; // Offset into WavefrontCompactMTL.names.
+    uint32_t maps; // Index of the first map in WavefrontCompactMTL.maps.
+    // Bit i set when map i in wavefrontMaterialMap order has a file. Maps
+    // are stored in bit order.
+    uint32_t mapMask;
+    // Ambient, diffuse, specular, transmission and emission red, green and
+    // blue.
+    uint16_t colors[5][3];
+    // Specular exponent, dissolve, optical density, roughness, metallic,
+    // sheen, clearcoat thickness and roughness, anisotropy and its rotation.
+    uint16_t scalars[10];
+    uint8_t alphaMask; // Bit i set when color i has a nonzero alpha.
+    int8_t illuminationModel;
+};
+
+// Materials of a WavefrontMTL packed for keeping many resident, in a single
+// allocation. Converting back gives the same materials except that colors
+// and scalars round to the nearest half float, alpha reads back as 0 or 1
+// and illumination models are clamped to [-128, 127]. Names, files and the
+// options of maps with a file are exact.
+struct WavefrontCompactMTL {
+    struct WavefrontCompactMaterial *materials; // Indexed like WavefrontMTL.materials.
+    unsigned int materialCount;
+    struct WavefrontCompactMap *maps;
+    unsigned int mapCount;
+    // Distinct map files, and distinct map options with the defaults first.
+    char **textures;
+    unsigned int textureCount;
+    struct WavefrontMapOptions *options;
+    unsigned int optionCount;
+    char *names;
+    size_t size; // Bytes allocated.
+    void *storage;
+    const struct WavefrontAllocator *allocator; // That of the source library.
+};
+
+int wavefrontCompactMTLCompose(struct WavefrontCompactMTL *compact, const struct WavefrontMTL *mtl);
+void wavefrontCompactMTLRelease(struct WavefrontCompactMTL *compact);
+// Unpack material index into m, whose name and files point into compact,
+// whose texture indices are into compact->textures and whose option indices
+// are into compact->options, which starts with the defaults as index 0 does.
+// Nothing is allocated.
+void wavefrontCompactMaterialExpand(const struct WavefrontCompactMTL *compact, unsigned int index, struct WavefrontMaterial *m);
+// Unpack every material into a library using the arena, which owns copies of
+// the strings.
+int wavefrontCompactMTLExpand(
+    const struct WavefrontCompactMTL *compact,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontAllocator *allocator);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wavefront_material_compact.h"
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+
+#define BENCH_MATERIALS 100000
+
+// Counts live bytes, keeping each size in a header.
+struct LiveBytes {
+    size_t bytes;
+};
+
+#define HEADER_SIZE 16
+
+static void *liveAllocate(void *context, size_t size) {
+    char *block = malloc(size + HEADER_SIZE);
+    if(!block) return NULL;
+    memcpy(block, &size, sizeof(size_t));
+    ((struct LiveBytes*)context)->bytes += size;
+    return block + HEADER_SIZE;
+}
+
+static void *liveReallocate(void *context, void *pointer, size_t size) {
+    char *block = (char*)pointer - HEADER_SIZE;
+    size_t old;
+    memcpy(&old, block, sizeof(size_t));
+    block = realloc(block, size + HEADER_SIZE);
+    if(!block) return NULL;
+    memcpy(block, &size, sizeof(size_t));
+    ((struct LiveBytes*)context)->bytes += size - old;
+    return block + HEADER_SIZE;
+}
+
+static void liveRelease(void *context, void *pointer) {
+    char *block = (char*)pointer - HEADER_SIZE;
+    size_t size;
+    memcpy(&size, block, sizeof(size_t));
+    ((struct LiveBytes*)context)->bytes -= size;
+    free(block);
+}
+
+// Materials as a typical exporter writes them, sharing a hundred textures.
+static char *generateLibrary(size_t *length) {
+    size_t capacity = (size_t)BENCH_MATERIALS * 320;
+    char *output = malloc(capacity);
+    if(!output) return NULL;
+    *length = 0;
+    for(unsigned int i = 0; i < BENCH_MATERIALS; i++) {
+        float x = (i % 1000) / 999.0f;
+        *length += snprintf(output + *length, capacity - *length,
+            "newmtl Material_%06u\n"
+            "Ns 96.078431\nKa 1.000000 1.000000 1.000000\nKd %f %f %f\n"
+            "Ks 0.500000 0.500000 0.500000\nKe 0.000000 0.000000 0.000000\n"
+            "Ni 1.450000\nd 1.000000\nillum 2\n"
+            "map_Kd textures/diffuse_%02u.png\nmap_Bump -bm 0.5 textures/normal_%02u.png\n\n",
+            i, x, x / 3, 1 - x, i % 100, i % 100);
+    }
+    return output;
+}
+
+static void printBytes(const char *label, size_t bytes, unsigned int count) {
+    printf("%-44s %12.1f bytes/material\n", label, count ? (double)bytes / count : 0);
+}
+
+// Resident size of a parsed library against its compact form.
+void wavefrontMaterialCompactBench() {
+    size_t length = 0;
+    char *input = generateLibrary(&length);
+    if(!input) return;
+    struct LiveBytes live = {0};
+    struct WavefrontAllocator allocator = {liveAllocate, liveReallocate, liveRelease, &live};
+    struct WavefrontMTLOptions options;
+    memset(&options, 0, sizeof(options));
+    options.allocator = &allocator;
+
+    unsigned int flags[] = {0, WAVEFRONT_MTL_ARENA};
+    const char *labels[] = {"WavefrontMTL", "WavefrontMTL arena"};
+    for(unsigned int i = 0; i < 2; i++) {
+        struct WavefrontMTL mtl;
+        options.flags = flags[i];
+        if(parseWavefrontMTLFromBuffer(&mtl, input, length, &options) != STATUS_OK) break;
+        wavefrontMTLShrinkToFit(&mtl);
+        printBytes(labels[i], live.bytes, mtl.materialCount);
+        if(i == 1) {
+            struct WavefrontCompactMTL compact;
+            size_t before = live.bytes;
+            clock_t start = clock();
+            int result = wavefrontCompactMTLCompose(&compact, &mtl);
+            double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+            if(result == STATUS_OK) {
+                printBytes("WavefrontCompactMTL", live.bytes - before, compact.materialCount);
+                printf("%-44s %12.0f materials/sec\n", "wavefrontCompactMTLCompose",
+                    seconds > 0 ? compact.materialCount / seconds : 0);
+                wavefrontCompactMTLRelease(&compact);
+            }
+        }
+        wavefrontMTLRelease(&mtl);
+    }
+    free(input);
+}
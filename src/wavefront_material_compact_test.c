@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <string.h>
+#include "wavefront_material_compact.h"
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+#include "cutil/src/assertion.h"
+
+// Values are exact in half precision except for Ns.
+static const char compactInput[] =
+    "newmtl first\n"
+    "Ka 0.125 0.25 0.5\n"
+    "Kd 1 0.75 0.5\n"
+    "Ns 96.078431\n"
+    "d 0.5\n"
+    "illum 2\n"
+    "map_Kd shared.png\n"
+    "map_Bump -bm 2 -clamp on bump.png\n"
+    "newmtl second\n"
+    "Ke 4 2 1\n"
+    "Pr 0.25\n"
+    "illum 300\n"
+    "map_Kd shared.png\n"
+    "refl -type cube_top -o 0.5 0.5 0 top.png\n"
+    "newmtl third\n"
+    "map_Ke -bm 2 -clamp on bump.png\n";
+
+void testCompactLayout() {
+    assertIntegersEqual(sizeof(struct WavefrontCompactMaterial), 64);
+    assertIntegersEqual(WAVEFRONT_MATERIAL_MAP_COUNT <= 32, 1);
+}
+
+// A library view over compact's options, so expanded materials resolve theirs.
+static void composeOptionsView(struct WavefrontMTL *view, struct WavefrontCompactMTL *compact) {
+    wavefrontMTLCompose(view);
+    view->mapOptions = compact->options + 1;
+    view->mapOptionCount = compact->optionCount - 1;
+}
+
+void testCompactRoundTrip() {
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, compactInput);
+    assertIntegersEqual(result, STATUS_OK);
+    struct WavefrontCompactMTL compact;
+    result = wavefrontCompactMTLCompose(&compact, &mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(compact.materialCount, 3);
+    assertIntegersEqual(compact.mapCount, 5);
+    assertIntegersEqual(compact.textureCount, 3);
+    // Defaults, -bm 2 -clamp on and -o 0.5 0.5 0.
+    assertIntegersEqual(compact.optionCount, 3);
+    assertIntegersEqual(compact.materials[0].mapMask, 1u << 1 | 1u << 6);
+
+    struct WavefrontMTL view;
+    composeOptionsView(&view, &compact);
+    struct WavefrontMaterial m;
+    wavefrontCompactMaterialExpand(&compact, 0, &m);
+    assertStringsEqual(m.name, "first");
+    assertFloatsEqual(m.ambient.g, 0.25);
+    assertFloatsEqual(m.ambient.a, 1);
+    assertFloatsEqual(m.diffuse.r, 1);
+    assertFloatsEqual(m.specular.a, 0);
+    // Rounded to the nearest half.
+    assertFloatsEqual(m.specularExponent, 96.0625);
+    assertStringsEqual(m.bumpMap.file, "bump.png");
+    assertStringsEqual(compact.textures[m.bumpMap.texture - 1], "bump.png");
+    assertFloatsEqual(compact.options[m.bumpMap.options].bumpMultiplier, 2);
+    mtl.materials[0].specularExponent = 96.0625;
+    assertIntegersEqual(wavefrontMaterialEqual(&view, &m, &mtl, mtl.materials), 1);
+
+    wavefrontCompactMaterialExpand(&compact, 1, &m);
+    assertIntegersEqual(m.illuminationModel, 127);
+    assertStringsEqual(m.reflectionMapCubeTop.file, "top.png");
+    assertFloatsEqual(compact.options[m.reflectionMapCubeTop.options].offset[0], 0.5);
+    mtl.materials[1].illuminationModel = 127;
+    assertIntegersEqual(wavefrontMaterialEqual(&view, &m, &mtl, mtl.materials + 1), 1);
+    wavefrontCompactMaterialExpand(&compact, 2, &m);
+    assertIntegersEqual(wavefrontMaterialEqual(&view, &m, &mtl, mtl.materials + 2), 1);
+
+    wavefrontCompactMTLRelease(&compact);
+    assertIntegersEqual(compact.materialCount, 0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testCompactExpandLibrary() {
+    struct WavefrontMTL mtl, next, expanded;
+    int result = parseWavefrontMTLFromString(&mtl, compactInput);
+    assertIntegersEqual(result, STATUS_OK);
+    // Leave the second slot removed.
+    result = parseWavefrontMTLFromString(&next,
+        "newmtl first\nnewmtl third\nmap_Ke -bm 2 -clamp on bump.png\nnewmtl fourth\nKd 0.5\n");
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLUpdate(&mtl, &next, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materials[1].name == NULL, 1);
+
+    struct WavefrontCompactMTL compact;
+    result = wavefrontCompactMTLCompose(&compact, &mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(compact.materials[1].name, WAVEFRONT_COMPACT_NONE);
+    result = wavefrontCompactMTLExpand(&compact, &expanded, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(expanded.flags, WAVEFRONT_MTL_ARENA);
+    assertIntegersEqual(expanded.materialCount, 4);
+    assertIntegersEqual(expanded.materials[1].name == NULL, 1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&expanded, "fourth"), 3);
+    for(unsigned int i = 0; i < mtl.materialCount; i++) {
+        assertIntegersEqual(wavefrontMaterialEqual(&expanded, expanded.materials + i, &mtl, mtl.materials + i), 1);
+    }
+    // Strings belong to the expanded library.
+    assertIntegersEqual(expanded.materials[2].name != compact.names, 1);
+    wavefrontCompactMTLRelease(&compact);
+    assertStringsEqual(expanded.materials[2].name, "third");
+    assertStringsEqual(expanded.materials[2].emissionMap.file, "bump.png");
+    assertIntegersEqual(expanded.materials[2].emissionMap.texture, 1);
+    wavefrontMTLRelease(&expanded);
+    wavefrontMTLRelease(&next);
+    wavefrontMTLRelease(&mtl);
+}
+
+#define VALUE_COUNT (5 * 4 + 10)
+
+// The color channels then the scalars of m, in WavefrontCompactMaterial order.
+static void materialValues(struct WavefrontMaterial *m, float **values) {
+    struct WavefrontColor *colors[] = {&m->ambient, &m->diffuse, &m->specular, &m->transmission, &m->emission};
+    for(int i = 0; i < 5; i++) {
+        values[i * 4] = &colors[i]->r;
+        values[i * 4 + 1] = &colors[i]->g;
+        values[i * 4 + 2] = &colors[i]->b;
+        values[i * 4 + 3] = &colors[i]->a;
+    }
+    float *scalars[] = {
+        &m->specularExponent, &m->dissolve, &m->opticalDensity, &m->roughness, &m->metallic,
+        &m->sheen, &m->clearcoatThickness, &m->clearcoatRoughness, &m->anisotropy, &m->anisotropyRotation
+    };
+    memcpy(values + 20, scalars, sizeof(scalars));
+}
+
+// Every sampled value reads back within half precision.
+void testCompactPrecision() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    char name[32];
+    unsigned int seed = 17;
+    for(int i = 0; i < 1000; i++) {
+        snprintf(name, sizeof(name), "material%d", i);
+        wavefrontMTLAddMaterial(&mtl, wavefrontMTLCopyString(&mtl, name, strlen(name)));
+        float *values[VALUE_COUNT];
+        materialValues(mtl.materials + i, values);
+        for(int j = 0; j < VALUE_COUNT; j++) {
+            seed = seed * 1103515245u + 12345u;
+            *values[j] = j < 20 && j % 4 == 3 ? 1 : (seed >> 8) / (float)(1u << 24) * (j % 2 ? 1 : 1000);
+        }
+    }
+    struct WavefrontCompactMTL compact;
+    int result = wavefrontCompactMTLCompose(&compact, &mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    int outside = 0;
+    for(unsigned int i = 0; i < mtl.materialCount; i++) {
+        struct WavefrontMaterial m;
+        wavefrontCompactMaterialExpand(&compact, i, &m);
+        float *expected[VALUE_COUNT], *actual[VALUE_COUNT];
+        materialValues(mtl.materials + i, expected);
+        materialValues(&m, actual);
+        for(int j = 0; j < VALUE_COUNT; j++) {
+            float error = *actual[j] - *expected[j];
+            if(error < 0) error = -error;
+            // Relative to the value, or to the smallest normal half.
+            float limit = (*expected[j] > 6.1035156e-5f ? *expected[j] : 6.1035156e-5f) / 2048;
+            outside += error > limit;
+        }
+    }
+    assertIntegersEqual(outside, 0);
+    wavefrontCompactMTLRelease(&compact);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testCompactEmpty() {
+    struct WavefrontMTL mtl, expanded;
+    wavefrontMTLCompose(&mtl);
+    struct WavefrontCompactMTL compact;
+    int result = wavefrontCompactMTLCompose(&compact, &mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(compact.materialCount, 0);
+    assertIntegersEqual(compact.optionCount, 1);
+    result = wavefrontCompactMTLExpand(&compact, &expanded, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(expanded.materialCount, 0);
+    wavefrontMTLRelease(&expanded);
+    wavefrontCompactMTLRelease(&compact);
+}
+
+void wavefrontMaterialCompactTest() {
+    testCompactLayout();
+    testCompactRoundTrip();
+    testCompactExpandLibrary();
+    testCompactPrecision();
+    testCompactEmpty();
+}
@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+
+#ifdef _WIN32
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Minimum CPU time spent repeating each measurement.
+#define BENCH_SECONDS 0.5
+
+// Allocations are counted by wrapping malloc and friends at link time, see
+// BENCH_LIBRARIES. Only calls made while counting is set are recorded, which
+// the corpus bench does from a single thread.
+static int counting = 0;
+static unsigned long long allocations = 0;
+static unsigned long long allocatedBytes = 0;
+
+#ifdef WAVEFRONT_BENCH_COUNT_ALLOCATIONS
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    if(counting) {
+        allocations++;
+        allocatedBytes += size;
+    }
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    if(counting) {
+        allocations++;
+        allocatedBytes += count * size;
+    }
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+    if(counting) {
+        allocations++;
+        allocatedBytes += size;
+    }
+    return __real_realloc(pointer, size);
+}
+#endif
+
+// Peak resident set size of the process so far in KiB.
+static unsigned long long peakResidentKiB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage)) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+// Appends one material to output and returns the number of bytes written.
+typedef size_t (*MaterialWriter)(char *output, size_t capacity, unsigned int index);
+
+// One short material per line pair, stressing per material overhead.
+static size_t writeTinyMaterial(char *output, size_t capacity, unsigned int i) {
+    return snprintf(output, capacity, "newmtl tiny_%07u\nKd 0.5 0.5 0.5\n", i);
+}
+
+// Every property and map keyword, restated several times as some exporters
+// do, stressing dispatch within a material.
+static size_t writeHeavyMaterial(char *output, size_t capacity, unsigned int i) {
+    size_t length = snprintf(output, capacity, "newmtl heavy_%05u\n", i);
+    for(unsigned int pass = 0; pass < 8 && length < capacity; pass++) {
+        length += snprintf(output + length, capacity - length,
+            "# pass %u\n"
+            "Ns 96.078431\nNi 1.450000\nd 1.000000\nTr 0.000000\nillum 2\n"
+            "Ka 1.000000 1.000000 1.000000\nKd 0.640000 0.640000 0.640000\n"
+            "Ks 0.500000 0.500000 0.500000\nKe 0.000000 0.000000 0.000000\n"
+            "Tf 1.000000 1.000000 1.000000\n"
+            "Pr 0.500000\nPm 0.000000\nPs 0.000000\nPc 0.000000\nPcr 0.030000\n"
+            "aniso 0.000000\nanisor 0.000000\n"
+            "map_Ka ambient.png\nmap_Kd -s 1 1 1 diffuse.png\nmap_Ks specular.png\n"
+            "map_Ke emission.png\nmap_Ns highlight.png\nmap_d alpha.png\n"
+            "map_Bump -bm 0.5 normal.png\ndisp displacement.png\ndecal decal.png\n"
+            "map_Pr roughness.png\nmap_Pm metallic.png\nmap_Ps sheen.png\n"
+            "refl -type sphere sky.png\n\n", pass);
+    }
+    return length;
+}
+
+// Maps with options and files unique to each material, stressing interning.
+static size_t writeTextureMaterial(char *output, size_t capacity, unsigned int i) {
+    return snprintf(output, capacity,
+        "newmtl textured_%06u\n"
+        "map_Ka -clamp on textures/%06u_ambient.png\n"
+        "map_Kd -o 0.5 0.5 -s 2 2 textures/%06u_diffuse.png\n"
+        "map_Ks -blendu off -blendv off textures/%06u_specular.png\n"
+        "map_Ns textures/%06u_highlight.png\n"
+        "map_d -imfchan m textures/%06u_alpha.png\n"
+        "bump -bm 0.8 textures/%06u_bump.png\n"
+        "map_Pr textures/%06u_roughness.png\n"
+        "map_Pm -mm 0 1 textures/%06u_metallic.png\n\n",
+        i, i, i, i, i, i, i, i, i);
+}
+
+// Colors written with full precision, stressing float parsing.
+static size_t writeColorMaterial(char *output, size_t capacity, unsigned int i) {
+    float x = (i % 1000) / 999.0f;
+    return snprintf(output, capacity,
+        "newmtl colored_%06u\n"
+        "Ka %.9g %.9g %.9g\nKd %.9g %.9g %.9g\nKs %.9g %.9g %.9g\n"
+        "Ke %.9g %.9g %.9g\nTf %.9g %.9g %.9g\n\n",
+        i, x, x / 3, x / 7, 1 - x, x / 11, x / 13, x / 17, 1 - x / 2, x / 19,
+        x / 23, x / 29, x / 31, 1 - x / 3, x / 37, x / 41);
+}
+
+struct Corpus {
+    const char *name;
+    MaterialWriter writer;
+};
+
+static const struct Corpus corpora[] = {
+    {"tiny", writeTinyMaterial},
+    {"heavy", writeHeavyMaterial},
+    {"textures", writeTextureMaterial},
+    {"colors", writeColorMaterial}
+};
+
+// Sizes chosen to fit in cache and to spill out of it.
+static const size_t corpusSizes[] = {64 * 1024, 1024 * 1024};
+
+// Whole materials are written until size bytes are reached.
+static char *generateCorpus(MaterialWriter writer, size_t size, size_t *length) {
+    size_t capacity = size + 16384;
+    char *output = malloc(capacity);
+    if(!output) return NULL;
+    *length = 0;
+    for(unsigned int i = 0; *length < size; i++) {
+        *length += writer(output + *length, capacity - *length, i);
+    }
+    return output;
+}
+
+struct CorpusResult {
+    size_t bytes;
+    unsigned int materials;
+    double parseBytesPerSecond;
+    double parseMaterialsPerSecond;
+    double releaseMaterialsPerSecond;
+    double allocationsPerMaterial;
+    double allocatedBytesPerMaterial;
+    unsigned long long peakResidentKiB;
+};
+
+static int measureCorpus(struct CorpusResult *result, const char *input, size_t length) {
+    memset(result, 0, sizeof(struct CorpusResult));
+    result->bytes = length;
+
+    struct WavefrontMTL mtl;
+    allocations = allocatedBytes = 0;
+    counting = 1;
+    int status = parseWavefrontMTLFromString(&mtl, input);
+    counting = 0;
+    if(status) return status;
+    result->materials = mtl.materialCount;
+    wavefrontMTLRelease(&mtl);
+    if(result->materials) {
+        result->allocationsPerMaterial = (double)allocations / result->materials;
+        result->allocatedBytesPerMaterial = (double)allocatedBytes / result->materials;
+    }
+
+    // Each library is released before the next parse, with release timed on
+    // its own and left out of parse throughput.
+    unsigned int iterations = 0;
+    clock_t start = clock(), elapsed = 0, releaseElapsed = 0;
+    do {
+        if(parseWavefrontMTLFromString(&mtl, input)) break;
+        clock_t released = clock();
+        wavefrontMTLRelease(&mtl);
+        releaseElapsed += clock() - released;
+        iterations++;
+        elapsed = clock() - start;
+    } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+    double parseSeconds = (double)(elapsed - releaseElapsed) / CLOCKS_PER_SEC;
+    double releaseSeconds = (double)releaseElapsed / CLOCKS_PER_SEC;
+    double materials = (double)iterations * result->materials;
+    if(parseSeconds > 0) {
+        result->parseBytesPerSecond = iterations * (double)length / parseSeconds;
+        result->parseMaterialsPerSecond = materials / parseSeconds;
+    }
+    if(releaseSeconds > 0) result->releaseMaterialsPerSecond = materials / releaseSeconds;
+    result->peakResidentKiB = peakResidentKiB();
+    return STATUS_OK;
+}
+
+static void printCorpus(const char *name, const struct CorpusResult *r, int json) {
+#ifdef WAVEFRONT_BENCH_COUNT_ALLOCATIONS
+    int counted = 1;
+#else
+    int counted = 0;
+#endif
+    if(json) {
+        printf("{\"corpus\":\"%s\",\"bytes\":%lu,\"materials\":%u,"
+            "\"parse_mb_per_sec\":%.3f,\"parse_materials_per_sec\":%.0f,"
+            "\"release_materials_per_sec\":%.0f,",
+            name, (unsigned long)r->bytes, r->materials,
+            r->parseBytesPerSecond / 1e6, r->parseMaterialsPerSecond,
+            r->releaseMaterialsPerSecond);
+        if(counted) {
+            printf("\"allocations_per_material\":%.3f,\"allocated_bytes_per_material\":%.1f,",
+                r->allocationsPerMaterial, r->allocatedBytesPerMaterial);
+        } else {
+            printf("\"allocations_per_material\":null,\"allocated_bytes_per_material\":null,");
+        }
+        printf("\"peak_rss_kib\":%llu}\n", r->peakResidentKiB);
+        return;
+    }
+    char label[64];
+    snprintf(label, sizeof(label), "corpus %s %lu KiB", name, (unsigned long)(r->bytes / 1024));
+    printf("%-28s %8.1f MB/sec %10.0f materials/sec %10.0f released/sec",
+        label, r->parseBytesPerSecond / 1e6, r->parseMaterialsPerSecond,
+        r->releaseMaterialsPerSecond);
+    if(counted) printf(" %6.2f allocs/material", r->allocationsPerMaterial);
+    printf(" %8llu KiB peak RSS\n", r->peakResidentKiB);
+}
+
+// Parse and release throughput over synthetic corpora of several shapes and
+// sizes, one line per corpus. Peak RSS is that of the whole process so far.
+void wavefrontMaterialCorpusBench(int json) {
+    for(unsigned int i = 0; i < sizeof(corpora)/sizeof(corpora[0]); i++) {
+        for(unsigned int j = 0; j < sizeof(corpusSizes)/sizeof(corpusSizes[0]); j++) {
+            size_t length;
+            char *input = generateCorpus(corpora[i].writer, corpusSizes[j], &length);
+            if(!input) return;
+            struct CorpusResult result;
+            if(measureCorpus(&result, input, length) == STATUS_OK) {
+                printCorpus(corpora[i].name, &result, json);
+            }
+            free(input);
+        }
+    }
+}
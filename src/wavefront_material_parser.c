@@ -1,153 +1,1291 @@
 #include <stdlib.h>
+#include <stddef.h>
 #include "cutil/src/error.h"
 #include "cutil/src/string.h"
+#include "wavefront_allocator.h"
 #include "wavefront_material_parser.h"
+#include "wavefront_file.h"
+#include "wavefront_number.h"
+#include "wavefront_scan.h"
+#include "wavefront_thread.h"
 
-static int parseNewMaterial(void *output, const char *line) {
-    struct WavefrontMTL *mtl = output;
-    if(!line) return STATUS_PARSE_ERR;
+#ifdef WAVEFRONT_MTL_STATS
+#include <time.h>
+#define STATS_ADD(parser, field, value) do { \
+    if((parser)->stats) (parser)->stats->field += (value); \
+} while(0)
+#else
+#define STATS_ADD(parser, field, value) ((void)0)
+#endif
 
-    const char *thisToken = line, *nextDelim = NULL, *nextToken = NULL;
-    if (tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS) &&
-        nextToken == NULL
-    ) {
-        char *temp = strCopyN(thisToken, nextDelim-thisToken);
-        if(temp == NULL) return STATUS_ALLOC_ERR;
+// Smallest piece of input worth handing to another thread.
+#define PARALLEL_MIN_PIECE 65536
+// Pieces per thread, letting threads that finish early take more work.
+#define PARALLEL_PIECES_PER_THREAD 4
+// Line ends found per call to the scan kernel, and bytes it scans at most.
+#define LINE_BATCH 256
+#define LINE_WINDOW 65536
 
-        int result = wavefrontMTLAddMaterial(mtl, temp);
+static int isHorizontalSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+static const char *skipSpace(const char *input, const char *end) {
+    while(input < end && isHorizontalSpace(*input)) input++;
+    return input;
+}
+
+static const char *skipToken(const char *input, const char *end) {
+    while(input < end && !isHorizontalSpace(*input)) input++;
+    return input;
+}
+
+static const char *trimSpace(const char *begin, const char *end) {
+    while(end > begin && isHorizontalSpace(end[-1])) end--;
+    return end;
+}
+
+// Line ends of [scan, end) found a batch at a time.
+struct LineScanner {
+    const char *scan; // Where the next batch starts.
+    const char *end;
+    const char *base; // Start of the current batch.
+    int kernel;
+    size_t count;
+    size_t next;
+    unsigned int ends[LINE_BATCH];
+};
+
+static void lineScannerCompose(struct LineScanner *lines, const char *input, const char *end) {
+    lines->scan = lines->base = input;
+    lines->end = end;
+    lines->kernel = wavefrontScanKernel();
+    lines->count = lines->next = 0;
+}
+
+// Return the next '\n' or '\r', or end when none is left.
+static const char *nextLineEnd(struct LineScanner *lines) {
+    while(lines->next == lines->count) {
+        if(lines->scan == lines->end) return lines->end;
+        size_t length = lines->end - lines->scan;
+        if(length > LINE_WINDOW) length = LINE_WINDOW;
+        lines->base = lines->scan;
+        lines->count = wavefrontFindLineEnds(lines->kernel, lines->scan, length, lines->ends, LINE_BATCH);
+        lines->next = 0;
+        // A full batch may have stopped short of the window.
+        lines->scan = lines->count == LINE_BATCH ?
+            lines->base + lines->ends[LINE_BATCH - 1] + 1 : lines->scan + length;
+    }
+    return lines->base + lines->ends[lines->next++];
+}
+
+static int parseNewMaterial(struct WavefrontMTLParser *state, const char *input, const char *end) {
+    struct WavefrontMTL *mtl = state->mtl;
+    const char *nameEnd = skipToken(input, end);
+    // Names with embedded whitespace are ignored.
+    if(nameEnd == input || trimSpace(nameEnd, end) != nameEnd) return STATUS_OK;
+
+    int index = wavefrontMTLFindMaterialN(mtl, input, nameEnd - input);
+    if(index >= 0) STATS_ADD(state, duplicateMaterials, 1);
+    if(index < 0 && state->selectOnly) {
+        state->material = NULL;
+        return STATUS_OK;
+    }
+    if(index < 0) {
+        char *name = wavefrontMTLCopyString(mtl, input, nameEnd - input);
+        if(name == NULL) return STATUS_ALLOC_ERR;
+
+        int result = wavefrontMTLAddMaterial(mtl, name);
         if(result) {
-            free(temp);
+            wavefrontMTLFreeString(mtl, name);
             return result;
         }
+        index = mtl->materialCount - 1;
+        STATS_ADD(state, materials, 1);
     }
+    state->material = mtl->materials + index;
     return STATUS_OK;
 }
 
-static int parseColor(void *output, const char *input) {
-    struct WavefrontColor *color = output;
+// Fail the statement being parsed for the given reason.
+static int parseError(struct WavefrontMTLParser *state, enum WavefrontMTLError error) {
+    state->error = error;
+    return STATUS_PARSE_ERR;
+}
+
+static int parseColor(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    // Parsed aside so a malformed line leaves the color as it was.
+    struct WavefrontColor color;
+    float *channels[] = {&color.r, &color.g, &color.b};
 
-    const char *thisToken = input, *nextDelim = NULL, *nextToken = NULL;
-    // Parse Red.
-    tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS);
-    if(*thisToken==*nextDelim) return STATUS_PARSE_ERR; // Red must be specified.
-    char *end = NULL;
-    color->r = strtof(thisToken, &end);
-    if(end != nextDelim)
-        return STATUS_PARSE_ERR;
+    int count = 0;
+    for(input = skipSpace(input, end); input < end; input = skipSpace(input, end)) {
+        if(count == 3) return parseError(state, WAVEFRONT_MTL_ERROR_EXTRA_VALUE);
+        const char *tokenEnd = skipToken(input, end);
+        const char *last = parseWavefrontFloat(input, tokenEnd, channels[count++]);
+        if(last == input || last != tokenEnd) return parseError(state, WAVEFRONT_MTL_ERROR_BAD_VALUE);
+        input = tokenEnd;
+    }
+    // Red must be specified.
+    if(count == 0) return parseError(state, WAVEFRONT_MTL_ERROR_MISSING_VALUE);
+    // Green and blue default to red if omitted.
+    if(count < 2) color.g = color.r;
+    if(count < 3) color.b = color.r;
+    color.a = 1.0;
+    *(struct WavefrontColor*)output = color;
+    return STATUS_OK;
+}
 
-    color->a = 1.0;
+// Like atoi, leading digits are used and anything else reads as zero.
+static int parseInteger(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    int value = 0;
+    parseWavefrontInteger(input, end, &value);
+    *((int*)output) = value;
+    return STATUS_OK;
+}
 
-    // Parse Green.
-    if (!tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS) ||
-        thisToken == nextDelim) {
-        // Green and blue default to red if omitted.
-        color->g = color->b = color->r;
-        return STATUS_OK;
+// Like atof, a leading number is used and anything else reads as zero.
+static int parseFloat(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    float value = 0;
+    parseWavefrontFloat(input, end, &value);
+    *((float*)output) = value;
+    return STATUS_OK;
+}
+
+// Tr is the complement of d.
+static int parseTransparency(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    float value = 0;
+    parseWavefrontFloat(input, end, &value);
+    *((float*)output) = 1 - value;
+    return STATUS_OK;
+}
+
+// Compare a token of known length against a keyword.
+static int tokenIs(const char *token, size_t length, const char *keyword, size_t keywordLength) {
+    return length == keywordLength && memcmp(token, keyword, length) == 0;
+}
+
+// Parse up to count numbers into output, returning the start of whatever
+// follows or NULL if fewer than required were found.
+static const char *parseOptionFloats(const char *input, const char *end, float *output, int required, int count) {
+    for(int i = 0; i < count; i++) {
+        const char *tokenEnd = skipToken(input, end);
+        float value;
+        if(input == tokenEnd || parseWavefrontFloat(input, tokenEnd, &value) != tokenEnd) {
+            return i < required ? NULL : input;
+        }
+        output[i] = value;
+        input = skipSpace(tokenEnd, end);
     }
-    color->g = strtof(thisToken, &end);
-    if(end != nextDelim)
-        return STATUS_PARSE_ERR;
+    return input;
+}
 
-    // Parse Blue.
-    if (!tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS) ||
-        thisToken == nextDelim) {
-        // Blue defaults to red if omitted.
-        color->b = color->r;
-        return STATUS_OK;
+static const char *parseOptionSwitch(const char *input, const char *end, unsigned int *flags, unsigned int flag) {
+    const char *valueEnd = skipToken(input, end);
+    size_t length = valueEnd - input;
+    if(tokenIs(input, length, "on", 2)) {
+        *flags |= flag;
+    } else if(tokenIs(input, length, "off", 3)) {
+        *flags &= ~flag;
+    } else {
+        return NULL;
     }
-    color->b = strtof(thisToken, &end);
-    if(end != nextDelim)
-        return STATUS_PARSE_ERR;
+    return skipSpace(valueEnd, end);
+}
+
+// Parse the options preceding a map file into options, returning the start
+// of the file. The value of -type is returned through type, unknown options
+// are assumed to take a single argument. A known option with a malformed
+// argument keeps its defaults and the argument is skipped as for unknown
+// options, unless it is the last token and so the file. Malformed is set for
+// either.
+static const char *parseMapOptions(
+    struct WavefrontMapOptions *options,
+    const char *input,
+    const char *end,
+    const char **type,
+    size_t *typeLength,
+    int *malformed
+) {
+    while(input < end && *input == '-') {
+        const char *name = input + 1;
+        const char *nameEnd = skipToken(input, end);
+        size_t length = nameEnd - name;
+        const char *argument = skipSpace(nameEnd, end);
+        const char *valueEnd = skipToken(argument, end);
+        input = argument;
 
-    return nextToken == NULL ? STATUS_OK : STATUS_PARSE_ERR;
+        if(tokenIs(name, length, "o", 1)) {
+            input = parseOptionFloats(input, end, options->offset, 1, 3);
+        } else if(tokenIs(name, length, "s", 1)) {
+            input = parseOptionFloats(input, end, options->scale, 1, 3);
+        } else if(tokenIs(name, length, "t", 1)) {
+            input = parseOptionFloats(input, end, options->turbulence, 1, 3);
+        } else if(tokenIs(name, length, "bm", 2)) {
+            input = parseOptionFloats(input, end, &options->bumpMultiplier, 1, 1);
+        } else if(tokenIs(name, length, "boost", 5)) {
+            input = parseOptionFloats(input, end, &options->boost, 1, 1);
+        } else if(tokenIs(name, length, "mm", 2)) {
+            float mm[2];
+            input = parseOptionFloats(input, end, mm, 2, 2);
+            if(input) {
+                options->base = mm[0];
+                options->gain = mm[1];
+            }
+        } else if(tokenIs(name, length, "texres", 6)) {
+            int resolution;
+            if(input == valueEnd || parseWavefrontInteger(input, valueEnd, &resolution) != valueEnd) {
+                input = NULL;
+            } else {
+                options->resolution = resolution;
+                input = skipSpace(valueEnd, end);
+            }
+        } else if(tokenIs(name, length, "imfchan", 7)) {
+            if(valueEnd - input != 1 || !memchr("rgbmlz", *input, 6)) {
+                input = NULL;
+            } else {
+                options->channel = *input;
+                input = skipSpace(valueEnd, end);
+            }
+        } else if(tokenIs(name, length, "blendu", 6)) {
+            input = parseOptionSwitch(input, end, &options->flags, WAVEFRONT_MAP_BLENDU);
+        } else if(tokenIs(name, length, "blendv", 6)) {
+            input = parseOptionSwitch(input, end, &options->flags, WAVEFRONT_MAP_BLENDV);
+        } else if(tokenIs(name, length, "cc", 2)) {
+            input = parseOptionSwitch(input, end, &options->flags, WAVEFRONT_MAP_COLOR_CORRECTION);
+        } else if(tokenIs(name, length, "clamp", 5)) {
+            input = parseOptionSwitch(input, end, &options->flags, WAVEFRONT_MAP_CLAMP);
+        } else {
+            if(tokenIs(name, length, "type", 4) && type) {
+                *type = input;
+                *typeLength = valueEnd - input;
+            }
+            input = skipSpace(valueEnd, end);
+        }
+        if(!input) {
+            *malformed = 1;
+            input = skipSpace(valueEnd, end);
+            if(input == end) input = argument;
+        }
+    }
+    return input;
 }
 
-static int parseInteger(void *output, const char *input) {
-    *((int*)output) = atoi(input);
+// Intern the file in [input, end) and options as those of map, keeping the
+// map as it was when there is no file.
+static int assignMap(
+    struct WavefrontMTLParser *state,
+    struct WavefrontMap *map,
+    const struct WavefrontMapOptions *options,
+    const char *input,
+    const char *end
+) {
+    end = trimSpace(input, end);
+    if(input == end) return STATUS_OK;
+
+    unsigned int texture = 0, index = 0;
+    int result = wavefrontMTLInternTexture(state->mtl, input, end - input, &texture);
+    if(!result) result = wavefrontMTLInternMapOptions(state->mtl, options, &index);
+    if(result) return result;
+    if(!map->texture) wavefrontMTLFreeString(state->mtl, map->file);
+    map->file = state->mtl->textures[texture - 1];
+    map->texture = texture;
+    map->options = index;
     return STATUS_OK;
 }
 
-static int parseFloat(void *output, const char *input) {
-    *((float*)output) = atof(input);
-    return STATUS_OK;
+static int parseMap(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    struct WavefrontMapOptions options;
+    wavefrontMapOptionsCompose(&options);
+    int malformed = 0;
+    input = parseMapOptions(&options, input, end, NULL, NULL, &malformed);
+    int result = assignMap(state, output, &options, input, end);
+    // Only a tolerant parse reports options it skipped.
+    if(!result && malformed && state->diagnostics) return parseError(state, WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    return result;
 }
 
-static int parseMap(void *output, const char *input) {
-    struct WavefrontMap *map = output;
+enum Keyword {
+    KEYWORD_UNKNOWN,
+    KEYWORD_NEWMTL,
+    KEYWORD_KA,
+    KEYWORD_KD,
+    KEYWORD_KS,
+    KEYWORD_KE,
+    KEYWORD_TF,
+    KEYWORD_TR,
+    KEYWORD_ILLUM,
+    KEYWORD_NS,
+    KEYWORD_NI,
+    KEYWORD_D,
+    KEYWORD_PR,
+    KEYWORD_PM,
+    KEYWORD_PS,
+    KEYWORD_PC,
+    KEYWORD_PCR,
+    KEYWORD_ANISO,
+    KEYWORD_ANISOR,
+    KEYWORD_MAP_KA,
+    KEYWORD_MAP_KD,
+    KEYWORD_MAP_KS,
+    KEYWORD_MAP_KE,
+    KEYWORD_MAP_KN,
+    KEYWORD_MAP_NS,
+    KEYWORD_MAP_D,
+    KEYWORD_MAP_PR,
+    KEYWORD_MAP_PM,
+    KEYWORD_MAP_PS,
+    KEYWORD_BUMP,
+    KEYWORD_DISP,
+    KEYWORD_DECAL,
+    KEYWORD_REFL
+};
 
-    const char *thisToken = input, *nextDelim = NULL, *nextToken = NULL;
-    while (tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS)) {
-        if(strStartsWith(thisToken, "-")) {
-            tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS);
-        } else {
+// Classify the suffix of a six character "map_XY" keyword.
+static enum Keyword classifyMap(char x, char y) {
+    switch(x) {
+    case 'K':
+        switch(y) {
+        case 'a': return KEYWORD_MAP_KA;
+        case 'd': return KEYWORD_MAP_KD;
+        case 's': return KEYWORD_MAP_KS;
+        case 'e': return KEYWORD_MAP_KE;
+        case 'n': return KEYWORD_MAP_KN;
+        }
+        break;
+    case 'N':
+        if(y == 's') return KEYWORD_MAP_NS;
+        break;
+    case 'P':
+        switch(y) {
+        case 'r': return KEYWORD_MAP_PR;
+        case 'm': return KEYWORD_MAP_PM;
+        case 's': return KEYWORD_MAP_PS;
+        }
+        break;
+    }
+    return KEYWORD_UNKNOWN;
+}
+
+// Classify a statement keyword by its length and leading characters. Each
+// keyword is confirmed by at most one comparison, so the cost per line does
+// not grow with the number of keywords.
+static enum Keyword classifyKeyword(const char *k, size_t length) {
+    switch(length) {
+    case 1:
+        if(k[0] == 'd') return KEYWORD_D;
+        break;
+    case 2:
+        switch(k[0]) {
+        case 'K':
+            switch(k[1]) {
+            case 'a': return KEYWORD_KA;
+            case 'd': return KEYWORD_KD;
+            case 's': return KEYWORD_KS;
+            case 'e': return KEYWORD_KE;
+            }
             break;
+        case 'N':
+            switch(k[1]) {
+            case 's': return KEYWORD_NS;
+            case 'i': return KEYWORD_NI;
+            }
+            break;
+        case 'T':
+            switch(k[1]) {
+            case 'f': return KEYWORD_TF;
+            case 'r': return KEYWORD_TR;
+            }
+            break;
+        case 'P':
+            switch(k[1]) {
+            case 'r': return KEYWORD_PR;
+            case 'm': return KEYWORD_PM;
+            case 's': return KEYWORD_PS;
+            case 'c': return KEYWORD_PC;
+            }
+            break;
+        }
+        break;
+    case 3:
+        if(memcmp(k, "Pcr", 3) == 0) return KEYWORD_PCR;
+        break;
+    case 4:
+        switch(k[0]) {
+        case 'r': return memcmp(k, "refl", 4) == 0 ? KEYWORD_REFL : KEYWORD_UNKNOWN;
+        case 'b': return memcmp(k, "bump", 4) == 0 ? KEYWORD_BUMP : KEYWORD_UNKNOWN;
+        case 'd': return memcmp(k, "disp", 4) == 0 ? KEYWORD_DISP : KEYWORD_UNKNOWN;
+        case 'n': return memcmp(k, "norm", 4) == 0 ? KEYWORD_MAP_KN : KEYWORD_UNKNOWN;
+        }
+        break;
+    case 5:
+        switch(k[0]) {
+        case 'i': return memcmp(k, "illum", 5) == 0 ? KEYWORD_ILLUM : KEYWORD_UNKNOWN;
+        case 'd': return memcmp(k, "decal", 5) == 0 ? KEYWORD_DECAL : KEYWORD_UNKNOWN;
+        case 'a': return memcmp(k, "aniso", 5) == 0 ? KEYWORD_ANISO : KEYWORD_UNKNOWN;
+        case 'm': return memcmp(k, "map_d", 5) == 0 ? KEYWORD_MAP_D : KEYWORD_UNKNOWN;
+        }
+        break;
+    case 6:
+        switch(k[0]) {
+        case 'n': return memcmp(k, "newmtl", 6) == 0 ? KEYWORD_NEWMTL : KEYWORD_UNKNOWN;
+        case 'a': return memcmp(k, "anisor", 6) == 0 ? KEYWORD_ANISOR : KEYWORD_UNKNOWN;
+        case 'm': return memcmp(k, "map_", 4) == 0 ? classifyMap(k[4], k[5]) : KEYWORD_UNKNOWN;
+        }
+        break;
+    case 8:
+        // Both capitalisations of map_bump are common.
+        if(memcmp(k, "map_", 4) == 0 && (k[4] == 'b' || k[4] == 'B') && memcmp(k + 5, "ump", 3) == 0) {
+            return KEYWORD_BUMP;
+        }
+        break;
+    }
+    return KEYWORD_UNKNOWN;
+}
+
+// Find the reflection map selected by the "-type" option of a refl statement.
+static struct WavefrontMap *reflectionMap(struct WavefrontMaterial *m, const char *type, size_t length) {
+    if(tokenIs(type, length, "sphere", 6)) return &m->reflectionMapSphere;
+    if(length < 8 || memcmp(type, "cube_", 5) != 0) return NULL;
+    switch(type[5]) {
+    case 't':
+        return tokenIs(type, length, "cube_top", 8) ? &m->reflectionMapCubeTop : NULL;
+    case 'b':
+        if(tokenIs(type, length, "cube_bottom", 11)) return &m->reflectionMapCubeBottom;
+        return tokenIs(type, length, "cube_back", 9) ? &m->reflectionMapCubeBack : NULL;
+    case 'f':
+        return tokenIs(type, length, "cube_front", 10) ? &m->reflectionMapCubeFront : NULL;
+    case 'l':
+        return tokenIs(type, length, "cube_left", 9) ? &m->reflectionMapCubeLeft : NULL;
+    case 'r':
+        return tokenIs(type, length, "cube_right", 10) ? &m->reflectionMapCubeRight : NULL;
+    }
+    return NULL;
+}
+
+struct Parser {
+    int (*fn)(struct WavefrontMTLParser *state, void *output, const char *input, const char *end);
+    size_t offset; // Location of the property within WavefrontMaterial.
+};
+
+// Property parsers indexed by keyword.
+static const struct Parser parsers[] = {
+    [KEYWORD_KA] = {parseColor, offsetof(struct WavefrontMaterial, ambient)},
+    [KEYWORD_KD] = {parseColor, offsetof(struct WavefrontMaterial, diffuse)},
+    [KEYWORD_KS] = {parseColor, offsetof(struct WavefrontMaterial, specular)},
+    [KEYWORD_KE] = {parseColor, offsetof(struct WavefrontMaterial, emission)},
+    [KEYWORD_TF] = {parseColor, offsetof(struct WavefrontMaterial, transmission)},
+    [KEYWORD_TR] = {parseTransparency, offsetof(struct WavefrontMaterial, dissolve)},
+    [KEYWORD_ILLUM] = {parseInteger, offsetof(struct WavefrontMaterial, illuminationModel)},
+    [KEYWORD_NS] = {parseFloat, offsetof(struct WavefrontMaterial, specularExponent)},
+    [KEYWORD_NI] = {parseFloat, offsetof(struct WavefrontMaterial, opticalDensity)},
+    [KEYWORD_D] = {parseFloat, offsetof(struct WavefrontMaterial, dissolve)},
+    [KEYWORD_PR] = {parseFloat, offsetof(struct WavefrontMaterial, roughness)},
+    [KEYWORD_PM] = {parseFloat, offsetof(struct WavefrontMaterial, metallic)},
+    [KEYWORD_PS] = {parseFloat, offsetof(struct WavefrontMaterial, sheen)},
+    [KEYWORD_PC] = {parseFloat, offsetof(struct WavefrontMaterial, clearcoatThickness)},
+    [KEYWORD_PCR] = {parseFloat, offsetof(struct WavefrontMaterial, clearcoatRoughness)},
+    [KEYWORD_ANISO] = {parseFloat, offsetof(struct WavefrontMaterial, anisotropy)},
+    [KEYWORD_ANISOR] = {parseFloat, offsetof(struct WavefrontMaterial, anisotropyRotation)},
+    [KEYWORD_MAP_KA] = {parseMap, offsetof(struct WavefrontMaterial, ambientMap)},
+    [KEYWORD_MAP_KD] = {parseMap, offsetof(struct WavefrontMaterial, diffuseMap)},
+    [KEYWORD_MAP_KS] = {parseMap, offsetof(struct WavefrontMaterial, specularColorMap)},
+    [KEYWORD_MAP_KE] = {parseMap, offsetof(struct WavefrontMaterial, emissionMap)},
+    [KEYWORD_MAP_KN] = {parseMap, offsetof(struct WavefrontMaterial, normalMap)},
+    [KEYWORD_MAP_NS] = {parseMap, offsetof(struct WavefrontMaterial, specularHighlightMap)},
+    [KEYWORD_MAP_D] = {parseMap, offsetof(struct WavefrontMaterial, alphaMap)},
+    [KEYWORD_MAP_PR] = {parseMap, offsetof(struct WavefrontMaterial, roughnessMap)},
+    [KEYWORD_MAP_PM] = {parseMap, offsetof(struct WavefrontMaterial, metallicMap)},
+    [KEYWORD_MAP_PS] = {parseMap, offsetof(struct WavefrontMaterial, sheenMap)},
+    [KEYWORD_BUMP] = {parseMap, offsetof(struct WavefrontMaterial, bumpMap)},
+    [KEYWORD_DISP] = {parseMap, offsetof(struct WavefrontMaterial, displacementMap)},
+    [KEYWORD_DECAL] = {parseMap, offsetof(struct WavefrontMaterial, decalMap)}
+};
+
+static int parseStatement(struct WavefrontMTLParser *state, enum Keyword keyword, const char *arguments, const char *end) {
+    if(keyword == KEYWORD_UNKNOWN) return STATUS_OK;
+    if(keyword == KEYWORD_NEWMTL) {
+        return parseNewMaterial(state, arguments, end);
+    }
+    // Properties preceding the first material have nowhere to go.
+    struct WavefrontMaterial *m = state->material;
+    if(!m) return STATUS_OK;
+
+    if(keyword == KEYWORD_REFL) {
+        struct WavefrontMapOptions options;
+        wavefrontMapOptionsCompose(&options);
+        const char *type = NULL;
+        size_t typeLength = 0;
+        int malformed = 0;
+        const char *file = parseMapOptions(&options, arguments, end, &type, &typeLength, &malformed);
+        struct WavefrontMap *map = type ? reflectionMap(m, type, typeLength) : NULL;
+        int result = map ? assignMap(state, map, &options, file, end) : STATUS_OK;
+        if(!result && malformed && state->diagnostics) return parseError(state, WAVEFRONT_MTL_ERROR_MAP_OPTION);
+        return result;
+    }
+    return parsers[keyword].fn(state, (char*)m + parsers[keyword].offset, arguments, end);
+}
+
+#ifdef WAVEFRONT_MTL_STATS
+static enum WavefrontMTLStatement statementClass(enum Keyword keyword) {
+    if(keyword == KEYWORD_NEWMTL) return WAVEFRONT_MTL_STATEMENT_MATERIAL;
+    if(keyword == KEYWORD_REFL || parsers[keyword].fn == parseMap) return WAVEFRONT_MTL_STATEMENT_MAP;
+    if(parsers[keyword].fn == parseColor) return WAVEFRONT_MTL_STATEMENT_COLOR;
+    return parsers[keyword].fn ? WAVEFRONT_MTL_STATEMENT_SCALAR : WAVEFRONT_MTL_STATEMENT_OTHER;
+}
+
+static int parseStatementTimed(struct WavefrontMTLParser *state, enum Keyword keyword, const char *arguments, const char *end) {
+    struct timespec start, stop;
+    timespec_get(&start, TIME_UTC);
+    int result = parseStatement(state, keyword, arguments, end);
+    timespec_get(&stop, TIME_UTC);
+
+    enum WavefrontMTLStatement statement = statementClass(keyword);
+    state->stats->lines++;
+    state->stats->statements[statement]++;
+    state->stats->nanoseconds[statement] +=
+        (stop.tv_sec - start.tv_sec) * 1000000000LL + (stop.tv_nsec - start.tv_nsec);
+    return result;
+}
+#endif
+
+static int parseLine(struct WavefrontMTLParser *state, const char *input, const char *end) {
+    input = skipSpace(input, end);
+    const char *keywordEnd = skipToken(input, end);
+    // Statements without arguments are ignored.
+    enum Keyword keyword = keywordEnd == end ? KEYWORD_UNKNOWN : classifyKeyword(input, keywordEnd - input);
+    const char *arguments = skipSpace(keywordEnd, end);
+#ifdef WAVEFRONT_MTL_STATS
+    if(state->stats) return parseStatementTimed(state, keyword, arguments, end);
+#endif
+    return parseStatement(state, keyword, arguments, end);
+}
+
+// Whether the line that just failed can be skipped rather than failing the
+// parse.
+static int tolerated(const struct WavefrontMTLParser *parser) {
+    return parser->result == STATUS_PARSE_ERR && parser->diagnostics;
+}
+
+// Add the '\n' line ends in [parser->counted, line) to parser->lines, which
+// only failed lines need.
+static unsigned long long countLines(struct WavefrontMTLParser *parser, const char *line) {
+    // Locals keep the loop in registers, and let it vectorize.
+    unsigned long long lines = 0;
+    for(const char *c = parser->counted; c < line; c++) lines += *c == '\n';
+    if(line > parser->counted) parser->counted = line;
+    return parser->lines += lines;
+}
+
+// Record the failed line [input, end) and carry on without it.
+static void skipLine(
+    struct WavefrontMTLParser *parser,
+    const char *input,
+    const char *end,
+    unsigned long long line,
+    unsigned long long offset
+) {
+    struct WavefrontMTLDiagnostics *diagnostics = parser->diagnostics;
+    if(diagnostics->count < diagnostics->capacity) {
+        struct WavefrontMTLDiagnostic *diagnostic = diagnostics->items + diagnostics->count++;
+        diagnostic->line = line;
+        diagnostic->offset = offset;
+        diagnostic->error = parser->error;
+        input = skipSpace(input, end);
+        size_t length = skipToken(input, end) - input;
+        if(length >= sizeof(diagnostic->keyword)) length = sizeof(diagnostic->keyword) - 1;
+        memcpy(diagnostic->keyword, input, length);
+        diagnostic->keyword[length] = '\0';
+    }
+    diagnostics->total++;
+    parser->result = STATUS_OK;
+}
+
+// Skip a failed line lying within parser->chunk.
+static void skipChunkLine(struct WavefrontMTLParser *parser, const char *input, const char *end) {
+    skipLine(parser, input, end, countLines(parser, input) + 1, parser->offset + (input - parser->chunk));
+}
+
+// Count allocations into the parser's stats until parserUntrack, restoring
+// whatever was tracked before.
+static void parserTrack(struct WavefrontMTLParser *parser) {
+#ifdef WAVEFRONT_MTL_STATS
+    if(parser->stats) parser->trackedBefore = wavefrontTrackAllocations(&parser->stats->allocation);
+#endif
+}
+
+static void parserUntrack(struct WavefrontMTLParser *parser) {
+#ifdef WAVEFRONT_MTL_STATS
+    if(parser->stats) wavefrontTrackAllocations(parser->trackedBefore);
+#endif
+}
+
+static int parserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options
+) {
+    parser->mtl = mtl;
+    parser->material = NULL;
+    parser->pending = NULL;
+    parser->pendingLength = 0;
+    parser->pendingCapacity = 0;
+    parser->result = STATUS_OK;
+    parser->selectOnly = 0;
+    parser->stats = options ? options->stats : NULL;
+    parser->trackedBefore = NULL;
+    parser->allocator = options ? options->allocator : NULL;
+    parser->diagnostics = options ? options->diagnostics : NULL;
+    parser->error = WAVEFRONT_MTL_ERROR_MISSING_VALUE;
+    parser->chunk = parser->counted = NULL;
+    parser->lines = parser->offset = 0;
+    if(parser->stats) memset(parser->stats, 0, sizeof(struct WavefrontMTLStats));
+    if(parser->diagnostics) parser->diagnostics->count = parser->diagnostics->total = 0;
+    parserTrack(parser);
+
+    wavefrontMTLCompose(mtl);
+    if(options) mtl->flags = options->flags;
+    mtl->allocator = parser->allocator;
+    if(options && options->materialCapacity &&
+        wavefrontMTLReserve(mtl, options->materialCapacity)) {
+        parser->result = STATUS_ALLOC_ERR;
+    }
+    return parser->result;
+}
+
+// Parse each complete line of [input, end), returning the start of any
+// unterminated line left over.
+static const char *parseLines(struct WavefrontMTLParser *parser, const char *input, const char *end) {
+    struct LineScanner lines;
+    lineScannerCompose(&lines, input, end);
+    for(const char *lineEnd = nextLineEnd(&lines); lineEnd < end; lineEnd = nextLineEnd(&lines)) {
+        parser->result = parseLine(parser, input, lineEnd);
+        if(tolerated(parser)) skipChunkLine(parser, input, lineEnd);
+        if(parser->result) break;
+        input = lineEnd + 1;
+    }
+    return input;
+}
+
+static int parserFail(struct WavefrontMTLParser *parser) {
+    wavefrontFreeWith(parser->allocator, parser->pending);
+    parser->pending = NULL;
+    parser->pendingLength = parser->pendingCapacity = 0;
+    wavefrontMTLRelease(parser->mtl);
+    return parser->result;
+}
+
+int wavefrontMTLParserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options
+) {
+    if(parserCompose(parser, mtl, options)) parserFail(parser);
+    parserUntrack(parser);
+    return parser->result;
+}
+
+static int parserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length) {
+    if(parser->result) return parser->result;
+    if(!chunk) return STATUS_INPUT_ERR;
+    const char *end = chunk + length;
+    STATS_ADD(parser, bytes, length);
+    parser->chunk = parser->counted = chunk;
+
+    // Complete the line carried over from the previous chunk.
+    if(parser->pendingLength) {
+        unsigned long long offset = parser->offset - parser->pendingLength;
+        struct LineScanner lines;
+        lineScannerCompose(&lines, chunk, end);
+        const char *lineEnd = nextLineEnd(&lines);
+        size_t needed = parser->pendingLength + (lineEnd - chunk);
+        if(needed > parser->pendingCapacity) {
+            size_t capacity = parser->pendingCapacity * 2 > needed ?
+                parser->pendingCapacity * 2 : needed;
+            char *temp = wavefrontReallocateWith(parser->allocator, parser->pending, capacity);
+            if(!temp) {
+                parser->result = STATUS_ALLOC_ERR;
+                return parserFail(parser);
+            }
+            parser->pending = temp;
+            parser->pendingCapacity = capacity;
+        }
+        memcpy(parser->pending + parser->pendingLength, chunk, lineEnd - chunk);
+        parser->pendingLength = needed;
+        if(lineEnd == end) {
+            parser->offset += length;
+            return STATUS_OK;
+        }
+
+        parser->result = parseLine(parser, parser->pending, parser->pending + needed);
+        if(tolerated(parser)) skipLine(parser, parser->pending, parser->pending + needed, parser->lines + 1, offset);
+        if(parser->result) return parserFail(parser);
+        parser->pendingLength = 0;
+        chunk = lineEnd + 1;
+    }
+
+    chunk = parseLines(parser, chunk, end);
+    if(parser->result) return parserFail(parser);
+
+    // Keep the unterminated tail for the next chunk.
+    size_t remaining = end - chunk;
+    if(remaining > parser->pendingCapacity) {
+        char *temp = wavefrontReallocateWith(parser->allocator, parser->pending, remaining);
+        if(!temp) {
+            parser->result = STATUS_ALLOC_ERR;
+            return parserFail(parser);
         }
+        parser->pending = temp;
+        parser->pendingCapacity = remaining;
     }
+    if(remaining) memcpy(parser->pending, chunk, remaining);
+    parser->pendingLength = remaining;
+    // Lines failing in later chunks are numbered after these.
+    if(parser->diagnostics) countLines(parser, end);
+    parser->offset += length;
+    return STATUS_OK;
+}
+
+int wavefrontMTLParserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length) {
+    parserTrack(parser);
+    int result = parserFeed(parser, chunk, length);
+    parserUntrack(parser);
+    return result;
+}
 
-    map->file = strCopy(thisToken);
+static int parserFinish(struct WavefrontMTLParser *parser) {
+    if(parser->result) return parser->result;
+    if(parser->pendingLength) {
+        const char *pendingEnd = parser->pending + parser->pendingLength;
+        parser->result = parseLine(parser, parser->pending, pendingEnd);
+        if(tolerated(parser)) {
+            skipLine(parser, parser->pending, pendingEnd, parser->lines + 1, parser->offset - parser->pendingLength);
+        }
+        if(parser->result) return parserFail(parser);
+    }
+    wavefrontFreeWith(parser->allocator, parser->pending);
+    parser->pending = NULL;
+    parser->pendingLength = parser->pendingCapacity = 0;
     return STATUS_OK;
 }
 
+int wavefrontMTLParserFinish(struct WavefrontMTLParser *parser) {
+    parserTrack(parser);
+    int result = parserFinish(parser);
+    parserUntrack(parser);
+    return result;
+}
+
+// Parse [input, end) including an unterminated last line.
+static int parseAll(struct WavefrontMTLParser *parser, const char *input, const char *end) {
+    STATS_ADD(parser, bytes, end - input);
+    input = parseLines(parser, input, end);
+    if(!parser->result && input < end) {
+        parser->result = parseLine(parser, input, end);
+        if(tolerated(parser)) skipChunkLine(parser, input, end);
+    }
+    return parser->result;
+}
+
+// Whether the line [input, end) holds a newmtl statement selecting a material.
+static int isMaterialLine(const char *input, const char *end) {
+    input = skipSpace(input, end);
+    const char *keywordEnd = skipToken(input, end);
+    if(!tokenIs(input, keywordEnd - input, "newmtl", 6)) return 0;
+    const char *name = skipSpace(keywordEnd, end);
+    const char *nameEnd = skipToken(name, end);
+    return nameEnd != name && trimSpace(nameEnd, end) == nameEnd;
+}
+
+// Find the first newmtl line starting after the line containing input.
+static const char *nextMaterialLine(const char *input, const char *end) {
+    struct LineScanner lines;
+    lineScannerCompose(&lines, input, end);
+    const char *lineEnd = nextLineEnd(&lines);
+    while(lineEnd < end) {
+        const char *line = lineEnd + 1;
+        lineEnd = nextLineEnd(&lines);
+        if(isMaterialLine(line, lineEnd)) return line;
+    }
+    return end;
+}
+
+struct ParallelPiece {
+    const char *input;
+    const char *end;
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLStats stats;
+    struct WavefrontMTLDiagnostics diagnostics; // Located within the piece.
+    int result;
+};
+
+struct ParallelParse {
+    struct ParallelPiece *pieces;
+    struct WavefrontMTLOptions options;
+};
+
+static void parsePiece(void *context, unsigned int index) {
+    struct ParallelParse *parse = context;
+    struct ParallelPiece *piece = parse->pieces + index;
+    struct WavefrontMTLOptions options = parse->options;
+    if(options.stats) options.stats = &piece->stats;
+    if(options.diagnostics) options.diagnostics = &piece->diagnostics;
+    piece->result = parseWavefrontMTLFromBuffer(
+        &piece->mtl, piece->input, piece->end - piece->input, &options);
+}
+
+#ifdef WAVEFRONT_MTL_STATS
+static void statsAdd(struct WavefrontMTLStats *total, const struct WavefrontMTLStats *part) {
+    total->lines += part->lines;
+    total->bytes += part->bytes;
+    total->materials += part->materials;
+    total->duplicateMaterials += part->duplicateMaterials;
+    total->allocation.allocations += part->allocation.allocations;
+    total->allocation.bytes += part->allocation.bytes;
+    for(unsigned int i = 0; i < WAVEFRONT_MTL_STATEMENT_COUNT; i++) {
+        total->statements[i] += part->statements[i];
+        total->nanoseconds[i] += part->nanoseconds[i];
+    }
+}
+#endif
+
+// Add the diagnostics of a piece to those of the whole parse, whose chunk
+// holds every piece.
+static void diagnosticsAdd(struct WavefrontMTLParser *parser, const struct ParallelPiece *piece) {
+    const struct WavefrontMTLDiagnostics *part = &piece->diagnostics;
+    struct WavefrontMTLDiagnostics *total = parser->diagnostics;
+    if(!part->total) return;
+    unsigned long long lines = countLines(parser, piece->input);
+    for(unsigned int i = 0; i < part->count && total->count < total->capacity; i++) {
+        struct WavefrontMTLDiagnostic *diagnostic = total->items + total->count++;
+        *diagnostic = part->items[i];
+        diagnostic->line += lines;
+        diagnostic->offset += piece->input - parser->chunk;
+    }
+    total->total += part->total;
+}
+
+// Fold a piece into the library parsed so far, as if parsed after it.
+static int parallelMerge(struct WavefrontMTLParser *parser, struct ParallelPiece *piece) {
+    struct WavefrontMTL *mtl = parser->mtl;
+    // The piece met its textures and map options in source order, including
+    // those of reopened materials and of maps later replaced. Interning them
+    // first numbers them as a serial parse would, before the reparse or
+    // Append add any. An empty library is instead taken over by Append as it
+    // is.
+    if(mtl->materialCount || mtl->textureCount || mtl->mapOptionCount) {
+        for(unsigned int i = 0; i < piece->mtl.textureCount; i++) {
+            const char *file = piece->mtl.textures[i];
+            unsigned int texture;
+            parser->result = wavefrontMTLInternTexture(mtl, file, strlen(file), &texture);
+            if(parser->result) return parser->result;
+        }
+        for(unsigned int i = 0; i < piece->mtl.mapOptionCount; i++) {
+            unsigned int index;
+            parser->result = wavefrontMTLInternMapOptions(mtl, piece->mtl.mapOptions + i, &index);
+            if(parser->result) return parser->result;
+        }
+    }
+    // Materials reopened from earlier pieces are updated by parsing their
+    // statements again, skipping everything else.
+    for(unsigned int i = 0; i < piece->mtl.materialCount; i++) {
+        if(wavefrontMTLFindMaterial(mtl, piece->mtl.materials[i].name) < 0) continue;
+        // The piece already counted these statements and skipped any
+        // malformed ones.
+        struct WavefrontMTLStats *stats = parser->stats;
+        struct WavefrontMTLDiagnostics *diagnostics = parser->diagnostics;
+        struct WavefrontMTLDiagnostics skipped = {0};
+        parser->stats = NULL;
+        parser->diagnostics = diagnostics ? &skipped : NULL;
+        parser->material = NULL;
+        parser->selectOnly = 1;
+        parseAll(parser, piece->input, piece->end);
+        parser->selectOnly = 0;
+        parser->stats = stats;
+        parser->diagnostics = diagnostics;
+        if(parser->result) return parser->result;
+        break;
+    }
+    parser->result = wavefrontMTLAppend(mtl, &piece->mtl);
+    return parser->result;
+}
+
+static int parseParallel(
+    struct WavefrontMTLParser *parser,
+    const char *input,
+    const char *end,
+    unsigned int threadCount
+) {
+    size_t length = end - input;
+    size_t pieceCount = (size_t)threadCount * PARALLEL_PIECES_PER_THREAD;
+    if(pieceCount > length / PARALLEL_MIN_PIECE) pieceCount = length / PARALLEL_MIN_PIECE;
+    if(pieceCount < 2) return parseAll(parser, input, end);
+
+    struct ParallelParse parse = {0};
+    parse.pieces = wavefrontAllocateZeroedWith(parser->allocator, pieceCount, sizeof(struct ParallelPiece));
+    if(!parse.pieces) return parser->result = STATUS_ALLOC_ERR;
+    parse.options.flags = parser->mtl->flags;
+    parse.options.stats = parser->stats;
+    parse.options.allocator = parser->allocator;
+    parse.options.diagnostics = parser->diagnostics;
+    // Each piece may record as many diagnostics as the whole parse.
+    unsigned int capacity = parser->diagnostics ? parser->diagnostics->capacity : 0;
+    struct WavefrontMTLDiagnostic *items = NULL;
+    if(capacity) {
+        items = wavefrontAllocateWith(parser->allocator, pieceCount * capacity * sizeof(struct WavefrontMTLDiagnostic));
+        if(!items) {
+            wavefrontFreeWith(parser->allocator, parse.pieces);
+            return parser->result = STATUS_ALLOC_ERR;
+        }
+    }
+
+    // Every piece but the first starts with a newmtl line, so each material
+    // is parsed whole by one thread.
+    const char *pieceInput = input;
+    for(size_t i = 0; i < pieceCount; i++) {
+        struct ParallelPiece *piece = parse.pieces + i;
+        const char *split = input + length / pieceCount * (i + 1);
+        if(split < pieceInput) split = pieceInput;
+        piece->input = pieceInput;
+        piece->end = i + 1 == pieceCount ? end : nextMaterialLine(split, end);
+        wavefrontMTLCompose(&piece->mtl);
+        piece->diagnostics.items = items ? items + i * capacity : NULL;
+        piece->diagnostics.capacity = capacity;
+        pieceInput = piece->end;
+    }
+    wavefrontRunParallel(parsePiece, &parse, pieceCount, threadCount, parser->allocator);
+
+    for(size_t i = 0; i < pieceCount; i++) {
+        struct ParallelPiece *piece = parse.pieces + i;
+        if(!parser->result) parser->result = piece->result;
+        // Before merging, which may count lines past the start of the piece.
+        if(!parser->result && parser->diagnostics) diagnosticsAdd(parser, piece);
+        if(!parser->result) parallelMerge(parser, piece);
+        wavefrontMTLRelease(&piece->mtl);
+#ifdef WAVEFRONT_MTL_STATS
+        if(parser->stats) statsAdd(parser->stats, &piece->stats);
+#endif
+    }
+    wavefrontFreeWith(parser->allocator, parse.pieces);
+    wavefrontFreeWith(parser->allocator, items);
+#ifdef WAVEFRONT_MTL_STATS
+    // Materials found in several pieces were merged into one.
+    if(parser->stats && !parser->result) {
+        parser->stats->duplicateMaterials += parser->stats->materials - parser->mtl->materialCount;
+        parser->stats->materials = parser->mtl->materialCount;
+    }
+#endif
+    return parser->result;
+}
+
+int parseWavefrontMTLFromBuffer(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options
+) {
+    if(!input) return STATUS_INPUT_ERR;
+    struct WavefrontMTLParser parser;
+    if(!parserCompose(&parser, mtl, options)) {
+        parser.chunk = parser.counted = input;
+        if(options && options->threadCount > 1) {
+            parseParallel(&parser, input, input + length, options->threadCount);
+        } else {
+            parseAll(&parser, input, input + length);
+        }
+    }
+    if(parser.result) parserFail(&parser);
+    parserUntrack(&parser);
+    return parser.result;
+}
+
 int parseWavefrontMTLFromString(struct WavefrontMTL *mtl, const char *input) {
     if(!input) return STATUS_INPUT_ERR;
-    mtl->materials = NULL;
-    mtl->materialCount = 0;
-
-    const char *thisToken = input, *nextDelim = NULL, *nextToken = NULL;
-    while (tokenize(&thisToken, &nextDelim, &nextToken, ASCII_V_DELIMITERS)) {
-        char *line = strCopyN(thisToken, nextDelim-thisToken);
-        if(line == NULL) return STATUS_ALLOC_ERR;
-
-        const char *temp = strAfterWhitespace(line);
-
-        struct WavefrontMaterial* m = NULL;
-        if (mtl->materialCount) {
-            m = mtl->materials + (mtl->materialCount-1);
-        }
-
-        const char *thisToken = temp,* nextDelim = NULL,* nextToken = NULL;
-        tokenize(&thisToken, &nextDelim, &nextToken, ASCII_H_DELIMITERS);
-
-        struct Parser {
-            char name[22];
-            int (*fn)(void *color, const char *input);
-            void *result;
-        };
-        struct Parser parsers[] = {
-            {"newmtl", parseNewMaterial, (void*)mtl},
-            {"Ka", parseColor, (void*)&m->ambient},
-            {"Kd", parseColor, (void*)&m->diffuse},
-            {"Ks", parseColor, (void*)&m->specular},
-            {"Tf", parseColor, (void*)&m->transmission},
-            {"illum", parseInteger, (void*)&m->illuminationModel},
-            {"Ns", parseFloat, (void*)&m->specularExponent},
-            {"Ni", parseFloat, (void*)&m->opticalDensity},
-            {"d", parseFloat, (void*)&m->dissolve},
-            {"map_Kd", parseMap, (void*)&m->diffuseMap},
-            {"map_Kn", parseMap, (void*)&m->normalMap},
-            {"refl -type sphere", parseMap, (void*)&m->reflectionMapSphere},
-            {"refl -type cube_top", parseMap, (void*)&m->reflectionMapCubeTop},
-            {"refl -type cube_bottom", parseMap, (void*)&m->reflectionMapCubeBottom},
-            {"refl -type cube_front", parseMap, (void*)&m->reflectionMapCubeFront},
-            {"refl -type cube_back", parseMap, (void*)&m->reflectionMapCubeBack},
-            {"refl -type cube_left", parseMap, (void*)&m->reflectionMapCubeLeft},
-            {"refl -type cube_right", parseMap, (void*)&m->reflectionMapCubeRight}
-        };
-        if(!nextToken) continue;
-        int result = STATUS_OK;
-        for(int i = 0; i < sizeof(parsers)/sizeof(struct Parser); i++) {
-            if((strStartsWith(thisToken, parsers[i].name) >= nextDelim)) {
-                const char *temp = nextToken ? strAfterWhitespace(nextToken) : NULL;
-                result = parsers[i].fn ? parsers[i].fn(parsers[i].result, temp) : STATUS_OK;
-                break;
-            }
+    return parseWavefrontMTLFromBuffer(mtl, input, strlen(input), NULL);
+}
+
+int parseWavefrontMTLFromFile(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontMTLOptions *options
+) {
+    if(!path) return STATUS_INPUT_ERR;
+    struct WavefrontFileView view;
+    int result = wavefrontFileMap(&view, path);
+    if(result) return result;
+    result = parseWavefrontMTLFromBuffer(mtl, view.data, view.length, options);
+    wavefrontFileUnmap(&view);
+    return result;
+}
+
+struct BatchEntry {
+    size_t length;
+    unsigned int index;
+};
+
+struct BatchParse {
+    struct WavefrontMTLBatchItem *items;
+    struct WavefrontFileView *views;
+    struct BatchEntry *order;
+    struct WavefrontMTLOptions options;
+};
+
+static int compareBatchEntries(const void *a, const void *b) {
+    size_t x = ((const struct BatchEntry*)a)->length;
+    size_t y = ((const struct BatchEntry*)b)->length;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static void parseBatchItem(void *context, unsigned int index) {
+    struct BatchParse *batch = context;
+    unsigned int itemIndex = batch->order[index].index;
+    struct WavefrontMTLBatchItem *item = batch->items + itemIndex;
+    if(item->result) return;
+    const char *input = item->input;
+    size_t length = item->length;
+    if(item->path) {
+        input = batch->views[itemIndex].data;
+        length = batch->views[itemIndex].length;
+    }
+    item->result = parseWavefrontMTLFromBuffer(&item->mtl, input, length, &batch->options);
+}
+
+int parseWavefrontMTLBatch(
+    struct WavefrontMTLBatchItem *items,
+    unsigned int count,
+    const struct WavefrontMTLOptions *options
+) {
+    struct BatchParse batch = {0};
+    if(options) batch.options = *options;
+    // Stats and diagnostics describe a single parse.
+    batch.options.stats = NULL;
+    batch.options.diagnostics = NULL;
+    unsigned int threadCount = batch.options.threadCount;
+    // Each library is parsed whole by one thread.
+    batch.options.threadCount = 0;
+    batch.items = items;
+    const struct WavefrontAllocator *allocator = batch.options.allocator;
+    batch.views = wavefrontAllocateZeroedWith(allocator, count, sizeof(struct WavefrontFileView));
+    batch.order = wavefrontAllocateWith(allocator, count * sizeof(struct BatchEntry));
+
+    // Map files up front so the biggest libraries can be started first,
+    // keeping a large one from finishing alone at the end.
+    for(unsigned int i = 0; i < count; i++) {
+        struct WavefrontMTLBatchItem *item = items + i;
+        wavefrontMTLCompose(&item->mtl);
+        item->mtl.allocator = allocator;
+        item->result = STATUS_OK;
+        if(!batch.views || !batch.order) {
+            item->result = STATUS_ALLOC_ERR;
+        } else if(item->path) {
+            item->result = wavefrontFileMap(batch.views + i, item->path);
+        } else if(!item->input) {
+            item->result = STATUS_INPUT_ERR;
         }
-        free(line);
-        if(result) {
-            wavefrontMTLRelease(mtl);
-            return result;
+        if(batch.order) {
+            batch.order[i].length = item->path ? batch.views[i].length : item->length;
+            batch.order[i].index = i;
+        }
+    }
+    if(batch.views && batch.order) {
+        qsort(batch.order, count, sizeof(struct BatchEntry), compareBatchEntries);
+        wavefrontRunParallel(parseBatchItem, &batch, count, threadCount, allocator);
+    }
+
+    int result = STATUS_OK;
+    for(unsigned int i = 0; i < count; i++) {
+        if(batch.views && items[i].path) wavefrontFileUnmap(batch.views + i);
+        if(!result) result = items[i].result;
+    }
+    wavefrontFreeWith(allocator, batch.views);
+    wavefrontFreeWith(allocator, batch.order);
+    return result;
+}
+
+int wavefrontMTLReload(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    struct WavefrontMTLChanges *changes
+) {
+    if(changes) memset(changes, 0, sizeof(struct WavefrontMTLChanges));
+    struct WavefrontMTLOptions options = {0};
+    options.flags = mtl->flags;
+    options.allocator = mtl->allocator;
+    struct WavefrontMTL next;
+    int result = parseWavefrontMTLFromBuffer(&next, input, length, &options);
+    if(result) return result;
+    result = wavefrontMTLUpdate(mtl, &next, changes);
+    wavefrontMTLRelease(&next);
+    return result;
+}
+
+struct WavefrontMTLIndexEntry {
+    const char *name;
+    size_t nameLength;
+    unsigned int firstBlock; // Block index + 1, 0 if none.
+    unsigned int lastBlock;
+    int material; // Index into the index's WavefrontMTL, -1 until parsed.
+};
+
+struct WavefrontMTLIndexBlock {
+    const char *input;
+    const char *end;
+    unsigned int next; // Block index + 1 of the next block of the same material.
+};
+
+// Find the slot holding the named entry, or the empty slot where it belongs.
+static unsigned int indexProbe(const struct WavefrontMTLIndex *index, const char *name, size_t length) {
+    unsigned int mask = index->tableSize - 1;
+    unsigned int slot = wavefrontMTLHashName(name, length) & mask;
+    for(; index->table[slot]; slot = (slot + 1) & mask) {
+        const struct WavefrontMTLIndexEntry *entry = index->entries + index->table[slot] - 1;
+        if(entry->nameLength == length && memcmp(entry->name, name, length) == 0) break;
+    }
+    return slot;
+}
+
+static int indexTableResize(struct WavefrontMTLIndex *index) {
+    unsigned int size = index->tableSize ? index->tableSize * 2 : 64;
+    unsigned int *table = wavefrontAllocateZeroedWith(index->mtl.allocator, size, sizeof(unsigned int));
+    if(!table) return STATUS_ALLOC_ERR;
+    wavefrontFreeWith(index->mtl.allocator, index->table);
+    index->table = table;
+    index->tableSize = size;
+    for(unsigned int i = 0; i < index->entryCount; i++) {
+        const struct WavefrontMTLIndexEntry *entry = index->entries + i;
+        index->table[indexProbe(index, entry->name, entry->nameLength)] = i + 1;
+    }
+    return STATUS_OK;
+}
+
+// Record that the statements in [input, end) belong to the named material.
+static int indexAddBlock(struct WavefrontMTLIndex *index, const char *name, size_t length, const char *input) {
+    if(index->blockCount == index->blockCapacity) {
+        unsigned int capacity = index->blockCapacity ? index->blockCapacity * 2 : 64;
+        struct WavefrontMTLIndexBlock *temp = wavefrontReallocateWith(index->mtl.allocator, index->blocks, capacity * sizeof(struct WavefrontMTLIndexBlock));
+        if(!temp) return STATUS_ALLOC_ERR;
+        index->blocks = temp;
+        index->blockCapacity = capacity;
+    }
+    if((index->entryCount + 1) * 2 > index->tableSize && indexTableResize(index)) return STATUS_ALLOC_ERR;
+
+    unsigned int slot = indexProbe(index, name, length);
+    if(!index->table[slot]) {
+        if(index->entryCount == index->entryCapacity) {
+            unsigned int capacity = index->entryCapacity ? index->entryCapacity * 2 : 64;
+            struct WavefrontMTLIndexEntry *temp = wavefrontReallocateWith(index->mtl.allocator, index->entries, capacity * sizeof(struct WavefrontMTLIndexEntry));
+            if(!temp) return STATUS_ALLOC_ERR;
+            index->entries = temp;
+            index->entryCapacity = capacity;
+        }
+        struct WavefrontMTLIndexEntry *entry = index->entries + index->entryCount++;
+        entry->name = name;
+        entry->nameLength = length;
+        entry->firstBlock = entry->lastBlock = 0;
+        entry->material = -1;
+        index->table[slot] = index->entryCount;
+    }
+
+    struct WavefrontMTLIndexEntry *entry = index->entries + index->table[slot] - 1;
+    struct WavefrontMTLIndexBlock *block = index->blocks + index->blockCount++;
+    block->input = input;
+    block->end = index->input + index->length;
+    block->next = 0;
+    if(entry->lastBlock) {
+        index->blocks[entry->lastBlock - 1].next = index->blockCount;
+    } else {
+        entry->firstBlock = index->blockCount;
+    }
+    entry->lastBlock = index->blockCount;
+    return STATUS_OK;
+}
+
+// Split the input at each newmtl line without parsing anything else.
+static int indexScan(struct WavefrontMTLIndex *index) {
+    const char *input = index->input;
+    const char *end = input + index->length;
+    struct WavefrontMTLIndexBlock *block = NULL;
+    struct LineScanner lines;
+    lineScannerCompose(&lines, input, end);
+    while(input < end) {
+        const char *lineEnd = nextLineEnd(&lines);
+        if(isMaterialLine(input, lineEnd)) {
+            if(block) block->end = input;
+            const char *name = skipSpace(skipToken(skipSpace(input, lineEnd), lineEnd), lineEnd);
+            const char *nameEnd = skipToken(name, lineEnd);
+            if(indexAddBlock(index, name, nameEnd - name, lineEnd)) return STATUS_ALLOC_ERR;
+            block = index->blocks + index->blockCount - 1;
         }
+        input = lineEnd < end ? lineEnd + 1 : end;
+    }
+    return STATUS_OK;
+}
+
+int wavefrontMTLIndexCompose(
+    struct WavefrontMTLIndex *index,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options
+) {
+    memset(index, 0, sizeof(struct WavefrontMTLIndex));
+    wavefrontMTLCompose(&index->mtl);
+    if(options) {
+        index->mtl.flags = options->flags;
+        index->mtl.allocator = options->allocator;
+    }
+    if(!input) return STATUS_INPUT_ERR;
+    index->input = input;
+    index->length = length;
+
+    int result = indexScan(index);
+    if(result) wavefrontMTLIndexRelease(index);
+    return result;
+}
+
+int wavefrontMTLIndexFind(struct WavefrontMTLIndex *index, const char *name, int *material) {
+    *material = -1;
+    if(!index->tableSize) return STATUS_OK;
+    unsigned int slot = indexProbe(index, name, strlen(name));
+    if(!index->table[slot]) return STATUS_OK;
+    struct WavefrontMTLIndexEntry *entry = index->entries + index->table[slot] - 1;
+    if(entry->material >= 0) {
+        *material = entry->material;
+        return STATUS_OK;
+    }
+
+    // Parse every block of the material, in order, before adding it so a
+    // failure leaves nothing behind.
+    struct WavefrontMaterial m;
+    wavefrontMaterialCompose(&m);
+    struct WavefrontMTLParser parser;
+    memset(&parser, 0, sizeof(struct WavefrontMTLParser));
+    parser.mtl = &index->mtl;
+    parser.material = &m;
+    parser.allocator = index->mtl.allocator;
+    for(unsigned int b = entry->firstBlock; b && !parser.result; b = index->blocks[b - 1].next) {
+        parseAll(&parser, index->blocks[b - 1].input, index->blocks[b - 1].end);
     }
+    if(parser.result) return parser.result;
 
+    struct WavefrontMTL *mtl = &index->mtl;
+    m.name = wavefrontMTLCopyString(mtl, entry->name, entry->nameLength);
+    if(!m.name) return STATUS_ALLOC_ERR;
+    int result = wavefrontMTLAddMaterial(mtl, m.name);
+    if(result) {
+        wavefrontMTLFreeString(mtl, m.name);
+        return result;
+    }
+    mtl->materials[mtl->materialCount - 1] = m;
+    entry->material = *material = mtl->materialCount - 1;
     return STATUS_OK;
 }
+
+void wavefrontMTLIndexRelease(struct WavefrontMTLIndex *index) {
+    wavefrontFreeWith(index->mtl.allocator, index->entries);
+    wavefrontFreeWith(index->mtl.allocator, index->blocks);
+    wavefrontFreeWith(index->mtl.allocator, index->table);
+    wavefrontMTLRelease(&index->mtl);
+    memset(index, 0, sizeof(struct WavefrontMTLIndex));
+    wavefrontMTLCompose(&index->mtl);
+}
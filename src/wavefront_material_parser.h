@@ -4,9 +4,179 @@
 extern "C"{
 #endif
 
+#include <stddef.h>
 #include "wavefront_material.h"
 
+// Statement classes timed separately by WavefrontMTLStats.
+enum WavefrontMTLStatement {
+    WAVEFRONT_MTL_STATEMENT_OTHER, // Blank lines, comments and unknown keywords.
+    WAVEFRONT_MTL_STATEMENT_MATERIAL,
+    WAVEFRONT_MTL_STATEMENT_COLOR,
+    WAVEFRONT_MTL_STATEMENT_SCALAR,
+    WAVEFRONT_MTL_STATEMENT_MAP,
+    WAVEFRONT_MTL_STATEMENT_COUNT
+};
+
+// Where a parse spent its time. Only filled in when the library is built
+// with WAVEFRONT_MTL_STATS, otherwise a parse just zeroes it. Threads of a
+// parallel parse add up, so times are CPU rather than wall clock time.
+struct WavefrontMTLStats {
+    unsigned long long lines;
+    unsigned long long bytes;
+    unsigned int materials;          // Materials created.
+    unsigned int duplicateMaterials; // newmtl statements naming an existing material.
+    struct WavefrontAllocationStats allocation;
+    unsigned long long statements[WAVEFRONT_MTL_STATEMENT_COUNT];
+    unsigned long long nanoseconds[WAVEFRONT_MTL_STATEMENT_COUNT];
+};
+
+// Why a malformed line was rejected.
+enum WavefrontMTLError {
+    WAVEFRONT_MTL_ERROR_MISSING_VALUE, // A color without red.
+    WAVEFRONT_MTL_ERROR_BAD_VALUE,     // A color channel that is not a number.
+    WAVEFRONT_MTL_ERROR_EXTRA_VALUE,   // More than three color channels.
+    WAVEFRONT_MTL_ERROR_MAP_OPTION     // A map option with a malformed argument, left at its default.
+};
+
+// A line skipped by a tolerant parse, or a map kept without its malformed
+// options.
+struct WavefrontMTLDiagnostic {
+    unsigned long long line;   // 1 based, counting '\n' line ends.
+    unsigned long long offset; // Byte offset of the start of the line.
+    char keyword[16];          // Truncated and NUL terminated.
+    enum WavefrontMTLError error;
+};
+
+// Diagnostics of a tolerant parse, kept in a buffer the caller provides.
+struct WavefrontMTLDiagnostics {
+    struct WavefrontMTLDiagnostic *items; // In input order.
+    unsigned int capacity;
+    unsigned int count;        // Recorded, at most capacity.
+    unsigned long long total;  // Lines reported, recorded or not.
+};
+
+struct WavefrontMTLOptions {
+    // Number of materials to reserve space for before parsing.
+    unsigned int materialCapacity;
+    // WAVEFRONT_MTL_* flags applied to the resulting WavefrontMTL.
+    unsigned int flags;
+    // Threads parsing a buffer concurrently, split at newmtl statements.
+    // 0 or 1 parses on the calling thread.
+    unsigned int threadCount;
+    // Filled in by the parse when not NULL.
+    struct WavefrontMTLStats *stats;
+    // Allocator of the resulting WavefrontMTL, which also makes the parse's
+    // own allocations. NULL uses the global allocator.
+    const struct WavefrontAllocator *allocator;
+    // When not NULL, malformed lines are skipped and described here instead
+    // of failing the parse. Malformed map options never fail it and are only
+    // described here. Allocation and input errors still fail it.
+    struct WavefrontMTLDiagnostics *diagnostics;
+};
+
+// Incremental parser fed a chunk at a time. Lines split across chunks are
+// carried over, so memory is bounded by the longest line.
+struct WavefrontMTLParser {
+    struct WavefrontMTL *mtl;
+    struct WavefrontMaterial *material; // Material receiving properties.
+    char *pending;
+    size_t pendingLength;
+    size_t pendingCapacity;
+    int result;
+    int selectOnly; // newmtl selects existing materials but adds none.
+    struct WavefrontMTLStats *stats;
+    struct WavefrontAllocationStats *trackedBefore; // Restored on return.
+    const struct WavefrontAllocator *allocator;
+    // Tolerant parses only. Malformed lines are located by counting line
+    // ends up to them, so clean input costs nothing extra.
+    struct WavefrontMTLDiagnostics *diagnostics;
+    enum WavefrontMTLError error; // Of the line that just failed.
+    const char *chunk;            // Start of the input being parsed.
+    const char *counted;          // Line ends before here are in lines.
+    unsigned long long lines;
+    unsigned long long offset;    // Of chunk within the whole input.
+};
+
 int parseWavefrontMTLFromString(struct WavefrontMTL *mtl, const char *input);
+// Parse length bytes of input, which need not be NUL terminated.
+// Options may be NULL to use defaults.
+int parseWavefrontMTLFromBuffer(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options);
+// Map the file at path into memory and parse it in place.
+int parseWavefrontMTLFromFile(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontMTLOptions *options);
+
+// One library of a batch, read from the file at path if set and otherwise
+// from length bytes of input.
+struct WavefrontMTLBatchItem {
+    const char *path;
+    const char *input;
+    size_t length;
+    struct WavefrontMTL mtl; // Empty unless result is STATUS_OK.
+    int result;
+};
+
+// Parse count libraries on options->threadCount threads, largest first.
+// Returns the status of the first item that failed, or STATUS_OK. Libraries
+// are parsed strictly, options->diagnostics is ignored.
+int parseWavefrontMTLBatch(
+    struct WavefrontMTLBatchItem *items,
+    unsigned int count,
+    const struct WavefrontMTLOptions *options);
+
+// Parse input and bring mtl in line with it through wavefrontMTLUpdate, so
+// unchanged materials keep their index. On any error mtl is untouched.
+int wavefrontMTLReload(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    struct WavefrontMTLChanges *changes);
+
+struct WavefrontMTLIndexEntry;
+struct WavefrontMTLIndexBlock;
+
+// Lazily parsed library. Composing only records where each material's
+// statements are, and a material is parsed the first time it is found.
+// The input is borrowed and must outlive the index. Materials are parsed
+// strictly, options->diagnostics is ignored.
+struct WavefrontMTLIndex {
+    const char *input;
+    size_t length;
+    struct WavefrontMTLIndexEntry *entries; // One per material name.
+    unsigned int entryCount;
+    unsigned int entryCapacity;
+    struct WavefrontMTLIndexBlock *blocks; // Statements following a newmtl.
+    unsigned int blockCount;
+    unsigned int blockCapacity;
+    // Open addressing table of entry index + 1 keyed by name, 0 if empty.
+    unsigned int *table;
+    unsigned int tableSize;
+    struct WavefrontMTL mtl; // Materials parsed so far.
+};
+
+int wavefrontMTLIndexCompose(
+    struct WavefrontMTLIndex *index,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options);
+// Set material to the index of the named material within index->mtl, parsing
+// it on first use, or -1 if the library has no such material.
+int wavefrontMTLIndexFind(struct WavefrontMTLIndex *index, const char *name, int *material);
+void wavefrontMTLIndexRelease(struct WavefrontMTLIndex *index);
+
+// On error the WavefrontMTL is released and later calls return the error.
+// Diagnostics of a tolerant parse cover every chunk fed.
+int wavefrontMTLParserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options);
+int wavefrontMTLParserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length);
+int wavefrontMTLParserFinish(struct WavefrontMTLParser *parser);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,493 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "wavefront_material_arrays.h"
+#include "wavefront_material_cache.h"
+#include "wavefront_material_parser.h"
+#include "cutil/src/error.h"
+
+// Minimum CPU time spent repeating each measurement.
+#define BENCH_SECONDS 0.5
+// Libraries released per measurement and number of measurements.
+#define BENCH_RELEASE_BATCH 16
+#define BENCH_RELEASE_ROUNDS 4
+
+static const char *materialTemplate =
+    "newmtl Material_%06u\n"
+    "Ns 96.078431\n"
+    "Ka 1.000000 1.000000 1.000000\n"
+    "Kd 0.640000 0.640000 0.640000\n"
+    "Ks 0.500000 0.500000 0.500000\n"
+    "Ni 1.000000\n"
+    "d 1.000000\n"
+    "illum 2\n"
+    "map_Kd textures/diffuse_%03u.png\n"
+    "\n";
+static const unsigned int linesPerMaterial = 10;
+
+static char *generateLibrary(unsigned int materialCount) {
+    size_t capacity = (size_t)materialCount * 256 + 1;
+    char *output = malloc(capacity);
+    if(!output) return NULL;
+    size_t length = 0;
+    for(unsigned int i = 0; i < materialCount; i++) {
+        length += snprintf(output + length, capacity - length,
+            materialTemplate, i, i % 100);
+    }
+    return output;
+}
+
+// Time wavefrontMTLRelease alone over a batch of libraries parsed up front.
+static void benchRelease(const char *label, const char *input, unsigned int flags) {
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    struct WavefrontMTL batch[BENCH_RELEASE_BATCH];
+    unsigned int materials = 0;
+    clock_t elapsed = 0;
+    for(unsigned int round = 0; round < BENCH_RELEASE_ROUNDS; round++) {
+        unsigned int count = 0;
+        for(; count < BENCH_RELEASE_BATCH; count++) {
+            if(parseWavefrontMTLFromBuffer(batch + count, input, strlen(input), &options)) break;
+            materials += batch[count].materialCount;
+        }
+        clock_t start = clock();
+        for(unsigned int i = 0; i < count; i++) {
+            wavefrontMTLRelease(batch + i);
+        }
+        elapsed += clock() - start;
+    }
+
+    double seconds = (double)elapsed / CLOCKS_PER_SEC;
+    printf("%-44s %12.0f materials/sec\n", label, seconds > 0 ? materials / seconds : 0);
+}
+
+static void benchParse(const char *label, const char *input, unsigned int lineCount) {
+    unsigned int iterations = 0;
+    clock_t start = clock(), elapsed = 0;
+    do {
+        struct WavefrontMTL mtl;
+        if(parseWavefrontMTLFromString(&mtl, input) != STATUS_OK) break;
+        wavefrontMTLRelease(&mtl);
+        iterations++;
+        elapsed = clock() - start;
+    } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+    double seconds = (double)elapsed / CLOCKS_PER_SEC;
+    double lines = (double)iterations * lineCount;
+    printf("%-44s %12.0f lines/sec\n", label, seconds > 0 ? lines / seconds : 0);
+}
+
+static void benchParseFromString(unsigned int materialCount) {
+    char *input = generateLibrary(materialCount);
+    if(!input) return;
+    char label[64];
+    snprintf(label, sizeof(label), "parseWavefrontMTLFromString %u materials", materialCount);
+    benchParse(label, input, materialCount * linesPerMaterial);
+    snprintf(label, sizeof(label), "wavefrontMTLRelease %u materials", materialCount);
+    benchRelease(label, input, 0);
+    snprintf(label, sizeof(label), "wavefrontMTLRelease %u materials arena", materialCount);
+    benchRelease(label, input, WAVEFRONT_MTL_ARENA);
+    free(input);
+}
+
+static int readAndParse(struct WavefrontMTL *mtl, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if(!file) return STATUS_INPUT_ERR;
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *input = malloc(length + 1);
+    int result = input && fread(input, 1, length, file) == (size_t)length ?
+        STATUS_OK : STATUS_INPUT_ERR;
+    fclose(file);
+    if(!result) {
+        input[length] = '\0';
+        result = parseWavefrontMTLFromString(mtl, input);
+    }
+    free(input);
+    return result;
+}
+
+// Compare reading a file into a heap buffer against mapping it.
+static void benchParseFile(unsigned int materialCount) {
+    const char *path = "bin/bench_library.mtl";
+    char *input = generateLibrary(materialCount);
+    if(!input) return;
+    FILE *file = fopen(path, "wb");
+    if(file) {
+        fwrite(input, 1, strlen(input), file);
+        fclose(file);
+    }
+    free(input);
+    if(!file) return;
+
+    for(int mapped = 0; mapped < 2; mapped++) {
+        unsigned int iterations = 0;
+        clock_t start = clock(), elapsed = 0;
+        do {
+            struct WavefrontMTL mtl;
+            int result = mapped ?
+                parseWavefrontMTLFromFile(&mtl, path, NULL) :
+                readAndParse(&mtl, path);
+            if(result != STATUS_OK) break;
+            wavefrontMTLRelease(&mtl);
+            iterations++;
+            elapsed = clock() - start;
+        } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+        double seconds = (double)elapsed / CLOCKS_PER_SEC;
+        char label[64];
+        snprintf(label, sizeof(label), "%s %u materials",
+            mapped ? "parseWavefrontMTLFromFile" : "fread + parseFromString", materialCount);
+        printf("%-44s %12.0f files/sec\n", label, seconds > 0 ? iterations / seconds : 0);
+    }
+    remove(path);
+}
+
+static double wallSeconds() {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// Processors available to the threaded benches, which bounds their scaling.
+static void printProcessors() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long processors = info.dwNumberOfProcessors;
+#else
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    printf("%-44s %12ld\n", "processors online", processors);
+}
+
+// Wall clock throughput, since CPU time sums over every thread.
+static void benchParseThreads(unsigned int materialCount) {
+    char *input = generateLibrary(materialCount);
+    if(!input) return;
+    size_t length = strlen(input);
+    printProcessors();
+    unsigned int threadCounts[] = {1, 2, 4, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTLOptions options = {0};
+        options.threadCount = threadCounts[i];
+        unsigned int iterations = 0;
+        double start = wallSeconds(), elapsed = 0;
+        do {
+            struct WavefrontMTL mtl;
+            if(parseWavefrontMTLFromBuffer(&mtl, input, length, &options) != STATUS_OK) break;
+            wavefrontMTLRelease(&mtl);
+            iterations++;
+            elapsed = wallSeconds() - start;
+        } while(elapsed < BENCH_SECONDS);
+
+        char label[64];
+        snprintf(label, sizeof(label), "parseWavefrontMTLFromBuffer %u materials %u threads",
+            materialCount, threadCounts[i]);
+        printf("%-44s %12.1f MB/sec\n", label,
+            elapsed > 0 ? iterations * (length / 1e6) / elapsed : 0);
+    }
+    free(input);
+}
+
+// Feed input to a parser in chunks of chunkSize bytes.
+static int parseChunked(struct WavefrontMTL *mtl, const char *input, size_t length,
+    size_t chunkSize, const struct WavefrontMTLOptions *options) {
+    struct WavefrontMTLParser parser;
+    int result = wavefrontMTLParserCompose(&parser, mtl, options);
+    for(size_t offset = 0; !result && offset < length; offset += chunkSize) {
+        size_t size = length - offset < chunkSize ? length - offset : chunkSize;
+        result = wavefrontMTLParserFeed(&parser, input + offset, size);
+    }
+    return result ? result : wavefrontMTLParserFinish(&parser);
+}
+
+// Clean input parsed strictly and tolerantly, which should run alike.
+static void benchParseTolerant(unsigned int materialCount) {
+    char *input = generateLibrary(materialCount);
+    if(!input) return;
+    size_t length = strlen(input);
+    struct WavefrontMTLDiagnostic items[16];
+    struct WavefrontMTLDiagnostics diagnostics = {items, 16};
+    for(int chunked = 0; chunked < 2; chunked++) {
+        for(int tolerant = 0; tolerant < 2; tolerant++) {
+            struct WavefrontMTLOptions options = {0};
+            if(tolerant) options.diagnostics = &diagnostics;
+            unsigned int iterations = 0;
+            clock_t start = clock(), elapsed = 0;
+            do {
+                struct WavefrontMTL mtl;
+                int result = chunked ?
+                    parseChunked(&mtl, input, length, 65536, &options) :
+                    parseWavefrontMTLFromBuffer(&mtl, input, length, &options);
+                if(result != STATUS_OK) break;
+                wavefrontMTLRelease(&mtl);
+                iterations++;
+                elapsed = clock() - start;
+            } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+            double seconds = (double)elapsed / CLOCKS_PER_SEC;
+            char label[64];
+            snprintf(label, sizeof(label), "%s %u materials %s",
+                chunked ? "wavefrontMTLParserFeed" : "parseWavefrontMTLFromBuffer",
+                materialCount, tolerant ? "tolerant" : "strict");
+            printf("%-44s %12.1f MB/sec\n", label,
+                seconds > 0 ? iterations * (length / 1e6) / seconds : 0);
+        }
+    }
+    free(input);
+}
+
+// Hundreds of small libraries and one large one, parsed one after another
+// and as a batch.
+static void benchParseBatchItems(struct WavefrontMTLBatchItem *items, unsigned int libraryCount) {
+    char *small = generateLibrary(20);
+    char *large = generateLibrary(20000);
+    if(!small || !large) {
+        free(small);
+        free(large);
+        return;
+    }
+    size_t bytes = 0;
+    for(unsigned int i = 0; i < libraryCount; i++) {
+        items[i].input = i == libraryCount / 2 ? large : small;
+        items[i].length = strlen(items[i].input);
+        bytes += items[i].length;
+    }
+
+    printProcessors();
+    unsigned int threadCounts[] = {0, 1, 4, 8};
+    for(unsigned int t = 0; t < sizeof(threadCounts)/sizeof(threadCounts[0]); t++) {
+        struct WavefrontMTLOptions options = {0};
+        options.threadCount = threadCounts[t];
+        unsigned int iterations = 0;
+        double start = wallSeconds(), elapsed = 0;
+        do {
+            int result = STATUS_OK;
+            for(unsigned int i = 0; i < libraryCount && !threadCounts[t]; i++) {
+                result |= parseWavefrontMTLFromBuffer(&items[i].mtl, items[i].input, items[i].length, NULL);
+            }
+            if(threadCounts[t]) result = parseWavefrontMTLBatch(items, libraryCount, &options);
+            for(unsigned int i = 0; i < libraryCount; i++) {
+                wavefrontMTLRelease(&items[i].mtl);
+            }
+            if(result != STATUS_OK) break;
+            iterations++;
+            elapsed = wallSeconds() - start;
+        } while(elapsed < BENCH_SECONDS);
+
+        char label[64];
+        if(threadCounts[t]) {
+            snprintf(label, sizeof(label), "parseWavefrontMTLBatch %u libraries %u threads",
+                libraryCount, threadCounts[t]);
+        } else {
+            snprintf(label, sizeof(label), "parseWavefrontMTLFromBuffer %u libraries", libraryCount);
+        }
+        printf("%-44s %12.1f MB/sec\n", label,
+            elapsed > 0 ? iterations * (bytes / 1e6) / elapsed : 0);
+    }
+    free(small);
+    free(large);
+}
+
+static void benchParseBatch(unsigned int libraryCount) {
+    struct WavefrontMTLBatchItem *items = calloc(libraryCount, sizeof(struct WavefrontMTLBatchItem));
+    if(!items) return;
+    benchParseBatchItems(items, libraryCount);
+    free(items);
+}
+
+// Text parse against loading the binary cache of the same library.
+static void benchCache(unsigned int materialCount) {
+    char *input = generateLibrary(materialCount);
+    struct WavefrontMTL mtl;
+    if(!input || parseWavefrontMTLFromString(&mtl, input)) {
+        free(input);
+        return;
+    }
+    char *blob;
+    size_t blobLength;
+    int result = wavefrontMTLSerialize(&mtl, &blob, &blobLength);
+    wavefrontMTLRelease(&mtl);
+    if(result) {
+        free(input);
+        return;
+    }
+
+    size_t length = strlen(input);
+    printf("%-44s %12.1f bytes/material\n", "MTL text", (double)length / materialCount);
+    printf("%-44s %12.1f bytes/material\n", "wavefrontMTLSerialize", (double)blobLength / materialCount);
+    for(int cached = 0; cached < 2; cached++) {
+        unsigned int iterations = 0;
+        clock_t start = clock(), elapsed = 0;
+        do {
+            result = cached ?
+                wavefrontMTLDeserialize(&mtl, blob, blobLength, NULL) :
+                parseWavefrontMTLFromBuffer(&mtl, input, length, NULL);
+            if(result != STATUS_OK) break;
+            wavefrontMTLRelease(&mtl);
+            iterations++;
+            elapsed = clock() - start;
+        } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+        double seconds = (double)elapsed / CLOCKS_PER_SEC;
+        char label[64];
+        snprintf(label, sizeof(label), "%s %u materials",
+            cached ? "wavefrontMTLDeserialize" : "parseWavefrontMTLFromBuffer", materialCount);
+        printf("%-44s %12.0f materials/sec\n", label,
+            seconds > 0 ? (double)iterations * materialCount / seconds : 0);
+    }
+    wavefrontFree(blob);
+    free(input);
+}
+
+// Full parse against indexing and looking up one material in every step.
+static void benchIndex(unsigned int materialCount, unsigned int step) {
+    char *input = generateLibrary(materialCount);
+    if(!input) return;
+    size_t length = strlen(input);
+    for(int lazy = 0; lazy < 2; lazy++) {
+        unsigned int iterations = 0;
+        clock_t start = clock(), elapsed = 0;
+        do {
+            int result = STATUS_OK;
+            if(lazy) {
+                struct WavefrontMTLIndex index;
+                result = wavefrontMTLIndexCompose(&index, input, length, NULL);
+                for(unsigned int i = 0; i < materialCount && !result; i += step) {
+                    char name[32];
+                    int material;
+                    snprintf(name, sizeof(name), "Material_%06u", i);
+                    result = wavefrontMTLIndexFind(&index, name, &material);
+                }
+                wavefrontMTLIndexRelease(&index);
+            } else {
+                struct WavefrontMTL mtl;
+                result = parseWavefrontMTLFromBuffer(&mtl, input, length, NULL);
+                wavefrontMTLRelease(&mtl);
+            }
+            if(result != STATUS_OK) break;
+            iterations++;
+            elapsed = clock() - start;
+        } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+        double seconds = (double)elapsed / CLOCKS_PER_SEC;
+        char label[64];
+        if(lazy) {
+            snprintf(label, sizeof(label), "wavefrontMTLIndex %u materials 1/%u used", materialCount, step);
+        } else {
+            snprintf(label, sizeof(label), "parseWavefrontMTLFromBuffer %u materials", materialCount);
+        }
+        printf("%-44s %12.0f libraries/sec\n", label, seconds > 0 ? iterations / seconds : 0);
+    }
+    free(input);
+}
+
+// Gather every diffuse color from the material records against copying the
+// exported array, as when filling a uniform buffer.
+static void benchMaterialArrays(unsigned int materialCount) {
+    char *input = generateLibrary(materialCount);
+    struct WavefrontMTL mtl;
+    struct WavefrontMaterialArrays arrays;
+    struct WavefrontColor *buffer = malloc(materialCount * sizeof(struct WavefrontColor));
+    if(!input || !buffer || parseWavefrontMTLFromString(&mtl, input)) {
+        free(input);
+        free(buffer);
+        return;
+    }
+    if(wavefrontMaterialArraysCompose(&arrays, &mtl) == STATUS_OK) {
+        for(int exported = 0; exported < 2; exported++) {
+            unsigned int iterations = 0;
+            clock_t start = clock(), elapsed = 0;
+            do {
+                if(exported) {
+                    memcpy(buffer, arrays.diffuse, materialCount * sizeof(struct WavefrontColor));
+                } else {
+                    for(unsigned int i = 0; i < materialCount; i++) buffer[i] = mtl.materials[i].diffuse;
+                }
+                iterations++;
+                elapsed = clock() - start;
+            } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+
+            double seconds = (double)elapsed / CLOCKS_PER_SEC;
+            char label[64];
+            snprintf(label, sizeof(label), "%s %u materials",
+                exported ? "diffuse copy from arrays" : "diffuse gather from materials", materialCount);
+            printf("%-44s %12.0f materials/sec\n", label,
+                seconds > 0 ? (double)iterations * materialCount / seconds : 0);
+        }
+        wavefrontMaterialArraysRelease(&arrays);
+    }
+    wavefrontMTLRelease(&mtl);
+    free(buffer);
+    free(input);
+}
+
+// Lines of the classic keywords, the mix measured before the physically
+// based extension was added.
+static const char *keywordLines[] = {
+    "Ka 0.1 0.2 0.3\n", "Kd 0.4 0.5 0.6\n", "Ks 0.7 0.8 0.9\n", "Tf 1 1 1\n",
+    "illum 2\n", "Ns 32\n", "Ni 1.5\n", "d 1\n", "Tr 0\n", "# comment\n",
+    "map_Kd diffuse.png\n", "map_Kn normal.png\n", "map_Ks specular.png\n",
+    "refl -type sphere sphere.png\n", "refl -type cube_right right.png\n",
+};
+
+// Lines of every recognised keyword.
+static const char *allKeywordLines[] = {
+    "Ka 0.1 0.2 0.3\n", "Kd 0.4 0.5 0.6\n", "Ks 0.7 0.8 0.9\n", "Ke 0 0 0\n",
+    "Tf 1 1 1\n", "Tr 0\n", "illum 2\n", "Ns 32\n", "Ni 1.5\n", "d 1\n",
+    "Pr 0.5\n", "Pm 0\n", "Ps 0\n", "Pc 0\n", "Pcr 0.03\n", "aniso 0\n", "anisor 0\n",
+    "map_Ka ambient.png\n", "map_Kd diffuse.png\n", "map_Ks specular.png\n",
+    "map_Ke emission.png\n", "map_Ns highlight.png\n", "map_d alpha.png\n",
+    "map_Pr roughness.png\n", "map_Pm metallic.png\n", "map_Ps sheen.png\n",
+    "map_Kn normal.png\n", "norm normal.png\n", "map_Bump bump.png\n",
+    "bump -bm 0.5 bump.png\n", "disp disp.png\n", "decal decal.png\n",
+    "refl -type sphere sphere.png\n", "refl -type cube_right right.png\n",
+};
+
+// Lines classified and then skipped, isolating keyword dispatch.
+static const char *skippedLines[] = {
+    "sharpness 60\n", "map_aat on\n", "Km 0\n", "Px 0\n",
+    "map_Kx x.png\n", "anisox 0\n", "decals x.png\n", "# comment\n",
+};
+
+static void benchParseLineMix(const char *label, const char **lines, unsigned int lineTypes, unsigned int lineCount) {
+    size_t capacity = (size_t)lineCount * 32 + 32;
+    char *input = malloc(capacity);
+    if(!input) return;
+    size_t length = snprintf(input, capacity, "newmtl keyword_mix\n");
+    unsigned int seed = 1;
+    for(unsigned int i = 0; i < lineCount; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const char *line = lines[(seed >> 16) % lineTypes];
+        length += snprintf(input + length, capacity - length, "%s", line);
+    }
+    benchParse(label, input, lineCount + 1);
+    free(input);
+}
+
+void wavefrontMaterialParserBench() {
+    benchParseFromString(100);
+    benchParseFromString(10000);
+    benchParseFile(100);
+    benchParseFile(10000);
+    benchParseThreads(200000);
+    benchParseTolerant(100000);
+    benchParseBatch(500);
+    benchCache(200000);
+    benchMaterialArrays(100000);
+    benchIndex(20000, 100);
+    benchParseLineMix("parseWavefrontMTLFromString keyword mix",
+        keywordLines, sizeof(keywordLines)/sizeof(keywordLines[0]), 100000);
+    benchParseLineMix("parseWavefrontMTLFromString all keywords",
+        allKeywordLines, sizeof(allKeywordLines)/sizeof(allKeywordLines[0]), 100000);
+    benchParseLineMix("parseWavefrontMTLFromString skipped keywords",
+        skippedLines, sizeof(skippedLines)/sizeof(skippedLines[0]), 100000);
+}
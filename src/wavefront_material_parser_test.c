@@ -1,3 +1,6 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "wavefront_material_parser.h"
 #include "cutil/src/error.h"
 #include "cutil/src/assertion.h"
@@ -364,6 +367,183 @@ void testParseReflectionMapCube() {
 
 }
 
+void testParseMapOptions() {
+    char input[] = "newmtl new_material\n"
+                   "map_Kd -o 0.5 0.25 -s 2 -t 0.1 0.2 0.3 -mm 0.2 0.8 -blendu off -clamp on "
+                   "-imfchan l -texres 512 -boost 1.5 -cc on textures/diffuse map.png \n"
+                   "map_Kn -bm 0.3 -unknown value normal.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    const struct WavefrontMapOptions *options = wavefrontMTLMapOptions(&mtl, &mtl.materials[0].diffuseMap);
+    assertStringsEqual(mtl.materials[0].diffuseMap.file, "textures/diffuse map.png");
+    assertFloatsEqual(options->offset[0], 0.5);
+    assertFloatsEqual(options->offset[1], 0.25);
+    assertFloatsEqual(options->offset[2], 0);
+    // Omitted components keep their defaults.
+    assertFloatsEqual(options->scale[0], 2);
+    assertFloatsEqual(options->scale[1], 1);
+    assertFloatsEqual(options->scale[2], 1);
+    assertFloatsEqual(options->turbulence[2], 0.3);
+    assertFloatsEqual(options->base, 0.2);
+    assertFloatsEqual(options->gain, 0.8);
+    assertFloatsEqual(options->boost, 1.5);
+    assertFloatsEqual(options->bumpMultiplier, 1);
+    assertIntegersEqual(options->resolution, 512);
+    assertIntegersEqual(options->channel, 'l');
+    assertIntegersEqual(options->flags,
+        WAVEFRONT_MAP_BLENDV | WAVEFRONT_MAP_CLAMP | WAVEFRONT_MAP_COLOR_CORRECTION);
+
+    options = wavefrontMTLMapOptions(&mtl, &mtl.materials[0].normalMap);
+    assertStringsEqual(mtl.materials[0].normalMap.file, "normal.png");
+    assertFloatsEqual(options->bumpMultiplier, 0.3);
+    assertFloatsEqual(options->scale[0], 1);
+    assertIntegersEqual(options->flags, WAVEFRONT_MAP_BLENDU | WAVEFRONT_MAP_BLENDV);
+    assertIntegersEqual(mtl.mapOptionCount, 2);
+    // Maps without a file have the default options too.
+    struct WavefrontMapOptions defaults;
+    wavefrontMapOptionsCompose(&defaults);
+    assertIntegersEqual(mtl.materials[0].bumpMap.options, 0);
+    assertIntegersEqual(memcmp(wavefrontMTLMapOptions(&mtl, &mtl.materials[0].bumpMap), &defaults, sizeof(defaults)), 0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseMapOptionsReplaced() {
+    char input[] = "newmtl new_material\n"
+                   "map_Kd -clamp on -s 3 first.png\n"
+                   "map_Kd second.png\n"
+                   "refl -s 4 -type sphere -blendv off sphere.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    struct WavefrontMap *map = &mtl.materials[0].diffuseMap;
+    assertStringsEqual(map->file, "second.png");
+    assertIntegersEqual(map->options, 0);
+    map = &mtl.materials[0].reflectionMapSphere;
+    assertStringsEqual(map->file, "sphere.png");
+    const struct WavefrontMapOptions *options = wavefrontMTLMapOptions(&mtl, map);
+    assertIntegersEqual(options->flags, WAVEFRONT_MAP_BLENDU);
+    assertFloatsEqual(options->scale[0], 4);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseMapOptionsGarbage() {
+    const char *inputs[] = {
+        "newmtl m\nmap_Kd -s file.png\n",
+        "newmtl m\nmap_Kd -mm 1 file.png\n",
+        "newmtl m\nmap_Kd -clamp yes file.png\n",
+        "newmtl m\nmap_Kd -imfchan x file.png\n",
+        "newmtl m\nmap_Kd -texres 1.5 file.png\n",
+        "newmtl m\nrefl -type sphere -bm\n"
+    };
+    // The option keeps its defaults, and its argument is skipped unless it is
+    // the file.
+    for(unsigned int i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        struct WavefrontMTL mtl;
+        int result = parseWavefrontMTLFromString(&mtl, inputs[i]);
+        assertIntegersEqual(result, STATUS_OK);
+        assertIntegersEqual(mtl.materialCount, 1);
+        assertIntegersEqual(mtl.mapOptionCount, 0);
+        const char *file = mtl.materials[0].diffuseMap.file;
+        if(i < 5) assertStringsEqual(file, "file.png");
+        assertIntegersEqual(mtl.materials[0].reflectionMapSphere.file == NULL, 1);
+        wavefrontMTLRelease(&mtl);
+
+        // Tolerant parses report them.
+        struct WavefrontMTLDiagnostic item;
+        struct WavefrontMTLDiagnostics diagnostics = {&item, 1};
+        struct WavefrontMTLOptions options = {0};
+        options.diagnostics = &diagnostics;
+        result = parseWavefrontMTLFromBuffer(&mtl, inputs[i], strlen(inputs[i]), &options);
+        assertIntegersEqual(result, STATUS_OK);
+        assertIntegersEqual(diagnostics.total, 1);
+        assertIntegersEqual(item.error, WAVEFRONT_MTL_ERROR_MAP_OPTION);
+        if(i < 5) assertStringsEqual(mtl.materials[0].diffuseMap.file, "file.png");
+        wavefrontMTLRelease(&mtl);
+    }
+}
+
+void testParseAllMaps() {
+    char input[] = "newmtl new_material\n"
+                   "map_Ka ka.png\n"
+                   "map_Kd kd.png\n"
+                   "map_Ks ks.png\n"
+                   "map_Ke ke.png\n"
+                   "map_Ns ns.png\n"
+                   "map_d d.png\n"
+                   "map_bump -bm 0.5 bump.png\n"
+                   "disp disp.png\n"
+                   "decal decal.png\n"
+                   "map_Pr pr.png\n"
+                   "map_Pm pm.png\n"
+                   "map_Ps ps.png\n"
+                   "norm norm.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    struct WavefrontMaterial *m = mtl.materials;
+    assertStringsEqual(m->ambientMap.file, "ka.png");
+    assertStringsEqual(m->diffuseMap.file, "kd.png");
+    assertStringsEqual(m->specularColorMap.file, "ks.png");
+    assertStringsEqual(m->emissionMap.file, "ke.png");
+    assertStringsEqual(m->specularHighlightMap.file, "ns.png");
+    assertStringsEqual(m->alphaMap.file, "d.png");
+    assertStringsEqual(m->bumpMap.file, "bump.png");
+    assertFloatsEqual(wavefrontMTLMapOptions(&mtl, &m->bumpMap)->bumpMultiplier, 0.5);
+    assertStringsEqual(m->displacementMap.file, "disp.png");
+    assertStringsEqual(m->decalMap.file, "decal.png");
+    assertStringsEqual(m->roughnessMap.file, "pr.png");
+    assertStringsEqual(m->metallicMap.file, "pm.png");
+    assertStringsEqual(m->sheenMap.file, "ps.png");
+    assertStringsEqual(m->normalMap.file, "norm.png");
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseBumpSpellings() {
+    char input[] = "newmtl a\nbump a.png\n"
+                   "newmtl b\nmap_Bump b.png\n"
+                   "newmtl c\nmap_bumps c.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    assertStringsEqual(mtl.materials[0].bumpMap.file, "a.png");
+    assertStringsEqual(mtl.materials[1].bumpMap.file, "b.png");
+    assertIntegersEqual(!mtl.materials[2].bumpMap.file, 1);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParsePhysicallyBased() {
+    char input[] = "newmtl new_material\n"
+                   "Pr 0.25\n"
+                   "Pm 1\n"
+                   "Ps 0.5\n"
+                   "Pc 0.125\n"
+                   "Pcr 0.75\n"
+                   "aniso 0.3\n"
+                   "anisor 0.6\n"
+                   "Ke 0.1 0.2 0.3\n"
+                   "Tr 0.25\n"
+                   "Pq 9\n"
+                   "anisox 9\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    struct WavefrontMaterial *m = mtl.materials;
+    assertFloatsEqual(m->roughness, 0.25);
+    assertFloatsEqual(m->metallic, 1);
+    assertFloatsEqual(m->sheen, 0.5);
+    assertFloatsEqual(m->clearcoatThickness, 0.125);
+    assertFloatsEqual(m->clearcoatRoughness, 0.75);
+    assertFloatsEqual(m->anisotropy, 0.3);
+    assertFloatsEqual(m->anisotropyRotation, 0.6);
+    assertFloatsEqual(m->emission.r, 0.1);
+    assertFloatsEqual(m->emission.b, 0.3);
+    assertFloatsEqual(m->emission.a, 1);
+    // Tr is the transparency, the complement of d.
+    assertFloatsEqual(m->dissolve, 0.75);
+    wavefrontMTLRelease(&mtl);
+}
+
 void testParseBlenderWavefrontMaterial() {
     char input[] = "# Blender MTL File: 'test.xyz'\n"
                    "# Material Count: 1 \n"
@@ -434,6 +614,814 @@ void testParseGuruWavefrontMaterial() {
     wavefrontMTLRelease(&mtl);
 }
 
+void testParseBufferNotTerminated() {
+    char input[] = "newmtl first\nKd 0.1 0.5 0.7\nnewmtl second_is_cut";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 5, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 2);
+    assertStringsEqual(mtl.materials[0].name, "first");
+    assertStringsEqual(mtl.materials[1].name, "second_is");
+    assertFloatsEqual(mtl.materials[0].diffuse.b, 0.7);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseReservesMaterials() {
+    char input[] = "newmtl first\nnewmtl second\n";
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLOptions options = {0};
+    options.materialCapacity = 64;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 2);
+    assertIntegersEqual(mtl.materialCapacity, 64);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseArena() {
+    char input[] = "newmtl first\n"
+                   "map_Kd first.png\n"
+                   "map_Kd replaced.png\n"
+                   "newmtl second\n"
+                   "refl -type sphere sphere.png\n";
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLOptions options = {0};
+    options.flags = WAVEFRONT_MTL_ARENA;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.flags, WAVEFRONT_MTL_ARENA);
+    assertIntegersEqual(mtl.materialCount, 2);
+    assertStringsEqual(mtl.materials[0].name, "first");
+    assertStringsEqual(mtl.materials[0].diffuseMap.file, "replaced.png");
+    assertStringsEqual(mtl.materials[1].reflectionMapSphere.file, "sphere.png");
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseSharedTextures() {
+    char input[] = "newmtl first\n"
+                   "map_Kd shared.png\n"
+                   "map_Kn normal.png\n"
+                   "newmtl second\n"
+                   "map_Kd shared.png\n"
+                   "refl -type sphere normal.png\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.textureCount, 2);
+    assertStringsEqual(mtl.textures[0], "shared.png");
+    assertStringsEqual(mtl.textures[1], "normal.png");
+    struct WavefrontMaterial *first = mtl.materials, *second = mtl.materials + 1;
+    assertIntegersEqual(first->diffuseMap.texture, 1);
+    assertIntegersEqual(second->diffuseMap.texture, 1);
+    assertIntegersEqual(first->diffuseMap.file == second->diffuseMap.file, 1);
+    assertIntegersEqual(first->normalMap.texture, 2);
+    assertIntegersEqual(second->reflectionMapSphere.texture, 2);
+    assertIntegersEqual(second->normalMap.texture, 0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseCarriageReturns() {
+    char input[] = "newmtl new_material\r\n"
+                   "Ka 0.1 0.5 0.7\r\n"
+                   "map_Kd test.png\r\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 1);
+    assertFloatsEqual(mtl.materials[0].ambient.b, 0.7);
+    assertStringsEqual(mtl.materials[0].diffuseMap.file, "test.png");
+    wavefrontMTLRelease(&mtl);
+}
+
+// Lines are found a batch at a time over windows of the input, so use more
+// lines than a batch holds and a line longer than a window.
+void testParseLongLines() {
+    size_t capacity = 300000, length = 0;
+    char *input = malloc(capacity);
+    for(unsigned int i = 0; i < 1000; i++) {
+        length += snprintf(input + length, capacity - length, "newmtl m%u\r\nKd 0.5 0.5 0.5\n", i);
+    }
+    input[length++] = '#';
+    for(unsigned int i = 0; i < 200000; i++) input[length++] = i % 64 ? 'x' : ' ';
+    length += snprintf(input + length, capacity - length, "\nnewmtl last\nmap_Kd last.png");
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, length, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 1001);
+    if(mtl.materialCount == 1001) {
+        assertFloatsEqual(mtl.materials[999].diffuse.g, 0.5);
+        assertStringsEqual(mtl.materials[1000].diffuseMap.file, "last.png");
+    }
+    wavefrontMTLRelease(&mtl);
+
+    struct WavefrontMTLIndex index;
+    wavefrontMTLIndexCompose(&index, input, length, NULL);
+    int material;
+    result = wavefrontMTLIndexFind(&index, "last", &material);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(material, 0);
+    assertIntegersEqual(index.entryCount, 1001);
+    wavefrontMTLIndexRelease(&index);
+    free(input);
+}
+
+void testParseDuplicateMaterial() {
+    char input[] = "newmtl first\n"
+                   "Ka 0.1 0.5 0.7\n"
+                   "newmtl second\n"
+                   "Ka 0.2\n"
+                   "newmtl first\n"
+                   "Kd 0.3\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 2);
+    assertFloatsEqual(mtl.materials[0].ambient.r, 0.1);
+    assertFloatsEqual(mtl.materials[0].diffuse.r, 0.3);
+    assertFloatsEqual(mtl.materials[1].ambient.r, 0.2);
+    assertFloatsEqual(mtl.materials[1].diffuse.r, 0.0);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParsePropertyBeforeMaterial() {
+    char input[] = "Ka 0.1 0.5 0.7\n"
+                   "newmtl new_material\n";
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, input);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 1);
+    assertFloatsEqual(mtl.materials[0].ambient.r, 0.0);
+    wavefrontMTLRelease(&mtl);
+}
+
+static const char libraryInput[] =
+    "# Library\n"
+    "newmtl first\n"
+    "\tKa 0.1 0.2 0.3\n"
+    "\tKd 0.4 0.5 0.6\r\n"
+    "\tNs 96.078431\n"
+    "\tillum 2\n"
+    "\tmap_Kd textures/first_diffuse.png\n"
+    "\n"
+    "newmtl second\n"
+    "Ks 0.7\n"
+    "d 0.25\n"
+    "refl -type cube_left left.png\n"
+    "map_Kn textures/first_diffuse.png\n"
+    "newmtl first\n"
+    "Tf 1 1 1\n"
+    "Ni 1.45";
+
+void assertMTLsEqual(struct WavefrontMTL *a, struct WavefrontMTL *b) {
+    assertIntegersEqual(a->materialCount, b->materialCount);
+    assertIntegersEqual(a->textureCount, b->textureCount);
+    for(unsigned int i = 0; i < a->textureCount && i < b->textureCount; i++) {
+        assertStringsEqual(a->textures[i], b->textures[i]);
+    }
+    if(a->materialCount != b->materialCount) return;
+    for(unsigned int i = 0; i < a->materialCount; i++) {
+        struct WavefrontMaterial *x = a->materials + i, *y = b->materials + i;
+        assertStringsEqual(x->name, y->name);
+        assertIntegersEqual(memcmp(&x->ambient, &y->ambient,
+            (char*)&x->ambientMap - (char*)&x->ambient), 0);
+        for(unsigned int map = 0; map < WAVEFRONT_MATERIAL_MAP_COUNT; map++) {
+            struct WavefrontMap *xMap = wavefrontMaterialMap(x, map);
+            struct WavefrontMap *yMap = wavefrontMaterialMap(y, map);
+            assertIntegersEqual(xMap->texture, yMap->texture);
+            if(xMap->file || yMap->file) assertStringsEqual(xMap->file, yMap->file);
+        }
+    }
+}
+
+void testParseChunked() {
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromString(&expected, libraryInput);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(expected.materialCount, 2);
+
+    size_t length = sizeof(libraryInput) - 1;
+    for(size_t chunkSize = 1; chunkSize <= length; chunkSize++) {
+        struct WavefrontMTL mtl;
+        struct WavefrontMTLParser parser;
+        result = wavefrontMTLParserCompose(&parser, &mtl, NULL);
+        for(size_t offset = 0; !result && offset < length; offset += chunkSize) {
+            size_t size = length - offset < chunkSize ? length - offset : chunkSize;
+            result = wavefrontMTLParserFeed(&parser, libraryInput + offset, size);
+            // Pending storage grows geometrically up to the longest line.
+            if(parser.pendingCapacity > 2 * 34) result = STATUS_ALLOC_ERR;
+        }
+        if(!result) result = wavefrontMTLParserFinish(&parser);
+        assertIntegersEqual(result, STATUS_OK);
+        assertMTLsEqual(&mtl, &expected);
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+}
+
+void testParseChunkedError() {
+    const char *chunks[] = {"newmtl first\nKa 0.1 0.", "2 0.3 asdf\n", "Kd 1\n"};
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLParser parser;
+    int result = wavefrontMTLParserCompose(&parser, &mtl, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLParserFeed(&parser, chunks[0], strlen(chunks[0]));
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLParserFeed(&parser, chunks[1], strlen(chunks[1]));
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+    assertIntegersEqual(mtl.materialCount, 0);
+    result = wavefrontMTLParserFeed(&parser, chunks[2], strlen(chunks[2]));
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+    result = wavefrontMTLParserFinish(&parser);
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+}
+
+static int writeFile(const char *path, const char *data, size_t length) {
+    FILE *file = fopen(path, "wb");
+    if(!file) return STATUS_INPUT_ERR;
+    size_t written = fwrite(data, 1, length, file);
+    fclose(file);
+    return written == length ? STATUS_OK : STATUS_INPUT_ERR;
+}
+
+void testParseFile() {
+    const char *path = "bin/test_parse_file.mtl";
+    int result = writeFile(path, libraryInput, sizeof(libraryInput) - 1);
+    assertIntegersEqual(result, STATUS_OK);
+
+    struct WavefrontMTL expected, mtl;
+    parseWavefrontMTLFromString(&expected, libraryInput);
+    result = parseWavefrontMTLFromFile(&mtl, path, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertMTLsEqual(&mtl, &expected);
+    wavefrontMTLRelease(&mtl);
+    wavefrontMTLRelease(&expected);
+    remove(path);
+}
+
+void testParseFilePageSized() {
+    // A file filling whole pages has no readable byte past its end.
+    const char *path = "bin/test_parse_file.mtl";
+    char input[8192];
+    size_t length = sizeof(input);
+    memset(input, '#', length);
+    const char tail[] = "\nnewmtl last\nNs 12.5";
+    memcpy(input + length - (sizeof(tail) - 1), tail, sizeof(tail) - 1);
+    int result = writeFile(path, input, length);
+    assertIntegersEqual(result, STATUS_OK);
+
+    struct WavefrontMTL mtl;
+    result = parseWavefrontMTLFromFile(&mtl, path, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 1);
+    if(mtl.materialCount) assertFloatsEqual(mtl.materials[0].specularExponent, 12.5);
+    wavefrontMTLRelease(&mtl);
+    remove(path);
+}
+
+void testParseFileEmpty() {
+    const char *path = "bin/test_parse_file.mtl";
+    int result = writeFile(path, "", 0);
+    assertIntegersEqual(result, STATUS_OK);
+    struct WavefrontMTL mtl;
+    result = parseWavefrontMTLFromFile(&mtl, path, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 0);
+    wavefrontMTLRelease(&mtl);
+    remove(path);
+}
+
+void testParseFileMissing() {
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromFile(&mtl, "bin/does_not_exist.mtl", NULL);
+    assertIntegersEqual(result, STATUS_INPUT_ERR);
+}
+
+// A library large enough to split, reopening earlier materials throughout.
+static char *generateLibrary(unsigned int materialCount) {
+    size_t capacity = (size_t)materialCount * 128 + 1;
+    char *output = malloc(capacity);
+    size_t length = 0;
+    for(unsigned int i = 0; output && i < materialCount; i++) {
+        unsigned int name = i % 7 == 6 ? i / 3 : i;
+        length += snprintf(output + length, capacity - length,
+            "newmtl material_%u\n"
+            "Kd %u.25 0.5 0.75\n"
+            "Ns %u\n"
+            "newmtl invalid name\n"
+            "map_Kd textures/diffuse_%u.png\n",
+            name, i % 10, i, i % 50);
+    }
+    return output;
+}
+
+void testParseParallel(unsigned int flags) {
+    char *input = generateLibrary(8000);
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromBuffer(&expected, input, strlen(input), &options);
+    assertIntegersEqual(result, STATUS_OK);
+
+    unsigned int threadCounts[] = {2, 3, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTL mtl;
+        options.threadCount = threadCounts[i];
+        result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+        assertIntegersEqual(result, STATUS_OK);
+        assertIntegersEqual(mtl.flags, flags);
+        assertMTLsEqual(&mtl, &expected);
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+// Textures are numbered in source order even when a piece reopens an
+// earlier material before adding its own, or replaces a map.
+void testParseParallelTextureOrder() {
+    size_t capacity = 20000 * 48 + 256;
+    char *input = malloc(capacity);
+    size_t length = 0;
+    for(unsigned int i = 0; i < 20000; i++) {
+        length += snprintf(input + length, capacity - length, "newmtl m%u\nmap_Kd common.png\n", i);
+    }
+    snprintf(input + length, capacity - length,
+        "newmtl late\nmap_Kd first_new.png\n"
+        "newmtl m5\nmap_Ks second_new.png\n"
+        "newmtl last\nmap_Ka replaced.png\nmap_Ka third_new.png\n");
+    struct WavefrontMTLOptions options = {0};
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromBuffer(&expected, input, strlen(input), &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(expected.textureCount, 5);
+    assertIntegersEqual(expected.materials[wavefrontMTLFindMaterial(&expected, "late")].diffuseMap.texture, 2);
+
+    unsigned int threadCounts[] = {2, 4, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTL mtl;
+        options.threadCount = threadCounts[i];
+        result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+        assertIntegersEqual(result, STATUS_OK);
+        assertMTLsEqual(&mtl, &expected);
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+void testParseParallelError() {
+    char *input = generateLibrary(8000);
+    // Break a line well past the first piece.
+    char *line = strstr(input + strlen(input) / 2, "Kd ");
+    line[3] = 'x';
+    struct WavefrontMTLOptions options = {0};
+    options.threadCount = 4;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+    assertIntegersEqual(mtl.materialCount, 0);
+    free(input);
+}
+
+// Lines 4, 6, 8, 10 and 12 are malformed, line 5 ends with a carriage return.
+static const char tolerantInput[] =
+    "# tolerant\n"
+    "newmtl first\n"
+    "Ka 0.1 0.2 0.3\n"
+    "Ka 0.5 x 0.5\n"
+    "Kd 0.4\r\n"
+    "map_Kd -bm abc diffuse.png\n"
+    "newmtl second\n"
+    "  Ks 1 2 3 4\n"
+    "Ns 10\n"
+    "refl -type sphere -o sphere.png\n"
+    "anisotropically_long_keyword\n"
+    "Tf ";
+
+static void assertDiagnostic(
+    const struct WavefrontMTLDiagnostic *diagnostic,
+    unsigned long long line,
+    const char *keyword,
+    enum WavefrontMTLError error
+) {
+    assertIntegersEqual(diagnostic->line, line);
+    assertStringsEqual(diagnostic->keyword, keyword);
+    assertIntegersEqual(diagnostic->error, error);
+    // The offset is that of the line's start.
+    const char *start = tolerantInput + diagnostic->offset;
+    unsigned long long lines = 1;
+    for(const char *c = tolerantInput; c < start; c++) lines += *c == '\n';
+    assertIntegersEqual(lines, line);
+    assertIntegersEqual(diagnostic->offset == 0 || start[-1] == '\n', 1);
+}
+
+static void assertTolerantDiagnostics(const struct WavefrontMTLDiagnostics *diagnostics) {
+    assertIntegersEqual(diagnostics->total, 5);
+    assertIntegersEqual(diagnostics->count, 5);
+    assertDiagnostic(diagnostics->items + 0, 4, "Ka", WAVEFRONT_MTL_ERROR_BAD_VALUE);
+    assertDiagnostic(diagnostics->items + 1, 6, "map_Kd", WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    assertDiagnostic(diagnostics->items + 2, 8, "Ks", WAVEFRONT_MTL_ERROR_EXTRA_VALUE);
+    assertDiagnostic(diagnostics->items + 3, 10, "refl", WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    assertDiagnostic(diagnostics->items + 4, 12, "Tf", WAVEFRONT_MTL_ERROR_MISSING_VALUE);
+}
+
+static void assertTolerantLibrary(struct WavefrontMTL *mtl) {
+    assertIntegersEqual(mtl->materialCount, 2);
+    if(mtl->materialCount != 2) return;
+    // Skipped lines leave properties as they were, maps are kept without
+    // their malformed options.
+    assertFloatsEqual(mtl->materials[0].ambient.g, 0.2);
+    assertFloatsEqual(mtl->materials[0].diffuse.b, 0.4);
+    assertStringsEqual(mtl->materials[0].diffuseMap.file, "diffuse.png");
+    assertIntegersEqual(mtl->materials[0].diffuseMap.options, 0);
+    assertStringsEqual(mtl->materials[1].reflectionMapSphere.file, "sphere.png");
+    assertFloatsEqual(mtl->materials[1].specular.a, 0);
+    assertFloatsEqual(mtl->materials[1].specularExponent, 10);
+}
+
+void testParseTolerant() {
+    struct WavefrontMTLDiagnostic items[8];
+    struct WavefrontMTLDiagnostics diagnostics = {items, 8, 3, 3};
+    struct WavefrontMTLOptions options = {0};
+    options.diagnostics = &diagnostics;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, tolerantInput, sizeof(tolerantInput) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertTolerantDiagnostics(&diagnostics);
+    assertTolerantLibrary(&mtl);
+    wavefrontMTLRelease(&mtl);
+
+    // Strict parses still fail.
+    result = parseWavefrontMTLFromString(&mtl, tolerantInput);
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+}
+
+void testParseTolerantFull() {
+    struct WavefrontMTLDiagnostic items[2];
+    struct WavefrontMTLDiagnostics diagnostics = {items, 2};
+    struct WavefrontMTLOptions options = {0};
+    options.diagnostics = &diagnostics;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, tolerantInput, sizeof(tolerantInput) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(diagnostics.count, 2);
+    assertIntegersEqual(diagnostics.total, 5);
+    assertDiagnostic(items + 1, 6, "map_Kd", WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    wavefrontMTLRelease(&mtl);
+
+    // Without a buffer lines are only counted.
+    struct WavefrontMTLDiagnostics counted = {NULL, 0};
+    options.diagnostics = &counted;
+    result = parseWavefrontMTLFromBuffer(&mtl, tolerantInput, sizeof(tolerantInput) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(counted.count, 0);
+    assertIntegersEqual(counted.total, 5);
+    assertTolerantLibrary(&mtl);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseTolerantChunked() {
+    size_t length = sizeof(tolerantInput) - 1;
+    for(size_t chunkSize = 1; chunkSize <= length; chunkSize++) {
+        struct WavefrontMTLDiagnostic items[8];
+        struct WavefrontMTLDiagnostics diagnostics = {items, 8};
+        struct WavefrontMTLOptions options = {0};
+        options.diagnostics = &diagnostics;
+        struct WavefrontMTL mtl;
+        struct WavefrontMTLParser parser;
+        int result = wavefrontMTLParserCompose(&parser, &mtl, &options);
+        for(size_t offset = 0; !result && offset < length; offset += chunkSize) {
+            size_t size = length - offset < chunkSize ? length - offset : chunkSize;
+            result = wavefrontMTLParserFeed(&parser, tolerantInput + offset, size);
+        }
+        if(!result) result = wavefrontMTLParserFinish(&parser);
+        assertIntegersEqual(result, STATUS_OK);
+        assertTolerantDiagnostics(&diagnostics);
+        assertTolerantLibrary(&mtl);
+        wavefrontMTLRelease(&mtl);
+    }
+}
+
+void testParseTolerantParallel() {
+    char *input = generateLibrary(8000);
+    // Break lines throughout, including those of reopened materials.
+    unsigned int broken = 0;
+    for(char *line = strstr(input, "\nKd "); line; line = strstr(line + 1, "\nKd ")) {
+        if(broken++ % 97 == 0) line[4] = 'x';
+    }
+    struct WavefrontMTLDiagnostic expectedItems[64], items[64];
+    struct WavefrontMTLDiagnostics expectedDiagnostics = {expectedItems, 64};
+    struct WavefrontMTLOptions options = {0};
+    options.diagnostics = &expectedDiagnostics;
+    struct WavefrontMTL expected;
+    int result = parseWavefrontMTLFromBuffer(&expected, input, strlen(input), &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(expectedDiagnostics.count, 64);
+    assertIntegersEqual(expectedDiagnostics.total, (broken + 96) / 97);
+
+    unsigned int threadCounts[] = {2, 3, 8};
+    for(unsigned int i = 0; i < sizeof(threadCounts)/sizeof(threadCounts[0]); i++) {
+        struct WavefrontMTLDiagnostics diagnostics = {items, 64};
+        struct WavefrontMTL mtl;
+        options.threadCount = threadCounts[i];
+        options.diagnostics = &diagnostics;
+        result = parseWavefrontMTLFromBuffer(&mtl, input, strlen(input), &options);
+        assertIntegersEqual(result, STATUS_OK);
+        assertMTLsEqual(&mtl, &expected);
+        assertIntegersEqual(diagnostics.total, expectedDiagnostics.total);
+        assertIntegersEqual(diagnostics.count, 64);
+        for(unsigned int j = 0; j < diagnostics.count; j++) {
+            assertIntegersEqual(items[j].line, expectedItems[j].line);
+            assertIntegersEqual(items[j].offset, expectedItems[j].offset);
+            assertStringsEqual(items[j].keyword, "Kd");
+        }
+        wavefrontMTLRelease(&mtl);
+    }
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+void testParseStats() {
+    char input[] = "# stats\n"
+                   "newmtl first\n"
+                   "Kd 0.5\n"
+                   "\n"
+                   "Ns 10\n"
+                   "map_Kd first.png\n"
+                   "newmtl second\n"
+                   "newmtl first\n"
+                   "Ka 1 1 1";
+    struct WavefrontMTLStats stats;
+    memset(&stats, 0xff, sizeof(stats));
+    struct WavefrontMTLOptions options = {0};
+    options.stats = &stats;
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, sizeof(input) - 1, &options);
+    assertIntegersEqual(result, STATUS_OK);
+#ifdef WAVEFRONT_MTL_STATS
+    assertIntegersEqual(stats.lines, 9);
+    assertIntegersEqual(stats.bytes, sizeof(input) - 1);
+    assertIntegersEqual(stats.materials, 2);
+    assertIntegersEqual(stats.duplicateMaterials, 1);
+    assertIntegersEqual(stats.statements[WAVEFRONT_MTL_STATEMENT_OTHER], 2);
+    assertIntegersEqual(stats.statements[WAVEFRONT_MTL_STATEMENT_MATERIAL], 3);
+    assertIntegersEqual(stats.statements[WAVEFRONT_MTL_STATEMENT_COLOR], 2);
+    assertIntegersEqual(stats.statements[WAVEFRONT_MTL_STATEMENT_SCALAR], 1);
+    assertIntegersEqual(stats.statements[WAVEFRONT_MTL_STATEMENT_MAP], 1);
+    // Two names, the material list and its table, one texture and its table.
+    assertIntegersEqual(stats.allocation.allocations >= 6, 1);
+    assertIntegersEqual(stats.allocation.bytes > 0, 1);
+#else
+    assertIntegersEqual(stats.lines, 0);
+    assertIntegersEqual(stats.allocation.allocations, 0);
+#endif
+    wavefrontMTLRelease(&mtl);
+}
+
+void testParseStatsParallel() {
+    char *input = generateLibrary(40000);
+    size_t length = strlen(input);
+    struct WavefrontMTLStats expected, stats;
+    struct WavefrontMTLOptions options = {0};
+    options.stats = &expected;
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromBuffer(&mtl, input, length, &options);
+    unsigned int materialCount = mtl.materialCount;
+    wavefrontMTLRelease(&mtl);
+
+    options.stats = &stats;
+    options.threadCount = 4;
+    int result = parseWavefrontMTLFromBuffer(&mtl, input, length, &options);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, materialCount);
+    assertIntegersEqual(stats.lines, expected.lines);
+    assertIntegersEqual(stats.bytes, expected.bytes);
+    assertIntegersEqual(stats.duplicateMaterials, expected.duplicateMaterials);
+    for(unsigned int i = 0; i < WAVEFRONT_MTL_STATEMENT_COUNT; i++) {
+        assertIntegersEqual(stats.statements[i], expected.statements[i]);
+    }
+#ifdef WAVEFRONT_MTL_STATS
+    assertIntegersEqual(stats.materials, materialCount);
+    assertIntegersEqual(stats.materials, expected.materials);
+    assertIntegersEqual(stats.bytes, length);
+#endif
+    wavefrontMTLRelease(&mtl);
+    free(input);
+}
+
+void testParseBatch() {
+    const char *path = "bin/test_parse_batch.mtl";
+    int result = writeFile(path, libraryInput, sizeof(libraryInput) - 1);
+    assertIntegersEqual(result, STATUS_OK);
+    char *large = generateLibrary(2000);
+
+    struct WavefrontMTLBatchItem items[6] = {{0}};
+    items[0].input = "newmtl a\nNs 2";
+    items[0].length = strlen(items[0].input);
+    items[1].path = path;
+    items[2].input = large;
+    items[2].length = strlen(large);
+    items[3].path = "bin/does_not_exist.mtl";
+    items[4].input = "newmtl b\nKa x";
+    items[4].length = strlen(items[4].input);
+    // Only length bytes are parsed.
+    items[5].input = "newmtl c\nnewmtl d";
+    items[5].length = 8;
+
+    struct WavefrontMTLOptions options = {0};
+    options.threadCount = 4;
+    result = parseWavefrontMTLBatch(items, 6, &options);
+    assertIntegersEqual(result, STATUS_INPUT_ERR);
+    assertIntegersEqual(items[0].result, STATUS_OK);
+    assertIntegersEqual(items[0].mtl.materialCount, 1);
+    assertFloatsEqual(items[0].mtl.materials[0].specularExponent, 2);
+    assertIntegersEqual(items[1].result, STATUS_OK);
+    assertIntegersEqual(items[1].mtl.materialCount, 2);
+    assertIntegersEqual(items[2].result, STATUS_OK);
+    struct WavefrontMTL expected;
+    parseWavefrontMTLFromString(&expected, large);
+    assertMTLsEqual(&items[2].mtl, &expected);
+    wavefrontMTLRelease(&expected);
+    assertIntegersEqual(items[3].result, STATUS_INPUT_ERR);
+    assertIntegersEqual(items[3].mtl.materialCount, 0);
+    assertIntegersEqual(items[4].result, STATUS_PARSE_ERR);
+    assertIntegersEqual(items[4].mtl.materialCount, 0);
+    assertIntegersEqual(items[5].result, STATUS_OK);
+    assertIntegersEqual(items[5].mtl.materialCount, 1);
+    for(unsigned int i = 0; i < 6; i++) {
+        wavefrontMTLRelease(&items[i].mtl);
+    }
+    free(large);
+    remove(path);
+}
+
+void testIndex() {
+    char *input = generateLibrary(3000);
+    struct WavefrontMTL expected;
+    parseWavefrontMTLFromString(&expected, input);
+
+    struct WavefrontMTLIndex index;
+    int result = wavefrontMTLIndexCompose(&index, input, strlen(input), NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(index.entryCount, expected.materialCount);
+    assertIntegersEqual(index.mtl.materialCount, 0);
+
+    // Look materials up from the back, so reopened ones are parsed whole.
+    int material = 0;
+    for(unsigned int i = expected.materialCount; i-- > 0;) {
+        struct WavefrontMaterial *m = expected.materials + i;
+        result = wavefrontMTLIndexFind(&index, m->name, &material);
+        assertIntegersEqual(result, STATUS_OK);
+        assertIntegersEqual(material, expected.materialCount - 1 - i);
+        if(material < 0) break;
+        struct WavefrontMaterial *found = index.mtl.materials + material;
+        assertStringsEqual(found->name, m->name);
+        assertIntegersEqual(wavefrontMaterialEqual(&index.mtl, found, &expected, m), 1);
+        if(i == expected.materialCount / 2) break;
+    }
+    // Only materials looked up are parsed, and only once.
+    unsigned int parsed = index.mtl.materialCount;
+    result = wavefrontMTLIndexFind(&index, expected.materials[expected.materialCount - 1].name, &material);
+    assertIntegersEqual(material, 0);
+    assertIntegersEqual(index.mtl.materialCount, parsed);
+    assertIntegersEqual(parsed < expected.materialCount, 1);
+
+    result = wavefrontMTLIndexFind(&index, "missing", &material);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(material, -1);
+    wavefrontMTLIndexRelease(&index);
+    wavefrontMTLRelease(&expected);
+    free(input);
+}
+
+void testIndexParseError() {
+    char input[] =
+        "Kd 0.5\n"
+        "newmtl good\n"
+        "Kd 0.5\n"
+        "newmtl bad\n"
+        "Kd x\n"
+        "newmtl good\n"
+        "Ns 4";
+    struct WavefrontMTLIndex index;
+    int result = wavefrontMTLIndexCompose(&index, input, sizeof(input) - 1, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(index.entryCount, 2);
+
+    int material = 0;
+    result = wavefrontMTLIndexFind(&index, "bad", &material);
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+    assertIntegersEqual(material, -1);
+    assertIntegersEqual(index.mtl.materialCount, 0);
+
+    result = wavefrontMTLIndexFind(&index, "good", &material);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(material, 0);
+    assertFloatsEqual(index.mtl.materials[0].diffuse.r, 0.5);
+    assertFloatsEqual(index.mtl.materials[0].specularExponent, 4);
+    wavefrontMTLIndexRelease(&index);
+}
+
+void testReload(unsigned int flags) {
+    char before[] =
+        "newmtl kept\n"
+        "Kd 0.5\n"
+        "map_Kd kept.png\n"
+        "newmtl changed\n"
+        "Kd 0.5\n"
+        "newmtl removed\n"
+        "newmtl renamed\n"
+        "map_Kn normal.png\n";
+    char after[] =
+        "newmtl added\n"
+        "map_Kd added.png\n"
+        "newmtl renamed_new\n"
+        "map_Kn normal.png\n"
+        "newmtl changed\n"
+        "Kd 0.75\n"
+        "map_Kd kept.png\n"
+        "newmtl kept\n"
+        "Kd 0.5\n"
+        "map_Kd kept.png\n";
+    struct WavefrontMTLOptions options = {0};
+    options.flags = flags;
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromBuffer(&mtl, before, sizeof(before) - 1, &options);
+
+    struct WavefrontMTLChanges changes;
+    int result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 6);
+    assertStringsEqual(mtl.materials[0].name, "kept");
+    assertStringsEqual(mtl.materials[1].name, "changed");
+    assertFloatsEqual(mtl.materials[1].diffuse.r, 0.75);
+    assertStringsEqual(mtl.materials[1].diffuseMap.file, "kept.png");
+    assertIntegersEqual(mtl.materials[1].diffuseMap.texture, mtl.materials[0].diffuseMap.texture);
+    // Removed materials leave an empty slot behind.
+    assertIntegersEqual(mtl.materials[2].name == NULL, 1);
+    assertIntegersEqual(mtl.materials[3].normalMap.file == NULL, 1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "removed"), -1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "renamed"), -1);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "kept"), 0);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "added"), 4);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "renamed_new"), 5);
+    assertStringsEqual(mtl.materials[4].diffuseMap.file, "added.png");
+
+    assertIntegersEqual(changes.changedCount, 1);
+    assertIntegersEqual(changes.changed[0], 1);
+    assertIntegersEqual(changes.removedCount, 2);
+    assertIntegersEqual(changes.removed[0], 2);
+    assertIntegersEqual(changes.removed[1], 3);
+    assertIntegersEqual(changes.addedCount, 2);
+    assertIntegersEqual(changes.added[0], 4);
+    assertIntegersEqual(changes.added[1], 5);
+    wavefrontMTLChangesRelease(&changes);
+
+    // Reloading identical text changes nothing.
+    result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(changes.addedCount + changes.removedCount + changes.changedCount, 0);
+    wavefrontMTLChangesRelease(&changes);
+
+    // Empty slots are filled before the library grows, so switching back
+    // and forth keeps its size.
+    for(unsigned int i = 0; i < 4; i++) {
+        result = wavefrontMTLReload(&mtl, before, sizeof(before) - 1, &changes);
+        assertIntegersEqual(result, STATUS_OK);
+        assertIntegersEqual(mtl.materialCount, 6);
+        assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "kept"), 0);
+        assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "removed"), 2);
+        assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "renamed"), 3);
+        assertIntegersEqual(changes.addedCount, 2);
+        assertIntegersEqual(changes.added[0], 2);
+        assertIntegersEqual(changes.added[1], 3);
+        assertIntegersEqual(changes.removedCount, 2);
+        assertIntegersEqual(changes.removed[0], 4);
+        assertIntegersEqual(changes.removed[1], 5);
+        wavefrontMTLChangesRelease(&changes);
+        result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, NULL);
+        assertIntegersEqual(result, STATUS_OK);
+        assertIntegersEqual(mtl.materialCount, 6);
+        assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "added"), 4);
+        assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "renamed_new"), 5);
+    }
+    wavefrontMTLRelease(&mtl);
+}
+
+void testReloadParseError() {
+    char before[] = "newmtl kept\nKd 0.5\n";
+    char after[] = "newmtl kept\nKd x\n";
+    struct WavefrontMTL mtl;
+    parseWavefrontMTLFromString(&mtl, before);
+    struct WavefrontMTLChanges changes;
+    int result = wavefrontMTLReload(&mtl, after, sizeof(after) - 1, &changes);
+    assertIntegersEqual(result, STATUS_PARSE_ERR);
+    assertIntegersEqual(changes.changedCount, 0);
+    assertIntegersEqual(mtl.materialCount, 1);
+    assertFloatsEqual(mtl.materials[0].diffuse.r, 0.5);
+    wavefrontMTLRelease(&mtl);
+}
+
 void wavefrontMaterialParserTest() {
     testParseNewMaterial();
     testParseNewMaterialNoName();
@@ -473,7 +1461,44 @@ void wavefrontMaterialParserTest() {
 
     testParseReflectionMapSphere();
     testParseReflectionMapCube();
+    testParseMapOptions();
+    testParseMapOptionsReplaced();
+    testParseMapOptionsGarbage();
+    testParseAllMaps();
+    testParseBumpSpellings();
+    testParsePhysicallyBased();
 
     testParseBlenderWavefrontMaterial();
     testParseGuruWavefrontMaterial();
+
+    testParseBufferNotTerminated();
+    testParseReservesMaterials();
+    testParseArena();
+    testParseSharedTextures();
+    testParseCarriageReturns();
+    testParseLongLines();
+    testParseChunked();
+    testParseChunkedError();
+    testParseFile();
+    testParseFilePageSized();
+    testParseFileEmpty();
+    testParseFileMissing();
+    testParseParallel(0);
+    testParseParallel(WAVEFRONT_MTL_ARENA);
+    testParseParallelTextureOrder();
+    testParseParallelError();
+    testParseTolerant();
+    testParseTolerantFull();
+    testParseTolerantChunked();
+    testParseTolerantParallel();
+    testParseStats();
+    testParseStatsParallel();
+    testParseBatch();
+    testIndex();
+    testIndexParseError();
+    testReload(0);
+    testReload(WAVEFRONT_MTL_ARENA);
+    testReloadParseError();
+    testParseDuplicateMaterial();
+    testParsePropertyBeforeMaterial();
 }
@@ -0,0 +1,372 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wavefront_material.h"
+#include "cutil/src/error.h"
+#include "cutil/src/string.h"
+#include "cutil/src/assertion.h"
+
+void testAddMaterial() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    int result = wavefrontMTLAddMaterial(&mtl, strCopy("first"));
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLAddMaterial(&mtl, strCopy("second"));
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 2);
+    assertStringsEqual(mtl.materials[1].name, "second");
+    wavefrontMTLRelease(&mtl);
+    assertIntegersEqual(mtl.materialCount, 0);
+}
+
+void testAddMaterialReusesName() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    wavefrontMTLAddMaterial(&mtl, strCopy("first"));
+    wavefrontMTLAddMaterial(&mtl, strCopy("second"));
+    char *name = strCopy("second");
+    int result = wavefrontMTLAddMaterial(&mtl, name);
+    free(name);
+    assertIntegersEqual(result, 1);
+    assertIntegersEqual(mtl.materialCount, 2);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testFindMaterial() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "missing"), -1);
+
+    char name[32];
+    for(int i = 0; i < 1000; i++) {
+        sprintf(name, "material_%d", i);
+        wavefrontMTLAddMaterial(&mtl, strCopy(name));
+    }
+    assertIntegersEqual(mtl.materialCount, 1000);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "material_0"), 0);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "material_517"), 517);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "material_999"), 999);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "material_1000"), -1);
+    assertIntegersEqual(wavefrontMTLFindMaterialN(&mtl, "material_42_suffix", 11), 42);
+    assertIntegersEqual(wavefrontMTLFindMaterialN(&mtl, "material_4", 9), -1);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testReserveMaterials() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    int result = wavefrontMTLReserve(&mtl, 100);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCapacity, 100);
+    struct WavefrontMaterial *materials = mtl.materials;
+
+    char name[32];
+    for(int i = 0; i < 100; i++) {
+        sprintf(name, "material_%d", i);
+        wavefrontMTLAddMaterial(&mtl, strCopy(name));
+    }
+    assertIntegersEqual(mtl.materials == materials, 1);
+    assertIntegersEqual(mtl.materialCapacity, 100);
+
+    wavefrontMTLAddMaterial(&mtl, strCopy("material_100"));
+    assertIntegersEqual(mtl.materialCapacity, 200);
+    result = wavefrontMTLShrinkToFit(&mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCapacity, 101);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "material_100"), 100);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testShrinkEmpty() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    wavefrontMTLReserve(&mtl, 10);
+    int result = wavefrontMTLShrinkToFit(&mtl);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCapacity, 0);
+    assertIntegersEqual(mtl.materials == NULL, 1);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testArenaStrings() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    mtl.flags |= WAVEFRONT_MTL_ARENA;
+
+    char name[32];
+    for(int i = 0; i < 5000; i++) {
+        sprintf(name, "material_%d", i);
+        char *copy = wavefrontMTLCopyString(&mtl, name, strlen(name));
+        wavefrontMTLAddMaterial(&mtl, copy);
+    }
+    char large[100000];
+    memset(large, 'x', sizeof(large));
+    char *file = wavefrontMTLCopyString(&mtl, large, sizeof(large));
+    mtl.materials[0].diffuseMap.file = file;
+    assertIntegersEqual(strlen(file), sizeof(large));
+    char *small = wavefrontMTLCopyString(&mtl, "file.png", 4);
+    assertStringsEqual(small, "file");
+    wavefrontMTLFreeString(&mtl, small);
+
+    assertIntegersEqual(mtl.materialCount, 5000);
+    assertStringsEqual(mtl.materials[4999].name, "material_4999");
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "material_2500"), 2500);
+    wavefrontMTLRelease(&mtl);
+    assertIntegersEqual(mtl.arena == NULL, 1);
+}
+
+void testInternTexture() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    wavefrontMTLAddMaterial(&mtl, strCopy("material"));
+    // Maps assigned by the caller keep per-field ownership.
+    mtl.materials[0].bumpMap.file = strCopy("bump.png");
+
+    unsigned int first = 0, second = 0, third = 0;
+    assertIntegersEqual(wavefrontMTLInternTexture(&mtl, "a.png", 5, &first), STATUS_OK);
+    assertIntegersEqual(wavefrontMTLInternTexture(&mtl, "b.png|", 5, &second), STATUS_OK);
+    assertIntegersEqual(wavefrontMTLInternTexture(&mtl, "a.png", 5, &third), STATUS_OK);
+    assertIntegersEqual(first, 1);
+    assertIntegersEqual(second, 2);
+    assertIntegersEqual(third, 1);
+    assertIntegersEqual(mtl.textureCount, 2);
+    assertStringsEqual(mtl.textures[1], "b.png");
+
+    char name[32];
+    for(int i = 0; i < 100; i++) {
+        sprintf(name, "texture_%d.png", i);
+        wavefrontMTLInternTexture(&mtl, name, strlen(name), &first);
+    }
+    assertIntegersEqual(mtl.textureCount, 102);
+    wavefrontMTLInternTexture(&mtl, "texture_50.png", 14, &first);
+    assertIntegersEqual(first, 53);
+    wavefrontMTLRelease(&mtl);
+}
+
+static void addMaterialWithMap(struct WavefrontMTL *mtl, const char *name, const char *file) {
+    unsigned int texture = 0;
+    wavefrontMTLAddMaterial(mtl, wavefrontMTLCopyString(mtl, name, strlen(name)));
+    wavefrontMTLInternTexture(mtl, file, strlen(file), &texture);
+    struct WavefrontMaterial *m = mtl->materials + mtl->materialCount - 1;
+    m->diffuseMap.file = mtl->textures[texture - 1];
+    m->diffuseMap.texture = texture;
+}
+
+// Give the diffuse map of the last material a bump multiplier.
+static void setBumpMultiplier(struct WavefrontMTL *mtl, float bumpMultiplier) {
+    struct WavefrontMapOptions options;
+    wavefrontMapOptionsCompose(&options);
+    options.bumpMultiplier = bumpMultiplier;
+    struct WavefrontMaterial *m = mtl->materials + mtl->materialCount - 1;
+    wavefrontMTLInternMapOptions(mtl, &options, &m->diffuseMap.options);
+}
+
+void testAppend(unsigned int flags) {
+    struct WavefrontMTL mtl, other;
+    wavefrontMTLCompose(&mtl);
+    wavefrontMTLCompose(&other);
+    mtl.flags = other.flags = flags;
+    addMaterialWithMap(&mtl, "first", "a.png");
+    addMaterialWithMap(&mtl, "second", "b.png");
+    setBumpMultiplier(&mtl, 2);
+    addMaterialWithMap(&other, "third", "b.png");
+    setBumpMultiplier(&other, 3);
+    addMaterialWithMap(&other, "first", "c.png");
+    setBumpMultiplier(&other, 4);
+    addMaterialWithMap(&other, "fourth", "d.png");
+    setBumpMultiplier(&other, 2);
+    other.materials[0].dissolve = 0.5;
+
+    int result = wavefrontMTLAppend(&mtl, &other);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(other.materialCount, 0);
+    assertIntegersEqual(other.textureCount, 0);
+    assertIntegersEqual(mtl.materialCount, 4);
+    assertStringsEqual(mtl.materials[2].name, "third");
+    assertStringsEqual(mtl.materials[3].name, "fourth");
+    assertFloatsEqual(mtl.materials[2].dissolve, 0.5);
+    // The existing material is kept rather than replaced.
+    assertStringsEqual(mtl.materials[0].diffuseMap.file, "a.png");
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "fourth"), 3);
+
+    // Shared files are interned once, and c.png of the first material left
+    // behind is dropped.
+    assertIntegersEqual(mtl.textureCount, 3);
+    assertStringsEqual(mtl.textures[2], "d.png");
+    assertIntegersEqual(mtl.materials[2].diffuseMap.texture, 2);
+    assertStringsEqual(mtl.materials[2].diffuseMap.file, "b.png");
+    assertIntegersEqual(mtl.materials[3].diffuseMap.texture, 3);
+    assertStringsEqual(mtl.materials[3].diffuseMap.file, "d.png");
+    // Map options likewise.
+    assertIntegersEqual(other.mapOptionCount, 0);
+    assertIntegersEqual(mtl.mapOptionCount, 2);
+    assertIntegersEqual(mtl.materials[2].diffuseMap.options, 2);
+    assertFloatsEqual(mtl.mapOptions[1].bumpMultiplier, 3);
+    assertIntegersEqual(mtl.materials[3].diffuseMap.options, 1);
+    wavefrontMTLRelease(&other);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testAppendFlagsMismatch() {
+    struct WavefrontMTL mtl, other;
+    wavefrontMTLCompose(&mtl);
+    wavefrontMTLCompose(&other);
+    other.flags = WAVEFRONT_MTL_ARENA;
+    assertIntegersEqual(wavefrontMTLAppend(&mtl, &other), STATUS_INPUT_ERR);
+}
+
+void testMaterialEqual() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    addMaterialWithMap(&mtl, "first", "a.png");
+    addMaterialWithMap(&mtl, "second", "a.png");
+    struct WavefrontMaterial *a = mtl.materials, *b = mtl.materials + 1;
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, a, &mtl, b), 1);
+    b->dissolve = 0.5;
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, a, &mtl, b), 0);
+    b->dissolve = 0;
+    b->bumpMap.file = strCopy("a.png");
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, a, &mtl, b), 0);
+    a->bumpMap.file = strCopy("a.png");
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, a, &mtl, b), 1);
+
+    struct WavefrontMapOptions options;
+    wavefrontMapOptionsCompose(&options);
+    options.bumpMultiplier = 2;
+    wavefrontMTLInternMapOptions(&mtl, &options, &b->bumpMap.options);
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, a, &mtl, b), 0);
+    // Options of different libraries compare by value, whatever their index.
+    struct WavefrontMTL other;
+    wavefrontMTLCompose(&other);
+    addMaterialWithMap(&other, "first", "a.png");
+    struct WavefrontMaterial *c = other.materials;
+    c->bumpMap.file = strCopy("a.png");
+    unsigned int index;
+    options.bumpMultiplier = 3;
+    wavefrontMTLInternMapOptions(&other, &options, &index);
+    options.bumpMultiplier = 2;
+    wavefrontMTLInternMapOptions(&other, &options, &c->bumpMap.options);
+    assertIntegersEqual(c->bumpMap.options, 2);
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, b, &other, c), 1);
+    assertIntegersEqual(wavefrontMaterialHash(&mtl, b) == wavefrontMaterialHash(&other, c), 1);
+    assertIntegersEqual(wavefrontMaterialEqual(&mtl, a, &other, c), 0);
+    wavefrontMTLRelease(&other);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testMaterialHash() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    addMaterialWithMap(&mtl, "first", "a.png");
+    addMaterialWithMap(&mtl, "second", "a.png");
+    struct WavefrontMaterial *a = mtl.materials, *b = mtl.materials + 1;
+    assertIntegersEqual(wavefrontMaterialHash(&mtl, a) == wavefrontMaterialHash(&mtl, b), 1);
+    b->diffuse.r = 0.5;
+    assertIntegersEqual(wavefrontMaterialHash(&mtl, a) == wavefrontMaterialHash(&mtl, b), 0);
+    b->diffuse.r = 0;
+    b->bumpMap.file = b->diffuseMap.file;
+    assertIntegersEqual(wavefrontMaterialHash(&mtl, a) == wavefrontMaterialHash(&mtl, b), 0);
+    b->bumpMap.file = NULL;
+    wavefrontMTLRelease(&mtl);
+}
+
+static void addColoredMaterial(struct WavefrontMTL *mtl, const char *name, float red, const char *file) {
+    addMaterialWithMap(mtl, name, file);
+    mtl->materials[mtl->materialCount - 1].diffuse = (struct WavefrontColor){red, 0, 0, 1};
+}
+
+void testMerge(unsigned int flags) {
+    struct WavefrontMTL mtl, sources[3];
+    wavefrontMTLCompose(&mtl);
+    mtl.flags = flags;
+    for(int i = 0; i < 3; i++) wavefrontMTLCompose(sources + i);
+    // Removing a name from an arena library leaks nothing.
+    sources[1].flags = WAVEFRONT_MTL_ARENA;
+    addColoredMaterial(&mtl, "existing", 0.25, "a.png");
+    addColoredMaterial(sources, "first", 1, "a.png");
+    addColoredMaterial(sources, "second", 0.5, "b.png");
+    addColoredMaterial(sources, "third", 0.25, "a.png");
+    addColoredMaterial(sources + 1, "copy", 1, "a.png");
+    addColoredMaterial(sources + 1, "first", 0.75, "a.png");
+    addColoredMaterial(sources + 1, "removed", 0, "c.png");
+    sources[1].materials[2].name = NULL;
+    addColoredMaterial(sources + 2, "first", 0.125, "b.png");
+    addColoredMaterial(sources + 2, "again", 0.5, "b.png");
+
+    struct WavefrontMTLRemap remap;
+    int result = wavefrontMTLMerge(&mtl, sources, 3, &remap);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 5);
+    assertIntegersEqual(mtl.textureCount, 2);
+    assertStringsEqual(mtl.materials[1].name, "first");
+    assertStringsEqual(mtl.materials[2].name, "second");
+    // Renamed after their source.
+    assertStringsEqual(mtl.materials[3].name, "first.2");
+    assertStringsEqual(mtl.materials[4].name, "first.3");
+    assertFloatsEqual(mtl.materials[4].diffuse.r, 0.125);
+    assertStringsEqual(mtl.materials[4].diffuseMap.file, "b.png");
+    assertIntegersEqual(mtl.materials[4].diffuseMap.texture, 2);
+    assertIntegersEqual(wavefrontMTLFindMaterial(&mtl, "first.3"), 4);
+
+    const int expected[] = {1, 2, 0, 1, 3, -1, 4, 2};
+    const unsigned int offsets[] = {0, 3, 6, 8};
+    assertIntegersEqual(remap.sourceCount, 3);
+    assertIntegersEqual(memcmp(remap.offsets, offsets, sizeof(offsets)), 0);
+    assertIntegersEqual(memcmp(remap.indices, expected, sizeof(expected)), 0);
+    wavefrontMTLRemapRelease(&remap);
+    assertIntegersEqual(remap.indices == NULL, 1);
+
+    for(int i = 0; i < 3; i++) wavefrontMTLRelease(sources + i);
+    wavefrontMTLRelease(&mtl);
+}
+
+// Many small libraries drawing on a few hundred distinct materials.
+void testMergeMany() {
+    struct WavefrontMTL sources[100], mtl;
+    char name[32];
+    for(int s = 0; s < 100; s++) {
+        wavefrontMTLCompose(sources + s);
+        for(int i = 0; i < 200; i++) {
+            int content = (s * 7919 + i * 104729) % 300;
+            snprintf(name, sizeof(name), "material%d", i);
+            snprintf(name + 16, sizeof(name) - 16, "%d.png", content % 50);
+            addColoredMaterial(sources + s, name, (float)content, name + 16);
+        }
+    }
+    wavefrontMTLCompose(&mtl);
+    struct WavefrontMTLRemap remap;
+    int result = wavefrontMTLMerge(&mtl, sources, 100, &remap);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materialCount, 300);
+    assertIntegersEqual(mtl.textureCount, 50);
+    int mismatches = 0;
+    for(int s = 0; s < 100; s++) {
+        for(unsigned int i = 0; i < sources[s].materialCount; i++) {
+            int index = remap.indices[remap.offsets[s] + i];
+            mismatches += !wavefrontMaterialEqual(sources + s, sources[s].materials + i, &mtl, mtl.materials + index);
+        }
+        wavefrontMTLRelease(sources + s);
+    }
+    assertIntegersEqual(mismatches, 0);
+    assertIntegersEqual(remap.offsets[100], 100 * 200);
+    wavefrontMTLRemapRelease(&remap);
+    wavefrontMTLRelease(&mtl);
+}
+
+void wavefrontMaterialTest() {
+    testAddMaterial();
+    testAddMaterialReusesName();
+    testFindMaterial();
+    testReserveMaterials();
+    testShrinkEmpty();
+    testArenaStrings();
+    testInternTexture();
+    testAppend(0);
+    testAppend(WAVEFRONT_MTL_ARENA);
+    testAppendFlagsMismatch();
+    testMaterialEqual();
+    testMaterialHash();
+    testMerge(0);
+    testMerge(WAVEFRONT_MTL_ARENA);
+    testMergeMany();
+}
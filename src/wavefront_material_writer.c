@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <string.h>
+#include "cutil/src/error.h"
+#include "wavefront_material_writer.h"
+#include "wavefront_number.h"
+
+// Text gathered before each call to the write callback.
+#define WRITE_BUFFER_SIZE 16384
+
+struct Writer {
+    WavefrontMTLWriteCallback write;
+    void *context;
+    int result;
+    size_t used;
+    char buffer[WRITE_BUFFER_SIZE];
+};
+
+struct Property {
+    const char *keyword;
+    size_t offset;
+};
+
+static const struct Property colors[] = {
+    {"Ka", offsetof(struct WavefrontMaterial, ambient)},
+    {"Kd", offsetof(struct WavefrontMaterial, diffuse)},
+    {"Ks", offsetof(struct WavefrontMaterial, specular)},
+    {"Ke", offsetof(struct WavefrontMaterial, emission)},
+    {"Tf", offsetof(struct WavefrontMaterial, transmission)}
+};
+
+static const struct Property scalars[] = {
+    {"Ns", offsetof(struct WavefrontMaterial, specularExponent)},
+    {"Ni", offsetof(struct WavefrontMaterial, opticalDensity)},
+    {"d", offsetof(struct WavefrontMaterial, dissolve)},
+    {"Pr", offsetof(struct WavefrontMaterial, roughness)},
+    {"Pm", offsetof(struct WavefrontMaterial, metallic)},
+    {"Ps", offsetof(struct WavefrontMaterial, sheen)},
+    {"Pc", offsetof(struct WavefrontMaterial, clearcoatThickness)},
+    {"Pcr", offsetof(struct WavefrontMaterial, clearcoatRoughness)},
+    {"aniso", offsetof(struct WavefrontMaterial, anisotropy)},
+    {"anisor", offsetof(struct WavefrontMaterial, anisotropyRotation)}
+};
+
+// Statement of each map in wavefrontMaterialMap order.
+static const char *const mapKeywords[WAVEFRONT_MATERIAL_MAP_COUNT] = {
+    "map_Ka", "map_Kd", "norm", "map_Ks", "map_Ns", "map_d", "map_Bump",
+    "disp", "decal",
+    "refl -type sphere", "refl -type cube_top", "refl -type cube_bottom",
+    "refl -type cube_front", "refl -type cube_back", "refl -type cube_left",
+    "refl -type cube_right",
+    "map_Pr", "map_Pm", "map_Ps", "map_Ke"
+};
+
+static void flush(struct Writer *w) {
+    if(!w->result && w->used) w->result = w->write(w->context, w->buffer, w->used);
+    w->used = 0;
+}
+
+// Room for size bytes, at most WRITE_BUFFER_SIZE, at the end of the buffer.
+static char *reserve(struct Writer *w, size_t size) {
+    if(w->used + size > WRITE_BUFFER_SIZE) flush(w);
+    return w->buffer + w->used;
+}
+
+static void writeBytes(struct Writer *w, const char *data, size_t length) {
+    while(length) {
+        if(w->used == WRITE_BUFFER_SIZE) flush(w);
+        size_t size = WRITE_BUFFER_SIZE - w->used;
+        if(size > length) size = length;
+        memcpy(w->buffer + w->used, data, size);
+        w->used += size;
+        data += size;
+        length -= size;
+    }
+}
+
+static void writeString(struct Writer *w, const char *string) {
+    writeBytes(w, string, strlen(string));
+}
+
+static void writeChar(struct Writer *w, char c) {
+    *reserve(w, 1) = c;
+    w->used++;
+}
+
+// Each number is preceded by a space.
+static void writeFloat(struct Writer *w, float value) {
+    char *out = reserve(w, 1 + WAVEFRONT_FLOAT_LENGTH);
+    *out = ' ';
+    w->used += 1 + formatWavefrontFloat(value, out + 1);
+}
+
+static void writeInteger(struct Writer *w, int value) {
+    char digits[12];
+    int length = 0;
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    do {
+        digits[length++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while(magnitude);
+    char *out = reserve(w, 2 + sizeof(digits));
+    *out++ = ' ';
+    if(value < 0) *out++ = '-';
+    while(length) *out++ = digits[--length];
+    w->used = out - w->buffer;
+}
+
+static int isZero(const void *value, size_t size) {
+    const unsigned char *bytes = value;
+    for(size_t i = 0; i < size; i++) {
+        if(bytes[i]) return 0;
+    }
+    return 1;
+}
+
+static void writeOptionFloats(struct Writer *w, const char *option, const float *values, int count) {
+    writeString(w, option);
+    for(int i = 0; i < count; i++) writeFloat(w, values[i]);
+}
+
+static void writeOptionSwitch(struct Writer *w, const char *option, unsigned int flags, unsigned int flag) {
+    writeString(w, option);
+    writeString(w, flags & flag ? " on" : " off");
+}
+
+// Options differing from their defaults, each followed by a space.
+static void writeMapOptions(struct Writer *w, const struct WavefrontMapOptions *options) {
+    struct WavefrontMapOptions defaults;
+    wavefrontMapOptionsCompose(&defaults);
+    if(memcmp(options, &defaults, sizeof(struct WavefrontMapOptions)) == 0) return;
+
+    unsigned int changed = options->flags ^ defaults.flags;
+    if(changed & WAVEFRONT_MAP_BLENDU) writeOptionSwitch(w, " -blendu", options->flags, WAVEFRONT_MAP_BLENDU);
+    if(changed & WAVEFRONT_MAP_BLENDV) writeOptionSwitch(w, " -blendv", options->flags, WAVEFRONT_MAP_BLENDV);
+    if(changed & WAVEFRONT_MAP_COLOR_CORRECTION) {
+        writeOptionSwitch(w, " -cc", options->flags, WAVEFRONT_MAP_COLOR_CORRECTION);
+    }
+    if(changed & WAVEFRONT_MAP_CLAMP) writeOptionSwitch(w, " -clamp", options->flags, WAVEFRONT_MAP_CLAMP);
+    if(memcmp(&options->base, &defaults.base, 2 * sizeof(float)) != 0) {
+        writeOptionFloats(w, " -mm", &options->base, 2);
+    }
+    if(memcmp(options->offset, defaults.offset, sizeof(options->offset)) != 0) {
+        writeOptionFloats(w, " -o", options->offset, 3);
+    }
+    if(memcmp(options->scale, defaults.scale, sizeof(options->scale)) != 0) {
+        writeOptionFloats(w, " -s", options->scale, 3);
+    }
+    if(memcmp(options->turbulence, defaults.turbulence, sizeof(options->turbulence)) != 0) {
+        writeOptionFloats(w, " -t", options->turbulence, 3);
+    }
+    if(options->resolution) {
+        writeString(w, " -texres");
+        writeInteger(w, options->resolution);
+    }
+    if(memcmp(&options->bumpMultiplier, &defaults.bumpMultiplier, sizeof(float)) != 0) {
+        writeOptionFloats(w, " -bm", &options->bumpMultiplier, 1);
+    }
+    if(!isZero(&options->boost, sizeof(float))) writeOptionFloats(w, " -boost", &options->boost, 1);
+    // Channels the parser rejects are left out.
+    if(options->channel > 0 && options->channel < 128 && memchr("rgbmlz", options->channel, 6)) {
+        writeString(w, " -imfchan ");
+        writeChar(w, (char)options->channel);
+    }
+}
+
+static void writeMaterial(struct Writer *w, const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m) {
+    writeString(w, "newmtl ");
+    writeString(w, m->name);
+    writeChar(w, '\n');
+    // Defaults are all zero.
+    for(unsigned int i = 0; i < sizeof(colors)/sizeof(colors[0]); i++) {
+        const struct WavefrontColor *color = (const struct WavefrontColor*)((const char*)m + colors[i].offset);
+        if(isZero(color, sizeof(struct WavefrontColor))) continue;
+        writeString(w, colors[i].keyword);
+        writeFloat(w, color->r);
+        writeFloat(w, color->g);
+        writeFloat(w, color->b);
+        writeChar(w, '\n');
+    }
+    for(unsigned int i = 0; i < sizeof(scalars)/sizeof(scalars[0]); i++) {
+        const float *value = (const float*)((const char*)m + scalars[i].offset);
+        if(isZero(value, sizeof(float))) continue;
+        writeString(w, scalars[i].keyword);
+        writeFloat(w, *value);
+        writeChar(w, '\n');
+    }
+    if(m->illuminationModel) {
+        writeString(w, "illum");
+        writeInteger(w, m->illuminationModel);
+        writeChar(w, '\n');
+    }
+    for(unsigned int i = 0; i < WAVEFRONT_MATERIAL_MAP_COUNT; i++) {
+        const struct WavefrontMap *map = wavefrontMaterialMap((struct WavefrontMaterial*)m, i);
+        if(!map->file) continue;
+        writeString(w, mapKeywords[i]);
+        writeMapOptions(w, wavefrontMTLMapOptions(mtl, map));
+        writeChar(w, ' ');
+        writeString(w, map->file);
+        writeChar(w, '\n');
+    }
+}
+
+int writeWavefrontMTL(const struct WavefrontMTL *mtl, WavefrontMTLWriteCallback write, void *context) {
+    if(!write) return STATUS_INPUT_ERR;
+    struct Writer w;
+    w.write = write;
+    w.context = context;
+    w.result = STATUS_OK;
+    w.used = 0;
+    int first = 1;
+    for(unsigned int i = 0; i < mtl->materialCount && !w.result; i++) {
+        // Removed materials have no name.
+        if(!mtl->materials[i].name) continue;
+        if(!first) writeChar(&w, '\n');
+        writeMaterial(&w, mtl, mtl->materials + i);
+        first = 0;
+    }
+    flush(&w);
+    return w.result;
+}
+
+struct BufferOutput {
+    char *buffer;
+    size_t capacity;
+    size_t length;
+};
+
+static int writeToBuffer(void *context, const char *data, size_t length) {
+    struct BufferOutput *output = context;
+    if(output->length < output->capacity) {
+        size_t size = output->capacity - output->length;
+        memcpy(output->buffer + output->length, data, size < length ? size : length);
+    }
+    output->length += length;
+    return STATUS_OK;
+}
+
+int writeWavefrontMTLToBuffer(const struct WavefrontMTL *mtl, char *buffer, size_t capacity, size_t *length) {
+    struct BufferOutput output = {buffer, capacity, 0};
+    int result = writeWavefrontMTL(mtl, writeToBuffer, &output);
+    *length = output.length;
+    if(result) return result;
+    return output.length > capacity ? STATUS_INPUT_ERR : STATUS_OK;
+}
+
+static int writeToFile(void *context, const char *data, size_t length) {
+    return fwrite(data, 1, length, context) == length ? STATUS_OK : STATUS_INPUT_ERR;
+}
+
+int writeWavefrontMTLToFile(const struct WavefrontMTL *mtl, const char *path) {
+    if(!path) return STATUS_INPUT_ERR;
+    FILE *file = fopen(path, "wb");
+    if(!file) return STATUS_INPUT_ERR;
+    int result = writeWavefrontMTL(mtl, writeToFile, file);
+    if(fclose(file) && !result) result = STATUS_INPUT_ERR;
+    return result;
+}
@@ -0,0 +1,29 @@
+#ifndef __WAVEFRONT_MATERIAL_WRITER_H
+#define __WAVEFRONT_MATERIAL_WRITER_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+#include "wavefront_material.h"
+
+// Receives the text in order, a buffer at a time. Returning anything but
+// STATUS_OK stops the write, which then returns that status.
+typedef int (*WavefrontMTLWriteCallback)(void *context, const char *data, size_t length);
+
+// Write mtl as canonical MTL text: materials in order, statements in a fixed
+// order, properties still at their defaults left out and numbers as the
+// shortest text that reads back the same. Parsing the output gives materials
+// equal to those of mtl, except that colors read back with an alpha of 1 and
+// removed materials are left out. Nothing is allocated.
+int writeWavefrontMTL(const struct WavefrontMTL *mtl, WavefrontMTLWriteCallback write, void *context);
+// Write into capacity bytes of buffer, which is not NUL terminated. Length is
+// set to the full length of the text, and STATUS_INPUT_ERR is returned with
+// only the first capacity bytes written when it does not fit.
+int writeWavefrontMTLToBuffer(const struct WavefrontMTL *mtl, char *buffer, size_t capacity, size_t *length);
+int writeWavefrontMTLToFile(const struct WavefrontMTL *mtl, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wavefront_material_parser.h"
+#include "wavefront_material_writer.h"
+#include "cutil/src/error.h"
+
+#define BENCH_SECONDS 0.5
+#define BENCH_MATERIALS 20000
+
+// Materials with full precision colors, as left by tools that blend or
+// convert them, and a map each.
+static void generateLibrary(struct WavefrontMTL *mtl) {
+    wavefrontMTLCompose(mtl);
+    unsigned int seed = 5;
+    char text[64];
+    for(unsigned int i = 0; i < BENCH_MATERIALS; i++) {
+        snprintf(text, sizeof(text), "Material_%06u", i);
+        if(wavefrontMTLAddMaterial(mtl, wavefrontMTLCopyString(mtl, text, strlen(text)))) return;
+        struct WavefrontMaterial *m = mtl->materials + i;
+        struct WavefrontColor *colors[] = {&m->ambient, &m->diffuse, &m->specular};
+        for(unsigned int c = 0; c < 3; c++) {
+            float *channels = &colors[c]->r;
+            for(unsigned int j = 0; j < 3; j++) {
+                seed = seed * 1103515245u + 12345u;
+                channels[j] = (seed >> 8) / (float)(1u << 24);
+            }
+            colors[c]->a = 1;
+        }
+        m->specularExponent = 96.078431f;
+        m->opticalDensity = 1.45f;
+        m->dissolve = 1;
+        m->illuminationModel = 2;
+        snprintf(text, sizeof(text), "textures/diffuse_%03u.png", i % 100);
+        m->diffuseMap.file = wavefrontMTLCopyString(mtl, text, strlen(text));
+    }
+}
+
+static int discard(void *context, const char *data, size_t length) {
+    *(size_t*)context += length;
+    return STATUS_OK;
+}
+
+// The fprintf loop tools wrote before there was a writer, into memory.
+static size_t writeWithSnprintf(const struct WavefrontMTL *mtl, char *output, size_t capacity) {
+    size_t length = 0;
+    for(unsigned int i = 0; i < mtl->materialCount && length < capacity; i++) {
+        const struct WavefrontMaterial *m = mtl->materials + i;
+        length += snprintf(output + length, capacity - length,
+            "newmtl %s\nKa %.9g %.9g %.9g\nKd %.9g %.9g %.9g\nKs %.9g %.9g %.9g\n"
+            "Ns %.9g\nNi %.9g\nd %.9g\nillum %d\nmap_Kd %s\n\n",
+            m->name, m->ambient.r, m->ambient.g, m->ambient.b,
+            m->diffuse.r, m->diffuse.g, m->diffuse.b, m->specular.r, m->specular.g, m->specular.b,
+            m->specularExponent, m->opticalDensity, m->dissolve, m->illuminationModel, m->diffuseMap.file);
+    }
+    return length;
+}
+
+static void printRate(const char *label, double bytes, double materials, clock_t elapsed) {
+    double seconds = (double)elapsed / CLOCKS_PER_SEC;
+    if(seconds <= 0) seconds = 1.0 / CLOCKS_PER_SEC;
+    printf("%-44s %12.1f MB/sec %12.0f materials/sec\n", label, bytes / seconds / 1e6, materials / seconds);
+}
+
+void wavefrontMaterialWriterBench() {
+    struct WavefrontMTL mtl;
+    generateLibrary(&mtl);
+    size_t length = 0;
+    writeWavefrontMTLToBuffer(&mtl, NULL, 0, &length);
+    size_t capacity = length * 2;
+    char *text = malloc(capacity);
+    if(!text) {
+        wavefrontMTLRelease(&mtl);
+        return;
+    }
+
+    double bytes = 0, materials = 0;
+    clock_t start = clock(), elapsed = 0;
+    do {
+        size_t written = 0;
+        if(writeWavefrontMTL(&mtl, discard, &written) != STATUS_OK) break;
+        bytes += written;
+        materials += mtl.materialCount;
+        elapsed = clock() - start;
+    } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+    printRate("writeWavefrontMTL", bytes, materials, elapsed);
+
+    bytes = materials = 0;
+    start = clock();
+    do {
+        bytes += writeWithSnprintf(&mtl, text, capacity);
+        materials += mtl.materialCount;
+        elapsed = clock() - start;
+    } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+    printRate("snprintf %.9g loop", bytes, materials, elapsed);
+
+    // Write then parse the text again.
+    bytes = materials = 0;
+    start = clock();
+    do {
+        struct WavefrontMTL parsed;
+        if(writeWavefrontMTLToBuffer(&mtl, text, capacity, &length) != STATUS_OK) break;
+        if(parseWavefrontMTLFromBuffer(&parsed, text, length, NULL) != STATUS_OK) break;
+        wavefrontMTLRelease(&parsed);
+        bytes += length;
+        materials += mtl.materialCount;
+        elapsed = clock() - start;
+    } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+    printRate("writeWavefrontMTL round trip", bytes, materials, elapsed);
+
+    free(text);
+    wavefrontMTLRelease(&mtl);
+}
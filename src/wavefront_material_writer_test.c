@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wavefront_material_parser.h"
+#include "wavefront_material_writer.h"
+#include "cutil/src/error.h"
+#include "cutil/src/assertion.h"
+
+static const char writerInput[] =
+    "newmtl first\n"
+    "Ka 0.1 0.2 0.3\n"
+    "Kd 0.640000 0.640000 0.640000\n"
+    "Ks 0 0 0\n"
+    "Ns 96.078431\n"
+    "Tr 0.25\n"
+    "illum 2\n"
+    "map_Kd -blendu off -o 0.5 0.25 0 -imfchan r diffuse.png\n"
+    "newmtl second\n"
+    "Ni 1.45\n"
+    "Pr 0.5\n"
+    "Ke 1e-7 0.5 12345678\n"
+    "bump -bm 2 -clamp on -texres 512 bump map.png\n"
+    "refl -type cube_top -mm 0.1 0.9 top.png\n";
+
+// Parse the written text back, returning 1 if every material with a name
+// has a match by name and content.
+static int readsBack(struct WavefrontMTL *mtl, const char *text, size_t length) {
+    struct WavefrontMTL parsed;
+    if(parseWavefrontMTLFromBuffer(&parsed, text, length, NULL) != STATUS_OK) return 0;
+    unsigned int named = 0, matched = 0;
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        if(!mtl->materials[i].name) continue;
+        named++;
+        int index = wavefrontMTLFindMaterial(&parsed, mtl->materials[i].name);
+        if(index >= 0 && wavefrontMaterialEqual(mtl, mtl->materials + i, &parsed, parsed.materials + index)) matched++;
+    }
+    int result = named == matched && parsed.materialCount == named;
+    wavefrontMTLRelease(&parsed);
+    return result;
+}
+
+void testWriteCanonical() {
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, writerInput);
+    assertIntegersEqual(result, STATUS_OK);
+
+    char text[1024];
+    size_t length = 0;
+    result = writeWavefrontMTLToBuffer(&mtl, text, sizeof(text) - 1, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    text[length] = 0;
+    assertStringsEqual(text,
+        "newmtl first\n"
+        "Ka 0.1 0.2 0.3\n"
+        "Kd 0.64 0.64 0.64\n"
+        "Ks 0 0 0\n"
+        "Ns 96.07843\n"
+        "d 0.75\n"
+        "illum 2\n"
+        "map_Kd -blendu off -o 0.5 0.25 0 -imfchan r diffuse.png\n"
+        "\n"
+        "newmtl second\n"
+        "Ke 1e-7 0.5 12345678\n"
+        "Ni 1.45\n"
+        "Pr 0.5\n"
+        "map_Bump -clamp on -texres 512 -bm 2 bump map.png\n"
+        "refl -type cube_top -mm 0.1 0.9 top.png\n");
+    assertIntegersEqual(readsBack(&mtl, text, length), 1);
+
+    // Written text is a fixed point.
+    struct WavefrontMTL parsed;
+    result = parseWavefrontMTLFromBuffer(&parsed, text, length, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    char again[1024];
+    size_t againLength = 0;
+    result = writeWavefrontMTLToBuffer(&parsed, again, sizeof(again), &againLength);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(againLength, length);
+    assertIntegersEqual(memcmp(again, text, length), 0);
+    wavefrontMTLRelease(&parsed);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testWriteBufferSize() {
+    struct WavefrontMTL mtl;
+    int result = parseWavefrontMTLFromString(&mtl, writerInput);
+    assertIntegersEqual(result, STATUS_OK);
+
+    size_t length = 0;
+    result = writeWavefrontMTLToBuffer(&mtl, NULL, 0, &length);
+    assertIntegersEqual(result, STATUS_INPUT_ERR);
+    char *text = malloc(length);
+    size_t written = 0;
+    result = writeWavefrontMTLToBuffer(&mtl, text, length - 1, &written);
+    assertIntegersEqual(result, STATUS_INPUT_ERR);
+    assertIntegersEqual(written, length);
+    result = writeWavefrontMTLToBuffer(&mtl, text, length, &written);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(written, length);
+    assertIntegersEqual(readsBack(&mtl, text, length), 1);
+    free(text);
+
+    // Nothing is written for an empty library.
+    struct WavefrontMTL empty;
+    wavefrontMTLCompose(&empty);
+    result = writeWavefrontMTLToBuffer(&empty, NULL, 0, &written);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(written, 0);
+    wavefrontMTLRelease(&empty);
+    wavefrontMTLRelease(&mtl);
+}
+
+static int failWrite(void *context, const char *data, size_t length) {
+    (*(int*)context)++;
+    return STATUS_ALLOC_ERR;
+}
+
+void testWriteCallbackError() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    // Several buffers worth of text.
+    char name[32];
+    int result = STATUS_OK;
+    for(int i = 0; i < 2000; i++) {
+        snprintf(name, sizeof(name), "material%d", i);
+        result = wavefrontMTLAddMaterial(&mtl, wavefrontMTLCopyString(&mtl, name, strlen(name)));
+        assertIntegersEqual(result, STATUS_OK);
+        mtl.materials[i].diffuse = (struct WavefrontColor){0.125f, 0.25f, 0.5f, 1};
+    }
+    int calls = 0;
+    result = writeWavefrontMTL(&mtl, failWrite, &calls);
+    assertIntegersEqual(result, STATUS_ALLOC_ERR);
+    assertIntegersEqual(calls, 1);
+    assertIntegersEqual(writeWavefrontMTL(&mtl, NULL, NULL), STATUS_INPUT_ERR);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testWriteSkipsRemoved() {
+    struct WavefrontMTL mtl, next;
+    int result = parseWavefrontMTLFromString(&mtl, writerInput);
+    assertIntegersEqual(result, STATUS_OK);
+    result = parseWavefrontMTLFromString(&next, "newmtl second\nNi 1.5\n");
+    assertIntegersEqual(result, STATUS_OK);
+    result = wavefrontMTLUpdate(&mtl, &next, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(mtl.materials[0].name == NULL, 1);
+
+    char text[256];
+    size_t length = 0;
+    result = writeWavefrontMTLToBuffer(&mtl, text, sizeof(text) - 1, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    text[length] = 0;
+    assertStringsEqual(text, "newmtl second\nNi 1.5\n");
+    wavefrontMTLRelease(&next);
+    wavefrontMTLRelease(&mtl);
+}
+
+static float randomFloat(unsigned int *seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    unsigned int bits = *seed;
+    *seed = *seed * 1103515245u + 12345u;
+    bits ^= *seed >> 16;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    // Keep to finite values, mostly in the range colors use.
+    if(value != value || value - value != 0) return 0;
+    return bits & 1 ? value : (float)(bits >> 8) / (1 << 24);
+}
+
+// Materials with random bit patterns in every property read back unchanged.
+void testWriteRoundTripRandom() {
+    struct WavefrontMTL mtl;
+    wavefrontMTLCompose(&mtl);
+    unsigned int seed = 3;
+    char name[32];
+    for(int i = 0; i < 300; i++) {
+        snprintf(name, sizeof(name), "random%d", i);
+        int result = wavefrontMTLAddMaterial(&mtl, wavefrontMTLCopyString(&mtl, name, strlen(name)));
+        assertIntegersEqual(result, STATUS_OK);
+        struct WavefrontMaterial *m = mtl.materials + i;
+        struct WavefrontColor *colors[] = {&m->ambient, &m->diffuse, &m->specular, &m->transmission, &m->emission};
+        // Colors read back with an alpha of 1.
+        for(int j = 0; j < 5; j++) {
+            *colors[j] = (struct WavefrontColor){randomFloat(&seed), randomFloat(&seed), randomFloat(&seed), 1};
+        }
+        float *scalars[] = {
+            &m->specularExponent, &m->dissolve, &m->opticalDensity, &m->roughness, &m->metallic,
+            &m->sheen, &m->clearcoatThickness, &m->clearcoatRoughness, &m->anisotropy, &m->anisotropyRotation
+        };
+        for(int j = 0; j < 10; j++) *scalars[j] = j % 3 ? randomFloat(&seed) : 0;
+        m->illuminationModel = (int)(seed % 11) - 1;
+        for(unsigned int j = i % 3; j < WAVEFRONT_MATERIAL_MAP_COUNT; j += 3) {
+            struct WavefrontMap *map = wavefrontMaterialMap(m, j);
+            snprintf(name, sizeof(name), "dir/map %d.png", (i + j) % 17);
+            map->file = wavefrontMTLCopyString(&mtl, name, strlen(name));
+            struct WavefrontMapOptions o;
+            wavefrontMapOptionsCompose(&o);
+            float *options[] = {
+                o.offset, o.offset + 1, o.offset + 2, o.scale, o.scale + 1, o.scale + 2,
+                o.turbulence, o.turbulence + 1, o.turbulence + 2, &o.bumpMultiplier, &o.boost, &o.base, &o.gain
+            };
+            for(int k = 0; k < 13; k++) {
+                if(seed & (1u << k)) *options[k] = randomFloat(&seed);
+            }
+            seed = seed * 1103515245u + 12345u;
+            o.flags = (seed >> 16) & 0xF;
+            o.resolution = seed & 0x100 ? (int)(seed >> 20) : 0;
+            o.channel = seed & 0x200 ? "rgbmlz"[(seed >> 10) % 6] : 0;
+            wavefrontMTLInternMapOptions(&mtl, &o, &map->options);
+        }
+    }
+    size_t length = 0;
+    writeWavefrontMTLToBuffer(&mtl, NULL, 0, &length);
+    char *text = malloc(length);
+    int result = writeWavefrontMTLToBuffer(&mtl, text, length, &length);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(readsBack(&mtl, text, length), 1);
+    free(text);
+    wavefrontMTLRelease(&mtl);
+}
+
+void testWriteFile() {
+    struct WavefrontMTL mtl, loaded;
+    int result = parseWavefrontMTLFromString(&mtl, writerInput);
+    assertIntegersEqual(result, STATUS_OK);
+    const char *path = "bin/writer_test.mtl";
+    result = writeWavefrontMTLToFile(&mtl, path);
+    assertIntegersEqual(result, STATUS_OK);
+    result = parseWavefrontMTLFromFile(&loaded, path, NULL);
+    assertIntegersEqual(result, STATUS_OK);
+    assertIntegersEqual(loaded.materialCount, 2);
+    assertIntegersEqual(wavefrontMaterialEqual(&loaded, loaded.materials + 1, &mtl, mtl.materials + 1), 1);
+    remove(path);
+    assertIntegersEqual(writeWavefrontMTLToFile(&mtl, "bin/missing/writer_test.mtl"), STATUS_INPUT_ERR);
+    wavefrontMTLRelease(&loaded);
+    wavefrontMTLRelease(&mtl);
+}
+
+void wavefrontMaterialWriterTest() {
+    testWriteCanonical();
+    testWriteBufferSize();
+    testWriteCallbackError();
+    testWriteSkipsRemoved();
+    testWriteRoundTripRandom();
+    testWriteFile();
+}
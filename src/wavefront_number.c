@@ -0,0 +1,799 @@
+#include <stdint.h>
+#include <string.h>
+#include "wavefront_number.h"
+
+// Significant digits held in the 64 bit mantissa.
+#define MANTISSA_DIGITS 19
+// Significant digits compared exactly on the slow path. Any float midpoint
+// is fully represented by far fewer.
+#define SLOW_DIGITS 800
+// Limbs of 32 bits covering SLOW_DIGITS scaled by the widest power of 5 and
+// 2 needed to compare against a midpoint.
+#define BIG_LIMBS 128
+
+#define FLOAT_INFINITY 0x7F800000u
+#define FLOAT_NAN 0x7FC00000u
+#define SMALLEST_POWER_OF_TEN -65
+#define LARGEST_POWER_OF_TEN 38
+
+// Normalized 128 bit approximations of powers of five, high word first.
+static const uint64_t powersOfFive[][2] = {
+    {0x86ccbb52ea94baeaull, 0x98e947129fc2b4e9ull}, // 5^-65
+    {0xa87fea27a539e9a5ull, 0x3f2398d747b36224ull}, // 5^-64
+    {0xd29fe4b18e88640eull, 0x8eec7f0d19a03aadull}, // 5^-63
+    {0x83a3eeeef9153e89ull, 0x1953cf68300424acull}, // 5^-62
+    {0xa48ceaaab75a8e2bull, 0x5fa8c3423c052dd7ull}, // 5^-61
+    {0xcdb02555653131b6ull, 0x3792f412cb06794dull}, // 5^-60
+    {0x808e17555f3ebf11ull, 0xe2bbd88bbee40bd0ull}, // 5^-59
+    {0xa0b19d2ab70e6ed6ull, 0x5b6aceaeae9d0ec4ull}, // 5^-58
+    {0xc8de047564d20a8bull, 0xf245825a5a445275ull}, // 5^-57
+    {0xfb158592be068d2eull, 0xeed6e2f0f0d56712ull}, // 5^-56
+    {0x9ced737bb6c4183dull, 0x55464dd69685606bull}, // 5^-55
+    {0xc428d05aa4751e4cull, 0xaa97e14c3c26b886ull}, // 5^-54
+    {0xf53304714d9265dfull, 0xd53dd99f4b3066a8ull}, // 5^-53
+    {0x993fe2c6d07b7fabull, 0xe546a8038efe4029ull}, // 5^-52
+    {0xbf8fdb78849a5f96ull, 0xde98520472bdd033ull}, // 5^-51
+    {0xef73d256a5c0f77cull, 0x963e66858f6d4440ull}, // 5^-50
+    {0x95a8637627989aadull, 0xdde7001379a44aa8ull}, // 5^-49
+    {0xbb127c53b17ec159ull, 0x5560c018580d5d52ull}, // 5^-48
+    {0xe9d71b689dde71afull, 0xaab8f01e6e10b4a6ull}, // 5^-47
+    {0x9226712162ab070dull, 0xcab3961304ca70e8ull}, // 5^-46
+    {0xb6b00d69bb55c8d1ull, 0x3d607b97c5fd0d22ull}, // 5^-45
+    {0xe45c10c42a2b3b05ull, 0x8cb89a7db77c506aull}, // 5^-44
+    {0x8eb98a7a9a5b04e3ull, 0x77f3608e92adb242ull}, // 5^-43
+    {0xb267ed1940f1c61cull, 0x55f038b237591ed3ull}, // 5^-42
+    {0xdf01e85f912e37a3ull, 0x6b6c46dec52f6688ull}, // 5^-41
+    {0x8b61313bbabce2c6ull, 0x2323ac4b3b3da015ull}, // 5^-40
+    {0xae397d8aa96c1b77ull, 0xabec975e0a0d081aull}, // 5^-39
+    {0xd9c7dced53c72255ull, 0x96e7bd358c904a21ull}, // 5^-38
+    {0x881cea14545c7575ull, 0x7e50d64177da2e54ull}, // 5^-37
+    {0xaa242499697392d2ull, 0xdde50bd1d5d0b9e9ull}, // 5^-36
+    {0xd4ad2dbfc3d07787ull, 0x955e4ec64b44e864ull}, // 5^-35
+    {0x84ec3c97da624ab4ull, 0xbd5af13bef0b113eull}, // 5^-34
+    {0xa6274bbdd0fadd61ull, 0xecb1ad8aeacdd58eull}, // 5^-33
+    {0xcfb11ead453994baull, 0x67de18eda5814af2ull}, // 5^-32
+    {0x81ceb32c4b43fcf4ull, 0x80eacf948770ced7ull}, // 5^-31
+    {0xa2425ff75e14fc31ull, 0xa1258379a94d028dull}, // 5^-30
+    {0xcad2f7f5359a3b3eull, 0x096ee45813a04330ull}, // 5^-29
+    {0xfd87b5f28300ca0dull, 0x8bca9d6e188853fcull}, // 5^-28
+    {0x9e74d1b791e07e48ull, 0x775ea264cf55347eull}, // 5^-27
+    {0xc612062576589ddaull, 0x95364afe032a819eull}, // 5^-26
+    {0xf79687aed3eec551ull, 0x3a83ddbd83f52205ull}, // 5^-25
+    {0x9abe14cd44753b52ull, 0xc4926a9672793543ull}, // 5^-24
+    {0xc16d9a0095928a27ull, 0x75b7053c0f178294ull}, // 5^-23
+    {0xf1c90080baf72cb1ull, 0x5324c68b12dd6339ull}, // 5^-22
+    {0x971da05074da7beeull, 0xd3f6fc16ebca5e04ull}, // 5^-21
+    {0xbce5086492111aeaull, 0x88f4bb1ca6bcf585ull}, // 5^-20
+    {0xec1e4a7db69561a5ull, 0x2b31e9e3d06c32e6ull}, // 5^-19
+    {0x9392ee8e921d5d07ull, 0x3aff322e62439fd0ull}, // 5^-18
+    {0xb877aa3236a4b449ull, 0x09befeb9fad487c3ull}, // 5^-17
+    {0xe69594bec44de15bull, 0x4c2ebe687989a9b4ull}, // 5^-16
+    {0x901d7cf73ab0acd9ull, 0x0f9d37014bf60a11ull}, // 5^-15
+    {0xb424dc35095cd80full, 0x538484c19ef38c95ull}, // 5^-14
+    {0xe12e13424bb40e13ull, 0x2865a5f206b06fbaull}, // 5^-13
+    {0x8cbccc096f5088cbull, 0xf93f87b7442e45d4ull}, // 5^-12
+    {0xafebff0bcb24aafeull, 0xf78f69a51539d749ull}, // 5^-11
+    {0xdbe6fecebdedd5beull, 0xb573440e5a884d1cull}, // 5^-10
+    {0x89705f4136b4a597ull, 0x31680a88f8953031ull}, // 5^-9
+    {0xabcc77118461cefcull, 0xfdc20d2b36ba7c3eull}, // 5^-8
+    {0xd6bf94d5e57a42bcull, 0x3d32907604691b4dull}, // 5^-7
+    {0x8637bd05af6c69b5ull, 0xa63f9a49c2c1b110ull}, // 5^-6
+    {0xa7c5ac471b478423ull, 0x0fcf80dc33721d54ull}, // 5^-5
+    {0xd1b71758e219652bull, 0xd3c36113404ea4a9ull}, // 5^-4
+    {0x83126e978d4fdf3bull, 0x645a1cac083126eaull}, // 5^-3
+    {0xa3d70a3d70a3d70aull, 0x3d70a3d70a3d70a4ull}, // 5^-2
+    {0xccccccccccccccccull, 0xcccccccccccccccdull}, // 5^-1
+    {0x8000000000000000ull, 0x0000000000000000ull}, // 5^0
+    {0xa000000000000000ull, 0x0000000000000000ull}, // 5^1
+    {0xc800000000000000ull, 0x0000000000000000ull}, // 5^2
+    {0xfa00000000000000ull, 0x0000000000000000ull}, // 5^3
+    {0x9c40000000000000ull, 0x0000000000000000ull}, // 5^4
+    {0xc350000000000000ull, 0x0000000000000000ull}, // 5^5
+    {0xf424000000000000ull, 0x0000000000000000ull}, // 5^6
+    {0x9896800000000000ull, 0x0000000000000000ull}, // 5^7
+    {0xbebc200000000000ull, 0x0000000000000000ull}, // 5^8
+    {0xee6b280000000000ull, 0x0000000000000000ull}, // 5^9
+    {0x9502f90000000000ull, 0x0000000000000000ull}, // 5^10
+    {0xba43b74000000000ull, 0x0000000000000000ull}, // 5^11
+    {0xe8d4a51000000000ull, 0x0000000000000000ull}, // 5^12
+    {0x9184e72a00000000ull, 0x0000000000000000ull}, // 5^13
+    {0xb5e620f480000000ull, 0x0000000000000000ull}, // 5^14
+    {0xe35fa931a0000000ull, 0x0000000000000000ull}, // 5^15
+    {0x8e1bc9bf04000000ull, 0x0000000000000000ull}, // 5^16
+    {0xb1a2bc2ec5000000ull, 0x0000000000000000ull}, // 5^17
+    {0xde0b6b3a76400000ull, 0x0000000000000000ull}, // 5^18
+    {0x8ac7230489e80000ull, 0x0000000000000000ull}, // 5^19
+    {0xad78ebc5ac620000ull, 0x0000000000000000ull}, // 5^20
+    {0xd8d726b7177a8000ull, 0x0000000000000000ull}, // 5^21
+    {0x878678326eac9000ull, 0x0000000000000000ull}, // 5^22
+    {0xa968163f0a57b400ull, 0x0000000000000000ull}, // 5^23
+    {0xd3c21bcecceda100ull, 0x0000000000000000ull}, // 5^24
+    {0x84595161401484a0ull, 0x0000000000000000ull}, // 5^25
+    {0xa56fa5b99019a5c8ull, 0x0000000000000000ull}, // 5^26
+    {0xcecb8f27f4200f3aull, 0x0000000000000000ull}, // 5^27
+    {0x813f3978f8940984ull, 0x4000000000000000ull}, // 5^28
+    {0xa18f07d736b90be5ull, 0x5000000000000000ull}, // 5^29
+    {0xc9f2c9cd04674edeull, 0xa400000000000000ull}, // 5^30
+    {0xfc6f7c4045812296ull, 0x4d00000000000000ull}, // 5^31
+    {0x9dc5ada82b70b59dull, 0xf020000000000000ull}, // 5^32
+    {0xc5371912364ce305ull, 0x6c28000000000000ull}, // 5^33
+    {0xf684df56c3e01bc6ull, 0xc732000000000000ull}, // 5^34
+    {0x9a130b963a6c115cull, 0x3c7f400000000000ull}, // 5^35
+    {0xc097ce7bc90715b3ull, 0x4b9f100000000000ull}, // 5^36
+    {0xf0bdc21abb48db20ull, 0x1e86d40000000000ull}, // 5^37
+    {0x96769950b50d88f4ull, 0x1314448000000000ull}, // 5^38
+};
+
+static const float floatPowersOfTen[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static const double doublePowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+struct Decimal {
+    uint64_t mantissa;  // Leading significant digits.
+    int digits;         // Number of digits in mantissa.
+    int exponent;       // Value is mantissa * 10^exponent...
+    int truncated;      // ...plus nonzero digits that did not fit.
+    int negative;
+    const char *begin;  // First digit of the input.
+    const char *end;    // End of the digits, before any exponent.
+};
+
+struct BigInteger {
+    uint32_t limbs[BIG_LIMBS];
+    int count;
+};
+
+static int isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static float floatFromBits(uint32_t bits) {
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+static int leadingZeros(uint64_t x) {
+    int count = 0;
+    if(!(x >> 32)) { count += 32; x <<= 32; }
+    if(!(x >> 48)) { count += 16; x <<= 16; }
+    if(!(x >> 56)) { count += 8; x <<= 8; }
+    if(!(x >> 60)) { count += 4; x <<= 4; }
+    if(!(x >> 62)) { count += 2; x <<= 2; }
+    if(!(x >> 63)) { count += 1; }
+    return count;
+}
+
+static void multiply64(uint64_t a, uint64_t b, uint64_t *high, uint64_t *low) {
+    uint64_t aLow = (uint32_t)a, aHigh = a >> 32;
+    uint64_t bLow = (uint32_t)b, bHigh = b >> 32;
+    uint64_t ll = aLow * bLow, lh = aLow * bHigh;
+    uint64_t hl = aHigh * bLow, hh = aHigh * bHigh;
+    uint64_t middle = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *low = (middle << 32) | (uint32_t)ll;
+    *high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+}
+
+// Eisel-Lemire: round w * 10^q to float bits using a 128 bit product.
+// Returns 0 when the product is too close to call.
+static int eiselLemire(uint64_t w, int q, uint32_t *bits) {
+    if(w == 0 || q < SMALLEST_POWER_OF_TEN) {
+        *bits = 0;
+        return 1;
+    }
+    if(q > LARGEST_POWER_OF_TEN) {
+        *bits = FLOAT_INFINITY;
+        return 1;
+    }
+    int lz = leadingZeros(w);
+    w <<= lz;
+
+    const uint64_t *power = powersOfFive[q - SMALLEST_POWER_OF_TEN];
+    uint64_t high, low;
+    multiply64(w, power[0], &high, &low);
+    // Refine with the low word when the bits that decide rounding are all set.
+    const uint64_t precisionMask = 0xFFFFFFFFFFFFFFFFull >> 26;
+    if((high & precisionMask) == precisionMask) {
+        uint64_t secondHigh, secondLow;
+        multiply64(w, power[1], &secondHigh, &secondLow);
+        low += secondHigh;
+        if(secondHigh > low) high++;
+        if(low == 0xFFFFFFFFFFFFFFFFull && (q < -27 || q > 55)) return 0;
+    }
+
+    int upperBit = (int)(high >> 63);
+    int shift = upperBit + 64 - 23 - 3;
+    uint64_t mantissa = high >> shift;
+    int power2 = (((152170 + 65536) * q) >> 16) + 63 + upperBit - lz + 127;
+    if(power2 <= 0) {
+        // Subnormal.
+        if(-power2 + 1 >= 64) {
+            *bits = 0;
+            return 1;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < (1ull << 23) ? 0 : 1;
+        *bits = ((uint32_t)power2 << 23) | (uint32_t)(mantissa & ((1ull << 23) - 1));
+        return 1;
+    }
+    // Exactly halfway between two floats, round to even.
+    if(low <= 1 && q >= -17 && q <= 10 && (mantissa & 3) == 1 &&
+        (mantissa << shift) == high) {
+        mantissa &= ~1ull;
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if(mantissa >= (2ull << 23)) {
+        mantissa = 1ull << 23;
+        power2++;
+    }
+    mantissa &= ~(1ull << 23);
+    if(power2 >= 0xFF) {
+        *bits = FLOAT_INFINITY;
+        return 1;
+    }
+    *bits = ((uint32_t)power2 << 23) | (uint32_t)mantissa;
+    return 1;
+}
+
+static void bigMultiply(struct BigInteger *b, uint32_t factor) {
+    uint64_t carry = 0;
+    for(int i = 0; i < b->count; i++) {
+        uint64_t product = (uint64_t)b->limbs[i] * factor + carry;
+        b->limbs[i] = (uint32_t)product;
+        carry = product >> 32;
+    }
+    if(carry && b->count < BIG_LIMBS) b->limbs[b->count++] = (uint32_t)carry;
+}
+
+static void bigAdd(struct BigInteger *b, uint32_t value) {
+    for(int i = 0; value && i < b->count; i++) {
+        uint64_t sum = (uint64_t)b->limbs[i] + value;
+        b->limbs[i] = (uint32_t)sum;
+        value = (uint32_t)(sum >> 32);
+    }
+    if(value && b->count < BIG_LIMBS) b->limbs[b->count++] = value;
+}
+
+static void bigMultiplyPow5(struct BigInteger *b, int exponent) {
+    // 5^13 is the largest power of five fitting a limb.
+    for(; exponent >= 13; exponent -= 13) bigMultiply(b, 1220703125u);
+    uint32_t factor = 1;
+    while(exponent-- > 0) factor *= 5;
+    if(factor > 1) bigMultiply(b, factor);
+}
+
+static void bigShiftLeft(struct BigInteger *b, int shift) {
+    int limbShift = shift / 32, bitShift = shift % 32;
+    if(!b->count) return;
+    if(bitShift) {
+        uint32_t carry = 0;
+        for(int i = 0; i < b->count; i++) {
+            uint32_t next = b->limbs[i] >> (32 - bitShift);
+            b->limbs[i] = (b->limbs[i] << bitShift) | carry;
+            carry = next;
+        }
+        if(carry && b->count < BIG_LIMBS) b->limbs[b->count++] = carry;
+    }
+    if(limbShift) {
+        if(b->count + limbShift > BIG_LIMBS) limbShift = BIG_LIMBS - b->count;
+        memmove(b->limbs + limbShift, b->limbs, b->count * sizeof(uint32_t));
+        memset(b->limbs, 0, limbShift * sizeof(uint32_t));
+        b->count += limbShift;
+    }
+}
+
+static int bigCompare(const struct BigInteger *a, const struct BigInteger *b) {
+    if(a->count != b->count) return a->count > b->count ? 1 : -1;
+    for(int i = a->count - 1; i >= 0; i--) {
+        if(a->limbs[i] != b->limbs[i]) return a->limbs[i] > b->limbs[i] ? 1 : -1;
+    }
+    return 0;
+}
+
+// Read up to SLOW_DIGITS significant digits, returning the power of ten of
+// the last one kept and whether any nonzero digit was dropped.
+static int bigFromDecimal(struct BigInteger *b, const struct Decimal *decimal, int *sticky) {
+    int firstPower = decimal->exponent + decimal->digits - 1;
+    int kept = 0;
+    uint32_t chunk = 0, chunkScale = 1;
+    b->count = 0;
+    *sticky = 0;
+    for(const char *p = decimal->begin; p < decimal->end; p++) {
+        if(!isDigit(*p)) continue;
+        if(kept == 0 && *p == '0') continue;
+        if(kept == SLOW_DIGITS) {
+            if(*p != '0') *sticky = 1;
+            continue;
+        }
+        chunk = chunk * 10 + (*p - '0');
+        chunkScale *= 10;
+        kept++;
+        if(chunkScale == 1000000000u) {
+            bigMultiply(b, chunkScale);
+            bigAdd(b, chunk);
+            chunk = 0;
+            chunkScale = 1;
+        }
+    }
+    if(chunkScale > 1) {
+        bigMultiply(b, chunkScale);
+        bigAdd(b, chunk);
+    }
+    return firstPower - kept + 1;
+}
+
+// Compare the decimal against the midpoint between float bits and the next float.
+static int compareMidpoint(const struct Decimal *decimal, uint32_t bits) {
+    uint32_t exponent = bits >> 23, fraction = bits & 0x7FFFFF;
+    uint32_t m = exponent ? fraction | 0x800000 : fraction;
+    int e = exponent ? (int)exponent - 150 : -149;
+
+    struct BigInteger left, right;
+    int sticky;
+    int power = bigFromDecimal(&left, decimal, &sticky);
+    right.limbs[0] = 2 * m + 1;
+    right.count = 1;
+    int leftPower2 = power, rightPower2 = e - 1;
+    if(power >= 0) {
+        bigMultiplyPow5(&left, power);
+    } else {
+        bigMultiplyPow5(&right, -power);
+    }
+    if(leftPower2 > rightPower2) {
+        bigShiftLeft(&left, leftPower2 - rightPower2);
+    } else {
+        bigShiftLeft(&right, rightPower2 - leftPower2);
+    }
+    int result = bigCompare(&left, &right);
+    return result == 0 && sticky ? 1 : result;
+}
+
+// Correct an estimate by comparing the exact decimal against float midpoints.
+static uint32_t slowPath(const struct Decimal *decimal) {
+    double estimate = (double)decimal->mantissa;
+    int q = decimal->exponent;
+    for(; q > 22; q -= 22) estimate *= 1e22;
+    for(; q < -22; q += 22) estimate /= 1e22;
+    estimate = q < 0 ? estimate / doublePowersOfTen[-q] : estimate * doublePowersOfTen[q];
+    float candidate = (float)estimate;
+    uint32_t bits;
+    memcpy(&bits, &candidate, sizeof(bits));
+
+    while(bits < FLOAT_INFINITY) {
+        int comparison = compareMidpoint(decimal, bits);
+        if(comparison < 0) break;
+        if(comparison == 0) return bits + (bits & 1);
+        bits++;
+    }
+    while(bits > 0) {
+        int comparison = compareMidpoint(decimal, bits - 1);
+        if(comparison > 0) break;
+        if(comparison == 0) return bits & 1 ? bits - 1 : bits;
+        bits--;
+    }
+    return bits;
+}
+
+static uint32_t decimalToBits(const struct Decimal *decimal) {
+    uint64_t w = decimal->mantissa;
+    int q = decimal->exponent;
+    if(w == 0) return 0;
+
+    // Leading digit outside the range of float.
+    int firstPower = q + decimal->digits - 1;
+    if(firstPower < -46) return 0;
+    if(firstPower > 38) return FLOAT_INFINITY;
+
+    // Both operands and the single rounding are exact.
+    if(!decimal->truncated && w <= (1u << 24) && q >= -10 && q <= 10) {
+        float value = (float)w;
+        value = q < 0 ? value / floatPowersOfTen[-q] : value * floatPowersOfTen[q];
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    uint32_t bits, upper;
+    if(eiselLemire(w, q, &bits)) {
+        // Dropped digits lie between w and w + 1.
+        if(!decimal->truncated || (eiselLemire(w + 1, q, &upper) && upper == bits)) {
+            return bits;
+        }
+    }
+    return slowPath(decimal);
+}
+
+static const char *matchWord(const char *input, const char *end, const char *word) {
+    for(; *word; word++, input++) {
+        if(input == end || (*input | 0x20) != *word) return NULL;
+    }
+    return input;
+}
+
+const char *parseWavefrontFloat(const char *input, const char *end, float *output) {
+    struct Decimal decimal = {0};
+    const char *p = input;
+    if(p < end && (*p == '+' || *p == '-')) decimal.negative = *p++ == '-';
+    uint32_t sign = decimal.negative ? 0x80000000u : 0;
+
+    decimal.begin = p;
+    int anyDigits = 0;
+    for(; p < end && isDigit(*p); p++) {
+        anyDigits = 1;
+        int digit = *p - '0';
+        if(decimal.digits == 0 && digit == 0) continue;
+        if(decimal.digits < MANTISSA_DIGITS) {
+            decimal.mantissa = decimal.mantissa * 10 + digit;
+            decimal.digits++;
+        } else {
+            decimal.exponent++;
+            if(digit) decimal.truncated = 1;
+        }
+    }
+    if(p < end && *p == '.') {
+        for(p++; p < end && isDigit(*p); p++) {
+            anyDigits = 1;
+            int digit = *p - '0';
+            if(decimal.digits == 0 && digit == 0) {
+                decimal.exponent--;
+            } else if(decimal.digits < MANTISSA_DIGITS) {
+                decimal.mantissa = decimal.mantissa * 10 + digit;
+                decimal.digits++;
+                decimal.exponent--;
+            } else if(digit) {
+                decimal.truncated = 1;
+            }
+        }
+    }
+    decimal.end = p;
+
+    if(!anyDigits) {
+        const char *last;
+        if((last = matchWord(decimal.begin, end, "infinity")) ||
+            (last = matchWord(decimal.begin, end, "inf"))) {
+            *output = floatFromBits(sign | FLOAT_INFINITY);
+            return last;
+        }
+        if((last = matchWord(decimal.begin, end, "nan"))) {
+            *output = floatFromBits(sign | FLOAT_NAN);
+            return last;
+        }
+        return input;
+    }
+
+    if(p < end && (*p == 'e' || *p == 'E')) {
+        const char *e = p + 1;
+        int negative = 0, exponent = 0;
+        if(e < end && (*e == '+' || *e == '-')) negative = *e++ == '-';
+        if(e < end && isDigit(*e)) {
+            for(; e < end && isDigit(*e); e++) {
+                // Saturate, anything this large is zero or infinity.
+                if(exponent < 100000) exponent = exponent * 10 + (*e - '0');
+            }
+            decimal.exponent += negative ? -exponent : exponent;
+            p = e;
+        }
+    }
+
+    *output = floatFromBits(sign | decimalToBits(&decimal));
+    return p;
+}
+
+const char *parseWavefrontInteger(const char *input, const char *end, int *output) {
+    const char *p = input;
+    int negative = 0;
+    if(p < end && (*p == '+' || *p == '-')) negative = *p++ == '-';
+    if(p == end || !isDigit(*p)) return input;
+
+    long long value = 0;
+    for(; p < end && isDigit(*p); p++) {
+        // Saturate rather than overflow.
+        if(value <= 2147483648ll) value = value * 10 + (*p - '0');
+    }
+    if(negative) value = -value;
+    if(value > 2147483647ll) value = 2147483647ll;
+    if(value < -2147483647ll - 1) value = -2147483647ll - 1;
+    *output = (int)value;
+    return p;
+}
+
+// Ryu: shortest decimal digits that read back as the same float.
+#define RYU_POW5_INV_BITCOUNT 59
+#define RYU_POW5_BITCOUNT 61
+
+// floor(2^(pow5Bits(i) + 58) / 5^i) + 1.
+static const uint64_t ryuPow5Inverse[31] = {
+    0x0800000000000001ull, 0x0666666666666667ull, 0x051eb851eb851eb9ull,
+    0x04189374bc6a7efaull, 0x068db8bac710cb2aull, 0x053e2d6238da3c22ull,
+    0x0431bde82d7b634eull, 0x06b5fca6af2bd216ull, 0x055e63b88c230e78ull,
+    0x044b82fa09b5a52dull, 0x06df37f675ef6eaeull, 0x057f5ff85e592558ull,
+    0x0465e6604b7a8447ull, 0x0709709a125da071ull, 0x05a126e1a84ae6c1ull,
+    0x0480ebe7b9d58567ull, 0x0734aca5f6226f0bull, 0x05c3bd5191b525a3ull,
+    0x049c97747490eae9ull, 0x0760f253edb4ab0eull, 0x05e72843249088d8ull,
+    0x04b8ed0283a6d3e0ull, 0x078e480405d7b966ull, 0x060b6cd004ac9452ull,
+    0x04d5f0a66a23a9dbull, 0x07bcb43d769f762bull, 0x063090312bb2c4efull,
+    0x04f3a68dbc8f03f3ull, 0x07ec3daf94180651ull, 0x065697bfa9acd1daull,
+    0x051212ffbaf0a7e2ull
+};
+
+// 5^i scaled to 61 bits, floor(5^i / 2^(pow5Bits(i) - 61)).
+static const uint64_t ryuPow5[48] = {
+    0x1000000000000000ull, 0x1400000000000000ull, 0x1900000000000000ull,
+    0x1f40000000000000ull, 0x1388000000000000ull, 0x186a000000000000ull,
+    0x1e84800000000000ull, 0x1312d00000000000ull, 0x17d7840000000000ull,
+    0x1dcd650000000000ull, 0x12a05f2000000000ull, 0x174876e800000000ull,
+    0x1d1a94a200000000ull, 0x12309ce540000000ull, 0x16bcc41e90000000ull,
+    0x1c6bf52634000000ull, 0x11c37937e0800000ull, 0x16345785d8a00000ull,
+    0x1bc16d674ec80000ull, 0x1158e460913d0000ull, 0x15af1d78b58c4000ull,
+    0x1b1ae4d6e2ef5000ull, 0x10f0cf064dd59200ull, 0x152d02c7e14af680ull,
+    0x1a784379d99db420ull, 0x108b2a2c28029094ull, 0x14adf4b7320334b9ull,
+    0x19d971e4fe8401e7ull, 0x1027e72f1f128130ull, 0x1431e0fae6d7217cull,
+    0x193e5939a08ce9dbull, 0x1f8def8808b02452ull, 0x13b8b5b5056e16b3ull,
+    0x18a6e32246c99c60ull, 0x1ed09bead87c0378ull, 0x13426172c74d822bull,
+    0x1812f9cf7920e2b6ull, 0x1e17b84357691b64ull, 0x12ced32a16a1b11eull,
+    0x178287f49c4a1d66ull, 0x1d6329f1c35ca4bfull, 0x125dfa371a19e6f7ull,
+    0x16f578c4e0a060b5ull, 0x1cb2d6f618c878e3ull, 0x11efc659cf7d4b8dull,
+    0x166bb7f0435c9e71ull, 0x1c06a5ec5433c60dull, 0x118427b3b4a05bc8ull
+};
+
+// ceil(log2(5^e)), or 1 for e == 0.
+static int pow5Bits(int e) {
+    return (int)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e)).
+static uint32_t log10Pow2(int e) {
+    return ((uint32_t)e * 78913) >> 18;
+}
+
+// floor(log10(5^e)).
+static uint32_t log10Pow5(int e) {
+    return ((uint32_t)e * 732923) >> 20;
+}
+
+static int multipleOfPowerOf5(uint32_t value, uint32_t p) {
+    uint32_t count = 0;
+    for(; value % 5 == 0; value /= 5) count++;
+    return count >= p;
+}
+
+static int multipleOfPowerOf2(uint32_t value, uint32_t p) {
+    return (value & ((1u << p) - 1)) == 0;
+}
+
+// (m * factor) >> shift for shift above 32, without a 128 bit type.
+static uint32_t multiplyShift(uint32_t m, uint64_t factor, int shift) {
+    uint64_t low = (uint64_t)m * (uint32_t)factor;
+    uint64_t high = (uint64_t)m * (factor >> 32);
+    return (uint32_t)(((low >> 32) + high) >> (shift - 32));
+}
+
+// Shortest digits and decimal exponent of a finite, non-zero float.
+static uint32_t shortestDigits(uint32_t ieeeMantissa, uint32_t ieeeExponent, int *exponent) {
+    int e2;
+    uint32_t m2;
+    if(ieeeExponent == 0) {
+        e2 = 1 - 127 - 23 - 2;
+        m2 = ieeeMantissa;
+    } else {
+        e2 = (int)ieeeExponent - 127 - 23 - 2;
+        m2 = (1u << 23) | ieeeMantissa;
+    }
+    int acceptBounds = (m2 & 1) == 0;
+
+    // The float and the midpoints to its neighbours, scaled by 4.
+    uint32_t mv = 4 * m2;
+    uint32_t mp = 4 * m2 + 2;
+    uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+    uint32_t mm = 4 * m2 - 1 - mmShift;
+
+    uint32_t vr, vp, vm;
+    int e10;
+    int vmIsTrailingZeros = 0, vrIsTrailingZeros = 0;
+    uint32_t lastRemovedDigit = 0;
+    if(e2 >= 0) {
+        uint32_t q = log10Pow2(e2);
+        e10 = (int)q;
+        int k = RYU_POW5_INV_BITCOUNT + pow5Bits((int)q) - 1;
+        int i = -e2 + (int)q + k;
+        vr = multiplyShift(mv, ryuPow5Inverse[q], i);
+        vp = multiplyShift(mp, ryuPow5Inverse[q], i);
+        vm = multiplyShift(mm, ryuPow5Inverse[q], i);
+        if(q != 0 && (vp - 1) / 10 <= vm / 10) {
+            int l = RYU_POW5_INV_BITCOUNT + pow5Bits((int)q - 1) - 1;
+            lastRemovedDigit = multiplyShift(mv, ryuPow5Inverse[q - 1], -e2 + (int)q - 1 + l) % 10;
+        }
+        if(q <= 9) {
+            // Only one of mp, mv and mm can be a multiple of 5, if any.
+            if(mv % 5 == 0) {
+                vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+            } else if(acceptBounds) {
+                vmIsTrailingZeros = multipleOfPowerOf5(mm, q);
+            } else {
+                vp -= multipleOfPowerOf5(mp, q);
+            }
+        }
+    } else {
+        uint32_t q = log10Pow5(-e2);
+        e10 = (int)q + e2;
+        int i = -e2 - (int)q;
+        int k = pow5Bits(i) - RYU_POW5_BITCOUNT;
+        int j = (int)q - k;
+        vr = multiplyShift(mv, ryuPow5[i], j);
+        vp = multiplyShift(mp, ryuPow5[i], j);
+        vm = multiplyShift(mm, ryuPow5[i], j);
+        if(q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = (int)q - 1 - (pow5Bits(i + 1) - RYU_POW5_BITCOUNT);
+            lastRemovedDigit = multiplyShift(mv, ryuPow5[i + 1], j) % 10;
+        }
+        if(q <= 1) {
+            // mv has at least q trailing zero bits.
+            vrIsTrailingZeros = 1;
+            if(acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            } else {
+                vp--;
+            }
+        } else if(q < 31) {
+            vrIsTrailingZeros = multipleOfPowerOf2(mv, q - 1);
+        }
+    }
+
+    // Drop digits while the interval still holds a shorter number.
+    int removed = 0;
+    uint32_t output;
+    if(vmIsTrailingZeros || vrIsTrailingZeros) {
+        while(vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if(vmIsTrailingZeros) {
+            while(vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        // Exactly halfway rounds to even.
+        if(vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) lastRemovedDigit = 4;
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    } else {
+        while(vp / 10 > vm / 10) {
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || lastRemovedDigit >= 5);
+    }
+    *exponent = e10 + removed;
+    return output;
+}
+
+static int decimalLength(uint32_t v) {
+    int length = 1;
+    while(v >= 10) {
+        v /= 10;
+        length++;
+    }
+    return length;
+}
+
+static char *copyWord(char *output, const char *word) {
+    while(*word) *output++ = *word++;
+    return output;
+}
+
+size_t formatWavefrontFloat(float value, char *output) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t ieeeMantissa = bits & ((1u << 23) - 1);
+    uint32_t ieeeExponent = (bits >> 23) & 0xFF;
+    char *out = output;
+    if(ieeeExponent == 0xFF && ieeeMantissa) return copyWord(out, "nan") - output;
+    if(bits >> 31) *out++ = '-';
+    if(ieeeExponent == 0xFF) return copyWord(out, "inf") - output;
+    if(!ieeeExponent && !ieeeMantissa) {
+        *out++ = '0';
+        return out - output;
+    }
+
+    int exponent;
+    uint32_t digits = shortestDigits(ieeeMantissa, ieeeExponent, &exponent);
+    int length = decimalLength(digits);
+    char text[9];
+    for(int i = length - 1; i >= 0; i--, digits /= 10) text[i] = (char)('0' + digits % 10);
+    // Position of the decimal point relative to the first digit.
+    int point = length + exponent;
+
+    if(point > -4 && point <= 9) {
+        if(point <= 0) {
+            out = copyWord(out, "0.");
+            for(int i = point; i < 0; i++) *out++ = '0';
+            for(int i = 0; i < length; i++) *out++ = text[i];
+        } else {
+            for(int i = 0; i < length || i < point; i++) {
+                if(i == point) *out++ = '.';
+                *out++ = i < length ? text[i] : '0';
+            }
+        }
+        return out - output;
+    }
+
+    *out++ = text[0];
+    if(length > 1) {
+        *out++ = '.';
+        for(int i = 1; i < length; i++) *out++ = text[i];
+    }
+    *out++ = 'e';
+    int scientific = point - 1;
+    if(scientific < 0) {
+        *out++ = '-';
+        scientific = -scientific;
+    }
+    if(scientific >= 10) *out++ = (char)('0' + scientific / 10);
+    *out++ = (char)('0' + scientific % 10);
+    return out - output;
+}
+
+unsigned short wavefrontFloatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t magnitude = bits & 0x7FFFFFFF;
+    // NaN stays NaN, quieted so the payload cannot turn it into infinity.
+    if(magnitude > FLOAT_INFINITY) return (unsigned short)(sign | 0x7E00 | (magnitude >> 13 & 0x3FF));
+    // 65520 and up round to infinity.
+    if(magnitude >= 0x477FF000) return (unsigned short)(sign | 0x7C00);
+    uint32_t half, remainder, halfway;
+    if(magnitude < 0x38800000) {
+        // Subnormal, in units of 2^-24; 2^-25 and below round to zero.
+        if(magnitude < 0x33000000) return (unsigned short)sign;
+        uint32_t shift = 126 - (magnitude >> 23);
+        uint32_t mantissa = (magnitude & 0x7FFFFF) | 0x800000;
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    } else {
+        // Rebias the exponent from 127 to 15.
+        half = (magnitude - 0x38000000) >> 13;
+        remainder = magnitude & 0x1FFF;
+        halfway = 0x1000;
+    }
+    // Round to nearest, ties to even, carrying into the exponent.
+    if(remainder > halfway || (remainder == halfway && (half & 1))) half++;
+    return (unsigned short)(sign | half);
+}
+
+float wavefrontHalfToFloat(unsigned short half) {
+    uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FF;
+    if(exponent == 0x1F) return floatFromBits(sign | FLOAT_INFINITY | mantissa << 13);
+    if(exponent) return floatFromBits(sign | (exponent + 112) << 23 | mantissa << 13);
+    if(!mantissa) return floatFromBits(sign);
+    // Normalize subnormals.
+    exponent = 113;
+    while(!(mantissa & 0x400)) {
+        mantissa <<= 1;
+        exponent--;
+    }
+    return floatFromBits(sign | exponent << 23 | (mantissa & 0x3FF) << 13);
+}
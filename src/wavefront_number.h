@@ -0,0 +1,34 @@
+#ifndef __WAVEFRONT_NUMBER_H
+#define __WAVEFRONT_NUMBER_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+
+// Locale independent number parsing over [input, end). Each returns the end
+// of the number, or input when none was found and output is left unchanged.
+
+// Decimal floats are correctly rounded, matching strtof in the C locale.
+const char *parseWavefrontFloat(const char *input, const char *end, float *output);
+const char *parseWavefrontInteger(const char *input, const char *end, int *output);
+
+// Longest output of formatWavefrontFloat.
+#define WAVEFRONT_FLOAT_LENGTH 16
+
+// Write the shortest decimal that parseWavefrontFloat reads back as value,
+// without a terminator, and return its length. Values from 1e-4 up to but
+// excluding 1e9 are written without an exponent.
+size_t formatWavefrontFloat(float value, char *output);
+
+// IEEE 754 binary16 conversion. Floats round to the nearest half, ties to
+// even, so at most 2^-11 relative error in the normal range. Magnitudes of
+// 65520 and up become infinity and those of 2^-25 and below zero.
+unsigned short wavefrontFloatToHalf(float value);
+// Exact.
+float wavefrontHalfToFloat(unsigned short half);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
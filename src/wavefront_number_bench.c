@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wavefront_number.h"
+
+#define BENCH_SECONDS 0.5
+#define BENCH_NUMBERS 4096
+
+// Numbers shaped like those written by common exporters.
+static void generateNumbers(char numbers[][32], const char *format) {
+    unsigned int seed = 7;
+    for(int i = 0; i < BENCH_NUMBERS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        snprintf(numbers[i], 32, format, (seed >> 8) / (double)(1u << 24) * (i % 4 ? 1 : 1000));
+    }
+}
+
+static void benchNumbers(const char *label, char numbers[][32]) {
+    size_t lengths[BENCH_NUMBERS];
+    for(int i = 0; i < BENCH_NUMBERS; i++) lengths[i] = strlen(numbers[i]);
+
+    volatile float sink = 0;
+    double parsed[2] = {0};
+    clock_t elapsed[2] = {0};
+    for(int parser = 0; parser < 2; parser++) {
+        clock_t start = clock();
+        do {
+            for(int i = 0; i < BENCH_NUMBERS; i++) {
+                float value = 0;
+                if(parser == 0) {
+                    value = strtof(numbers[i], NULL);
+                } else {
+                    parseWavefrontFloat(numbers[i], numbers[i] + lengths[i], &value);
+                }
+                sink += value;
+            }
+            parsed[parser] += BENCH_NUMBERS;
+            elapsed[parser] = clock() - start;
+        } while(elapsed[parser] < BENCH_SECONDS * CLOCKS_PER_SEC);
+    }
+    for(int parser = 0; parser < 2; parser++) {
+        double seconds = (double)elapsed[parser] / CLOCKS_PER_SEC;
+        char name[64];
+        snprintf(name, sizeof(name), "%s %s", parser ? "parseWavefrontFloat" : "strtof", label);
+        printf("%-44s %12.0f numbers/sec\n", name, seconds > 0 ? parsed[parser] / seconds : 0);
+    }
+}
+
+void wavefrontNumberBench() {
+    static char numbers[BENCH_NUMBERS][32];
+    generateNumbers(numbers, "%f");
+    benchNumbers("%f", numbers);
+    generateNumbers(numbers, "%.4f");
+    benchNumbers("%.4f", numbers);
+    generateNumbers(numbers, "%.9g");
+    benchNumbers("%.9g", numbers);
+}
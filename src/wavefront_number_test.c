@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wavefront_number.h"
+#include "cutil/src/assertion.h"
+
+// Compare bit patterns so signed zeros and rounding differences show.
+static int sameFloat(float a, float b) {
+    return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+// Parse input with both parsers, returning 1 if the results are identical.
+static int matchesStrtof(const char *input) {
+    char *expectedEnd = NULL;
+    float expected = strtof(input, &expectedEnd);
+    float actual = 0;
+    const char *end = input + strlen(input);
+    const char *actualEnd = parseWavefrontFloat(input, end, &actual);
+    if(actualEnd == input) actual = 0;
+    if(actualEnd != expectedEnd || !sameFloat(actual, expected)) {
+        printf("%s: parsed %.9g, strtof %.9g\n", input, actual, expected);
+        return 0;
+    }
+    return 1;
+}
+
+void testParseFloatSimple() {
+    const char *inputs[] = {
+        "0", "-0", "1", "0.5", "0.640000", "96.078431", "1.000000", "3.920000",
+        "+2.5", "-0.0001", ".5", "5.", "1e3", "1E-3", "2.5e+2", "1e", "1e+",
+        "0.1", "0.2", "0.3", "3.4028235e38", "3.4028236e38", "1e39", "1e-45",
+        "7e-46", "8e-46", "1.17549435e-38", "1.4e-45", "inf", "-Infinity",
+        "1.5 0.5", "12abc", "00000000000000000000000000000123.456",
+        "0.000000000000000000000000000000000000000000000000001"
+    };
+    int matched = 0;
+    for(unsigned int i = 0; i < sizeof(inputs)/sizeof(inputs[0]); i++) {
+        matched += matchesStrtof(inputs[i]);
+    }
+    assertIntegersEqual(matched, sizeof(inputs)/sizeof(inputs[0]));
+}
+
+void testParseFloatInvalid() {
+    const char *inputs[] = {"", "-", ".", "e5", "abc", "+.e1"};
+    for(unsigned int i = 0; i < sizeof(inputs)/sizeof(inputs[0]); i++) {
+        float value = 42;
+        const char *input = inputs[i];
+        const char *end = parseWavefrontFloat(input, input + strlen(input), &value);
+        assertIntegersEqual(end == input, 1);
+        assertFloatsEqual(value, 42);
+    }
+}
+
+void testParseFloatBounded() {
+    const char input[] = "0.12345";
+    float value = 0;
+    const char *end = parseWavefrontFloat(input, input + 4, &value);
+    assertIntegersEqual(end - input, 4);
+    assertFloatsEqual(value, 0.12);
+}
+
+static const char *roundTripFormats[] = {"%.9g", "%.6g", "%.3g", "%.17g", "%.30e"};
+// Significands sampled at each end of every exponent.
+#define EDGE_SIGNIFICANDS 64
+
+// Print the float with bit pattern in the first count formats, returning
+// how many parse differently from strtof.
+static int parseMismatches(uint32_t pattern, unsigned int count) {
+    char input[128];
+    float value;
+    memcpy(&value, &pattern, sizeof(value));
+    int mismatches = 0;
+    for(unsigned int i = 0; i < count; i++) {
+        snprintf(input, sizeof(input), roundTripFormats[i], value);
+        mismatches += !matchesStrtof(input);
+    }
+    return mismatches;
+}
+
+// Every float printed as its shortest round trip form and with more or
+// fewer digits. The lowest and highest significands of every exponent,
+// where carries and exponent boundaries sit, and a prime stride between.
+void testParseFloatRoundTrip() {
+    unsigned int count = sizeof(roundTripFormats)/sizeof(roundTripFormats[0]);
+    int mismatches = 0;
+    for(uint32_t exponent = 0; exponent < 255; exponent++) {
+        for(uint32_t i = 0; i < EDGE_SIGNIFICANDS; i++) {
+            mismatches += parseMismatches(exponent << 23 | i, count);
+            mismatches += parseMismatches(exponent << 23 | (0x7FFFFF - i), count);
+        }
+    }
+    for(unsigned long long bits = 0; bits < 0x7F800000ull; bits += 8191) {
+        mismatches += parseMismatches((uint32_t)bits, count);
+    }
+    assertIntegersEqual(mismatches, 0);
+}
+
+// Exact decimal expansions of midpoints between neighbouring floats must
+// round to even, and their neighbours either side.
+void testParseFloatMidpoints() {
+    char input[256];
+    int mismatches = 0;
+    for(unsigned long long bits = 0; bits < 0x7F7FFFFFull; bits += 65521) {
+        uint32_t pattern = (uint32_t)bits, next = pattern + 1;
+        float low, high;
+        memcpy(&low, &pattern, sizeof(low));
+        memcpy(&high, &next, sizeof(high));
+        double midpoint = ((double)low + (double)high) / 2;
+        snprintf(input, sizeof(input), "%.120e", midpoint);
+        mismatches += !matchesStrtof(input);
+        // Perturb the last printed digit of the exact expansion.
+        snprintf(input, sizeof(input), "%.120e1", midpoint);
+        char *e = strchr(input, 'e');
+        memmove(e - 1, e, strlen(e) + 1);
+        mismatches += !matchesStrtof(input);
+        snprintf(input, sizeof(input), "%.40e", midpoint);
+        mismatches += !matchesStrtof(input);
+    }
+    assertIntegersEqual(mismatches, 0);
+}
+
+// Random digit strings of varying length and exponent.
+void testParseFloatRandom() {
+    char input[256];
+    int mismatches = 0;
+    unsigned int seed = 12345;
+    for(int i = 0; i < 200000; i++) {
+        int length = 0;
+        seed = seed * 1103515245u + 12345u;
+        int digits = 1 + (seed >> 16) % 40;
+        if(seed & 1) input[length++] = '-';
+        for(int d = 0; d < digits; d++) {
+            seed = seed * 1103515245u + 12345u;
+            input[length++] = '0' + (seed >> 16) % 10;
+            if(d == 0 && (seed & 2)) input[length++] = '.';
+        }
+        seed = seed * 1103515245u + 12345u;
+        snprintf(input + length, sizeof(input) - length, "e%d", (int)((seed >> 16) % 100) - 60);
+        mismatches += !matchesStrtof(input);
+    }
+    assertIntegersEqual(mismatches, 0);
+}
+
+void testFormatFloat() {
+    const float values[] = {
+        0, -0.0f, 1, -2.5f, 0.64f, 96.078431f, 0.1f, 1e-4f, 9.9e-5f, 123456789,
+        1e9f, 1e10f, 3.4028235e38f, 1e-45f, 1.17549435e-38f, 1.0f/0.0f, -1.0f/0.0f
+    };
+    const char *expected[] = {
+        "0", "-0", "1", "-2.5", "0.64", "96.07843", "0.1", "0.0001", "9.9e-5", "123456790",
+        "1e9", "1e10", "3.4028235e38", "1e-45", "1.1754944e-38", "inf", "-inf"
+    };
+    char output[WAVEFRONT_FLOAT_LENGTH + 1];
+    for(unsigned int i = 0; i < sizeof(values)/sizeof(values[0]); i++) {
+        size_t length = formatWavefrontFloat(values[i], output);
+        output[length] = 0;
+        assertStringsEqual(output, expected[i]);
+    }
+}
+
+// Significant digits of formatted output, trailing zeros of an integer left
+// out.
+static int significantDigits(const char *output) {
+    int digits = 0, zeros = 0, leading = 1;
+    for(const char *c = output; *c && *c != 'e'; c++) {
+        if(*c < '0' || *c > '9') continue;
+        if(*c == '0' && leading) continue;
+        leading = 0;
+        zeros = *c == '0' ? zeros + 1 : 0;
+        digits++;
+    }
+    return digits - zeros;
+}
+
+// Every sampled float reads back exactly, in no more digits than the fewest
+// %g needs.
+void testFormatFloatRoundTrip() {
+    char output[WAVEFRONT_FLOAT_LENGTH + 1], shortest[32];
+    int mismatches = 0;
+    for(unsigned long long bits = 0; bits < 0x100000000ull; bits += 4093) {
+        uint32_t pattern = (uint32_t)bits;
+        float value, parsed = 0;
+        memcpy(&value, &pattern, sizeof(value));
+        if(value != value) continue;
+        size_t length = formatWavefrontFloat(value, output);
+        output[length] = 0;
+        int precision = 1;
+        for(; precision < 9; precision++) {
+            snprintf(shortest, sizeof(shortest), "%.*g", precision, value);
+            if(strtof(shortest, NULL) == value) break;
+        }
+        const char *end = parseWavefrontFloat(output, output + length, &parsed);
+        if(end != output + length || !sameFloat(parsed, value) || significantDigits(output) > precision) {
+            printf("%.9g: formatted %s\n", value, output);
+            mismatches++;
+        }
+    }
+    assertIntegersEqual(mismatches, 0);
+}
+
+// Every half converts to a float and back unchanged.
+void testHalfRoundTrip() {
+    int mismatches = 0;
+    for(unsigned int half = 0; half < 0x10000; half++) {
+        float value = wavefrontHalfToFloat((unsigned short)half);
+        unsigned short back = wavefrontFloatToHalf(value);
+        int nan = (half & 0x7C00) == 0x7C00 && (half & 0x3FF);
+        if(nan ? value == value || (back & 0x7C00) != 0x7C00 || !(back & 0x3FF) : back != half) mismatches++;
+    }
+    assertIntegersEqual(mismatches, 0);
+    assertFloatsEqual(wavefrontHalfToFloat(0x3C00), 1);
+    assertFloatsEqual(wavefrontHalfToFloat(0x7BFF), 65504);
+    assertFloatsEqual(wavefrontHalfToFloat(0x0001), 5.9604645e-8f);
+}
+
+static double distance(double a, double b) {
+    return a > b ? a - b : b - a;
+}
+
+// Sampled floats convert to the nearest half, ties to even.
+void testFloatToHalfRounding() {
+    int mismatches = 0;
+    for(unsigned long long bits = 0; bits < 0x7F800000ull; bits += 997) {
+        uint32_t pattern = (uint32_t)bits;
+        float value;
+        memcpy(&value, &pattern, sizeof(value));
+        unsigned short half = wavefrontFloatToHalf(value);
+        if(value >= 65520) {
+            mismatches += half != 0x7C00;
+            continue;
+        }
+        double error = distance(wavefrontHalfToFloat(half), value);
+        // Neither finite neighbour may be nearer, or as near when half is odd.
+        for(int step = -1; step <= 1; step += 2) {
+            unsigned int neighbour = half + step;
+            if(neighbour > 0x7BFF) continue;
+            double other = distance(wavefrontHalfToFloat((unsigned short)neighbour), value);
+            if(other < error || (other == error && (half & 1))) mismatches++;
+        }
+    }
+    assertIntegersEqual(mismatches, 0);
+    assertIntegersEqual(wavefrontFloatToHalf(65519), 0x7BFF);
+    assertIntegersEqual(wavefrontFloatToHalf(65520), 0x7C00);
+    assertIntegersEqual(wavefrontFloatToHalf(-0.0f), 0x8000);
+    assertIntegersEqual(wavefrontFloatToHalf(2.9802322e-8f), 0);
+    assertIntegersEqual(wavefrontFloatToHalf(2.9802326e-8f), 1);
+}
+
+void testParseInteger() {
+    const char input[] = "-42 17";
+    int value = 0;
+    const char *end = parseWavefrontInteger(input, input + sizeof(input) - 1, &value);
+    assertIntegersEqual(value, -42);
+    assertIntegersEqual(end - input, 3);
+    end = parseWavefrontInteger("x", input + 1, &value);
+    assertIntegersEqual(value, -42);
+    const char *large = "99999999999";
+    parseWavefrontInteger(large, large + strlen(large), &value);
+    assertIntegersEqual(value, 2147483647);
+}
+
+#ifdef WAVEFRONT_EXHAUSTIVE_TESTS
+#include "wavefront_thread.h"
+
+#define EXHAUSTIVE_TASKS 4096
+#define EXHAUSTIVE_THREADS 16
+
+// Every finite float of either sign printed with %.9g and %.6g, and
+// through formatWavefrontFloat, reads back as strtof reads it.
+static void sweepFloats(void *context, unsigned int index) {
+    int *mismatches = context;
+    char output[WAVEFRONT_FLOAT_LENGTH + 1];
+    unsigned long long first = (unsigned long long)index * (0x100000000ull / EXHAUSTIVE_TASKS);
+    unsigned long long last = first + 0x100000000ull / EXHAUSTIVE_TASKS;
+    for(unsigned long long bits = first; bits < last; bits++) {
+        uint32_t pattern = (uint32_t)bits;
+        if((pattern & 0x7F800000u) == 0x7F800000u) continue;
+        mismatches[index] += parseMismatches(pattern, 2);
+        float value;
+        memcpy(&value, &pattern, sizeof(value));
+        output[formatWavefrontFloat(value, output)] = 0;
+        mismatches[index] += !matchesStrtof(output);
+    }
+}
+
+// Takes about two CPU hours, so only built by make test-exhaustive.
+void testFloatExhaustive() {
+    int *mismatches = calloc(EXHAUSTIVE_TASKS, sizeof(int));
+    wavefrontRunParallel(sweepFloats, mismatches, EXHAUSTIVE_TASKS, EXHAUSTIVE_THREADS, NULL);
+    int total = 0;
+    for(unsigned int i = 0; i < EXHAUSTIVE_TASKS; i++) total += mismatches[i];
+    assertIntegersEqual(total, 0);
+    free(mismatches);
+}
+#endif
+
+void wavefrontNumberTest() {
+    testParseFloatSimple();
+    testParseFloatInvalid();
+    testParseFloatBounded();
+    testParseFloatRoundTrip();
+    testParseFloatMidpoints();
+    testParseFloatRandom();
+    testParseInteger();
+    testFormatFloat();
+    testFormatFloatRoundTrip();
+    testHalfRoundTrip();
+    testFloatToHalfRounding();
+#ifdef WAVEFRONT_EXHAUSTIVE_TESTS
+    testFloatExhaustive();
+#endif
+}
@@ -0,0 +1,90 @@
+#include "wavefront_scan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WAVEFRONT_SCAN_X86
+#include <immintrin.h>
+#endif
+
+// Each kernel scans from offset begin, appending to ends from count onwards.
+static size_t findLineEndsScalar(
+    const char *input, size_t begin, size_t length,
+    unsigned int *ends, size_t count, size_t capacity
+) {
+    for(size_t i = begin; i < length && count < capacity; i++) {
+        if(input[i] == '\n' || input[i] == '\r') ends[count++] = (unsigned int)i;
+    }
+    return count;
+}
+
+#ifdef WAVEFRONT_SCAN_X86
+// Append the offset of each set bit of mask, lowest first.
+#define STORE_MASK(mask, offset) do { \
+    while(mask) { \
+        if(count == capacity) return count; \
+        ends[count++] = (unsigned int)((offset) + __builtin_ctz(mask)); \
+        mask &= mask - 1; \
+    } \
+} while(0)
+
+__attribute__((target("sse2")))
+static size_t findLineEndsSSE2(
+    const char *input, size_t begin, size_t length,
+    unsigned int *ends, size_t count, size_t capacity
+) {
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    size_t i = begin;
+    for(; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(input + i));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, lf), _mm_cmpeq_epi8(bytes, cr)));
+        STORE_MASK(mask, i);
+    }
+    return findLineEndsScalar(input, i, length, ends, count, capacity);
+}
+
+__attribute__((target("avx2")))
+static size_t findLineEndsAVX2(
+    const char *input, size_t begin, size_t length,
+    unsigned int *ends, size_t count, size_t capacity
+) {
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    size_t i = begin;
+    for(; i + 32 <= length; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(input + i));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, lf), _mm256_cmpeq_epi8(bytes, cr)));
+        STORE_MASK(mask, i);
+    }
+    return findLineEndsSSE2(input, i, length, ends, count, capacity);
+}
+#endif
+
+int wavefrontScanKernel() {
+#ifdef WAVEFRONT_SCAN_X86
+    if(__builtin_cpu_supports("avx2")) return WAVEFRONT_SCAN_AVX2;
+    if(__builtin_cpu_supports("sse2")) return WAVEFRONT_SCAN_SSE2;
+#endif
+    return WAVEFRONT_SCAN_SCALAR;
+}
+
+size_t wavefrontFindLineEnds(
+    int kernel,
+    const char *input,
+    size_t length,
+    unsigned int *ends,
+    size_t capacity
+) {
+    int supported = wavefrontScanKernel();
+    switch(kernel < supported ? kernel : supported) {
+#ifdef WAVEFRONT_SCAN_X86
+    case WAVEFRONT_SCAN_AVX2:
+        return findLineEndsAVX2(input, 0, length, ends, 0, capacity);
+    case WAVEFRONT_SCAN_SSE2:
+        return findLineEndsSSE2(input, 0, length, ends, 0, capacity);
+#endif
+    default:
+        return findLineEndsScalar(input, 0, length, ends, 0, capacity);
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef __WAVEFRONT_SCAN_H
+#define __WAVEFRONT_SCAN_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stddef.h>
+
+// Implementations of wavefrontFindLineEnds. A kernel the CPU lacks the
+// instructions for is replaced by the fastest one it supports.
+#define WAVEFRONT_SCAN_SCALAR 0
+#define WAVEFRONT_SCAN_SSE2 1
+#define WAVEFRONT_SCAN_AVX2 2
+
+// The fastest kernel the running CPU supports.
+int wavefrontScanKernel();
+// Store the offsets of the first capacity line ends, '\n' or '\r', within
+// length bytes of input and return how many were stored. Fewer than capacity
+// means the rest of the input holds none. Length must fit an unsigned int.
+size_t wavefrontFindLineEnds(
+    int kernel,
+    const char *input,
+    size_t length,
+    unsigned int *ends,
+    size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "wavefront_scan.h"
+
+#define BENCH_SECONDS 0.5
+#define BENCH_BATCH 256
+
+// Lines shaped like those of a typical exporter, averaging some 20 bytes.
+static char *generateLines(size_t size) {
+    static const char *lines[] = {
+        "newmtl material\n", "Ns 96.078431\n", "Ka 1.000000 1.000000 1.000000\n",
+        "Kd 0.640000 0.640000 0.640000\n", "illum 2\n", "map_Kd diffuse.png\n", "\n"
+    };
+    char *output = malloc(size);
+    if(!output) return NULL;
+    size_t length = 0;
+    for(unsigned int i = 0; length < size; i++) {
+        for(const char *c = lines[i % 7]; *c && length < size; c++) output[length++] = *c;
+    }
+    return output;
+}
+
+static void benchKernel(const char *label, int kernel, const char *input, size_t length) {
+    unsigned int ends[BENCH_BATCH];
+    volatile size_t sink = 0;
+    double bytes = 0;
+    clock_t start = clock(), elapsed = 0;
+    do {
+        // Resume after the last line end of each full batch, as the parser does.
+        size_t offset = 0;
+        while(offset < length) {
+            size_t count = wavefrontFindLineEnds(kernel, input + offset, length - offset, ends, BENCH_BATCH);
+            sink += count;
+            offset = count == BENCH_BATCH ? offset + ends[BENCH_BATCH - 1] + 1 : length;
+        }
+        bytes += length;
+        elapsed = clock() - start;
+    } while(elapsed < BENCH_SECONDS * CLOCKS_PER_SEC);
+    double seconds = (double)elapsed / CLOCKS_PER_SEC;
+    printf("%-44s %12.1f MB/sec\n", label, seconds > 0 ? bytes / seconds / 1e6 : 0);
+}
+
+// Line splitting throughput of each kernel the CPU supports.
+void wavefrontScanBench() {
+    size_t length = 1 << 20;
+    char *input = generateLines(length);
+    if(!input) return;
+    int supported = wavefrontScanKernel();
+    benchKernel("wavefrontFindLineEnds scalar", WAVEFRONT_SCAN_SCALAR, input, length);
+    if(supported >= WAVEFRONT_SCAN_SSE2) {
+        benchKernel("wavefrontFindLineEnds sse2", WAVEFRONT_SCAN_SSE2, input, length);
+    }
+    if(supported >= WAVEFRONT_SCAN_AVX2) {
+        benchKernel("wavefrontFindLineEnds avx2", WAVEFRONT_SCAN_AVX2, input, length);
+    }
+    free(input);
+}
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <string.h>
+#include "wavefront_scan.h"
+#include "cutil/src/assertion.h"
+
+static const int kernels[] = {
+    WAVEFRONT_SCAN_SCALAR, WAVEFRONT_SCAN_SSE2, WAVEFRONT_SCAN_AVX2
+};
+
+// Bytes line ends are easily confused with, bytes with the high bit set
+// included.
+static const char alphabet[] = {'\n', '\r', ' ', '\t', 'a', '\0', (char)0x8a, (char)0x8d};
+
+// Compare a kernel with a byte at a time search, returning 1 if they agree.
+static int matchesReference(int kernel, const char *input, size_t length, size_t capacity) {
+    unsigned int expected[512], actual[512];
+    size_t expectedCount = 0;
+    for(size_t i = 0; i < length && expectedCount < capacity; i++) {
+        if(input[i] == '\n' || input[i] == '\r') expected[expectedCount++] = (unsigned int)i;
+    }
+    size_t count = wavefrontFindLineEnds(kernel, input, length, actual, capacity);
+    if(count != expectedCount || memcmp(actual, expected, count * sizeof(unsigned int)) != 0) {
+        printf("kernel %d: %lu of %lu line ends match in %lu bytes\n", kernel,
+            (unsigned long)count, (unsigned long)expectedCount, (unsigned long)length);
+        return 0;
+    }
+    return 1;
+}
+
+void testScanKernel() {
+    int kernel = wavefrontScanKernel();
+    assertIntegersEqual(kernel >= WAVEFRONT_SCAN_SCALAR && kernel <= WAVEFRONT_SCAN_AVX2, 1);
+    unsigned int ends[4];
+    const char input[] = "Kd 1 1 1\r\nKs 0 0 0\n";
+    for(unsigned int i = 0; i < sizeof(kernels)/sizeof(kernels[0]); i++) {
+        assertIntegersEqual(wavefrontFindLineEnds(kernels[i], input, sizeof(input) - 1, ends, 4), 3);
+        assertIntegersEqual(ends[0], 8);
+        assertIntegersEqual(ends[1], 9);
+        assertIntegersEqual(ends[2], 18);
+        assertIntegersEqual(wavefrontFindLineEnds(kernels[i], input, 8, ends, 4), 0);
+        assertIntegersEqual(wavefrontFindLineEnds(kernels[i], input, sizeof(input) - 1, ends, 0), 0);
+    }
+}
+
+// Random inputs at every alignment, with lengths and capacities landing on
+// either side of the vector widths.
+void testScanEquivalence() {
+    char buffer[600];
+    unsigned int seed = 11;
+    int matched = 0, total = 0;
+    for(unsigned int round = 0; round < 4000; round++) {
+        seed = seed * 1103515245u + 12345u;
+        // Sparse line ends in some rounds, dense in others.
+        unsigned int spread = round % 3 ? sizeof(alphabet) : 64;
+        for(unsigned int i = 0; i < sizeof(buffer); i++) {
+            seed = seed * 1103515245u + 12345u;
+            unsigned int pick = (seed >> 16) % spread;
+            buffer[i] = pick < sizeof(alphabet) ? alphabet[pick] : 'x';
+        }
+        size_t offset = round % 32;
+        size_t length = (seed >> 8) % (sizeof(buffer) - offset - 32 + 1);
+        size_t capacity = round % 5 ? 512 : 1 + (seed >> 4) % 40;
+        for(unsigned int i = 0; i < sizeof(kernels)/sizeof(kernels[0]); i++) {
+            matched += matchesReference(kernels[i], buffer + offset, length, capacity);
+            total++;
+        }
+    }
+    assertIntegersEqual(matched, total);
+}
+
+void wavefrontScanTest() {
+    testScanKernel();
+    testScanEquivalence();
+}
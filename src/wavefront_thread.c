@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include "wavefront_allocator.h"
+#include "wavefront_thread.h"
+
+struct WorkQueue {
+    void (*task)(void *context, unsigned int index);
+    void *context;
+    unsigned int count;
+    unsigned int next; // Next index to run, guarded by lock.
+    pthread_mutex_t lock;
+};
+
+static void *worker(void *argument) {
+    struct WorkQueue *queue = argument;
+    for(;;) {
+        pthread_mutex_lock(&queue->lock);
+        unsigned int index = queue->next++;
+        pthread_mutex_unlock(&queue->lock);
+        if(index >= queue->count) break;
+        queue->task(queue->context, index);
+    }
+    return NULL;
+}
+
+void wavefrontRunParallel(
+    void (*task)(void *context, unsigned int index),
+    void *context,
+    unsigned int count,
+    unsigned int threadCount,
+    const struct WavefrontAllocator *allocator
+) {
+    struct WorkQueue queue;
+    queue.task = task;
+    queue.context = context;
+    queue.count = count;
+    queue.next = 0;
+    if(threadCount > count) threadCount = count;
+    if(threadCount < 2 || pthread_mutex_init(&queue.lock, NULL)) {
+        for(unsigned int i = 0; i < count; i++) task(context, i);
+        return;
+    }
+
+    // Threads that fail to start leave more work for the rest.
+    pthread_t *threads = wavefrontAllocateWith(allocator, (threadCount - 1) * sizeof(pthread_t));
+    unsigned int started = 0;
+    while(threads && started + 1 < threadCount &&
+        !pthread_create(threads + started, NULL, worker, &queue)) {
+        started++;
+    }
+    worker(&queue);
+    for(unsigned int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    wavefrontFreeWith(allocator, threads);
+    pthread_mutex_destroy(&queue.lock);
+}
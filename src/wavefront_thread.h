@@ -0,0 +1,22 @@
+#ifndef __WAVEFRONT_THREAD_H
+#define __WAVEFRONT_THREAD_H
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+struct WavefrontAllocator;
+
+// Call task(context, i) for every i below count on up to threadCount threads,
+// the calling thread included. Threads take the next index as they finish, so
+// uneven tasks balance themselves. Bookkeeping is allocated with allocator.
+void wavefrontRunParallel(
+    void (*task)(void *context, unsigned int index),
+    void *context,
+    unsigned int count,
+    unsigned int threadCount,
+    const struct WavefrontAllocator *allocator);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,304 @@
+	.file	"wavefront_allocator.c"
+	.text
+	.p2align 4
+	.type	defaultRelease, @function
+defaultRelease:
+.LFB13:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	jmp	free@PLT
+	.cfi_endproc
+.LFE13:
+	.size	defaultRelease, .-defaultRelease
+	.p2align 4
+	.type	defaultReallocate, @function
+defaultReallocate:
+.LFB12:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	movq	%rdx, %rsi
+	jmp	realloc@PLT
+	.cfi_endproc
+.LFE12:
+	.size	defaultReallocate, .-defaultReallocate
+	.p2align 4
+	.type	defaultAllocate, @function
+defaultAllocate:
+.LFB11:
+	.cfi_startproc
+	movq	%rsi, %rdi
+	jmp	malloc@PLT
+	.cfi_endproc
+.LFE11:
+	.size	defaultAllocate, .-defaultAllocate
+	.p2align 4
+	.globl	wavefrontSetAllocator
+	.type	wavefrontSetAllocator, @function
+wavefrontSetAllocator:
+.LFB14:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	je	.L6
+	movdqu	(%rdi), %xmm1
+	movaps	%xmm1, allocator(%rip)
+	movdqu	16(%rdi), %xmm2
+	movaps	%xmm2, 16+allocator(%rip)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	leaq	defaultReallocate(%rip), %rax
+	leaq	defaultAllocate(%rip), %rdx
+	movq	$0, 24+allocator(%rip)
+	movq	%rax, %xmm3
+	movq	%rdx, %xmm0
+	leaq	defaultRelease(%rip), %rax
+	punpcklqdq	%xmm3, %xmm0
+	movq	%rax, 16+allocator(%rip)
+	movaps	%xmm0, allocator(%rip)
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	wavefrontSetAllocator, .-wavefrontSetAllocator
+	.p2align 4
+	.globl	wavefrontAllocateWith
+	.type	wavefrontAllocateWith, @function
+wavefrontAllocateWith:
+.LFB15:
+	.cfi_startproc
+	leaq	allocator(%rip), %rax
+	testq	%rdi, %rdi
+	cmove	%rax, %rdi
+	movq	24(%rdi), %rdx
+	movq	(%rdi), %rax
+	movq	%rdx, %rdi
+	jmp	*%rax
+	.cfi_endproc
+.LFE15:
+	.size	wavefrontAllocateWith, .-wavefrontAllocateWith
+	.p2align 4
+	.globl	wavefrontAllocateZeroedWith
+	.type	wavefrontAllocateZeroedWith, @function
+wavefrontAllocateZeroedWith:
+.LFB16:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %r8
+	movq	%rdx, %rcx
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	testq	%rdx, %rdx
+	je	.L11
+	movq	%rdx, %rax
+	mulq	%rsi
+	jo	.L16
+.L11:
+	movq	%rcx, %rbx
+	leaq	allocator(%rip), %rax
+	imulq	%rsi, %rbx
+	testq	%r8, %r8
+	cmove	%rax, %r8
+	movq	%rbx, %rsi
+	movq	24(%r8), %rdi
+	call	*(%r8)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L16
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	memset@PLT
+.L10:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+	xorl	%ebp, %ebp
+	jmp	.L10
+	.cfi_endproc
+.LFE16:
+	.size	wavefrontAllocateZeroedWith, .-wavefrontAllocateZeroedWith
+	.p2align 4
+	.globl	wavefrontReallocateWith
+	.type	wavefrontReallocateWith, @function
+wavefrontReallocateWith:
+.LFB17:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	leaq	allocator(%rip), %rax
+	cmove	%rax, %rdi
+	movq	24(%rdi), %rcx
+	testq	%rsi, %rsi
+	je	.L29
+	movq	8(%rdi), %rax
+	movq	%rcx, %rdi
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	movq	(%rdi), %rax
+	movq	%rdx, %rsi
+	movq	%rcx, %rdi
+	jmp	*%rax
+	.cfi_endproc
+.LFE17:
+	.size	wavefrontReallocateWith, .-wavefrontReallocateWith
+	.p2align 4
+	.globl	wavefrontFreeWith
+	.type	wavefrontFreeWith, @function
+wavefrontFreeWith:
+.LFB18:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	leaq	allocator(%rip), %rax
+	cmove	%rax, %rdi
+	testq	%rsi, %rsi
+	je	.L30
+	movq	24(%rdi), %rdx
+	movq	16(%rdi), %rax
+	movq	%rdx, %rdi
+	jmp	*%rax
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	wavefrontFreeWith, .-wavefrontFreeWith
+	.p2align 4
+	.globl	wavefrontAllocate
+	.type	wavefrontAllocate, @function
+wavefrontAllocate:
+.LFB19:
+	.cfi_startproc
+	movq	%rdi, %rsi
+	movq	24+allocator(%rip), %rdi
+	jmp	*allocator(%rip)
+	.cfi_endproc
+.LFE19:
+	.size	wavefrontAllocate, .-wavefrontAllocate
+	.p2align 4
+	.globl	wavefrontAllocateZeroed
+	.type	wavefrontAllocateZeroed, @function
+wavefrontAllocateZeroed:
+.LFB20:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	testq	%rsi, %rsi
+	je	.L35
+	movq	%rdi, %rax
+	mulq	%rsi
+	jo	.L39
+.L35:
+	movq	%rdi, %rbx
+	movq	24+allocator(%rip), %rdi
+	imulq	%rsi, %rbx
+	movq	%rbx, %rsi
+	call	*allocator(%rip)
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L39
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	memset@PLT
+.L34:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.cfi_restore_state
+	xorl	%ebp, %ebp
+	jmp	.L34
+	.cfi_endproc
+.LFE20:
+	.size	wavefrontAllocateZeroed, .-wavefrontAllocateZeroed
+	.p2align 4
+	.globl	wavefrontReallocate
+	.type	wavefrontReallocate, @function
+wavefrontReallocate:
+.LFB21:
+	.cfi_startproc
+	movq	24+allocator(%rip), %rax
+	testq	%rdi, %rdi
+	je	.L50
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movq	%rax, %rdi
+	jmp	*8+allocator(%rip)
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	movq	%rax, %rdi
+	jmp	*allocator(%rip)
+	.cfi_endproc
+.LFE21:
+	.size	wavefrontReallocate, .-wavefrontReallocate
+	.p2align 4
+	.globl	wavefrontFree
+	.type	wavefrontFree, @function
+wavefrontFree:
+.LFB22:
+	.cfi_startproc
+	movq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L51
+	movq	24+allocator(%rip), %rdi
+	jmp	*16+allocator(%rip)
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	wavefrontFree, .-wavefrontFree
+	.p2align 4
+	.globl	wavefrontTrackAllocations
+	.type	wavefrontTrackAllocations, @function
+wavefrontTrackAllocations:
+.LFB23:
+	.cfi_startproc
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	wavefrontTrackAllocations, .-wavefrontTrackAllocations
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	allocator, @object
+	.size	allocator, 32
+allocator:
+	.quad	defaultAllocate
+	.quad	defaultReallocate
+	.quad	defaultRelease
+	.quad	0
+	.section	.note.GNU-stack,"",@progbits
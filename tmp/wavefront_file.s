@@ -0,0 +1,129 @@
+	.file	"wavefront_file.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	""
+	.text
+	.p2align 4
+	.globl	wavefrontFileMap
+	.type	wavefrontFileMap, @function
+wavefrontFileMap:
+.LFB0:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	xorl	%eax, %eax
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	xorl	%esi, %esi
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 192
+	movq	$0, (%rbx)
+	movq	$0, 8(%rbx)
+	movq	$0, 16(%rbx)
+	call	open@PLT
+	testl	%eax, %eax
+	js	.L3
+	movq	%rsp, %rsi
+	movl	%eax, %edi
+	movl	%eax, %ebp
+	call	fstat@PLT
+	movl	%eax, %r12d
+	testl	%eax, %eax
+	jne	.L4
+	movl	24(%rsp), %eax
+	andl	$61440, %eax
+	cmpl	$32768, %eax
+	jne	.L4
+	movq	48(%rsp), %rsi
+	testq	%rsi, %rsi
+	je	.L15
+	xorl	%edi, %edi
+	xorl	%r9d, %r9d
+	movl	%ebp, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	call	mmap@PLT
+	movl	%ebp, %edi
+	movq	%rax, %r13
+	call	close@PLT
+	cmpq	$-1, %r13
+	je	.L3
+	movq	48(%rsp), %rsi
+	movl	$2, %edx
+	movq	%r13, %rdi
+	call	madvise@PLT
+	movq	48(%rsp), %rax
+	movq	%r13, (%rbx)
+	movq	%r13, 16(%rbx)
+	movq	%rax, 8(%rbx)
+.L1:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	%r12d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.cfi_restore_state
+	movl	%ebp, %edi
+	call	close@PLT
+.L3:
+	movl	$2, %r12d
+	jmp	.L1
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	movl	%ebp, %edi
+	call	close@PLT
+	leaq	.LC0(%rip), %rax
+	movq	%rax, (%rbx)
+	jmp	.L1
+	.cfi_endproc
+.LFE0:
+	.size	wavefrontFileMap, .-wavefrontFileMap
+	.p2align 4
+	.globl	wavefrontFileUnmap
+	.type	wavefrontFileUnmap, @function
+wavefrontFileUnmap:
+.LFB1:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	16(%rdi), %rdi
+	testq	%rdi, %rdi
+	je	.L17
+	movq	8(%rbx), %rsi
+	call	munmap@PLT
+.L17:
+	movq	$0, (%rbx)
+	movq	$0, 8(%rbx)
+	movq	$0, 16(%rbx)
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	wavefrontFileUnmap, .-wavefrontFileUnmap
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3788 @@
+# 0 "src/wavefront_material.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/wavefront_material.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 2 "src/wavefront_material.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 3 "src/wavefront_material.c" 2
+# 1 "../cutil/src/error.h" 1
+# 4 "src/wavefront_material.c" 2
+# 1 "../cutil/src/string.h" 1
+
+
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 4 "../cutil/src/string.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 5 "../cutil/src/string.h" 2
+
+
+
+# 7 "../cutil/src/string.h"
+char *strCopy(const char *s);
+char *strCopyN(const char *s, size_t n);
+const char *strStartsWith(const char *s, const char *prefix);
+const char *strAfterWhitespace(const char *s);
+int tokenize(const char **thisToken, const char **nextDelim, const char **nextToken, const char *delims);
+# 5 "src/wavefront_material.c" 2
+# 1 "src/wavefront_allocator.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_allocator.h" 2
+
+
+
+
+struct WavefrontAllocator {
+    void *(*allocate)(void *context, size_t size);
+    void *(*reallocate)(void *context, void *pointer, size_t size);
+    void (*release)(void *context, void *pointer);
+    void *context;
+};
+
+struct WavefrontAllocationStats {
+    unsigned long long allocations;
+    unsigned long long bytes;
+};
+
+
+
+
+void wavefrontSetAllocator(const struct WavefrontAllocator *allocator);
+void *wavefrontAllocate(size_t size);
+
+void *wavefrontAllocateZeroed(size_t count, size_t size);
+void *wavefrontReallocate(void *pointer, size_t size);
+void wavefrontFree(void *pointer);
+
+
+void *wavefrontAllocateWith(const struct WavefrontAllocator *allocator, size_t size);
+void *wavefrontAllocateZeroedWith(const struct WavefrontAllocator *allocator, size_t count, size_t size);
+void *wavefrontReallocateWith(const struct WavefrontAllocator *allocator, void *pointer, size_t size);
+void wavefrontFreeWith(const struct WavefrontAllocator *allocator, void *pointer);
+
+
+
+struct WavefrontAllocationStats *wavefrontTrackAllocations(struct WavefrontAllocationStats *stats);
+# 6 "src/wavefront_material.c" 2
+# 1 "src/wavefront_material.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_material.h" 2
+
+
+struct WavefrontColor {
+    float r, g, b, a;
+};
+# 23 "src/wavefront_material.h"
+struct WavefrontMapOptions {
+    float offset[3];
+    float scale[3];
+    float turbulence[3];
+    float bumpMultiplier;
+    float boost;
+    float base, gain;
+    int resolution;
+    int channel;
+    unsigned int flags;
+};
+
+struct WavefrontMap {
+    char *file;
+
+    unsigned int texture;
+
+    unsigned int options;
+};
+
+struct WavefrontMaterial {
+    char *name;
+    struct WavefrontColor ambient;
+    struct WavefrontColor diffuse;
+    struct WavefrontColor specular;
+    struct WavefrontColor transmission;
+    struct WavefrontColor emission;
+    float specularExponent;
+    float dissolve;
+    float opticalDensity;
+
+    float roughness;
+    float metallic;
+    float sheen;
+    float clearcoatThickness;
+    float clearcoatRoughness;
+    float anisotropy;
+    float anisotropyRotation;
+    int illuminationModel;
+    struct WavefrontMap ambientMap;
+    struct WavefrontMap diffuseMap;
+    struct WavefrontMap normalMap;
+    struct WavefrontMap specularColorMap;
+    struct WavefrontMap specularHighlightMap;
+    struct WavefrontMap alphaMap;
+    struct WavefrontMap bumpMap;
+    struct WavefrontMap displacementMap;
+    struct WavefrontMap decalMap;
+    struct WavefrontMap reflectionMapSphere;
+    struct WavefrontMap reflectionMapCubeTop;
+    struct WavefrontMap reflectionMapCubeBottom;
+    struct WavefrontMap reflectionMapCubeFront;
+    struct WavefrontMap reflectionMapCubeBack;
+    struct WavefrontMap reflectionMapCubeLeft;
+    struct WavefrontMap reflectionMapCubeRight;
+    struct WavefrontMap roughnessMap;
+    struct WavefrontMap metallicMap;
+    struct WavefrontMap sheenMap;
+    struct WavefrontMap emissionMap;
+};
+
+
+
+
+
+
+
+struct WavefrontArenaChunk;
+
+struct WavefrontMTL {
+    struct WavefrontMaterial *materials;
+    unsigned int materialCount;
+    unsigned int materialCapacity;
+
+    unsigned int *materialTable;
+    unsigned int materialTableSize;
+
+    char **textures;
+    unsigned int textureCount;
+    unsigned int textureCapacity;
+    unsigned int *textureTable;
+    unsigned int textureTableSize;
+
+    struct WavefrontMapOptions *mapOptions;
+    unsigned int mapOptionCount;
+    unsigned int mapOptionCapacity;
+    unsigned int *mapOptionTable;
+    unsigned int mapOptionTableSize;
+    unsigned int flags;
+    struct WavefrontArenaChunk *arena;
+
+
+    const struct WavefrontAllocator *allocator;
+};
+
+
+struct WavefrontMTLChanges {
+    unsigned int *added;
+    unsigned int addedCount;
+    unsigned int *removed;
+    unsigned int removedCount;
+    unsigned int *changed;
+    unsigned int changedCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+
+
+
+struct WavefrontMTLRemap {
+    int *indices;
+    unsigned int *offsets;
+    unsigned int sourceCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+void wavefrontMTLCompose(struct WavefrontMTL *mtl);
+void wavefrontMTLRelease(struct WavefrontMTL *mtl);
+
+
+
+int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name);
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length);
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string);
+
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count);
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl);
+
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name);
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length);
+
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture);
+
+
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index);
+
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map);
+
+
+
+
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other);
+
+
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b);
+
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m);
+
+
+
+
+
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes);
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes);
+
+
+
+
+
+
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap);
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap);
+
+unsigned int wavefrontMTLHashName(const char *name, size_t length);
+
+
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options);
+
+
+int wavefrontMaterialCompose(struct WavefrontMaterial *m);
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index);
+# 7 "src/wavefront_material.c" 2
+
+
+
+
+
+
+
+static const size_t mapOffsets[20] = {
+    
+# 15 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 15 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 15 "src/wavefront_material.c" 3 4
+   , 
+# 15 "src/wavefront_material.c"
+   ambientMap
+# 15 "src/wavefront_material.c" 3 4
+   )
+# 15 "src/wavefront_material.c"
+                                                 ,
+    
+# 16 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 16 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 16 "src/wavefront_material.c" 3 4
+   , 
+# 16 "src/wavefront_material.c"
+   diffuseMap
+# 16 "src/wavefront_material.c" 3 4
+   )
+# 16 "src/wavefront_material.c"
+                                                 ,
+    
+# 17 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 17 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 17 "src/wavefront_material.c" 3 4
+   , 
+# 17 "src/wavefront_material.c"
+   normalMap
+# 17 "src/wavefront_material.c" 3 4
+   )
+# 17 "src/wavefront_material.c"
+                                                ,
+    
+# 18 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 18 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 18 "src/wavefront_material.c" 3 4
+   , 
+# 18 "src/wavefront_material.c"
+   specularColorMap
+# 18 "src/wavefront_material.c" 3 4
+   )
+# 18 "src/wavefront_material.c"
+                                                       ,
+    
+# 19 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 19 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 19 "src/wavefront_material.c" 3 4
+   , 
+# 19 "src/wavefront_material.c"
+   specularHighlightMap
+# 19 "src/wavefront_material.c" 3 4
+   )
+# 19 "src/wavefront_material.c"
+                                                           ,
+    
+# 20 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 20 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 20 "src/wavefront_material.c" 3 4
+   , 
+# 20 "src/wavefront_material.c"
+   alphaMap
+# 20 "src/wavefront_material.c" 3 4
+   )
+# 20 "src/wavefront_material.c"
+                                               ,
+    
+# 21 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 21 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 21 "src/wavefront_material.c" 3 4
+   , 
+# 21 "src/wavefront_material.c"
+   bumpMap
+# 21 "src/wavefront_material.c" 3 4
+   )
+# 21 "src/wavefront_material.c"
+                                              ,
+    
+# 22 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 22 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 22 "src/wavefront_material.c" 3 4
+   , 
+# 22 "src/wavefront_material.c"
+   displacementMap
+# 22 "src/wavefront_material.c" 3 4
+   )
+# 22 "src/wavefront_material.c"
+                                                      ,
+    
+# 23 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 23 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 23 "src/wavefront_material.c" 3 4
+   , 
+# 23 "src/wavefront_material.c"
+   decalMap
+# 23 "src/wavefront_material.c" 3 4
+   )
+# 23 "src/wavefront_material.c"
+                                               ,
+    
+# 24 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 24 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 24 "src/wavefront_material.c" 3 4
+   , 
+# 24 "src/wavefront_material.c"
+   reflectionMapSphere
+# 24 "src/wavefront_material.c" 3 4
+   )
+# 24 "src/wavefront_material.c"
+                                                          ,
+    
+# 25 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 25 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 25 "src/wavefront_material.c" 3 4
+   , 
+# 25 "src/wavefront_material.c"
+   reflectionMapCubeTop
+# 25 "src/wavefront_material.c" 3 4
+   )
+# 25 "src/wavefront_material.c"
+                                                           ,
+    
+# 26 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 26 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 26 "src/wavefront_material.c" 3 4
+   , 
+# 26 "src/wavefront_material.c"
+   reflectionMapCubeBottom
+# 26 "src/wavefront_material.c" 3 4
+   )
+# 26 "src/wavefront_material.c"
+                                                              ,
+    
+# 27 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 27 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 27 "src/wavefront_material.c" 3 4
+   , 
+# 27 "src/wavefront_material.c"
+   reflectionMapCubeFront
+# 27 "src/wavefront_material.c" 3 4
+   )
+# 27 "src/wavefront_material.c"
+                                                             ,
+    
+# 28 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 28 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 28 "src/wavefront_material.c" 3 4
+   , 
+# 28 "src/wavefront_material.c"
+   reflectionMapCubeBack
+# 28 "src/wavefront_material.c" 3 4
+   )
+# 28 "src/wavefront_material.c"
+                                                            ,
+    
+# 29 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 29 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 29 "src/wavefront_material.c" 3 4
+   , 
+# 29 "src/wavefront_material.c"
+   reflectionMapCubeLeft
+# 29 "src/wavefront_material.c" 3 4
+   )
+# 29 "src/wavefront_material.c"
+                                                            ,
+    
+# 30 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 30 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 30 "src/wavefront_material.c" 3 4
+   , 
+# 30 "src/wavefront_material.c"
+   reflectionMapCubeRight
+# 30 "src/wavefront_material.c" 3 4
+   )
+# 30 "src/wavefront_material.c"
+                                                             ,
+    
+# 31 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 31 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 31 "src/wavefront_material.c" 3 4
+   , 
+# 31 "src/wavefront_material.c"
+   roughnessMap
+# 31 "src/wavefront_material.c" 3 4
+   )
+# 31 "src/wavefront_material.c"
+                                                   ,
+    
+# 32 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 32 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 32 "src/wavefront_material.c" 3 4
+   , 
+# 32 "src/wavefront_material.c"
+   metallicMap
+# 32 "src/wavefront_material.c" 3 4
+   )
+# 32 "src/wavefront_material.c"
+                                                  ,
+    
+# 33 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 33 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 33 "src/wavefront_material.c" 3 4
+   , 
+# 33 "src/wavefront_material.c"
+   sheenMap
+# 33 "src/wavefront_material.c" 3 4
+   )
+# 33 "src/wavefront_material.c"
+                                               ,
+    
+# 34 "src/wavefront_material.c" 3 4
+   __builtin_offsetof (
+# 34 "src/wavefront_material.c"
+   struct WavefrontMaterial
+# 34 "src/wavefront_material.c" 3 4
+   , 
+# 34 "src/wavefront_material.c"
+   emissionMap
+# 34 "src/wavefront_material.c" 3 4
+   )
+
+# 35 "src/wavefront_material.c"
+};
+
+struct WavefrontArenaChunk {
+    struct WavefrontArenaChunk *next;
+    size_t size;
+    size_t used;
+    char data[];
+};
+
+
+static const struct WavefrontMapOptions defaultMapOptions = {
+    .scale = {1, 1, 1},
+    .bumpMultiplier = 1,
+    .gain = 1,
+    .flags = 0x1 | 0x2
+};
+
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options) {
+    *options = defaultMapOptions;
+}
+
+int wavefrontMaterialCompose(struct WavefrontMaterial *m) {
+
+    memset(m, 0, sizeof(struct WavefrontMaterial));
+
+    return 0;
+}
+
+
+static unsigned int hashBytes(unsigned int hash, const void *data, size_t length) {
+    const unsigned char *bytes = data;
+    for(size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+unsigned int wavefrontMTLHashName(const char *name, size_t length) {
+    return hashBytes(2166136261u, name, length);
+}
+
+
+static const char *tableString(const void *strings, size_t stride, unsigned int index) {
+    return *(char *const *)((const char*)strings + index * stride);
+}
+
+static void tableInsert(unsigned int *slots, unsigned int size, const char *string, size_t length, unsigned int index) {
+    unsigned int mask = size - 1;
+    unsigned int slot = wavefrontMTLHashName(string, length) & mask;
+    while(slots[slot]) slot = (slot + 1) & mask;
+    slots[slot] = index + 1;
+}
+
+
+
+static void tableFill(
+    unsigned int *slots, unsigned int size,
+    const void *strings, size_t stride, unsigned int stringCount
+) {
+    memset(slots, 0, size * sizeof(unsigned int));
+    for(unsigned int i = 0; i < stringCount; i++) {
+        const char *string = tableString(strings, stride, i);
+        if(string) tableInsert(slots, size, string, strlen(string), i);
+    }
+}
+
+
+static int tableBuild(
+    const struct WavefrontAllocator *allocator,
+    unsigned int **slots, unsigned int *size,
+    const void *strings, size_t stride, unsigned int stringCount,
+    unsigned int newSize
+) {
+    unsigned int *table = wavefrontAllocateWith(allocator, newSize * sizeof(unsigned int));
+    if(!table) return 1;
+    tableFill(table, newSize, strings, stride, stringCount);
+    wavefrontFreeWith(allocator, *slots);
+    *slots = table;
+    *size = newSize;
+    return 0;
+}
+
+
+static int tableResize(
+    const struct WavefrontAllocator *allocator,
+    unsigned int **slots, unsigned int *size,
+    const void *strings, size_t stride, unsigned int stringCount,
+    unsigned int count
+) {
+    unsigned int newSize = *size ? *size : 16;
+    while(newSize < count * 2) newSize *= 2;
+    if(newSize == *size) return 0;
+    return tableBuild(allocator, slots, size, strings, stride, stringCount, newSize);
+}
+
+
+static unsigned int tableProbe(
+    const unsigned int *slots, unsigned int size,
+    const void *strings, size_t stride,
+    const char *string, size_t length
+) {
+    unsigned int mask = size - 1;
+    unsigned int slot = wavefrontMTLHashName(string, length) & mask;
+    for(; slots[slot]; slot = (slot + 1) & mask) {
+        const char *other = tableString(strings, stride, slots[slot] - 1);
+        if(strncmp(string, other, length) == 0 && other[length] == '\0') break;
+    }
+    return slot;
+}
+
+static int tableFind(
+    const unsigned int *slots, unsigned int size,
+    const void *strings, size_t stride,
+    const char *string, size_t length
+) {
+    if(!size) return -1;
+    unsigned int slot = tableProbe(slots, size, strings, stride, string, length);
+    return (int)slots[slot] - 1;
+}
+
+static int materialTableResize(struct WavefrontMTL *mtl, unsigned int count) {
+    return tableResize(mtl->allocator, &mtl->materialTable, &mtl->materialTableSize,
+        mtl->materials, sizeof(struct WavefrontMaterial), mtl->materialCount, count);
+}
+
+static int materialsResize(struct WavefrontMTL *mtl, unsigned int capacity) {
+    struct WavefrontMaterial *temp = 
+# 161 "src/wavefront_material.c" 3 4
+                                    ((void *)0)
+# 161 "src/wavefront_material.c"
+                                        ;
+    if(capacity) {
+        temp = (struct WavefrontMaterial*)wavefrontReallocateWith(
+            mtl->allocator, mtl->materials,
+            capacity * sizeof(struct WavefrontMaterial));
+        if(!temp) return 1;
+    } else {
+        wavefrontFreeWith(mtl->allocator, mtl->materials);
+    }
+    mtl->materials = temp;
+    mtl->materialCapacity = capacity;
+    return 0;
+}
+
+static void *arenaAllocate(struct WavefrontMTL *mtl, size_t size) {
+    struct WavefrontArenaChunk *chunk = mtl->arena;
+    if(chunk && chunk->size - chunk->used >= size) {
+        void *result = chunk->data + chunk->used;
+        chunk->used += size;
+        return result;
+    }
+
+    int dedicated = chunk && size > 65536 / 4;
+    size_t chunkSize = dedicated || size > 65536 ? size : 65536;
+    struct WavefrontArenaChunk *temp = wavefrontAllocateWith(mtl->allocator, sizeof(struct WavefrontArenaChunk) + chunkSize);
+    if(!temp) return 
+# 186 "src/wavefront_material.c" 3 4
+                    ((void *)0)
+# 186 "src/wavefront_material.c"
+                        ;
+    temp->size = chunkSize;
+    temp->used = size;
+    if(dedicated) {
+        temp->next = chunk->next;
+        chunk->next = temp;
+    } else {
+        temp->next = chunk;
+        mtl->arena = temp;
+    }
+    return temp->data;
+}
+
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length) {
+    char *result = mtl->flags & 0x1 ?
+        arenaAllocate(mtl, length + 1) : wavefrontAllocateWith(mtl->allocator, length + 1);
+    if(result) {
+        memcpy(result, string, length);
+        result[length] = '\0';
+    }
+    return result;
+}
+
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string) {
+
+    if(!(mtl->flags & 0x1)) wavefrontFreeWith(mtl->allocator, string);
+}
+
+void wavefrontMTLCompose(struct WavefrontMTL *mtl) {
+    mtl->materials = 
+# 215 "src/wavefront_material.c" 3 4
+                    ((void *)0)
+# 215 "src/wavefront_material.c"
+                        ;
+    mtl->materialCount = 0;
+    mtl->materialCapacity = 0;
+    mtl->materialTable = 
+# 218 "src/wavefront_material.c" 3 4
+                        ((void *)0)
+# 218 "src/wavefront_material.c"
+                            ;
+    mtl->materialTableSize = 0;
+    mtl->textures = 
+# 220 "src/wavefront_material.c" 3 4
+                   ((void *)0)
+# 220 "src/wavefront_material.c"
+                       ;
+    mtl->textureCount = 0;
+    mtl->textureCapacity = 0;
+    mtl->textureTable = 
+# 223 "src/wavefront_material.c" 3 4
+                       ((void *)0)
+# 223 "src/wavefront_material.c"
+                           ;
+    mtl->textureTableSize = 0;
+    mtl->mapOptions = 
+# 225 "src/wavefront_material.c" 3 4
+                     ((void *)0)
+# 225 "src/wavefront_material.c"
+                         ;
+    mtl->mapOptionCount = 0;
+    mtl->mapOptionCapacity = 0;
+    mtl->mapOptionTable = 
+# 228 "src/wavefront_material.c" 3 4
+                         ((void *)0)
+# 228 "src/wavefront_material.c"
+                             ;
+    mtl->mapOptionTableSize = 0;
+    mtl->flags = 0;
+    mtl->arena = 
+# 231 "src/wavefront_material.c" 3 4
+                ((void *)0)
+# 231 "src/wavefront_material.c"
+                    ;
+    mtl->allocator = 
+# 232 "src/wavefront_material.c" 3 4
+                    ((void *)0)
+# 232 "src/wavefront_material.c"
+                        ;
+}
+
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index) {
+    return (struct WavefrontMap*)((char*)m + mapOffsets[index]);
+}
+
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length) {
+    return tableFind(mtl->materialTable, mtl->materialTableSize,
+        mtl->materials, sizeof(struct WavefrontMaterial), name, length);
+}
+
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name) {
+    return wavefrontMTLFindMaterialN(mtl, name, strlen(name));
+}
+
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count) {
+    if(materialTableResize(mtl, count)) return 1;
+    if(count <= mtl->materialCapacity) return 0;
+    return materialsResize(mtl, count);
+}
+
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl) {
+    if(mtl->materialCount == mtl->materialCapacity) return 0;
+    return materialsResize(mtl, mtl->materialCount);
+}
+
+int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name) {
+
+    size_t length = strlen(name);
+    int index = wavefrontMTLFindMaterialN(mtl, name, length);
+    if(index >= 0) return index;
+
+
+    if(mtl->materialCount == mtl->materialCapacity) {
+        unsigned int capacity = mtl->materialCapacity ?
+            mtl->materialCapacity * 2 : 8;
+        if(materialsResize(mtl, capacity)) return 1;
+    }
+    if(materialTableResize(mtl, mtl->materialCount + 1)) return 1;
+    tableInsert(mtl->materialTable, mtl->materialTableSize, name, length, mtl->materialCount);
+
+    struct WavefrontMaterial *m = mtl->materialCount++ + mtl->materials;
+    int result = wavefrontMaterialCompose(m);
+    m->name = name;
+    return result;
+}
+
+static int texturesReserve(struct WavefrontMTL *mtl, unsigned int count) {
+    if(count > mtl->textureCapacity) {
+        unsigned int capacity = mtl->textureCapacity ?
+            mtl->textureCapacity * 2 : 8;
+        if(capacity < count) capacity = count;
+        char **temp = wavefrontReallocateWith(mtl->allocator, mtl->textures, capacity * sizeof(char*));
+        if(!temp) return 1;
+        mtl->textures = temp;
+        mtl->textureCapacity = capacity;
+    }
+    return tableResize(mtl->allocator, &mtl->textureTable, &mtl->textureTableSize,
+        mtl->textures, sizeof(char*), mtl->textureCount, count);
+}
+
+
+static unsigned int textureAppend(struct WavefrontMTL *mtl, char *file, size_t length) {
+    tableInsert(mtl->textureTable, mtl->textureTableSize, file, length, mtl->textureCount);
+    mtl->textures[mtl->textureCount++] = file;
+    return mtl->textureCount;
+}
+
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture) {
+    int index = tableFind(mtl->textureTable, mtl->textureTableSize,
+        mtl->textures, sizeof(char*), file, length);
+    if(index >= 0) {
+        *texture = index + 1;
+        return 0;
+    }
+
+    if(texturesReserve(mtl, mtl->textureCount + 1)) return 1;
+    char *copy = wavefrontMTLCopyString(mtl, file, length);
+    if(!copy) return 1;
+    *texture = textureAppend(mtl, copy, length);
+    return 0;
+}
+
+
+static unsigned int mapOptionsProbe(const struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options) {
+    unsigned int mask = mtl->mapOptionTableSize - 1;
+    unsigned int slot = hashBytes(2166136261u, options, sizeof(struct WavefrontMapOptions)) & mask;
+    for(; mtl->mapOptionTable[slot]; slot = (slot + 1) & mask) {
+        const struct WavefrontMapOptions *other = mtl->mapOptions + mtl->mapOptionTable[slot] - 1;
+        if(memcmp(options, other, sizeof(struct WavefrontMapOptions)) == 0) break;
+    }
+    return slot;
+}
+
+
+static void mapOptionsFill(struct WavefrontMTL *mtl) {
+    memset(mtl->mapOptionTable, 0, mtl->mapOptionTableSize * sizeof(unsigned int));
+    for(unsigned int i = 0; i < mtl->mapOptionCount; i++) {
+        mtl->mapOptionTable[mapOptionsProbe(mtl, mtl->mapOptions + i)] = i + 1;
+    }
+}
+
+static int mapOptionsReserve(struct WavefrontMTL *mtl, unsigned int count) {
+    if(count > mtl->mapOptionCapacity) {
+        unsigned int capacity = mtl->mapOptionCapacity ?
+            mtl->mapOptionCapacity * 2 : 8;
+        if(capacity < count) capacity = count;
+        struct WavefrontMapOptions *temp = wavefrontReallocateWith(mtl->allocator, mtl->mapOptions,
+            capacity * sizeof(struct WavefrontMapOptions));
+        if(!temp) return 1;
+        mtl->mapOptions = temp;
+        mtl->mapOptionCapacity = capacity;
+    }
+
+    unsigned int size = mtl->mapOptionTableSize ? mtl->mapOptionTableSize : 16;
+    while(size < count * 2) size *= 2;
+    if(size == mtl->mapOptionTableSize) return 0;
+    unsigned int *table = wavefrontAllocateWith(mtl->allocator, size * sizeof(unsigned int));
+    if(!table) return 1;
+    wavefrontFreeWith(mtl->allocator, mtl->mapOptionTable);
+    mtl->mapOptionTable = table;
+    mtl->mapOptionTableSize = size;
+    mapOptionsFill(mtl);
+    return 0;
+}
+
+
+static unsigned int mapOptionsAppend(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options) {
+    unsigned int slot = mapOptionsProbe(mtl, options);
+    if(!mtl->mapOptionTable[slot]) {
+        mtl->mapOptions[mtl->mapOptionCount] = *options;
+        mtl->mapOptionTable[slot] = ++mtl->mapOptionCount;
+    }
+    return mtl->mapOptionTable[slot];
+}
+
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index) {
+    *index = 0;
+    if(memcmp(options, &defaultMapOptions, sizeof(struct WavefrontMapOptions)) == 0) return 0;
+    if(mtl->mapOptionTableSize) {
+        unsigned int slot = mapOptionsProbe(mtl, options);
+        if(mtl->mapOptionTable[slot]) {
+            *index = mtl->mapOptionTable[slot];
+            return 0;
+        }
+    }
+    if(mapOptionsReserve(mtl, mtl->mapOptionCount + 1)) return 1;
+    *index = mapOptionsAppend(mtl, options);
+    return 0;
+}
+
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map) {
+    return map->options ? mtl->mapOptions + map->options - 1 : &defaultMapOptions;
+}
+
+static void wavefrontMaterialRelease(struct WavefrontMTL *mtl, struct WavefrontMaterial *m) {
+    wavefrontFreeWith(mtl->allocator, m->name);
+    for(unsigned int i = 0; i < 20; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+
+        if(!map->texture) wavefrontFreeWith(mtl->allocator, map->file);
+    }
+}
+
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other) {
+    if(mtl->flags != other->flags || mtl->allocator != other->allocator) return 2;
+
+
+    if(!mtl->materialCount && !mtl->textureCount && !mtl->mapOptionCount && !mtl->arena &&
+        other->materialCapacity >= mtl->materialCapacity) {
+        wavefrontFreeWith(mtl->allocator, mtl->materials);
+        wavefrontFreeWith(mtl->allocator, mtl->materialTable);
+        wavefrontFreeWith(mtl->allocator, mtl->textures);
+        wavefrontFreeWith(mtl->allocator, mtl->textureTable);
+        wavefrontFreeWith(mtl->allocator, mtl->mapOptions);
+        wavefrontFreeWith(mtl->allocator, mtl->mapOptionTable);
+        *mtl = *other;
+        wavefrontMTLCompose(other);
+        other->flags = mtl->flags;
+        other->allocator = mtl->allocator;
+        return 0;
+    }
+
+
+    unsigned int count = mtl->materialCount + other->materialCount;
+    if(count > mtl->materialCapacity) {
+        unsigned int capacity = mtl->materialCapacity * 2;
+        if(materialsResize(mtl, capacity > count ? capacity : count)) return 1;
+    }
+    if(materialTableResize(mtl, count)) return 1;
+    if(texturesReserve(mtl, mtl->textureCount + other->textureCount)) return 1;
+    if(mapOptionsReserve(mtl, mtl->mapOptionCount + other->mapOptionCount)) return 1;
+    unsigned int *remap = wavefrontAllocateZeroedWith(mtl->allocator, other->textureCount + 1, sizeof(unsigned int));
+    unsigned int *optionRemap = wavefrontAllocateZeroedWith(mtl->allocator, other->mapOptionCount + 1, sizeof(unsigned int));
+    if(!remap || !optionRemap) {
+        wavefrontFreeWith(mtl->allocator, remap);
+        wavefrontFreeWith(mtl->allocator, optionRemap);
+        return 1;
+    }
+
+
+    if(other->arena) {
+        struct WavefrontArenaChunk *last = other->arena;
+        while(last->next) last = last->next;
+        if(mtl->arena) {
+            last->next = mtl->arena->next;
+            mtl->arena->next = other->arena;
+        } else {
+            mtl->arena = other->arena;
+        }
+        other->arena = 
+# 443 "src/wavefront_material.c" 3 4
+                      ((void *)0)
+# 443 "src/wavefront_material.c"
+                          ;
+    }
+    int arena = mtl->flags & 0x1;
+
+
+
+    for(unsigned int i = 0; i < other->materialCount; i++) {
+        struct WavefrontMaterial *m = other->materials + i;
+        if(!m->name || wavefrontMTLFindMaterial(mtl, m->name) >= 0) continue;
+        for(unsigned int j = 0; j < 20; j++) {
+            remap[wavefrontMaterialMap(m, j)->texture] = 1;
+            optionRemap[wavefrontMaterialMap(m, j)->options] = 1;
+        }
+    }
+    remap[0] = 0;
+    optionRemap[0] = 0;
+    for(unsigned int i = 0; i < other->mapOptionCount; i++) {
+        if(optionRemap[i + 1]) optionRemap[i + 1] = mapOptionsAppend(mtl, other->mapOptions + i);
+    }
+    for(unsigned int i = 0; i < other->textureCount; i++) {
+        char *file = other->textures[i];
+        if(!remap[i + 1]) {
+            if(!arena) wavefrontFreeWith(mtl->allocator, file);
+            continue;
+        }
+        size_t length = strlen(file);
+        int index = tableFind(mtl->textureTable, mtl->textureTableSize,
+            mtl->textures, sizeof(char*), file, length);
+        if(index >= 0) {
+            remap[i + 1] = index + 1;
+            if(!arena) wavefrontFreeWith(mtl->allocator, file);
+        } else {
+            remap[i + 1] = textureAppend(mtl, file, length);
+        }
+    }
+
+    for(unsigned int i = 0; i < other->materialCount; i++) {
+        struct WavefrontMaterial *m = other->materials + i;
+        if(!m->name) continue;
+
+        unsigned int slot = tableProbe(mtl->materialTable, mtl->materialTableSize,
+            mtl->materials, sizeof(struct WavefrontMaterial), m->name, strlen(m->name));
+        if(mtl->materialTable[slot]) {
+            if(!arena) wavefrontMaterialRelease(mtl, m);
+            continue;
+        }
+        for(unsigned int j = 0; j < 20; j++) {
+            struct WavefrontMap *map = wavefrontMaterialMap(m, j);
+            map->options = optionRemap[map->options];
+            if(!map->texture) continue;
+            map->texture = remap[map->texture];
+            map->file = mtl->textures[map->texture - 1];
+        }
+        mtl->materials[mtl->materialCount++] = *m;
+        mtl->materialTable[slot] = mtl->materialCount;
+    }
+    wavefrontFreeWith(mtl->allocator, remap);
+    wavefrontFreeWith(mtl->allocator, optionRemap);
+
+    wavefrontFreeWith(mtl->allocator, other->materials);
+    wavefrontFreeWith(mtl->allocator, other->materialTable);
+    wavefrontFreeWith(mtl->allocator, other->textures);
+    wavefrontFreeWith(mtl->allocator, other->textureTable);
+    wavefrontFreeWith(mtl->allocator, other->mapOptions);
+    wavefrontFreeWith(mtl->allocator, other->mapOptionTable);
+    wavefrontMTLCompose(other);
+    other->flags = mtl->flags;
+    other->allocator = mtl->allocator;
+    return 0;
+}
+
+static int stringsEqual(const char *a, const char *b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b
+) {
+
+    size_t begin = 
+# 525 "src/wavefront_material.c" 3 4
+                  __builtin_offsetof (
+# 525 "src/wavefront_material.c"
+                  struct WavefrontMaterial
+# 525 "src/wavefront_material.c" 3 4
+                  , 
+# 525 "src/wavefront_material.c"
+                  ambient
+# 525 "src/wavefront_material.c" 3 4
+                  )
+# 525 "src/wavefront_material.c"
+                                                             ;
+    size_t end = 
+# 526 "src/wavefront_material.c" 3 4
+                __builtin_offsetof (
+# 526 "src/wavefront_material.c"
+                struct WavefrontMaterial
+# 526 "src/wavefront_material.c" 3 4
+                , 
+# 526 "src/wavefront_material.c"
+                illuminationModel
+# 526 "src/wavefront_material.c" 3 4
+                ) 
+# 526 "src/wavefront_material.c"
+                                                                      + sizeof(int);
+    if(memcmp((const char*)a + begin, (const char*)b + begin, end - begin) != 0) return 0;
+    for(unsigned int i = 0; i < 20; i++) {
+        const struct WavefrontMap *mapA = (const struct WavefrontMap*)((const char*)a + mapOffsets[i]);
+        const struct WavefrontMap *mapB = (const struct WavefrontMap*)((const char*)b + mapOffsets[i]);
+        if(!stringsEqual(mapA->file, mapB->file)) return 0;
+
+        if(x == y ? mapA->options != mapB->options :
+            memcmp(wavefrontMTLMapOptions(x, mapA), wavefrontMTLMapOptions(y, mapB),
+                sizeof(struct WavefrontMapOptions)) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m) {
+
+    size_t begin = 
+# 544 "src/wavefront_material.c" 3 4
+                  __builtin_offsetof (
+# 544 "src/wavefront_material.c"
+                  struct WavefrontMaterial
+# 544 "src/wavefront_material.c" 3 4
+                  , 
+# 544 "src/wavefront_material.c"
+                  ambient
+# 544 "src/wavefront_material.c" 3 4
+                  )
+# 544 "src/wavefront_material.c"
+                                                             ;
+    size_t end = 
+# 545 "src/wavefront_material.c" 3 4
+                __builtin_offsetof (
+# 545 "src/wavefront_material.c"
+                struct WavefrontMaterial
+# 545 "src/wavefront_material.c" 3 4
+                , 
+# 545 "src/wavefront_material.c"
+                illuminationModel
+# 545 "src/wavefront_material.c" 3 4
+                ) 
+# 545 "src/wavefront_material.c"
+                                                                      + sizeof(int);
+    unsigned int hash = hashBytes(2166136261u, (const char*)m + begin, end - begin);
+    for(unsigned char i = 0; i < 20; i++) {
+        const struct WavefrontMap *map = (const struct WavefrontMap*)((const char*)m + mapOffsets[i]);
+        if(!map->file) continue;
+        hash = hashBytes(hash, &i, 1);
+        hash = hashBytes(hash, map->file, strlen(map->file) + 1);
+        hash = hashBytes(hash, wavefrontMTLMapOptions(mtl, map), sizeof(struct WavefrontMapOptions));
+    }
+    return hash;
+}
+
+
+
+
+static int materialCopy(
+    struct WavefrontMTL *mtl,
+    struct WavefrontMaterial *m,
+    const struct WavefrontMTL *from,
+    const struct WavefrontMaterial *source
+) {
+    *m = *source;
+    m->name = 
+# 567 "src/wavefront_material.c" 3 4
+             ((void *)0)
+# 567 "src/wavefront_material.c"
+                 ;
+
+    int result = 0;
+    for(unsigned int i = 0; i < 20; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+        if(map->options && !result) {
+            result = wavefrontMTLInternMapOptions(mtl, wavefrontMTLMapOptions(from, map), &map->options);
+        }
+        if(result) map->options = 0;
+        const char *file = map->file;
+
+        map->file = 
+# 578 "src/wavefront_material.c" 3 4
+                   ((void *)0)
+# 578 "src/wavefront_material.c"
+                       ;
+        if(!file || result) {
+            map->texture = 0;
+        } else if(map->texture) {
+            result = wavefrontMTLInternTexture(mtl, file, strlen(file), &map->texture);
+            if(!result) map->file = mtl->textures[map->texture - 1];
+        } else {
+            map->file = wavefrontMTLCopyString(mtl, file, strlen(file));
+            if(!map->file) result = 1;
+        }
+        if(!map->file) map->texture = 0;
+    }
+    return result;
+}
+
+
+
+static int materialAssign(
+    struct WavefrontMTL *mtl,
+    struct WavefrontMaterial *m,
+    const struct WavefrontMTL *from,
+    const struct WavefrontMaterial *source
+) {
+    char *name = m->name;
+    m->name = 
+# 602 "src/wavefront_material.c" 3 4
+             ((void *)0)
+# 602 "src/wavefront_material.c"
+                 ;
+    if(!(mtl->flags & 0x1)) wavefrontMaterialRelease(mtl, m);
+    int result = materialCopy(mtl, m, from, source);
+    m->name = name;
+    return result;
+}
+
+
+
+
+static void mtlTruncate(
+    struct WavefrontMTL *mtl,
+    unsigned int materialCount,
+    unsigned int textureCount,
+    unsigned int mapOptionCount
+) {
+    if(!(mtl->flags & 0x1)) {
+        for(unsigned int i = materialCount; i < mtl->materialCount; i++) {
+            wavefrontMaterialRelease(mtl, mtl->materials + i);
+        }
+        for(unsigned int i = textureCount; i < mtl->textureCount; i++) {
+            wavefrontFreeWith(mtl->allocator, mtl->textures[i]);
+        }
+    }
+    if(materialCount < mtl->materialCount) {
+        mtl->materialCount = materialCount;
+        tableFill(mtl->materialTable, mtl->materialTableSize,
+            mtl->materials, sizeof(struct WavefrontMaterial), materialCount);
+    }
+    if(textureCount < mtl->textureCount) {
+        mtl->textureCount = textureCount;
+        tableFill(mtl->textureTable, mtl->textureTableSize, mtl->textures, sizeof(char*), textureCount);
+    }
+    if(mapOptionCount < mtl->mapOptionCount) {
+        mtl->mapOptionCount = mapOptionCount;
+        mapOptionsFill(mtl);
+    }
+}
+
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes) {
+    struct WavefrontMTLChanges local;
+    if(!changes) changes = &local;
+    memset(changes, 0, sizeof(struct WavefrontMTLChanges));
+    changes->allocator = mtl->allocator;
+
+
+
+
+    unsigned int count = mtl->materialCount;
+    int *matches = wavefrontAllocateWith(mtl->allocator, (count + 1) * sizeof(int));
+    unsigned char *matched = wavefrontAllocateZeroedWith(mtl->allocator, next->materialCount + 1, 1);
+    if(!matches || !matched) {
+        wavefrontFreeWith(mtl->allocator, matches);
+        wavefrontFreeWith(mtl->allocator, matched);
+        return 1;
+    }
+    unsigned int empty = 0, removed = 0, changed = 0, added = 0;
+    for(unsigned int i = 0; i < count; i++) {
+        const struct WavefrontMaterial *m = mtl->materials + i;
+        int j = m->name ? wavefrontMTLFindMaterial(next, m->name) : -2;
+        matches[i] = j;
+        if(j == -2) {
+            empty++;
+        } else if(j < 0) {
+            removed++;
+        } else if(wavefrontMaterialEqual(mtl, m, next, next->materials + j)) {
+            matched[j] = 1;
+        } else {
+            matched[j] = 2;
+            changed++;
+        }
+    }
+    for(unsigned int j = 0; j < next->materialCount; j++) {
+        if(!matched[j] && next->materials[j].name) added++;
+    }
+
+
+
+
+    unsigned int textureCount = mtl->textureCount;
+    unsigned int mapOptionCount = mtl->mapOptionCount;
+    unsigned int staged = 0;
+    struct WavefrontMaterial *copies = wavefrontAllocateWith(mtl->allocator,
+        (changed + added + 1) * sizeof(struct WavefrontMaterial));
+    changes->added = wavefrontAllocateWith(mtl->allocator, (added + 1) * sizeof(unsigned int));
+    changes->removed = wavefrontAllocateWith(mtl->allocator, (removed + 1) * sizeof(unsigned int));
+    changes->changed = wavefrontAllocateWith(mtl->allocator, (changed + 1) * sizeof(unsigned int));
+    int result = copies && changes->added && changes->removed && changes->changed ?
+        0 : 1;
+    if(!result) result = wavefrontMTLReserve(mtl, count + (added > empty ? added - empty : 0));
+    for(unsigned int i = 0; i < count && !result; i++) {
+        if(matches[i] < 0 || matched[matches[i]] != 2) continue;
+        result = materialCopy(mtl, copies + staged++, next, next->materials + matches[i]);
+    }
+    for(unsigned int j = 0; j < next->materialCount && !result; j++) {
+        const char *name = next->materials[j].name;
+        if(matched[j] || !name) continue;
+        struct WavefrontMaterial *m = copies + staged++;
+        result = materialCopy(mtl, m, next, next->materials + j);
+        if(!result) {
+            m->name = wavefrontMTLCopyString(mtl, name, strlen(name));
+            if(!m->name) result = 1;
+        }
+    }
+
+    if(result) {
+        if(!(mtl->flags & 0x1)) {
+            for(unsigned int i = 0; i < staged; i++) wavefrontMaterialRelease(mtl, copies + i);
+        }
+        mtlTruncate(mtl, count, textureCount, mapOptionCount);
+        wavefrontMTLChangesRelease(changes);
+    } else {
+
+        staged = 0;
+        for(unsigned int i = 0; i < count; i++) {
+            struct WavefrontMaterial *m = mtl->materials + i;
+            int j = matches[i];
+            if(j == -2 || (j >= 0 && matched[j] == 1)) continue;
+            char *name = m->name;
+            if(j >= 0) m->name = 
+# 721 "src/wavefront_material.c" 3 4
+                                ((void *)0)
+# 721 "src/wavefront_material.c"
+                                    ;
+            if(!(mtl->flags & 0x1)) wavefrontMaterialRelease(mtl, m);
+            if(j < 0) {
+
+                wavefrontMaterialCompose(m);
+                changes->removed[changes->removedCount++] = i;
+            } else {
+                *m = copies[staged++];
+                m->name = name;
+                changes->changed[changes->changedCount++] = i;
+            }
+        }
+        unsigned int slot = 0;
+        for(unsigned int k = 0; k < added; k++) {
+            while(slot < count && matches[slot] != -2) slot++;
+            unsigned int index = slot < count ? slot++ : mtl->materialCount++;
+            mtl->materials[index] = copies[staged++];
+            changes->added[changes->addedCount++] = index;
+        }
+        if(removed || added) {
+            tableFill(mtl->materialTable, mtl->materialTableSize,
+                mtl->materials, sizeof(struct WavefrontMaterial), mtl->materialCount);
+        }
+    }
+    wavefrontFreeWith(mtl->allocator, copies);
+    wavefrontFreeWith(mtl->allocator, matches);
+    wavefrontFreeWith(mtl->allocator, matched);
+    if(changes == &local) wavefrontMTLChangesRelease(&local);
+    return result;
+}
+
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes) {
+    wavefrontFreeWith(changes->allocator, changes->added);
+    wavefrontFreeWith(changes->allocator, changes->removed);
+    wavefrontFreeWith(changes->allocator, changes->changed);
+    memset(changes, 0, sizeof(struct WavefrontMTLChanges));
+}
+
+
+
+static int addUniqueMaterial(struct WavefrontMTL *mtl, const char *name, unsigned int suffix, unsigned int *index) {
+    size_t length = strlen(name);
+    char *copy = 
+# 763 "src/wavefront_material.c" 3 4
+                ((void *)0)
+# 763 "src/wavefront_material.c"
+                    ;
+    if(wavefrontMTLFindMaterialN(mtl, name, length) < 0) {
+        copy = wavefrontMTLCopyString(mtl, name, length);
+    } else {
+
+        char *candidate = wavefrontAllocateWith(mtl->allocator, length + 12);
+        if(!candidate) return 1;
+        memcpy(candidate, name, length);
+        size_t candidateLength;
+        do {
+            candidateLength = length + snprintf(candidate + length, 12, ".%u", suffix++);
+        } while(wavefrontMTLFindMaterialN(mtl, candidate, candidateLength) >= 0);
+        copy = wavefrontMTLCopyString(mtl, candidate, candidateLength);
+        wavefrontFreeWith(mtl->allocator, candidate);
+    }
+    if(!copy) return 1;
+    int result = wavefrontMTLAddMaterial(mtl, copy);
+    if(result) {
+        wavefrontMTLFreeString(mtl, copy);
+        return result;
+    }
+    *index = mtl->materialCount - 1;
+    return 0;
+}
+
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap
+) {
+    memset(remap, 0, sizeof(struct WavefrontMTLRemap));
+    remap->allocator = mtl->allocator;
+
+    unsigned int materialCount = mtl->materialCount;
+    unsigned int textureCount = mtl->textureCount;
+    unsigned int mapOptionCount = mtl->mapOptionCount;
+    unsigned int total = 0;
+    for(unsigned int s = 0; s < sourceCount; s++) total += sources[s].materialCount;
+
+
+    unsigned int capacity = mtl->materialCount + total;
+    unsigned int size = 16;
+    while(size < capacity * 2) size *= 2;
+    unsigned int mask = size - 1;
+    unsigned int *slots = wavefrontAllocateZeroedWith(mtl->allocator, size, sizeof(unsigned int));
+    unsigned int *hashes = wavefrontAllocateWith(mtl->allocator, (capacity + 1) * sizeof(unsigned int));
+    remap->offsets = wavefrontAllocateWith(mtl->allocator, (sourceCount + 1) * sizeof(unsigned int));
+    remap->indices = wavefrontAllocateWith(mtl->allocator, (total + 1) * sizeof(int));
+    int result = slots && hashes && remap->offsets && remap->indices ? 0 : 1;
+    remap->sourceCount = sourceCount;
+
+
+    for(unsigned int i = 0; i < mtl->materialCount && !result; i++) {
+        const struct WavefrontMaterial *m = mtl->materials + i;
+        if(!m->name) continue;
+        unsigned int hash = wavefrontMaterialHash(mtl, m);
+        unsigned int slot = hash & mask;
+        for(; slots[slot]; slot = (slot + 1) & mask) {
+            unsigned int j = slots[slot] - 1;
+            if(hashes[j] == hash && wavefrontMaterialEqual(mtl, mtl->materials + j, mtl, m)) break;
+        }
+        if(slots[slot]) continue;
+        hashes[i] = hash;
+        slots[slot] = i + 1;
+    }
+
+    unsigned int position = 0;
+    for(unsigned int s = 0; s < sourceCount && !result; s++) {
+        remap->offsets[s] = position;
+        for(unsigned int i = 0; i < sources[s].materialCount && !result; i++) {
+            const struct WavefrontMaterial *m = sources[s].materials + i;
+            if(!m->name) {
+                remap->indices[position++] = -1;
+                continue;
+            }
+            unsigned int hash = wavefrontMaterialHash(sources + s, m);
+            unsigned int slot = hash & mask;
+            for(; slots[slot]; slot = (slot + 1) & mask) {
+                unsigned int j = slots[slot] - 1;
+                if(hashes[j] == hash && wavefrontMaterialEqual(mtl, mtl->materials + j, sources + s, m)) break;
+            }
+            if(slots[slot]) {
+                remap->indices[position++] = slots[slot] - 1;
+                continue;
+            }
+            unsigned int index;
+            result = addUniqueMaterial(mtl, m->name, s + 1, &index);
+            if(!result) result = materialAssign(mtl, mtl->materials + index, sources + s, m);
+            if(result) break;
+            hashes[index] = hash;
+            slots[slot] = index + 1;
+            remap->indices[position++] = index;
+        }
+    }
+    if(!result) remap->offsets[sourceCount] = position;
+    wavefrontFreeWith(mtl->allocator, slots);
+    wavefrontFreeWith(mtl->allocator, hashes);
+    if(result) {
+        mtlTruncate(mtl, materialCount, textureCount, mapOptionCount);
+        wavefrontMTLRemapRelease(remap);
+    }
+    return result;
+}
+
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap) {
+    wavefrontFreeWith(remap->allocator, remap->indices);
+    wavefrontFreeWith(remap->allocator, remap->offsets);
+    memset(remap, 0, sizeof(struct WavefrontMTLRemap));
+}
+
+void wavefrontMTLRelease(struct WavefrontMTL *mtl) {
+    if(mtl->flags & 0x1) {
+        while(mtl->arena) {
+            struct WavefrontArenaChunk *next = mtl->arena->next;
+            wavefrontFreeWith(mtl->allocator, mtl->arena);
+            mtl->arena = next;
+        }
+    } else {
+        for(unsigned int i = 0; i < mtl->materialCount; i++) {
+            wavefrontMaterialRelease(mtl, mtl->materials + i);
+        }
+        for(unsigned int i = 0; i < mtl->textureCount; i++) {
+            wavefrontFreeWith(mtl->allocator, mtl->textures[i]);
+        }
+    }
+    wavefrontFreeWith(mtl->allocator, mtl->materials);
+    wavefrontFreeWith(mtl->allocator, mtl->materialTable);
+    wavefrontFreeWith(mtl->allocator, mtl->textures);
+    wavefrontFreeWith(mtl->allocator, mtl->textureTable);
+    wavefrontFreeWith(mtl->allocator, mtl->mapOptions);
+    wavefrontFreeWith(mtl->allocator, mtl->mapOptionTable);
+    wavefrontMTLCompose(mtl);
+}
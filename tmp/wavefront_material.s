@@ -0,0 +1,5263 @@
+	.file	"wavefront_material.c"
+	.text
+	.p2align 4
+	.type	mapOptionsFill, @function
+mapOptionsFill:
+.LFB49:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%esi, %esi
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	88(%rdi), %edx
+	movq	%rdi, (%rsp)
+	movq	80(%rdi), %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+	movl	72(%rbx), %eax
+	testl	%eax, %eax
+	je	.L1
+	movq	80(%rbx), %r13
+	movq	64(%rbx), %r12
+	movl	$0, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	movl	8(%rsp), %ebx
+	movq	(%rsp), %rax
+	movl	$-2128831035, %ecx
+	movl	88(%rax), %eax
+	salq	$6, %rbx
+	addq	%r12, %rbx
+	movl	%eax, 12(%rsp)
+	leal	-1(%rax), %ebp
+	leaq	64(%rbx), %rsi
+	movq	%rbx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	movzbl	(%rax), %edx
+	addq	$1, %rax
+	xorl	%edx, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%rsi, %rax
+	jne	.L3
+	jmp	.L17
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	salq	$6, %rax
+	movl	$64, %edx
+	movq	%rbx, %rdi
+	leaq	-64(%r12,%rax), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L4
+	leal	1(%r14), %ecx
+.L17:
+	andl	%ebp, %ecx
+	movl	%ecx, %eax
+	leaq	0(%r13,%rax,4), %r15
+	movq	%rax, %r14
+	movl	(%r15), %eax
+	testl	%eax, %eax
+	jne	.L19
+.L4:
+	addl	$1, 8(%rsp)
+	movq	(%rsp), %rdi
+	movl	8(%rsp), %eax
+	movl	%eax, (%r15)
+	cmpl	72(%rdi), %eax
+	jb	.L6
+.L1:
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	mapOptionsFill, .-mapOptionsFill
+	.p2align 4
+	.type	mapOptionsReserve, @function
+mapOptionsReserve:
+.LFB50:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	76(%rdi), %edx
+	movl	%esi, %ebx
+	cmpl	%esi, %edx
+	jnb	.L21
+	testl	%edx, %edx
+	leal	(%rdx,%rdx), %eax
+	movl	$8, %edx
+	cmove	%edx, %eax
+	cmpl	%esi, %eax
+	cmovb	%esi, %eax
+	movq	64(%rdi), %rsi
+	movq	104(%rdi), %rdi
+	movl	%eax, %edx
+	movq	%rdx, %r12
+	salq	$6, %rdx
+	call	wavefrontReallocateWith@PLT
+	testq	%rax, %rax
+	je	.L31
+	movq	%rax, 64(%rbp)
+	movl	%r12d, 76(%rbp)
+.L21:
+	movl	88(%rbp), %edx
+	leal	(%rbx,%rbx), %eax
+	testl	%edx, %edx
+	je	.L39
+	cmpl	%eax, %edx
+	jnb	.L28
+	movl	%edx, %ebx
+	addl	%ebx, %ebx
+	cmpl	%eax, %ebx
+	jb	.L29
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	movl	%ebx, %esi
+	salq	$2, %rsi
+	cmpl	%ebx, %edx
+	je	.L28
+.L27:
+	movq	104(%rbp), %rdi
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L31
+	movq	104(%rbp), %rdi
+	movq	80(%rbp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	%r12, 80(%rbp)
+	movq	%rbp, %rdi
+	movl	%ebx, 88(%rbp)
+	call	mapOptionsFill
+.L28:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.cfi_restore_state
+	movl	$16, %ebx
+	movl	$64, %esi
+	cmpl	$16, %eax
+	jbe	.L27
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	addl	%ebx, %ebx
+	cmpl	%eax, %ebx
+	jb	.L29
+	jmp	.L40
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE50:
+	.size	mapOptionsReserve, .-mapOptionsReserve
+	.p2align 4
+	.type	texturesReserve, @function
+texturesReserve:
+.LFB45:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	%esi, %ebx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movl	44(%rdi), %edx
+	movq	32(%rdi), %r14
+	cmpl	%esi, %edx
+	jnb	.L42
+	testl	%edx, %edx
+	leal	(%rdx,%rdx), %eax
+	movl	$8, %edx
+	movq	104(%rdi), %rdi
+	cmove	%edx, %eax
+	cmpl	%esi, %eax
+	cmovb	%esi, %eax
+	movq	%r14, %rsi
+	movl	%eax, %edx
+	movq	%rdx, %rbp
+	salq	$3, %rdx
+	call	wavefrontReallocateWith@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L51
+	movq	%rax, 32(%r15)
+	movl	%ebp, 44(%r15)
+.L42:
+	movl	56(%r15), %edx
+	leal	(%rbx,%rbx), %eax
+	testl	%edx, %edx
+	je	.L75
+	cmpl	%eax, %edx
+	jnb	.L49
+	movl	%edx, %r12d
+	addl	%r12d, %r12d
+	cmpl	%eax, %r12d
+	jb	.L50
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	cmpl	%r12d, %edx
+	je	.L49
+	movl	%r12d, %edx
+	leaq	0(,%rdx,4), %rbp
+.L48:
+	movq	104(%r15), %rax
+	movq	%rbp, %rsi
+	movl	40(%r15), %ebx
+	movq	%rax, %rdi
+	movq	%rax, 24(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L51
+	movq	%rbp, %rdx
+	xorl	%esi, %esi
+	leal	-1(%r12), %ebp
+	movq	%rax, %rdi
+	call	memset@PLT
+	xorl	%esi, %esi
+	testl	%ebx, %ebx
+	jne	.L58
+	jmp	.L59
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	addq	$8, %r14
+	cmpl	%esi, %ebx
+	je	.L59
+.L58:
+	movq	(%r14), %rdx
+	addl	$1, %esi
+	testq	%rdx, %rdx
+	je	.L53
+	movq	%rdx, %rdi
+	movl	%esi, 12(%rsp)
+	movq	%rdx, 16(%rsp)
+	call	strlen@PLT
+	movl	12(%rsp), %esi
+	testq	%rax, %rax
+	je	.L62
+	movq	16(%rsp), %rdx
+	leaq	(%rdx,%rax), %r8
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	movzbl	(%rdx), %edi
+	addq	$1, %rdx
+	xorl	%edi, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%r8, %rdx
+	jne	.L55
+	andl	%ebp, %eax
+	movl	%eax, %edx
+	leaq	0(%r13,%rdx,4), %rdx
+	movl	(%rdx), %ecx
+	testl	%ecx, %ecx
+	je	.L56
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	addl	$1, %eax
+.L54:
+	andl	%ebp, %eax
+	movl	%eax, %edx
+	leaq	0(%r13,%rdx,4), %rdx
+	movl	(%rdx), %ecx
+	testl	%ecx, %ecx
+	jne	.L76
+.L56:
+	movl	%esi, (%rdx)
+	addq	$8, %r14
+	cmpl	%esi, %ebx
+	jne	.L58
+.L59:
+	movq	48(%r15), %rsi
+	movq	24(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%r13, 48(%r15)
+	movl	%r12d, 56(%r15)
+.L49:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.cfi_restore_state
+	movl	$16, %r12d
+	movl	$64, %ebp
+	cmpl	$16, %eax
+	jbe	.L48
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	addl	%r12d, %r12d
+	cmpl	%eax, %r12d
+	jb	.L50
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+	movl	$-2128831035, %eax
+	jmp	.L54
+	.cfi_endproc
+.LFE45:
+	.size	texturesReserve, .-texturesReserve
+	.p2align 4
+	.type	mtlTruncate, @function
+mtlTruncate:
+.LFB61:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	%esi, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movl	8(%rdi), %eax
+	movl	%edx, 8(%rsp)
+	movl	%ecx, 28(%rsp)
+	testb	$1, 92(%rdi)
+	jne	.L88
+	cmpl	%eax, %esi
+	jnb	.L82
+	movl	%esi, %ebp
+	leaq	160+mapOffsets(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	movl	%ebp, %r15d
+	movq	104(%r14), %rdi
+	leaq	mapOffsets(%rip), %rbx
+	imulq	$456, %r15, %r15
+	addq	(%r14), %r15
+	movq	(%r15), %rsi
+	call	wavefrontFreeWith@PLT
+	jmp	.L84
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	addq	$8, %rbx
+	cmpq	%r12, %rbx
+	je	.L131
+.L84:
+	movq	(%rbx), %rax
+	addq	%r15, %rax
+	movl	8(%rax), %r8d
+	testl	%r8d, %r8d
+	jne	.L83
+	movq	(%rax), %rsi
+	movq	104(%r14), %rdi
+	addq	$8, %rbx
+	call	wavefrontFreeWith@PLT
+	cmpq	%r12, %rbx
+	jne	.L84
+.L131:
+	movl	8(%r14), %eax
+	addl	$1, %ebp
+	cmpl	%eax, %ebp
+	jb	.L85
+	movl	8(%rsp), %ecx
+	cmpl	40(%r14), %ecx
+	jnb	.L86
+.L105:
+	movl	8(%rsp), %ebx
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	movq	32(%r14), %rax
+	movl	%ebx, %edx
+	movq	104(%r14), %rdi
+	addl	$1, %ebx
+	movq	(%rax,%rdx,8), %rsi
+	call	wavefrontFreeWith@PLT
+	cmpl	40(%r14), %ebx
+	jb	.L87
+.L88:
+	cmpl	8(%r14), %r13d
+	jb	.L80
+.L81:
+	movl	8(%rsp), %eax
+	cmpl	40(%r14), %eax
+	jb	.L132
+.L90:
+	movl	28(%rsp), %eax
+	cmpl	72(%r14), %eax
+	jb	.L133
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L86:
+	.cfi_restore_state
+	cmpl	%eax, %r13d
+	jnb	.L90
+.L80:
+	movl	24(%r14), %edx
+	movq	16(%r14), %rbp
+	movl	%r13d, 8(%r14)
+	xorl	%esi, %esi
+	movq	(%r14), %r15
+	movq	%rdx, %rbx
+	movq	%rbp, %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+	testl	%r13d, %r13d
+	je	.L81
+	movq	%r15, %rcx
+	subl	$1, %ebx
+	xorl	%r15d, %r15d
+	jmp	.L96
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	addq	$456, %rcx
+	cmpl	%r15d, %r13d
+	je	.L81
+.L96:
+	movq	(%rcx), %r12
+	addl	$1, %r15d
+	testq	%r12, %r12
+	je	.L91
+	movq	%r12, %rdi
+	movq	%rcx, 16(%rsp)
+	call	strlen@PLT
+	movq	16(%rsp), %rcx
+	testq	%rax, %rax
+	je	.L106
+	leaq	(%r12,%rax), %rdi
+	movq	%r12, %rdx
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	movzbl	(%rdx), %esi
+	addq	$1, %rdx
+	xorl	%esi, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%rdi, %rdx
+	jne	.L93
+	andl	%ebx, %eax
+	movl	%eax, %edx
+	leaq	0(%rbp,%rdx,4), %rdx
+	movl	(%rdx), %edi
+	testl	%edi, %edi
+	je	.L94
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	addl	$1, %eax
+.L92:
+	andl	%ebx, %eax
+	movl	%eax, %edx
+	leaq	0(%rbp,%rdx,4), %rdx
+	movl	(%rdx), %edi
+	testl	%edi, %edi
+	jne	.L134
+.L94:
+	movl	%r15d, (%rdx)
+	jmp	.L91
+.L133:
+	movl	%eax, 72(%r14)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	mapOptionsFill
+.L132:
+	.cfi_restore_state
+	movl	56(%r14), %edx
+	movq	48(%r14), %rbp
+	movl	%eax, 40(%r14)
+	movl	%eax, %ebx
+	xorl	%esi, %esi
+	movq	32(%r14), %r13
+	movq	%rdx, %r15
+	movq	%rbp, %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+	testl	%ebx, %ebx
+	je	.L90
+	movl	%ebx, %ecx
+	movl	$1, %r12d
+	subl	$1, %r15d
+	jmp	.L104
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	leaq	1(%r12), %rax
+	cmpq	%rcx, %r12
+	je	.L90
+	movq	%rax, %r12
+.L104:
+	movq	-8(%r13,%r12,8), %rbx
+	testq	%rbx, %rbx
+	je	.L99
+	movq	%rbx, %rdi
+	movq	%rcx, 8(%rsp)
+	call	strlen@PLT
+	movq	8(%rsp), %rcx
+	testq	%rax, %rax
+	je	.L107
+	leaq	(%rbx,%rax), %rdi
+	movq	%rbx, %rdx
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	movzbl	(%rdx), %esi
+	addq	$1, %rdx
+	xorl	%esi, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%rdi, %rdx
+	jne	.L101
+	andl	%r15d, %eax
+	movl	%eax, %edx
+	leaq	0(%rbp,%rdx,4), %rdx
+	movl	(%rdx), %esi
+	testl	%esi, %esi
+	je	.L102
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	addl	$1, %eax
+.L100:
+	andl	%r15d, %eax
+	movl	%eax, %edx
+	leaq	0(%rbp,%rdx,4), %rdx
+	movl	(%rdx), %esi
+	testl	%esi, %esi
+	jne	.L135
+.L102:
+	movl	%r12d, (%rdx)
+	jmp	.L99
+.L82:
+	cmpl	40(%rdi), %edx
+	jb	.L105
+	jmp	.L90
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movl	$-2128831035, %eax
+	jmp	.L100
+.L106:
+	movl	$-2128831035, %eax
+	jmp	.L92
+	.cfi_endproc
+.LFE61:
+	.size	mtlTruncate, .-mtlTruncate
+	.p2align 4
+	.globl	wavefrontMapOptionsCompose
+	.type	wavefrontMapOptionsCompose, @function
+wavefrontMapOptionsCompose:
+.LFB22:
+	.cfi_startproc
+	pxor	%xmm0, %xmm0
+	movq	.LC0(%rip), %rax
+	movups	%xmm0, 16(%rdi)
+	movups	%xmm0, 48(%rdi)
+	movups	%xmm0, (%rdi)
+	movups	%xmm0, 32(%rdi)
+	movss	.LC1(%rip), %xmm0
+	movq	%rax, 12(%rdi)
+	movl	$3, 60(%rdi)
+	movss	%xmm0, 20(%rdi)
+	movss	%xmm0, 36(%rdi)
+	movss	%xmm0, 48(%rdi)
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	wavefrontMapOptionsCompose, .-wavefrontMapOptionsCompose
+	.p2align 4
+	.globl	wavefrontMaterialCompose
+	.type	wavefrontMaterialCompose, @function
+wavefrontMaterialCompose:
+.LFB23:
+	.cfi_startproc
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	movl	$456, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	wavefrontMaterialCompose, .-wavefrontMaterialCompose
+	.p2align 4
+	.globl	wavefrontMTLHashName
+	.type	wavefrontMTLHashName, @function
+wavefrontMTLHashName:
+.LFB25:
+	.cfi_startproc
+	testq	%rsi, %rsi
+	je	.L142
+	addq	%rdi, %rsi
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	movzbl	(%rdi), %edx
+	addq	$1, %rdi
+	xorl	%edx, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%rsi, %rdi
+	jne	.L141
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	movl	$-2128831035, %eax
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	wavefrontMTLHashName, .-wavefrontMTLHashName
+	.p2align 4
+	.globl	wavefrontMTLCopyString
+	.type	wavefrontMTLCopyString, @function
+wavefrontMTLCopyString:
+.LFB36:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	1(%rdx), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	testb	$1, 92(%rdi)
+	je	.L145
+	movq	96(%rdi), %r14
+	testq	%r14, %r14
+	je	.L146
+	movq	16(%r14), %rdx
+	movq	8(%r14), %rax
+	subq	%rdx, %rax
+	cmpq	%r13, %rax
+	jnb	.L171
+.L146:
+	testq	%r14, %r14
+	movq	104(%rbx), %rdi
+	setne	%r15b
+	cmpq	$16384, %r13
+	seta	%al
+	andl	%eax, %r15d
+	cmpq	$65536, %r13
+	ja	.L156
+	testb	%r15b, %r15b
+	jne	.L156
+	movl	$65560, %esi
+	call	wavefrontAllocateWith@PLT
+	testq	%rax, %rax
+	je	.L154
+	movq	$65536, 8(%rax)
+	movq	%r13, 16(%rax)
+.L152:
+	movq	%r14, (%rax)
+	movq	%rax, 96(%rbx)
+.L153:
+	leaq	24(%rax), %rbx
+.L147:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	memcpy@PLT
+	movb	$0, (%rbx,%r12)
+.L144:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	.cfi_restore_state
+	movq	104(%rdi), %rdi
+	movq	%r13, %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	jne	.L147
+.L154:
+	xorl	%ebx, %ebx
+	jmp	.L144
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	leaq	25(%r12), %rsi
+	call	wavefrontAllocateWith@PLT
+	testq	%rax, %rax
+	je	.L154
+	movq	%r13, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	movups	%xmm0, 8(%rax)
+	testb	%r15b, %r15b
+	je	.L152
+	movq	(%r14), %rdx
+	movq	%rdx, (%rax)
+	movq	%rax, (%r14)
+	jmp	.L153
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	leaq	24(%r14,%rdx), %rbx
+	addq	%r13, %rdx
+	movq	%rdx, 16(%r14)
+	jmp	.L147
+	.cfi_endproc
+.LFE36:
+	.size	wavefrontMTLCopyString, .-wavefrontMTLCopyString
+	.p2align 4
+	.globl	wavefrontMTLFreeString
+	.type	wavefrontMTLFreeString, @function
+wavefrontMTLFreeString:
+.LFB37:
+	.cfi_startproc
+	testb	$1, 92(%rdi)
+	je	.L174
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	movq	104(%rdi), %rdi
+	jmp	wavefrontFreeWith@PLT
+	.cfi_endproc
+.LFE37:
+	.size	wavefrontMTLFreeString, .-wavefrontMTLFreeString
+	.p2align 4
+	.globl	wavefrontMTLCompose
+	.type	wavefrontMTLCompose, @function
+wavefrontMTLCompose:
+.LFB38:
+	.cfi_startproc
+	pxor	%xmm0, %xmm0
+	movq	$0, (%rdi)
+	movq	$0, 8(%rdi)
+	movq	$0, 16(%rdi)
+	movl	$0, 24(%rdi)
+	movq	$0, 32(%rdi)
+	movq	$0, 40(%rdi)
+	movq	$0, 48(%rdi)
+	movl	$0, 56(%rdi)
+	movq	$0, 64(%rdi)
+	movq	$0, 72(%rdi)
+	movq	$0, 80(%rdi)
+	movq	$0, 88(%rdi)
+	movups	%xmm0, 96(%rdi)
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	wavefrontMTLCompose, .-wavefrontMTLCompose
+	.p2align 4
+	.globl	wavefrontMaterialMap
+	.type	wavefrontMaterialMap, @function
+wavefrontMaterialMap:
+.LFB39:
+	.cfi_startproc
+	movl	%esi, %esi
+	leaq	mapOffsets(%rip), %rax
+	addq	(%rax,%rsi,8), %rdi
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	wavefrontMaterialMap, .-wavefrontMaterialMap
+	.p2align 4
+	.globl	wavefrontMTLFindMaterialN
+	.type	wavefrontMTLFindMaterialN, @function
+wavefrontMTLFindMaterialN:
+.LFB40:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	(%rdi), %rax
+	movl	24(%rdi), %r13d
+	movq	%rsi, 8(%rsp)
+	movq	16(%rdi), %r14
+	movq	%rax, (%rsp)
+	testl	%r13d, %r13d
+	je	.L184
+	movq	%rdx, %rbp
+	subl	$1, %r13d
+	testq	%rdx, %rdx
+	je	.L185
+	movq	%rsi, %rax
+	movl	$-2128831035, %ecx
+	addq	%rdx, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L180:
+	movzbl	(%rax), %edx
+	addq	$1, %rax
+	xorl	%edx, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%rsi, %rax
+	jne	.L180
+	andl	%r13d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %ebx
+	movq	%rax, %r12
+	testl	%ebx, %ebx
+	je	.L184
+	.p2align 4,,10
+	.p2align 3
+.L191:
+	leal	-1(%rbx), %eax
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	movq	%rax, %rbx
+	imulq	$456, %rax, %rax
+	movq	(%rdi,%rax), %r15
+	movq	8(%rsp), %rdi
+	movq	%r15, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L182
+	cmpb	$0, (%r15,%rbp)
+	je	.L190
+.L182:
+	leal	1(%r12), %ecx
+.L179:
+	andl	%r13d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %ebx
+	movq	%rax, %r12
+	testl	%ebx, %ebx
+	jne	.L191
+.L184:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$-1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	.cfi_restore_state
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L185:
+	.cfi_restore_state
+	movl	$-2128831035, %ecx
+	jmp	.L179
+	.cfi_endproc
+.LFE40:
+	.size	wavefrontMTLFindMaterialN, .-wavefrontMTLFindMaterialN
+	.p2align 4
+	.globl	wavefrontMTLFindMaterial
+	.type	wavefrontMTLFindMaterial, @function
+wavefrontMTLFindMaterial:
+.LFB41:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rsi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rsi, 8(%rsp)
+	call	strlen@PLT
+	movl	24(%rbx), %r13d
+	movq	16(%rbx), %r14
+	movq	%rax, %rbp
+	movq	(%rbx), %rax
+	movq	%rax, (%rsp)
+	testl	%r13d, %r13d
+	je	.L199
+	subl	$1, %r13d
+	testq	%rbp, %rbp
+	je	.L200
+	movq	%r15, %rax
+	leaq	0(%rbp,%r15), %rsi
+	movl	$-2128831035, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L195:
+	movzbl	(%rax), %edx
+	addq	$1, %rax
+	xorl	%edx, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%rsi, %rax
+	jne	.L195
+	andl	%r13d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %ebx
+	movq	%rax, %r12
+	testl	%ebx, %ebx
+	je	.L199
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	leal	-1(%rbx), %eax
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	movq	%rax, %rbx
+	imulq	$456, %rax, %rax
+	movq	(%rdi,%rax), %r15
+	movq	8(%rsp), %rdi
+	movq	%r15, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L197
+	cmpb	$0, (%r15,%rbp)
+	je	.L205
+.L197:
+	leal	1(%r12), %ecx
+.L194:
+	andl	%r13d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %ebx
+	movq	%rax, %r12
+	testl	%ebx, %ebx
+	jne	.L206
+.L199:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$-1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	.cfi_restore_state
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L200:
+	.cfi_restore_state
+	movl	$-2128831035, %ecx
+	jmp	.L194
+	.cfi_endproc
+.LFE41:
+	.size	wavefrontMTLFindMaterial, .-wavefrontMTLFindMaterial
+	.p2align 4
+	.globl	wavefrontMTLReserve
+	.type	wavefrontMTLReserve, @function
+wavefrontMTLReserve:
+.LFB42:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	104(%rdi), %rax
+	movl	24(%rdi), %edx
+	movl	%esi, 28(%rsp)
+	movq	%rax, 16(%rsp)
+	leal	(%rsi,%rsi), %eax
+	testl	%edx, %edx
+	jne	.L208
+	movl	$16, %r13d
+	movl	$64, %ebx
+	cmpl	$16, %eax
+	jbe	.L210
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	addl	%r13d, %r13d
+	cmpl	%eax, %r13d
+	jb	.L212
+.L241:
+	cmpl	%r13d, %edx
+	je	.L211
+	movl	%r13d, %edx
+	leaq	0(,%rdx,4), %rbx
+.L210:
+	movq	16(%rsp), %rdi
+	movq	%rbx, %rsi
+	movl	8(%r12), %ebp
+	movq	(%r12), %r15
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L224
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	xorl	%ebx, %ebx
+	call	memset@PLT
+	movq	%r15, %rsi
+	leal	-1(%r13), %r15d
+	testl	%ebp, %ebp
+	jne	.L221
+	jmp	.L222
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	addq	$456, %rsi
+	cmpl	%ebx, %ebp
+	je	.L222
+.L221:
+	movq	(%rsi), %rdi
+	addl	$1, %ebx
+	testq	%rdi, %rdi
+	je	.L216
+	movq	%rsi, (%rsp)
+	movq	%rdi, 8(%rsp)
+	call	strlen@PLT
+	movq	(%rsp), %rsi
+	testq	%rax, %rax
+	je	.L226
+	movq	8(%rsp), %rdi
+	leaq	(%rdi,%rax), %r9
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L218:
+	movzbl	(%rdi), %r8d
+	addq	$1, %rdi
+	xorl	%r8d, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%r9, %rdi
+	jne	.L218
+	andl	%r15d, %eax
+	movl	%eax, %edi
+	leaq	(%r14,%rdi,4), %rdi
+	movl	(%rdi), %edx
+	testl	%edx, %edx
+	je	.L219
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	addl	$1, %eax
+.L217:
+	andl	%r15d, %eax
+	movl	%eax, %edi
+	leaq	(%r14,%rdi,4), %rdi
+	movl	(%rdi), %edx
+	testl	%edx, %edx
+	jne	.L239
+.L219:
+	movl	%ebx, (%rdi)
+	addq	$456, %rsi
+	cmpl	%ebx, %ebp
+	jne	.L221
+.L222:
+	movq	16(%r12), %rsi
+	movq	16(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%r14, 16(%r12)
+	movl	%r13d, 24(%r12)
+.L211:
+	movl	28(%rsp), %ebx
+	cmpl	%ebx, 12(%r12)
+	jb	.L240
+.L223:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	.cfi_restore_state
+	cmpl	%eax, %edx
+	jnb	.L211
+	movl	%edx, %r13d
+	addl	%r13d, %r13d
+	cmpl	%eax, %r13d
+	jb	.L212
+	jmp	.L241
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	.cfi_restore_state
+	movl	%ebx, %edx
+	movq	(%r12), %rsi
+	movq	104(%r12), %rdi
+	imulq	$456, %rdx, %rdx
+	call	wavefrontReallocateWith@PLT
+	testq	%rax, %rax
+	je	.L224
+	movq	%rax, (%r12)
+	movl	%ebx, 12(%r12)
+	jmp	.L223
+	.p2align 4,,10
+	.p2align 3
+.L226:
+	movl	$-2128831035, %eax
+	jmp	.L217
+	.cfi_endproc
+.LFE42:
+	.size	wavefrontMTLReserve, .-wavefrontMTLReserve
+	.p2align 4
+	.globl	wavefrontMTLShrinkToFit
+	.type	wavefrontMTLShrinkToFit, @function
+wavefrontMTLShrinkToFit:
+.LFB43:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movl	8(%rdi), %ebp
+	cmpl	12(%rdi), %ebp
+	je	.L247
+	movq	(%rdi), %rsi
+	movq	%rdi, %rbx
+	movq	104(%rdi), %rdi
+	testl	%ebp, %ebp
+	jne	.L250
+	call	wavefrontFreeWith@PLT
+	xorl	%eax, %eax
+.L246:
+	movq	%rax, (%rbx)
+	movl	%ebp, 12(%rbx)
+.L247:
+	xorl	%eax, %eax
+.L242:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	.cfi_restore_state
+	movl	%ebp, %edx
+	imulq	$456, %rdx, %rdx
+	call	wavefrontReallocateWith@PLT
+	testq	%rax, %rax
+	jne	.L246
+	movl	$1, %eax
+	jmp	.L242
+	.cfi_endproc
+.LFE43:
+	.size	wavefrontMTLShrinkToFit, .-wavefrontMTLShrinkToFit
+	.p2align 4
+	.globl	wavefrontMTLAddMaterial
+	.type	wavefrontMTLAddMaterial, @function
+wavefrontMTLAddMaterial:
+.LFB44:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	movq	%rsi, %rdi
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	call	strlen@PLT
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	movq	%rax, 40(%rsp)
+	call	wavefrontMTLFindMaterialN
+	testl	%eax, %eax
+	jns	.L251
+	movq	104(%r12), %rax
+	movl	8(%r12), %ebx
+	movq	(%r12), %r9
+	movq	%rax, 8(%rsp)
+	cmpl	12(%r12), %ebx
+	jne	.L253
+	testl	%ebx, %ebx
+	jne	.L296
+	movl	$3648, %edx
+	movl	$8, %ebx
+	movq	%rax, %rdi
+.L254:
+	movq	%r9, %rsi
+	call	wavefrontReallocateWith@PLT
+	movq	%rax, %r9
+	testq	%rax, %rax
+	je	.L263
+.L256:
+	movq	104(%r12), %rax
+	movq	%r9, (%r12)
+	movl	%ebx, 12(%r12)
+	movl	8(%r12), %ebx
+	movq	%rax, 8(%rsp)
+.L253:
+	movl	24(%r12), %r14d
+	leal	1(%rbx), %esi
+	leal	(%rsi,%rsi), %eax
+	testl	%r14d, %r14d
+	jne	.L257
+	movl	$16, %r13d
+	movl	$64, %edx
+	cmpl	$16, %eax
+	jbe	.L259
+	.p2align 4,,10
+	.p2align 3
+.L261:
+	addl	%r13d, %r13d
+	cmpl	%eax, %r13d
+	jb	.L261
+	movl	%r13d, %edx
+	salq	$2, %rdx
+	cmpl	%r13d, %r14d
+	je	.L295
+.L259:
+	movq	8(%rsp), %rdi
+	movq	%rdx, %rsi
+	movq	%r9, 24(%rsp)
+	movq	%rdx, 16(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, %r15
+	testq	%rax, %rax
+	je	.L263
+	movq	16(%rsp), %rdx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	leal	-1(%r13), %r14d
+	call	memset@PLT
+	movq	24(%rsp), %rdx
+	xorl	%esi, %esi
+	testl	%ebx, %ebx
+	jne	.L270
+	.p2align 4,,10
+	.p2align 3
+.L271:
+	movq	16(%r12), %rsi
+	movq	8(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	8(%r12), %eax
+	movq	%r15, 16(%r12)
+	movl	%r13d, 24(%r12)
+	movq	(%r12), %r9
+	leal	1(%rax), %esi
+.L260:
+	movq	40(%rsp), %rax
+	testq	%rax, %rax
+	je	.L280
+	addq	%rbp, %rax
+	movq	%rbp, %rdx
+	movq	%rax, %rbx
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L273:
+	movzbl	(%rdx), %edi
+	addq	$1, %rdx
+	xorl	%edi, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%rbx, %rdx
+	jne	.L273
+	andl	%r14d, %eax
+	movl	%eax, %edx
+	leaq	(%r15,%rdx,4), %rdx
+	movl	(%rdx), %ecx
+	testl	%ecx, %ecx
+	je	.L274
+	.p2align 4,,10
+	.p2align 3
+.L297:
+	addl	$1, %eax
+.L272:
+	andl	%r14d, %eax
+	movl	%eax, %edx
+	leaq	(%r15,%rdx,4), %rdx
+	movl	(%rdx), %ecx
+	testl	%ecx, %ecx
+	jne	.L297
+.L274:
+	movl	%esi, (%rdx)
+	movl	8(%r12), %eax
+	xorl	%esi, %esi
+	leal	1(%rax), %edx
+	imulq	$456, %rax, %rax
+	movl	%edx, 8(%r12)
+	movl	$456, %edx
+	leaq	(%r9,%rax), %rbx
+	movq	%rbx, %rdi
+	call	memset@PLT
+	movq	%rbp, (%rbx)
+	xorl	%eax, %eax
+.L251:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L298:
+	.cfi_restore_state
+	addl	$1, %eax
+.L266:
+	andl	%r14d, %eax
+	movl	%eax, %edi
+	leaq	(%r15,%rdi,4), %rdi
+	movl	(%rdi), %r8d
+	testl	%r8d, %r8d
+	jne	.L298
+	movl	%esi, (%rdi)
+.L265:
+	addq	$456, %rdx
+	cmpl	%esi, %ebx
+	je	.L271
+.L270:
+	movq	(%rdx), %rdi
+	addl	$1, %esi
+	testq	%rdi, %rdi
+	je	.L265
+	movq	%rdx, 24(%rsp)
+	movl	%esi, 16(%rsp)
+	movq	%rdi, 32(%rsp)
+	call	strlen@PLT
+	movl	16(%rsp), %esi
+	movq	24(%rsp), %rdx
+	testq	%rax, %rax
+	je	.L279
+	movq	32(%rsp), %rdi
+	leaq	(%rdi,%rax), %r10
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	movzbl	(%rdi), %r9d
+	addq	$1, %rdi
+	xorl	%r9d, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%r10, %rdi
+	jne	.L267
+	jmp	.L266
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	movl	%r14d, %r13d
+	cmpl	%eax, %r14d
+	jb	.L261
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	movq	16(%r12), %r15
+	subl	$1, %r14d
+	jmp	.L260
+	.p2align 4,,10
+	.p2align 3
+.L296:
+	addl	%ebx, %ebx
+	jne	.L299
+	movq	%r9, %rsi
+	movq	%rax, %rdi
+	call	wavefrontFreeWith@PLT
+	xorl	%r9d, %r9d
+	jmp	.L256
+	.p2align 4,,10
+	.p2align 3
+.L263:
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L279:
+	.cfi_restore_state
+	movl	$-2128831035, %eax
+	jmp	.L266
+.L280:
+	movl	$-2128831035, %eax
+	jmp	.L272
+.L299:
+	movl	%ebx, %edx
+	movq	%rax, %rdi
+	imulq	$456, %rdx, %rdx
+	jmp	.L254
+	.cfi_endproc
+.LFE44:
+	.size	wavefrontMTLAddMaterial, .-wavefrontMTLAddMaterial
+	.p2align 4
+	.globl	wavefrontMTLInternTexture
+	.type	wavefrontMTLInternTexture, @function
+wavefrontMTLInternTexture:
+.LFB47:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	32(%rdi), %rax
+	movl	56(%rdi), %r12d
+	movq	%rdi, 16(%rsp)
+	movq	48(%rdi), %r13
+	movq	%rcx, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	testl	%r12d, %r12d
+	je	.L301
+	leal	-1(%r12), %eax
+	movl	%eax, 4(%rsp)
+	testq	%rdx, %rdx
+	je	.L315
+	movq	%rsi, %rax
+	movl	$-2128831035, %ecx
+	leaq	(%rdx,%rsi), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L303:
+	movzbl	(%rax), %edx
+	addq	$1, %rax
+	xorl	%edx, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%rsi, %rax
+	jne	.L303
+	jmp	.L302
+	.p2align 4,,10
+	.p2align 3
+.L331:
+	movq	8(%rsp), %rdi
+	leal	-1(%r15), %eax
+	movq	%rbx, %rdx
+	movq	(%rdi,%rax,8), %r12
+	movq	%rbp, %rdi
+	movq	%r12, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L304
+	cmpb	$0, (%r12,%rbx)
+	je	.L305
+.L304:
+	leal	1(%r14), %ecx
+.L302:
+	movl	4(%rsp), %r14d
+	andl	%ecx, %r14d
+	movl	%r14d, %eax
+	movl	0(%r13,%rax,4), %r15d
+	testl	%r15d, %r15d
+	jne	.L331
+.L301:
+	movq	16(%rsp), %rdi
+	movl	40(%rdi), %eax
+	leal	1(%rax), %esi
+	movl	%eax, 4(%rsp)
+	call	texturesReserve
+	testl	%eax, %eax
+	je	.L308
+.L310:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L308:
+	.cfi_restore_state
+	movq	16(%rsp), %r15
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%r15, %rdi
+	call	wavefrontMTLCopyString
+	movq	%rax, %rdi
+	testq	%rax, %rax
+	je	.L310
+	movl	56(%r15), %eax
+	movl	40(%r15), %r8d
+	movq	48(%r15), %rsi
+	movl	%eax, 4(%rsp)
+	leal	-1(%rax), %ecx
+	testq	%rbx, %rbx
+	je	.L316
+	movq	%rdi, %rdx
+	addq	%rdi, %rbx
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L312:
+	movzbl	(%rdx), %r9d
+	addq	$1, %rdx
+	xorl	%r9d, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%rbx, %rdx
+	jne	.L312
+	andl	%ecx, %eax
+	movl	%eax, %edx
+	leaq	(%rsi,%rdx,4), %rdx
+	movl	(%rdx), %r9d
+	testl	%r9d, %r9d
+	je	.L313
+	.p2align 4,,10
+	.p2align 3
+.L332:
+	addl	$1, %eax
+.L311:
+	andl	%ecx, %eax
+	movl	%eax, %edx
+	leaq	(%rsi,%rdx,4), %rdx
+	movl	(%rdx), %r9d
+	testl	%r9d, %r9d
+	jne	.L332
+.L313:
+	movq	16(%rsp), %rbx
+	addl	$1, %r8d
+	movl	%r8d, (%rdx)
+	movl	40(%rbx), %eax
+	movq	32(%rbx), %rdx
+	leal	1(%rax), %r15d
+	movl	%r15d, 40(%rbx)
+	movq	%rdi, (%rdx,%rax,8)
+	jmp	.L307
+	.p2align 4,,10
+	.p2align 3
+.L305:
+	testl	%r15d, %r15d
+	jle	.L301
+.L307:
+	movq	24(%rsp), %rax
+	movl	%r15d, (%rax)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L315:
+	.cfi_restore_state
+	movl	$-2128831035, %ecx
+	jmp	.L302
+.L316:
+	movl	$-2128831035, %eax
+	jmp	.L311
+	.cfi_endproc
+.LFE47:
+	.size	wavefrontMTLInternTexture, .-wavefrontMTLInternTexture
+	.p2align 4
+	.globl	wavefrontMTLInternMapOptions
+	.type	wavefrontMTLInternMapOptions, @function
+wavefrontMTLInternMapOptions:
+.LFB52:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	leaq	defaultMapOptions(%rip), %rsi
+	movq	%rbx, %rdi
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movl	$0, (%rdx)
+	movq	%rdx, 8(%rsp)
+	movl	$64, %edx
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L334
+	movl	88(%rbp), %r12d
+	testl	%r12d, %r12d
+	je	.L335
+	subl	$1, %r12d
+	movq	%rbx, %rax
+	leaq	64(%rbx), %rsi
+	movl	$-2128831035, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L336:
+	movzbl	(%rax), %edx
+	addq	$1, %rax
+	xorl	%edx, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%rsi, %rax
+	jne	.L336
+	movq	80(%rbp), %r14
+	andl	%r12d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %r13d
+	movq	%rax, %r15
+	testl	%r13d, %r13d
+	je	.L335
+	movq	64(%rbp), %rax
+	movq	%rax, (%rsp)
+	jmp	.L338
+	.p2align 4,,10
+	.p2align 3
+.L363:
+	leal	1(%r15), %ecx
+	andl	%r12d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %r13d
+	movq	%rax, %r15
+	testl	%r13d, %r13d
+	je	.L335
+.L338:
+	movq	(%rsp), %rdi
+	movl	%r13d, %eax
+	movl	$64, %edx
+	salq	$6, %rax
+	leaq	-64(%rdi,%rax), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L363
+	movq	8(%rsp), %rax
+	movl	%r13d, (%rax)
+.L334:
+	xorl	%eax, %eax
+.L333:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L335:
+	.cfi_restore_state
+	movl	72(%rbp), %eax
+	movq	%rbp, %rdi
+	leal	1(%rax), %esi
+	call	mapOptionsReserve
+	movl	%eax, %edx
+	movl	$1, %eax
+	testl	%edx, %edx
+	jne	.L333
+	movl	88(%rbp), %eax
+	leaq	64(%rbx), %rsi
+	movl	$-2128831035, %ecx
+	leal	-1(%rax), %r14d
+	movq	%rbx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L340:
+	movzbl	(%rax), %edx
+	addq	$1, %rax
+	xorl	%edx, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%rsi, %rax
+	jne	.L340
+	movq	80(%rbp), %r15
+	andl	%r14d, %ecx
+	movq	64(%rbp), %rdi
+	movl	%ecx, %eax
+	leaq	(%r15,%rax,4), %r13
+	movq	%rax, %r12
+	movq	%rdi, (%rsp)
+	movl	0(%r13), %eax
+	testl	%eax, %eax
+	jne	.L343
+	jmp	.L341
+	.p2align 4,,10
+	.p2align 3
+.L364:
+	leal	1(%r12), %ecx
+	andl	%r14d, %ecx
+	movl	%ecx, %eax
+	leaq	(%r15,%rax,4), %r13
+	movq	%rax, %r12
+	movl	0(%r13), %eax
+	testl	%eax, %eax
+	je	.L341
+.L343:
+	movq	(%rsp), %rdi
+	salq	$6, %rax
+	movl	$64, %edx
+	leaq	-64(%rdi,%rax), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L364
+	movl	0(%r13), %eax
+.L344:
+	movq	8(%rsp), %rbx
+	movl	%eax, (%rbx)
+	xorl	%eax, %eax
+	jmp	.L333
+	.p2align 4,,10
+	.p2align 3
+.L341:
+	movl	72(%rbp), %edx
+	movq	(%rsp), %r12
+	movdqu	(%rbx), %xmm0
+	movq	%rdx, %rax
+	salq	$6, %rdx
+	addq	%rdx, %r12
+	addl	$1, %eax
+	movups	%xmm0, (%r12)
+	movdqu	16(%rbx), %xmm1
+	movups	%xmm1, 16(%r12)
+	movdqu	32(%rbx), %xmm2
+	movups	%xmm2, 32(%r12)
+	movdqu	48(%rbx), %xmm3
+	movups	%xmm3, 48(%r12)
+	movl	%eax, 72(%rbp)
+	movl	%eax, 0(%r13)
+	jmp	.L344
+	.cfi_endproc
+.LFE52:
+	.size	wavefrontMTLInternMapOptions, .-wavefrontMTLInternMapOptions
+	.p2align 4
+	.type	materialCopy, @function
+materialCopy:
+.LFB59:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	movq	%rcx, %rsi
+	movl	$57, %ecx
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	mapOffsets(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	160(%rbp), %r13
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, (%rsp)
+	movq	%r12, %rdi
+	rep movsq
+	movq	%rdx, 8(%rsp)
+	movq	$0, (%r12)
+	jmp	.L376
+	.p2align 4,,10
+	.p2align 3
+.L385:
+	testl	%eax, %eax
+	je	.L383
+.L367:
+	movl	$0, 12(%rbx)
+	movq	$0, (%rbx)
+.L371:
+	addq	$8, %rbp
+	movl	$0, 8(%rbx)
+	cmpq	%rbp, %r13
+	je	.L384
+.L376:
+	movq	0(%rbp), %rbx
+	addq	%r12, %rbx
+	movl	12(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L385
+.L366:
+	testl	%eax, %eax
+	jne	.L367
+	movq	(%rbx), %r15
+	movq	$0, (%rbx)
+	testq	%r15, %r15
+	je	.L371
+	movq	%r15, %rdi
+	movl	8(%rbx), %r14d
+	call	strlen@PLT
+	movq	%rax, %rdx
+	testl	%r14d, %r14d
+	je	.L372
+	movq	(%rsp), %rdi
+	leaq	8(%rbx), %rcx
+	movq	%r15, %rsi
+	call	wavefrontMTLInternTexture
+	testl	%eax, %eax
+	je	.L373
+	movq	(%rbx), %rdx
+.L374:
+	testq	%rdx, %rdx
+	je	.L371
+	addq	$8, %rbp
+	cmpq	%rbp, %r13
+	jne	.L376
+.L384:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	.cfi_restore_state
+	movq	(%rsp), %rdi
+	movq	%r15, %rsi
+	call	wavefrontMTLCopyString
+	movq	%rax, %rdx
+	movq	%rax, (%rbx)
+	xorl	%eax, %eax
+	testq	%rdx, %rdx
+	sete	%al
+	jmp	.L374
+	.p2align 4,,10
+	.p2align 3
+.L383:
+	movq	8(%rsp), %rsi
+	salq	$6, %rdx
+	leaq	12(%rbx), %rax
+	movq	(%rsp), %rdi
+	movq	64(%rsi), %rcx
+	leaq	-64(%rcx,%rdx), %rsi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternMapOptions
+	jmp	.L366
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	movl	8(%rbx), %edx
+	movq	(%rsp), %rdi
+	leal	-1(%rdx), %ecx
+	movq	32(%rdi), %rdx
+	movq	(%rdx,%rcx,8), %rdx
+	movq	%rdx, (%rbx)
+	jmp	.L374
+	.cfi_endproc
+.LFE59:
+	.size	materialCopy, .-materialCopy
+	.p2align 4
+	.globl	wavefrontMTLMapOptions
+	.type	wavefrontMTLMapOptions, @function
+wavefrontMTLMapOptions:
+.LFB53:
+	.cfi_startproc
+	movl	12(%rsi), %eax
+	leaq	defaultMapOptions(%rip), %rdx
+	testl	%eax, %eax
+	je	.L386
+	movq	64(%rdi), %rdx
+	salq	$6, %rax
+	leaq	-64(%rdx,%rax), %rdx
+.L386:
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	wavefrontMTLMapOptions, .-wavefrontMTLMapOptions
+	.p2align 4
+	.globl	wavefrontMTLAppend
+	.type	wavefrontMTLAppend, @function
+wavefrontMTLAppend:
+.LFB55:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$2, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$104, %rsp
+	.cfi_def_cfa_offset 160
+	movl	92(%rsi), %esi
+	cmpl	%esi, 92(%rdi)
+	jne	.L390
+	movq	104(%rdi), %rcx
+	movq	%rdi, %rbp
+	cmpq	104(%r12), %rcx
+	jne	.L390
+	movl	8(%rdi), %r15d
+	movl	12(%rdi), %eax
+	movq	(%rdi), %r14
+	testl	%r15d, %r15d
+	jne	.L392
+	movl	40(%rdi), %esi
+	testl	%esi, %esi
+	jne	.L392
+	movl	72(%rdi), %edx
+	testl	%edx, %edx
+	jne	.L392
+	cmpq	$0, 96(%rdi)
+	jne	.L392
+	cmpl	%eax, 12(%r12)
+	jb	.L392
+	movq	%rcx, %rdi
+	movq	%r14, %rsi
+	call	wavefrontFreeWith@PLT
+	movq	16(%rbp), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%rbp), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	48(%rbp), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	64(%rbp), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	80(%rbp), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movdqu	(%r12), %xmm5
+	movups	%xmm5, 0(%rbp)
+	movdqu	16(%r12), %xmm6
+	movups	%xmm6, 16(%rbp)
+	movdqu	32(%r12), %xmm7
+	movups	%xmm7, 32(%rbp)
+	movdqu	48(%r12), %xmm5
+	movups	%xmm5, 48(%rbp)
+	movdqu	64(%r12), %xmm6
+	movups	%xmm6, 64(%rbp)
+	movdqu	80(%r12), %xmm7
+	movups	%xmm7, 80(%rbp)
+	movdqu	96(%r12), %xmm5
+	movups	%xmm5, 96(%rbp)
+.L528:
+	pxor	%xmm0, %xmm0
+	movq	$0, 88(%r12)
+	movups	%xmm0, 96(%r12)
+	movq	$0, 8(%r12)
+	movq	$0, 40(%r12)
+	movq	$0, 72(%r12)
+	movl	92(%rbp), %eax
+	movq	$0, (%r12)
+	movl	%eax, 92(%r12)
+	movq	104(%rbp), %rax
+	movq	$0, 16(%r12)
+	movl	$0, 24(%r12)
+	movq	$0, 32(%r12)
+	movq	$0, 48(%r12)
+	movl	$0, 56(%r12)
+	movq	$0, 64(%r12)
+	movq	$0, 80(%r12)
+	movq	%rax, 104(%r12)
+	xorl	%eax, %eax
+.L390:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	.cfi_restore_state
+	movl	8(%r12), %ebx
+	addl	%r15d, %ebx
+	cmpl	%ebx, %eax
+	jnb	.L393
+	addl	%eax, %eax
+	movq	%r14, %rsi
+	movq	%rcx, %rdi
+	cmpl	%ebx, %eax
+	cmovb	%ebx, %eax
+	movl	%eax, %edx
+	movq	%rdx, %r13
+	imulq	$456, %rdx, %rdx
+	call	wavefrontReallocateWith@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L411
+	movl	8(%rbp), %r15d
+	movq	104(%rbp), %rcx
+	movq	%rax, 0(%rbp)
+	movl	%r13d, 12(%rbp)
+.L393:
+	movl	24(%rbp), %edx
+	leal	(%rbx,%rbx), %eax
+	testl	%edx, %edx
+	je	.L530
+	cmpl	%eax, %edx
+	jnb	.L398
+	movl	%edx, %ebx
+	addl	%ebx, %ebx
+	cmpl	%eax, %ebx
+	jb	.L399
+	.p2align 4,,10
+	.p2align 3
+.L533:
+	cmpl	%ebx, %edx
+	je	.L398
+	movl	%ebx, %edx
+	salq	$2, %rdx
+.L397:
+	movq	%rdx, %rsi
+	movq	%rcx, %rdi
+	movq	%rdx, 16(%rsp)
+	movq	%rcx, 8(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L411
+	movq	16(%rsp), %rdx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	memset@PLT
+	xorl	%esi, %esi
+	testl	%r15d, %r15d
+	movq	8(%rsp), %rcx
+	leal	-1(%rbx), %edx
+	je	.L408
+	movl	%ebx, 16(%rsp)
+	movl	%r15d, %ebx
+	movl	%edx, %r15d
+	movq	%rbp, 24(%rsp)
+	movq	%r14, %rbp
+	movq	%r12, 32(%rsp)
+	movl	%esi, %r12d
+	movq	%rcx, 8(%rsp)
+	jmp	.L407
+	.p2align 4,,10
+	.p2align 3
+.L402:
+	addq	$456, %rbp
+	cmpl	%r12d, %ebx
+	je	.L531
+.L407:
+	movq	0(%rbp), %r14
+	addl	$1, %r12d
+	testq	%r14, %r14
+	je	.L402
+	movq	%r14, %rdi
+	call	strlen@PLT
+	testq	%rax, %rax
+	je	.L462
+	leaq	(%r14,%rax), %r9
+	movq	%r14, %rdi
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L404:
+	movzbl	(%rdi), %r8d
+	addq	$1, %rdi
+	xorl	%r8d, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%rdi, %r9
+	jne	.L404
+	jmp	.L403
+	.p2align 4,,10
+	.p2align 3
+.L530:
+	movl	$16, %ebx
+	cmpl	$16, %eax
+	jbe	.L532
+	.p2align 4,,10
+	.p2align 3
+.L399:
+	addl	%ebx, %ebx
+	cmpl	%eax, %ebx
+	jb	.L399
+	jmp	.L533
+	.p2align 4,,10
+	.p2align 3
+.L534:
+	addl	$1, %eax
+.L403:
+	andl	%r15d, %eax
+	movl	%eax, %edi
+	leaq	0(%r13,%rdi,4), %rdi
+	movl	(%rdi), %r14d
+	testl	%r14d, %r14d
+	jne	.L534
+	movl	%r12d, (%rdi)
+	addq	$456, %rbp
+	cmpl	%r12d, %ebx
+	jne	.L407
+.L531:
+	movq	8(%rsp), %rcx
+	movl	16(%rsp), %ebx
+	movq	24(%rsp), %rbp
+	movq	32(%rsp), %r12
+.L408:
+	movq	16(%rbp), %rsi
+	movq	%rcx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%r13, 16(%rbp)
+	movl	%ebx, 24(%rbp)
+.L398:
+	movl	40(%r12), %esi
+	movq	%rbp, %rdi
+	addl	40(%rbp), %esi
+	call	texturesReserve
+	testl	%eax, %eax
+	jne	.L411
+	movl	72(%r12), %esi
+	movq	%rbp, %rdi
+	addl	72(%rbp), %esi
+	call	mapOptionsReserve
+	testl	%eax, %eax
+	je	.L535
+.L411:
+	addq	$104, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L462:
+	.cfi_restore_state
+	movl	$-2128831035, %eax
+	jmp	.L403
+.L535:
+	movl	40(%r12), %eax
+	movq	104(%rbp), %rdi
+	movl	$4, %edx
+	leal	1(%rax), %esi
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	104(%rbp), %rdi
+	movl	$4, %edx
+	movq	%rax, 8(%rsp)
+	movl	72(%r12), %eax
+	leal	1(%rax), %esi
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	8(%rsp), %r8
+	movq	%rax, %r9
+	testq	%r8, %r8
+	je	.L469
+	testq	%rax, %rax
+	je	.L469
+	movq	96(%r12), %rcx
+	testq	%rcx, %rcx
+	je	.L412
+	movq	%rcx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L413:
+	movq	%rax, %rdx
+	movq	(%rax), %rax
+	testq	%rax, %rax
+	jne	.L413
+	movq	96(%rbp), %rax
+	testq	%rax, %rax
+	je	.L414
+	movq	(%rax), %rsi
+	movq	%rsi, (%rdx)
+	movq	%rcx, (%rax)
+.L415:
+	movq	$0, 96(%r12)
+.L412:
+	movl	92(%rbp), %eax
+	movl	8(%r12), %ebx
+	andl	$1, %eax
+	movl	%eax, 76(%rsp)
+	testl	%ebx, %ebx
+	je	.L422
+	movq	(%r12), %rax
+	xorl	%r15d, %r15d
+	movq	%rbp, 24(%rsp)
+	movq	%r9, %rbp
+	movq	%r12, 32(%rsp)
+	movl	%r15d, %r13d
+	movq	%r8, %r12
+	movl	%ebx, %r15d
+	movq	%rax, 16(%rsp)
+	leaq	160+mapOffsets(%rip), %r14
+	jmp	.L421
+	.p2align 4,,10
+	.p2align 3
+.L419:
+	addl	$1, %r13d
+	cmpl	%r15d, %r13d
+	jnb	.L536
+.L421:
+	movl	%r13d, %ebx
+	movq	16(%rsp), %rax
+	imulq	$456, %rbx, %rbx
+	addq	%rax, %rbx
+	movq	(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L419
+	movq	%rsi, %rdi
+	movq	%rsi, 8(%rsp)
+	call	strlen@PLT
+	movq	8(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLFindMaterialN
+	testl	%eax, %eax
+	jns	.L419
+	leaq	mapOffsets(%rip), %rax
+	.p2align 4,,10
+	.p2align 3
+.L420:
+	movq	(%rax), %rdx
+	addq	$8, %rax
+	addq	%rbx, %rdx
+	movl	8(%rdx), %esi
+	movl	$1, (%r12,%rsi,4)
+	movl	12(%rdx), %edx
+	movl	$1, 0(%rbp,%rdx,4)
+	cmpq	%r14, %rax
+	jne	.L420
+	movq	32(%rsp), %rax
+	movl	8(%rax), %r15d
+	jmp	.L419
+.L536:
+	movq	%r12, %r8
+	movq	%rbp, %r9
+	movq	32(%rsp), %r12
+	movq	24(%rsp), %rbp
+.L422:
+	movl	$0, (%r8)
+	xorl	%r15d, %r15d
+	movl	$0, (%r9)
+	movl	72(%r12), %ecx
+	testl	%ecx, %ecx
+	je	.L418
+	movq	%rbp, %rsi
+	movq	%r8, 48(%rsp)
+	movl	%r15d, %ebp
+	movq	%r12, %rdi
+	jmp	.L417
+	.p2align 4,,10
+	.p2align 3
+.L425:
+	cmpl	%ecx, %ebp
+	jnb	.L537
+.L417:
+	leal	1(%rbp), %edx
+	movl	%ebp, %eax
+	movq	%rdx, %rbp
+	leaq	(%r9,%rdx,4), %rdx
+	movl	(%rdx), %ebx
+	testl	%ebx, %ebx
+	je	.L425
+	movl	%eax, %r14d
+	movl	88(%rsi), %eax
+	movl	$-2128831035, %ebx
+	salq	$6, %r14
+	addq	64(%rdi), %r14
+	leal	-1(%rax), %r12d
+	movq	%r14, %rcx
+	leaq	64(%r14), %r8
+	.p2align 4,,10
+	.p2align 3
+.L426:
+	movzbl	(%rcx), %eax
+	addq	$1, %rcx
+	xorl	%eax, %ebx
+	imull	$16777619, %ebx, %ebx
+	cmpq	%rcx, %r8
+	jne	.L426
+	movq	80(%rsi), %r8
+	andl	%r12d, %ebx
+	movq	64(%rsi), %r13
+	movl	%ebx, %eax
+	leaq	(%r8,%rax,4), %r15
+	movl	(%r15), %eax
+	testl	%eax, %eax
+	je	.L427
+	movq	%rdx, 16(%rsp)
+	movl	%ebx, %edx
+	movq	%r15, %rbx
+	movl	%ebp, 8(%rsp)
+	movl	%edx, %r15d
+	movq	%r8, %rbp
+	movq	%r9, 24(%rsp)
+	movq	%rsi, 32(%rsp)
+	movq	%rdi, 40(%rsp)
+	jmp	.L429
+	.p2align 4,,10
+	.p2align 3
+.L539:
+	leal	1(%r15), %ecx
+	andl	%r12d, %ecx
+	movl	%ecx, %eax
+	leaq	0(%rbp,%rax,4), %rbx
+	movq	%rax, %r15
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	je	.L538
+.L429:
+	salq	$6, %rax
+	movl	$64, %edx
+	movq	%r14, %rdi
+	leaq	-64(%r13,%rax), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L539
+	movl	8(%rsp), %ebp
+	movq	16(%rsp), %rdx
+	movq	24(%rsp), %r9
+	movq	32(%rsp), %rsi
+	movq	40(%rsp), %rdi
+	movl	(%rbx), %eax
+.L430:
+	movl	%eax, (%rdx)
+	movl	72(%rdi), %ecx
+	jmp	.L425
+.L538:
+	movl	8(%rsp), %ebp
+	movq	16(%rsp), %rdx
+	movq	%rbx, %r15
+	movq	24(%rsp), %r9
+	movq	32(%rsp), %rsi
+	movq	40(%rsp), %rdi
+.L427:
+	movl	72(%rsi), %r8d
+	movdqu	(%r14), %xmm1
+	movq	%r8, %rax
+	salq	$6, %r8
+	leaq	0(%r13,%r8), %rcx
+	addl	$1, %eax
+	movups	%xmm1, (%rcx)
+	movdqu	16(%r14), %xmm2
+	movups	%xmm2, 16(%rcx)
+	movdqu	32(%r14), %xmm3
+	movups	%xmm3, 32(%rcx)
+	movdqu	48(%r14), %xmm4
+	movups	%xmm4, 48(%rcx)
+	movl	%eax, 72(%rsi)
+	movl	%eax, (%r15)
+	jmp	.L430
+.L537:
+	movq	48(%rsp), %r8
+	movq	%rsi, %rbp
+	movq	%rdi, %r12
+.L418:
+	movl	40(%r12), %ecx
+	testl	%ecx, %ecx
+	je	.L540
+	movq	104(%rbp), %rax
+	movq	%r9, 88(%rsp)
+	xorl	%r15d, %r15d
+	movq	$0, 24(%rsp)
+	movl	%r15d, %edx
+	movq	%rax, 80(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%rbp, %r8
+	.p2align 4,,10
+	.p2align 3
+.L423:
+	movq	32(%r12), %rax
+	movq	24(%rsp), %rsi
+	movq	64(%rsp), %rbx
+	movq	(%rax,%rsi,8), %rsi
+	leal	1(%rdx), %eax
+	leaq	(%rbx,%rax,4), %r9
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rdx
+	movl	(%r9), %r11d
+	testl	%r11d, %r11d
+	je	.L541
+	movq	%rsi, %rdi
+	movq	%r8, 16(%rsp)
+	movq	%r9, 32(%rsp)
+	movq	%rsi, 8(%rsp)
+	movl	%eax, 40(%rsp)
+	call	strlen@PLT
+	movq	16(%rsp), %r8
+	movq	8(%rsp), %rsi
+	movq	%rax, %r15
+	movq	32(%rsp), %r9
+	movl	40(%rsp), %edx
+	movl	56(%r8), %r10d
+	movq	32(%r8), %rax
+	movq	48(%r8), %r14
+	testl	%r10d, %r10d
+	movq	%rax, 16(%rsp)
+	leal	-1(%r10), %r13d
+	je	.L435
+	testq	%r15, %r15
+	je	.L466
+	movq	%rsi, %r11
+	leaq	(%r15,%rsi), %rbp
+	movl	$-2128831035, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L437:
+	movzbl	(%r11), %eax
+	addq	$1, %r11
+	xorl	%eax, %ebx
+	imull	$16777619, %ebx, %ebx
+	cmpq	%rbp, %r11
+	jne	.L437
+.L436:
+	andl	%r13d, %ebx
+	movl	%ebx, %r10d
+	movl	(%r14,%r10,4), %ebp
+	testl	%ebp, %ebp
+	je	.L435
+	movl	%edx, 32(%rsp)
+	movq	%r9, 40(%rsp)
+	movq	%rsi, 8(%rsp)
+	movq	%r8, 48(%rsp)
+	movq	%r12, 56(%rsp)
+	movl	%ebp, %r12d
+	movl	%ebx, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L440:
+	movq	16(%rsp), %rdx
+	leal	-1(%r12), %eax
+	movq	8(%rsp), %rdi
+	movq	(%rdx,%rax,8), %rbx
+	movq	%r15, %rdx
+	movq	%rbx, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L438
+	cmpb	$0, (%rbx,%r15)
+	je	.L439
+.L438:
+	leal	1(%rbp), %ecx
+	andl	%r13d, %ecx
+	movl	%ecx, %eax
+	movl	(%r14,%rax,4), %r12d
+	movq	%rax, %rbp
+	testl	%r12d, %r12d
+	jne	.L440
+	movl	32(%rsp), %edx
+	movq	40(%rsp), %r9
+	movq	8(%rsp), %rsi
+	movq	48(%rsp), %r8
+	movq	56(%rsp), %r12
+.L435:
+	movl	40(%r8), %ebp
+	testq	%r15, %r15
+	je	.L467
+	movq	%rsi, %rbx
+	leaq	(%r15,%rsi), %rax
+	movl	$-2128831035, %r10d
+	.p2align 4,,10
+	.p2align 3
+.L443:
+	movzbl	(%rbx), %ecx
+	addq	$1, %rbx
+	xorl	%ecx, %r10d
+	imull	$16777619, %r10d, %r10d
+	cmpq	%rax, %rbx
+	jne	.L443
+	jmp	.L442
+	.p2align 4,,10
+	.p2align 3
+.L542:
+	addl	$1, %r10d
+.L442:
+	andl	%r13d, %r10d
+	movl	%r10d, %eax
+	leaq	(%r14,%rax,4), %rax
+	movl	(%rax), %edi
+	testl	%edi, %edi
+	jne	.L542
+	addl	$1, %ebp
+	movq	16(%rsp), %rbx
+	movl	%ebp, (%rax)
+	movl	40(%r8), %eax
+	leal	1(%rax), %ecx
+	movl	%ecx, 40(%r8)
+	movq	%rsi, (%rbx,%rax,8)
+	movl	%ecx, (%r9)
+.L529:
+	movl	40(%r12), %ecx
+.L434:
+	cmpl	%ecx, %edx
+	jb	.L423
+	movq	%r8, %rbp
+	movq	88(%rsp), %r9
+	movq	64(%rsp), %r8
+.L424:
+	movl	8(%r12), %eax
+	xorl	%esi, %esi
+	movl	%eax, 32(%rsp)
+	testl	%eax, %eax
+	je	.L432
+	movq	%r8, 88(%rsp)
+	movl	%esi, %edx
+	movq	%r9, %r13
+	movq	%r12, 24(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L431:
+	movq	24(%rsp), %rax
+	movl	%edx, %r15d
+	imulq	$456, %r15, %r15
+	addq	(%rax), %r15
+	movq	(%r15), %r12
+	testq	%r12, %r12
+	je	.L447
+	movq	%r12, %rdi
+	movl	%edx, 8(%rsp)
+	call	strlen@PLT
+	movq	16(%rbp), %r9
+	movl	8(%rsp), %edx
+	movq	%rax, %r14
+	movq	0(%rbp), %rax
+	testq	%r14, %r14
+	movq	%rax, 16(%rsp)
+	movl	24(%rbp), %eax
+	leal	-1(%rax), %edi
+	je	.L468
+	movq	%r12, %r10
+	leaq	(%r14,%r12), %r11
+	movl	$-2128831035, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L449:
+	movzbl	(%r10), %eax
+	addq	$1, %r10
+	xorl	%eax, %ebx
+	imull	$16777619, %ebx, %ebx
+	cmpq	%r11, %r10
+	jne	.L449
+.L448:
+	andl	%edi, %ebx
+	movl	%ebx, %eax
+	leaq	(%r9,%rax,4), %rax
+	movl	(%rax), %r10d
+	testl	%r10d, %r10d
+	je	.L450
+	movl	%edx, 40(%rsp)
+	movq	%r12, 8(%rsp)
+	movq	%r13, 48(%rsp)
+	movq	16(%rsp), %r13
+	movq	%r15, 56(%rsp)
+	movq	%r9, %r15
+	movq	%rbp, 64(%rsp)
+	movl	%ebx, %ebp
+	movl	%edi, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L453:
+	leal	-1(%r10), %eax
+	movq	8(%rsp), %rdi
+	movq	%r14, %rdx
+	imulq	$456, %rax, %rax
+	movq	0(%r13,%rax), %r12
+	movq	%r12, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L451
+	cmpb	$0, (%r12,%r14)
+	je	.L452
+.L451:
+	leal	1(%rbp), %ecx
+	andl	%ebx, %ecx
+	movl	%ecx, %eax
+	movq	%rax, %rbp
+	leaq	(%r15,%rax,4), %rax
+	movl	(%rax), %r10d
+	testl	%r10d, %r10d
+	jne	.L453
+	movl	40(%rsp), %edx
+	movq	48(%rsp), %r13
+	movq	56(%rsp), %r15
+	movq	64(%rsp), %rbp
+.L450:
+	movq	88(%rsp), %r8
+	leaq	mapOffsets(%rip), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	movq	(%rsi), %rcx
+	addq	%r15, %rcx
+	movl	12(%rcx), %edi
+	movl	0(%r13,%rdi,4), %edi
+	movl	%edi, 12(%rcx)
+	movl	8(%rcx), %edi
+	testl	%edi, %edi
+	je	.L458
+	movl	(%r8,%rdi,4), %edi
+	leal	-1(%rdi), %r9d
+	movl	%edi, 8(%rcx)
+	movq	32(%rbp), %rdi
+	movq	(%rdi,%r9,8), %rdi
+	movq	%rdi, (%rcx)
+.L458:
+	addq	$8, %rsi
+	leaq	160+mapOffsets(%rip), %rcx
+	cmpq	%rcx, %rsi
+	jne	.L455
+	movl	8(%rbp), %r10d
+	movq	16(%rsp), %rsi
+	movl	$57, %ecx
+	leal	1(%r10), %r9d
+	imulq	$456, %r10, %r10
+	movl	%r9d, 8(%rbp)
+	addq	%r10, %rsi
+	movq	%rsi, %rdi
+	movq	%r15, %rsi
+	rep movsq
+	movl	%r9d, (%rax)
+	movq	24(%rsp), %rax
+	movl	8(%rax), %eax
+	movl	%eax, 32(%rsp)
+.L447:
+	movl	32(%rsp), %eax
+	addl	$1, %edx
+	cmpl	%eax, %edx
+	jb	.L431
+	movq	88(%rsp), %r8
+	movq	24(%rsp), %r12
+	movq	%r13, %r9
+.L432:
+	movq	80(%rsp), %rdi
+	movq	%r8, %rsi
+	movq	%r9, 8(%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	104(%rbp), %rdi
+	movq	8(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	(%r12), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	16(%r12), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%r12), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	48(%r12), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	64(%r12), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	80(%r12), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	jmp	.L528
+	.p2align 4,,10
+	.p2align 3
+.L452:
+	movl	76(%rsp), %ecx
+	movl	40(%rsp), %edx
+	movq	8(%rsp), %r12
+	movq	48(%rsp), %r13
+	movq	56(%rsp), %r15
+	movq	64(%rsp), %rbp
+	testl	%ecx, %ecx
+	jne	.L447
+	movq	80(%rsp), %rdi
+	movq	%r12, %rsi
+	movl	%edx, 8(%rsp)
+	leaq	mapOffsets(%rip), %rbx
+	call	wavefrontFreeWith@PLT
+	movl	8(%rsp), %r12d
+	jmp	.L457
+	.p2align 4,,10
+	.p2align 3
+.L456:
+	addq	$8, %rbx
+	leaq	160+mapOffsets(%rip), %rax
+	cmpq	%rax, %rbx
+	je	.L543
+.L457:
+	movq	(%rbx), %rax
+	addq	%r15, %rax
+	movl	8(%rax), %edx
+	testl	%edx, %edx
+	jne	.L456
+	movq	(%rax), %rsi
+	movq	104(%rbp), %rdi
+	call	wavefrontFreeWith@PLT
+	jmp	.L456
+	.p2align 4,,10
+	.p2align 3
+.L439:
+	movl	%r12d, %ebp
+	movl	32(%rsp), %edx
+	movq	40(%rsp), %r9
+	movq	8(%rsp), %rsi
+	movq	48(%rsp), %r8
+	movq	56(%rsp), %r12
+	testl	%ebp, %ebp
+	jle	.L435
+	movl	%ebp, (%r9)
+	movl	76(%rsp), %r9d
+	testl	%r9d, %r9d
+	jne	.L529
+.L441:
+	movq	80(%rsp), %rdi
+	movq	%r8, 16(%rsp)
+	movl	%edx, 8(%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	16(%rsp), %r8
+	movl	40(%r12), %ecx
+	movl	8(%rsp), %edx
+	movq	104(%r8), %rax
+	movq	%rax, 80(%rsp)
+	jmp	.L434
+	.p2align 4,,10
+	.p2align 3
+.L541:
+	movl	76(%rsp), %r10d
+	testl	%r10d, %r10d
+	jne	.L434
+	jmp	.L441
+.L543:
+	movq	24(%rsp), %rax
+	movl	%r12d, %edx
+	movl	8(%rax), %eax
+	movl	%eax, 32(%rsp)
+	movq	104(%rbp), %rax
+	movq	%rax, 80(%rsp)
+	jmp	.L447
+.L468:
+	movl	$-2128831035, %ebx
+	jmp	.L448
+.L532:
+	movl	$64, %edx
+	jmp	.L397
+.L466:
+	movl	$-2128831035, %ebx
+	jmp	.L436
+.L469:
+	movq	104(%rbp), %rdi
+	movq	%r8, %rsi
+	movq	%r9, 8(%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	104(%rbp), %rdi
+	movq	8(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	jmp	.L411
+.L467:
+	movl	$-2128831035, %r10d
+	jmp	.L442
+.L414:
+	movq	%rcx, 96(%rbp)
+	jmp	.L415
+.L540:
+	movq	104(%rbp), %rax
+	movq	%rax, 80(%rsp)
+	jmp	.L424
+	.cfi_endproc
+.LFE55:
+	.size	wavefrontMTLAppend, .-wavefrontMTLAppend
+	.p2align 4
+	.globl	wavefrontMaterialEqual
+	.type	wavefrontMaterialEqual, @function
+wavefrontMaterialEqual:
+.LFB57:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdx, %r14
+	movl	$124, %edx
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	leaq	8(%rcx), %rsi
+	leaq	8(%rbx), %rdi
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	call	memcmp@PLT
+	movl	%eax, 28(%rsp)
+	testl	%eax, %eax
+	jne	.L556
+	cmpq	%r14, %r13
+	je	.L546
+	leaq	mapOffsets(%rip), %r12
+	leaq	160(%r12), %r15
+	.p2align 4,,10
+	.p2align 3
+.L553:
+	movq	(%r12), %rax
+	leaq	(%rbx,%rax), %r8
+	leaq	0(%rbp,%rax), %rdx
+	movq	(%rdx), %rsi
+	movq	(%r8), %rdi
+	cmpq	%rsi, %rdi
+	je	.L547
+	movq	%r8, 16(%rsp)
+	movq	%rdx, 8(%rsp)
+	testq	%rsi, %rsi
+	je	.L544
+	testq	%rdi, %rdi
+	je	.L544
+	call	strcmp@PLT
+	movq	8(%rsp), %rdx
+	movq	16(%rsp), %r8
+	testl	%eax, %eax
+	je	.L547
+.L544:
+	movl	28(%rsp), %eax
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L547:
+	.cfi_restore_state
+	movl	12(%rdx), %eax
+	testl	%eax, %eax
+	je	.L574
+	movq	64(%r14), %rdx
+	salq	$6, %rax
+	leaq	-64(%rdx,%rax), %rsi
+	movl	12(%r8), %eax
+	testl	%eax, %eax
+	jne	.L549
+.L575:
+	leaq	defaultMapOptions(%rip), %rdi
+.L551:
+	movl	$64, %edx
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L544
+	addq	$8, %r12
+	cmpq	%r15, %r12
+	jne	.L553
+.L573:
+	movl	$1, 28(%rsp)
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L574:
+	movl	12(%r8), %eax
+	leaq	defaultMapOptions(%rip), %rsi
+	testl	%eax, %eax
+	je	.L575
+.L549:
+	movq	64(%r13), %rdx
+	salq	$6, %rax
+	leaq	-64(%rdx,%rax), %rdi
+	jmp	.L551
+	.p2align 4,,10
+	.p2align 3
+.L556:
+	movl	$0, 28(%rsp)
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L546:
+	leaq	mapOffsets(%rip), %r14
+	leaq	160(%r14), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L555:
+	movq	(%r14), %rax
+	leaq	(%rbx,%rax), %r15
+	leaq	0(%rbp,%rax), %r13
+	movq	0(%r13), %rsi
+	movq	(%r15), %rdi
+	cmpq	%rdi, %rsi
+	je	.L554
+	testq	%rdi, %rdi
+	je	.L544
+	testq	%rsi, %rsi
+	je	.L544
+	call	strcmp@PLT
+	leaq	160+mapOffsets(%rip), %rdx
+	testl	%eax, %eax
+	jne	.L544
+.L554:
+	movl	12(%r15), %eax
+	cmpl	%eax, 12(%r13)
+	jne	.L544
+	addq	$8, %r14
+	cmpq	%rdx, %r14
+	jne	.L555
+	jmp	.L573
+	.cfi_endproc
+.LFE57:
+	.size	wavefrontMaterialEqual, .-wavefrontMaterialEqual
+	.p2align 4
+	.globl	wavefrontMaterialHash
+	.type	wavefrontMaterialHash, @function
+wavefrontMaterialHash:
+.LFB58:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	8(%rsi), %rax
+	movl	$-2128831035, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	leaq	132(%rsi), %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L577:
+	movzbl	(%rax), %ecx
+	addq	$1, %rax
+	movl	%ecx, %edx
+	xorl	%r15d, %edx
+	imull	$16777619, %edx, %r15d
+	cmpq	%rsi, %rax
+	jne	.L577
+	xorl	%ebp, %ebp
+	leaq	mapOffsets(%rip), %r14
+	.p2align 4,,10
+	.p2align 3
+.L583:
+	movq	(%r14,%rbp,8), %r12
+	addq	%r13, %r12
+	movq	(%r12), %rbx
+	testq	%rbx, %rbx
+	je	.L578
+	movl	%r15d, %edx
+	movq	%rbx, %rdi
+	xorl	%ebp, %edx
+	imull	$16777619, %edx, %r15d
+	call	strlen@PLT
+	cmpq	$-1, %rax
+	je	.L579
+	leaq	1(%rax,%rbx), %rcx
+.L580:
+	movzbl	(%rbx), %eax
+	addq	$1, %rbx
+	xorl	%r15d, %eax
+	imull	$16777619, %eax, %r15d
+	cmpq	%rcx, %rbx
+	jne	.L580
+.L579:
+	movl	12(%r12), %ecx
+	leaq	defaultMapOptions(%rip), %rax
+	testl	%ecx, %ecx
+	je	.L581
+	movq	8(%rsp), %rax
+	salq	$6, %rcx
+	movq	64(%rax), %rax
+	leaq	-64(%rax,%rcx), %rax
+.L581:
+	leaq	64(%rax), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L582:
+	movzbl	(%rax), %ecx
+	addq	$1, %rax
+	xorl	%r15d, %ecx
+	imull	$16777619, %ecx, %r15d
+	cmpq	%rsi, %rax
+	jne	.L582
+.L578:
+	addq	$1, %rbp
+	cmpq	$20, %rbp
+	jne	.L583
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	movl	%r15d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE58:
+	.size	wavefrontMaterialHash, .-wavefrontMaterialHash
+	.p2align 4
+	.globl	wavefrontMTLUpdate
+	.type	wavefrontMTLUpdate, @function
+wavefrontMTLUpdate:
+.LFB62:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+	testq	%rdx, %rdx
+	movl	$56, %edx
+	leaq	80(%rsp), %rax
+	cmove	%rax, %r12
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	memset@PLT
+	movq	104(%rbx), %rdi
+	movl	8(%rbx), %ebp
+	movq	%rdi, 48(%r12)
+	leal	1(%rbp), %esi
+	salq	$2, %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	104(%rbx), %rdi
+	movl	$1, %edx
+	movq	%rax, 16(%rsp)
+	movq	%rax, %r15
+	movl	8(%r14), %eax
+	leal	1(%rax), %esi
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	%rax, (%rsp)
+	testq	%r15, %r15
+	je	.L599
+	testq	%rax, %rax
+	je	.L599
+	testl	%ebp, %ebp
+	je	.L725
+	movq	16(%rsp), %rdi
+	movl	%ebp, %eax
+	xorl	%r15d, %r15d
+	movl	%ebp, 44(%rsp)
+	movq	%r12, 48(%rsp)
+	movq	%r15, %rbp
+	leaq	(%rdi,%rax,4), %rax
+	movl	$0, 24(%rsp)
+	movq	%rdi, %r12
+	movq	%rax, 8(%rsp)
+	movl	$0, 32(%rsp)
+	movl	$0, 40(%rsp)
+	jmp	.L609
+	.p2align 4,,10
+	.p2align 3
+.L603:
+	movq	%r15, %rdi
+	call	strlen@PLT
+	movq	%r15, %rsi
+	movq	%r14, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLFindMaterialN
+	movl	%eax, (%r12)
+	cmpl	$-2, %eax
+	je	.L604
+	testl	%eax, %eax
+	js	.L726
+	movslq	%eax, %r15
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	imulq	$456, %r15, %rcx
+	addq	(%r14), %rcx
+	call	wavefrontMaterialEqual
+	movl	%eax, %edx
+	movq	(%rsp), %rax
+	addq	%r15, %rax
+	testl	%edx, %edx
+	je	.L608
+	movb	$1, (%rax)
+	.p2align 4,,10
+	.p2align 3
+.L606:
+	addq	$456, %rbp
+	addq	$4, %r12
+	cmpq	%r12, 8(%rsp)
+	je	.L727
+.L609:
+	movq	(%rbx), %r13
+	addq	%rbp, %r13
+	movq	0(%r13), %r15
+	testq	%r15, %r15
+	jne	.L603
+	movl	$-2, (%r12)
+.L604:
+	addl	$1, 40(%rsp)
+	jmp	.L606
+	.p2align 4,,10
+	.p2align 3
+.L726:
+	addl	$1, 32(%rsp)
+	jmp	.L606
+	.p2align 4,,10
+	.p2align 3
+.L608:
+	addl	$1, 24(%rsp)
+	movb	$2, (%rax)
+	jmp	.L606
+	.p2align 4,,10
+	.p2align 3
+.L727:
+	movl	32(%rsp), %eax
+	movl	24(%rsp), %edi
+	movl	44(%rsp), %ebp
+	movq	48(%rsp), %r12
+	addl	$1, %eax
+	leal	1(%rdi), %esi
+	salq	$2, %rax
+	movq	%rsi, %rdi
+	leaq	0(,%rsi,4), %r15
+	movq	%rax, 24(%rsp)
+.L601:
+	movl	8(%r14), %r11d
+	testl	%r11d, %r11d
+	je	.L662
+	movq	(%rsp), %rsi
+	movl	%r11d, %ecx
+	xorl	%edx, %edx
+	xorl	%r11d, %r11d
+	movq	%rsi, %rax
+	addq	%rsi, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L612:
+	cmpb	$0, (%rax)
+	jne	.L611
+	movq	(%r14), %rsi
+	cmpq	$1, (%rsi,%rdx)
+	sbbl	$-1, %r11d
+.L611:
+	addq	$1, %rax
+	addq	$456, %rdx
+	cmpq	%rax, %rcx
+	jne	.L612
+	leal	1(%r11), %r13d
+	leal	(%r11,%rdi), %esi
+	salq	$2, %r13
+.L610:
+	movl	40(%rbx), %eax
+	imulq	$456, %rsi, %rsi
+	movq	104(%rbx), %rdi
+	movl	%r11d, 56(%rsp)
+	movl	%eax, 44(%rsp)
+	movl	72(%rbx), %eax
+	movl	%eax, 48(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	104(%rbx), %rdi
+	movq	%r13, %rsi
+	movq	%rax, 8(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	104(%rbx), %rdi
+	movq	24(%rsp), %rsi
+	movq	%rax, (%r12)
+	call	wavefrontAllocateWith@PLT
+	movq	104(%rbx), %rdi
+	movq	%r15, %rsi
+	movq	%rax, 16(%r12)
+	call	wavefrontAllocateWith@PLT
+	cmpq	$0, 8(%rsp)
+	movq	%rax, 32(%r12)
+	je	.L665
+	cmpq	$0, (%r12)
+	je	.L665
+	cmpq	$0, 16(%r12)
+	je	.L665
+	testq	%rax, %rax
+	je	.L665
+	movl	40(%rsp), %eax
+	movl	56(%rsp), %r11d
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	subl	%eax, %esi
+	movl	%r11d, 24(%rsp)
+	addl	%r11d, %esi
+	cmpl	%r11d, %eax
+	cmovnb	%ebp, %esi
+	call	wavefrontMTLReserve
+	movl	24(%rsp), %r11d
+	testl	%eax, %eax
+	movl	%eax, 40(%rsp)
+	sete	%cl
+	testl	%ebp, %ebp
+	setne	%r9b
+	andb	%cl, %r9b
+	je	.L667
+	movq	%rbx, 24(%rsp)
+	movq	%r14, %r15
+	movl	%ebp, %ebx
+	movq	(%rsp), %r14
+	movq	%r12, 64(%rsp)
+	xorl	%r13d, %r13d
+	movq	16(%rsp), %r12
+	xorl	%eax, %eax
+	movl	%r11d, 56(%rsp)
+	movl	%r9d, %ebp
+	jmp	.L617
+	.p2align 4,,10
+	.p2align 3
+.L728:
+	movslq	%ecx, %rsi
+	xorl	%edi, %edi
+	movl	%ebp, %ecx
+	cmpb	$2, (%r14,%rsi)
+	jne	.L616
+	leal	1(%rax), %ecx
+	movq	8(%rsp), %rdi
+	movq	%r15, %rdx
+	movl	%ecx, 40(%rsp)
+	imulq	$456, %rsi, %rcx
+	movl	%eax, %esi
+	addq	(%r15), %rcx
+	imulq	$456, %rsi, %rsi
+	addq	%rdi, %rsi
+	movq	24(%rsp), %rdi
+	call	materialCopy
+	testl	%eax, %eax
+	movl	%eax, %edi
+	movl	40(%rsp), %eax
+	sete	%cl
+.L616:
+	addl	$1, %r13d
+	cmpl	%ebx, %r13d
+	jnb	.L719
+.L729:
+	testb	%cl, %cl
+	je	.L719
+.L617:
+	movl	%r13d, %ecx
+	movl	(%r12,%rcx,4), %ecx
+	testl	%ecx, %ecx
+	jns	.L728
+	addl	$1, %r13d
+	movl	%ebp, %ecx
+	xorl	%edi, %edi
+	cmpl	%ebx, %r13d
+	jb	.L729
+	.p2align 4,,10
+	.p2align 3
+.L719:
+	movl	%edi, 40(%rsp)
+	movl	%ebx, %ebp
+	movl	56(%rsp), %r11d
+	movq	%r15, %r14
+	movq	24(%rsp), %rbx
+	movq	64(%rsp), %r12
+.L615:
+	movl	8(%r14), %edi
+	testl	%edi, %edi
+	je	.L619
+	testb	%cl, %cl
+	je	.L619
+	movl	%r11d, 56(%rsp)
+	xorl	%r8d, %r8d
+	movl	%ebp, 40(%rsp)
+	movl	%r8d, %ebp
+	movq	%r12, 24(%rsp)
+	movq	%r14, %r12
+	.p2align 4,,10
+	.p2align 3
+.L622:
+	movl	%ebp, %edx
+	movq	(%rsp), %rsi
+	imulq	$456, %rdx, %rcx
+	addq	(%r12), %rcx
+	movq	(%rcx), %r14
+	cmpb	$0, (%rsi,%rdx)
+	setne	%dl
+	testq	%r14, %r14
+	sete	%r11b
+	xorl	%esi, %esi
+	orb	%r11b, %dl
+	je	.L730
+.L620:
+	addl	$1, %ebp
+	cmpl	%edi, %ebp
+	jnb	.L721
+	testb	%dl, %dl
+	jne	.L622
+.L721:
+	movl	40(%rsp), %ebp
+	movl	56(%rsp), %r11d
+	movl	%esi, 40(%rsp)
+	movq	24(%rsp), %r12
+.L619:
+	cmpl	$0, 40(%rsp)
+	jne	.L671
+	movl	%ebp, %r9d
+	xorl	%r8d, %r8d
+	leaq	160+mapOffsets(%rip), %r14
+	xorl	%r13d, %r13d
+	testl	%ebp, %ebp
+	je	.L625
+	movq	%r8, %r15
+	movl	%r11d, 72(%rsp)
+	movl	%r13d, %r8d
+	movq	%rbx, %r13
+	movl	%ebp, 76(%rsp)
+	movq	%r9, 24(%rsp)
+	jmp	.L641
+	.p2align 4,,10
+	.p2align 3
+.L732:
+	movq	(%rsp), %rbx
+	movslq	%ecx, %rax
+	cmpb	$1, (%rbx,%rax)
+	je	.L636
+	movq	0(%rbp), %rax
+	xorl	%esi, %esi
+	movq	$0, 0(%rbp)
+	testb	$1, 92(%r13)
+	je	.L635
+.L637:
+	movl	%r8d, %esi
+	movq	8(%rsp), %rbx
+	movl	$57, %ecx
+	movq	%rbp, %rdi
+	imulq	$456, %rsi, %rsi
+	movq	32(%r12), %rdx
+	addl	$1, %r8d
+	addq	%rbx, %rsi
+	rep movsq
+	movq	%rax, 0(%rbp)
+	movl	40(%r12), %eax
+	leal	1(%rax), %ecx
+	movl	%ecx, 40(%r12)
+	movl	%r9d, (%rdx,%rax,4)
+.L636:
+	addq	$1, %r15
+	cmpq	%r15, 24(%rsp)
+	je	.L731
+.L641:
+	movq	16(%rsp), %rax
+	imulq	$456, %r15, %rbp
+	movl	%r15d, %r9d
+	addq	0(%r13), %rbp
+	movl	(%rax,%r15,4), %ecx
+	cmpl	$-2, %ecx
+	je	.L636
+	testl	%ecx, %ecx
+	jns	.L732
+	movq	0(%rbp), %rax
+	testb	$1, 92(%r13)
+	je	.L672
+.L640:
+	movl	$456, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	movl	%r8d, 48(%rsp)
+	movl	%r9d, 44(%rsp)
+	addq	$1, %r15
+	call	memset@PLT
+	movl	24(%r12), %eax
+	movq	16(%r12), %rdx
+	movl	44(%rsp), %r9d
+	movl	48(%rsp), %r8d
+	leal	1(%rax), %ecx
+	movl	%ecx, 24(%r12)
+	movl	%r9d, (%rdx,%rax,4)
+	cmpq	%r15, 24(%rsp)
+	jne	.L641
+.L731:
+	movl	72(%rsp), %r11d
+	movl	76(%rsp), %ebp
+	movq	%r13, %rbx
+	movl	%r8d, %r13d
+.L625:
+	testl	%r11d, %r11d
+	je	.L642
+	movq	(%r12), %rax
+	xorl	%r8d, %r8d
+	movl	%r11d, 32(%rsp)
+	leal	(%r11,%r13), %r15d
+	movq	(%rbx), %r14
+	xorl	%r10d, %r10d
+	movq	%rax, 24(%rsp)
+	cmpl	%ebp, %r8d
+	jnb	.L676
+	.p2align 4,,10
+	.p2align 3
+.L734:
+	movq	16(%rsp), %rdi
+	movl	%r8d, %eax
+	leaq	(%rdi,%rax,4), %rdx
+	movl	%r8d, %eax
+	jmp	.L651
+	.p2align 4,,10
+	.p2align 3
+.L645:
+	addl	$1, %eax
+	addq	$4, %rdx
+	cmpl	%eax, %ebp
+	je	.L673
+.L651:
+	cmpl	$-2, (%rdx)
+	jne	.L645
+	cmpl	%ebp, %eax
+	jnb	.L674
+	leal	1(%rax), %r11d
+.L646:
+	movl	%eax, %edx
+	movl	%r13d, %esi
+	movq	8(%rsp), %rdi
+	movl	$57, %ecx
+	imulq	$456, %rdx, %rdx
+	leal	1(%r13), %r9d
+	imulq	$456, %rsi, %rsi
+	addq	%r14, %rdx
+	addq	%rdi, %rsi
+	movq	%rdx, %rdi
+	movl	8(%r12), %edx
+	rep movsq
+	leal	1(%rdx), %ecx
+	movl	%ecx, 8(%r12)
+	movq	24(%rsp), %rcx
+	movl	%eax, (%rcx,%rdx,4)
+	leal	1(%r10), %eax
+	cmpl	%r15d, %r9d
+	je	.L648
+	cmpl	%ebp, %r8d
+	jnb	.L733
+	movl	%r11d, %r8d
+	movl	%eax, %r10d
+	movl	%r9d, %r13d
+	cmpl	%ebp, %r8d
+	jb	.L734
+.L676:
+	movl	%r8d, %r11d
+	jmp	.L644
+	.p2align 4,,10
+	.p2align 3
+.L665:
+	movl	$1, 40(%rsp)
+.L613:
+	movl	44(%rsp), %edx
+	movl	48(%rsp), %ecx
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	call	mtlTruncate
+	movq	(%r12), %rsi
+	movq	48(%r12), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	16(%r12), %rsi
+	movq	48(%r12), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%r12), %rsi
+	movq	48(%r12), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	$56, %edx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	memset@PLT
+.L627:
+	movq	104(%rbx), %rdi
+	movq	8(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	104(%rbx), %rdi
+	movq	16(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	104(%rbx), %rdi
+	movq	(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	leaq	80(%rsp), %rax
+	cmpq	%rax, %r12
+	je	.L735
+.L597:
+	movl	40(%rsp), %eax
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L599:
+	.cfi_restore_state
+	movq	104(%rbx), %rdi
+	movq	16(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	104(%rbx), %rdi
+	movq	(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movl	$1, 40(%rsp)
+	jmp	.L597
+	.p2align 4,,10
+	.p2align 3
+.L730:
+	movl	%eax, %r13d
+	leal	1(%rax), %r15d
+	movq	8(%rsp), %rax
+	movq	%r12, %rdx
+	imulq	$456, %r13, %r13
+	movq	%rbx, %rdi
+	addq	%rax, %r13
+	movq	%r13, %rsi
+	call	materialCopy
+	testl	%eax, %eax
+	je	.L736
+	movl	40(%rsp), %ebp
+	movq	24(%rsp), %r12
+	movl	%eax, 40(%rsp)
+.L621:
+	testb	$1, 92(%rbx)
+	jne	.L613
+	testl	%r15d, %r15d
+	je	.L613
+	movl	%r15d, %r13d
+	movq	8(%rsp), %rcx
+	movl	%ebp, 24(%rsp)
+	movq	%rbx, %rbp
+	imulq	$456, %r13, %r13
+	movq	%rcx, %rbx
+	leaq	0(%r13,%rcx), %r15
+	leaq	160+mapOffsets(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L631:
+	movq	(%rbx), %rsi
+	movq	104(%rbp), %rdi
+	leaq	mapOffsets(%rip), %r14
+	call	wavefrontFreeWith@PLT
+	jmp	.L630
+	.p2align 4,,10
+	.p2align 3
+.L629:
+	addq	$8, %r14
+	cmpq	%r13, %r14
+	je	.L737
+.L630:
+	movq	(%r14), %rdx
+	addq	%rbx, %rdx
+	movl	8(%rdx), %edi
+	testl	%edi, %edi
+	jne	.L629
+	movq	(%rdx), %rsi
+	movq	104(%rbp), %rdi
+	addq	$8, %r14
+	call	wavefrontFreeWith@PLT
+	cmpq	%r13, %r14
+	jne	.L630
+.L737:
+	addq	$456, %rbx
+	cmpq	%r15, %rbx
+	jne	.L631
+	movq	%rbp, %rbx
+	movl	24(%rsp), %ebp
+	jmp	.L613
+	.p2align 4,,10
+	.p2align 3
+.L736:
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString
+	xorl	%esi, %esi
+	movl	8(%r12), %edi
+	testq	%rax, %rax
+	movq	%rax, 0(%r13)
+	movl	%r15d, %eax
+	sete	%sil
+	setne	%dl
+	jmp	.L620
+	.p2align 4,,10
+	.p2align 3
+.L672:
+	movq	%rax, %rsi
+.L635:
+	movq	104(%r13), %rdi
+	leaq	mapOffsets(%rip), %rbx
+	movq	%rax, 56(%rsp)
+	movl	%ecx, 48(%rsp)
+	movl	%r8d, 44(%rsp)
+	movl	%r9d, 64(%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	%rbx, %rcx
+	movq	%r12, %rax
+	movq	%rbp, %rbx
+	movq	%r13, %r12
+	movq	%rcx, %rbp
+	movq	%rax, %r13
+	jmp	.L639
+	.p2align 4,,10
+	.p2align 3
+.L638:
+	addq	$8, %rbp
+	cmpq	%rbp, %r14
+	je	.L738
+.L639:
+	movq	0(%rbp), %rdx
+	addq	%rbx, %rdx
+	movl	8(%rdx), %esi
+	testl	%esi, %esi
+	jne	.L638
+	movq	(%rdx), %rsi
+	movq	104(%r12), %rdi
+	addq	$8, %rbp
+	call	wavefrontFreeWith@PLT
+	cmpq	%rbp, %r14
+	jne	.L639
+.L738:
+	movl	48(%rsp), %ecx
+	movq	%rbx, %rbp
+	movq	%r13, %rbx
+	movl	44(%rsp), %r8d
+	movq	%r12, %r13
+	movq	56(%rsp), %rax
+	movl	64(%rsp), %r9d
+	movq	%rbx, %r12
+	testl	%ecx, %ecx
+	jns	.L637
+	jmp	.L640
+	.p2align 4,,10
+	.p2align 3
+.L673:
+	movl	%ebp, %r11d
+.L644:
+	movl	8(%rbx), %eax
+	leal	1(%rax), %edx
+	movl	%edx, 8(%rbx)
+	jmp	.L646
+.L642:
+	movl	32(%rsp), %ecx
+	testl	%ecx, %ecx
+	je	.L627
+	movq	(%rbx), %r14
+	.p2align 4,,10
+	.p2align 3
+.L648:
+	movl	24(%rbx), %edx
+	movq	16(%rbx), %r13
+	xorl	%esi, %esi
+	movl	8(%rbx), %ebp
+	movl	%edx, 24(%rsp)
+	movq	%r13, %rdi
+	salq	$2, %rdx
+	call	memset@PLT
+	testl	%ebp, %ebp
+	je	.L627
+	movl	24(%rsp), %ecx
+	movq	%r14, %rdx
+	movq	%rbx, 24(%rsp)
+	xorl	%r14d, %r14d
+	movq	%r12, 32(%rsp)
+	movl	%ebp, %ebx
+	movq	%rdx, %r12
+	subl	$1, %ecx
+	movl	%ecx, %ebp
+	jmp	.L658
+	.p2align 4,,10
+	.p2align 3
+.L653:
+	addq	$456, %r12
+	cmpl	%r14d, %ebx
+	je	.L739
+.L658:
+	movq	(%r12), %r15
+	addl	$1, %r14d
+	testq	%r15, %r15
+	je	.L653
+	movq	%r15, %rdi
+	call	strlen@PLT
+	testq	%rax, %rax
+	je	.L677
+	leaq	(%r15,%rax), %r8
+	movq	%r15, %rsi
+	movl	$-2128831035, %eax
+	.p2align 4,,10
+	.p2align 3
+.L655:
+	movzbl	(%rsi), %edi
+	addq	$1, %rsi
+	xorl	%edi, %eax
+	imull	$16777619, %eax, %eax
+	cmpq	%r8, %rsi
+	jne	.L655
+	andl	%ebp, %eax
+	movl	%eax, %esi
+	leaq	0(%r13,%rsi,4), %rsi
+	movl	(%rsi), %edx
+	testl	%edx, %edx
+	je	.L656
+	.p2align 4,,10
+	.p2align 3
+.L740:
+	addl	$1, %eax
+.L654:
+	andl	%ebp, %eax
+	movl	%eax, %esi
+	leaq	0(%r13,%rsi,4), %rsi
+	movl	(%rsi), %edx
+	testl	%edx, %edx
+	jne	.L740
+.L656:
+	movl	%r14d, (%rsi)
+	addq	$456, %r12
+	cmpl	%r14d, %ebx
+	jne	.L658
+.L739:
+	movq	24(%rsp), %rbx
+	movq	32(%rsp), %r12
+	jmp	.L627
+.L733:
+	movl	32(%rsp), %r11d
+	movq	8(%rsp), %rbp
+	subl	%r13d, %r10d
+	movq	%rcx, %r8
+.L649:
+	movl	8(%rbx), %edx
+	movl	%r9d, %esi
+	movl	$57, %ecx
+	addl	$1, %r9d
+	imulq	$456, %rsi, %rsi
+	leal	1(%rdx), %eax
+	movl	%eax, 8(%rbx)
+	movl	%edx, %eax
+	imulq	$456, %rax, %rax
+	addq	%rbp, %rsi
+	addq	%r14, %rax
+	movq	%rax, %rdi
+	movl	8(%r12), %eax
+	rep movsq
+	leal	1(%rax), %ecx
+	movl	%ecx, 8(%r12)
+	movl	%edx, (%r8,%rax,4)
+	leal	(%r10,%r9), %eax
+	cmpl	%r11d, %eax
+	jb	.L649
+	jmp	.L648
+.L735:
+	movq	80(%rsp), %rsi
+	movq	128(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	96(%rsp), %rsi
+	movq	128(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	112(%rsp), %rsi
+	movq	128(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	$56, %edx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	memset@PLT
+	jmp	.L597
+.L725:
+	movl	$4, %r15d
+	movl	$1, %esi
+	movl	$1, %edi
+	movl	$0, 32(%rsp)
+	movl	$0, 40(%rsp)
+	movq	$4, 24(%rsp)
+	jmp	.L601
+.L662:
+	movl	$4, %r13d
+	jmp	.L610
+.L677:
+	movl	$-2128831035, %eax
+	jmp	.L654
+.L667:
+	xorl	%eax, %eax
+	jmp	.L615
+.L674:
+	movl	%eax, %r11d
+	jmp	.L644
+.L671:
+	movl	%eax, %r15d
+	jmp	.L621
+	.cfi_endproc
+.LFE62:
+	.size	wavefrontMTLUpdate, .-wavefrontMTLUpdate
+	.p2align 4
+	.globl	wavefrontMTLChangesRelease
+	.type	wavefrontMTLChangesRelease, @function
+wavefrontMTLChangesRelease:
+.LFB63:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	(%rdi), %rsi
+	movq	48(%rdi), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	16(%rbx), %rsi
+	movq	48(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%rbx), %rsi
+	movq	48(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%rbx, %rdi
+	movl	$56, %edx
+	xorl	%esi, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	memset@PLT
+	.cfi_endproc
+.LFE63:
+	.size	wavefrontMTLChangesRelease, .-wavefrontMTLChangesRelease
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	".%u"
+	.text
+	.p2align 4
+	.globl	wavefrontMTLMerge
+	.type	wavefrontMTLMerge, @function
+wavefrontMTLMerge:
+.LFB65:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	%edx, %r13d
+	movl	$32, %edx
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	xorl	%esi, %esi
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rdi, 16(%rsp)
+	movq	%rcx, %rdi
+	movq	%rcx, 72(%rsp)
+	call	memset@PLT
+	movl	8(%r14), %eax
+	movq	104(%r14), %rdi
+	movl	%eax, 148(%rsp)
+	movl	40(%r14), %eax
+	movq	%rdi, 24(%r15)
+	movl	%eax, 152(%rsp)
+	movl	72(%r14), %eax
+	movl	%eax, 156(%rsp)
+	testl	%r13d, %r13d
+	je	.L795
+	movl	%r13d, %edx
+	movq	%rbx, %rax
+	leaq	0(,%rdx,8), %rcx
+	subq	%rdx, %rcx
+	xorl	%edx, %edx
+	salq	$4, %rcx
+	addq	%rbx, %rcx
+.L745:
+	addl	8(%rax), %edx
+	addq	$112, %rax
+	cmpq	%rcx, %rax
+	jne	.L745
+	movl	148(%rsp), %eax
+	leal	1(%rdx), %ebp
+	salq	$2, %rbp
+	leal	(%rax,%rdx), %r12d
+.L744:
+	leal	(%r12,%r12), %edx
+	cmpl	$16, %edx
+	jbe	.L796
+	movl	$16, %eax
+.L747:
+	addl	%eax, %eax
+	cmpl	%edx, %eax
+	jb	.L747
+	movl	%eax, %esi
+	subl	$1, %eax
+	movl	%eax, 132(%rsp)
+.L746:
+	movl	$4, %edx
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	16(%rsp), %r14
+	leal	1(%r12), %esi
+	salq	$2, %rsi
+	movq	%rax, 80(%rsp)
+	movq	104(%r14), %rdi
+	call	wavefrontAllocateWith@PLT
+	movq	104(%r14), %rdi
+	leal	1(%r13), %esi
+	salq	$2, %rsi
+	movq	%rax, 104(%rsp)
+	movq	%rax, %r12
+	call	wavefrontAllocateWith@PLT
+	movq	72(%rsp), %r15
+	movq	104(%r14), %rdi
+	movq	%rbp, %rsi
+	movq	%rax, 8(%r15)
+	call	wavefrontAllocateWith@PLT
+	cmpq	$0, 80(%rsp)
+	movq	%rax, (%r15)
+	je	.L800
+	testq	%r12, %r12
+	je	.L800
+	movq	72(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	testq	%rax, %rax
+	sete	%al
+	movq	8(%rdi), %r15
+	movl	8(%rsi), %r9d
+	movl	%r13d, 16(%rdi)
+	testq	%r15, %r15
+	sete	%dl
+	orl	%edx, %eax
+	testl	%r9d, %r9d
+	je	.L751
+	testb	%al, %al
+	jne	.L857
+	movq	(%rsi), %r14
+	movl	%r13d, 56(%rsp)
+	movq	%rsi, %r12
+	xorl	%ecx, %ecx
+	movq	%r15, 64(%rsp)
+	movq	80(%rsp), %r13
+	movq	%r14, (%rsp)
+	movq	104(%rsp), %r15
+	movq	%rbx, 48(%rsp)
+	movl	132(%rsp), %r14d
+	jmp	.L756
+.L752:
+	cmpl	%r9d, %ecx
+	jnb	.L858
+.L756:
+	movl	%ecx, %edx
+	movq	(%rsp), %rax
+	addl	$1, %ecx
+	imulq	$456, %rdx, %rsi
+	movq	%rdx, 8(%rsp)
+	leaq	(%rax,%rsi), %r8
+	cmpq	$0, (%r8)
+	je	.L752
+	movq	%r12, %rdi
+	movq	%r8, %rsi
+	movl	%ecx, 32(%rsp)
+	movl	%r9d, 40(%rsp)
+	movq	%r8, 24(%rsp)
+	call	wavefrontMaterialHash
+	movl	32(%rsp), %ecx
+	movq	8(%rsp), %rdx
+	movl	%eax, %ebx
+	movl	%eax, %ebp
+	andl	%r14d, %ebx
+	movl	%ebx, %eax
+	leaq	0(%r13,%rax,4), %rdi
+	movl	(%rdi), %eax
+	testl	%eax, %eax
+	je	.L753
+	movq	24(%rsp), %r8
+	movl	%r14d, %edi
+	movl	%ecx, 24(%rsp)
+	movl	%ebp, %r14d
+	movq	%rdx, 32(%rsp)
+	movl	%edi, %ebp
+	movq	%r8, 8(%rsp)
+	jmp	.L755
+	.p2align 4,,10
+	.p2align 3
+.L754:
+	addl	$1, %ebx
+	andl	%ebp, %ebx
+	movl	%ebx, %eax
+	leaq	0(%r13,%rax,4), %rdi
+	movl	(%rdi), %eax
+	testl	%eax, %eax
+	je	.L859
+.L755:
+	subl	$1, %eax
+	cmpl	%r14d, (%r15,%rax,4)
+	jne	.L754
+	movq	(%rsp), %rsi
+	movq	8(%rsp), %rcx
+	movq	%r12, %rdx
+	movq	%r12, %rdi
+	imulq	$456, %rax, %rax
+	addq	%rax, %rsi
+	call	wavefrontMaterialEqual
+	testl	%eax, %eax
+	je	.L754
+	movl	24(%rsp), %ecx
+	movl	40(%rsp), %r9d
+	movl	%ebp, %r14d
+	cmpl	%r9d, %ecx
+	jb	.L756
+.L858:
+	movl	56(%rsp), %r13d
+	movq	48(%rsp), %rbx
+	movq	64(%rsp), %r15
+	testl	%r13d, %r13d
+	jne	.L793
+	movq	16(%rsp), %rax
+	xorl	%r9d, %r9d
+	movq	104(%rax), %rdx
+.L792:
+	movl	%r13d, %eax
+	movq	80(%rsp), %rsi
+	movq	%rdx, %rdi
+	movl	%r9d, (%r15,%rax,4)
+	call	wavefrontFreeWith@PLT
+	movq	16(%rsp), %rax
+	movq	104(%rsp), %rsi
+	movq	104(%rax), %rdi
+	call	wavefrontFreeWith@PLT
+	xorl	%r11d, %r11d
+	jmp	.L743
+.L859:
+	movl	%ebp, %eax
+	movq	32(%rsp), %rdx
+	movl	24(%rsp), %ecx
+	movl	%r14d, %ebp
+	movl	%eax, %r14d
+.L753:
+	movl	%ebp, (%r15,%rdx,4)
+	movl	%ecx, (%rdi)
+	movl	8(%r12), %r9d
+	jmp	.L752
+.L751:
+	testb	%al, %al
+	jne	.L790
+	testl	%r13d, %r13d
+	je	.L790
+.L793:
+	movq	%rbx, 24(%rsp)
+	xorl	%ebx, %ebx
+	xorl	%r9d, %r9d
+	movq	%r15, %rax
+	movl	%r13d, 144(%rsp)
+	movq	%rbx, %r13
+.L789:
+	leal	1(%r13), %edx
+	movl	%r9d, (%rax,%r13,4)
+	movl	%edx, 128(%rsp)
+	movq	24(%rsp), %rdx
+	movl	8(%rdx), %ecx
+	testl	%ecx, %ecx
+	je	.L758
+	addl	$1, %r9d
+	movl	$0, 32(%rsp)
+	movq	%rdx, %rsi
+	movl	132(%rsp), %r14d
+	movl	%r9d, 48(%rsp)
+	movl	%r9d, %eax
+	movq	%r13, 136(%rsp)
+	jmp	.L787
+	.p2align 4,,10
+	.p2align 3
+.L861:
+	movq	72(%rsp), %rax
+	movq	(%rax), %rax
+	movl	$-1, (%rax,%rdx,4)
+.L760:
+	movl	48(%rsp), %eax
+	movq	24(%rsp), %rdx
+	addl	$1, 32(%rsp)
+	movl	32(%rsp), %edi
+	addl	$1, %eax
+	cmpl	8(%rdx), %edi
+	jnb	.L860
+	movl	%eax, 48(%rsp)
+	movq	%rdx, %rsi
+.L787:
+	leal	-1(%rax), %edx
+	movl	32(%rsp), %eax
+	movl	%edx, 64(%rsp)
+	imulq	$456, %rax, %rax
+	addq	(%rsi), %rax
+	movq	(%rax), %rbx
+	movq	%rax, 40(%rsp)
+	testq	%rbx, %rbx
+	je	.L861
+	movq	24(%rsp), %rdi
+	movq	%rax, %rsi
+	call	wavefrontMaterialHash
+	movq	80(%rsp), %rdx
+	movl	%eax, %ebp
+	movl	%eax, %r12d
+	andl	%r14d, %ebp
+	movl	%ebp, %eax
+	leaq	(%rdx,%rax,4), %r8
+	movq	16(%rsp), %rax
+	movl	(%r8), %r15d
+	movq	(%rax), %rax
+	movq	%rax, (%rsp)
+	testl	%r15d, %r15d
+	je	.L761
+	movl	%r14d, %eax
+	movq	%rbx, 8(%rsp)
+	movl	%r12d, %r14d
+	movq	80(%rsp), %rbx
+	movq	104(%rsp), %r13
+	movl	%eax, %r12d
+	jmp	.L764
+	.p2align 4,,10
+	.p2align 3
+.L762:
+	addl	$1, %ebp
+	andl	%r12d, %ebp
+	movl	%ebp, %eax
+	leaq	(%rbx,%rax,4), %rax
+	movl	(%rax), %r15d
+	testl	%r15d, %r15d
+	je	.L862
+.L764:
+	leal	-1(%r15), %esi
+	movq	%rsi, %r15
+	cmpl	%r14d, 0(%r13,%rsi,4)
+	jne	.L762
+	imulq	$456, %rsi, %rsi
+	movq	(%rsp), %rax
+	movq	40(%rsp), %rcx
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rdi
+	addq	%rax, %rsi
+	call	wavefrontMaterialEqual
+	testl	%eax, %eax
+	je	.L762
+	movq	72(%rsp), %rax
+	movl	64(%rsp), %edx
+	movl	%r12d, %r14d
+	movq	(%rax), %rax
+	movl	%r15d, (%rax,%rdx,4)
+	jmp	.L760
+	.p2align 4,,10
+	.p2align 3
+.L862:
+	movq	%rax, %r8
+	movq	8(%rsp), %rbx
+	movl	%r12d, %eax
+	movl	%r14d, %r12d
+	movl	%eax, %r14d
+.L761:
+	movq	%rbx, %rdi
+	movq	%r8, 8(%rsp)
+	call	strlen@PLT
+	movq	16(%rsp), %rsi
+	movq	8(%rsp), %r8
+	movq	%rax, %rdx
+	movl	24(%rsi), %eax
+	movq	16(%rsi), %rsi
+	testl	%eax, %eax
+	je	.L765
+	leal	-1(%rax), %r13d
+	testq	%rdx, %rdx
+	je	.L797
+	movq	%rbx, %rdi
+	leaq	(%rdx,%rbx), %r9
+	movl	$-2128831035, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L767:
+	movzbl	(%rdi), %eax
+	addq	$1, %rdi
+	xorl	%eax, %r15d
+	imull	$16777619, %r15d, %r15d
+	cmpq	%r9, %rdi
+	jne	.L767
+.L766:
+	andl	%r13d, %r15d
+	movl	%r15d, %ecx
+	movl	(%rsi,%rcx,4), %ebp
+	testl	%ebp, %ebp
+	je	.L765
+	movq	%r8, 56(%rsp)
+	movq	%rbx, 8(%rsp)
+	movl	%r15d, %ebx
+	movq	%rsi, %r15
+	movl	%r12d, 88(%rsp)
+	movq	%rdx, %r12
+	movl	%r14d, 96(%rsp)
+	movl	%ebp, %r14d
+	movl	%r13d, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L770:
+	leal	-1(%r14), %eax
+	movq	(%rsp), %rdi
+	movq	%r12, %rdx
+	imulq	$456, %rax, %rax
+	movq	(%rdi,%rax), %r13
+	movq	8(%rsp), %rdi
+	movq	%r13, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L768
+	cmpb	$0, 0(%r13,%r12)
+	je	.L769
+.L768:
+	leal	1(%rbx), %ecx
+	movl	%ecx, %ebx
+	andl	%ebp, %ebx
+	movl	%ebx, %eax
+	movl	(%r15,%rax,4), %r14d
+	testl	%r14d, %r14d
+	jne	.L770
+	movq	%r12, %rdx
+	movq	8(%rsp), %rbx
+	movq	56(%rsp), %r8
+	movl	88(%rsp), %r12d
+	movl	96(%rsp), %r14d
+.L765:
+	movq	16(%rsp), %rdi
+	movq	%rbx, %rsi
+	movq	%r8, (%rsp)
+	call	wavefrontMTLCopyString
+	movq	(%rsp), %r8
+	movq	%rax, %rbx
+	testq	%rbx, %rbx
+	je	.L855
+.L846:
+	movq	16(%rsp), %rdi
+	movq	%rbx, %rsi
+	movq	%r8, (%rsp)
+	call	wavefrontMTLAddMaterial
+	movq	(%rsp), %r8
+	testl	%eax, %eax
+	jne	.L863
+	movq	16(%rsp), %rax
+	movl	8(%rax), %ebx
+	leal	-1(%rbx), %edx
+	imulq	$456, %rdx, %r9
+	addq	(%rax), %r9
+	movq	%rdx, 56(%rsp)
+	movq	%rdx, %r13
+	movq	(%r9), %rdi
+	movq	%r9, %rbp
+	movq	$0, (%r9)
+	movq	%rdi, (%rsp)
+	testb	$1, 92(%rax)
+	je	.L864
+.L784:
+	movq	16(%rsp), %rdi
+	movq	40(%rsp), %rcx
+	movq	%rbp, %rsi
+	movq	%r8, 8(%rsp)
+	movq	24(%rsp), %rdx
+	call	materialCopy
+	movq	(%rsp), %rdi
+	movq	8(%rsp), %r8
+	testl	%eax, %eax
+	movq	%rdi, 0(%rbp)
+	jne	.L865
+	movq	104(%rsp), %rax
+	movq	56(%rsp), %rsi
+	movq	72(%rsp), %rdi
+	movl	%r12d, (%rax,%rsi,4)
+	movl	64(%rsp), %eax
+	movq	(%rdi), %rdx
+	movl	%ebx, (%r8)
+	movl	%r13d, (%rdx,%rax,4)
+	jmp	.L760
+.L769:
+	movl	%r14d, %ebp
+	movq	%r12, %rdx
+	movq	8(%rsp), %rbx
+	movq	56(%rsp), %r8
+	movl	88(%rsp), %r12d
+	movl	96(%rsp), %r14d
+	testl	%ebp, %ebp
+	jle	.L765
+	movq	16(%rsp), %rax
+	leaq	12(%rdx), %rsi
+	movq	%r8, 8(%rsp)
+	movq	%rdx, (%rsp)
+	movq	104(%rax), %rdi
+	call	wavefrontAllocateWith@PLT
+	movq	(%rsp), %rdx
+	movq	8(%rsp), %r8
+	testq	%rax, %rax
+	movq	%rax, %rbp
+	je	.L855
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	movq	%r8, 8(%rsp)
+	movq	%rdx, (%rsp)
+	call	memcpy@PLT
+	movq	(%rsp), %rdx
+	movq	8(%rsp), %r8
+	movl	%r12d, 120(%rsp)
+	movl	%r14d, 124(%rsp)
+	movl	128(%rsp), %ebx
+	leaq	0(%rbp,%rdx), %rax
+	movq	%r8, 112(%rsp)
+	movq	%rax, 88(%rsp)
+	movq	%rdx, 96(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L780:
+	movq	88(%rsp), %rdi
+	movl	%ebx, %ecx
+	leaq	.LC3(%rip), %rdx
+	xorl	%eax, %eax
+	movl	$12, %esi
+	addl	$1, %ebx
+	call	snprintf@PLT
+	movq	96(%rsp), %rdi
+	cltq
+	leaq	(%rax,%rdi), %r14
+	movq	16(%rsp), %rax
+	movl	24(%rax), %edx
+	movq	(%rax), %rdi
+	movq	16(%rax), %r12
+	testl	%edx, %edx
+	je	.L852
+	subl	$1, %edx
+	testq	%r14, %r14
+	je	.L798
+	movq	%rbp, %r9
+	leaq	(%r14,%rbp), %r10
+	movl	$-2128831035, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L776:
+	movzbl	(%r9), %eax
+	addq	$1, %r9
+	xorl	%eax, %ecx
+	imull	$16777619, %ecx, %ecx
+	cmpq	%r10, %r9
+	jne	.L776
+.L775:
+	andl	%edx, %ecx
+	movl	%ecx, %r8d
+	movl	(%r12,%r8,4), %r15d
+	testl	%r15d, %r15d
+	je	.L852
+	movl	%ebx, 56(%rsp)
+	movq	%r12, %r13
+	movq	%rdi, %r12
+	movl	%edx, 8(%rsp)
+	movq	%rbp, (%rsp)
+	movl	%r8d, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L779:
+	leal	-1(%r15), %eax
+	movq	(%rsp), %rdi
+	movq	%r14, %rdx
+	imulq	$456, %rax, %rax
+	movq	(%r12,%rax), %rbx
+	movq	%rbx, %rsi
+	call	strncmp@PLT
+	testl	%eax, %eax
+	jne	.L777
+	cmpb	$0, (%rbx,%r14)
+	je	.L778
+.L777:
+	leal	1(%rbp), %ecx
+	movl	8(%rsp), %ebp
+	andl	%ecx, %ebp
+	movl	%ebp, %eax
+	movl	0(%r13,%rax,4), %r15d
+	testl	%r15d, %r15d
+	jne	.L779
+	movq	%r14, %r15
+	movq	112(%rsp), %r8
+	movl	120(%rsp), %r12d
+	movq	(%rsp), %rbp
+	movl	124(%rsp), %r14d
+.L774:
+	movq	%r15, %rdx
+	movq	16(%rsp), %r15
+	movq	%rbp, %rsi
+	movq	%r8, (%rsp)
+	movq	%r15, %rdi
+	call	wavefrontMTLCopyString
+	movq	104(%r15), %rdi
+	movq	%rbp, %rsi
+	movq	%rax, %rbx
+	call	wavefrontFreeWith@PLT
+	movq	(%rsp), %r8
+	testq	%rbx, %rbx
+	jne	.L846
+.L855:
+	movq	16(%rsp), %rax
+	movq	104(%rax), %rdi
+.L750:
+	movl	$1, %r11d
+	jmp	.L782
+	.p2align 4,,10
+	.p2align 3
+.L778:
+	movq	(%rsp), %rbp
+	movl	56(%rsp), %ebx
+	testl	%r15d, %r15d
+	jg	.L780
+.L852:
+	movq	%r14, %r15
+	movq	112(%rsp), %r8
+	movl	120(%rsp), %r12d
+	movl	124(%rsp), %r14d
+	jmp	.L774
+.L798:
+	movl	$-2128831035, %ecx
+	jmp	.L775
+.L864:
+	movq	104(%rax), %rdi
+	leaq	mapOffsets(%rip), %r15
+	xorl	%esi, %esi
+	movq	%r8, 8(%rsp)
+	call	wavefrontFreeWith@PLT
+	movl	%ebx, 88(%rsp)
+	movq	%rbp, %rbx
+	movq	%r15, %rbp
+	movq	16(%rsp), %r15
+	jmp	.L786
+	.p2align 4,,10
+	.p2align 3
+.L785:
+	addq	$8, %rbp
+	leaq	160+mapOffsets(%rip), %rax
+	cmpq	%rax, %rbp
+	je	.L866
+.L786:
+	movq	0(%rbp), %rdx
+	addq	%rbx, %rdx
+	movl	8(%rdx), %eax
+	testl	%eax, %eax
+	jne	.L785
+	movq	(%rdx), %rsi
+	movq	104(%r15), %rdi
+	addq	$8, %rbp
+	call	wavefrontFreeWith@PLT
+	leaq	160+mapOffsets(%rip), %rax
+	cmpq	%rax, %rbp
+	jne	.L786
+.L866:
+	movq	%rbx, %rbp
+	movq	8(%rsp), %r8
+	movl	88(%rsp), %ebx
+	jmp	.L784
+.L860:
+	movq	72(%rsp), %rax
+	movl	48(%rsp), %r9d
+	movq	136(%rsp), %r13
+	movq	8(%rax), %rax
+.L758:
+	movl	144(%rsp), %esi
+	addq	$1, %r13
+	addq	$112, 24(%rsp)
+	cmpl	%esi, %r13d
+	jb	.L789
+	movq	%rax, %r15
+	movq	16(%rsp), %rax
+	movl	%esi, %r13d
+	movq	104(%rax), %rdx
+	jmp	.L792
+	.p2align 4,,10
+	.p2align 3
+.L863:
+	movl	%eax, %r11d
+	movq	16(%rsp), %rax
+	movq	%rbx, %rbp
+	testb	$1, 92(%rax)
+	je	.L847
+.L856:
+	movq	104(%rax), %rdi
+.L782:
+	movq	80(%rsp), %rsi
+	movl	%r11d, (%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	16(%rsp), %rbx
+	movq	104(%rsp), %rsi
+	movq	104(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	156(%rsp), %ecx
+	movl	152(%rsp), %edx
+	movq	%rbx, %rdi
+	movl	148(%rsp), %esi
+	call	mtlTruncate
+	movq	72(%rsp), %rbx
+	movq	(%rbx), %rsi
+	movq	24(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	8(%rbx), %rsi
+	movq	24(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	$32, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	memset@PLT
+	movl	(%rsp), %r11d
+.L743:
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r11d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L797:
+	.cfi_restore_state
+	movl	$-2128831035, %r15d
+	jmp	.L766
+.L847:
+	movq	104(%rax), %rdi
+	movq	%rax, %rbx
+	movq	%rbp, %rsi
+	movl	%r11d, (%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	104(%rbx), %rdi
+	movl	(%rsp), %r11d
+	jmp	.L782
+.L865:
+	movl	%eax, %r11d
+	movq	16(%rsp), %rax
+	jmp	.L856
+.L800:
+	movq	72(%rsp), %rax
+	movl	%r13d, 16(%rax)
+	movq	16(%rsp), %rax
+	movq	104(%rax), %rdi
+	jmp	.L750
+.L796:
+	movl	$15, 132(%rsp)
+	movl	$16, %esi
+	jmp	.L746
+.L795:
+	movl	148(%rsp), %r12d
+	movl	$4, %ebp
+	jmp	.L744
+.L790:
+	movq	16(%rsp), %rdx
+	movq	104(%rdx), %rdi
+	movq	%rdi, %rdx
+	testb	%al, %al
+	je	.L792
+	jmp	.L750
+	.p2align 4,,10
+	.p2align 3
+.L857:
+	movq	104(%rsi), %rdi
+	jmp	.L750
+	.cfi_endproc
+.LFE65:
+	.size	wavefrontMTLMerge, .-wavefrontMTLMerge
+	.p2align 4
+	.globl	wavefrontMTLRemapRelease
+	.type	wavefrontMTLRemapRelease, @function
+wavefrontMTLRemapRelease:
+.LFB66:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	(%rdi), %rsi
+	movq	24(%rdi), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	8(%rbx), %rsi
+	movq	24(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%rbx, %rdi
+	movl	$32, %edx
+	xorl	%esi, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	memset@PLT
+	.cfi_endproc
+.LFE66:
+	.size	wavefrontMTLRemapRelease, .-wavefrontMTLRemapRelease
+	.p2align 4
+	.globl	wavefrontMTLRelease
+	.type	wavefrontMTLRelease, @function
+wavefrontMTLRelease:
+.LFB67:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movl	92(%rdi), %r12d
+	andl	$1, %r12d
+	jne	.L870
+	movl	8(%rdi), %esi
+	xorl	%r13d, %r13d
+	leaq	160+mapOffsets(%rip), %r15
+	testl	%esi, %esi
+	je	.L877
+	.p2align 4,,10
+	.p2align 3
+.L871:
+	movl	%r13d, %ebp
+	movq	104(%r14), %rdi
+	leaq	mapOffsets(%rip), %rbx
+	imulq	$456, %rbp, %rbp
+	addq	(%r14), %rbp
+	movq	0(%rbp), %rsi
+	call	wavefrontFreeWith@PLT
+	jmp	.L876
+	.p2align 4,,10
+	.p2align 3
+.L875:
+	addq	$8, %rbx
+	cmpq	%rbx, %r15
+	je	.L888
+.L876:
+	movq	(%rbx), %rax
+	addq	%rbp, %rax
+	movl	8(%rax), %edx
+	testl	%edx, %edx
+	jne	.L875
+	movq	(%rax), %rsi
+	movq	104(%r14), %rdi
+	addq	$8, %rbx
+	call	wavefrontFreeWith@PLT
+	cmpq	%rbx, %r15
+	jne	.L876
+.L888:
+	addl	$1, %r13d
+	cmpl	8(%r14), %r13d
+	jb	.L871
+.L877:
+	movl	40(%r14), %ecx
+	testl	%ecx, %ecx
+	je	.L873
+	.p2align 4,,10
+	.p2align 3
+.L872:
+	movq	32(%r14), %rax
+	movl	%r12d, %edx
+	movq	104(%r14), %rdi
+	addl	$1, %r12d
+	movq	(%rax,%rdx,8), %rsi
+	call	wavefrontFreeWith@PLT
+	cmpl	40(%r14), %r12d
+	jb	.L872
+.L873:
+	movq	(%r14), %rsi
+	movq	104(%r14), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	16(%r14), %rsi
+	movq	104(%r14), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%r14), %rsi
+	movq	104(%r14), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	48(%r14), %rsi
+	movq	104(%r14), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	64(%r14), %rsi
+	movq	104(%r14), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	80(%r14), %rsi
+	movq	104(%r14), %rdi
+	call	wavefrontFreeWith@PLT
+	pxor	%xmm0, %xmm0
+	movq	$0, (%r14)
+	movq	$0, 8(%r14)
+	movq	$0, 16(%r14)
+	movl	$0, 24(%r14)
+	movq	$0, 32(%r14)
+	movq	$0, 40(%r14)
+	movq	$0, 48(%r14)
+	movl	$0, 56(%r14)
+	movq	$0, 64(%r14)
+	movq	$0, 72(%r14)
+	movq	$0, 80(%r14)
+	movq	$0, 88(%r14)
+	movups	%xmm0, 96(%r14)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L870:
+	.cfi_restore_state
+	movq	96(%rdi), %rbx
+	testq	%rbx, %rbx
+	je	.L873
+	.p2align 4,,10
+	.p2align 3
+.L874:
+	movq	%rbx, %rsi
+	movq	104(%r14), %rdi
+	movq	(%rbx), %rbx
+	call	wavefrontFreeWith@PLT
+	movq	%rbx, 96(%r14)
+	testq	%rbx, %rbx
+	jne	.L874
+	jmp	.L873
+	.cfi_endproc
+.LFE67:
+	.size	wavefrontMTLRelease, .-wavefrontMTLRelease
+	.section	.rodata
+	.align 32
+	.type	defaultMapOptions, @object
+	.size	defaultMapOptions, 64
+defaultMapOptions:
+	.zero	12
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.zero	12
+	.long	1065353216
+	.zero	8
+	.long	1065353216
+	.zero	8
+	.long	3
+	.align 32
+	.type	mapOffsets, @object
+	.size	mapOffsets, 160
+mapOffsets:
+	.quad	136
+	.quad	152
+	.quad	168
+	.quad	184
+	.quad	200
+	.quad	216
+	.quad	232
+	.quad	248
+	.quad	264
+	.quad	280
+	.quad	296
+	.quad	312
+	.quad	328
+	.quad	344
+	.quad	360
+	.quad	376
+	.quad	392
+	.quad	408
+	.quad	424
+	.quad	440
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	1065353216
+	.long	1065353216
+	.set	.LC1,.LC0
+	.section	.note.GNU-stack,"",@progbits
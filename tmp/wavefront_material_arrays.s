@@ -0,0 +1,323 @@
+	.file	"wavefront_material_arrays.c"
+	.text
+	.p2align 4
+	.globl	wavefrontMaterialArraysCompose
+	.type	wavefrontMaterialArraysCompose, @function
+wavefrontMaterialArraysCompose:
+.LFB12:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$472, %edx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%rsi, 48(%rsp)
+	xorl	%esi, %esi
+	call	memset@PLT
+	movl	8(%rbx), %r15d
+	movq	%rbx, %rax
+	movq	104(%rax), %rdi
+	leaq	15(,%r15,4), %rbx
+	movq	%r15, %r13
+	movq	%r15, %rdx
+	andq	$-16, %rbx
+	movq	%rdi, 464(%rbp)
+	salq	$4, %r13
+	leaq	(%rbx,%rbx), %rax
+	salq	$6, %rdx
+	movq	%rax, 56(%rsp)
+	addq	%rbx, %rax
+	addq	%r13, %rdx
+	movq	%rax, %rcx
+	salq	$4, %rcx
+	addq	%rcx, %rax
+	leaq	16(%rdx,%rax), %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, 456(%rbp)
+	testq	%rax, %rax
+	je	.L6
+	addq	$15, %rax
+	movl	%r15d, 68(%rsp)
+	andq	$-16, %rax
+	movl	%r15d, 0(%rbp)
+	leaq	(%rax,%r13), %r12
+	movq	%rax, 8(%rsp)
+	movq	%rax, 8(%rbp)
+	leaq	(%r12,%r13), %rax
+	leaq	(%rax,%r13), %rcx
+	movq	%rax, 16(%rsp)
+	movq	%rax, 24(%rbp)
+	leaq	(%rcx,%r13), %rax
+	movq	%rcx, 24(%rsp)
+	movq	%rcx, 32(%rbp)
+	leaq	(%rax,%r13), %rcx
+	movq	%rax, 32(%rsp)
+	movq	%rax, 40(%rbp)
+	leaq	(%rcx,%rbx), %rax
+	movq	%rcx, 40(%rsp)
+	movq	%rcx, 48(%rbp)
+	leaq	(%rax,%rbx), %rcx
+	leaq	(%rcx,%rbx), %rsi
+	movq	%rax, 72(%rsp)
+	leaq	(%rsi,%rbx), %rdi
+	movq	%rax, 56(%rbp)
+	leaq	(%rdi,%rbx), %r8
+	movq	%r12, 16(%rbp)
+	leaq	(%r8,%rbx), %r9
+	movq	%rcx, 64(%rbp)
+	leaq	(%r9,%rbx), %r10
+	movq	%rsi, 72(%rbp)
+	leaq	(%r10,%rbx), %r11
+	movq	%rdi, 80(%rbp)
+	leaq	(%r11,%rbx), %r13
+	movq	%r8, 88(%rbp)
+	leaq	0(%r13,%rbx), %r14
+	movq	%r9, 96(%rbp)
+	leaq	(%r14,%rbx), %rax
+	movq	%r10, 104(%rbp)
+	movq	%rax, %rdx
+	addq	%rbx, %rax
+	movq	%r11, 112(%rbp)
+	movq	%rax, %xmm0
+	movq	%rdx, %xmm1
+	movq	%rdx, %rax
+	movq	%r13, 120(%rbp)
+	punpcklqdq	%xmm0, %xmm1
+	movq	56(%rsp), %xmm0
+	leaq	(%rbx,%rbx,4), %rdx
+	movq	%r14, 128(%rbp)
+	movups	%xmm1, 136(%rbp)
+	leaq	(%rax,%rdx,4), %rax
+	punpcklqdq	%xmm0, %xmm0
+	addq	%rax, %rbx
+	movdqa	%xmm0, %xmm2
+	movq	%rbx, %xmm3
+	paddq	%xmm1, %xmm2
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 152(%rbp)
+	movdqa	%xmm0, %xmm2
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 168(%rbp)
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 184(%rbp)
+	movdqa	%xmm0, %xmm2
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 200(%rbp)
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 216(%rbp)
+	movdqa	%xmm0, %xmm2
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 232(%rbp)
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 248(%rbp)
+	movdqa	%xmm0, %xmm2
+	movups	%xmm1, 264(%rbp)
+	paddq	%xmm0, %xmm1
+	movups	%xmm1, 280(%rbp)
+	movq	%rax, %xmm1
+	movl	68(%rsp), %eax
+	punpcklqdq	%xmm3, %xmm1
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 296(%rbp)
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 312(%rbp)
+	movdqa	%xmm0, %xmm2
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 328(%rbp)
+	movdqa	%xmm2, %xmm1
+	movups	%xmm2, 344(%rbp)
+	movdqa	%xmm0, %xmm2
+	paddq	%xmm0, %xmm1
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 360(%rbp)
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 376(%rbp)
+	movdqa	%xmm0, %xmm2
+	paddq	%xmm1, %xmm2
+	movups	%xmm1, 392(%rbp)
+	movdqa	%xmm0, %xmm1
+	paddq	%xmm2, %xmm1
+	movups	%xmm2, 408(%rbp)
+	paddq	%xmm1, %xmm0
+	movups	%xmm1, 424(%rbp)
+	movups	%xmm0, 440(%rbp)
+	testl	%eax, %eax
+	je	.L3
+	leaq	0(,%r15,4), %rax
+	movq	72(%rsp), %rdx
+	xorl	%ebx, %ebx
+	movq	%rax, 56(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movq	48(%rsp), %rax
+	imulq	$114, %rbx, %r15
+	addq	(%rax), %r15
+	movq	8(%rsp), %rax
+	movdqu	8(%r15), %xmm3
+	movss	88(%r15), %xmm0
+	movups	%xmm3, (%rax,%rbx,4)
+	movdqu	24(%r15), %xmm4
+	movq	16(%rsp), %rax
+	movups	%xmm4, (%r12,%rbx,4)
+	movdqu	40(%r15), %xmm5
+	xorl	%r12d, %r12d
+	movups	%xmm5, (%rax,%rbx,4)
+	movq	24(%rsp), %rax
+	movdqu	56(%r15), %xmm6
+	movups	%xmm6, (%rax,%rbx,4)
+	movq	32(%rsp), %rax
+	movdqu	72(%r15), %xmm7
+	movups	%xmm7, (%rax,%rbx,4)
+	movq	40(%rsp), %rax
+	movss	%xmm0, (%rax,%rbx)
+	movss	92(%r15), %xmm0
+	movss	%xmm0, (%rdx,%rbx)
+	movss	96(%r15), %xmm0
+	movss	%xmm0, (%rcx,%rbx)
+	movss	100(%r15), %xmm0
+	movss	%xmm0, (%rsi,%rbx)
+	movss	104(%r15), %xmm0
+	movss	%xmm0, (%rdi,%rbx)
+	movss	108(%r15), %xmm0
+	movss	%xmm0, (%r8,%rbx)
+	movss	112(%r15), %xmm0
+	movss	%xmm0, (%r9,%rbx)
+	movss	116(%r15), %xmm0
+	movss	%xmm0, (%r10,%rbx)
+	movss	120(%r15), %xmm0
+	movl	128(%r15), %eax
+	movss	%xmm0, (%r11,%rbx)
+	movss	124(%r15), %xmm0
+	movss	%xmm0, 0(%r13,%rbx)
+	movl	%eax, (%r14,%rbx)
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	movl	%r12d, %esi
+	movq	%r15, %rdi
+	call	wavefrontMaterialMap@PLT
+	movl	%r12d, %esi
+	movq	%r15, %rdi
+	movl	8(%rax), %edx
+	movq	136(%rbp,%r12,8), %rax
+	movl	%edx, (%rax,%rbx)
+	call	wavefrontMaterialMap@PLT
+	movl	12(%rax), %edx
+	movq	296(%rbp,%r12,8), %rax
+	addq	$1, %r12
+	movl	%edx, (%rax,%rbx)
+	cmpq	$20, %r12
+	jne	.L5
+	movq	56(%rsp), %rax
+	addq	$4, %rbx
+	cmpq	%rax, %rbx
+	je	.L3
+	movq	8(%rbp), %rax
+	movq	16(%rbp), %r12
+	movq	56(%rbp), %rdx
+	movq	64(%rbp), %rcx
+	movq	72(%rbp), %rsi
+	movq	80(%rbp), %rdi
+	movq	%rax, 8(%rsp)
+	movq	24(%rbp), %rax
+	movq	88(%rbp), %r8
+	movq	96(%rbp), %r9
+	movq	104(%rbp), %r10
+	movq	112(%rbp), %r11
+	movq	120(%rbp), %r13
+	movq	%rax, 16(%rsp)
+	movq	32(%rbp), %rax
+	movq	128(%rbp), %r14
+	movq	%rax, 24(%rsp)
+	movq	40(%rbp), %rax
+	movq	%rax, 32(%rsp)
+	movq	48(%rbp), %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L4
+.L3:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L6:
+	.cfi_restore_state
+	addq	$88, %rsp
+	.cfi_def_cfa_offset 56
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	wavefrontMaterialArraysCompose, .-wavefrontMaterialArraysCompose
+	.p2align 4
+	.globl	wavefrontMaterialArraysRelease
+	.type	wavefrontMaterialArraysRelease, @function
+wavefrontMaterialArraysRelease:
+.LFB13:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	456(%rdi), %rsi
+	movq	464(%rdi), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%rbx, %rdi
+	movl	$472, %edx
+	xorl	%esi, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	memset@PLT
+	.cfi_endproc
+.LFE13:
+	.size	wavefrontMaterialArraysRelease, .-wavefrontMaterialArraysRelease
+	.section	.note.GNU-stack,"",@progbits
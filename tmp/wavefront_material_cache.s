@@ -0,0 +1,1772 @@
+	.file	"wavefront_material_cache.c"
+	.text
+	.p2align 4
+	.type	deserialize, @function
+deserialize:
+.LFB39:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	movq	%rdi, 8(%rsp)
+	cmpq	$35, %rdx
+	jbe	.L34
+	movq	%rsi, %rbx
+	movq	%rdx, %rbp
+	leaq	magic(%rip), %rsi
+	movl	$4, %edx
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L34
+	cmpl	$4, 4(%rbx)
+	jne	.L34
+	movl	12(%rbx), %r13d
+	movl	16(%rbx), %eax
+	movl	20(%rbx), %edi
+	movl	32(%rbx), %edx
+	movl	28(%rbx), %r10d
+	movl	24(%rbx), %esi
+	movq	%rax, %r9
+	salq	$6, %rax
+	movq	%rdx, %r8
+	leaq	0(%r13,%rdi), %r14
+	movl	%edi, 80(%rsp)
+	movl	8(%rbx), %r11d
+	leaq	36(%r10,%rdx), %rdx
+	addq	%rsi, %r14
+	movq	%r13, %rcx
+	movq	%rsi, %r12
+	addq	%rax, %rdx
+	leaq	(%rdx,%r14,4), %rdx
+	cmpq	%rdx, %rbp
+	jne	.L34
+	imulq	$1041204193, %r10, %rdx
+	shrq	$37, %rdx
+	cmpl	%r11d, %edx
+	jb	.L34
+	leaq	36(%rbx), %rdx
+	leaq	0(,%rsi,4), %r15
+	addq	%rdx, %rax
+	movq	%rdx, 16(%rsp)
+	movq	%rax, 32(%rsp)
+	addq	%r10, %rax
+	leaq	(%rax,%r13,4), %rbp
+	movq	%rax, 40(%rsp)
+	leaq	0(,%rdi,4), %rax
+	leaq	0(%rbp,%rax), %r14
+	movq	%rax, 24(%rsp)
+	leaq	(%r14,%r15), %rsi
+	testl	%r8d, %r8d
+	jne	.L137
+.L3:
+	movl	80(%rsp), %eax
+	testl	%eax, %eax
+	je	.L138
+	movl	80(%rsp), %ebx
+	leal	-1(%rbx), %edx
+	andl	%ebx, %edx
+	jne	.L34
+	movl	%ebx, %eax
+	shrl	%eax
+	cmpl	%r11d, %eax
+	jb	.L34
+	xorl	%eax, %eax
+	jmp	.L6
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	cmpl	$1, %edi
+	sbbl	$-1, %edx
+	addl	$1, %eax
+	cmpl	%eax, %ebx
+	je	.L139
+.L6:
+	leal	0(,%rax,4), %edi
+	movl	0(%rbp,%rdi), %edi
+	cmpl	%edi, %r11d
+	jnb	.L140
+.L34:
+	movl	$2, %ebx
+.L1:
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	.cfi_restore_state
+	leal	-1(%r8), %eax
+	cmpb	$0, (%rsi,%rax)
+	je	.L3
+	jmp	.L34
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	xorl	%eax, %eax
+	testl	%r11d, %r11d
+	sete	%al
+.L5:
+	testl	%eax, %eax
+	je	.L34
+	testl	%r12d, %r12d
+	je	.L141
+	leal	-1(%r12), %edx
+	andl	%r12d, %edx
+	jne	.L34
+	movl	%r12d, %eax
+	shrl	%eax
+	cmpl	%ecx, %eax
+	jb	.L34
+	xorl	%eax, %eax
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	cmpl	$1, %edi
+	sbbl	$-1, %edx
+	addl	$1, %eax
+	cmpl	%eax, %r12d
+	je	.L142
+.L9:
+	leal	0(,%rax,4), %edi
+	movl	(%r14,%rdi), %edi
+	cmpl	%edi, %ecx
+	jnb	.L143
+	jmp	.L34
+.L141:
+	xorl	%ebx, %ebx
+	testl	%ecx, %ecx
+	sete	%bl
+.L8:
+	testl	%ebx, %ebx
+	je	.L34
+	movq	8(%rsp), %rdi
+	movl	$1, 92(%rdi)
+	testl	%r8d, %r8d
+	je	.L59
+	leal	-1(%r8), %edx
+	movl	%r11d, 84(%rsp)
+	movl	%ecx, 72(%rsp)
+	movl	%r9d, 64(%rsp)
+	movq	%r10, 56(%rsp)
+	movl	%r8d, 48(%rsp)
+	call	wavefrontMTLCopyString@PLT
+	movl	48(%rsp), %r8d
+	movq	56(%rsp), %r10
+	testq	%rax, %rax
+	movq	%rax, 88(%rsp)
+	movl	64(%rsp), %r9d
+	movl	72(%rsp), %ecx
+	movl	84(%rsp), %r11d
+	je	.L1
+.L10:
+	leaq	0(,%r13,8), %rsi
+	movq	8(%rsp), %r13
+	movl	%r11d, 48(%rsp)
+	movl	%ecx, 84(%rsp)
+	movq	104(%r13), %rdi
+	movl	%r9d, 72(%rsp)
+	movl	%r8d, 64(%rsp)
+	movq	%r10, 56(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movl	48(%rsp), %esi
+	movq	104(%r13), %rdi
+	movq	%rax, 32(%r13)
+	imulq	$456, %rsi, %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	104(%r13), %rdi
+	movq	24(%rsp), %rsi
+	movq	%rax, 0(%r13)
+	call	wavefrontAllocateWith@PLT
+	movl	80(%rsp), %r13d
+	movl	48(%rsp), %r11d
+	movq	56(%rsp), %r10
+	movl	64(%rsp), %r8d
+	testl	%r13d, %r13d
+	movl	72(%rsp), %r9d
+	movl	84(%rsp), %ecx
+	je	.L17
+	movl	80(%rsp), %edi
+	xorl	%edx, %edx
+	testq	%rax, %rax
+	je	.L17
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	leal	0(,%rdx,4), %esi
+	movl	0(%rbp,%rsi), %esi
+	movl	%esi, (%rax,%rdx,4)
+	addq	$1, %rdx
+	cmpl	%edi, %edx
+	jb	.L12
+.L17:
+	movl	%ecx, 72(%rsp)
+	movq	8(%rsp), %rcx
+	movq	%r15, %rsi
+	movl	%r11d, 84(%rsp)
+	movq	%rax, 16(%rcx)
+	movq	104(%rcx), %rdi
+	movl	%r9d, 64(%rsp)
+	movl	%r8d, 56(%rsp)
+	movq	%r10, 48(%rsp)
+	call	wavefrontAllocateWith@PLT
+	testl	%r12d, %r12d
+	movq	48(%rsp), %r10
+	movl	56(%rsp), %r8d
+	setne	%dil
+	testq	%rax, %rax
+	movl	64(%rsp), %r9d
+	movl	72(%rsp), %ecx
+	movl	84(%rsp), %r11d
+	movq	%rax, %rsi
+	je	.L16
+	xorl	%eax, %eax
+	testb	%dil, %dil
+	je	.L16
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	leal	0(,%rax,4), %edx
+	movl	(%r14,%rdx), %edx
+	movl	%edx, (%rsi,%rax,4)
+	addq	$1, %rax
+	cmpl	%r12d, %eax
+	jb	.L14
+.L16:
+	movq	8(%rsp), %rax
+	movq	%rsi, 48(%rax)
+	testl	%ecx, %ecx
+	je	.L19
+	cmpq	$0, 32(%rax)
+	je	.L1
+.L19:
+	testl	%r11d, %r11d
+	je	.L21
+	movq	8(%rsp), %rax
+	cmpq	$0, (%rax)
+	je	.L1
+.L21:
+	movl	80(%rsp), %ebp
+	testl	%ebp, %ebp
+	je	.L22
+	movq	8(%rsp), %rax
+	cmpq	$0, 16(%rax)
+	je	.L1
+.L22:
+	testq	%rsi, %rsi
+	jne	.L65
+	testb	%dil, %dil
+	jne	.L1
+.L65:
+	movq	8(%rsp), %rax
+	movl	80(%rsp), %esi
+	movl	%r12d, 56(%rax)
+	movl	%esi, 24(%rax)
+	testl	%r9d, %r9d
+	je	.L24
+	movq	16(%rsp), %rbp
+	movl	%ecx, 72(%rsp)
+	xorl	%r15d, %r15d
+	leaq	120(%rsp), %r13
+	movq	%r10, 56(%rsp)
+	leaq	124(%rsp), %r12
+	leaq	128(%rsp), %r14
+	movl	%r8d, 64(%rsp)
+	movl	%r9d, 16(%rsp)
+	movl	%r11d, 84(%rsp)
+	movl	%ebx, 48(%rsp)
+	movq	%rbp, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	movl	(%rbx,%rbp), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	call	memcpy@PLT
+	movss	124(%rsp), %xmm0
+	movss	%xmm0, (%r14,%rbp)
+	addq	$4, %rbp
+	cmpq	$12, %rbp
+	jne	.L25
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	movl	(%rbx,%rbp), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	call	memcpy@PLT
+	movss	124(%rsp), %xmm0
+	movss	%xmm0, (%r14,%rbp)
+	addq	$4, %rbp
+	cmpq	$24, %rbp
+	jne	.L26
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	movl	(%rbx,%rbp), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	call	memcpy@PLT
+	movss	124(%rsp), %xmm0
+	movss	%xmm0, (%r14,%rbp)
+	addq	$4, %rbp
+	cmpq	$36, %rbp
+	jne	.L27
+	movl	36(%rbx), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	call	memcpy@PLT
+	movl	40(%rbx), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movss	124(%rsp), %xmm0
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	movss	%xmm0, 164(%rsp)
+	call	memcpy@PLT
+	movl	44(%rbx), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movss	124(%rsp), %xmm0
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	movss	%xmm0, 168(%rsp)
+	call	memcpy@PLT
+	movl	48(%rbx), %eax
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movss	124(%rsp), %xmm0
+	movq	%r12, %rdi
+	movl	%eax, 120(%rsp)
+	movss	%xmm0, 172(%rsp)
+	call	memcpy@PLT
+	movq	52(%rbx), %rax
+	movq	%r12, %rdx
+	movq	%r14, %rsi
+	movss	124(%rsp), %xmm0
+	movq	8(%rsp), %rdi
+	movq	%rax, 180(%rsp)
+	movl	60(%rbx), %eax
+	movss	%xmm0, 176(%rsp)
+	movl	%eax, 188(%rsp)
+	call	wavefrontMTLInternMapOptions@PLT
+	testl	%eax, %eax
+	jne	.L133
+	addl	$1, %r15d
+	cmpl	124(%rsp), %r15d
+	jne	.L34
+	movl	16(%rsp), %eax
+	addq	$64, %rbx
+	cmpl	%eax, %r15d
+	jne	.L29
+	movq	56(%rsp), %r10
+	movl	64(%rsp), %r8d
+	movl	72(%rsp), %ecx
+	movl	84(%rsp), %r11d
+.L24:
+	movq	8(%rsp), %rax
+	movl	40(%rax), %edx
+	movl	%ecx, 44(%rax)
+	cmpl	%ecx, %edx
+	jnb	.L36
+	movq	%rax, %rbx
+	movq	88(%rsp), %r9
+	movl	%edx, %eax
+	movq	40(%rsp), %rdi
+	movq	32(%rbx), %rsi
+	leaq	(%rsi,%rax,8), %rsi
+.L35:
+	leal	0(,%rdx,4), %eax
+	movl	(%rdi,%rax), %eax
+	cmpl	$-1, %eax
+	je	.L144
+	cmpl	%r8d, %eax
+	jnb	.L34
+	addq	%r9, %rax
+	movq	%rax, (%rsi)
+	je	.L34
+	addl	$1, %edx
+	addq	$8, %rsi
+	movl	%edx, 40(%rbx)
+	cmpl	%ecx, %edx
+	jne	.L35
+.L36:
+	movq	8(%rsp), %rax
+	xorl	%ecx, %ecx
+	movl	%r11d, 12(%rax)
+	movl	8(%rax), %eax
+	cmpl	%r11d, %eax
+	jnb	.L32
+	movq	8(%rsp), %rdi
+	imulq	$456, %rax, %rax
+	addq	(%rdi), %rax
+	movq	%rax, %rbp
+	cmpq	$131, %r10
+	jbe	.L34
+	movq	32(%rsp), %rdx
+	movq	%r10, 16(%rsp)
+	movq	%r10, %rcx
+	xorl	%esi, %esi
+	movl	%r8d, 84(%rsp)
+	leaq	124(%rsp), %r13
+	movq	%rdi, %r8
+	leaq	128(%rsp), %r14
+	movl	%r11d, 40(%rsp)
+	movq	%rdx, %r11
+.L37:
+	movl	128(%r11), %edx
+	movl	%edx, %r12d
+	shrl	$20, %r12d
+	jne	.L34
+	testl	%edx, %edx
+	je	.L63
+	movl	%edx, %eax
+	xorl	%r10d, %r10d
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	leal	-1(%rax), %edi
+	addl	$1, %r10d
+	andl	%edi, %eax
+	jne	.L39
+	leaq	(%r10,%r10,2), %rax
+	leaq	132(,%rax,4), %r9
+	cmpq	%r9, %rcx
+	jb	.L34
+.L38:
+	movq	%rbp, %rdi
+	movq	%r8, 96(%rsp)
+	movq	%rsi, 72(%rsp)
+	movq	%r11, 64(%rsp)
+	movl	%edx, 56(%rsp)
+	movq	%r9, 48(%rsp)
+	call	wavefrontMaterialCompose@PLT
+	movq	64(%rsp), %r11
+	movq	48(%rsp), %r9
+	movl	56(%rsp), %edx
+	movq	72(%rsp), %rsi
+	movl	(%r11), %eax
+	movq	96(%rsp), %r8
+	cmpl	$-1, %eax
+	je	.L145
+	movl	84(%rsp), %ecx
+	cmpl	%ecx, %eax
+	jnb	.L34
+	movq	88(%rsp), %rcx
+	addq	%rcx, %rax
+.L42:
+	movq	%rax, 0(%rbp)
+	leaq	4(%r11), %rbx
+	leaq	colorOffsets(%rip), %rcx
+	movq	%r11, 48(%rsp)
+	movq	%rsi, 56(%rsp)
+	movq	%r9, 64(%rsp)
+	movl	%edx, 96(%rsp)
+	movq	%r8, 104(%rsp)
+	movl	%r12d, 72(%rsp)
+	movq	%rbx, %r12
+	movq	%rcx, %rbx
+.L41:
+	movl	(%r12), %eax
+	movq	(%rbx), %r15
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	addq	$8, %rbx
+	addq	$16, %r12
+	movl	%eax, 124(%rsp)
+	addq	%rbp, %r15
+	call	memcpy@PLT
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	movss	128(%rsp), %xmm0
+	movss	%xmm0, (%r15)
+	movl	-12(%r12), %eax
+	movl	%eax, 124(%rsp)
+	call	memcpy@PLT
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	movss	128(%rsp), %xmm0
+	movss	%xmm0, 4(%r15)
+	movl	-8(%r12), %eax
+	movl	%eax, 124(%rsp)
+	call	memcpy@PLT
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	movss	128(%rsp), %xmm0
+	movss	%xmm0, 8(%r15)
+	movl	-4(%r12), %eax
+	movl	%eax, 124(%rsp)
+	call	memcpy@PLT
+	leaq	40+colorOffsets(%rip), %rax
+	movss	128(%rsp), %xmm0
+	movss	%xmm0, 12(%r15)
+	cmpq	%rbx, %rax
+	jne	.L41
+	movq	48(%rsp), %r11
+	leaq	scalarOffsets(%rip), %rbx
+	leaq	84(%r11), %r15
+	movq	%r15, %r12
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	movl	(%r12), %eax
+	movq	(%rbx), %r15
+	movl	$4, %edx
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+	addq	$8, %rbx
+	addq	$4, %r12
+	movl	%eax, 124(%rsp)
+	addq	%rbp, %r15
+	call	memcpy@PLT
+	leaq	80+scalarOffsets(%rip), %rax
+	movss	128(%rsp), %xmm0
+	movss	%xmm0, (%r15)
+	cmpq	%rbx, %rax
+	jne	.L43
+	movq	48(%rsp), %r11
+	movq	56(%rsp), %rsi
+	movl	$1, %ebx
+	movq	64(%rsp), %r9
+	movl	96(%rsp), %edx
+	movq	%r13, 64(%rsp)
+	movq	104(%rsp), %r8
+	movl	124(%r11), %eax
+	movq	%rsi, 48(%rsp)
+	leaq	132(%r11), %r15
+	movl	72(%rsp), %r12d
+	movq	%r9, 56(%rsp)
+	movl	%edx, %r13d
+	movq	%r14, 72(%rsp)
+	movq	%r15, %r14
+	movq	%r8, %r15
+	movl	%eax, 128(%rbp)
+	jmp	.L49
+.L147:
+	cmpl	$-1, %esi
+	jne	.L34
+	movq	32(%r15), %rsi
+	subl	$1, %edi
+	movq	(%rsi,%rdi,8), %rsi
+	movq	%rsi, (%rax)
+.L47:
+	addq	$12, %r14
+.L44:
+	addl	$1, %r12d
+	cmpl	$20, %r12d
+	je	.L146
+.L49:
+	movl	%ebx, %eax
+	movl	%r12d, %ecx
+	sall	%cl, %eax
+	testl	%r13d, %eax
+	je	.L44
+	movl	%r12d, %esi
+	movq	%rbp, %rdi
+	call	wavefrontMaterialMap@PLT
+	movl	4(%r14), %edi
+	movl	%edi, 8(%rax)
+	movl	8(%r14), %esi
+	movl	%esi, 12(%rax)
+	cmpl	%edi, 40(%r15)
+	jb	.L34
+	cmpl	%esi, 72(%r15)
+	jb	.L34
+	movl	(%r14), %esi
+	testl	%edi, %edi
+	jne	.L147
+	cmpl	$-1, %esi
+	je	.L148
+	movl	84(%rsp), %ecx
+	cmpl	%ecx, %esi
+	jnb	.L34
+	movq	88(%rsp), %rcx
+	addq	%rcx, %rsi
+	movq	%rsi, (%rax)
+	jne	.L47
+	jmp	.L34
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	movq	$0, 88(%rsp)
+	jmp	.L10
+.L146:
+	movl	8(%r15), %eax
+	movq	48(%rsp), %rsi
+	movq	%r15, %r8
+	movq	56(%rsp), %r9
+	movl	40(%rsp), %ecx
+	addl	$1, %eax
+	movq	64(%rsp), %r13
+	movq	72(%rsp), %r14
+	movl	%eax, 8(%r15)
+	addq	%r9, %rsi
+	cmpl	%ecx, %eax
+	jnb	.L149
+	movq	16(%rsp), %rcx
+	movl	%eax, %edi
+	movq	32(%rsp), %rax
+	imulq	$456, %rdi, %rdi
+	addq	(%r8), %rdi
+	subq	%rsi, %rcx
+	movq	%rdi, %rbp
+	leaq	(%rax,%rsi), %r11
+	cmpq	$131, %rcx
+	ja	.L37
+	jmp	.L34
+.L139:
+	xorl	%eax, %eax
+	cmpl	%edx, %r11d
+	setnb	%al
+	jmp	.L5
+.L133:
+	movl	48(%rsp), %ebx
+	jmp	.L1
+.L144:
+	movq	$0, (%rsi)
+	jmp	.L34
+.L142:
+	xorl	%ebx, %ebx
+	cmpl	%edx, %ecx
+	setnb	%bl
+	jmp	.L8
+.L148:
+	movq	$0, (%rax)
+	jmp	.L34
+.L145:
+	xorl	%eax, %eax
+	jmp	.L42
+.L63:
+	movl	$132, %r9d
+	jmp	.L38
+.L149:
+	movq	16(%rsp), %r10
+	movq	%rsi, %rcx
+.L32:
+	cmpq	%rcx, %r10
+	jne	.L34
+	movl	80(%rsp), %edx
+	testl	%edx, %edx
+	je	.L51
+	movq	8(%rsp), %rcx
+	movq	24(%rsp), %rsi
+	movq	16(%rcx), %rdx
+	addq	%rdx, %rsi
+.L53:
+	movl	(%rdx), %ecx
+	testl	%ecx, %ecx
+	je	.L52
+	movq	8(%rsp), %rdi
+	subl	$1, %ecx
+	imulq	$456, %rcx, %rcx
+	addq	(%rdi), %rcx
+	cmpq	$0, (%rcx)
+	je	.L34
+.L52:
+	addq	$4, %rdx
+	cmpq	%rsi, %rdx
+	jne	.L53
+.L51:
+	movq	8(%rsp), %rbp
+	xorl	%ebx, %ebx
+	testl	%eax, %eax
+	je	.L56
+.L54:
+	movl	%ebx, %edx
+	imulq	$456, %rdx, %rdx
+	addq	0(%rbp), %rdx
+	movq	(%rdx), %rsi
+	testq	%rsi, %rsi
+	je	.L55
+	movq	%rbp, %rdi
+	call	wavefrontMTLFindMaterial@PLT
+	cmpl	%ebx, %eax
+	jne	.L34
+	movl	8(%rbp), %eax
+.L55:
+	addl	$1, %ebx
+	cmpl	%eax, %ebx
+	jb	.L54
+.L56:
+	xorl	%ebx, %ebx
+	jmp	.L1
+	.cfi_endproc
+.LFE39:
+	.size	deserialize, .-deserialize
+	.p2align 4
+	.globl	wavefrontMTLSerialize
+	.type	wavefrontMTLSerialize, @function
+wavefrontMTLSerialize:
+.LFB34:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r9
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movl	8(%rdi), %eax
+	movq	%rsi, 88(%rsp)
+	movq	%rax, %rbx
+	movq	%rax, %r14
+	movq	%rdx, 96(%rsp)
+	salq	$5, %rbx
+	addq	%rax, %rbx
+	movl	40(%rdi), %eax
+	salq	$2, %rbx
+	testl	%eax, %eax
+	je	.L189
+	movq	32(%rdi), %r13
+	xorl	%r12d, %r12d
+	movq	%rdi, %r15
+	leaq	0(%r13,%rax,8), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	movq	0(%r13), %rdi
+	testq	%rdi, %rdi
+	je	.L152
+	call	strlen@PLT
+	leaq	1(%r12,%rax), %r12
+.L152:
+	addq	$8, %r13
+	cmpq	%rbp, %r13
+	jne	.L153
+	movq	%r15, %r9
+.L151:
+	testl	%r14d, %r14d
+	je	.L154
+	xorl	%r13d, %r13d
+	movq	%r9, %r14
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	movl	%r13d, %ebp
+	imulq	$456, %rbp, %rbp
+	addq	(%r14), %rbp
+	movq	0(%rbp), %rdi
+	testq	%rdi, %rdi
+	je	.L155
+	call	strlen@PLT
+	leaq	1(%r12,%rax), %r12
+.L155:
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L157:
+	movq	%rbp, %rdi
+	movl	%r15d, %esi
+	call	wavefrontMaterialMap@PLT
+	movq	(%rax), %rdi
+	testq	%rdi, %rdi
+	je	.L156
+	movl	8(%rax), %r11d
+	addq	$12, %rbx
+	testl	%r11d, %r11d
+	jne	.L156
+	call	strlen@PLT
+	leaq	1(%r12,%rax), %r12
+.L156:
+	addl	$1, %r15d
+	cmpl	$20, %r15d
+	jne	.L157
+	addl	$1, %r13d
+	cmpl	8(%r14), %r13d
+	jb	.L158
+	movq	%r14, %r9
+.L154:
+	movl	$4294967294, %eax
+	cmpq	%r12, %rax
+	jb	.L190
+	movq	%rbx, %rax
+	shrq	$32, %rax
+	jne	.L190
+	movl	24(%r9), %edx
+	movl	40(%r9), %eax
+	movq	%r9, 8(%rsp)
+	movq	104(%r9), %rdi
+	addq	%rdx, %rax
+	movl	56(%r9), %edx
+	addq	%rdx, %rax
+	movl	72(%r9), %edx
+	salq	$6, %rdx
+	leaq	36(%rdx,%rax,4), %rax
+	addq	%r12, %rax
+	leaq	(%rax,%rbx), %rsi
+	movq	%rsi, 80(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	8(%rsp), %r9
+	movq	%rax, 72(%rsp)
+	movq	%rax, %r14
+	movl	40(%r9), %eax
+	movq	104(%r9), %rdi
+	leal	1(%rax), %esi
+	salq	$2, %rsi
+	call	wavefrontAllocateWith@PLT
+	testq	%r14, %r14
+	movq	8(%rsp), %r9
+	movq	%rax, %r10
+	je	.L196
+	testq	%rax, %rax
+	je	.L196
+	movq	72(%rsp), %r14
+	movl	$4, %edx
+	movq	%r9, 16(%rsp)
+	movzbl	%bh, %ebp
+	leaq	magic(%rip), %rsi
+	movq	%rax, 8(%rsp)
+	movq	%r14, %rdi
+	call	memcpy@PLT
+	movq	16(%rsp), %r9
+	movl	.LC1(%rip), %eax
+	movl	%ebx, %r8d
+	shrl	$16, %r8d
+	movl	%eax, 4(%r14)
+	movl	8(%r9), %eax
+	movzbl	%r8b, %r8d
+	movl	%eax, 8(%r14)
+	movl	40(%r9), %eax
+	movl	%eax, 12(%r14)
+	movl	72(%r9), %eax
+	movl	%eax, 16(%r14)
+	movl	24(%r9), %eax
+	movl	%eax, 20(%r14)
+	movl	%ebx, %eax
+	movl	56(%r9), %edx
+	movzbl	%bl, %ebx
+	shrl	$24, %eax
+	movl	%r12d, 32(%r14)
+	movzbl	%al, %eax
+	movl	%edx, %edi
+	movl	%edx, %esi
+	movl	%edx, %ecx
+	salq	$8, %rax
+	shrl	$24, %edi
+	movzbl	%dl, %edx
+	shrl	$16, %esi
+	orq	%r8, %rax
+	movzbl	%dil, %edi
+	shrl	$8, %ecx
+	salq	$8, %rax
+	movzbl	%sil, %esi
+	movzbl	%cl, %ecx
+	orq	%rbp, %rax
+	leaq	36(%r14), %rbp
+	salq	$8, %rax
+	orq	%rbx, %rax
+	salq	$8, %rax
+	orq	%rdi, %rax
+	salq	$8, %rax
+	orq	%rsi, %rax
+	salq	$8, %rax
+	orq	%rcx, %rax
+	salq	$8, %rax
+	orq	%rdx, %rax
+	movq	%rax, 24(%r14)
+	movl	72(%r9), %r10d
+	testl	%r10d, %r10d
+	movq	8(%rsp), %r10
+	je	.L162
+	movq	%r12, 16(%rsp)
+	xorl	%r13d, %r13d
+	leaq	120(%rsp), %r14
+	leaq	124(%rsp), %rbx
+	movq	%r10, 24(%rsp)
+	movq	%r9, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	movq	8(%rsp), %rax
+	movl	%r13d, %r9d
+	xorl	%r15d, %r15d
+	salq	$6, %r9
+	addq	64(%rax), %r9
+	movq	%r9, %r12
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	movss	(%r12,%r15), %xmm0
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movl	%eax, 0(%rbp,%r15)
+	addq	$4, %r15
+	cmpq	$12, %r15
+	jne	.L163
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	movss	(%r12,%r15), %xmm0
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movl	%eax, 0(%rbp,%r15)
+	addq	$4, %r15
+	cmpq	$24, %r15
+	jne	.L164
+	.p2align 4,,10
+	.p2align 3
+.L165:
+	movss	(%r12,%r15), %xmm0
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movl	%eax, 0(%rbp,%r15)
+	addq	$4, %r15
+	cmpq	$36, %r15
+	jne	.L165
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	addl	$1, %r13d
+	movss	36(%r12), %xmm0
+	addq	$64, %rbp
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	%eax, -28(%rbp)
+	movss	40(%r12), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	%eax, -24(%rbp)
+	movss	44(%r12), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	%eax, -20(%rbp)
+	movss	48(%r12), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movl	%eax, %edx
+	movb	%al, -16(%rbp)
+	movb	%ah, -15(%rbp)
+	shrl	$16, %edx
+	shrl	$24, %eax
+	movb	%dl, -14(%rbp)
+	movb	%al, -13(%rbp)
+	movl	52(%r12), %eax
+	movl	%eax, %edx
+	movb	%al, -12(%rbp)
+	movb	%ah, -11(%rbp)
+	shrl	$16, %edx
+	shrl	$24, %eax
+	movb	%dl, -10(%rbp)
+	movb	%al, -9(%rbp)
+	movl	56(%r12), %eax
+	movl	%eax, %edx
+	movb	%al, -8(%rbp)
+	movb	%ah, -7(%rbp)
+	shrl	$16, %edx
+	shrl	$24, %eax
+	movb	%dl, -6(%rbp)
+	movb	%al, -5(%rbp)
+	movl	60(%r12), %eax
+	movl	%eax, %edx
+	movb	%al, -4(%rbp)
+	movb	%ah, -3(%rbp)
+	shrl	$24, %eax
+	shrl	$16, %edx
+	movb	%al, -1(%rbp)
+	movq	8(%rsp), %rax
+	movb	%dl, -2(%rbp)
+	cmpl	72(%rax), %r13d
+	jb	.L166
+	movq	16(%rsp), %r12
+	movq	24(%rsp), %r10
+	movq	%rax, %r9
+.L162:
+	movq	80(%rsp), %rax
+	movq	72(%rsp), %rcx
+	movl	40(%r9), %r8d
+	subq	%r12, %rax
+	addq	%rcx, %rax
+	movq	%rax, 32(%rsp)
+	testl	%r8d, %r8d
+	je	.L167
+	movq	32(%r9), %rdx
+	movq	%rbp, 24(%rsp)
+	xorl	%r14d, %r14d
+	xorl	%ebx, %ebx
+	movq	%r10, %rbp
+.L171:
+	movl	%ebx, %eax
+	movq	(%rdx,%rax,8), %r13
+	leaq	0(%rbp,%rax,4), %r15
+	testq	%r13, %r13
+	je	.L168
+.L234:
+	movq	%r13, %rdi
+	movq	%r9, 16(%rsp)
+	addl	$1, %ebx
+	movl	%r14d, 8(%rsp)
+	call	strlen@PLT
+	movq	%r13, %rsi
+	leaq	1(%rax), %r12
+	movq	32(%rsp), %rax
+	movq	%r12, %rdx
+	leaq	(%rax,%r14), %rdi
+	addq	%r12, %r14
+	call	memcpy@PLT
+	movl	8(%rsp), %ecx
+	movq	16(%rsp), %r9
+	movl	%ecx, (%r15)
+	movl	40(%r9), %eax
+	cmpl	%eax, %ebx
+	jnb	.L170
+	movq	32(%r9), %rdx
+	movl	%ebx, %eax
+	leaq	0(%rbp,%rax,4), %r15
+	movq	(%rdx,%rax,8), %r13
+	testq	%r13, %r13
+	jne	.L234
+.L168:
+	movl	$-1, (%r15)
+	movl	40(%r9), %eax
+	addl	$1, %ebx
+	cmpl	%eax, %ebx
+	jb	.L171
+.L170:
+	movl	8(%r9), %edi
+	movq	%rbp, %r10
+	movq	%r14, %rcx
+	movq	24(%rsp), %rbp
+	testl	%edi, %edi
+	je	.L172
+.L188:
+	leaq	120(%rsp), %rax
+	movl	$0, 44(%rsp)
+	movq	%rbp, %r8
+	leaq	124(%rsp), %rbx
+	movq	%rax, 64(%rsp)
+	movl	$1, %r14d
+	movq	%rcx, %rbp
+	movq	%r10, 104(%rsp)
+	movq	%r9, 48(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	movl	44(%rsp), %r12d
+	movq	48(%rsp), %rax
+	imulq	$456, %r12, %r12
+	addq	(%rax), %r12
+	movq	(%r12), %r15
+	testq	%r15, %r15
+	je	.L191
+	movq	%r15, %rdi
+	movq	%r8, 8(%rsp)
+	call	strlen@PLT
+	movq	%r15, %rsi
+	leaq	1(%rax), %r13
+	movq	32(%rsp), %rax
+	movq	%r13, %rdx
+	leaq	(%rax,%rbp), %rdi
+	call	memcpy@PLT
+	movq	8(%rsp), %r8
+	movl	%ebp, %eax
+	addq	%r13, %rbp
+.L173:
+	leaq	colorOffsets(%rip), %r15
+	movl	%eax, (%r8)
+	leaq	4(%r8), %r13
+	movq	%r8, 16(%rsp)
+	movq	%r12, 8(%rsp)
+	movq	%rbp, 24(%rsp)
+	movq	%r15, %rbp
+	movq	64(%rsp), %r15
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	movq	8(%rsp), %r12
+	addq	0(%rbp), %r12
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movss	(%r12), %xmm0
+	movl	$4, %edx
+	addq	$8, %rbp
+	addq	$16, %r13
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	%eax, -16(%r13)
+	movss	4(%r12), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	%eax, -12(%r13)
+	movss	8(%r12), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movl	$4, %edx
+	movl	%eax, -8(%r13)
+	movss	12(%r12), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movl	%eax, -4(%r13)
+	leaq	40+colorOffsets(%rip), %rax
+	cmpq	%rax, %rbp
+	jne	.L174
+	movq	16(%rsp), %r8
+	movq	8(%rsp), %r12
+	leaq	scalarOffsets(%rip), %r13
+	movq	24(%rsp), %rbp
+	leaq	84(%r8), %r15
+	movq	%r8, 8(%rsp)
+	movq	%rbp, 16(%rsp)
+	movq	%r12, %rbp
+	movq	%r15, %r12
+	movq	64(%rsp), %r15
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movq	0(%r13), %rax
+	movl	$4, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	addq	$8, %r13
+	addq	$4, %r12
+	movss	0(%rbp,%rax), %xmm0
+	movss	%xmm0, 120(%rsp)
+	call	memcpy@PLT
+	movl	124(%rsp), %eax
+	movl	%eax, -4(%r12)
+	leaq	80+scalarOffsets(%rip), %rax
+	cmpq	%rax, %r13
+	jne	.L175
+	movq	%rbp, %r12
+	movq	8(%rsp), %r8
+	xorl	%r15d, %r15d
+	movq	16(%rsp), %rbp
+	movl	128(%r12), %eax
+	movq	%rbx, 8(%rsp)
+	xorl	%r13d, %r13d
+	movl	%r15d, %ebx
+	movq	%r8, %r15
+	movl	%eax, 124(%r8)
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	movl	%ebx, %esi
+	movq	%r12, %rdi
+	call	wavefrontMaterialMap@PLT
+	cmpq	$0, (%rax)
+	je	.L176
+	movl	%r14d, %eax
+	movl	%ebx, %ecx
+	sall	%cl, %eax
+	orl	%eax, %r13d
+.L176:
+	addl	$1, %ebx
+	cmpl	$20, %ebx
+	jne	.L177
+	movq	8(%rsp), %rbx
+	movq	%r15, %r8
+	movl	%r13d, %eax
+	xorl	%ecx, %ecx
+	shrl	$16, %eax
+	addq	$132, %r8
+	movw	%r13w, 128(%r15)
+	movb	%al, 130(%r15)
+	movb	$0, 131(%r15)
+	movq	%r8, %r15
+	movq	%rbx, 56(%rsp)
+	movl	%ecx, %ebx
+	jmp	.L180
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	movl	$-1, %eax
+	movl	$-1, %esi
+	movl	$-1, %edi
+	movl	$-1, %r10d
+.L179:
+	movb	%r10b, (%r15)
+	addq	$12, %r15
+	movb	%dil, -11(%r15)
+	movb	%sil, -10(%r15)
+	movb	%al, -9(%r15)
+	movl	8(%r9), %eax
+	movl	%eax, -8(%r15)
+	movl	12(%r9), %eax
+	movl	%eax, -4(%r15)
+.L178:
+	addl	$1, %ebx
+	cmpl	$20, %ebx
+	je	.L235
+.L180:
+	movl	%r14d, %eax
+	movl	%ebx, %ecx
+	sall	%cl, %eax
+	testl	%r13d, %eax
+	je	.L178
+	movl	%ebx, %esi
+	movq	%r12, %rdi
+	call	wavefrontMaterialMap@PLT
+	movl	8(%rax), %esi
+	movq	%rax, %r9
+	testl	%esi, %esi
+	jne	.L193
+	movq	(%rax), %rsi
+	testq	%rsi, %rsi
+	je	.L193
+	movq	%rsi, %rdi
+	movq	%rsi, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	call	strlen@PLT
+	movq	16(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	movq	32(%rsp), %rax
+	movq	%rdx, 8(%rsp)
+	leaq	(%rax,%rbp), %rdi
+	call	memcpy@PLT
+	movq	%rbp, %rax
+	movq	8(%rsp), %rdx
+	movl	%ebp, %esi
+	movzbl	%ah, %edi
+	movl	%ebp, %eax
+	movl	%ebp, %r10d
+	movq	24(%rsp), %r9
+	shrl	$16, %esi
+	shrl	$24, %eax
+	addq	%rdx, %rbp
+	jmp	.L179
+.L196:
+	movq	104(%r9), %rdi
+	movq	72(%rsp), %rsi
+	movq	%r10, 16(%rsp)
+	movq	%r9, 8(%rsp)
+	call	wavefrontFreeWith@PLT
+	movq	8(%rsp), %r9
+	movq	16(%rsp), %rsi
+	movq	104(%r9), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	$1, %eax
+.L150:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L235:
+	.cfi_restore_state
+	movq	48(%rsp), %rcx
+	addl	$1, 44(%rsp)
+	movq	%r15, %r8
+	movq	56(%rsp), %rbx
+	movl	44(%rsp), %eax
+	cmpl	8(%rcx), %eax
+	jb	.L181
+	movq	104(%rsp), %r10
+	movl	40(%rcx), %eax
+	movq	%r15, %rbp
+	movq	%rcx, %r9
+.L172:
+	testl	%eax, %eax
+	je	.L182
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	movl	%eax, %edx
+	addq	$4, %rbp
+	addl	$1, %eax
+	movl	(%r10,%rdx,4), %edx
+	movl	%edx, -4(%rbp)
+	cmpl	40(%r9), %eax
+	jb	.L183
+.L182:
+	movl	24(%r9), %ecx
+	testl	%ecx, %ecx
+	je	.L184
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L185:
+	movq	16(%r9), %rdx
+	movl	%eax, %ecx
+	addq	$4, %rbp
+	addl	$1, %eax
+	movl	(%rdx,%rcx,4), %edx
+	movl	%edx, -4(%rbp)
+	cmpl	24(%r9), %eax
+	jb	.L185
+.L184:
+	movl	56(%r9), %edx
+	xorl	%eax, %eax
+	testl	%edx, %edx
+	je	.L187
+	.p2align 4,,10
+	.p2align 3
+.L186:
+	movq	48(%r9), %rdx
+	movl	%eax, %ecx
+	movl	(%rdx,%rcx,4), %edx
+	movl	%edx, 0(%rbp,%rax,4)
+	addq	$1, %rax
+	cmpl	56(%r9), %eax
+	jb	.L186
+.L187:
+	movq	104(%r9), %rdi
+	movq	%r10, %rsi
+	call	wavefrontFreeWith@PLT
+	movq	88(%rsp), %rax
+	movq	72(%rsp), %rcx
+	movq	%rcx, (%rax)
+	movq	96(%rsp), %rax
+	movq	80(%rsp), %rcx
+	movq	%rcx, (%rax)
+	xorl	%eax, %eax
+	jmp	.L150
+.L191:
+	movl	.LC0(%rip), %eax
+	jmp	.L173
+.L190:
+	movl	$2, %eax
+	jmp	.L150
+.L189:
+	xorl	%r12d, %r12d
+	jmp	.L151
+.L167:
+	movl	8(%r9), %eax
+	xorl	%ecx, %ecx
+	testl	%eax, %eax
+	jne	.L188
+	jmp	.L182
+	.cfi_endproc
+.LFE34:
+	.size	wavefrontMTLSerialize, .-wavefrontMTLSerialize
+	.p2align 4
+	.globl	wavefrontMTLDeserialize
+	.type	wavefrontMTLDeserialize, @function
+wavefrontMTLDeserialize:
+.LFB40:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rcx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 64
+	call	wavefrontMTLCompose@PLT
+	movq	%r12, 104(%rbx)
+	testq	%rbp, %rbp
+	je	.L238
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	deserialize
+	testl	%eax, %eax
+	jne	.L243
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	.cfi_restore_state
+	movq	%rbx, %rdi
+	movl	%eax, 12(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	.cfi_restore_state
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 40
+	movl	$2, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	wavefrontMTLDeserialize, .-wavefrontMTLDeserialize
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"wb"
+	.text
+	.p2align 4
+	.globl	wavefrontMTLSaveCache
+	.type	wavefrontMTLSaveCache, @function
+wavefrontMTLSaveCache:
+.LFB41:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	leaq	8(%rsp), %rdx
+	movq	%rsp, %rsi
+	call	wavefrontMTLSerialize
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	je	.L251
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L251:
+	.cfi_restore_state
+	leaq	.LC2(%rip), %rsi
+	movq	%r12, %rdi
+	call	fopen@PLT
+	movq	(%rsp), %r13
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L248
+	movq	8(%rsp), %r14
+	movq	%r13, %rdi
+	movq	%rax, %rcx
+	movl	$1, %esi
+	movq	%r14, %rdx
+	call	fwrite@PLT
+	movq	%rbx, %rdi
+	movq	%rax, %r12
+	call	fclose@PLT
+	testl	%eax, %eax
+	jne	.L248
+	xorl	%ebx, %ebx
+	cmpq	%r12, %r14
+	setne	%bl
+	addl	%ebx, %ebx
+.L247:
+	movq	104(%rbp), %rdi
+	movq	%r13, %rsi
+	call	wavefrontFreeWith@PLT
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L248:
+	.cfi_restore_state
+	movl	$2, %ebx
+	jmp	.L247
+	.cfi_endproc
+.LFE41:
+	.size	wavefrontMTLSaveCache, .-wavefrontMTLSaveCache
+	.p2align 4
+	.globl	wavefrontMTLLoadCache
+	.type	wavefrontMTLLoadCache, @function
+wavefrontMTLLoadCache:
+.LFB42:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rsp, %r12
+	movq	%r12, %rdi
+	call	wavefrontFileMap@PLT
+	testl	%eax, %eax
+	jne	.L261
+	movq	(%rsp), %rbx
+	movq	%rbp, %rdi
+	movq	8(%rsp), %r14
+	call	wavefrontMTLCompose@PLT
+	movq	%r13, 104(%rbp)
+	testq	%rbx, %rbx
+	je	.L256
+	movq	%rbx, %rsi
+	movq	%r14, %rdx
+	movq	%rbp, %rdi
+	call	deserialize
+	movl	%eax, %ebx
+	testl	%eax, %eax
+	jne	.L262
+.L255:
+	movq	%r12, %rdi
+	call	wavefrontFileUnmap@PLT
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L261:
+	.cfi_restore_state
+	movq	%rbp, %rdi
+	movl	%eax, %ebx
+	call	wavefrontMTLCompose@PLT
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	.cfi_restore_state
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	jmp	.L255
+	.p2align 4,,10
+	.p2align 3
+.L256:
+	movl	$2, %ebx
+	jmp	.L255
+	.cfi_endproc
+.LFE42:
+	.size	wavefrontMTLLoadCache, .-wavefrontMTLLoadCache
+	.section	.rodata
+	.align 32
+	.type	scalarOffsets, @object
+	.size	scalarOffsets, 80
+scalarOffsets:
+	.quad	88
+	.quad	92
+	.quad	96
+	.quad	100
+	.quad	104
+	.quad	108
+	.quad	112
+	.quad	116
+	.quad	120
+	.quad	124
+	.align 32
+	.type	colorOffsets, @object
+	.size	colorOffsets, 40
+colorOffsets:
+	.quad	8
+	.quad	24
+	.quad	40
+	.quad	56
+	.quad	72
+	.type	magic, @object
+	.size	magic, 4
+magic:
+	.ascii	"WMTL"
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.byte	-1
+	.byte	-1
+	.byte	-1
+	.byte	-1
+	.align 4
+.LC1:
+	.byte	4
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1370 @@
+# 0 "src/wavefront_material_compact.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/wavefront_material_compact.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 2 "src/wavefront_material_compact.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 3 "src/wavefront_material_compact.c" 2
+# 1 "../cutil/src/error.h" 1
+# 4 "src/wavefront_material_compact.c" 2
+# 1 "src/wavefront_allocator.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_allocator.h" 2
+
+
+
+
+
+# 12 "src/wavefront_allocator.h"
+struct WavefrontAllocator {
+    void *(*allocate)(void *context, size_t size);
+    void *(*reallocate)(void *context, void *pointer, size_t size);
+    void (*release)(void *context, void *pointer);
+    void *context;
+};
+
+struct WavefrontAllocationStats {
+    unsigned long long allocations;
+    unsigned long long bytes;
+};
+
+
+
+
+void wavefrontSetAllocator(const struct WavefrontAllocator *allocator);
+void *wavefrontAllocate(size_t size);
+
+void *wavefrontAllocateZeroed(size_t count, size_t size);
+void *wavefrontReallocate(void *pointer, size_t size);
+void wavefrontFree(void *pointer);
+
+
+void *wavefrontAllocateWith(const struct WavefrontAllocator *allocator, size_t size);
+void *wavefrontAllocateZeroedWith(const struct WavefrontAllocator *allocator, size_t count, size_t size);
+void *wavefrontReallocateWith(const struct WavefrontAllocator *allocator, void *pointer, size_t size);
+void wavefrontFreeWith(const struct WavefrontAllocator *allocator, void *pointer);
+
+
+
+struct WavefrontAllocationStats *wavefrontTrackAllocations(struct WavefrontAllocationStats *stats);
+# 5 "src/wavefront_material_compact.c" 2
+# 1 "src/wavefront_material_compact.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_material_compact.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 9 "src/wavefront_material_compact.h" 2
+# 1 "src/wavefront_material.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_material.h" 2
+
+
+
+# 10 "src/wavefront_material.h"
+struct WavefrontColor {
+    float r, g, b, a;
+};
+# 23 "src/wavefront_material.h"
+struct WavefrontMapOptions {
+    float offset[3];
+    float scale[3];
+    float turbulence[3];
+    float bumpMultiplier;
+    float boost;
+    float base, gain;
+    int resolution;
+    int channel;
+    unsigned int flags;
+};
+
+struct WavefrontMap {
+    char *file;
+
+    unsigned int texture;
+
+    unsigned int options;
+};
+
+struct WavefrontMaterial {
+    char *name;
+    struct WavefrontColor ambient;
+    struct WavefrontColor diffuse;
+    struct WavefrontColor specular;
+    struct WavefrontColor transmission;
+    struct WavefrontColor emission;
+    float specularExponent;
+    float dissolve;
+    float opticalDensity;
+
+    float roughness;
+    float metallic;
+    float sheen;
+    float clearcoatThickness;
+    float clearcoatRoughness;
+    float anisotropy;
+    float anisotropyRotation;
+    int illuminationModel;
+    struct WavefrontMap ambientMap;
+    struct WavefrontMap diffuseMap;
+    struct WavefrontMap normalMap;
+    struct WavefrontMap specularColorMap;
+    struct WavefrontMap specularHighlightMap;
+    struct WavefrontMap alphaMap;
+    struct WavefrontMap bumpMap;
+    struct WavefrontMap displacementMap;
+    struct WavefrontMap decalMap;
+    struct WavefrontMap reflectionMapSphere;
+    struct WavefrontMap reflectionMapCubeTop;
+    struct WavefrontMap reflectionMapCubeBottom;
+    struct WavefrontMap reflectionMapCubeFront;
+    struct WavefrontMap reflectionMapCubeBack;
+    struct WavefrontMap reflectionMapCubeLeft;
+    struct WavefrontMap reflectionMapCubeRight;
+    struct WavefrontMap roughnessMap;
+    struct WavefrontMap metallicMap;
+    struct WavefrontMap sheenMap;
+    struct WavefrontMap emissionMap;
+};
+
+
+
+
+
+
+
+struct WavefrontArenaChunk;
+
+struct WavefrontMTL {
+    struct WavefrontMaterial *materials;
+    unsigned int materialCount;
+    unsigned int materialCapacity;
+
+    unsigned int *materialTable;
+    unsigned int materialTableSize;
+
+    char **textures;
+    unsigned int textureCount;
+    unsigned int textureCapacity;
+    unsigned int *textureTable;
+    unsigned int textureTableSize;
+
+    struct WavefrontMapOptions *mapOptions;
+    unsigned int mapOptionCount;
+    unsigned int mapOptionCapacity;
+    unsigned int *mapOptionTable;
+    unsigned int mapOptionTableSize;
+    unsigned int flags;
+    struct WavefrontArenaChunk *arena;
+
+
+    const struct WavefrontAllocator *allocator;
+};
+
+
+struct WavefrontMTLChanges {
+    unsigned int *added;
+    unsigned int addedCount;
+    unsigned int *removed;
+    unsigned int removedCount;
+    unsigned int *changed;
+    unsigned int changedCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+
+
+
+struct WavefrontMTLRemap {
+    int *indices;
+    unsigned int *offsets;
+    unsigned int sourceCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+void wavefrontMTLCompose(struct WavefrontMTL *mtl);
+void wavefrontMTLRelease(struct WavefrontMTL *mtl);
+
+
+
+int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name);
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length);
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string);
+
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count);
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl);
+
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name);
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length);
+
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture);
+
+
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index);
+
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map);
+
+
+
+
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other);
+
+
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b);
+
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m);
+
+
+
+
+
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes);
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes);
+
+
+
+
+
+
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap);
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap);
+
+unsigned int wavefrontMTLHashName(const char *name, size_t length);
+
+
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options);
+
+
+int wavefrontMaterialCompose(struct WavefrontMaterial *m);
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index);
+# 10 "src/wavefront_material_compact.h" 2
+
+
+
+
+
+struct WavefrontCompactMap {
+    uint32_t texture;
+    uint32_t options;
+};
+
+
+
+struct WavefrontCompactMaterial {
+    uint32_t name;
+    uint32_t maps;
+
+
+    uint32_t mapMask;
+
+
+    uint16_t colors[5][3];
+
+
+    uint16_t scalars[10];
+    uint8_t alphaMask;
+    int8_t illuminationModel;
+};
+
+
+
+
+
+
+struct WavefrontCompactMTL {
+    struct WavefrontCompactMaterial *materials;
+    unsigned int materialCount;
+    struct WavefrontCompactMap *maps;
+    unsigned int mapCount;
+
+    char **textures;
+    unsigned int textureCount;
+    struct WavefrontMapOptions *options;
+    unsigned int optionCount;
+    char *names;
+    size_t size;
+    void *storage;
+    const struct WavefrontAllocator *allocator;
+};
+
+int wavefrontCompactMTLCompose(struct WavefrontCompactMTL *compact, const struct WavefrontMTL *mtl);
+void wavefrontCompactMTLRelease(struct WavefrontCompactMTL *compact);
+
+
+
+
+void wavefrontCompactMaterialExpand(const struct WavefrontCompactMTL *compact, unsigned int index, struct WavefrontMaterial *m);
+
+
+int wavefrontCompactMTLExpand(
+    const struct WavefrontCompactMTL *compact,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontAllocator *allocator);
+# 6 "src/wavefront_material_compact.c" 2
+# 1 "src/wavefront_number.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_number.h" 2
+
+
+
+
+
+const char *parseWavefrontFloat(const char *input, const char *end, float *output);
+const char *parseWavefrontInteger(const char *input, const char *end, int *output);
+
+
+
+
+
+
+
+size_t formatWavefrontFloat(float value, char *output);
+
+
+
+
+unsigned short wavefrontFloatToHalf(float value);
+
+float wavefrontHalfToFloat(unsigned short half);
+# 7 "src/wavefront_material_compact.c" 2
+
+
+
+
+
+
+static const size_t colorOffsets[] = {
+    
+# 14 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 14 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 14 "src/wavefront_material_compact.c" 3 4
+   , 
+# 14 "src/wavefront_material_compact.c"
+   ambient
+# 14 "src/wavefront_material_compact.c" 3 4
+   )
+# 14 "src/wavefront_material_compact.c"
+                                              ,
+    
+# 15 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 15 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 15 "src/wavefront_material_compact.c" 3 4
+   , 
+# 15 "src/wavefront_material_compact.c"
+   diffuse
+# 15 "src/wavefront_material_compact.c" 3 4
+   )
+# 15 "src/wavefront_material_compact.c"
+                                              ,
+    
+# 16 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 16 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 16 "src/wavefront_material_compact.c" 3 4
+   , 
+# 16 "src/wavefront_material_compact.c"
+   specular
+# 16 "src/wavefront_material_compact.c" 3 4
+   )
+# 16 "src/wavefront_material_compact.c"
+                                               ,
+    
+# 17 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 17 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 17 "src/wavefront_material_compact.c" 3 4
+   , 
+# 17 "src/wavefront_material_compact.c"
+   transmission
+# 17 "src/wavefront_material_compact.c" 3 4
+   )
+# 17 "src/wavefront_material_compact.c"
+                                                   ,
+    
+# 18 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 18 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 18 "src/wavefront_material_compact.c" 3 4
+   , 
+# 18 "src/wavefront_material_compact.c"
+   emission
+# 18 "src/wavefront_material_compact.c" 3 4
+   )
+
+# 19 "src/wavefront_material_compact.c"
+};
+static const size_t scalarOffsets[] = {
+    
+# 21 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 21 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 21 "src/wavefront_material_compact.c" 3 4
+   , 
+# 21 "src/wavefront_material_compact.c"
+   specularExponent
+# 21 "src/wavefront_material_compact.c" 3 4
+   )
+# 21 "src/wavefront_material_compact.c"
+                                                       ,
+    
+# 22 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 22 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 22 "src/wavefront_material_compact.c" 3 4
+   , 
+# 22 "src/wavefront_material_compact.c"
+   dissolve
+# 22 "src/wavefront_material_compact.c" 3 4
+   )
+# 22 "src/wavefront_material_compact.c"
+                                               ,
+    
+# 23 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 23 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 23 "src/wavefront_material_compact.c" 3 4
+   , 
+# 23 "src/wavefront_material_compact.c"
+   opticalDensity
+# 23 "src/wavefront_material_compact.c" 3 4
+   )
+# 23 "src/wavefront_material_compact.c"
+                                                     ,
+    
+# 24 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 24 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 24 "src/wavefront_material_compact.c" 3 4
+   , 
+# 24 "src/wavefront_material_compact.c"
+   roughness
+# 24 "src/wavefront_material_compact.c" 3 4
+   )
+# 24 "src/wavefront_material_compact.c"
+                                                ,
+    
+# 25 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 25 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 25 "src/wavefront_material_compact.c" 3 4
+   , 
+# 25 "src/wavefront_material_compact.c"
+   metallic
+# 25 "src/wavefront_material_compact.c" 3 4
+   )
+# 25 "src/wavefront_material_compact.c"
+                                               ,
+    
+# 26 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 26 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 26 "src/wavefront_material_compact.c" 3 4
+   , 
+# 26 "src/wavefront_material_compact.c"
+   sheen
+# 26 "src/wavefront_material_compact.c" 3 4
+   )
+# 26 "src/wavefront_material_compact.c"
+                                            ,
+    
+# 27 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 27 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 27 "src/wavefront_material_compact.c" 3 4
+   , 
+# 27 "src/wavefront_material_compact.c"
+   clearcoatThickness
+# 27 "src/wavefront_material_compact.c" 3 4
+   )
+# 27 "src/wavefront_material_compact.c"
+                                                         ,
+    
+# 28 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 28 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 28 "src/wavefront_material_compact.c" 3 4
+   , 
+# 28 "src/wavefront_material_compact.c"
+   clearcoatRoughness
+# 28 "src/wavefront_material_compact.c" 3 4
+   )
+# 28 "src/wavefront_material_compact.c"
+                                                         ,
+    
+# 29 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 29 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 29 "src/wavefront_material_compact.c" 3 4
+   , 
+# 29 "src/wavefront_material_compact.c"
+   anisotropy
+# 29 "src/wavefront_material_compact.c" 3 4
+   )
+# 29 "src/wavefront_material_compact.c"
+                                                 ,
+    
+# 30 "src/wavefront_material_compact.c" 3 4
+   __builtin_offsetof (
+# 30 "src/wavefront_material_compact.c"
+   struct WavefrontMaterial
+# 30 "src/wavefront_material_compact.c" 3 4
+   , 
+# 30 "src/wavefront_material_compact.c"
+   anisotropyRotation
+# 30 "src/wavefront_material_compact.c" 3 4
+   )
+
+# 31 "src/wavefront_material_compact.c"
+};
+
+
+
+struct Interner {
+    const void **items;
+    unsigned int count;
+    unsigned int *slots;
+    unsigned int mask;
+    size_t bytes;
+};
+
+static int internerCompose(struct Interner *interner, const struct WavefrontAllocator *allocator, unsigned int capacity) {
+    unsigned int size = 16;
+    while(size < capacity * 2) size *= 2;
+    interner->items = wavefrontAllocateWith(allocator, (capacity + 1) * sizeof(void*));
+    interner->slots = wavefrontAllocateZeroedWith(allocator, size, sizeof(unsigned int));
+    interner->count = 0;
+    interner->mask = size - 1;
+    interner->bytes = 0;
+    return interner->items && interner->slots ? 0 : 1;
+}
+
+static void internerRelease(struct Interner *interner, const struct WavefrontAllocator *allocator) {
+    wavefrontFreeWith(allocator, interner->items);
+    wavefrontFreeWith(allocator, interner->slots);
+}
+
+
+static unsigned int internFile(struct Interner *interner, const char *file) {
+    size_t length = strlen(file);
+    unsigned int slot = wavefrontMTLHashName(file, length) & interner->mask;
+    for(; interner->slots[slot]; slot = (slot + 1) & interner->mask) {
+        unsigned int index = interner->slots[slot] - 1;
+        if(strcmp(interner->items[index], file) == 0) return index;
+    }
+    interner->items[interner->count] = file;
+    interner->slots[slot] = ++interner->count;
+    interner->bytes += length + 1;
+    return interner->count - 1;
+}
+
+static unsigned int internOptions(struct Interner *interner, const struct WavefrontMapOptions *options) {
+    unsigned int slot = wavefrontMTLHashName((const char*)options, sizeof(struct WavefrontMapOptions)) & interner->mask;
+    for(; interner->slots[slot]; slot = (slot + 1) & interner->mask) {
+        unsigned int index = interner->slots[slot] - 1;
+        if(memcmp(interner->items[index], options, sizeof(struct WavefrontMapOptions)) == 0) return index;
+    }
+    interner->items[interner->count] = options;
+    interner->slots[slot] = ++interner->count;
+    return interner->count - 1;
+}
+
+static void packMaterial(
+    struct WavefrontCompactMTL *compact,
+    struct WavefrontCompactMaterial *packed,
+    const struct WavefrontMTL *mtl,
+    const struct WavefrontMaterial *m,
+    struct Interner *files,
+    struct Interner *options,
+    size_t *nameOffset
+) {
+    if(m->name) {
+        size_t length = strlen(m->name) + 1;
+        memcpy(compact->names + *nameOffset, m->name, length);
+        packed->name = (uint32_t)*nameOffset;
+        *nameOffset += length;
+    } else {
+        packed->name = 0xFFFFFFFFu;
+    }
+    packed->alphaMask = 0;
+    for(unsigned int i = 0; i < (sizeof(colorOffsets) / sizeof(colorOffsets[0])); i++) {
+        const struct WavefrontColor *color = (const struct WavefrontColor*)((const char*)m + colorOffsets[i]);
+        packed->colors[i][0] = wavefrontFloatToHalf(color->r);
+        packed->colors[i][1] = wavefrontFloatToHalf(color->g);
+        packed->colors[i][2] = wavefrontFloatToHalf(color->b);
+        if(color->a != 0) packed->alphaMask |= 1 << i;
+    }
+    for(unsigned int i = 0; i < (sizeof(scalarOffsets) / sizeof(scalarOffsets[0])); i++) {
+        packed->scalars[i] = wavefrontFloatToHalf(*(const float*)((const char*)m + scalarOffsets[i]));
+    }
+    int illuminationModel = m->illuminationModel;
+    if(illuminationModel < -128) illuminationModel = -128;
+    if(illuminationModel > 127) illuminationModel = 127;
+    packed->illuminationModel = (int8_t)illuminationModel;
+
+    packed->maps = compact->mapCount;
+    packed->mapMask = 0;
+    for(unsigned int i = 0; i < 20; i++) {
+        const struct WavefrontMap *map = wavefrontMaterialMap((struct WavefrontMaterial*)m, i);
+        if(!map->file) continue;
+        packed->mapMask |= 1u << i;
+        struct WavefrontCompactMap *compactMap = compact->maps + compact->mapCount++;
+        compactMap->texture = internFile(files, map->file);
+        compactMap->options = internOptions(options, wavefrontMTLMapOptions(mtl, map));
+    }
+}
+
+int wavefrontCompactMTLCompose(struct WavefrontCompactMTL *compact, const struct WavefrontMTL *mtl) {
+    memset(compact, 0, sizeof(struct WavefrontCompactMTL));
+    compact->allocator = mtl->allocator;
+    unsigned int mapCount = 0;
+    size_t nameBytes = 0;
+    for(unsigned int i = 0; i < mtl->materialCount; i++) {
+        struct WavefrontMaterial *m = mtl->materials + i;
+        if(m->name) nameBytes += strlen(m->name) + 1;
+        for(unsigned int j = 0; j < 20; j++) {
+            mapCount += wavefrontMaterialMap(m, j)->file != 
+# 138 "src/wavefront_material_compact.c" 3 4
+                                                           ((void *)0)
+# 138 "src/wavefront_material_compact.c"
+                                                               ;
+        }
+    }
+
+
+    struct Interner files, options;
+    memset(&files, 0, sizeof(struct Interner));
+    memset(&options, 0, sizeof(struct Interner));
+    struct WavefrontMapOptions defaults;
+    wavefrontMapOptionsCompose(&defaults);
+    int result = internerCompose(&files, compact->allocator, mapCount);
+    if(!result) result = internerCompose(&options, compact->allocator, mapCount + 1);
+    if(!result) {
+        internOptions(&options, &defaults);
+        for(unsigned int i = 0; i < mtl->materialCount; i++) {
+            for(unsigned int j = 0; j < 20; j++) {
+                const struct WavefrontMap *map = wavefrontMaterialMap(mtl->materials + i, j);
+                if(!map->file) continue;
+                internFile(&files, map->file);
+                internOptions(&options, wavefrontMTLMapOptions(mtl, map));
+            }
+        }
+
+        compact->size = files.count * sizeof(char*) +
+            mtl->materialCount * sizeof(struct WavefrontCompactMaterial) +
+            mapCount * sizeof(struct WavefrontCompactMap) +
+            options.count * sizeof(struct WavefrontMapOptions) +
+            nameBytes + files.bytes;
+        compact->storage = wavefrontAllocateWith(compact->allocator, compact->size ? compact->size : 1);
+        if(!compact->storage) result = 1;
+    }
+    if(!result) {
+        char *next = compact->storage;
+        compact->textures = (char**)next;
+        next += files.count * sizeof(char*);
+        compact->materials = (struct WavefrontCompactMaterial*)next;
+        next += mtl->materialCount * sizeof(struct WavefrontCompactMaterial);
+        compact->maps = (struct WavefrontCompactMap*)next;
+        next += mapCount * sizeof(struct WavefrontCompactMap);
+        compact->options = (struct WavefrontMapOptions*)next;
+        next += options.count * sizeof(struct WavefrontMapOptions);
+        compact->names = next;
+        next += nameBytes;
+
+        compact->textureCount = files.count;
+        for(unsigned int i = 0; i < files.count; i++) {
+            size_t length = strlen(files.items[i]) + 1;
+            memcpy(next, files.items[i], length);
+            compact->textures[i] = next;
+            next += length;
+        }
+        compact->optionCount = options.count;
+        for(unsigned int i = 0; i < options.count; i++) {
+            compact->options[i] = *(const struct WavefrontMapOptions*)options.items[i];
+        }
+        size_t nameOffset = 0;
+        for(unsigned int i = 0; i < mtl->materialCount; i++) {
+            packMaterial(compact, compact->materials + i, mtl, mtl->materials + i, &files, &options, &nameOffset);
+        }
+        compact->materialCount = mtl->materialCount;
+    }
+    internerRelease(&files, compact->allocator);
+    internerRelease(&options, compact->allocator);
+    if(result) wavefrontCompactMTLRelease(compact);
+    return result;
+}
+
+void wavefrontCompactMTLRelease(struct WavefrontCompactMTL *compact) {
+    wavefrontFreeWith(compact->allocator, compact->storage);
+    memset(compact, 0, sizeof(struct WavefrontCompactMTL));
+}
+
+void wavefrontCompactMaterialExpand(const struct WavefrontCompactMTL *compact, unsigned int index, struct WavefrontMaterial *m) {
+    const struct WavefrontCompactMaterial *packed = compact->materials + index;
+    m->name = packed->name == 0xFFFFFFFFu ? 
+# 212 "src/wavefront_material_compact.c" 3 4
+                                                      ((void *)0) 
+# 212 "src/wavefront_material_compact.c"
+                                                           : compact->names + packed->name;
+    for(unsigned int i = 0; i < (sizeof(colorOffsets) / sizeof(colorOffsets[0])); i++) {
+        struct WavefrontColor *color = (struct WavefrontColor*)((char*)m + colorOffsets[i]);
+        color->r = wavefrontHalfToFloat(packed->colors[i][0]);
+        color->g = wavefrontHalfToFloat(packed->colors[i][1]);
+        color->b = wavefrontHalfToFloat(packed->colors[i][2]);
+        color->a = packed->alphaMask & (1 << i) ? 1.0f : 0.0f;
+    }
+    for(unsigned int i = 0; i < (sizeof(scalarOffsets) / sizeof(scalarOffsets[0])); i++) {
+        *(float*)((char*)m + scalarOffsets[i]) = wavefrontHalfToFloat(packed->scalars[i]);
+    }
+    m->illuminationModel = packed->illuminationModel;
+
+    const struct WavefrontCompactMap *compactMap = compact->maps + packed->maps;
+    for(unsigned int i = 0; i < 20; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+        if(packed->mapMask & (1u << i)) {
+            map->file = compact->textures[compactMap->texture];
+            map->texture = compactMap->texture + 1;
+            map->options = compactMap->options;
+            compactMap++;
+        } else {
+            map->file = 
+# 234 "src/wavefront_material_compact.c" 3 4
+                       ((void *)0)
+# 234 "src/wavefront_material_compact.c"
+                           ;
+            map->texture = 0;
+            map->options = 0;
+        }
+    }
+}
+
+
+static void expandInto(const struct WavefrontCompactMTL *compact, unsigned int index, struct WavefrontMTL *mtl) {
+    struct WavefrontMaterial *m = mtl->materials + mtl->materialCount - 1;
+    char *name = m->name;
+    wavefrontCompactMaterialExpand(compact, index, m);
+    m->name = name;
+    for(unsigned int i = 0; i < 20; i++) {
+        struct WavefrontMap *map = wavefrontMaterialMap(m, i);
+
+        if(map->file) map->file = mtl->textures[map->texture - 1];
+    }
+}
+
+int wavefrontCompactMTLExpand(
+    const struct WavefrontCompactMTL *compact,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontAllocator *allocator
+) {
+    wavefrontMTLCompose(mtl);
+    mtl->flags = 0x1;
+    mtl->allocator = allocator;
+    int result = wavefrontMTLReserve(mtl, compact->materialCount);
+    for(unsigned int i = 0; i < compact->textureCount && !result; i++) {
+        unsigned int texture;
+        const char *file = compact->textures[i];
+        result = wavefrontMTLInternTexture(mtl, file, strlen(file), &texture);
+    }
+
+    for(unsigned int i = 1; i < compact->optionCount && !result; i++) {
+        unsigned int index;
+        result = wavefrontMTLInternMapOptions(mtl, compact->options + i, &index);
+    }
+    for(unsigned int i = 0; i < compact->materialCount && !result; i++) {
+        uint32_t name = compact->materials[i].name;
+        if(name == 0xFFFFFFFFu) {
+
+
+            mtl->materials[mtl->materialCount++].name = 
+# 278 "src/wavefront_material_compact.c" 3 4
+                                                       ((void *)0)
+# 278 "src/wavefront_material_compact.c"
+                                                           ;
+        } else {
+            const char *source = compact->names + name;
+            char *copy = wavefrontMTLCopyString(mtl, source, strlen(source));
+            result = copy ? wavefrontMTLAddMaterial(mtl, copy) : 1;
+            if(result) break;
+        }
+        expandInto(compact, i, mtl);
+    }
+    if(result) wavefrontMTLRelease(mtl);
+    return result;
+}
@@ -0,0 +1,1186 @@
+	.file	"wavefront_material_compact.c"
+	.text
+	.p2align 4
+	.type	internFile, @function
+internFile:
+.LFB2:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, (%rsp)
+	movq	%rsi, %rdi
+	call	strlen@PLT
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	movq	%rax, 8(%rsp)
+	call	wavefrontMTLHashName@PLT
+	movl	24(%rbx), %r12d
+	movq	16(%rbx), %r13
+	movq	%rbx, %rsi
+	andl	%r12d, %eax
+	movl	0(%r13,%rax,4), %ebx
+	testl	%ebx, %ebx
+	je	.L2
+	movq	(%rsi), %r14
+	movl	%eax, %r15d
+	jmp	.L4
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	leal	1(%r15), %edx
+	andl	%r12d, %edx
+	movl	%edx, %eax
+	movl	0(%r13,%rax,4), %ebx
+	movq	%rax, %r15
+	leaq	0(,%rax,4), %rcx
+	testl	%ebx, %ebx
+	je	.L5
+.L4:
+	leal	-1(%rbx), %eax
+	movq	%rbp, %rsi
+	movq	(%r14,%rax,8), %rdi
+	movq	%rax, %rbx
+	call	strcmp@PLT
+	testl	%eax, %eax
+	jne	.L12
+.L1:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L2:
+	.cfi_restore_state
+	leaq	0(,%rax,4), %rcx
+	movq	(%rsp), %rax
+	movq	(%rax), %r14
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	movq	(%rsp), %rsi
+	movl	8(%rsi), %eax
+	movq	%rbp, (%r14,%rax,8)
+	movq	16(%rsi), %rdx
+	movq	%rax, %rbx
+	leal	1(%rax), %eax
+	movl	%eax, 8(%rsi)
+	movl	%eax, (%rdx,%rcx)
+	movq	32(%rsi), %rax
+	movq	%rsi, %rcx
+	movq	8(%rsp), %rsi
+	leaq	1(%rsi,%rax), %rax
+	movq	%rax, 32(%rcx)
+	jmp	.L1
+	.cfi_endproc
+.LFE2:
+	.size	internFile, .-internFile
+	.p2align 4
+	.type	internOptions, @function
+internOptions:
+.LFB3:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	movl	$64, %esi
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rdi, 8(%rsp)
+	movq	%rbp, %rdi
+	call	wavefrontMTLHashName@PLT
+	movl	24(%rbx), %r12d
+	movq	16(%rbx), %r13
+	movq	%rbx, %rsi
+	andl	%r12d, %eax
+	movl	0(%r13,%rax,4), %ebx
+	testl	%ebx, %ebx
+	je	.L14
+	movq	(%rsi), %r14
+	movl	%eax, %r15d
+	jmp	.L16
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	leal	1(%r15), %ecx
+	andl	%r12d, %ecx
+	movl	%ecx, %eax
+	movl	0(%r13,%rax,4), %ebx
+	movq	%rax, %r15
+	leaq	0(,%rax,4), %rdx
+	testl	%ebx, %ebx
+	je	.L17
+.L16:
+	leal	-1(%rbx), %eax
+	movl	$64, %edx
+	movq	%rbp, %rsi
+	movq	(%r14,%rax,8), %rdi
+	movq	%rax, %rbx
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L23
+.L13:
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L14:
+	.cfi_restore_state
+	leaq	0(,%rax,4), %rdx
+	movq	8(%rsp), %rax
+	movq	(%rax), %r14
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	movq	8(%rsp), %rsi
+	movl	8(%rsi), %eax
+	movq	%rbp, (%r14,%rax,8)
+	movq	16(%rsi), %rcx
+	movq	%rax, %rbx
+	leal	1(%rax), %eax
+	movl	%eax, 8(%rsi)
+	movl	%eax, (%rcx,%rdx)
+	jmp	.L13
+	.cfi_endproc
+.LFE3:
+	.size	internOptions, .-internOptions
+	.p2align 4
+	.globl	wavefrontCompactMTLCompose
+	.type	wavefrontCompactMTLCompose, @function
+wavefrontCompactMTLCompose:
+.LFB5:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$96, %edx
+	movq	%rsi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 304
+	movq	%rsi, 40(%rsp)
+	xorl	%esi, %esi
+	movq	%rdi, 32(%rsp)
+	call	memset@PLT
+	movq	104(%r15), %rax
+	movq	%rax, 88(%rbx)
+	movl	8(%r15), %ebx
+	testl	%ebx, %ebx
+	je	.L25
+	xorl	%r13d, %r13d
+	xorl	%r12d, %r12d
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	movl	%r13d, %r14d
+	imulq	$456, %r14, %r14
+	addq	(%r15), %r14
+	movq	(%r14), %rdi
+	testq	%rdi, %rdi
+	je	.L26
+	call	strlen@PLT
+	leaq	1(%r12,%rax), %r12
+.L26:
+	xorl	%ebp, %ebp
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	movl	%ebp, %esi
+	movq	%r14, %rdi
+	call	wavefrontMaterialMap@PLT
+	cmpq	$1, (%rax)
+	sbbl	$-1, %ebx
+	addl	$1, %ebp
+	cmpl	$20, %ebp
+	jne	.L27
+	addl	$1, %r13d
+	cmpl	8(%r15), %r13d
+	jb	.L28
+	leaq	80(%rsp), %rdi
+	movl	$40, %edx
+	xorl	%esi, %esi
+	leaq	128(%rsp), %r13
+	movq	%rdi, 56(%rsp)
+	leaq	176(%rsp), %rbp
+	call	memset@PLT
+	movl	$40, %edx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	memset@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMapOptionsCompose@PLT
+	movq	32(%rsp), %rax
+	leal	1(%rbx), %esi
+	leal	(%rbx,%rbx), %edx
+	movq	%rsi, %rcx
+	salq	$3, %rsi
+	movq	88(%rax), %rdi
+	cmpl	$16, %edx
+	jbe	.L60
+	movl	$16, %eax
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	addl	%eax, %eax
+	cmpl	%edx, %eax
+	jb	.L30
+	movl	%eax, %r8d
+	leal	-1(%rax), %r14d
+.L29:
+	movq	%r8, 16(%rsp)
+	movl	%ecx, 24(%rsp)
+	movq	%rdi, 8(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	16(%rsp), %rsi
+	movq	8(%rsp), %rdi
+	movl	$4, %edx
+	movq	%rax, 80(%rsp)
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	80(%rsp), %rsi
+	movl	%r14d, 104(%rsp)
+	movq	%rax, 96(%rsp)
+	movl	$0, 88(%rsp)
+	movq	$0, 112(%rsp)
+	testq	%rsi, %rsi
+	je	.L31
+	testq	%rax, %rax
+	je	.L31
+	movl	24(%rsp), %ecx
+	addl	%ecx, %ecx
+	cmpl	$16, %ecx
+	jbe	.L61
+	movl	$16, %eax
+.L33:
+	addl	%eax, %eax
+	cmpl	%ecx, %eax
+	jb	.L33
+	movl	%eax, %ecx
+	leal	-1(%rax), %r14d
+.L32:
+	movq	32(%rsp), %rax
+	leal	2(%rbx), %esi
+	movq	%rcx, 16(%rsp)
+	salq	$3, %rsi
+	movq	88(%rax), %rdi
+	movq	%rdi, 8(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	16(%rsp), %rsi
+	movq	8(%rsp), %rdi
+	movl	$4, %edx
+	movq	%rax, 128(%rsp)
+	call	wavefrontAllocateZeroedWith@PLT
+	movl	%r14d, 152(%rsp)
+	cmpq	$0, 128(%rsp)
+	movq	%rax, 144(%rsp)
+	movl	$0, 136(%rsp)
+	movq	$0, 160(%rsp)
+	je	.L101
+	testq	%rax, %rax
+	je	.L101
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	xorl	%r14d, %r14d
+	call	internOptions
+	movq	40(%rsp), %rax
+	movl	8(%rax), %edx
+	testl	%edx, %edx
+	je	.L102
+	movq	%r12, 16(%rsp)
+	movq	56(%rsp), %r15
+	movq	%rax, %rbp
+	movl	%r14d, 8(%rsp)
+	movl	%ebx, 24(%rsp)
+.L36:
+	movl	8(%rsp), %r12d
+	xorl	%ebx, %ebx
+	imulq	$456, %r12, %r12
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	movq	0(%rbp), %rdi
+	movl	%ebx, %esi
+	addq	%r12, %rdi
+	call	wavefrontMaterialMap@PLT
+	movq	(%rax), %rsi
+	movq	%rax, %r14
+	testq	%rsi, %rsi
+	je	.L38
+	movq	%r15, %rdi
+	call	internFile
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	wavefrontMTLMapOptions@PLT
+	movq	%r13, %rdi
+	movq	%rax, %rsi
+	call	internOptions
+.L38:
+	addl	$1, %ebx
+	cmpl	$20, %ebx
+	jne	.L39
+	addl	$1, 8(%rsp)
+	movl	8(%rbp), %eax
+	movl	8(%rsp), %ecx
+	cmpl	%eax, %ecx
+	jb	.L36
+	movq	16(%rsp), %r12
+	movl	24(%rsp), %ebx
+.L37:
+	movl	136(%rsp), %edx
+	movq	32(%rsp), %r15
+	addq	%rax, %rdx
+	movl	88(%rsp), %eax
+	movq	88(%r15), %rdi
+	addq	%rbx, %rax
+	leaq	(%rax,%rdx,8), %rdx
+	movq	112(%rsp), %rax
+	addq	%r12, %rax
+	leaq	(%rax,%rdx,8), %rax
+	movl	$1, %edx
+	testq	%rax, %rax
+	movq	%rax, 72(%r15)
+	cmovne	%rax, %rdx
+	movq	%rdx, %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, 80(%r15)
+	testq	%rax, %rax
+	je	.L101
+	movq	32(%rsp), %rdi
+	movl	88(%rsp), %edx
+	movq	%rax, 32(%rdi)
+	movq	%rdx, %rcx
+	leaq	(%rax,%rdx,8), %rax
+	movq	40(%rsp), %rdx
+	movq	%rax, (%rdi)
+	movl	8(%rdx), %edx
+	movl	%ecx, 40(%rdi)
+	movq	%rdx, %rsi
+	salq	$6, %rdx
+	addq	%rdx, %rax
+	leaq	(%rax,%rbx,8), %rbx
+	movq	%rax, 16(%rdi)
+	movl	136(%rsp), %eax
+	movq	%rbx, 48(%rdi)
+	movq	%rax, %rdx
+	salq	$6, %rax
+	addq	%rax, %rbx
+	movq	%rbx, 64(%rdi)
+	addq	%r12, %rbx
+	testl	%ecx, %ecx
+	je	.L41
+	xorl	%r12d, %r12d
+	movq	%rdi, %r14
+.L42:
+	movq	80(%rsp), %rax
+	movl	%r12d, %r13d
+	addl	$1, %r12d
+	movq	(%rax,%r13,8), %r15
+	movq	%r15, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rdi
+	movq	%r15, %rsi
+	leaq	1(%rax), %rbp
+	movq	%rbp, %rdx
+	call	memcpy@PLT
+	movq	32(%r14), %rax
+	movq	%rbx, (%rax,%r13,8)
+	addq	%rbp, %rbx
+	cmpl	88(%rsp), %r12d
+	jb	.L42
+	movq	40(%rsp), %rax
+	movl	136(%rsp), %edx
+	movl	8(%rax), %esi
+.L41:
+	movq	32(%rsp), %rax
+	movl	%edx, 56(%rax)
+	testl	%edx, %edx
+	je	.L47
+	movq	128(%rsp), %rcx
+	movq	48(%rax), %rax
+	leaq	(%rcx,%rdx,8), %rdi
+.L46:
+	movq	(%rcx), %rdx
+	addq	$8, %rcx
+	addq	$64, %rax
+	movdqu	(%rdx), %xmm2
+	movups	%xmm2, -64(%rax)
+	movdqu	16(%rdx), %xmm3
+	movups	%xmm3, -48(%rax)
+	movdqu	32(%rdx), %xmm4
+	movups	%xmm4, -32(%rax)
+	movdqu	48(%rdx), %xmm5
+	movups	%xmm5, -16(%rax)
+	cmpq	%rcx, %rdi
+	jne	.L46
+.L47:
+	movq	$0, 72(%rsp)
+	movl	$0, 68(%rsp)
+	testl	%esi, %esi
+	je	.L45
+.L44:
+	movl	68(%rsp), %r8d
+	movq	40(%rsp), %rcx
+	movq	32(%rsp), %r15
+	imulq	$456, %r8, %r14
+	movq	(%rcx), %rax
+	salq	$6, %r8
+	addq	(%r15), %r8
+	addq	%r14, %rax
+	movq	(%rax), %rbx
+	movq	%rax, 24(%rsp)
+	movl	$-1, %eax
+	testq	%rbx, %rbx
+	je	.L48
+	movq	%rbx, %rdi
+	movq	%r8, 8(%rsp)
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	leaq	1(%rax), %rbp
+	movq	%r15, %rax
+	movq	72(%rsp), %r15
+	movq	64(%rax), %rdi
+	movq	%rbp, %rdx
+	addq	%r15, %rdi
+	call	memcpy@PLT
+	movl	%r15d, %eax
+	addq	%rbp, %r15
+	movq	8(%rsp), %r8
+	movq	%r15, 72(%rsp)
+.L48:
+	movl	%eax, (%r8)
+	movq	24(%rsp), %r14
+	leaq	12(%r8), %rbx
+	xorl	%ebp, %ebp
+	movb	$0, 62(%r8)
+	xorl	%r13d, %r13d
+	movq	%r8, %r15
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	leaq	colorOffsets(%rip), %rax
+	movq	(%rax,%rbp,8), %r12
+	addq	%r14, %r12
+	movss	(%r12), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movss	4(%r12), %xmm0
+	movw	%ax, (%rbx)
+	call	wavefrontFloatToHalf@PLT
+	movss	8(%r12), %xmm0
+	movw	%ax, 2(%rbx)
+	call	wavefrontFloatToHalf@PLT
+	movd	%r13d, %xmm1
+	ucomiss	12(%r12), %xmm1
+	movw	%ax, 4(%rbx)
+	jp	.L66
+	je	.L49
+.L66:
+	movl	$1, %eax
+	movl	%ebp, %ecx
+	sall	%cl, %eax
+	orb	%al, 62(%r15)
+.L49:
+	addq	$1, %rbp
+	addq	$6, %rbx
+	cmpq	$5, %rbp
+	jne	.L51
+	movq	24(%rsp), %r12
+	leaq	scalarOffsets(%rip), %rbx
+	leaq	42(%r15), %rbp
+	movq	%r15, %r13
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	movq	(%rbx), %rax
+	addq	$8, %rbx
+	addq	$2, %rbp
+	movss	(%r12,%rax), %xmm0
+	call	wavefrontFloatToHalf@PLT
+	movw	%ax, -2(%rbp)
+	leaq	80+scalarOffsets(%rip), %rax
+	cmpq	%rax, %rbx
+	jne	.L52
+	movq	24(%rsp), %rax
+	movl	$127, %edx
+	movq	%r13, 48(%rsp)
+	movl	$0, 8(%rsp)
+	movl	128(%rax), %eax
+	cmpl	%edx, %eax
+	cmovg	%edx, %eax
+	movl	$-128, %edx
+	cmpl	%edx, %eax
+	cmovl	%edx, %eax
+	movb	%al, 63(%r13)
+	movq	32(%rsp), %rax
+	movl	24(%rax), %eax
+	movl	$0, 8(%r13)
+	movl	%eax, 4(%r13)
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	movl	8(%rsp), %r15d
+	movq	24(%rsp), %rdi
+	movl	%r15d, %esi
+	call	wavefrontMaterialMap@PLT
+	movq	(%rax), %rsi
+	movq	%rax, %rbx
+	testq	%rsi, %rsi
+	je	.L53
+	movl	%r15d, %ecx
+	movl	$1, %eax
+	movq	56(%rsp), %rdi
+	sall	%cl, %eax
+	movq	48(%rsp), %rcx
+	orl	%eax, 8(%rcx)
+	movq	32(%rsp), %rcx
+	movl	24(%rcx), %ebp
+	movq	16(%rcx), %r14
+	leal	1(%rbp), %eax
+	salq	$3, %rbp
+	movl	%eax, 24(%rcx)
+	addq	%rbp, %r14
+	movq	%r14, 16(%rsp)
+	call	internFile
+	movq	40(%rsp), %rdi
+	movq	%rbx, %rsi
+	movl	%eax, (%r14)
+	call	wavefrontMTLMapOptions@PLT
+	movl	$64, %esi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	wavefrontMTLHashName@PLT
+	movl	152(%rsp), %r13d
+	movq	144(%rsp), %r12
+	movq	128(%rsp), %r14
+	andl	%r13d, %eax
+	movl	%eax, %ebp
+	leaq	0(,%rax,4), %rdx
+	movl	(%r12,%rax,4), %eax
+	testl	%eax, %eax
+	jne	.L56
+	jmp	.L57
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	addl	$1, %ebp
+	andl	%r13d, %ebp
+	movl	%ebp, %eax
+	leaq	0(,%rax,4), %rdx
+	movl	(%r12,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L57
+.L56:
+	subl	$1, %eax
+	movl	$64, %edx
+	movq	%rbx, %rsi
+	movq	(%r14,%rax,8), %rdi
+	movq	%rax, %r15
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L103
+.L55:
+	movq	16(%rsp), %rax
+	movl	%r15d, 4(%rax)
+.L53:
+	addl	$1, 8(%rsp)
+	movl	8(%rsp), %eax
+	cmpl	$20, %eax
+	jne	.L58
+	movq	40(%rsp), %rcx
+	addl	$1, 68(%rsp)
+	movl	68(%rsp), %eax
+	movl	8(%rcx), %esi
+	cmpl	%esi, %eax
+	jb	.L44
+.L45:
+	movq	32(%rsp), %r15
+	movq	88(%r15), %rbx
+	movl	%esi, 8(%r15)
+	movq	80(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	96(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	88(%r15), %rbx
+	movq	128(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	144(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	xorl	%eax, %eax
+	jmp	.L24
+.L101:
+	movq	80(%rsp), %rsi
+.L31:
+	movq	32(%rsp), %r15
+	movq	88(%r15), %rbx
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	96(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	88(%r15), %rbx
+	movq	128(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	144(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	80(%r15), %rsi
+	movq	88(%r15), %rdi
+	call	wavefrontFreeWith@PLT
+	movl	$96, %edx
+	xorl	%esi, %esi
+	movq	%r15, %rdi
+	call	memset@PLT
+	movl	$1, %eax
+.L24:
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.cfi_restore_state
+	movl	136(%rsp), %ecx
+	movq	%rbx, (%r14,%rcx,8)
+	movq	144(%rsp), %rsi
+	movq	%rcx, %r15
+	leal	1(%rcx), %ecx
+	movl	%ecx, 136(%rsp)
+	movl	%ecx, (%rsi,%rdx)
+	jmp	.L55
+.L25:
+	leaq	80(%rsp), %rdi
+	movl	$40, %edx
+	xorl	%esi, %esi
+	xorl	%r12d, %r12d
+	leaq	128(%rsp), %r13
+	movq	%rdi, 56(%rsp)
+	leaq	176(%rsp), %rbp
+	movl	$15, %r14d
+	call	memset@PLT
+	xorl	%esi, %esi
+	movl	$40, %edx
+	movq	%r13, %rdi
+	call	memset@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMapOptionsCompose@PLT
+	movq	32(%rsp), %rax
+	movl	$16, %r8d
+	movl	$8, %esi
+	movl	$1, %ecx
+	movq	88(%rax), %rdi
+	jmp	.L29
+.L61:
+	movl	$15, %r14d
+	movl	$16, %ecx
+	jmp	.L32
+.L102:
+	xorl	%eax, %eax
+	jmp	.L37
+.L60:
+	movl	$15, %r14d
+	movl	$16, %r8d
+	jmp	.L29
+	.cfi_endproc
+.LFE5:
+	.size	wavefrontCompactMTLCompose, .-wavefrontCompactMTLCompose
+	.p2align 4
+	.globl	wavefrontCompactMTLRelease
+	.type	wavefrontCompactMTLRelease, @function
+wavefrontCompactMTLRelease:
+.LFB6:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	80(%rdi), %rsi
+	movq	88(%rdi), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%rbx, %rdi
+	movl	$96, %edx
+	xorl	%esi, %esi
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	jmp	memset@PLT
+	.cfi_endproc
+.LFE6:
+	.size	wavefrontCompactMTLRelease, .-wavefrontCompactMTLRelease
+	.p2align 4
+	.globl	wavefrontCompactMaterialExpand
+	.type	wavefrontCompactMaterialExpand, @function
+wavefrontCompactMaterialExpand:
+.LFB7:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	salq	$6, %rbp
+	movq	%rdx, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	addq	(%rdi), %rbp
+	movl	0(%rbp), %edx
+	cmpl	$-1, %edx
+	je	.L107
+	movl	%edx, %eax
+	addq	64(%rdi), %rax
+.L107:
+	movq	%rax, (%rbx)
+	leaq	12(%rbp), %r12
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	leaq	colorOffsets(%rip), %rax
+	movzwl	(%r12), %edi
+	movq	(%rax,%r15,8), %r14
+	call	wavefrontHalfToFloat@PLT
+	movzwl	2(%r12), %edi
+	addq	%rbx, %r14
+	movss	%xmm0, (%r14)
+	call	wavefrontHalfToFloat@PLT
+	movzwl	4(%r12), %edi
+	movss	%xmm0, 4(%r14)
+	call	wavefrontHalfToFloat@PLT
+	movss	%xmm0, 8(%r14)
+	movzbl	62(%rbp), %edx
+	btl	%r15d, %edx
+	jnc	.L108
+	addq	$1, %r15
+	movl	$0x3f800000, 12(%r14)
+	addq	$6, %r12
+	cmpq	$5, %r15
+	jne	.L111
+.L110:
+	leaq	42(%rbp), %r14
+	leaq	scalarOffsets(%rip), %r12
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	movq	(%r12), %r15
+	movzwl	(%r14), %edi
+	addq	$8, %r12
+	addq	$2, %r14
+	call	wavefrontHalfToFloat@PLT
+	addq	%rbx, %r15
+	leaq	80+scalarOffsets(%rip), %rax
+	movss	%xmm0, (%r15)
+	cmpq	%rax, %r12
+	jne	.L112
+	movsbl	63(%rbp), %eax
+	movl	4(%rbp), %edx
+	xorl	%r15d, %r15d
+	movl	$1, %r12d
+	movl	%eax, 128(%rbx)
+	movq	16(%r13), %rax
+	leaq	(%rax,%rdx,8), %r14
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	movl	%r15d, %esi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialMap@PLT
+	movl	%r12d, %edx
+	movl	%r15d, %ecx
+	sall	%cl, %edx
+	andl	8(%rbp), %edx
+	je	.L113
+	movl	(%r14), %esi
+	movq	32(%r13), %rcx
+	addl	$1, %r15d
+	addq	$8, %r14
+	movq	%rsi, %rdx
+	movq	(%rcx,%rsi,8), %rcx
+	addl	$1, %edx
+	movl	%edx, 8(%rax)
+	movl	-4(%r14), %edx
+	movq	%rcx, (%rax)
+	movl	%edx, 12(%rax)
+	cmpl	$20, %r15d
+	jne	.L116
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	.cfi_restore_state
+	addl	$1, %r15d
+	movq	$0, (%rax)
+	movq	$0, 8(%rax)
+	cmpl	$20, %r15d
+	jne	.L116
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L108:
+	.cfi_restore_state
+	addq	$1, %r15
+	movl	$0x00000000, 12(%r14)
+	addq	$6, %r12
+	cmpq	$5, %r15
+	jne	.L111
+	jmp	.L110
+	.cfi_endproc
+.LFE7:
+	.size	wavefrontCompactMaterialExpand, .-wavefrontCompactMaterialExpand
+	.p2align 4
+	.globl	wavefrontCompactMTLExpand
+	.type	wavefrontCompactMTLExpand, @function
+wavefrontCompactMTLExpand:
+.LFB9:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	movq	%rsi, %rdi
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdx, %rbx
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 80
+	call	wavefrontMTLCompose@PLT
+	movl	$1, 92(%rbp)
+	movl	8(%r12), %esi
+	movq	%rbp, %rdi
+	movq	%rbx, 104(%rbp)
+	call	wavefrontMTLReserve@PLT
+	movl	40(%r12), %esi
+	testl	%eax, %eax
+	sete	%cl
+	movl	%ecx, %edx
+	testl	%esi, %esi
+	je	.L129
+	testb	%cl, %cl
+	je	.L129
+	xorl	%r13d, %r13d
+	leaq	28(%rsp), %rbx
+	jmp	.L130
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	testb	%dl, %dl
+	je	.L129
+.L130:
+	movq	32(%r12), %rax
+	movl	%r13d, %edx
+	addl	$1, %r13d
+	movq	(%rax,%rdx,8), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rcx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	testl	%eax, %eax
+	sete	%dl
+	cmpl	40(%r12), %r13d
+	jb	.L175
+.L129:
+	cmpl	$1, 56(%r12)
+	jbe	.L132
+	testb	%dl, %dl
+	je	.L132
+	movl	$1, %r13d
+	leaq	28(%rsp), %rbx
+	jmp	.L133
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	testb	%dl, %dl
+	je	.L132
+.L133:
+	movl	%r13d, %esi
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	addl	$1, %r13d
+	salq	$6, %rsi
+	addq	48(%r12), %rsi
+	call	wavefrontMTLInternMapOptions@PLT
+	testl	%eax, %eax
+	sete	%dl
+	cmpl	56(%r12), %r13d
+	jb	.L176
+.L132:
+	movl	8(%r12), %ecx
+	testl	%ecx, %ecx
+	je	.L135
+	testb	%dl, %dl
+	je	.L135
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	movl	%r13d, %eax
+	salq	$6, %rax
+	addq	(%r12), %rax
+	movl	(%rax), %eax
+	cmpl	$-1, %eax
+	jne	.L136
+	movl	8(%rbp), %edx
+	movq	0(%rbp), %rcx
+	leal	1(%rdx), %eax
+	imulq	$456, %rdx, %rdx
+	movl	%eax, 8(%rbp)
+	movq	$0, (%rcx,%rdx)
+.L137:
+	imulq	$456, %rax, %rax
+	movl	%r13d, %esi
+	movq	%r12, %rdi
+	leaq	-456(%rcx,%rax), %rbx
+	movq	(%rbx), %r14
+	movq	%rbx, %rdx
+	call	wavefrontCompactMaterialExpand
+	movq	%r14, (%rbx)
+	xorl	%r14d, %r14d
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movl	%r14d, %esi
+	movq	%rbx, %rdi
+	call	wavefrontMaterialMap@PLT
+	cmpq	$0, (%rax)
+	je	.L139
+	movl	8(%rax), %edx
+	leal	-1(%rdx), %ecx
+	movq	32(%rbp), %rdx
+	movq	(%rdx,%rcx,8), %rdx
+	movq	%rdx, (%rax)
+.L139:
+	addl	$1, %r14d
+	cmpl	$20, %r14d
+	jne	.L140
+	addl	$1, %r13d
+	cmpl	8(%r12), %r13d
+	jb	.L141
+	xorl	%eax, %eax
+	jmp	.L128
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	movl	%eax, %ebx
+	addq	64(%r12), %rbx
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLCopyString@PLT
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L145
+	movq	%rbp, %rdi
+	call	wavefrontMTLAddMaterial@PLT
+	testl	%eax, %eax
+	jne	.L143
+	movq	0(%rbp), %rcx
+	movl	8(%rbp), %eax
+	jmp	.L137
+.L145:
+	movl	$1, %eax
+.L143:
+	movq	%rbp, %rdi
+	movl	%eax, 12(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	12(%rsp), %eax
+.L128:
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.L135:
+	.cfi_restore_state
+	testl	%eax, %eax
+	jne	.L143
+	xorl	%eax, %eax
+	jmp	.L128
+	.cfi_endproc
+.LFE9:
+	.size	wavefrontCompactMTLExpand, .-wavefrontCompactMTLExpand
+	.section	.rodata
+	.align 32
+	.type	scalarOffsets, @object
+	.size	scalarOffsets, 80
+scalarOffsets:
+	.quad	88
+	.quad	92
+	.quad	96
+	.quad	100
+	.quad	104
+	.quad	108
+	.quad	112
+	.quad	116
+	.quad	120
+	.quad	124
+	.align 32
+	.type	colorOffsets, @object
+	.size	colorOffsets, 40
+colorOffsets:
+	.quad	8
+	.quad	24
+	.quad	40
+	.quad	56
+	.quad	72
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3908 @@
+# 0 "src/wavefront_material_parser.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/wavefront_material_parser.c"
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 2 "src/wavefront_material_parser.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 3 "src/wavefront_material_parser.c" 2
+# 1 "../cutil/src/error.h" 1
+# 4 "src/wavefront_material_parser.c" 2
+# 1 "../cutil/src/string.h" 1
+
+
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 4 "../cutil/src/string.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 5 "../cutil/src/string.h" 2
+
+
+
+# 7 "../cutil/src/string.h"
+char *strCopy(const char *s);
+char *strCopyN(const char *s, size_t n);
+const char *strStartsWith(const char *s, const char *prefix);
+const char *strAfterWhitespace(const char *s);
+int tokenize(const char **thisToken, const char **nextDelim, const char **nextToken, const char *delims);
+# 5 "src/wavefront_material_parser.c" 2
+# 1 "src/wavefront_allocator.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_allocator.h" 2
+
+
+
+
+struct WavefrontAllocator {
+    void *(*allocate)(void *context, size_t size);
+    void *(*reallocate)(void *context, void *pointer, size_t size);
+    void (*release)(void *context, void *pointer);
+    void *context;
+};
+
+struct WavefrontAllocationStats {
+    unsigned long long allocations;
+    unsigned long long bytes;
+};
+
+
+
+
+void wavefrontSetAllocator(const struct WavefrontAllocator *allocator);
+void *wavefrontAllocate(size_t size);
+
+void *wavefrontAllocateZeroed(size_t count, size_t size);
+void *wavefrontReallocate(void *pointer, size_t size);
+void wavefrontFree(void *pointer);
+
+
+void *wavefrontAllocateWith(const struct WavefrontAllocator *allocator, size_t size);
+void *wavefrontAllocateZeroedWith(const struct WavefrontAllocator *allocator, size_t count, size_t size);
+void *wavefrontReallocateWith(const struct WavefrontAllocator *allocator, void *pointer, size_t size);
+void wavefrontFreeWith(const struct WavefrontAllocator *allocator, void *pointer);
+
+
+
+struct WavefrontAllocationStats *wavefrontTrackAllocations(struct WavefrontAllocationStats *stats);
+# 6 "src/wavefront_material_parser.c" 2
+# 1 "src/wavefront_material_parser.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_material_parser.h" 2
+# 1 "src/wavefront_material.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_material.h" 2
+
+
+struct WavefrontColor {
+    float r, g, b, a;
+};
+# 23 "src/wavefront_material.h"
+struct WavefrontMapOptions {
+    float offset[3];
+    float scale[3];
+    float turbulence[3];
+    float bumpMultiplier;
+    float boost;
+    float base, gain;
+    int resolution;
+    int channel;
+    unsigned int flags;
+};
+
+struct WavefrontMap {
+    char *file;
+
+    unsigned int texture;
+
+    unsigned int options;
+};
+
+struct WavefrontMaterial {
+    char *name;
+    struct WavefrontColor ambient;
+    struct WavefrontColor diffuse;
+    struct WavefrontColor specular;
+    struct WavefrontColor transmission;
+    struct WavefrontColor emission;
+    float specularExponent;
+    float dissolve;
+    float opticalDensity;
+
+    float roughness;
+    float metallic;
+    float sheen;
+    float clearcoatThickness;
+    float clearcoatRoughness;
+    float anisotropy;
+    float anisotropyRotation;
+    int illuminationModel;
+    struct WavefrontMap ambientMap;
+    struct WavefrontMap diffuseMap;
+    struct WavefrontMap normalMap;
+    struct WavefrontMap specularColorMap;
+    struct WavefrontMap specularHighlightMap;
+    struct WavefrontMap alphaMap;
+    struct WavefrontMap bumpMap;
+    struct WavefrontMap displacementMap;
+    struct WavefrontMap decalMap;
+    struct WavefrontMap reflectionMapSphere;
+    struct WavefrontMap reflectionMapCubeTop;
+    struct WavefrontMap reflectionMapCubeBottom;
+    struct WavefrontMap reflectionMapCubeFront;
+    struct WavefrontMap reflectionMapCubeBack;
+    struct WavefrontMap reflectionMapCubeLeft;
+    struct WavefrontMap reflectionMapCubeRight;
+    struct WavefrontMap roughnessMap;
+    struct WavefrontMap metallicMap;
+    struct WavefrontMap sheenMap;
+    struct WavefrontMap emissionMap;
+};
+
+
+
+
+
+
+
+struct WavefrontArenaChunk;
+
+struct WavefrontMTL {
+    struct WavefrontMaterial *materials;
+    unsigned int materialCount;
+    unsigned int materialCapacity;
+
+    unsigned int *materialTable;
+    unsigned int materialTableSize;
+
+    char **textures;
+    unsigned int textureCount;
+    unsigned int textureCapacity;
+    unsigned int *textureTable;
+    unsigned int textureTableSize;
+
+    struct WavefrontMapOptions *mapOptions;
+    unsigned int mapOptionCount;
+    unsigned int mapOptionCapacity;
+    unsigned int *mapOptionTable;
+    unsigned int mapOptionTableSize;
+    unsigned int flags;
+    struct WavefrontArenaChunk *arena;
+
+
+    const struct WavefrontAllocator *allocator;
+};
+
+
+struct WavefrontMTLChanges {
+    unsigned int *added;
+    unsigned int addedCount;
+    unsigned int *removed;
+    unsigned int removedCount;
+    unsigned int *changed;
+    unsigned int changedCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+
+
+
+struct WavefrontMTLRemap {
+    int *indices;
+    unsigned int *offsets;
+    unsigned int sourceCount;
+    const struct WavefrontAllocator *allocator;
+};
+
+void wavefrontMTLCompose(struct WavefrontMTL *mtl);
+void wavefrontMTLRelease(struct WavefrontMTL *mtl);
+
+
+
+int wavefrontMTLAddMaterial(struct WavefrontMTL *mtl, char *name);
+char *wavefrontMTLCopyString(struct WavefrontMTL *mtl, const char *string, size_t length);
+void wavefrontMTLFreeString(struct WavefrontMTL *mtl, char *string);
+
+int wavefrontMTLReserve(struct WavefrontMTL *mtl, unsigned int count);
+int wavefrontMTLShrinkToFit(struct WavefrontMTL *mtl);
+
+int wavefrontMTLFindMaterial(const struct WavefrontMTL *mtl, const char *name);
+int wavefrontMTLFindMaterialN(const struct WavefrontMTL *mtl, const char *name, size_t length);
+
+int wavefrontMTLInternTexture(struct WavefrontMTL *mtl, const char *file, size_t length, unsigned int *texture);
+
+
+int wavefrontMTLInternMapOptions(struct WavefrontMTL *mtl, const struct WavefrontMapOptions *options, unsigned int *index);
+
+const struct WavefrontMapOptions *wavefrontMTLMapOptions(const struct WavefrontMTL *mtl, const struct WavefrontMap *map);
+
+
+
+
+int wavefrontMTLAppend(struct WavefrontMTL *mtl, struct WavefrontMTL *other);
+
+
+int wavefrontMaterialEqual(
+    const struct WavefrontMTL *x,
+    const struct WavefrontMaterial *a,
+    const struct WavefrontMTL *y,
+    const struct WavefrontMaterial *b);
+
+unsigned int wavefrontMaterialHash(const struct WavefrontMTL *mtl, const struct WavefrontMaterial *m);
+
+
+
+
+
+int wavefrontMTLUpdate(struct WavefrontMTL *mtl, const struct WavefrontMTL *next, struct WavefrontMTLChanges *changes);
+void wavefrontMTLChangesRelease(struct WavefrontMTLChanges *changes);
+
+
+
+
+
+
+int wavefrontMTLMerge(
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTL *sources,
+    unsigned int sourceCount,
+    struct WavefrontMTLRemap *remap);
+void wavefrontMTLRemapRelease(struct WavefrontMTLRemap *remap);
+
+unsigned int wavefrontMTLHashName(const char *name, size_t length);
+
+
+void wavefrontMapOptionsCompose(struct WavefrontMapOptions *options);
+
+
+int wavefrontMaterialCompose(struct WavefrontMaterial *m);
+struct WavefrontMap *wavefrontMaterialMap(struct WavefrontMaterial *m, unsigned int index);
+# 9 "src/wavefront_material_parser.h" 2
+
+
+enum WavefrontMTLStatement {
+    WAVEFRONT_MTL_STATEMENT_OTHER,
+    WAVEFRONT_MTL_STATEMENT_MATERIAL,
+    WAVEFRONT_MTL_STATEMENT_COLOR,
+    WAVEFRONT_MTL_STATEMENT_SCALAR,
+    WAVEFRONT_MTL_STATEMENT_MAP,
+    WAVEFRONT_MTL_STATEMENT_COUNT
+};
+
+
+
+
+struct WavefrontMTLStats {
+    unsigned long long lines;
+    unsigned long long bytes;
+    unsigned int materials;
+    unsigned int duplicateMaterials;
+    struct WavefrontAllocationStats allocation;
+    unsigned long long statements[WAVEFRONT_MTL_STATEMENT_COUNT];
+    unsigned long long nanoseconds[WAVEFRONT_MTL_STATEMENT_COUNT];
+};
+
+
+enum WavefrontMTLError {
+    WAVEFRONT_MTL_ERROR_MISSING_VALUE,
+    WAVEFRONT_MTL_ERROR_BAD_VALUE,
+    WAVEFRONT_MTL_ERROR_EXTRA_VALUE,
+    WAVEFRONT_MTL_ERROR_MAP_OPTION
+};
+
+
+
+struct WavefrontMTLDiagnostic {
+    unsigned long long line;
+    unsigned long long offset;
+    char keyword[16];
+    enum WavefrontMTLError error;
+};
+
+
+struct WavefrontMTLDiagnostics {
+    struct WavefrontMTLDiagnostic *items;
+    unsigned int capacity;
+    unsigned int count;
+    unsigned long long total;
+};
+
+struct WavefrontMTLOptions {
+
+    unsigned int materialCapacity;
+
+    unsigned int flags;
+
+
+    unsigned int threadCount;
+
+    struct WavefrontMTLStats *stats;
+
+
+    const struct WavefrontAllocator *allocator;
+
+
+
+    struct WavefrontMTLDiagnostics *diagnostics;
+};
+
+
+
+struct WavefrontMTLParser {
+    struct WavefrontMTL *mtl;
+    struct WavefrontMaterial *material;
+    char *pending;
+    size_t pendingLength;
+    size_t pendingCapacity;
+    int result;
+    int selectOnly;
+    struct WavefrontMTLStats *stats;
+    struct WavefrontAllocationStats *trackedBefore;
+    const struct WavefrontAllocator *allocator;
+
+
+    struct WavefrontMTLDiagnostics *diagnostics;
+    enum WavefrontMTLError error;
+    const char *chunk;
+    const char *counted;
+    unsigned long long lines;
+    unsigned long long offset;
+};
+
+int parseWavefrontMTLFromString(struct WavefrontMTL *mtl, const char *input);
+
+
+int parseWavefrontMTLFromBuffer(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options);
+
+int parseWavefrontMTLFromFile(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontMTLOptions *options);
+
+
+
+struct WavefrontMTLBatchItem {
+    const char *path;
+    const char *input;
+    size_t length;
+    struct WavefrontMTL mtl;
+    int result;
+};
+
+
+
+
+int parseWavefrontMTLBatch(
+    struct WavefrontMTLBatchItem *items,
+    unsigned int count,
+    const struct WavefrontMTLOptions *options);
+
+
+
+int wavefrontMTLReload(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    struct WavefrontMTLChanges *changes);
+
+struct WavefrontMTLIndexEntry;
+struct WavefrontMTLIndexBlock;
+
+
+
+
+
+struct WavefrontMTLIndex {
+    const char *input;
+    size_t length;
+    struct WavefrontMTLIndexEntry *entries;
+    unsigned int entryCount;
+    unsigned int entryCapacity;
+    struct WavefrontMTLIndexBlock *blocks;
+    unsigned int blockCount;
+    unsigned int blockCapacity;
+
+    unsigned int *table;
+    unsigned int tableSize;
+    struct WavefrontMTL mtl;
+};
+
+int wavefrontMTLIndexCompose(
+    struct WavefrontMTLIndex *index,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options);
+
+
+int wavefrontMTLIndexFind(struct WavefrontMTLIndex *index, const char *name, int *material);
+void wavefrontMTLIndexRelease(struct WavefrontMTLIndex *index);
+
+
+
+int wavefrontMTLParserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options);
+int wavefrontMTLParserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length);
+int wavefrontMTLParserFinish(struct WavefrontMTLParser *parser);
+# 7 "src/wavefront_material_parser.c" 2
+# 1 "src/wavefront_file.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_file.h" 2
+
+
+
+struct WavefrontFileView {
+    const char *data;
+    size_t length;
+    void *handle;
+};
+
+int wavefrontFileMap(struct WavefrontFileView *view, const char *path);
+void wavefrontFileUnmap(struct WavefrontFileView *view);
+# 8 "src/wavefront_material_parser.c" 2
+# 1 "src/wavefront_number.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_number.h" 2
+
+
+
+
+
+const char *parseWavefrontFloat(const char *input, const char *end, float *output);
+const char *parseWavefrontInteger(const char *input, const char *end, int *output);
+
+
+
+
+
+
+
+size_t formatWavefrontFloat(float value, char *output);
+
+
+
+
+unsigned short wavefrontFloatToHalf(float value);
+
+float wavefrontHalfToFloat(unsigned short half);
+# 9 "src/wavefront_material_parser.c" 2
+# 1 "src/wavefront_scan.h" 1
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 8 "src/wavefront_scan.h" 2
+# 16 "src/wavefront_scan.h"
+int wavefrontScanKernel();
+
+
+
+size_t wavefrontFindLineEnds(
+    int kernel,
+    const char *input,
+    size_t length,
+    unsigned int *ends,
+    size_t capacity);
+# 10 "src/wavefront_material_parser.c" 2
+# 1 "src/wavefront_thread.h" 1
+
+
+
+
+
+
+struct WavefrontAllocator;
+
+
+
+
+void wavefrontRunParallel(
+    void (*task)(void *context, unsigned int index),
+    void *context,
+    unsigned int count,
+    unsigned int threadCount,
+    const struct WavefrontAllocator *allocator);
+# 11 "src/wavefront_material_parser.c" 2
+# 29 "src/wavefront_material_parser.c"
+static int isHorizontalSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+static const char *skipSpace(const char *input, const char *end) {
+    while(input < end && isHorizontalSpace(*input)) input++;
+    return input;
+}
+
+static const char *skipToken(const char *input, const char *end) {
+    while(input < end && !isHorizontalSpace(*input)) input++;
+    return input;
+}
+
+static const char *trimSpace(const char *begin, const char *end) {
+    while(end > begin && isHorizontalSpace(end[-1])) end--;
+    return end;
+}
+
+
+struct LineScanner {
+    const char *scan;
+    const char *end;
+    const char *base;
+    int kernel;
+    size_t count;
+    size_t next;
+    unsigned int ends[256];
+};
+
+static void lineScannerCompose(struct LineScanner *lines, const char *input, const char *end) {
+    lines->scan = lines->base = input;
+    lines->end = end;
+    lines->kernel = wavefrontScanKernel();
+    lines->count = lines->next = 0;
+}
+
+
+static const char *nextLineEnd(struct LineScanner *lines) {
+    while(lines->next == lines->count) {
+        if(lines->scan == lines->end) return lines->end;
+        size_t length = lines->end - lines->scan;
+        if(length > 65536) length = 65536;
+        lines->base = lines->scan;
+        lines->count = wavefrontFindLineEnds(lines->kernel, lines->scan, length, lines->ends, 256);
+        lines->next = 0;
+
+        lines->scan = lines->count == 256 ?
+            lines->base + lines->ends[256 - 1] + 1 : lines->scan + length;
+    }
+    return lines->base + lines->ends[lines->next++];
+}
+
+static int parseNewMaterial(struct WavefrontMTLParser *state, const char *input, const char *end) {
+    struct WavefrontMTL *mtl = state->mtl;
+    const char *nameEnd = skipToken(input, end);
+
+    if(nameEnd == input || trimSpace(nameEnd, end) != nameEnd) return 0;
+
+    int index = wavefrontMTLFindMaterialN(mtl, input, nameEnd - input);
+    if(index >= 0) ((void)0);
+    if(index < 0 && state->selectOnly) {
+        state->material = 
+# 91 "src/wavefront_material_parser.c" 3 4
+                         ((void *)0)
+# 91 "src/wavefront_material_parser.c"
+                             ;
+        return 0;
+    }
+    if(index < 0) {
+        char *name = wavefrontMTLCopyString(mtl, input, nameEnd - input);
+        if(name == 
+# 96 "src/wavefront_material_parser.c" 3 4
+                  ((void *)0)
+# 96 "src/wavefront_material_parser.c"
+                      ) return 1;
+
+        int result = wavefrontMTLAddMaterial(mtl, name);
+        if(result) {
+            wavefrontMTLFreeString(mtl, name);
+            return result;
+        }
+        index = mtl->materialCount - 1;
+        ((void)0);
+    }
+    state->material = mtl->materials + index;
+    return 0;
+}
+
+
+static int parseError(struct WavefrontMTLParser *state, enum WavefrontMTLError error) {
+    state->error = error;
+    return 3;
+}
+
+static int parseColor(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+
+    struct WavefrontColor color;
+    float *channels[] = {&color.r, &color.g, &color.b};
+
+    int count = 0;
+    for(input = skipSpace(input, end); input < end; input = skipSpace(input, end)) {
+        if(count == 3) return parseError(state, WAVEFRONT_MTL_ERROR_EXTRA_VALUE);
+        const char *tokenEnd = skipToken(input, end);
+        const char *last = parseWavefrontFloat(input, tokenEnd, channels[count++]);
+        if(last == input || last != tokenEnd) return parseError(state, WAVEFRONT_MTL_ERROR_BAD_VALUE);
+        input = tokenEnd;
+    }
+
+    if(count == 0) return parseError(state, WAVEFRONT_MTL_ERROR_MISSING_VALUE);
+
+    if(count < 2) color.g = color.r;
+    if(count < 3) color.b = color.r;
+    color.a = 1.0;
+    *(struct WavefrontColor*)output = color;
+    return 0;
+}
+
+
+static int parseInteger(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    int value = 0;
+    parseWavefrontInteger(input, end, &value);
+    *((int*)output) = value;
+    return 0;
+}
+
+
+static int parseFloat(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    float value = 0;
+    parseWavefrontFloat(input, end, &value);
+    *((float*)output) = value;
+    return 0;
+}
+
+
+static int parseTransparency(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    float value = 0;
+    parseWavefrontFloat(input, end, &value);
+    *((float*)output) = 1 - value;
+    return 0;
+}
+
+
+static int tokenIs(const char *token, size_t length, const char *keyword, size_t keywordLength) {
+    return length == keywordLength && memcmp(token, keyword, length) == 0;
+}
+
+
+
+static const char *parseOptionFloats(const char *input, const char *end, float *output, int required, int count) {
+    for(int i = 0; i < count; i++) {
+        const char *tokenEnd = skipToken(input, end);
+        float value;
+        if(input == tokenEnd || parseWavefrontFloat(input, tokenEnd, &value) != tokenEnd) {
+            return i < required ? 
+# 175 "src/wavefront_material_parser.c" 3 4
+                                 ((void *)0) 
+# 175 "src/wavefront_material_parser.c"
+                                      : input;
+        }
+        output[i] = value;
+        input = skipSpace(tokenEnd, end);
+    }
+    return input;
+}
+
+static const char *parseOptionSwitch(const char *input, const char *end, unsigned int *flags, unsigned int flag) {
+    const char *valueEnd = skipToken(input, end);
+    size_t length = valueEnd - input;
+    if(tokenIs(input, length, "on", 2)) {
+        *flags |= flag;
+    } else if(tokenIs(input, length, "off", 3)) {
+        *flags &= ~flag;
+    } else {
+        return 
+# 191 "src/wavefront_material_parser.c" 3 4
+              ((void *)0)
+# 191 "src/wavefront_material_parser.c"
+                  ;
+    }
+    return skipSpace(valueEnd, end);
+}
+
+
+
+
+
+
+
+static const char *parseMapOptions(
+    struct WavefrontMapOptions *options,
+    const char *input,
+    const char *end,
+    const char **type,
+    size_t *typeLength,
+    int *malformed
+) {
+    while(input < end && *input == '-') {
+        const char *name = input + 1;
+        const char *nameEnd = skipToken(input, end);
+        size_t length = nameEnd - name;
+        const char *argument = skipSpace(nameEnd, end);
+        const char *valueEnd = skipToken(argument, end);
+        input = argument;
+
+        if(tokenIs(name, length, "o", 1)) {
+            input = parseOptionFloats(input, end, options->offset, 1, 3);
+        } else if(tokenIs(name, length, "s", 1)) {
+            input = parseOptionFloats(input, end, options->scale, 1, 3);
+        } else if(tokenIs(name, length, "t", 1)) {
+            input = parseOptionFloats(input, end, options->turbulence, 1, 3);
+        } else if(tokenIs(name, length, "bm", 2)) {
+            input = parseOptionFloats(input, end, &options->bumpMultiplier, 1, 1);
+        } else if(tokenIs(name, length, "boost", 5)) {
+            input = parseOptionFloats(input, end, &options->boost, 1, 1);
+        } else if(tokenIs(name, length, "mm", 2)) {
+            float mm[2];
+            input = parseOptionFloats(input, end, mm, 2, 2);
+            if(input) {
+                options->base = mm[0];
+                options->gain = mm[1];
+            }
+        } else if(tokenIs(name, length, "texres", 6)) {
+            int resolution;
+            if(input == valueEnd || parseWavefrontInteger(input, valueEnd, &resolution) != valueEnd) {
+                input = 
+# 238 "src/wavefront_material_parser.c" 3 4
+                       ((void *)0)
+# 238 "src/wavefront_material_parser.c"
+                           ;
+            } else {
+                options->resolution = resolution;
+                input = skipSpace(valueEnd, end);
+            }
+        } else if(tokenIs(name, length, "imfchan", 7)) {
+            if(valueEnd - input != 1 || !memchr("rgbmlz", *input, 6)) {
+                input = 
+# 245 "src/wavefront_material_parser.c" 3 4
+                       ((void *)0)
+# 245 "src/wavefront_material_parser.c"
+                           ;
+            } else {
+                options->channel = *input;
+                input = skipSpace(valueEnd, end);
+            }
+        } else if(tokenIs(name, length, "blendu", 6)) {
+            input = parseOptionSwitch(input, end, &options->flags, 0x1);
+        } else if(tokenIs(name, length, "blendv", 6)) {
+            input = parseOptionSwitch(input, end, &options->flags, 0x2);
+        } else if(tokenIs(name, length, "cc", 2)) {
+            input = parseOptionSwitch(input, end, &options->flags, 0x4);
+        } else if(tokenIs(name, length, "clamp", 5)) {
+            input = parseOptionSwitch(input, end, &options->flags, 0x8);
+        } else {
+            if(tokenIs(name, length, "type", 4) && type) {
+                *type = input;
+                *typeLength = valueEnd - input;
+            }
+            input = skipSpace(valueEnd, end);
+        }
+        if(!input) {
+            *malformed = 1;
+            input = skipSpace(valueEnd, end);
+            if(input == end) input = argument;
+        }
+    }
+    return input;
+}
+
+
+
+static int assignMap(
+    struct WavefrontMTLParser *state,
+    struct WavefrontMap *map,
+    const struct WavefrontMapOptions *options,
+    const char *input,
+    const char *end
+) {
+    end = trimSpace(input, end);
+    if(input == end) return 0;
+
+    unsigned int texture = 0, index = 0;
+    int result = wavefrontMTLInternTexture(state->mtl, input, end - input, &texture);
+    if(!result) result = wavefrontMTLInternMapOptions(state->mtl, options, &index);
+    if(result) return result;
+    if(!map->texture) wavefrontMTLFreeString(state->mtl, map->file);
+    map->file = state->mtl->textures[texture - 1];
+    map->texture = texture;
+    map->options = index;
+    return 0;
+}
+
+static int parseMap(struct WavefrontMTLParser *state, void *output, const char *input, const char *end) {
+    struct WavefrontMapOptions options;
+    wavefrontMapOptionsCompose(&options);
+    int malformed = 0;
+    input = parseMapOptions(&options, input, end, 
+# 301 "src/wavefront_material_parser.c" 3 4
+                                                 ((void *)0)
+# 301 "src/wavefront_material_parser.c"
+                                                     , 
+# 301 "src/wavefront_material_parser.c" 3 4
+                                                       ((void *)0)
+# 301 "src/wavefront_material_parser.c"
+                                                           , &malformed);
+    int result = assignMap(state, output, &options, input, end);
+
+    if(!result && malformed && state->diagnostics) return parseError(state, WAVEFRONT_MTL_ERROR_MAP_OPTION);
+    return result;
+}
+
+enum Keyword {
+    KEYWORD_UNKNOWN,
+    KEYWORD_NEWMTL,
+    KEYWORD_KA,
+    KEYWORD_KD,
+    KEYWORD_KS,
+    KEYWORD_KE,
+    KEYWORD_TF,
+    KEYWORD_TR,
+    KEYWORD_ILLUM,
+    KEYWORD_NS,
+    KEYWORD_NI,
+    KEYWORD_D,
+    KEYWORD_PR,
+    KEYWORD_PM,
+    KEYWORD_PS,
+    KEYWORD_PC,
+    KEYWORD_PCR,
+    KEYWORD_ANISO,
+    KEYWORD_ANISOR,
+    KEYWORD_MAP_KA,
+    KEYWORD_MAP_KD,
+    KEYWORD_MAP_KS,
+    KEYWORD_MAP_KE,
+    KEYWORD_MAP_KN,
+    KEYWORD_MAP_NS,
+    KEYWORD_MAP_D,
+    KEYWORD_MAP_PR,
+    KEYWORD_MAP_PM,
+    KEYWORD_MAP_PS,
+    KEYWORD_BUMP,
+    KEYWORD_DISP,
+    KEYWORD_DECAL,
+    KEYWORD_REFL
+};
+
+
+static enum Keyword classifyMap(char x, char y) {
+    switch(x) {
+    case 'K':
+        switch(y) {
+        case 'a': return KEYWORD_MAP_KA;
+        case 'd': return KEYWORD_MAP_KD;
+        case 's': return KEYWORD_MAP_KS;
+        case 'e': return KEYWORD_MAP_KE;
+        case 'n': return KEYWORD_MAP_KN;
+        }
+        break;
+    case 'N':
+        if(y == 's') return KEYWORD_MAP_NS;
+        break;
+    case 'P':
+        switch(y) {
+        case 'r': return KEYWORD_MAP_PR;
+        case 'm': return KEYWORD_MAP_PM;
+        case 's': return KEYWORD_MAP_PS;
+        }
+        break;
+    }
+    return KEYWORD_UNKNOWN;
+}
+
+
+
+
+static enum Keyword classifyKeyword(const char *k, size_t length) {
+    switch(length) {
+    case 1:
+        if(k[0] == 'd') return KEYWORD_D;
+        break;
+    case 2:
+        switch(k[0]) {
+        case 'K':
+            switch(k[1]) {
+            case 'a': return KEYWORD_KA;
+            case 'd': return KEYWORD_KD;
+            case 's': return KEYWORD_KS;
+            case 'e': return KEYWORD_KE;
+            }
+            break;
+        case 'N':
+            switch(k[1]) {
+            case 's': return KEYWORD_NS;
+            case 'i': return KEYWORD_NI;
+            }
+            break;
+        case 'T':
+            switch(k[1]) {
+            case 'f': return KEYWORD_TF;
+            case 'r': return KEYWORD_TR;
+            }
+            break;
+        case 'P':
+            switch(k[1]) {
+            case 'r': return KEYWORD_PR;
+            case 'm': return KEYWORD_PM;
+            case 's': return KEYWORD_PS;
+            case 'c': return KEYWORD_PC;
+            }
+            break;
+        }
+        break;
+    case 3:
+        if(memcmp(k, "Pcr", 3) == 0) return KEYWORD_PCR;
+        break;
+    case 4:
+        switch(k[0]) {
+        case 'r': return memcmp(k, "refl", 4) == 0 ? KEYWORD_REFL : KEYWORD_UNKNOWN;
+        case 'b': return memcmp(k, "bump", 4) == 0 ? KEYWORD_BUMP : KEYWORD_UNKNOWN;
+        case 'd': return memcmp(k, "disp", 4) == 0 ? KEYWORD_DISP : KEYWORD_UNKNOWN;
+        case 'n': return memcmp(k, "norm", 4) == 0 ? KEYWORD_MAP_KN : KEYWORD_UNKNOWN;
+        }
+        break;
+    case 5:
+        switch(k[0]) {
+        case 'i': return memcmp(k, "illum", 5) == 0 ? KEYWORD_ILLUM : KEYWORD_UNKNOWN;
+        case 'd': return memcmp(k, "decal", 5) == 0 ? KEYWORD_DECAL : KEYWORD_UNKNOWN;
+        case 'a': return memcmp(k, "aniso", 5) == 0 ? KEYWORD_ANISO : KEYWORD_UNKNOWN;
+        case 'm': return memcmp(k, "map_d", 5) == 0 ? KEYWORD_MAP_D : KEYWORD_UNKNOWN;
+        }
+        break;
+    case 6:
+        switch(k[0]) {
+        case 'n': return memcmp(k, "newmtl", 6) == 0 ? KEYWORD_NEWMTL : KEYWORD_UNKNOWN;
+        case 'a': return memcmp(k, "anisor", 6) == 0 ? KEYWORD_ANISOR : KEYWORD_UNKNOWN;
+        case 'm': return memcmp(k, "map_", 4) == 0 ? classifyMap(k[4], k[5]) : KEYWORD_UNKNOWN;
+        }
+        break;
+    case 8:
+
+        if(memcmp(k, "map_", 4) == 0 && (k[4] == 'b' || k[4] == 'B') && memcmp(k + 5, "ump", 3) == 0) {
+            return KEYWORD_BUMP;
+        }
+        break;
+    }
+    return KEYWORD_UNKNOWN;
+}
+
+
+static struct WavefrontMap *reflectionMap(struct WavefrontMaterial *m, const char *type, size_t length) {
+    if(tokenIs(type, length, "sphere", 6)) return &m->reflectionMapSphere;
+    if(length < 8 || memcmp(type, "cube_", 5) != 0) return 
+# 449 "src/wavefront_material_parser.c" 3 4
+                                                          ((void *)0)
+# 449 "src/wavefront_material_parser.c"
+                                                              ;
+    switch(type[5]) {
+    case 't':
+        return tokenIs(type, length, "cube_top", 8) ? &m->reflectionMapCubeTop : 
+# 452 "src/wavefront_material_parser.c" 3 4
+                                                                                ((void *)0)
+# 452 "src/wavefront_material_parser.c"
+                                                                                    ;
+    case 'b':
+        if(tokenIs(type, length, "cube_bottom", 11)) return &m->reflectionMapCubeBottom;
+        return tokenIs(type, length, "cube_back", 9) ? &m->reflectionMapCubeBack : 
+# 455 "src/wavefront_material_parser.c" 3 4
+                                                                                  ((void *)0)
+# 455 "src/wavefront_material_parser.c"
+                                                                                      ;
+    case 'f':
+        return tokenIs(type, length, "cube_front", 10) ? &m->reflectionMapCubeFront : 
+# 457 "src/wavefront_material_parser.c" 3 4
+                                                                                     ((void *)0)
+# 457 "src/wavefront_material_parser.c"
+                                                                                         ;
+    case 'l':
+        return tokenIs(type, length, "cube_left", 9) ? &m->reflectionMapCubeLeft : 
+# 459 "src/wavefront_material_parser.c" 3 4
+                                                                                  ((void *)0)
+# 459 "src/wavefront_material_parser.c"
+                                                                                      ;
+    case 'r':
+        return tokenIs(type, length, "cube_right", 10) ? &m->reflectionMapCubeRight : 
+# 461 "src/wavefront_material_parser.c" 3 4
+                                                                                     ((void *)0)
+# 461 "src/wavefront_material_parser.c"
+                                                                                         ;
+    }
+    return 
+# 463 "src/wavefront_material_parser.c" 3 4
+          ((void *)0)
+# 463 "src/wavefront_material_parser.c"
+              ;
+}
+
+struct Parser {
+    int (*fn)(struct WavefrontMTLParser *state, void *output, const char *input, const char *end);
+    size_t offset;
+};
+
+
+static const struct Parser parsers[] = {
+    [KEYWORD_KA] = {parseColor, 
+# 473 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 473 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 473 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 473 "src/wavefront_material_parser.c"
+                               ambient
+# 473 "src/wavefront_material_parser.c" 3 4
+                               )
+# 473 "src/wavefront_material_parser.c"
+                                                                          },
+    [KEYWORD_KD] = {parseColor, 
+# 474 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 474 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 474 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 474 "src/wavefront_material_parser.c"
+                               diffuse
+# 474 "src/wavefront_material_parser.c" 3 4
+                               )
+# 474 "src/wavefront_material_parser.c"
+                                                                          },
+    [KEYWORD_KS] = {parseColor, 
+# 475 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 475 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 475 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 475 "src/wavefront_material_parser.c"
+                               specular
+# 475 "src/wavefront_material_parser.c" 3 4
+                               )
+# 475 "src/wavefront_material_parser.c"
+                                                                           },
+    [KEYWORD_KE] = {parseColor, 
+# 476 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 476 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 476 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 476 "src/wavefront_material_parser.c"
+                               emission
+# 476 "src/wavefront_material_parser.c" 3 4
+                               )
+# 476 "src/wavefront_material_parser.c"
+                                                                           },
+    [KEYWORD_TF] = {parseColor, 
+# 477 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 477 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 477 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 477 "src/wavefront_material_parser.c"
+                               transmission
+# 477 "src/wavefront_material_parser.c" 3 4
+                               )
+# 477 "src/wavefront_material_parser.c"
+                                                                               },
+    [KEYWORD_TR] = {parseTransparency, 
+# 478 "src/wavefront_material_parser.c" 3 4
+                                      __builtin_offsetof (
+# 478 "src/wavefront_material_parser.c"
+                                      struct WavefrontMaterial
+# 478 "src/wavefront_material_parser.c" 3 4
+                                      , 
+# 478 "src/wavefront_material_parser.c"
+                                      dissolve
+# 478 "src/wavefront_material_parser.c" 3 4
+                                      )
+# 478 "src/wavefront_material_parser.c"
+                                                                                  },
+    [KEYWORD_ILLUM] = {parseInteger, 
+# 479 "src/wavefront_material_parser.c" 3 4
+                                    __builtin_offsetof (
+# 479 "src/wavefront_material_parser.c"
+                                    struct WavefrontMaterial
+# 479 "src/wavefront_material_parser.c" 3 4
+                                    , 
+# 479 "src/wavefront_material_parser.c"
+                                    illuminationModel
+# 479 "src/wavefront_material_parser.c" 3 4
+                                    )
+# 479 "src/wavefront_material_parser.c"
+                                                                                         },
+    [KEYWORD_NS] = {parseFloat, 
+# 480 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 480 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 480 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 480 "src/wavefront_material_parser.c"
+                               specularExponent
+# 480 "src/wavefront_material_parser.c" 3 4
+                               )
+# 480 "src/wavefront_material_parser.c"
+                                                                                   },
+    [KEYWORD_NI] = {parseFloat, 
+# 481 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 481 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 481 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 481 "src/wavefront_material_parser.c"
+                               opticalDensity
+# 481 "src/wavefront_material_parser.c" 3 4
+                               )
+# 481 "src/wavefront_material_parser.c"
+                                                                                 },
+    [KEYWORD_D] = {parseFloat, 
+# 482 "src/wavefront_material_parser.c" 3 4
+                              __builtin_offsetof (
+# 482 "src/wavefront_material_parser.c"
+                              struct WavefrontMaterial
+# 482 "src/wavefront_material_parser.c" 3 4
+                              , 
+# 482 "src/wavefront_material_parser.c"
+                              dissolve
+# 482 "src/wavefront_material_parser.c" 3 4
+                              )
+# 482 "src/wavefront_material_parser.c"
+                                                                          },
+    [KEYWORD_PR] = {parseFloat, 
+# 483 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 483 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 483 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 483 "src/wavefront_material_parser.c"
+                               roughness
+# 483 "src/wavefront_material_parser.c" 3 4
+                               )
+# 483 "src/wavefront_material_parser.c"
+                                                                            },
+    [KEYWORD_PM] = {parseFloat, 
+# 484 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 484 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 484 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 484 "src/wavefront_material_parser.c"
+                               metallic
+# 484 "src/wavefront_material_parser.c" 3 4
+                               )
+# 484 "src/wavefront_material_parser.c"
+                                                                           },
+    [KEYWORD_PS] = {parseFloat, 
+# 485 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 485 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 485 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 485 "src/wavefront_material_parser.c"
+                               sheen
+# 485 "src/wavefront_material_parser.c" 3 4
+                               )
+# 485 "src/wavefront_material_parser.c"
+                                                                        },
+    [KEYWORD_PC] = {parseFloat, 
+# 486 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 486 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 486 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 486 "src/wavefront_material_parser.c"
+                               clearcoatThickness
+# 486 "src/wavefront_material_parser.c" 3 4
+                               )
+# 486 "src/wavefront_material_parser.c"
+                                                                                     },
+    [KEYWORD_PCR] = {parseFloat, 
+# 487 "src/wavefront_material_parser.c" 3 4
+                                __builtin_offsetof (
+# 487 "src/wavefront_material_parser.c"
+                                struct WavefrontMaterial
+# 487 "src/wavefront_material_parser.c" 3 4
+                                , 
+# 487 "src/wavefront_material_parser.c"
+                                clearcoatRoughness
+# 487 "src/wavefront_material_parser.c" 3 4
+                                )
+# 487 "src/wavefront_material_parser.c"
+                                                                                      },
+    [KEYWORD_ANISO] = {parseFloat, 
+# 488 "src/wavefront_material_parser.c" 3 4
+                                  __builtin_offsetof (
+# 488 "src/wavefront_material_parser.c"
+                                  struct WavefrontMaterial
+# 488 "src/wavefront_material_parser.c" 3 4
+                                  , 
+# 488 "src/wavefront_material_parser.c"
+                                  anisotropy
+# 488 "src/wavefront_material_parser.c" 3 4
+                                  )
+# 488 "src/wavefront_material_parser.c"
+                                                                                },
+    [KEYWORD_ANISOR] = {parseFloat, 
+# 489 "src/wavefront_material_parser.c" 3 4
+                                   __builtin_offsetof (
+# 489 "src/wavefront_material_parser.c"
+                                   struct WavefrontMaterial
+# 489 "src/wavefront_material_parser.c" 3 4
+                                   , 
+# 489 "src/wavefront_material_parser.c"
+                                   anisotropyRotation
+# 489 "src/wavefront_material_parser.c" 3 4
+                                   )
+# 489 "src/wavefront_material_parser.c"
+                                                                                         },
+    [KEYWORD_MAP_KA] = {parseMap, 
+# 490 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 490 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 490 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 490 "src/wavefront_material_parser.c"
+                                 ambientMap
+# 490 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 490 "src/wavefront_material_parser.c"
+                                                                               },
+    [KEYWORD_MAP_KD] = {parseMap, 
+# 491 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 491 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 491 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 491 "src/wavefront_material_parser.c"
+                                 diffuseMap
+# 491 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 491 "src/wavefront_material_parser.c"
+                                                                               },
+    [KEYWORD_MAP_KS] = {parseMap, 
+# 492 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 492 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 492 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 492 "src/wavefront_material_parser.c"
+                                 specularColorMap
+# 492 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 492 "src/wavefront_material_parser.c"
+                                                                                     },
+    [KEYWORD_MAP_KE] = {parseMap, 
+# 493 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 493 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 493 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 493 "src/wavefront_material_parser.c"
+                                 emissionMap
+# 493 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 493 "src/wavefront_material_parser.c"
+                                                                                },
+    [KEYWORD_MAP_KN] = {parseMap, 
+# 494 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 494 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 494 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 494 "src/wavefront_material_parser.c"
+                                 normalMap
+# 494 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 494 "src/wavefront_material_parser.c"
+                                                                              },
+    [KEYWORD_MAP_NS] = {parseMap, 
+# 495 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 495 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 495 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 495 "src/wavefront_material_parser.c"
+                                 specularHighlightMap
+# 495 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 495 "src/wavefront_material_parser.c"
+                                                                                         },
+    [KEYWORD_MAP_D] = {parseMap, 
+# 496 "src/wavefront_material_parser.c" 3 4
+                                __builtin_offsetof (
+# 496 "src/wavefront_material_parser.c"
+                                struct WavefrontMaterial
+# 496 "src/wavefront_material_parser.c" 3 4
+                                , 
+# 496 "src/wavefront_material_parser.c"
+                                alphaMap
+# 496 "src/wavefront_material_parser.c" 3 4
+                                )
+# 496 "src/wavefront_material_parser.c"
+                                                                            },
+    [KEYWORD_MAP_PR] = {parseMap, 
+# 497 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 497 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 497 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 497 "src/wavefront_material_parser.c"
+                                 roughnessMap
+# 497 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 497 "src/wavefront_material_parser.c"
+                                                                                 },
+    [KEYWORD_MAP_PM] = {parseMap, 
+# 498 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 498 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 498 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 498 "src/wavefront_material_parser.c"
+                                 metallicMap
+# 498 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 498 "src/wavefront_material_parser.c"
+                                                                                },
+    [KEYWORD_MAP_PS] = {parseMap, 
+# 499 "src/wavefront_material_parser.c" 3 4
+                                 __builtin_offsetof (
+# 499 "src/wavefront_material_parser.c"
+                                 struct WavefrontMaterial
+# 499 "src/wavefront_material_parser.c" 3 4
+                                 , 
+# 499 "src/wavefront_material_parser.c"
+                                 sheenMap
+# 499 "src/wavefront_material_parser.c" 3 4
+                                 )
+# 499 "src/wavefront_material_parser.c"
+                                                                             },
+    [KEYWORD_BUMP] = {parseMap, 
+# 500 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 500 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 500 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 500 "src/wavefront_material_parser.c"
+                               bumpMap
+# 500 "src/wavefront_material_parser.c" 3 4
+                               )
+# 500 "src/wavefront_material_parser.c"
+                                                                          },
+    [KEYWORD_DISP] = {parseMap, 
+# 501 "src/wavefront_material_parser.c" 3 4
+                               __builtin_offsetof (
+# 501 "src/wavefront_material_parser.c"
+                               struct WavefrontMaterial
+# 501 "src/wavefront_material_parser.c" 3 4
+                               , 
+# 501 "src/wavefront_material_parser.c"
+                               displacementMap
+# 501 "src/wavefront_material_parser.c" 3 4
+                               )
+# 501 "src/wavefront_material_parser.c"
+                                                                                  },
+    [KEYWORD_DECAL] = {parseMap, 
+# 502 "src/wavefront_material_parser.c" 3 4
+                                __builtin_offsetof (
+# 502 "src/wavefront_material_parser.c"
+                                struct WavefrontMaterial
+# 502 "src/wavefront_material_parser.c" 3 4
+                                , 
+# 502 "src/wavefront_material_parser.c"
+                                decalMap
+# 502 "src/wavefront_material_parser.c" 3 4
+                                )
+# 502 "src/wavefront_material_parser.c"
+                                                                            }
+};
+
+static int parseStatement(struct WavefrontMTLParser *state, enum Keyword keyword, const char *arguments, const char *end) {
+    if(keyword == KEYWORD_UNKNOWN) return 0;
+    if(keyword == KEYWORD_NEWMTL) {
+        return parseNewMaterial(state, arguments, end);
+    }
+
+    struct WavefrontMaterial *m = state->material;
+    if(!m) return 0;
+
+    if(keyword == KEYWORD_REFL) {
+        struct WavefrontMapOptions options;
+        wavefrontMapOptionsCompose(&options);
+        const char *type = 
+# 517 "src/wavefront_material_parser.c" 3 4
+                          ((void *)0)
+# 517 "src/wavefront_material_parser.c"
+                              ;
+        size_t typeLength = 0;
+        int malformed = 0;
+        const char *file = parseMapOptions(&options, arguments, end, &type, &typeLength, &malformed);
+        struct WavefrontMap *map = type ? reflectionMap(m, type, typeLength) : 
+# 521 "src/wavefront_material_parser.c" 3 4
+                                                                              ((void *)0)
+# 521 "src/wavefront_material_parser.c"
+                                                                                  ;
+        int result = map ? assignMap(state, map, &options, file, end) : 0;
+        if(!result && malformed && state->diagnostics) return parseError(state, WAVEFRONT_MTL_ERROR_MAP_OPTION);
+        return result;
+    }
+    return parsers[keyword].fn(state, (char*)m + parsers[keyword].offset, arguments, end);
+}
+# 552 "src/wavefront_material_parser.c"
+static int parseLine(struct WavefrontMTLParser *state, const char *input, const char *end) {
+    input = skipSpace(input, end);
+    const char *keywordEnd = skipToken(input, end);
+
+    enum Keyword keyword = keywordEnd == end ? KEYWORD_UNKNOWN : classifyKeyword(input, keywordEnd - input);
+    const char *arguments = skipSpace(keywordEnd, end);
+
+
+
+    return parseStatement(state, keyword, arguments, end);
+}
+
+
+
+static int tolerated(const struct WavefrontMTLParser *parser) {
+    return parser->result == 3 && parser->diagnostics;
+}
+
+
+
+static unsigned long long countLines(struct WavefrontMTLParser *parser, const char *line) {
+
+    unsigned long long lines = 0;
+    for(const char *c = parser->counted; c < line; c++) lines += *c == '\n';
+    if(line > parser->counted) parser->counted = line;
+    return parser->lines += lines;
+}
+
+
+static void skipLine(
+    struct WavefrontMTLParser *parser,
+    const char *input,
+    const char *end,
+    unsigned long long line,
+    unsigned long long offset
+) {
+    struct WavefrontMTLDiagnostics *diagnostics = parser->diagnostics;
+    if(diagnostics->count < diagnostics->capacity) {
+        struct WavefrontMTLDiagnostic *diagnostic = diagnostics->items + diagnostics->count++;
+        diagnostic->line = line;
+        diagnostic->offset = offset;
+        diagnostic->error = parser->error;
+        input = skipSpace(input, end);
+        size_t length = skipToken(input, end) - input;
+        if(length >= sizeof(diagnostic->keyword)) length = sizeof(diagnostic->keyword) - 1;
+        memcpy(diagnostic->keyword, input, length);
+        diagnostic->keyword[length] = '\0';
+    }
+    diagnostics->total++;
+    parser->result = 0;
+}
+
+
+static void skipChunkLine(struct WavefrontMTLParser *parser, const char *input, const char *end) {
+    skipLine(parser, input, end, countLines(parser, input) + 1, parser->offset + (input - parser->chunk));
+}
+
+
+
+static void parserTrack(struct WavefrontMTLParser *parser) {
+
+
+
+}
+
+static void parserUntrack(struct WavefrontMTLParser *parser) {
+
+
+
+}
+
+static int parserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options
+) {
+    parser->mtl = mtl;
+    parser->material = 
+# 629 "src/wavefront_material_parser.c" 3 4
+                      ((void *)0)
+# 629 "src/wavefront_material_parser.c"
+                          ;
+    parser->pending = 
+# 630 "src/wavefront_material_parser.c" 3 4
+                     ((void *)0)
+# 630 "src/wavefront_material_parser.c"
+                         ;
+    parser->pendingLength = 0;
+    parser->pendingCapacity = 0;
+    parser->result = 0;
+    parser->selectOnly = 0;
+    parser->stats = options ? options->stats : 
+# 635 "src/wavefront_material_parser.c" 3 4
+                                              ((void *)0)
+# 635 "src/wavefront_material_parser.c"
+                                                  ;
+    parser->trackedBefore = 
+# 636 "src/wavefront_material_parser.c" 3 4
+                           ((void *)0)
+# 636 "src/wavefront_material_parser.c"
+                               ;
+    parser->allocator = options ? options->allocator : 
+# 637 "src/wavefront_material_parser.c" 3 4
+                                                      ((void *)0)
+# 637 "src/wavefront_material_parser.c"
+                                                          ;
+    parser->diagnostics = options ? options->diagnostics : 
+# 638 "src/wavefront_material_parser.c" 3 4
+                                                          ((void *)0)
+# 638 "src/wavefront_material_parser.c"
+                                                              ;
+    parser->error = WAVEFRONT_MTL_ERROR_MISSING_VALUE;
+    parser->chunk = parser->counted = 
+# 640 "src/wavefront_material_parser.c" 3 4
+                                     ((void *)0)
+# 640 "src/wavefront_material_parser.c"
+                                         ;
+    parser->lines = parser->offset = 0;
+    if(parser->stats) memset(parser->stats, 0, sizeof(struct WavefrontMTLStats));
+    if(parser->diagnostics) parser->diagnostics->count = parser->diagnostics->total = 0;
+    parserTrack(parser);
+
+    wavefrontMTLCompose(mtl);
+    if(options) mtl->flags = options->flags;
+    mtl->allocator = parser->allocator;
+    if(options && options->materialCapacity &&
+        wavefrontMTLReserve(mtl, options->materialCapacity)) {
+        parser->result = 1;
+    }
+    return parser->result;
+}
+
+
+
+static const char *parseLines(struct WavefrontMTLParser *parser, const char *input, const char *end) {
+    struct LineScanner lines;
+    lineScannerCompose(&lines, input, end);
+    for(const char *lineEnd = nextLineEnd(&lines); lineEnd < end; lineEnd = nextLineEnd(&lines)) {
+        parser->result = parseLine(parser, input, lineEnd);
+        if(tolerated(parser)) skipChunkLine(parser, input, lineEnd);
+        if(parser->result) break;
+        input = lineEnd + 1;
+    }
+    return input;
+}
+
+static int parserFail(struct WavefrontMTLParser *parser) {
+    wavefrontFreeWith(parser->allocator, parser->pending);
+    parser->pending = 
+# 672 "src/wavefront_material_parser.c" 3 4
+                     ((void *)0)
+# 672 "src/wavefront_material_parser.c"
+                         ;
+    parser->pendingLength = parser->pendingCapacity = 0;
+    wavefrontMTLRelease(parser->mtl);
+    return parser->result;
+}
+
+int wavefrontMTLParserCompose(
+    struct WavefrontMTLParser *parser,
+    struct WavefrontMTL *mtl,
+    const struct WavefrontMTLOptions *options
+) {
+    if(parserCompose(parser, mtl, options)) parserFail(parser);
+    parserUntrack(parser);
+    return parser->result;
+}
+
+static int parserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length) {
+    if(parser->result) return parser->result;
+    if(!chunk) return 2;
+    const char *end = chunk + length;
+    ((void)0);
+    parser->chunk = parser->counted = chunk;
+
+
+    if(parser->pendingLength) {
+        unsigned long long offset = parser->offset - parser->pendingLength;
+        struct LineScanner lines;
+        lineScannerCompose(&lines, chunk, end);
+        const char *lineEnd = nextLineEnd(&lines);
+        size_t needed = parser->pendingLength + (lineEnd - chunk);
+        if(needed > parser->pendingCapacity) {
+            size_t capacity = parser->pendingCapacity * 2 > needed ?
+                parser->pendingCapacity * 2 : needed;
+            char *temp = wavefrontReallocateWith(parser->allocator, parser->pending, capacity);
+            if(!temp) {
+                parser->result = 1;
+                return parserFail(parser);
+            }
+            parser->pending = temp;
+            parser->pendingCapacity = capacity;
+        }
+        memcpy(parser->pending + parser->pendingLength, chunk, lineEnd - chunk);
+        parser->pendingLength = needed;
+        if(lineEnd == end) {
+            parser->offset += length;
+            return 0;
+        }
+
+        parser->result = parseLine(parser, parser->pending, parser->pending + needed);
+        if(tolerated(parser)) skipLine(parser, parser->pending, parser->pending + needed, parser->lines + 1, offset);
+        if(parser->result) return parserFail(parser);
+        parser->pendingLength = 0;
+        chunk = lineEnd + 1;
+    }
+
+    chunk = parseLines(parser, chunk, end);
+    if(parser->result) return parserFail(parser);
+
+
+    size_t remaining = end - chunk;
+    if(remaining > parser->pendingCapacity) {
+        char *temp = wavefrontReallocateWith(parser->allocator, parser->pending, remaining);
+        if(!temp) {
+            parser->result = 1;
+            return parserFail(parser);
+        }
+        parser->pending = temp;
+        parser->pendingCapacity = remaining;
+    }
+    if(remaining) memcpy(parser->pending, chunk, remaining);
+    parser->pendingLength = remaining;
+
+    if(parser->diagnostics) countLines(parser, end);
+    parser->offset += length;
+    return 0;
+}
+
+int wavefrontMTLParserFeed(struct WavefrontMTLParser *parser, const char *chunk, size_t length) {
+    parserTrack(parser);
+    int result = parserFeed(parser, chunk, length);
+    parserUntrack(parser);
+    return result;
+}
+
+static int parserFinish(struct WavefrontMTLParser *parser) {
+    if(parser->result) return parser->result;
+    if(parser->pendingLength) {
+        const char *pendingEnd = parser->pending + parser->pendingLength;
+        parser->result = parseLine(parser, parser->pending, pendingEnd);
+        if(tolerated(parser)) {
+            skipLine(parser, parser->pending, pendingEnd, parser->lines + 1, parser->offset - parser->pendingLength);
+        }
+        if(parser->result) return parserFail(parser);
+    }
+    wavefrontFreeWith(parser->allocator, parser->pending);
+    parser->pending = 
+# 767 "src/wavefront_material_parser.c" 3 4
+                     ((void *)0)
+# 767 "src/wavefront_material_parser.c"
+                         ;
+    parser->pendingLength = parser->pendingCapacity = 0;
+    return 0;
+}
+
+int wavefrontMTLParserFinish(struct WavefrontMTLParser *parser) {
+    parserTrack(parser);
+    int result = parserFinish(parser);
+    parserUntrack(parser);
+    return result;
+}
+
+
+static int parseAll(struct WavefrontMTLParser *parser, const char *input, const char *end) {
+    ((void)0);
+    input = parseLines(parser, input, end);
+    if(!parser->result && input < end) {
+        parser->result = parseLine(parser, input, end);
+        if(tolerated(parser)) skipChunkLine(parser, input, end);
+    }
+    return parser->result;
+}
+
+
+static int isMaterialLine(const char *input, const char *end) {
+    input = skipSpace(input, end);
+    const char *keywordEnd = skipToken(input, end);
+    if(!tokenIs(input, keywordEnd - input, "newmtl", 6)) return 0;
+    const char *name = skipSpace(keywordEnd, end);
+    const char *nameEnd = skipToken(name, end);
+    return nameEnd != name && trimSpace(nameEnd, end) == nameEnd;
+}
+
+
+static const char *nextMaterialLine(const char *input, const char *end) {
+    struct LineScanner lines;
+    lineScannerCompose(&lines, input, end);
+    const char *lineEnd = nextLineEnd(&lines);
+    while(lineEnd < end) {
+        const char *line = lineEnd + 1;
+        lineEnd = nextLineEnd(&lines);
+        if(isMaterialLine(line, lineEnd)) return line;
+    }
+    return end;
+}
+
+struct ParallelPiece {
+    const char *input;
+    const char *end;
+    struct WavefrontMTL mtl;
+    struct WavefrontMTLStats stats;
+    struct WavefrontMTLDiagnostics diagnostics;
+    int result;
+};
+
+struct ParallelParse {
+    struct ParallelPiece *pieces;
+    struct WavefrontMTLOptions options;
+};
+
+static void parsePiece(void *context, unsigned int index) {
+    struct ParallelParse *parse = context;
+    struct ParallelPiece *piece = parse->pieces + index;
+    struct WavefrontMTLOptions options = parse->options;
+    if(options.stats) options.stats = &piece->stats;
+    if(options.diagnostics) options.diagnostics = &piece->diagnostics;
+    piece->result = parseWavefrontMTLFromBuffer(
+        &piece->mtl, piece->input, piece->end - piece->input, &options);
+}
+# 854 "src/wavefront_material_parser.c"
+static void diagnosticsAdd(struct WavefrontMTLParser *parser, const struct ParallelPiece *piece) {
+    const struct WavefrontMTLDiagnostics *part = &piece->diagnostics;
+    struct WavefrontMTLDiagnostics *total = parser->diagnostics;
+    if(!part->total) return;
+    unsigned long long lines = countLines(parser, piece->input);
+    for(unsigned int i = 0; i < part->count && total->count < total->capacity; i++) {
+        struct WavefrontMTLDiagnostic *diagnostic = total->items + total->count++;
+        *diagnostic = part->items[i];
+        diagnostic->line += lines;
+        diagnostic->offset += piece->input - parser->chunk;
+    }
+    total->total += part->total;
+}
+
+
+static int parallelMerge(struct WavefrontMTLParser *parser, struct ParallelPiece *piece) {
+    struct WavefrontMTL *mtl = parser->mtl;
+
+
+
+
+
+    if(mtl->materialCount || mtl->textureCount || mtl->mapOptionCount) {
+        for(unsigned int i = 0; i < piece->mtl.textureCount; i++) {
+            const char *file = piece->mtl.textures[i];
+            unsigned int texture;
+            parser->result = wavefrontMTLInternTexture(mtl, file, strlen(file), &texture);
+            if(parser->result) return parser->result;
+        }
+        for(unsigned int i = 0; i < piece->mtl.mapOptionCount; i++) {
+            unsigned int index;
+            parser->result = wavefrontMTLInternMapOptions(mtl, piece->mtl.mapOptions + i, &index);
+            if(parser->result) return parser->result;
+        }
+    }
+
+
+    for(unsigned int i = 0; i < piece->mtl.materialCount; i++) {
+        if(wavefrontMTLFindMaterial(mtl, piece->mtl.materials[i].name) < 0) continue;
+
+
+        struct WavefrontMTLStats *stats = parser->stats;
+        struct WavefrontMTLDiagnostics *diagnostics = parser->diagnostics;
+        struct WavefrontMTLDiagnostics skipped = {0};
+        parser->stats = 
+# 898 "src/wavefront_material_parser.c" 3 4
+                       ((void *)0)
+# 898 "src/wavefront_material_parser.c"
+                           ;
+        parser->diagnostics = diagnostics ? &skipped : 
+# 899 "src/wavefront_material_parser.c" 3 4
+                                                      ((void *)0)
+# 899 "src/wavefront_material_parser.c"
+                                                          ;
+        parser->material = 
+# 900 "src/wavefront_material_parser.c" 3 4
+                          ((void *)0)
+# 900 "src/wavefront_material_parser.c"
+                              ;
+        parser->selectOnly = 1;
+        parseAll(parser, piece->input, piece->end);
+        parser->selectOnly = 0;
+        parser->stats = stats;
+        parser->diagnostics = diagnostics;
+        if(parser->result) return parser->result;
+        break;
+    }
+    parser->result = wavefrontMTLAppend(mtl, &piece->mtl);
+    return parser->result;
+}
+
+static int parseParallel(
+    struct WavefrontMTLParser *parser,
+    const char *input,
+    const char *end,
+    unsigned int threadCount
+) {
+    size_t length = end - input;
+    size_t pieceCount = (size_t)threadCount * 4;
+    if(pieceCount > length / 65536) pieceCount = length / 65536;
+    if(pieceCount < 2) return parseAll(parser, input, end);
+
+    struct ParallelParse parse = {0};
+    parse.pieces = wavefrontAllocateZeroedWith(parser->allocator, pieceCount, sizeof(struct ParallelPiece));
+    if(!parse.pieces) return parser->result = 1;
+    parse.options.flags = parser->mtl->flags;
+    parse.options.stats = parser->stats;
+    parse.options.allocator = parser->allocator;
+    parse.options.diagnostics = parser->diagnostics;
+
+    unsigned int capacity = parser->diagnostics ? parser->diagnostics->capacity : 0;
+    struct WavefrontMTLDiagnostic *items = 
+# 933 "src/wavefront_material_parser.c" 3 4
+                                          ((void *)0)
+# 933 "src/wavefront_material_parser.c"
+                                              ;
+    if(capacity) {
+        items = wavefrontAllocateWith(parser->allocator, pieceCount * capacity * sizeof(struct WavefrontMTLDiagnostic));
+        if(!items) {
+            wavefrontFreeWith(parser->allocator, parse.pieces);
+            return parser->result = 1;
+        }
+    }
+
+
+
+    const char *pieceInput = input;
+    for(size_t i = 0; i < pieceCount; i++) {
+        struct ParallelPiece *piece = parse.pieces + i;
+        const char *split = input + length / pieceCount * (i + 1);
+        if(split < pieceInput) split = pieceInput;
+        piece->input = pieceInput;
+        piece->end = i + 1 == pieceCount ? end : nextMaterialLine(split, end);
+        wavefrontMTLCompose(&piece->mtl);
+        piece->diagnostics.items = items ? items + i * capacity : 
+# 952 "src/wavefront_material_parser.c" 3 4
+                                                                 ((void *)0)
+# 952 "src/wavefront_material_parser.c"
+                                                                     ;
+        piece->diagnostics.capacity = capacity;
+        pieceInput = piece->end;
+    }
+    wavefrontRunParallel(parsePiece, &parse, pieceCount, threadCount, parser->allocator);
+
+    for(size_t i = 0; i < pieceCount; i++) {
+        struct ParallelPiece *piece = parse.pieces + i;
+        if(!parser->result) parser->result = piece->result;
+
+        if(!parser->result && parser->diagnostics) diagnosticsAdd(parser, piece);
+        if(!parser->result) parallelMerge(parser, piece);
+        wavefrontMTLRelease(&piece->mtl);
+
+
+
+    }
+    wavefrontFreeWith(parser->allocator, parse.pieces);
+    wavefrontFreeWith(parser->allocator, items);
+
+
+
+
+
+
+
+    return parser->result;
+}
+
+int parseWavefrontMTLFromBuffer(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options
+) {
+    if(!input) return 2;
+    struct WavefrontMTLParser parser;
+    if(!parserCompose(&parser, mtl, options)) {
+        parser.chunk = parser.counted = input;
+        if(options && options->threadCount > 1) {
+            parseParallel(&parser, input, input + length, options->threadCount);
+        } else {
+            parseAll(&parser, input, input + length);
+        }
+    }
+    if(parser.result) parserFail(&parser);
+    parserUntrack(&parser);
+    return parser.result;
+}
+
+int parseWavefrontMTLFromString(struct WavefrontMTL *mtl, const char *input) {
+    if(!input) return 2;
+    return parseWavefrontMTLFromBuffer(mtl, input, strlen(input), 
+# 1004 "src/wavefront_material_parser.c" 3 4
+                                                                 ((void *)0)
+# 1004 "src/wavefront_material_parser.c"
+                                                                     );
+}
+
+int parseWavefrontMTLFromFile(
+    struct WavefrontMTL *mtl,
+    const char *path,
+    const struct WavefrontMTLOptions *options
+) {
+    if(!path) return 2;
+    struct WavefrontFileView view;
+    int result = wavefrontFileMap(&view, path);
+    if(result) return result;
+    result = parseWavefrontMTLFromBuffer(mtl, view.data, view.length, options);
+    wavefrontFileUnmap(&view);
+    return result;
+}
+
+struct BatchEntry {
+    size_t length;
+    unsigned int index;
+};
+
+struct BatchParse {
+    struct WavefrontMTLBatchItem *items;
+    struct WavefrontFileView *views;
+    struct BatchEntry *order;
+    struct WavefrontMTLOptions options;
+};
+
+static int compareBatchEntries(const void *a, const void *b) {
+    size_t x = ((const struct BatchEntry*)a)->length;
+    size_t y = ((const struct BatchEntry*)b)->length;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static void parseBatchItem(void *context, unsigned int index) {
+    struct BatchParse *batch = context;
+    unsigned int itemIndex = batch->order[index].index;
+    struct WavefrontMTLBatchItem *item = batch->items + itemIndex;
+    if(item->result) return;
+    const char *input = item->input;
+    size_t length = item->length;
+    if(item->path) {
+        input = batch->views[itemIndex].data;
+        length = batch->views[itemIndex].length;
+    }
+    item->result = parseWavefrontMTLFromBuffer(&item->mtl, input, length, &batch->options);
+}
+
+int parseWavefrontMTLBatch(
+    struct WavefrontMTLBatchItem *items,
+    unsigned int count,
+    const struct WavefrontMTLOptions *options
+) {
+    struct BatchParse batch = {0};
+    if(options) batch.options = *options;
+
+    batch.options.stats = 
+# 1061 "src/wavefront_material_parser.c" 3 4
+                         ((void *)0)
+# 1061 "src/wavefront_material_parser.c"
+                             ;
+    batch.options.diagnostics = 
+# 1062 "src/wavefront_material_parser.c" 3 4
+                               ((void *)0)
+# 1062 "src/wavefront_material_parser.c"
+                                   ;
+    unsigned int threadCount = batch.options.threadCount;
+
+    batch.options.threadCount = 0;
+    batch.items = items;
+    const struct WavefrontAllocator *allocator = batch.options.allocator;
+    batch.views = wavefrontAllocateZeroedWith(allocator, count, sizeof(struct WavefrontFileView));
+    batch.order = wavefrontAllocateWith(allocator, count * sizeof(struct BatchEntry));
+
+
+
+    for(unsigned int i = 0; i < count; i++) {
+        struct WavefrontMTLBatchItem *item = items + i;
+        wavefrontMTLCompose(&item->mtl);
+        item->mtl.allocator = allocator;
+        item->result = 0;
+        if(!batch.views || !batch.order) {
+            item->result = 1;
+        } else if(item->path) {
+            item->result = wavefrontFileMap(batch.views + i, item->path);
+        } else if(!item->input) {
+            item->result = 2;
+        }
+        if(batch.order) {
+            batch.order[i].length = item->path ? batch.views[i].length : item->length;
+            batch.order[i].index = i;
+        }
+    }
+    if(batch.views && batch.order) {
+        qsort(batch.order, count, sizeof(struct BatchEntry), compareBatchEntries);
+        wavefrontRunParallel(parseBatchItem, &batch, count, threadCount, allocator);
+    }
+
+    int result = 0;
+    for(unsigned int i = 0; i < count; i++) {
+        if(batch.views && items[i].path) wavefrontFileUnmap(batch.views + i);
+        if(!result) result = items[i].result;
+    }
+    wavefrontFreeWith(allocator, batch.views);
+    wavefrontFreeWith(allocator, batch.order);
+    return result;
+}
+
+int wavefrontMTLReload(
+    struct WavefrontMTL *mtl,
+    const char *input,
+    size_t length,
+    struct WavefrontMTLChanges *changes
+) {
+    if(changes) memset(changes, 0, sizeof(struct WavefrontMTLChanges));
+    struct WavefrontMTLOptions options = {0};
+    options.flags = mtl->flags;
+    options.allocator = mtl->allocator;
+    struct WavefrontMTL next;
+    int result = parseWavefrontMTLFromBuffer(&next, input, length, &options);
+    if(result) return result;
+    result = wavefrontMTLUpdate(mtl, &next, changes);
+    wavefrontMTLRelease(&next);
+    return result;
+}
+
+struct WavefrontMTLIndexEntry {
+    const char *name;
+    size_t nameLength;
+    unsigned int firstBlock;
+    unsigned int lastBlock;
+    int material;
+};
+
+struct WavefrontMTLIndexBlock {
+    const char *input;
+    const char *end;
+    unsigned int next;
+};
+
+
+static unsigned int indexProbe(const struct WavefrontMTLIndex *index, const char *name, size_t length) {
+    unsigned int mask = index->tableSize - 1;
+    unsigned int slot = wavefrontMTLHashName(name, length) & mask;
+    for(; index->table[slot]; slot = (slot + 1) & mask) {
+        const struct WavefrontMTLIndexEntry *entry = index->entries + index->table[slot] - 1;
+        if(entry->nameLength == length && memcmp(entry->name, name, length) == 0) break;
+    }
+    return slot;
+}
+
+static int indexTableResize(struct WavefrontMTLIndex *index) {
+    unsigned int size = index->tableSize ? index->tableSize * 2 : 64;
+    unsigned int *table = wavefrontAllocateZeroedWith(index->mtl.allocator, size, sizeof(unsigned int));
+    if(!table) return 1;
+    wavefrontFreeWith(index->mtl.allocator, index->table);
+    index->table = table;
+    index->tableSize = size;
+    for(unsigned int i = 0; i < index->entryCount; i++) {
+        const struct WavefrontMTLIndexEntry *entry = index->entries + i;
+        index->table[indexProbe(index, entry->name, entry->nameLength)] = i + 1;
+    }
+    return 0;
+}
+
+
+static int indexAddBlock(struct WavefrontMTLIndex *index, const char *name, size_t length, const char *input) {
+    if(index->blockCount == index->blockCapacity) {
+        unsigned int capacity = index->blockCapacity ? index->blockCapacity * 2 : 64;
+        struct WavefrontMTLIndexBlock *temp = wavefrontReallocateWith(index->mtl.allocator, index->blocks, capacity * sizeof(struct WavefrontMTLIndexBlock));
+        if(!temp) return 1;
+        index->blocks = temp;
+        index->blockCapacity = capacity;
+    }
+    if((index->entryCount + 1) * 2 > index->tableSize && indexTableResize(index)) return 1;
+
+    unsigned int slot = indexProbe(index, name, length);
+    if(!index->table[slot]) {
+        if(index->entryCount == index->entryCapacity) {
+            unsigned int capacity = index->entryCapacity ? index->entryCapacity * 2 : 64;
+            struct WavefrontMTLIndexEntry *temp = wavefrontReallocateWith(index->mtl.allocator, index->entries, capacity * sizeof(struct WavefrontMTLIndexEntry));
+            if(!temp) return 1;
+            index->entries = temp;
+            index->entryCapacity = capacity;
+        }
+        struct WavefrontMTLIndexEntry *entry = index->entries + index->entryCount++;
+        entry->name = name;
+        entry->nameLength = length;
+        entry->firstBlock = entry->lastBlock = 0;
+        entry->material = -1;
+        index->table[slot] = index->entryCount;
+    }
+
+    struct WavefrontMTLIndexEntry *entry = index->entries + index->table[slot] - 1;
+    struct WavefrontMTLIndexBlock *block = index->blocks + index->blockCount++;
+    block->input = input;
+    block->end = index->input + index->length;
+    block->next = 0;
+    if(entry->lastBlock) {
+        index->blocks[entry->lastBlock - 1].next = index->blockCount;
+    } else {
+        entry->firstBlock = index->blockCount;
+    }
+    entry->lastBlock = index->blockCount;
+    return 0;
+}
+
+
+static int indexScan(struct WavefrontMTLIndex *index) {
+    const char *input = index->input;
+    const char *end = input + index->length;
+    struct WavefrontMTLIndexBlock *block = 
+# 1208 "src/wavefront_material_parser.c" 3 4
+                                          ((void *)0)
+# 1208 "src/wavefront_material_parser.c"
+                                              ;
+    struct LineScanner lines;
+    lineScannerCompose(&lines, input, end);
+    while(input < end) {
+        const char *lineEnd = nextLineEnd(&lines);
+        if(isMaterialLine(input, lineEnd)) {
+            if(block) block->end = input;
+            const char *name = skipSpace(skipToken(skipSpace(input, lineEnd), lineEnd), lineEnd);
+            const char *nameEnd = skipToken(name, lineEnd);
+            if(indexAddBlock(index, name, nameEnd - name, lineEnd)) return 1;
+            block = index->blocks + index->blockCount - 1;
+        }
+        input = lineEnd < end ? lineEnd + 1 : end;
+    }
+    return 0;
+}
+
+int wavefrontMTLIndexCompose(
+    struct WavefrontMTLIndex *index,
+    const char *input,
+    size_t length,
+    const struct WavefrontMTLOptions *options
+) {
+    memset(index, 0, sizeof(struct WavefrontMTLIndex));
+    wavefrontMTLCompose(&index->mtl);
+    if(options) {
+        index->mtl.flags = options->flags;
+        index->mtl.allocator = options->allocator;
+    }
+    if(!input) return 2;
+    index->input = input;
+    index->length = length;
+
+    int result = indexScan(index);
+    if(result) wavefrontMTLIndexRelease(index);
+    return result;
+}
+
+int wavefrontMTLIndexFind(struct WavefrontMTLIndex *index, const char *name, int *material) {
+    *material = -1;
+    if(!index->tableSize) return 0;
+    unsigned int slot = indexProbe(index, name, strlen(name));
+    if(!index->table[slot]) return 0;
+    struct WavefrontMTLIndexEntry *entry = index->entries + index->table[slot] - 1;
+    if(entry->material >= 0) {
+        *material = entry->material;
+        return 0;
+    }
+
+
+
+    struct WavefrontMaterial m;
+    wavefrontMaterialCompose(&m);
+    struct WavefrontMTLParser parser;
+    memset(&parser, 0, sizeof(struct WavefrontMTLParser));
+    parser.mtl = &index->mtl;
+    parser.material = &m;
+    parser.allocator = index->mtl.allocator;
+    for(unsigned int b = entry->firstBlock; b && !parser.result; b = index->blocks[b - 1].next) {
+        parseAll(&parser, index->blocks[b - 1].input, index->blocks[b - 1].end);
+    }
+    if(parser.result) return parser.result;
+
+    struct WavefrontMTL *mtl = &index->mtl;
+    m.name = wavefrontMTLCopyString(mtl, entry->name, entry->nameLength);
+    if(!m.name) return 1;
+    int result = wavefrontMTLAddMaterial(mtl, m.name);
+    if(result) {
+        wavefrontMTLFreeString(mtl, m.name);
+        return result;
+    }
+    mtl->materials[mtl->materialCount - 1] = m;
+    entry->material = *material = mtl->materialCount - 1;
+    return 0;
+}
+
+void wavefrontMTLIndexRelease(struct WavefrontMTLIndex *index) {
+    wavefrontFreeWith(index->mtl.allocator, index->entries);
+    wavefrontFreeWith(index->mtl.allocator, index->blocks);
+    wavefrontFreeWith(index->mtl.allocator, index->table);
+    wavefrontMTLRelease(&index->mtl);
+    memset(index, 0, sizeof(struct WavefrontMTLIndex));
+    wavefrontMTLCompose(&index->mtl);
+}
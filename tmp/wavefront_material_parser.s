@@ -0,0 +1,6529 @@
+	.file	"wavefront_material_parser.c"
+	.text
+	.p2align 4
+	.type	compareBatchEntries, @function
+compareBatchEntries:
+.LFB58:
+	.cfi_startproc
+	movq	(%rdi), %rdx
+	movq	(%rsi), %rcx
+	movl	$1, %eax
+	cmpq	%rcx, %rdx
+	jb	.L1
+	cmpq	%rdx, %rcx
+	sbbl	%eax, %eax
+.L1:
+	ret
+	.cfi_endproc
+.LFE58:
+	.size	compareBatchEntries, .-compareBatchEntries
+	.p2align 4
+	.type	skipLine, @function
+skipLine:
+.LFB36:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	72(%rdi), %rbp
+	movl	12(%rbp), %eax
+	cmpl	8(%rbp), %eax
+	jnb	.L6
+	leaq	(%rax,%rax,4), %r13
+	movq	%rdx, %rdi
+	leal	1(%rax), %edx
+	movq	0(%rbp), %rax
+	movl	%edx, 12(%rbp)
+	leaq	(%rax,%r13,8), %r13
+	movl	80(%r12), %eax
+	movq	%rcx, 0(%r13)
+	movq	%r8, 8(%r13)
+	movl	%eax, 32(%r13)
+	cmpq	%rdi, %rsi
+	jb	.L7
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	xorl	%ebx, %ebx
+	jmp	.L8
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	addq	$1, %rsi
+	cmpq	%rsi, %rdi
+	je	.L21
+.L7:
+	movzbl	(%rsi), %eax
+	cmpb	$32, %al
+	je	.L10
+	cmpb	$9, %al
+	je	.L10
+	cmpq	%rdi, %rsi
+	jnb	.L21
+	movq	%rsi, %rax
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	movzbl	(%rax), %edx
+	cmpb	$32, %dl
+	je	.L15
+	cmpb	$9, %dl
+	je	.L15
+	addq	$1, %rax
+	cmpq	%rax, %rdi
+	jne	.L9
+	movq	%rdi, %rbx
+	movl	$15, %eax
+	subq	%rsi, %rbx
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+.L8:
+	leaq	16(%r13), %rdi
+	movq	%rbx, %rdx
+	call	memcpy@PLT
+	movb	$0, 16(%r13,%rbx)
+.L6:
+	addq	$1, 16(%rbp)
+	movl	$0, 40(%r12)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+	subq	%rsi, %rax
+	movq	%rax, %rbx
+	movl	$15, %eax
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	jmp	.L8
+	.cfi_endproc
+.LFE36:
+	.size	skipLine, .-skipLine
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"on"
+.LC1:
+	.string	"off"
+	.text
+	.p2align 4
+	.type	parseOptionSwitch, @function
+parseOptionSwitch:
+.LFB25:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	cmpq	%rsi, %rdi
+	jnb	.L36
+	movq	%rsi, %rbp
+	movq	%rdx, %r13
+	movl	%ecx, %r12d
+	movq	%rdi, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L25
+	cmpb	$9, %al
+	je	.L25
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L23
+.L25:
+	movq	%rbx, %rax
+	subq	%rdi, %rax
+	cmpq	$2, %rax
+	je	.L42
+	cmpq	$3, %rax
+	je	.L43
+.L36:
+	xorl	%ebx, %ebx
+.L22:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.cfi_restore_state
+	movl	$3, %edx
+	leaq	.LC1(%rip), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L36
+	movl	%r12d, %ecx
+	notl	%ecx
+	andl	0(%r13), %ecx
+	jmp	.L29
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	movl	$2, %edx
+	leaq	.LC0(%rip), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L36
+	movl	0(%r13), %ecx
+	orl	%r12d, %ecx
+.L29:
+	movl	%ecx, 0(%r13)
+	cmpq	%rbp, %rbx
+	jb	.L30
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L22
+.L30:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L31
+	cmpb	$9, %al
+	je	.L31
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	parseOptionSwitch, .-parseOptionSwitch
+	.section	.rodata.str1.1
+.LC2:
+	.string	"newmtl"
+	.text
+	.p2align 4
+	.type	isMaterialLine, @function
+isMaterialLine:
+.LFB49:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	jnb	.L79
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L45
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	addq	$1, %rdi
+	cmpq	%rdi, %rbp
+	je	.L65
+.L45:
+	movzbl	(%rdi), %eax
+	cmpb	$32, %al
+	je	.L47
+	cmpb	$9, %al
+	je	.L47
+	cmpq	%rbp, %rdi
+	jnb	.L65
+	movq	%rdi, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L50
+	cmpb	$9, %al
+	je	.L50
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L49
+.L50:
+	movq	%rbx, %rdx
+	xorl	%eax, %eax
+	subq	%rdi, %rdx
+	cmpq	$6, %rdx
+	je	.L80
+.L44:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.cfi_restore_state
+	leaq	.LC2(%rip), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L81
+.L65:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.cfi_restore_state
+	cmpq	%rbp, %rbx
+	jb	.L53
+	jmp	.L44
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L44
+.L53:
+	movzbl	(%rbx), %edx
+	cmpb	$32, %dl
+	je	.L54
+	cmpb	$9, %dl
+	je	.L54
+	cmpq	%rbp, %rbx
+	jnb	.L44
+	movq	%rbx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	movzbl	(%rdx), %ecx
+	cmpb	$32, %cl
+	je	.L67
+	cmpb	$9, %cl
+	je	.L67
+	addq	$1, %rdx
+	cmpq	%rdx, %rbp
+	jne	.L56
+.L57:
+	xorl	%eax, %eax
+	cmpq	%rdx, %rbp
+	sete	%al
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L67:
+	.cfi_restore_state
+	cmpq	%rbx, %rdx
+	je	.L44
+	cmpq	%rbp, %rdx
+	jb	.L60
+	jmp	.L57
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	subq	$1, %rbp
+	cmpq	%rdx, %rbp
+	je	.L57
+.L60:
+	movzbl	-1(%rbp), %eax
+	cmpb	$32, %al
+	je	.L61
+	cmpb	$9, %al
+	je	.L61
+	jmp	.L57
+.L79:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	isMaterialLine, .-isMaterialLine
+	.p2align 4
+	.type	parseFloat, @function
+parseFloat:
+.LFB21:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdx, %rdi
+	movq	%rsi, %rbx
+	movq	%rcx, %rsi
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	leaq	12(%rsp), %rdx
+	movl	$0x00000000, 12(%rsp)
+	call	parseWavefrontFloat@PLT
+	movss	12(%rsp), %xmm0
+	xorl	%eax, %eax
+	movss	%xmm0, (%rbx)
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	parseFloat, .-parseFloat
+	.p2align 4
+	.type	parseTransparency, @function
+parseTransparency:
+.LFB22:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdx, %rdi
+	movq	%rsi, %rbx
+	movq	%rcx, %rsi
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	leaq	12(%rsp), %rdx
+	movl	$0x00000000, 12(%rsp)
+	call	parseWavefrontFloat@PLT
+	movss	.LC4(%rip), %xmm0
+	xorl	%eax, %eax
+	subss	12(%rsp), %xmm0
+	movss	%xmm0, (%rbx)
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	parseTransparency, .-parseTransparency
+	.p2align 4
+	.type	parseColor, @function
+parseColor:
+.LFB19:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	leaq	16(%rsp), %rax
+	movq	%rdi, 8(%rsp)
+	movq	%rax, %xmm0
+	leaq	20(%rsp), %rax
+	movq	%rax, %xmm1
+	leaq	24(%rsp), %rax
+	punpcklqdq	%xmm1, %xmm0
+	movq	%rax, 48(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	cmpq	%rcx, %rdx
+	jb	.L87
+	jmp	.L104
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L104
+.L87:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L89
+	cmpb	$9, %al
+	je	.L89
+	cmpq	%rbp, %rbx
+	jnb	.L104
+	movq	%rbx, %r13
+	movl	$1, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L107
+	cmpb	$9, %al
+	je	.L107
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L90
+	movq	24(%rsp,%r15,8), %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %rbp
+	jne	.L95
+	movl	%r15d, %r14d
+	cmpq	%r13, %rax
+	jne	.L97
+.L95:
+	movl	$1, %eax
+	jmp	.L88
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movq	24(%rsp,%r15,8), %rdx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	movl	%r15d, %r14d
+	call	parseWavefrontFloat@PLT
+	cmpq	%r13, %rax
+	je	.L95
+	cmpq	%rbx, %rax
+	jne	.L95
+	cmpq	%rbp, %rbx
+	jb	.L96
+	jmp	.L97
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	addq	$1, %rbx
+	cmpq	%rbx, %rbp
+	je	.L97
+.L96:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L99
+	cmpb	$9, %al
+	je	.L99
+	cmpq	%rbp, %rbx
+	jnb	.L97
+	addq	$1, %r15
+	cmpq	$4, %r15
+	je	.L106
+	movq	%rbx, %r13
+	jmp	.L90
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	movl	$2, %eax
+.L88:
+	movq	8(%rsp), %rcx
+	movl	%eax, 80(%rcx)
+	movl	$3, %eax
+.L86:
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.cfi_restore_state
+	xorl	%eax, %eax
+	jmp	.L88
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	cmpl	$1, %r14d
+	je	.L116
+	cmpl	$3, %r14d
+	jne	.L117
+.L103:
+	movl	$0x3f800000, 28(%rsp)
+	movdqa	16(%rsp), %xmm2
+	xorl	%eax, %eax
+	movups	%xmm2, (%r12)
+	jmp	.L86
+.L117:
+	movss	16(%rsp), %xmm0
+.L102:
+	movss	%xmm0, 24(%rsp)
+	jmp	.L103
+.L116:
+	movss	16(%rsp), %xmm0
+	movss	%xmm0, 20(%rsp)
+	jmp	.L102
+	.cfi_endproc
+.LFE19:
+	.size	parseColor, .-parseColor
+	.p2align 4
+	.type	parseInteger, @function
+parseInteger:
+.LFB20:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdx, %rdi
+	movq	%rsi, %rbx
+	movq	%rcx, %rsi
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	leaq	12(%rsp), %rdx
+	movl	$0, 12(%rsp)
+	call	parseWavefrontInteger@PLT
+	movl	12(%rsp), %eax
+	movl	%eax, (%rbx)
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	parseInteger, .-parseInteger
+	.p2align 4
+	.type	assignMap, @function
+assignMap:
+.LFB27:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rsi, %rbx
+	movq	%rcx, %rsi
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	cmpq	%r8, %rcx
+	jb	.L121
+	jmp	.L122
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	subq	$1, %r8
+	cmpq	%r8, %rsi
+	je	.L123
+.L121:
+	movzbl	-1(%r8), %eax
+	cmpb	$32, %al
+	je	.L124
+	cmpb	$9, %al
+	je	.L124
+.L122:
+	cmpq	%r8, %rsi
+	je	.L123
+	movq	%r8, %rdx
+	movq	(%r12), %rdi
+	leaq	8(%rsp), %rcx
+	movl	$0, 8(%rsp)
+	subq	%rsi, %rdx
+	movl	$0, 12(%rsp)
+	call	wavefrontMTLInternTexture@PLT
+	testl	%eax, %eax
+	je	.L129
+.L120:
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	.cfi_restore_state
+	movq	(%r12), %rdi
+	leaq	12(%rsp), %rdx
+	movq	%rbp, %rsi
+	call	wavefrontMTLInternMapOptions@PLT
+	testl	%eax, %eax
+	jne	.L120
+	movl	8(%rbx), %eax
+	testl	%eax, %eax
+	je	.L130
+.L126:
+	movq	(%r12), %rdx
+	movl	8(%rsp), %eax
+	movd	12(%rsp), %xmm1
+	movq	32(%rdx), %rdx
+	leal	-1(%rax), %ecx
+	movd	%eax, %xmm0
+	punpckldq	%xmm1, %xmm0
+	movq	(%rdx,%rcx,8), %rdx
+	movq	%xmm0, 8(%rbx)
+	movq	%rdx, (%rbx)
+.L123:
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	xorl	%eax, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.L130:
+	.cfi_restore_state
+	movq	(%rbx), %rsi
+	movq	(%r12), %rdi
+	call	wavefrontMTLFreeString@PLT
+	jmp	.L126
+	.cfi_endproc
+.LFE27:
+	.size	assignMap, .-assignMap
+	.p2align 4
+	.type	indexScan, @function
+indexScan:
+.LFB65:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1160, %rsp
+	.cfi_def_cfa_offset 1216
+	movq	(%rdi), %r12
+	movq	8(%rdi), %rbx
+	addq	%r12, %rbx
+	movq	%r12, %xmm0
+	movq	%r12, 96(%rsp)
+	movq	%rbx, %xmm1
+	movq	%rbx, 40(%rsp)
+	punpcklqdq	%xmm1, %xmm0
+	movaps	%xmm0, 80(%rsp)
+	call	wavefrontScanKernel@PLT
+	pxor	%xmm0, %xmm0
+	movl	%eax, 104(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	cmpq	%rbx, %r12
+	jnb	.L133
+	movq	80(%rsp), %rbx
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	xorl	%ebp, %ebp
+	leaq	128(%rsp), %r14
+	movq	%r15, %r13
+	movq	%rbx, %rsi
+	cmpq	%rax, %rdx
+	je	.L137
+	jmp	.L225
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	movq	80(%rsp), %rsi
+	addq	%r15, %rsi
+	movq	%rsi, 80(%rsp)
+	testq	%rax, %rax
+	jne	.L226
+.L137:
+	movq	88(%rsp), %r15
+	cmpq	%rsi, %r15
+	je	.L217
+	subq	%rsi, %r15
+	movl	$65536, %eax
+	movl	104(%rsp), %edi
+	movq	%r14, %rcx
+	cmpq	%rax, %r15
+	movl	$256, %r8d
+	movq	%rsi, 96(%rsp)
+	cmova	%rax, %r15
+	movq	%r15, %rdx
+	call	wavefrontFindLineEnds@PLT
+	movq	$0, 120(%rsp)
+	movq	%rax, 112(%rsp)
+	cmpq	$256, %rax
+	jne	.L135
+	movq	96(%rsp), %rbx
+	movl	1148(%rsp), %eax
+	movl	$1, %edx
+	leaq	1(%rbx,%rax), %rax
+	movq	%rax, 80(%rsp)
+	xorl	%eax, %eax
+.L136:
+	movl	128(%rsp,%rax,4), %eax
+	movq	%r12, %rdi
+	movq	%rdx, 120(%rsp)
+	addq	%rax, %rbx
+	movq	%rbx, %rsi
+	call	isMaterialLine
+	testl	%eax, %eax
+	jne	.L227
+.L138:
+	movq	40(%rsp), %rax
+	cmpq	%rax, %rbx
+	jnb	.L133
+	leaq	1(%rbx), %r12
+	cmpq	%rax, %r12
+	jnb	.L133
+	movq	80(%rsp), %rbx
+	movq	112(%rsp), %rdx
+	movq	120(%rsp), %rax
+	movq	%rbx, %rsi
+	cmpq	%rax, %rdx
+	je	.L137
+.L225:
+	movq	96(%rsp), %rbx
+	leaq	1(%rax), %rdx
+	jmp	.L136
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	xorl	%eax, %eax
+.L131:
+	addq	$1160, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	.cfi_restore_state
+	movq	%rsi, %rbx
+	movq	%r12, %rdi
+	movq	%rbx, %rsi
+	call	isMaterialLine
+	testl	%eax, %eax
+	je	.L138
+.L227:
+	testq	%rbp, %rbp
+	je	.L139
+	movq	%r12, 8(%rbp)
+.L139:
+	cmpq	%rbx, %r12
+	jb	.L140
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	addq	$1, %r12
+	cmpq	%rbx, %r12
+	je	.L178
+.L140:
+	movzbl	(%r12), %eax
+	cmpb	$32, %al
+	je	.L143
+	cmpb	$9, %al
+	je	.L143
+	cmpq	%rbx, %r12
+	jnb	.L178
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	movzbl	(%r12), %eax
+	cmpb	$32, %al
+	je	.L147
+	cmpb	$9, %al
+	je	.L147
+	addq	$1, %r12
+	cmpq	%rbx, %r12
+	jne	.L142
+.L178:
+	xorl	%r15d, %r15d
+.L149:
+	movl	44(%r13), %ebp
+	cmpl	%ebp, 40(%r13)
+	je	.L228
+.L154:
+	movl	24(%r13), %eax
+	movl	56(%r13), %ebp
+	leal	2(%rax,%rax), %eax
+	cmpl	%eax, %ebp
+	jnb	.L158
+.L230:
+	testl	%ebp, %ebp
+	je	.L181
+	leal	(%rbp,%rbp), %esi
+	movq	%rsi, %rbp
+.L159:
+	movq	168(%r13), %rdi
+	movl	$4, %edx
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	%rax, 16(%rsp)
+	testq	%rax, %rax
+	je	.L160
+	movq	48(%r13), %rsi
+	movq	168(%r13), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	16(%rsp), %rax
+	movl	%ebp, 56(%r13)
+	movq	%rax, 48(%r13)
+	movl	24(%r13), %eax
+	testl	%eax, %eax
+	je	.L158
+	movq	%r12, 48(%rsp)
+	xorl	%r8d, %r8d
+	movl	%ebp, %ecx
+	movq	%rbx, 56(%rsp)
+	movl	%r8d, %edx
+	movq	%r13, %r8
+	movq	%r15, 64(%rsp)
+	movq	%r14, 72(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L165:
+	movl	%edx, %eax
+	movl	%edx, 32(%rsp)
+	leal	-1(%rcx), %ebp
+	salq	$5, %rax
+	addq	16(%r8), %rax
+	movq	%r8, 24(%rsp)
+	movq	8(%rax), %r12
+	movq	(%rax), %rdi
+	movq	%r12, %rsi
+	movq	%rdi, 8(%rsp)
+	call	wavefrontMTLHashName@PLT
+	movq	24(%rsp), %r8
+	movl	32(%rsp), %edx
+	andl	%ebp, %eax
+	movq	48(%r8), %r13
+	movl	%eax, %ebx
+	leaq	0(,%rax,4), %r14
+	movl	0(%r13,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L161
+	movq	16(%r8), %r15
+	movq	%r13, %rcx
+	movl	%edx, 24(%rsp)
+	movq	%r8, 32(%rsp)
+	movq	%r15, %r13
+	movq	%r14, %r15
+	movl	%ebp, %r14d
+	movq	%rcx, %rbp
+	jmp	.L163
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	addl	$1, %ebx
+	andl	%r14d, %ebx
+	movl	%ebx, %eax
+	leaq	0(,%rax,4), %r15
+	movl	0(%rbp,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L222
+.L163:
+	salq	$5, %rax
+	leaq	-32(%r13,%rax), %rax
+	cmpq	8(%rax), %r12
+	jne	.L162
+	movq	(%rax), %rdi
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdx
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L162
+.L222:
+	movl	24(%rsp), %edx
+	movq	32(%rsp), %r8
+	movq	%r15, %r14
+	movq	%rbp, %r13
+.L161:
+	movq	16(%rsp), %rax
+	addl	$1, %edx
+	movl	%edx, (%rax,%r14)
+	cmpl	24(%r8), %edx
+	jnb	.L229
+	movq	%r13, 16(%rsp)
+	movl	56(%r8), %ecx
+	jmp	.L165
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	cmpq	%rbx, %r12
+	jb	.L146
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	addq	$1, %r12
+	cmpq	%rbx, %r12
+	je	.L178
+.L146:
+	movzbl	(%r12), %eax
+	cmpb	$32, %al
+	je	.L150
+	cmpb	$9, %al
+	je	.L150
+	cmpq	%rbx, %r12
+	jnb	.L178
+	movq	%r12, %r15
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	movzbl	(%r15), %eax
+	cmpb	$32, %al
+	je	.L183
+	cmpb	$9, %al
+	je	.L183
+	addq	$1, %r15
+	cmpq	%rbx, %r15
+	jne	.L151
+	movq	%rbx, %r15
+	movl	44(%r13), %ebp
+	subq	%r12, %r15
+	cmpl	%ebp, 40(%r13)
+	jne	.L154
+.L228:
+	testl	%ebp, %ebp
+	je	.L180
+	leal	(%rbp,%rbp), %eax
+	leaq	(%rax,%rax,2), %rdx
+	movq	%rax, %rbp
+	salq	$3, %rdx
+.L155:
+	movq	32(%r13), %rsi
+	movq	168(%r13), %rdi
+	call	wavefrontReallocateWith@PLT
+	testq	%rax, %rax
+	je	.L160
+	movq	%rax, 32(%r13)
+	movl	24(%r13), %eax
+	movl	%ebp, 44(%r13)
+	movl	56(%r13), %ebp
+	leal	2(%rax,%rax), %eax
+	cmpl	%eax, %ebp
+	jb	.L230
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	leal	-1(%rbp), %r10d
+	movq	%r15, %rsi
+	movq	%r12, %rdi
+	movl	%r10d, 8(%rsp)
+	call	wavefrontMTLHashName@PLT
+	movl	8(%rsp), %r10d
+	movq	48(%r13), %r8
+	movq	16(%r13), %rcx
+	andl	%r10d, %eax
+	movl	%eax, %ebp
+	leaq	0(,%rax,4), %r9
+	movl	(%r8,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L167
+	movq	%r12, 8(%rsp)
+	movq	%r15, %r12
+	movq	%rcx, %r15
+	movq	%rbx, 16(%rsp)
+	movq	%r9, %rbx
+	movq	%r13, 24(%rsp)
+	movq	%r8, %r13
+	movq	%r14, 32(%rsp)
+	movl	%r10d, %r14d
+	jmp	.L170
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	addl	$1, %ebp
+	andl	%r14d, %ebp
+	movl	%ebp, %eax
+	leaq	0(,%rax,4), %rbx
+	movl	0(%r13,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L231
+.L170:
+	salq	$5, %rax
+	leaq	-32(%r15,%rax), %rax
+	cmpq	%r12, 8(%rax)
+	jne	.L168
+	movq	(%rax), %rdi
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdx
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L168
+	movq	%rbx, %r9
+	movq	%r13, %r8
+	movq	16(%rsp), %rbx
+	movq	24(%rsp), %r13
+	movq	32(%rsp), %r14
+	movl	(%r8,%r9), %edx
+	movq	%r15, %rcx
+.L171:
+	salq	$5, %rdx
+	movq	32(%r13), %rsi
+	leaq	-32(%rcx,%rdx), %rdi
+	movl	40(%r13), %edx
+	movq	8(%r13), %rcx
+	addq	0(%r13), %rcx
+	leal	1(%rdx), %eax
+	leaq	(%rdx,%rdx,2), %rdx
+	leaq	(%rsi,%rdx,8), %rdx
+	movl	%eax, 40(%r13)
+	movq	%rbx, (%rdx)
+	movq	%rcx, 8(%rdx)
+	movl	$0, 16(%rdx)
+	movl	20(%rdi), %edx
+	testl	%edx, %edx
+	je	.L174
+	subl	$1, %edx
+	leaq	(%rdx,%rdx,2), %rdx
+	movl	%eax, 16(%rsi,%rdx,8)
+.L175:
+	movl	%eax, 20(%rdi)
+	leaq	(%rax,%rax,2), %rax
+	leaq	-24(%rsi,%rax,8), %rbp
+	jmp	.L138
+	.p2align 4,,10
+	.p2align 3
+.L231:
+	movq	%rbx, %r9
+	movq	%r13, %r8
+	movq	%r15, %rcx
+	movq	16(%rsp), %rbx
+	movq	%r12, %r15
+	movq	24(%rsp), %r13
+	movq	8(%rsp), %r12
+	movq	32(%rsp), %r14
+.L167:
+	movl	24(%r13), %ebp
+	cmpl	28(%r13), %ebp
+	je	.L232
+.L172:
+	leal	1(%rbp), %edx
+	salq	$5, %rbp
+	leaq	(%rcx,%rbp), %rax
+	movl	%edx, 24(%r13)
+	movq	%r12, (%rax)
+	movq	%r15, 8(%rax)
+	movq	$0, 16(%rax)
+	movl	$-1, 24(%rax)
+	movl	%edx, (%r8,%r9)
+	jmp	.L171
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	subq	%r12, %r15
+	jmp	.L149
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	movl	%eax, 16(%rdi)
+	jmp	.L175
+.L229:
+	movq	48(%rsp), %r12
+	movq	56(%rsp), %rbx
+	movq	%r8, %r13
+	movq	64(%rsp), %r15
+	movq	72(%rsp), %r14
+	movl	56(%r8), %ebp
+	jmp	.L158
+.L181:
+	movl	$64, %esi
+	movl	$64, %ebp
+	jmp	.L159
+.L160:
+	movl	$1, %eax
+	jmp	.L131
+.L180:
+	movl	$1536, %edx
+	movl	$64, %ebp
+	jmp	.L155
+.L232:
+	testl	%ebp, %ebp
+	je	.L182
+	leal	(%rbp,%rbp), %edx
+	movq	%rdx, %rbp
+	salq	$5, %rdx
+.L173:
+	movq	168(%r13), %rdi
+	movq	%rcx, %rsi
+	movq	%r9, 8(%rsp)
+	call	wavefrontReallocateWith@PLT
+	movq	%rax, %rcx
+	testq	%rax, %rax
+	je	.L160
+	movq	48(%r13), %r8
+	movq	8(%rsp), %r9
+	movl	%ebp, 28(%r13)
+	movq	%rax, 16(%r13)
+	movl	24(%r13), %ebp
+	jmp	.L172
+.L182:
+	movl	$2048, %edx
+	movl	$64, %ebp
+	jmp	.L173
+.L226:
+	movq	96(%rsp), %rbx
+	movl	$1, %edx
+	xorl	%eax, %eax
+	jmp	.L136
+	.cfi_endproc
+.LFE65:
+	.size	indexScan, .-indexScan
+	.p2align 4
+	.type	nextMaterialLine, @function
+nextMaterialLine:
+.LFB50:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	xorl	%eax, %eax
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$1096, %rsp
+	.cfi_def_cfa_offset 1136
+	movq	%rsi, 24(%rsp)
+	leaq	64(%rsp), %rbp
+	movq	%rdi, 32(%rsp)
+	movq	%rdi, 16(%rsp)
+	call	wavefrontScanKernel@PLT
+	pxor	%xmm0, %xmm0
+	movq	16(%rsp), %rsi
+	movl	%eax, 40(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	jmp	.L237
+	.p2align 4,,10
+	.p2align 3
+.L235:
+	movq	16(%rsp), %rsi
+	addq	%rbx, %rsi
+	movq	%rsi, 16(%rsp)
+	testq	%rax, %rax
+	jne	.L252
+.L237:
+	movq	24(%rsp), %rbx
+	cmpq	%rsi, %rbx
+	je	.L234
+	subq	%rsi, %rbx
+	movl	$65536, %eax
+	movl	40(%rsp), %edi
+	movq	%rbp, %rcx
+	cmpq	%rax, %rbx
+	movl	$256, %r8d
+	movq	%rsi, 32(%rsp)
+	cmova	%rax, %rbx
+	movq	%rbx, %rdx
+	call	wavefrontFindLineEnds@PLT
+	movq	$0, 56(%rsp)
+	movq	%rax, 48(%rsp)
+	cmpq	$256, %rax
+	jne	.L235
+	movq	32(%rsp), %rsi
+	movl	1084(%rsp), %eax
+	leaq	1(%rsi,%rax), %rax
+	movq	%rax, 16(%rsp)
+.L236:
+	movq	$1, 56(%rsp)
+	movl	64(%rsp), %eax
+	addq	%rax, %rsi
+.L234:
+	leaq	64(%rsp), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	cmpq	%r13, %rsi
+	jnb	.L243
+	movq	56(%rsp), %rax
+	leaq	1(%rsi), %r12
+	cmpq	%rax, 48(%rsp)
+	jne	.L238
+	movq	16(%rsp), %rsi
+	jmp	.L242
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	addq	16(%rsp), %rbx
+	movq	%rbx, 16(%rsp)
+	movq	%rbx, %rsi
+	testq	%rax, %rax
+	jne	.L253
+.L242:
+	movq	24(%rsp), %rbx
+	cmpq	%rsi, %rbx
+	je	.L239
+	subq	%rsi, %rbx
+	movl	$65536, %eax
+	movl	40(%rsp), %edi
+	movq	%rbp, %rcx
+	cmpq	%rax, %rbx
+	movl	$256, %r8d
+	movq	%rsi, 32(%rsp)
+	cmova	%rax, %rbx
+	movq	%rbx, %rdx
+	call	wavefrontFindLineEnds@PLT
+	movq	$0, 56(%rsp)
+	movq	%rax, 48(%rsp)
+	cmpq	$256, %rax
+	jne	.L240
+	movq	32(%rsp), %rsi
+	movl	1084(%rsp), %eax
+	movl	$1, %edx
+	leaq	1(%rsi,%rax), %rax
+	movq	%rax, 16(%rsp)
+	xorl	%eax, %eax
+.L241:
+	movl	64(%rsp,%rax,4), %eax
+	movq	%rdx, 56(%rsp)
+	addq	%rax, %rsi
+.L239:
+	movq	%r12, %rdi
+	movq	%rsi, 8(%rsp)
+	call	isMaterialLine
+	movq	8(%rsp), %rsi
+	testl	%eax, %eax
+	je	.L244
+	movq	%r12, %r13
+.L243:
+	addq	$1096, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%r13, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.L238:
+	.cfi_restore_state
+	movq	32(%rsp), %rsi
+	leaq	1(%rax), %rdx
+	jmp	.L241
+.L253:
+	movq	32(%rsp), %rsi
+	movl	$1, %edx
+	xorl	%eax, %eax
+	jmp	.L241
+.L252:
+	movq	32(%rsp), %rsi
+	jmp	.L236
+	.cfi_endproc
+.LFE50:
+	.size	nextMaterialLine, .-nextMaterialLine
+	.section	.rodata.str1.1
+.LC5:
+	.string	"o"
+.LC6:
+	.string	"s"
+.LC7:
+	.string	"t"
+.LC8:
+	.string	"bm"
+.LC9:
+	.string	"boost"
+.LC10:
+	.string	"mm"
+.LC11:
+	.string	"texres"
+.LC12:
+	.string	"imfchan"
+.LC13:
+	.string	"rgbmlz"
+.LC14:
+	.string	"blendu"
+.LC15:
+	.string	"blendv"
+.LC16:
+	.string	"cc"
+.LC17:
+	.string	"clamp"
+.LC18:
+	.string	"type"
+	.text
+	.p2align 4
+	.type	parseMapOptions.constprop.0, @function
+parseMapOptions.constprop.0:
+.LFB70:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	leaq	72(%rsp), %rax
+	movq	%rdi, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	cmpq	%rdx, %rsi
+	jnb	.L395
+	movq	%r8, 56(%rsp)
+	movq	%rdx, %r13
+	movq	%rcx, %rbx
+	movq	%r9, 48(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L255:
+	cmpb	$45, (%r12)
+	jne	.L395
+	leaq	1(%r12), %r14
+	cmpq	%r13, %r12
+	jnb	.L395
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	movzbl	(%r12), %eax
+	cmpb	$32, %al
+	je	.L396
+	cmpb	$9, %al
+	je	.L396
+	addq	$1, %r12
+	cmpq	%r13, %r12
+	jne	.L257
+	movq	%r12, %rdx
+	subq	%r14, %rdx
+.L263:
+	movq	%r12, 8(%rsp)
+	jmp	.L264
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	movq	%r12, %rdx
+	subq	%r14, %rdx
+	cmpq	%r13, %r12
+	jb	.L262
+	jmp	.L263
+	.p2align 4,,10
+	.p2align 3
+.L265:
+	addq	$1, %r12
+	cmpq	%r12, %r13
+	je	.L371
+.L262:
+	movzbl	(%r12), %eax
+	cmpb	$32, %al
+	je	.L265
+	cmpb	$9, %al
+	je	.L265
+	cmpq	%r13, %r12
+	jnb	.L263
+	movq	%r12, %r8
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	movzbl	(%r8), %eax
+	cmpb	$32, %al
+	je	.L448
+	cmpb	$9, %al
+	je	.L448
+	addq	$1, %r8
+	cmpq	%r8, %r13
+	jne	.L266
+.L448:
+	movq	%r8, 8(%rsp)
+.L264:
+	cmpq	$1, %rdx
+	je	.L482
+.L269:
+	cmpq	$2, %rdx
+	je	.L483
+	cmpq	$5, %rdx
+	jne	.L484
+	movl	$5, %edx
+	leaq	.LC9(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L485
+	movl	$5, %edx
+	leaq	.LC17(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L302
+	movq	16(%rsp), %rax
+	movl	$8, %ecx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	leaq	60(%rax), %rdx
+	call	parseOptionSwitch
+	movq	%rax, %rbp
+	jmp	.L285
+	.p2align 4,,10
+	.p2align 3
+.L371:
+	movq	%r13, 8(%rsp)
+	cmpq	$1, %rdx
+	jne	.L269
+.L482:
+	leaq	.LC5(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L486
+	xorl	%r14d, %r14d
+	movq	%r12, 32(%rsp)
+	movq	%r12, %rbp
+	movq	%rbx, 40(%rsp)
+	movq	%r14, %r12
+	movq	16(%rsp), %rbx
+	movq	24(%rsp), %r14
+	.p2align 4,,10
+	.p2align 3
+.L270:
+	cmpq	%r13, %rbp
+	jnb	.L469
+	movq	%rbp, %r15
+	.p2align 4,,10
+	.p2align 3
+.L286:
+	movzbl	(%r15), %eax
+	cmpb	$32, %al
+	je	.L272
+	cmpb	$9, %al
+	je	.L272
+	addq	$1, %r15
+	cmpq	%r15, %r13
+	jne	.L286
+.L272:
+	cmpq	%rbp, %r15
+	je	.L469
+	movq	%r14, %rdx
+	movq	%r15, %rsi
+	movq	%rbp, %rdi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %r15
+	jne	.L469
+	movss	72(%rsp), %xmm0
+	movss	%xmm0, (%rbx,%r12,4)
+	cmpq	%r13, %r15
+	jb	.L282
+	jmp	.L470
+	.p2align 4,,10
+	.p2align 3
+.L284:
+	addq	$1, %r15
+	cmpq	%r15, %r13
+	je	.L376
+.L282:
+	movzbl	(%r15), %eax
+	cmpb	$32, %al
+	je	.L284
+	cmpb	$9, %al
+	je	.L284
+.L470:
+	movq	%r15, %rbp
+.L283:
+	addq	$1, %r12
+	cmpq	$3, %r12
+	jne	.L270
+.L477:
+	movq	32(%rsp), %r12
+	movq	40(%rsp), %rbx
+.L285:
+	testq	%rbp, %rbp
+	je	.L280
+.L478:
+	movq	%rbp, %r12
+.L281:
+	cmpq	%r13, %r12
+	jb	.L255
+.L395:
+	movq	%r12, %r14
+.L254:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	.cfi_restore_state
+	movq	%r13, %rbp
+	jmp	.L283
+	.p2align 4,,10
+	.p2align 3
+.L486:
+	movl	$1, %edx
+	leaq	.LC6(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L487
+	xorl	%r15d, %r15d
+	movq	%r12, %rbp
+	movq	%r12, 32(%rsp)
+	movq	%rbx, 40(%rsp)
+	movq	%r15, %r12
+	movq	16(%rsp), %rbx
+	movq	24(%rsp), %r15
+	cmpq	%r13, %rbp
+	jnb	.L473
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	movq	%rbp, %r14
+	.p2align 4,,10
+	.p2align 3
+.L300:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L289
+	cmpb	$9, %al
+	je	.L289
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	jne	.L300
+.L289:
+	cmpq	%r14, %rbp
+	je	.L473
+	movq	%r15, %rdx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %r14
+	jne	.L473
+	movss	72(%rsp), %xmm0
+	movss	%xmm0, 12(%rbx,%r12,4)
+	cmpq	%r13, %r14
+	jb	.L297
+	jmp	.L472
+	.p2align 4,,10
+	.p2align 3
+.L299:
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	je	.L380
+.L297:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L299
+	cmpb	$9, %al
+	je	.L299
+.L472:
+	movq	%r14, %rbp
+.L298:
+	addq	$1, %r12
+	cmpq	$3, %r12
+	je	.L477
+	cmpq	%r13, %rbp
+	jb	.L381
+.L473:
+	movq	%r12, %r15
+	movq	40(%rsp), %rbx
+	movq	32(%rsp), %r12
+	testl	%r15d, %r15d
+	jne	.L478
+.L280:
+	movq	48(%rsp), %rax
+	movq	8(%rsp), %r8
+	movl	$1, (%rax)
+	cmpq	%r13, 8(%rsp)
+	jb	.L367
+	jmp	.L488
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	addq	$1, %r8
+	cmpq	%r8, %r13
+	je	.L281
+.L367:
+	movzbl	(%r8), %eax
+	cmpb	$32, %al
+	je	.L369
+	cmpb	$9, %al
+	je	.L369
+	cmpq	%r8, %r13
+	cmovne	%r8, %r12
+	jmp	.L281
+	.p2align 4,,10
+	.p2align 3
+.L380:
+	movq	%r13, %rbp
+	jmp	.L298
+.L487:
+	movl	$1, %edx
+	leaq	.LC7(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L382
+.L302:
+	movq	8(%rsp), %r12
+	cmpq	%r13, %r12
+	jnb	.L395
+	.p2align 4,,10
+	.p2align 3
+.L365:
+	movzbl	(%r12), %eax
+	cmpb	$32, %al
+	je	.L366
+	cmpb	$9, %al
+	jne	.L281
+.L366:
+	addq	$1, %r12
+	cmpq	%r12, %r13
+	jne	.L365
+.L359:
+	movq	%r13, %r12
+	jmp	.L281
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movl	$2, %edx
+	leaq	.LC8(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L489
+	cmpq	%r13, %r12
+	jnb	.L280
+	movq	%r12, %r14
+	.p2align 4,,10
+	.p2align 3
+.L323:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L322
+	cmpb	$9, %al
+	je	.L322
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	jne	.L323
+.L322:
+	cmpq	%r14, %r12
+	je	.L280
+	leaq	72(%rsp), %rdx
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %r14
+	jne	.L280
+	movss	72(%rsp), %xmm0
+	movq	16(%rsp), %rax
+	movss	%xmm0, 36(%rax)
+	cmpq	%r13, %r14
+	jb	.L326
+	jmp	.L389
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	je	.L359
+.L326:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L397
+	cmpb	$9, %al
+	je	.L397
+.L389:
+	movq	%r14, %r12
+	jmp	.L281
+.L469:
+	movq	%r12, %r14
+	movq	40(%rsp), %rbx
+	movq	32(%rsp), %r12
+	testl	%r14d, %r14d
+	jne	.L478
+	jmp	.L280
+.L484:
+	cmpq	$6, %rdx
+	jne	.L490
+	movl	$6, %edx
+	leaq	.LC11(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L349
+	movq	8(%rsp), %r15
+	cmpq	%r15, %r12
+	je	.L280
+	leaq	72(%rsp), %rdx
+	movq	%r15, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontInteger@PLT
+	cmpq	%rax, %r15
+	jne	.L280
+	movl	72(%rsp), %eax
+	movq	16(%rsp), %rcx
+	movq	8(%rsp), %r12
+	movl	%eax, 52(%rcx)
+	cmpq	%r13, 8(%rsp)
+	jnb	.L281
+	movq	8(%rsp), %r8
+	jmp	.L352
+.L354:
+	addq	$1, %r8
+	cmpq	%r8, %r13
+	je	.L359
+.L352:
+	movzbl	(%r8), %eax
+	cmpb	$32, %al
+	je	.L354
+	cmpb	$9, %al
+	je	.L354
+.L479:
+	movq	%r8, %r12
+	jmp	.L281
+.L349:
+	movl	$6, %edx
+	leaq	.LC14(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L362
+	movq	16(%rsp), %rax
+	movl	$1, %ecx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	leaq	60(%rax), %rdx
+	call	parseOptionSwitch
+	movq	%rax, %rbp
+	jmp	.L285
+.L362:
+	movl	$6, %edx
+	leaq	.LC15(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L302
+	movq	16(%rsp), %rax
+	movl	$2, %ecx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	leaq	60(%rax), %rdx
+	call	parseOptionSwitch
+	movq	%rax, %rbp
+	jmp	.L285
+.L489:
+	movl	$2, %edx
+	leaq	.LC10(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L491
+	movl	$2, %edx
+	leaq	.LC16(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L302
+	movq	16(%rsp), %rax
+	movl	$4, %ecx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	leaq	60(%rax), %rdx
+	call	parseOptionSwitch
+	movq	%rax, %rbp
+	jmp	.L285
+.L382:
+	xorl	%r15d, %r15d
+	movq	%r12, 32(%rsp)
+	movq	%r12, %rbp
+	movq	%rbx, 40(%rsp)
+	movq	%r15, %r12
+	movq	16(%rsp), %rbx
+	movq	24(%rsp), %r15
+	.p2align 4,,10
+	.p2align 3
+.L301:
+	cmpq	%r13, %rbp
+	jnb	.L473
+	movq	%rbp, %r14
+	.p2align 4,,10
+	.p2align 3
+.L316:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L305
+	cmpb	$9, %al
+	je	.L305
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	jne	.L316
+.L305:
+	cmpq	%rbp, %r14
+	je	.L473
+	movq	%r15, %rdx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %r14
+	jne	.L473
+	movss	72(%rsp), %xmm0
+	movss	%xmm0, 24(%rbx,%r12,4)
+	cmpq	%r13, %r14
+	jb	.L313
+	jmp	.L474
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	je	.L384
+.L313:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L315
+	cmpb	$9, %al
+	je	.L315
+.L474:
+	movq	%r14, %rbp
+.L314:
+	addq	$1, %r12
+	cmpq	$3, %r12
+	jne	.L301
+	jmp	.L477
+	.p2align 4,,10
+	.p2align 3
+.L384:
+	movq	%r13, %rbp
+	jmp	.L314
+.L488:
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r13
+	je	.L281
+	movq	%rax, %r14
+	jmp	.L254
+.L485:
+	cmpq	%r13, %r12
+	jnb	.L280
+	movq	%r12, %r14
+	.p2align 4,,10
+	.p2align 3
+.L330:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L329
+	cmpb	$9, %al
+	je	.L329
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	jne	.L330
+.L329:
+	cmpq	%r14, %r12
+	je	.L280
+	leaq	72(%rsp), %rdx
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %r14
+	jne	.L280
+	movss	72(%rsp), %xmm0
+	movq	16(%rsp), %rax
+	movss	%xmm0, 40(%rax)
+	cmpq	%r13, %r14
+	jb	.L333
+	jmp	.L389
+	.p2align 4,,10
+	.p2align 3
+.L398:
+	addq	$1, %r14
+	cmpq	%r14, %r13
+	je	.L359
+.L333:
+	movzbl	(%r14), %eax
+	cmpb	$32, %al
+	je	.L398
+	cmpb	$9, %al
+	je	.L398
+	movq	%r14, %r12
+	jmp	.L281
+.L491:
+	leaq	72(%rsp), %rbp
+	movq	%r12, 32(%rsp)
+	movq	%r12, %rdi
+	leaq	80(%rsp), %r14
+	movq	%r13, %r12
+	leaq	68(%rsp), %r15
+	movq	%rbx, %r13
+	movq	%rbp, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L335:
+	cmpq	%r12, %rdi
+	jnb	.L457
+	movq	%rdi, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L348:
+	movzbl	0(%rbp), %eax
+	cmpb	$32, %al
+	je	.L339
+	cmpb	$9, %al
+	je	.L339
+	addq	$1, %rbp
+	cmpq	%rbp, %r12
+	jne	.L348
+.L339:
+	cmpq	%rdi, %rbp
+	je	.L457
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	call	parseWavefrontFloat@PLT
+	cmpq	%rax, %rbp
+	jne	.L457
+	movss	68(%rsp), %xmm0
+	movss	%xmm0, (%rbx)
+	cmpq	%r12, %rbp
+	jb	.L344
+	jmp	.L475
+	.p2align 4,,10
+	.p2align 3
+.L346:
+	addq	$1, %rbp
+	cmpq	%rbp, %r12
+	je	.L391
+.L344:
+	movzbl	0(%rbp), %eax
+	cmpb	$32, %al
+	je	.L346
+	cmpb	$9, %al
+	je	.L346
+.L475:
+	movq	%rbp, %rdi
+.L345:
+	addq	$4, %rbx
+	cmpq	%rbx, %r14
+	jne	.L335
+	movq	72(%rsp), %rax
+	movq	16(%rsp), %rcx
+	movq	%r13, %rbx
+	movq	%r12, %r13
+	movq	%rdi, %r12
+	movq	%rax, 44(%rcx)
+	jmp	.L281
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	movq	%r12, %rdi
+	jmp	.L345
+.L457:
+	movq	%r13, %rbx
+	movq	%r12, %r13
+	movq	32(%rsp), %r12
+	jmp	.L280
+.L490:
+	cmpq	$7, %rdx
+	jne	.L492
+	movl	$7, %edx
+	leaq	.LC12(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L302
+	movq	8(%rsp), %r15
+	movq	%r15, %rax
+	subq	%r12, %rax
+	cmpq	$1, %rax
+	jne	.L280
+	movsbl	(%r12), %r14d
+	movl	$6, %edx
+	leaq	.LC13(%rip), %rdi
+	movl	%r14d, %esi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L280
+	movq	16(%rsp), %rax
+	movq	%r15, %r12
+	movl	%r14d, 56(%rax)
+	cmpq	%r13, %r15
+	jnb	.L281
+	movq	%r15, %r8
+	jmp	.L357
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	addq	$1, %r8
+	cmpq	%r8, %r13
+	je	.L359
+.L357:
+	movzbl	(%r8), %eax
+	cmpb	$32, %al
+	je	.L360
+	cmpb	$9, %al
+	je	.L360
+	jmp	.L479
+.L492:
+	cmpq	$4, %rdx
+	jne	.L302
+	movl	$4, %edx
+	leaq	.LC18(%rip), %rsi
+	movq	%r14, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L302
+	testq	%rbx, %rbx
+	je	.L302
+	movq	8(%rsp), %rax
+	movq	56(%rsp), %rcx
+	movq	%r12, (%rbx)
+	subq	%r12, %rax
+	movq	%rax, (%rcx)
+	jmp	.L302
+	.cfi_endproc
+.LFE70:
+	.size	parseMapOptions.constprop.0, .-parseMapOptions.constprop.0
+	.p2align 4
+	.type	parseMap, @function
+parseMap:
+.LFB28:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rcx, %rbx
+	subq	$80, %rsp
+	.cfi_def_cfa_offset 128
+	leaq	16(%rsp), %r13
+	movq	%r13, %rdi
+	call	wavefrontMapOptionsCompose@PLT
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	leaq	12(%rsp), %r9
+	movl	$0, 12(%rsp)
+	call	parseMapOptions.constprop.0
+	movq	%rbx, %r8
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rcx
+	movq	%rbp, %rdi
+	call	assignMap
+	testl	%eax, %eax
+	jne	.L493
+	movl	12(%rsp), %edx
+	testl	%edx, %edx
+	je	.L493
+	cmpq	$0, 72(%rbp)
+	jne	.L500
+.L493:
+	addq	$80, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L500:
+	.cfi_restore_state
+	movl	$3, 80(%rbp)
+	movl	$3, %eax
+	jmp	.L493
+	.cfi_endproc
+.LFE28:
+	.size	parseMap, .-parseMap
+	.section	.rodata.str1.1
+.LC19:
+	.string	"Pcr"
+.LC20:
+	.string	"refl"
+.LC21:
+	.string	"bump"
+.LC22:
+	.string	"disp"
+.LC23:
+	.string	"norm"
+.LC24:
+	.string	"illum"
+.LC25:
+	.string	"decal"
+.LC26:
+	.string	"aniso"
+.LC27:
+	.string	"map_d"
+.LC28:
+	.string	"anisor"
+.LC29:
+	.string	"map_"
+.LC30:
+	.string	"ump"
+.LC31:
+	.string	"sphere"
+.LC32:
+	.string	"cube_"
+.LC33:
+	.string	"cube_top"
+.LC34:
+	.string	"cube_bottom"
+.LC35:
+	.string	"cube_back"
+.LC36:
+	.string	"cube_front"
+.LC37:
+	.string	"cube_left"
+.LC38:
+	.string	"cube_right"
+	.text
+	.p2align 4
+	.type	parseLine, @function
+parseLine:
+.LFB33:
+	.cfi_startproc
+	cmpq	%rdx, %rsi
+	jnb	.L854
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	jmp	.L502
+	.p2align 4,,10
+	.p2align 3
+.L504:
+	addq	$1, %rbp
+	cmpq	%rbp, %r12
+	je	.L503
+.L502:
+	movzbl	0(%rbp), %eax
+	cmpb	$32, %al
+	je	.L504
+	cmpb	$9, %al
+	je	.L504
+	cmpq	%r12, %rbp
+	jnb	.L503
+	movq	%rbp, %rbx
+	.p2align 4,,10
+	.p2align 3
+.L506:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L662
+	cmpb	$9, %al
+	je	.L662
+	addq	$1, %rbx
+	cmpq	%rbx, %r12
+	jne	.L506
+.L503:
+	xorl	%eax, %eax
+.L501:
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L662:
+	.cfi_restore_state
+	cmpq	%rbx, %r12
+	je	.L503
+	movq	%rbx, %rax
+	subq	%rbp, %rax
+	cmpq	$8, %rax
+	ja	.L509
+	leaq	.L511(%rip), %rdx
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L511:
+	.long	.L509-.L511
+	.long	.L517-.L511
+	.long	.L516-.L511
+	.long	.L515-.L511
+	.long	.L514-.L511
+	.long	.L513-.L511
+	.long	.L512-.L511
+	.long	.L509-.L511
+	.long	.L510-.L511
+	.text
+.L517:
+	cmpb	$100, 0(%rbp)
+	je	.L855
+	.p2align 4,,10
+	.p2align 3
+.L509:
+	cmpq	%r12, %rbx
+	jnb	.L503
+	xorl	%edx, %edx
+	jmp	.L596
+	.p2align 4,,10
+	.p2align 3
+.L598:
+	addq	$1, %rbx
+	cmpq	%r12, %rbx
+	jnb	.L597
+.L596:
+	movzbl	(%rbx), %eax
+	cmpb	$32, %al
+	je	.L598
+	cmpb	$9, %al
+	je	.L598
+.L597:
+	testl	%edx, %edx
+	je	.L503
+	cmpl	$1, %edx
+	je	.L856
+	movq	8(%r13), %rbp
+	testq	%rbp, %rbp
+	je	.L503
+	cmpl	$32, %edx
+	je	.L549
+.L611:
+	salq	$4, %rdx
+	leaq	parsers(%rip), %rax
+	movq	%r12, %rcx
+	movq	%r13, %rdi
+	addq	%rdx, %rax
+	movq	%rbx, %rdx
+	movq	8(%rax), %rsi
+	movq	(%rax), %rax
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	addq	%rbp, %rsi
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	jmp	*%rax
+.L516:
+	.cfi_restore_state
+	movzbl	0(%rbp), %eax
+	cmpb	$80, %al
+	je	.L519
+	jg	.L520
+	cmpb	$75, %al
+	je	.L521
+	cmpb	$78, %al
+	jne	.L509
+	movzbl	1(%rbp), %eax
+	cmpb	$105, %al
+	je	.L532
+	cmpb	$115, %al
+	jne	.L509
+	movl	$9, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L515:
+	movl	$3, %edx
+	leaq	.LC19(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	xorl	%edx, %edx
+	testl	%eax, %eax
+	sete	%dl
+	sall	$4, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	testl	%edx, %edx
+	je	.L503
+	movl	$16, %edx
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L514:
+	movzbl	0(%rbp), %eax
+	cmpb	$110, %al
+	je	.L545
+	jg	.L546
+	cmpb	$98, %al
+	je	.L547
+	cmpb	$100, %al
+	jne	.L509
+	movl	$4, %edx
+	leaq	.LC22(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movl	$30, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L513:
+	movzbl	0(%rbp), %eax
+	cmpb	$105, %al
+	je	.L553
+	jg	.L554
+	cmpb	$97, %al
+	je	.L555
+	cmpb	$100, %al
+	jne	.L509
+	movl	$5, %edx
+	leaq	.LC25(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movl	$31, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L512:
+	movzbl	0(%rbp), %eax
+	cmpb	$109, %al
+	je	.L562
+	cmpb	$110, %al
+	je	.L563
+	cmpb	$97, %al
+	jne	.L509
+	movl	$6, %edx
+	leaq	.LC28(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movl	$18, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L510:
+	movl	$4, %edx
+	leaq	.LC29(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movzbl	4(%rbp), %eax
+	andl	$-33, %eax
+	cmpb	$66, %al
+	jne	.L509
+	leaq	5(%rbp), %rdi
+	movl	$3, %edx
+	leaq	.LC30(%rip), %rsi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+.L852:
+	movl	$29, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+.L544:
+	movq	8(%r13), %rbp
+	testq	%rbp, %rbp
+	jne	.L611
+	jmp	.L503
+	.p2align 4,,10
+	.p2align 3
+.L546:
+	cmpb	$114, %al
+	jne	.L509
+	movl	$4, %edx
+	leaq	.LC20(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	xorl	%edx, %edx
+	testl	%eax, %eax
+	sete	%dl
+	sall	$5, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	testl	%edx, %edx
+	je	.L503
+	movq	8(%r13), %rbp
+	testq	%rbp, %rbp
+	je	.L503
+	.p2align 4,,10
+	.p2align 3
+.L549:
+	leaq	48(%rsp), %r14
+	movq	%r14, %rdi
+	call	wavefrontMapOptionsCompose@PLT
+	movq	%rbx, %rsi
+	leaq	32(%rsp), %rcx
+	movq	%r12, %rdx
+	leaq	28(%rsp), %r9
+	leaq	40(%rsp), %r8
+	movq	%r14, %rdi
+	movq	$0, 32(%rsp)
+	movq	$0, 40(%rsp)
+	movl	$0, 28(%rsp)
+	call	parseMapOptions.constprop.0
+	movq	32(%rsp), %rbx
+	movq	%rax, %r15
+	testq	%rbx, %rbx
+	je	.L613
+	movq	40(%rsp), %rcx
+	cmpq	$6, %rcx
+	je	.L857
+	cmpq	$7, %rcx
+	movq	%rcx, 8(%rsp)
+	jbe	.L613
+	movl	$5, %edx
+	leaq	.LC32(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L613
+	movzbl	5(%rbx), %eax
+	subl	$98, %eax
+	cmpb	$18, %al
+	ja	.L613
+	leaq	.L618(%rip), %rdx
+	movzbl	%al, %eax
+	movq	8(%rsp), %rcx
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L618:
+	.long	.L622-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L621-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L620-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L613-.L618
+	.long	.L619-.L618
+	.long	.L613-.L618
+	.long	.L617-.L618
+	.text
+.L520:
+	cmpb	$84, %al
+	jne	.L509
+	movzbl	1(%rbp), %eax
+	cmpb	$102, %al
+	je	.L534
+	cmpb	$114, %al
+	jne	.L509
+	movl	$7, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L554:
+	cmpb	$109, %al
+	jne	.L509
+	movl	$5, %edx
+	leaq	.LC27(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movl	$25, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L856:
+	movq	%rbx, %rax
+	cmpq	%r12, %rbx
+	jnb	.L503
+	.p2align 4,,10
+	.p2align 3
+.L600:
+	movzbl	(%rax), %edx
+	cmpb	$32, %dl
+	je	.L663
+	cmpb	$9, %dl
+	je	.L663
+	addq	$1, %rax
+	cmpq	%rax, %r12
+	jne	.L600
+.L605:
+	movq	0(%r13), %r12
+	subq	%rbx, %rax
+	movq	%rbx, %rsi
+	movq	%rax, %rdx
+	movq	%rax, %rbp
+	movq	%r12, %rdi
+	call	wavefrontMTLFindMaterialN@PLT
+	testl	%eax, %eax
+	js	.L858
+.L607:
+	cltq
+	imulq	$456, %rax, %rax
+	addq	(%r12), %rax
+	movq	%rax, 8(%r13)
+	xorl	%eax, %eax
+	jmp	.L501
+.L857:
+	movl	$6, %edx
+	leaq	.LC31(%rip), %rsi
+	movq	%rbx, %rdi
+	addq	$280, %rbp
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L613
+.L616:
+	movq	%r12, %r8
+	movq	%r15, %rcx
+	movq	%r14, %rdx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	assignMap
+	testl	%eax, %eax
+	jne	.L501
+	.p2align 4,,10
+	.p2align 3
+.L613:
+	movl	28(%rsp), %eax
+	testl	%eax, %eax
+	je	.L501
+	xorl	%eax, %eax
+	cmpq	$0, 72(%r13)
+	je	.L501
+	movl	$3, 80(%r13)
+	movl	$3, %eax
+	jmp	.L501
+.L855:
+	cmpq	%r12, %rbx
+	jnb	.L595
+	movl	$11, %edx
+	jmp	.L596
+.L532:
+	movl	$10, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L534:
+	movl	$6, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L619:
+	cmpq	$10, %rcx
+	jne	.L613
+	movl	$10, %edx
+	leaq	.LC38(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L613
+	addq	$376, %rbp
+	jmp	.L616
+.L620:
+	cmpq	$9, %rcx
+	jne	.L613
+	movl	$9, %edx
+	leaq	.LC37(%rip), %rsi
+	movq	%rbx, %rdi
+	addq	$360, %rbp
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L616
+	jmp	.L613
+.L621:
+	cmpq	$10, %rcx
+	jne	.L613
+	movl	$10, %edx
+	leaq	.LC36(%rip), %rsi
+	movq	%rbx, %rdi
+	addq	$328, %rbp
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L616
+	jmp	.L613
+.L622:
+	cmpq	$11, %rcx
+	je	.L859
+	cmpq	$9, %rcx
+	jne	.L613
+	movl	$9, %edx
+	leaq	.LC35(%rip), %rsi
+	movq	%rbx, %rdi
+	addq	$344, %rbp
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L616
+	jmp	.L613
+.L617:
+	cmpq	$8, %rcx
+	jne	.L613
+	movl	$8, %edx
+	leaq	.LC33(%rip), %rsi
+	movq	%rbx, %rdi
+	addq	$296, %rbp
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L616
+	jmp	.L613
+	.p2align 4,,10
+	.p2align 3
+.L663:
+	cmpq	%rax, %rbx
+	je	.L503
+	cmpq	%r12, %rax
+	jb	.L604
+	jmp	.L601
+	.p2align 4,,10
+	.p2align 3
+.L606:
+	subq	$1, %r12
+	cmpq	%rax, %r12
+	je	.L605
+.L604:
+	movzbl	-1(%r12), %edx
+	cmpb	$32, %dl
+	je	.L606
+	cmpb	$9, %dl
+	je	.L606
+.L601:
+	cmpq	%rax, %r12
+	je	.L605
+	xorl	%eax, %eax
+	jmp	.L501
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	movl	$6, %edx
+	leaq	.LC2(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	xorl	%edx, %edx
+	testl	%eax, %eax
+	sete	%dl
+	cmpq	%r12, %rbx
+	jb	.L596
+	xorl	%eax, %eax
+	jmp	.L501
+	.p2align 4,,10
+	.p2align 3
+.L562:
+	movl	$4, %edx
+	leaq	.LC29(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movzbl	4(%rbp), %edx
+	movzbl	5(%rbp), %eax
+	cmpb	$78, %dl
+	je	.L566
+	cmpb	$80, %dl
+	je	.L567
+	cmpb	$75, %dl
+	je	.L860
+.L568:
+	xorl	%edx, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	xorl	%eax, %eax
+	jmp	.L501
+	.p2align 4,,10
+	.p2align 3
+.L521:
+	movzbl	1(%rbp), %eax
+	cmpb	$101, %al
+	je	.L524
+	jg	.L525
+	cmpb	$97, %al
+	je	.L526
+	cmpb	$100, %al
+	jne	.L509
+	movl	$3, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	movzbl	1(%rbp), %eax
+	cmpb	$114, %al
+	je	.L537
+	jg	.L538
+	cmpb	$99, %al
+	je	.L539
+	cmpb	$109, %al
+	jne	.L509
+	movl	$13, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L555:
+	movl	$5, %edx
+	leaq	.LC26(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	movl	$17, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L525:
+	cmpb	$115, %al
+	jne	.L509
+	movl	$4, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L538:
+	cmpb	$115, %al
+	jne	.L509
+	movl	$14, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L553:
+	movl	$5, %edx
+	leaq	.LC24(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	xorl	%edx, %edx
+	testl	%eax, %eax
+	sete	%dl
+	sall	$3, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	testl	%edx, %edx
+	je	.L503
+	movl	$8, %edx
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L547:
+	movl	$4, %edx
+	leaq	.LC21(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+	jmp	.L852
+.L545:
+	movl	$4, %edx
+	leaq	.LC23(%rip), %rsi
+	movq	%rbp, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L509
+.L571:
+	movl	$23, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L858:
+	movl	44(%r13), %eax
+	testl	%eax, %eax
+	je	.L608
+	movq	$0, 8(%r13)
+	xorl	%eax, %eax
+	jmp	.L501
+.L524:
+	movl	$5, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L526:
+	movl	$2, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L539:
+	movl	$15, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L537:
+	movl	$12, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L608:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdx
+	movq	%r12, %rdi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rax, %rbx
+	movl	$1, %eax
+	testq	%rbx, %rbx
+	je	.L501
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	wavefrontMTLAddMaterial@PLT
+	testl	%eax, %eax
+	jne	.L861
+	movl	8(%r12), %eax
+	subl	$1, %eax
+	jmp	.L607
+.L860:
+	subl	$97, %eax
+	cmpb	$18, %al
+	ja	.L568
+	leaq	.L570(%rip), %rdx
+	movzbl	%al, %eax
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L570:
+	.long	.L574-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L573-.L570
+	.long	.L572-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L571-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L568-.L570
+	.long	.L569-.L570
+	.text
+.L567:
+	cmpb	$114, %al
+	je	.L578
+	cmpb	$115, %al
+	je	.L579
+	cmpb	$109, %al
+	jne	.L568
+	movl	$27, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L566:
+	cmpb	$115, %al
+	jne	.L568
+	movl	$24, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.p2align 4,,10
+	.p2align 3
+.L859:
+	movl	$11, %edx
+	leaq	.LC34(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L613
+	addq	$312, %rbp
+	jmp	.L616
+.L595:
+	movq	8(%r13), %rbp
+	testq	%rbp, %rbp
+	je	.L503
+	movl	$11, %edx
+	jmp	.L611
+.L579:
+	movl	$28, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+.L578:
+	movl	$26, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+.L854:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	xorl	%eax, %eax
+	ret
+.L861:
+	.cfi_def_cfa_offset 176
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movl	%eax, 8(%rsp)
+	call	wavefrontMTLFreeString@PLT
+	movl	8(%rsp), %eax
+	jmp	.L501
+.L569:
+	movl	$21, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+.L572:
+	movl	$22, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+.L573:
+	movl	$20, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+.L574:
+	movl	$19, %edx
+	cmpq	%r12, %rbx
+	jb	.L596
+	jmp	.L544
+	.cfi_endproc
+.LFE33:
+	.size	parseLine, .-parseLine
+	.p2align 4
+	.type	parseLines, @function
+parseLines:
+.LFB41:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1080, %rsp
+	.cfi_def_cfa_offset 1136
+	movq	%rsi, 16(%rsp)
+	leaq	48(%rsp), %rbp
+	movq	%rsi, (%rsp)
+	movq	%rdx, 8(%rsp)
+	call	wavefrontScanKernel@PLT
+	pxor	%xmm0, %xmm0
+	movq	(%rsp), %r15
+	movl	%eax, 24(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	jmp	.L866
+	.p2align 4,,10
+	.p2align 3
+.L864:
+	addq	(%rsp), %rbx
+	movq	%rbx, (%rsp)
+	movq	%rbx, %r15
+	testq	%rax, %rax
+	jne	.L893
+.L866:
+	movq	8(%rsp), %rbx
+	cmpq	%r15, %rbx
+	je	.L863
+	movl	$65536, %eax
+	subq	%r15, %rbx
+	movl	24(%rsp), %edi
+	movq	%rbp, %rcx
+	cmpq	%rax, %rbx
+	movl	$256, %r8d
+	movq	%r15, %rsi
+	movq	%r15, 16(%rsp)
+	cmova	%rax, %rbx
+	movq	%rbx, %rdx
+	call	wavefrontFindLineEnds@PLT
+	movq	$0, 40(%rsp)
+	movq	%rax, 32(%rsp)
+	cmpq	$256, %rax
+	jne	.L864
+	movq	16(%rsp), %r15
+	movl	1068(%rsp), %eax
+	leaq	1(%r15,%rax), %rax
+	movq	%rax, (%rsp)
+.L865:
+	movq	$1, 40(%rsp)
+	movl	48(%rsp), %eax
+	addq	%rax, %r15
+.L863:
+	cmpq	%r14, %r15
+	jnb	.L862
+	leaq	48(%rsp), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L879:
+	movq	%r15, %rdx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	parseLine
+	movl	%eax, 40(%r13)
+	cmpl	$3, %eax
+	je	.L894
+.L868:
+	testl	%eax, %eax
+	jne	.L862
+	movq	40(%rsp), %rax
+	leaq	1(%r15), %r12
+	cmpq	%rax, 32(%rsp)
+	jne	.L874
+	movq	(%rsp), %r15
+	jmp	.L878
+	.p2align 4,,10
+	.p2align 3
+.L876:
+	addq	(%rsp), %rbx
+	movq	%rbx, (%rsp)
+	movq	%rbx, %r15
+	testq	%rax, %rax
+	jne	.L895
+.L878:
+	movq	8(%rsp), %rbx
+	cmpq	%r15, %rbx
+	je	.L875
+	movl	$65536, %eax
+	subq	%r15, %rbx
+	movl	24(%rsp), %edi
+	movq	%rbp, %rcx
+	cmpq	%rax, %rbx
+	movl	$256, %r8d
+	movq	%r15, %rsi
+	movq	%r15, 16(%rsp)
+	cmova	%rax, %rbx
+	movq	%rbx, %rdx
+	call	wavefrontFindLineEnds@PLT
+	movq	$0, 40(%rsp)
+	movq	%rax, 32(%rsp)
+	cmpq	$256, %rax
+	jne	.L876
+	movq	16(%rsp), %r15
+	movl	1068(%rsp), %eax
+	movl	$1, %edx
+	leaq	1(%r15,%rax), %rax
+	movq	%rax, (%rsp)
+	xorl	%eax, %eax
+.L877:
+	movl	48(%rsp,%rax,4), %eax
+	movq	%rdx, 40(%rsp)
+	addq	%rax, %r15
+.L875:
+	cmpq	%r14, %r15
+	jb	.L879
+.L862:
+	addq	$1080, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L894:
+	.cfi_restore_state
+	cmpq	$0, 72(%r13)
+	je	.L862
+	movq	96(%r13), %rdx
+	movq	%r12, %r8
+	subq	88(%r13), %r8
+	addq	112(%r13), %r8
+	cmpq	%r12, %rdx
+	jnb	.L881
+	movq	%r12, %rsi
+	movq	%rdx, %rax
+	subq	%rdx, %rsi
+	leaq	-1(%rsi), %rcx
+	cmpq	$14, %rcx
+	jbe	.L882
+	pxor	%xmm4, %xmm4
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	movq	%rsi, %rcx
+	andq	$-16, %rcx
+	pxor	%xmm3, %xmm3
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L872:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	.LC39(%rip), %xmm0
+	pand	.LC40(%rip), %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm2
+	movdqa	%xmm0, %xmm7
+	punpckhwd	%xmm5, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm5, %xmm2
+	punpcklwd	%xmm5, %xmm7
+	punpcklwd	%xmm5, %xmm1
+	movdqa	%xmm1, %xmm8
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm8
+	paddq	%xmm8, %xmm1
+	movdqa	%xmm2, %xmm8
+	punpckhdq	%xmm3, %xmm2
+	punpckldq	%xmm3, %xmm8
+	paddq	%xmm8, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm7, %xmm2
+	punpckhdq	%xmm3, %xmm7
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm2, %xmm7
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm7
+	paddq	%xmm7, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rax, %rcx
+	jne	.L872
+	movdqa	%xmm4, %xmm0
+	movq	%rsi, %rax
+	andq	$-16, %rax
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm4
+	addq	%rax, %rdx
+	andl	$15, %esi
+	movq	%xmm4, %rcx
+	je	.L873
+.L871:
+	xorl	%eax, %eax
+	cmpb	$10, (%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	1(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 1(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	2(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 2(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	3(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 3(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	4(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 4(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	5(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 5(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	6(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 6(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	7(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 7(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	8(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 8(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	9(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 9(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	10(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 10(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	11(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 11(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	12(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 12(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	13(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 13(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	14(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L873
+	xorl	%eax, %eax
+	cmpb	$10, 14(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L873:
+	movq	%r12, 96(%r13)
+.L870:
+	addq	104(%r13), %rcx
+	movq	%r15, %rdx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	movq	%rcx, 104(%r13)
+	addq	$1, %rcx
+	call	skipLine
+	movl	40(%r13), %eax
+	jmp	.L868
+.L874:
+	movq	16(%rsp), %r15
+	leaq	1(%rax), %rdx
+	jmp	.L877
+.L881:
+	xorl	%ecx, %ecx
+	jmp	.L870
+.L882:
+	xorl	%ecx, %ecx
+	jmp	.L871
+.L893:
+	movq	16(%rsp), %r15
+	jmp	.L865
+.L895:
+	movq	16(%rsp), %r15
+	movl	$1, %edx
+	xorl	%eax, %eax
+	jmp	.L877
+	.cfi_endproc
+.LFE41:
+	.size	parseLines, .-parseLines
+	.p2align 4
+	.type	parseAll.isra.0, @function
+parseAll.isra.0:
+.LFB74:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	call	parseLines
+	movl	40(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L896
+	movq	%rax, %r12
+	cmpq	%rbp, %rax
+	jb	.L915
+.L896:
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L915:
+	.cfi_restore_state
+	movq	%rbp, %rdx
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	call	parseLine
+	movl	%eax, 40(%rbx)
+	cmpl	$3, %eax
+	jne	.L896
+	cmpq	$0, 72(%rbx)
+	je	.L896
+	movq	96(%rbx), %rdx
+	movq	%r12, %r8
+	subq	88(%rbx), %r8
+	addq	112(%rbx), %r8
+	cmpq	%r12, %rdx
+	jnb	.L905
+	movq	%r12, %rsi
+	movq	%rdx, %rax
+	subq	%rdx, %rsi
+	leaq	-1(%rsi), %rcx
+	cmpq	$14, %rcx
+	jbe	.L906
+	pxor	%xmm3, %xmm3
+	pxor	%xmm5, %xmm5
+	pxor	%xmm4, %xmm4
+	movq	%rsi, %rcx
+	andq	$-16, %rcx
+	movdqa	.LC39(%rip), %xmm7
+	movdqa	.LC40(%rip), %xmm6
+	pxor	%xmm2, %xmm2
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L903:
+	movdqu	(%rax), %xmm1
+	addq	$16, %rax
+	pcmpeqb	%xmm7, %xmm1
+	pand	%xmm6, %xmm1
+	movdqa	%xmm1, %xmm0
+	punpckhbw	%xmm5, %xmm1
+	punpcklbw	%xmm5, %xmm0
+	movdqa	%xmm1, %xmm8
+	punpckhwd	%xmm4, %xmm1
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm4, %xmm0
+	punpcklwd	%xmm4, %xmm8
+	movdqa	%xmm0, %xmm10
+	punpcklwd	%xmm4, %xmm9
+	punpckhdq	%xmm2, %xmm0
+	punpckldq	%xmm2, %xmm10
+	paddq	%xmm10, %xmm0
+	movdqa	%xmm9, %xmm10
+	punpckhdq	%xmm2, %xmm9
+	punpckldq	%xmm2, %xmm10
+	paddq	%xmm10, %xmm9
+	paddq	%xmm9, %xmm0
+	movdqa	%xmm8, %xmm9
+	punpckhdq	%xmm2, %xmm8
+	punpckldq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm8
+	movdqa	%xmm1, %xmm9
+	punpckhdq	%xmm2, %xmm1
+	punpckldq	%xmm2, %xmm9
+	paddq	%xmm3, %xmm1
+	paddq	%xmm9, %xmm8
+	paddq	%xmm8, %xmm0
+	movdqa	%xmm0, %xmm3
+	paddq	%xmm1, %xmm3
+	cmpq	%rax, %rcx
+	jne	.L903
+	movdqa	%xmm3, %xmm0
+	movq	%rsi, %rax
+	andq	$-16, %rax
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm3
+	addq	%rax, %rdx
+	andl	$15, %esi
+	movq	%xmm3, %rcx
+	je	.L904
+.L902:
+	xorl	%eax, %eax
+	cmpb	$10, (%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	1(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 1(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	2(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 2(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	3(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 3(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	4(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 4(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	5(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 5(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	6(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 6(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	7(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 7(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	8(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 8(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	9(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 9(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	10(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 10(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	11(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 11(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	12(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 12(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	13(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 13(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	leaq	14(%rdx), %rax
+	cmpq	%r12, %rax
+	jnb	.L904
+	xorl	%eax, %eax
+	cmpb	$10, 14(%rdx)
+	sete	%al
+	addq	%rax, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L904:
+	movq	%r12, 96(%rbx)
+.L901:
+	addq	104(%rbx), %rcx
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movq	%rcx, 104(%rbx)
+	addq	$1, %rcx
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	skipLine
+.L905:
+	.cfi_restore_state
+	xorl	%ecx, %ecx
+	jmp	.L901
+.L906:
+	xorl	%ecx, %ecx
+	jmp	.L902
+	.cfi_endproc
+.LFE74:
+	.size	parseAll.isra.0, .-parseAll.isra.0
+	.p2align 4
+	.type	parseParallel.isra.0, @function
+parseParallel.isra.0:
+.LFB75:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%ecx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	salq	$2, %r12
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	movq	%rdx, (%rsp)
+	subq	%rsi, %rdx
+	movq	%rdx, %rax
+	movl	%ecx, 32(%rsp)
+	shrq	$16, %rax
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+	cmpq	$1, %r12
+	jbe	.L991
+	movq	64(%rdi), %rdi
+	pxor	%xmm0, %xmm0
+	movq	%rsi, 8(%rsp)
+	movq	%rdx, %r14
+	movq	%r12, %rsi
+	movl	$280, %edx
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm0, 96(%rsp)
+	movaps	%xmm0, 112(%rsp)
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	8(%rsp), %r8
+	testq	%rax, %rax
+	movq	%rax, 80(%rsp)
+	movq	%rax, %rsi
+	je	.L990
+	movq	0(%rbp), %rax
+	movdqu	64(%rbp), %xmm1
+	movdqu	48(%rbp), %xmm0
+	movl	92(%rax), %eax
+	punpcklqdq	%xmm1, %xmm0
+	movl	%eax, 92(%rsp)
+	movq	72(%rbp), %rax
+	movups	%xmm0, 104(%rsp)
+	movq	%rax, 8(%rsp)
+	movq	%rax, 120(%rsp)
+	testq	%rax, %rax
+	je	.L956
+	movq	$0, 8(%rsp)
+	movl	8(%rax), %r9d
+	xorl	%ebx, %ebx
+	testl	%r9d, %r9d
+	jne	.L992
+.L920:
+	movq	%r14, %rax
+	xorl	%edx, %edx
+	leaq	(%rbx,%rbx,4), %r14
+	xorl	%r13d, %r13d
+	divq	%r12
+	movq	%rbp, 40(%rsp)
+	movq	8(%rsp), %r15
+	movq	%rsi, %rdx
+	movq	%rax, %rcx
+	leaq	0(,%r14,8), %rax
+	movq	%r13, %r14
+	leaq	(%r8,%rcx), %rbx
+	movq	%rax, 16(%rsp)
+	movq	%rbx, %rbp
+	movq	%rcx, 24(%rsp)
+	movl	%r9d, %ebx
+	jmp	.L925
+	.p2align 4,,10
+	.p2align 3
+.L993:
+	cmpq	%rbp, %r8
+	movq	%r8, %rdi
+	movq	(%rsp), %rsi
+	cmovb	%rbp, %rdi
+	call	nextMaterialLine
+	leaq	16(%r13), %rdi
+	movq	%rax, 8(%r13)
+	call	wavefrontMTLCompose@PLT
+	cmpq	$0, 8(%rsp)
+	je	.L955
+	movq	16(%rsp), %rax
+	movq	8(%r13), %r8
+	movq	%r15, 248(%r13)
+	movl	%ebx, 256(%r13)
+	addq	%rax, %r15
+	movq	24(%rsp), %rax
+	addq	%rax, %rbp
+.L953:
+	movq	80(%rsp), %rdx
+.L925:
+	imulq	$280, %r14, %rax
+	addq	$1, %r14
+	leaq	(%rdx,%rax), %r13
+	movq	%r8, 0(%r13)
+	cmpq	%r14, %r12
+	jne	.L993
+	movq	(%rsp), %rax
+	leaq	16(%r13), %rdi
+	movq	%rax, 8(%r13)
+	call	wavefrontMTLCompose@PLT
+	cmpq	$0, 8(%rsp)
+	jne	.L994
+.L955:
+	movq	16(%rsp), %rax
+	movq	8(%r13), %r8
+	movl	%ebx, 256(%r13)
+	movq	$0, 248(%r13)
+	addq	%rax, %r15
+	movq	24(%rsp), %rax
+	addq	%rax, %rbp
+	cmpq	%r14, %r12
+	jne	.L953
+	movq	40(%rsp), %rbp
+	jmp	.L924
+	.p2align 4,,10
+	.p2align 3
+.L994:
+	movq	%r15, 248(%r13)
+	movq	40(%rsp), %rbp
+	movl	%ebx, 256(%r13)
+.L924:
+	movq	64(%rbp), %r8
+	movl	32(%rsp), %ecx
+	movl	%r12d, %edx
+	leaq	80(%rsp), %rsi
+	leaq	parsePiece(%rip), %rdi
+	xorl	%r14d, %r14d
+	call	wavefrontRunParallel@PLT
+	imulq	$280, %r12, %rax
+	leaq	48(%rsp), %r12
+	movq	%rax, 16(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L952:
+	movq	80(%rsp), %rbx
+	movl	40(%rbp), %r13d
+	addq	%r14, %rbx
+	leaq	16(%rbx), %rax
+	movq	%rax, (%rsp)
+	testl	%r13d, %r13d
+	jne	.L927
+	movl	272(%rbx), %eax
+	movl	%eax, 40(%rbp)
+	testl	%eax, %eax
+	jne	.L927
+	movq	72(%rbp), %rdi
+	testq	%rdi, %rdi
+	je	.L929
+	movq	264(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L929
+	movq	(%rbx), %r9
+	movq	96(%rbp), %rdx
+	cmpq	%r9, %rdx
+	jnb	.L958
+	movq	%r9, %r8
+	movq	%rdx, %rax
+	subq	%rdx, %r8
+	leaq	-1(%r8), %rcx
+	cmpq	$14, %rcx
+	jbe	.L959
+	pxor	%xmm2, %xmm2
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	movq	%r8, %rcx
+	andq	$-16, %rcx
+	pxor	%xmm4, %xmm4
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L932:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	.LC39(%rip), %xmm0
+	pand	.LC40(%rip), %xmm0
+	movdqa	%xmm0, %xmm1
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm1
+	movdqa	%xmm0, %xmm3
+	punpckhwd	%xmm5, %xmm0
+	movdqa	%xmm1, %xmm7
+	punpckhwd	%xmm5, %xmm1
+	punpcklwd	%xmm5, %xmm3
+	movdqa	%xmm1, %xmm8
+	punpcklwd	%xmm5, %xmm7
+	punpckldq	%xmm4, %xmm1
+	punpckhdq	%xmm4, %xmm8
+	paddq	%xmm8, %xmm1
+	movdqa	%xmm7, %xmm8
+	punpckldq	%xmm4, %xmm7
+	punpckhdq	%xmm4, %xmm8
+	paddq	%xmm8, %xmm7
+	paddq	%xmm7, %xmm1
+	movdqa	%xmm3, %xmm7
+	punpckldq	%xmm4, %xmm3
+	punpckhdq	%xmm4, %xmm7
+	paddq	%xmm7, %xmm3
+	movdqa	%xmm0, %xmm7
+	punpckhdq	%xmm4, %xmm0
+	punpckldq	%xmm4, %xmm7
+	paddq	%xmm0, %xmm2
+	paddq	%xmm7, %xmm3
+	paddq	%xmm3, %xmm1
+	paddq	%xmm1, %xmm2
+	cmpq	%rax, %rcx
+	jne	.L932
+	movdqa	%xmm2, %xmm0
+	movq	%r8, %rcx
+	andq	$-16, %rcx
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm2
+	addq	%rcx, %rdx
+	andl	$15, %r8d
+	movq	%xmm2, %rax
+	je	.L933
+.L931:
+	xorl	%ecx, %ecx
+	cmpb	$10, (%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 1(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 2(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 3(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 4(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 5(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 6(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 7(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 8(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 9(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 10(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 11(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 12(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	xorl	%ecx, %ecx
+	cmpb	$10, 13(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%r9, %rcx
+	jnb	.L933
+	cmpb	$10, 14(%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L933:
+	movq	%r9, 96(%rbp)
+.L930:
+	movl	260(%rbx), %r11d
+	addq	104(%rbp), %rax
+	movq	%rax, 104(%rbp)
+	movq	%rax, %xmm1
+	testl	%r11d, %r11d
+	je	.L936
+	movl	12(%rdi), %eax
+	movl	8(%rdi), %r11d
+	xorl	%edx, %edx
+	xorl	%r8d, %r8d
+	leaq	(%rax,%rax,4), %r10
+	movq	%rax, %rcx
+	salq	$3, %r10
+	jmp	.L935
+	.p2align 4,,10
+	.p2align 3
+.L937:
+	leaq	(%r10,%rdx), %rax
+	addl	$1, %ecx
+	addq	(%rdi), %rax
+	addl	$1, %r8d
+	movq	248(%rbx), %r13
+	movl	%ecx, 12(%rdi)
+	movdqa	%xmm1, %xmm0
+	movdqu	0(%r13,%rdx), %xmm6
+	movups	%xmm6, (%rax)
+	movdqu	16(%r13,%rdx), %xmm5
+	movdqu	(%rax), %xmm6
+	movups	%xmm5, 16(%rax)
+	movq	32(%r13,%rdx), %r13
+	addq	$40, %rdx
+	movq	%r13, 32(%rax)
+	movq	%r9, %r13
+	subq	88(%rbp), %r13
+	movq	%r13, %xmm2
+	punpcklqdq	%xmm2, %xmm0
+	paddq	%xmm6, %xmm0
+	movups	%xmm0, (%rax)
+	cmpl	260(%rbx), %r8d
+	jnb	.L936
+.L935:
+	cmpl	%r11d, %ecx
+	jb	.L937
+.L936:
+	addq	%rsi, 16(%rdi)
+.L929:
+	movq	0(%rbp), %r13
+	movl	8(%r13), %r10d
+	testl	%r10d, %r10d
+	jne	.L938
+	movl	40(%r13), %r9d
+	testl	%r9d, %r9d
+	jne	.L938
+	movl	72(%r13), %esi
+	testl	%esi, %esi
+	je	.L942
+	.p2align 4,,10
+	.p2align 3
+.L938:
+	movl	56(%rbx), %r8d
+	xorl	%r15d, %r15d
+	testl	%r8d, %r8d
+	je	.L946
+	movq	%r14, 24(%rsp)
+	jmp	.L940
+	.p2align 4,,10
+	.p2align 3
+.L996:
+	addl	$1, %r15d
+	cmpl	56(%rbx), %r15d
+	jnb	.L995
+.L940:
+	movq	48(%rbx), %rdx
+	movl	%r15d, %eax
+	movq	(%rdx,%rax,8), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	%r12, %rcx
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	movq	%rax, %rdx
+	call	wavefrontMTLInternTexture@PLT
+	movl	%eax, 40(%rbp)
+	testl	%eax, %eax
+	je	.L996
+	movq	24(%rsp), %r14
+	.p2align 4,,10
+	.p2align 3
+.L927:
+	movq	(%rsp), %rdi
+	addq	$280, %r14
+	call	wavefrontMTLRelease@PLT
+	cmpq	%r14, 16(%rsp)
+	jne	.L952
+	movq	64(%rbp), %rdi
+	movq	80(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	64(%rbp), %rdi
+	movq	8(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+.L916:
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L995:
+	.cfi_restore_state
+	movq	24(%rsp), %r14
+.L946:
+	movl	88(%rbx), %edi
+	xorl	%r15d, %r15d
+	testl	%edi, %edi
+	je	.L942
+	.p2align 4,,10
+	.p2align 3
+.L941:
+	movl	%r15d, %esi
+	movq	%r12, %rdx
+	movq	%r13, %rdi
+	salq	$6, %rsi
+	addq	80(%rbx), %rsi
+	call	wavefrontMTLInternMapOptions@PLT
+	movl	%eax, 40(%rbp)
+	testl	%eax, %eax
+	jne	.L927
+	addl	$1, %r15d
+	cmpl	88(%rbx), %r15d
+	jb	.L941
+.L942:
+	movl	24(%rbx), %ecx
+	xorl	%edx, %edx
+	movl	%edx, %r15d
+	testl	%ecx, %ecx
+	je	.L944
+.L943:
+	movl	%r15d, %eax
+	movq	%r13, %rdi
+	imulq	$456, %rax, %rax
+	addq	16(%rbx), %rax
+	movq	(%rax), %rsi
+	call	wavefrontMTLFindMaterial@PLT
+	testl	%eax, %eax
+	js	.L997
+	movq	72(%rbp), %rcx
+	movl	$0, %edx
+	movq	48(%rbp), %r8
+	movq	%rbp, %rdi
+	leaq	48(%rsp), %rax
+	movq	(%rbx), %rsi
+	pxor	%xmm0, %xmm0
+	movq	$0, 48(%rbp)
+	testq	%rcx, %rcx
+	movq	$0, 8(%rbp)
+	cmove	%rdx, %rax
+	movl	$1, 44(%rbp)
+	movq	8(%rbx), %rdx
+	movq	%r8, 32(%rsp)
+	movq	%rax, 72(%rbp)
+	movq	%rcx, 24(%rsp)
+	movq	$0, 64(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	call	parseAll.isra.0
+	movq	32(%rsp), %r8
+	movl	40(%rbp), %eax
+	movl	$0, 44(%rbp)
+	movq	24(%rsp), %rcx
+	movq	%r8, 48(%rbp)
+	movq	%rcx, 72(%rbp)
+	testl	%eax, %eax
+	jne	.L927
+.L944:
+	movq	(%rsp), %rsi
+	movq	%r13, %rdi
+	call	wavefrontMTLAppend@PLT
+	movl	%eax, 40(%rbp)
+	jmp	.L927
+	.p2align 4,,10
+	.p2align 3
+.L991:
+	movq	(%rsp), %rdx
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	jmp	parseAll.isra.0
+	.p2align 4,,10
+	.p2align 3
+.L956:
+	.cfi_restore_state
+	xorl	%ebx, %ebx
+	xorl	%r9d, %r9d
+	jmp	.L920
+	.p2align 4,,10
+	.p2align 3
+.L997:
+	addl	$1, %r15d
+	cmpl	24(%rbx), %r15d
+	jb	.L943
+	jmp	.L944
+.L921:
+	movq	64(%rbp), %rdi
+	movq	80(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	.p2align 4,,10
+	.p2align 3
+.L990:
+	movl	$1, 40(%rbp)
+	jmp	.L916
+	.p2align 4,,10
+	.p2align 3
+.L992:
+	movl	%r9d, %ebx
+	movq	%r12, %rax
+	movq	%xmm1, %rdi
+	movq	%r8, 24(%rsp)
+	imulq	%rbx, %rax
+	movl	%r9d, 16(%rsp)
+	leaq	(%rax,%rax,4), %rsi
+	salq	$3, %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, 8(%rsp)
+	testq	%rax, %rax
+	je	.L921
+	movq	80(%rsp), %rsi
+	movl	16(%rsp), %r9d
+	movq	24(%rsp), %r8
+	jmp	.L920
+.L958:
+	xorl	%eax, %eax
+	jmp	.L930
+.L959:
+	xorl	%eax, %eax
+	jmp	.L931
+	.cfi_endproc
+.LFE75:
+	.size	parseParallel.isra.0, .-parseParallel.isra.0
+	.p2align 4
+	.type	parsePiece, @function
+parsePiece:
+.LFB51:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	%esi, %ebx
+	imulq	$280, %rbx, %rbx
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 208
+	movq	24(%rdi), %rcx
+	addq	(%rdi), %rbx
+	movq	40(%rdi), %rax
+	leaq	128(%rbx), %rdx
+	movq	(%rbx), %rbp
+	testq	%rcx, %rcx
+	cmovne	%rdx, %rcx
+	leaq	248(%rbx), %rdx
+	testq	%rax, %rax
+	cmovne	%rdx, %rax
+	testq	%rbp, %rbp
+	je	.L1009
+	movq	8(%rbx), %rsi
+	movq	32(%rdi), %rdx
+	pxor	%xmm0, %xmm0
+	leaq	16(%rbx), %r15
+	movq	%r15, 16(%rsp)
+	movl	8(%rdi), %r12d
+	movq	%rsi, 8(%rsp)
+	movl	12(%rdi), %r13d
+	movq	$0, 24(%rsp)
+	movl	16(%rdi), %r14d
+	movq	$0, 32(%rsp)
+	movq	$0, 56(%rsp)
+	movq	%rcx, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movq	%rdx, 80(%rsp)
+	movq	%rax, 88(%rsp)
+	movl	$0, 96(%rsp)
+	movups	%xmm0, 40(%rsp)
+	movups	%xmm0, 104(%rsp)
+	movups	%xmm0, 120(%rsp)
+	testq	%rcx, %rcx
+	je	.L1002
+	movl	$120, %edx
+	xorl	%esi, %esi
+	movq	%rcx, %rdi
+	call	memset@PLT
+	movq	88(%rsp), %rax
+.L1002:
+	testq	%rax, %rax
+	je	.L1003
+	movq	$0, 16(%rax)
+	movl	$0, 12(%rax)
+.L1003:
+	movq	%r15, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	80(%rsp), %rax
+	movl	%r13d, 108(%rbx)
+	movq	%rax, 120(%rbx)
+	testl	%r12d, %r12d
+	jne	.L1028
+.L1004:
+	movl	56(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1005
+	movq	%rbp, %xmm0
+	leaq	16(%rsp), %rdi
+	punpcklqdq	%xmm0, %xmm0
+	movups	%xmm0, 104(%rsp)
+	cmpl	$1, %r14d
+	ja	.L1029
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rsi
+	call	parseAll.isra.0
+.L1007:
+	movl	56(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1005
+.L1001:
+	movl	%eax, 272(%rbx)
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1028:
+	.cfi_restore_state
+	movl	%r12d, %esi
+	movq	%r15, %rdi
+	call	wavefrontMTLReserve@PLT
+	testl	%eax, %eax
+	je	.L1004
+	movl	$1, 56(%rsp)
+.L1005:
+	movq	32(%rsp), %rsi
+	movq	80(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	16(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 32(%rsp)
+	movups	%xmm0, 40(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	56(%rsp), %eax
+	jmp	.L1001
+	.p2align 4,,10
+	.p2align 3
+.L1009:
+	movl	$2, %eax
+	jmp	.L1001
+	.p2align 4,,10
+	.p2align 3
+.L1029:
+	movq	8(%rsp), %rdx
+	movl	%r14d, %ecx
+	movq	%rbp, %rsi
+	call	parseParallel.isra.0
+	jmp	.L1007
+	.cfi_endproc
+.LFE51:
+	.size	parsePiece, .-parsePiece
+	.p2align 4
+	.type	parserFeed, @function
+parserFeed:
+.LFB44:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1128, %rsp
+	.cfi_def_cfa_offset 1184
+	movl	40(%rdi), %r12d
+	testl	%r12d, %r12d
+	jne	.L1030
+	movq	%rsi, %rbx
+	testq	%rsi, %rsi
+	je	.L1054
+	movq	24(%rdi), %rax
+	movq	%rsi, %xmm0
+	movq	%rdi, %r15
+	movq	%rdx, %r13
+	punpcklqdq	%xmm0, %xmm0
+	leaq	(%rsi,%rdx), %rbp
+	movq	%rax, 16(%rsp)
+	movups	%xmm0, 88(%rdi)
+	testq	%rax, %rax
+	jne	.L1075
+.L1032:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdx
+	movq	%r15, %rdi
+	call	parseLines
+	movl	40(%r15), %r12d
+	movq	%rax, %rbx
+	testl	%r12d, %r12d
+	jne	.L1073
+	movq	%rbp, %r14
+	subq	%rax, %r14
+	cmpq	%r14, 32(%r15)
+	jb	.L1076
+	testq	%r14, %r14
+	jne	.L1077
+.L1048:
+	cmpq	$0, 72(%r15)
+	movq	%r14, 24(%r15)
+	je	.L1049
+	movq	96(%r15), %rdx
+	cmpq	%rbp, %rdx
+	jnb	.L1055
+	movq	%rbp, %rsi
+	movq	%rdx, %rax
+	subq	%rdx, %rsi
+	leaq	-1(%rsi), %rcx
+	cmpq	$14, %rcx
+	jbe	.L1056
+	pxor	%xmm4, %xmm4
+	pxor	%xmm6, %xmm6
+	pxor	%xmm5, %xmm5
+	movq	%rsi, %rcx
+	andq	$-16, %rcx
+	movdqa	.LC40(%rip), %xmm7
+	pxor	%xmm3, %xmm3
+	movdqa	.LC39(%rip), %xmm8
+	addq	%rdx, %rcx
+	.p2align 4,,10
+	.p2align 3
+.L1052:
+	movdqu	(%rax), %xmm0
+	addq	$16, %rax
+	pcmpeqb	%xmm8, %xmm0
+	pand	%xmm7, %xmm0
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm6, %xmm0
+	punpcklbw	%xmm6, %xmm2
+	movdqa	%xmm0, %xmm9
+	punpckhwd	%xmm5, %xmm0
+	movdqa	%xmm2, %xmm1
+	punpckhwd	%xmm5, %xmm2
+	punpcklwd	%xmm5, %xmm9
+	punpcklwd	%xmm5, %xmm1
+	movdqa	%xmm1, %xmm10
+	punpckhdq	%xmm3, %xmm1
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm1
+	movdqa	%xmm2, %xmm10
+	punpckhdq	%xmm3, %xmm2
+	punpckldq	%xmm3, %xmm10
+	paddq	%xmm10, %xmm2
+	paddq	%xmm2, %xmm1
+	movdqa	%xmm9, %xmm2
+	punpckhdq	%xmm3, %xmm9
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm2, %xmm9
+	movdqa	%xmm0, %xmm2
+	punpckhdq	%xmm3, %xmm0
+	punpckldq	%xmm3, %xmm2
+	paddq	%xmm4, %xmm0
+	paddq	%xmm2, %xmm9
+	paddq	%xmm9, %xmm1
+	movdqa	%xmm1, %xmm4
+	paddq	%xmm0, %xmm4
+	cmpq	%rax, %rcx
+	jne	.L1052
+	movdqa	%xmm4, %xmm0
+	movq	%rsi, %rcx
+	andq	$-16, %rcx
+	psrldq	$8, %xmm0
+	paddq	%xmm0, %xmm4
+	addq	%rcx, %rdx
+	andl	$15, %esi
+	movq	%xmm4, %rax
+	je	.L1053
+.L1051:
+	xorl	%ecx, %ecx
+	cmpb	$10, (%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	1(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 1(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	2(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 2(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	3(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 3(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	4(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 4(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	5(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 5(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	6(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 6(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	7(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 7(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	8(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 8(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	9(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 9(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	10(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 10(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	11(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 11(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	12(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 12(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	13(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	xorl	%ecx, %ecx
+	cmpb	$10, 13(%rdx)
+	sete	%cl
+	addq	%rcx, %rax
+	leaq	14(%rdx), %rcx
+	cmpq	%rbp, %rcx
+	jnb	.L1053
+	cmpb	$10, 14(%rdx)
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+	.p2align 4,,10
+	.p2align 3
+.L1053:
+	movq	%rbp, 96(%r15)
+.L1050:
+	addq	%rax, 104(%r15)
+.L1049:
+	addq	%r13, 112(%r15)
+.L1030:
+	addq	$1128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r12d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1075:
+	.cfi_restore_state
+	movq	112(%rdi), %rax
+	movq	%rsi, 64(%rsp)
+	movq	%rsi, 48(%rsp)
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	movq	%rbp, 56(%rsp)
+	call	wavefrontScanKernel@PLT
+	pxor	%xmm0, %xmm0
+	movq	48(%rsp), %r9
+	movl	%eax, 72(%rsp)
+	leaq	96(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	jmp	.L1036
+	.p2align 4,,10
+	.p2align 3
+.L1034:
+	addq	48(%rsp), %r14
+	movq	%r14, 48(%rsp)
+	movq	%r14, %r9
+	testq	%rax, %rax
+	jne	.L1078
+.L1036:
+	movq	56(%rsp), %rdx
+	cmpq	%r9, %rdx
+	je	.L1033
+	subq	%r9, %rdx
+	movl	$65536, %eax
+	movq	8(%rsp), %rcx
+	movq	%r9, %rsi
+	cmpq	%rax, %rdx
+	movq	%rdx, %r14
+	movl	72(%rsp), %edi
+	movl	$256, %r8d
+	cmova	%rax, %r14
+	movq	%r9, 64(%rsp)
+	movq	%r14, %rdx
+	call	wavefrontFindLineEnds@PLT
+	movq	$0, 88(%rsp)
+	movq	%rax, 80(%rsp)
+	cmpq	$256, %rax
+	jne	.L1034
+	movq	64(%rsp), %r9
+	movl	1116(%rsp), %eax
+	leaq	1(%r9,%rax), %rax
+	movq	%rax, 48(%rsp)
+.L1035:
+	movq	$1, 88(%rsp)
+	movl	96(%rsp), %eax
+	addq	%rax, %r9
+.L1033:
+	movq	24(%r15), %rdx
+	movq	%r9, %rcx
+	movq	32(%r15), %rax
+	subq	%rbx, %rcx
+	movq	16(%r15), %rsi
+	leaq	(%rdx,%rcx), %r14
+	cmpq	%r14, %rax
+	jnb	.L1037
+	addq	%rax, %rax
+	movq	64(%r15), %rdi
+	movq	%r9, 40(%rsp)
+	cmpq	%r14, %rax
+	movq	%rcx, 32(%rsp)
+	cmovb	%r14, %rax
+	movq	%rax, %rdx
+	movq	%rax, 8(%rsp)
+	call	wavefrontReallocateWith@PLT
+	movq	8(%rsp), %rdx
+	movq	32(%rsp), %rcx
+	testq	%rax, %rax
+	movq	40(%rsp), %r9
+	movq	%rax, %rsi
+	je	.L1072
+	movq	%rax, 16(%r15)
+	movq	%rdx, 32(%r15)
+	movq	24(%r15), %rdx
+.L1037:
+	leaq	(%rsi,%rdx), %rdi
+	movq	%rcx, %rdx
+	movq	%rbx, %rsi
+	movq	%r9, 8(%rsp)
+	call	memcpy@PLT
+	movq	8(%rsp), %r9
+	movq	%r14, 24(%r15)
+	cmpq	%r9, %rbp
+	je	.L1049
+	movq	16(%r15), %rsi
+	movq	%r15, %rdi
+	movq	%r9, 8(%rsp)
+	leaq	(%rsi,%r14), %rdx
+	call	parseLine
+	movq	8(%rsp), %r9
+	cmpl	$3, %eax
+	movl	%eax, 40(%r15)
+	je	.L1079
+.L1041:
+	testl	%eax, %eax
+	jne	.L1073
+	movq	$0, 24(%r15)
+	leaq	1(%r9), %rbx
+	jmp	.L1032
+.L1072:
+	movl	$1, 40(%r15)
+	.p2align 4,,10
+	.p2align 3
+.L1073:
+	movq	16(%r15), %rsi
+.L1074:
+	movq	64(%r15), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	$0, 16(%r15)
+	pxor	%xmm0, %xmm0
+	movq	(%r15), %rdi
+	movups	%xmm0, 24(%r15)
+	call	wavefrontMTLRelease@PLT
+	movl	40(%r15), %r12d
+	jmp	.L1030
+	.p2align 4,,10
+	.p2align 3
+.L1076:
+	movq	64(%r15), %rdi
+	movq	16(%r15), %rsi
+	movq	%r14, %rdx
+	call	wavefrontReallocateWith@PLT
+	movq	%rax, %rdi
+	testq	%rax, %rax
+	je	.L1072
+	movq	%rax, 16(%r15)
+	movq	%r14, 32(%r15)
+.L1047:
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	call	memcpy@PLT
+	jmp	.L1048
+	.p2align 4,,10
+	.p2align 3
+.L1054:
+	movl	$2, %r12d
+	jmp	.L1030
+	.p2align 4,,10
+	.p2align 3
+.L1079:
+	cmpq	$0, 72(%r15)
+	movq	16(%r15), %rsi
+	je	.L1074
+	movq	104(%r15), %rax
+	movq	24(%rsp), %r8
+	leaq	(%rsi,%r14), %rdx
+	movq	%r15, %rdi
+	movq	%r9, 8(%rsp)
+	leaq	1(%rax), %rcx
+	movq	16(%rsp), %rax
+	subq	%rax, %r8
+	call	skipLine
+	movl	40(%r15), %eax
+	movq	8(%rsp), %r9
+	jmp	.L1041
+.L1056:
+	xorl	%eax, %eax
+	jmp	.L1051
+.L1055:
+	xorl	%eax, %eax
+	jmp	.L1050
+.L1077:
+	movq	16(%r15), %rdi
+	jmp	.L1047
+.L1078:
+	movq	64(%rsp), %r9
+	jmp	.L1035
+	.cfi_endproc
+.LFE44:
+	.size	parserFeed, .-parserFeed
+	.p2align 4
+	.type	parseBatchItem, @function
+parseBatchItem:
+.LFB59:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	%esi, %esi
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	salq	$4, %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 176
+	addq	16(%rdi), %rsi
+	movl	8(%rsi), %eax
+	leaq	(%rax,%rax,8), %rbx
+	salq	$4, %rbx
+	addq	(%rdi), %rbx
+	movl	136(%rbx), %edx
+	testl	%edx, %edx
+	jne	.L1080
+	cmpq	$0, (%rbx)
+	movq	8(%rbx), %r12
+	movq	%rdi, %rbp
+	movq	16(%rbx), %r13
+	je	.L1082
+	leaq	(%rax,%rax,2), %rdx
+	movq	8(%rdi), %rax
+	leaq	(%rax,%rdx,8), %rax
+	movq	(%rax), %r12
+	movq	8(%rax), %r13
+.L1082:
+	leaq	24(%rbx), %r14
+	testq	%r12, %r12
+	je	.L1092
+	movq	48(%rbp), %rax
+	movq	40(%rbp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	%r14, (%rsp)
+	movq	$0, 8(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	56(%rbp), %rax
+	movq	$0, 16(%rsp)
+	movq	$0, 40(%rsp)
+	movq	%rdi, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	%rax, 72(%rsp)
+	movl	$0, 80(%rsp)
+	movups	%xmm0, 24(%rsp)
+	movups	%xmm0, 88(%rsp)
+	movups	%xmm0, 104(%rsp)
+	testq	%rdi, %rdi
+	je	.L1084
+	movl	$120, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	movq	72(%rsp), %rax
+.L1084:
+	testq	%rax, %rax
+	je	.L1085
+	movq	$0, 16(%rax)
+	movq	%r14, %rdi
+	movl	$0, 12(%rax)
+	call	wavefrontMTLCompose@PLT
+.L1086:
+	movl	28(%rbp), %eax
+	movl	24(%rbp), %esi
+	movl	%eax, 116(%rbx)
+	movq	64(%rsp), %rax
+	movq	%rax, 128(%rbx)
+	testl	%esi, %esi
+	jne	.L1103
+.L1087:
+	movl	40(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1088
+	movq	%r12, %xmm0
+	movl	32(%rbp), %ecx
+	leaq	(%r12,%r13), %rdx
+	movq	%rsp, %rdi
+	punpcklqdq	%xmm0, %xmm0
+	movq	%r12, %rsi
+	movups	%xmm0, 88(%rsp)
+	cmpl	$1, %ecx
+	ja	.L1104
+	call	parseAll.isra.0
+.L1090:
+	movl	40(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1088
+.L1083:
+	movl	%eax, 136(%rbx)
+.L1080:
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1085:
+	.cfi_restore_state
+	movq	%r14, %rdi
+	call	wavefrontMTLCompose@PLT
+	jmp	.L1086
+	.p2align 4,,10
+	.p2align 3
+.L1104:
+	call	parseParallel.isra.0
+	jmp	.L1090
+	.p2align 4,,10
+	.p2align 3
+.L1103:
+	movq	%r14, %rdi
+	call	wavefrontMTLReserve@PLT
+	testl	%eax, %eax
+	je	.L1087
+	movl	$1, 40(%rsp)
+.L1088:
+	movq	16(%rsp), %rsi
+	movq	64(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 16(%rsp)
+	movups	%xmm0, 24(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	40(%rsp), %eax
+	jmp	.L1083
+	.p2align 4,,10
+	.p2align 3
+.L1092:
+	movl	$2, %eax
+	jmp	.L1083
+	.cfi_endproc
+.LFE59:
+	.size	parseBatchItem, .-parseBatchItem
+	.p2align 4
+	.globl	wavefrontMTLParserCompose
+	.type	wavefrontMTLParserCompose, @function
+wavefrontMTLParserCompose:
+.LFB43:
+	.cfi_startproc
+	pxor	%xmm0, %xmm0
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	movq	%rsi, (%rdi)
+	movq	$0, 8(%rdi)
+	movq	$0, 16(%rdi)
+	movq	$0, 40(%rdi)
+	movups	%xmm0, 24(%rdi)
+	testq	%rdx, %rdx
+	je	.L1134
+	movq	24(%rdx), %rax
+	movq	16(%rdx), %rdi
+	movq	%rdx, %rbp
+	movq	$0, 56(%rbx)
+	movq	%rax, 64(%rbx)
+	movq	32(%rdx), %rax
+	movq	%rdi, 48(%rbx)
+	movq	%rax, 72(%rbx)
+	movl	$0, 80(%rbx)
+	movups	%xmm0, 88(%rbx)
+	movups	%xmm0, 104(%rbx)
+	testq	%rdi, %rdi
+	je	.L1133
+	movl	$120, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	movq	72(%rbx), %rax
+.L1133:
+	testq	%rax, %rax
+	je	.L1130
+	movq	$0, 16(%rax)
+	movl	$0, 12(%rax)
+.L1130:
+	movq	%r12, %rdi
+	call	wavefrontMTLCompose@PLT
+	movl	4(%rbp), %eax
+	movl	0(%rbp), %esi
+	movl	%eax, 92(%r12)
+	movq	64(%rbx), %rax
+	movq	%rax, 104(%r12)
+	testl	%esi, %esi
+	jne	.L1135
+.L1107:
+	movl	40(%rbx), %eax
+	testl	%eax, %eax
+	jne	.L1111
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1135:
+	.cfi_restore_state
+	movq	%r12, %rdi
+	call	wavefrontMTLReserve@PLT
+	testl	%eax, %eax
+	je	.L1107
+	movl	$1, 40(%rbx)
+.L1111:
+	movq	16(%rbx), %rsi
+	movq	64(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	$0, 16(%rbx)
+	movq	(%rbx), %rdi
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 24(%rbx)
+	call	wavefrontMTLRelease@PLT
+	movl	40(%rbx), %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1134:
+	.cfi_restore_state
+	movl	$0, 80(%rdi)
+	movups	%xmm0, 48(%rdi)
+	movups	%xmm0, 64(%rdi)
+	movups	%xmm0, 88(%rdi)
+	movups	%xmm0, 104(%rdi)
+	movq	%rsi, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	64(%rbx), %rax
+	movq	%rax, 104(%r12)
+	jmp	.L1107
+	.cfi_endproc
+.LFE43:
+	.size	wavefrontMTLParserCompose, .-wavefrontMTLParserCompose
+	.p2align 4
+	.globl	wavefrontMTLParserFeed
+	.type	wavefrontMTLParserFeed, @function
+wavefrontMTLParserFeed:
+.LFB45:
+	.cfi_startproc
+	jmp	parserFeed
+	.cfi_endproc
+.LFE45:
+	.size	wavefrontMTLParserFeed, .-wavefrontMTLParserFeed
+	.p2align 4
+	.globl	wavefrontMTLParserFinish
+	.type	wavefrontMTLParserFinish, @function
+wavefrontMTLParserFinish:
+.LFB47:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	40(%rdi), %ebp
+	testl	%ebp, %ebp
+	jne	.L1137
+	movq	24(%rdi), %rax
+	movq	16(%rdi), %rsi
+	movq	%rdi, %rbx
+	testq	%rax, %rax
+	je	.L1139
+	leaq	(%rsi,%rax), %r12
+	movq	%r12, %rdx
+	call	parseLine
+	movl	%eax, 40(%rbx)
+	cmpl	$3, %eax
+	je	.L1148
+.L1140:
+	movq	16(%rbx), %rsi
+	testl	%eax, %eax
+	jne	.L1142
+.L1139:
+	movq	64(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	$0, 16(%rbx)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 24(%rbx)
+.L1137:
+	movl	%ebp, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1142:
+	.cfi_restore_state
+	movq	64(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	$0, 16(%rbx)
+	pxor	%xmm0, %xmm0
+	movq	(%rbx), %rdi
+	movups	%xmm0, 24(%rbx)
+	call	wavefrontMTLRelease@PLT
+	movl	40(%rbx), %ebp
+	jmp	.L1137
+	.p2align 4,,10
+	.p2align 3
+.L1148:
+	cmpq	$0, 72(%rbx)
+	movq	16(%rbx), %rsi
+	je	.L1142
+	movq	104(%rbx), %rax
+	movq	112(%rbx), %r8
+	movq	%r12, %rdx
+	movq	%rbx, %rdi
+	subq	24(%rbx), %r8
+	leaq	1(%rax), %rcx
+	call	skipLine
+	movl	40(%rbx), %eax
+	jmp	.L1140
+	.cfi_endproc
+.LFE47:
+	.size	wavefrontMTLParserFinish, .-wavefrontMTLParserFinish
+	.p2align 4
+	.globl	parseWavefrontMTLFromBuffer
+	.type	parseWavefrontMTLFromBuffer, @function
+parseWavefrontMTLFromBuffer:
+.LFB55:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %xmm1
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	punpcklqdq	%xmm1, %xmm1
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 192
+	movaps	%xmm1, (%rsp)
+	testq	%rsi, %rsi
+	je	.L1166
+	pxor	%xmm0, %xmm0
+	movq	%rdi, 16(%rsp)
+	movq	%rdi, %rbp
+	movq	%rsi, %r12
+	movq	$0, 24(%rsp)
+	movq	%rdx, %r13
+	movq	%rcx, %rbx
+	movq	$0, 32(%rsp)
+	movq	$0, 56(%rsp)
+	movups	%xmm0, 40(%rsp)
+	testq	%rcx, %rcx
+	je	.L1181
+	movq	24(%rcx), %rax
+	movq	16(%rcx), %rdi
+	movq	$0, 72(%rsp)
+	movl	$0, 96(%rsp)
+	movq	%rax, 80(%rsp)
+	movq	32(%rcx), %rax
+	movq	%rdi, 64(%rsp)
+	movq	%rax, 88(%rsp)
+	movups	%xmm0, 104(%rsp)
+	movups	%xmm0, 120(%rsp)
+	testq	%rdi, %rdi
+	je	.L1180
+	movl	$120, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	movq	88(%rsp), %rax
+.L1180:
+	testq	%rax, %rax
+	je	.L1177
+	movq	$0, 16(%rax)
+	movl	$0, 12(%rax)
+.L1177:
+	movq	%rbp, %rdi
+	call	wavefrontMTLCompose@PLT
+	movl	4(%rbx), %eax
+	movq	80(%rsp), %rdi
+	movl	(%rbx), %esi
+	movl	%eax, 92(%rbp)
+	movq	%rdi, 104(%rbp)
+	testl	%esi, %esi
+	jne	.L1182
+	movl	56(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1164
+.L1159:
+	movdqa	(%rsp), %xmm2
+	movl	8(%rbx), %ecx
+	movups	%xmm2, 104(%rsp)
+	cmpl	$1, %ecx
+	ja	.L1183
+.L1161:
+	leaq	(%r12,%r13), %rdx
+	leaq	16(%rsp), %rdi
+	movq	%r12, %rsi
+	call	parseAll.isra.0
+	movl	56(%rsp), %eax
+.L1162:
+	testl	%eax, %eax
+	jne	.L1158
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1181:
+	.cfi_restore_state
+	movl	$0, 96(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movaps	%xmm0, 80(%rsp)
+	movups	%xmm0, 104(%rsp)
+	movups	%xmm0, 120(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movq	80(%rsp), %rdi
+	movl	56(%rsp), %ecx
+	movq	%rdi, 104(%rbp)
+	testl	%ecx, %ecx
+	je	.L1152
+.L1164:
+	movq	32(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	16(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 32(%rsp)
+	movups	%xmm0, 40(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	56(%rsp), %eax
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1183:
+	.cfi_restore_state
+	leaq	(%r12,%r13), %rdx
+	leaq	16(%rsp), %rdi
+	movq	%r12, %rsi
+	call	parseParallel.isra.0
+	movl	56(%rsp), %eax
+	jmp	.L1162
+	.p2align 4,,10
+	.p2align 3
+.L1152:
+	movdqa	(%rsp), %xmm3
+	movups	%xmm3, 104(%rsp)
+	jmp	.L1161
+	.p2align 4,,10
+	.p2align 3
+.L1166:
+	addq	$152, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	$2, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1182:
+	.cfi_restore_state
+	movq	%rbp, %rdi
+	call	wavefrontMTLReserve@PLT
+	testl	%eax, %eax
+	je	.L1157
+	movl	$1, 56(%rsp)
+.L1158:
+	movq	80(%rsp), %rdi
+	jmp	.L1164
+	.p2align 4,,10
+	.p2align 3
+.L1157:
+	movl	56(%rsp), %edx
+	testl	%edx, %edx
+	je	.L1159
+	jmp	.L1158
+	.cfi_endproc
+.LFE55:
+	.size	parseWavefrontMTLFromBuffer, .-parseWavefrontMTLFromBuffer
+	.p2align 4
+	.globl	parseWavefrontMTLFromString
+	.type	parseWavefrontMTLFromString, @function
+parseWavefrontMTLFromString:
+.LFB56:
+	.cfi_startproc
+	testq	%rsi, %rsi
+	je	.L1188
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	movq	%rsi, %rdi
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rsi, %rbx
+	addq	$-128, %rsp
+	.cfi_def_cfa_offset 160
+	call	strlen@PLT
+	pxor	%xmm0, %xmm0
+	movq	%rbp, %rdi
+	movq	%rbp, (%rsp)
+	movq	%rax, %r12
+	movups	%xmm0, 24(%rsp)
+	movq	$0, 8(%rsp)
+	movq	$0, 16(%rsp)
+	movq	$0, 40(%rsp)
+	movl	$0, 80(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	movaps	%xmm0, 64(%rsp)
+	movups	%xmm0, 88(%rsp)
+	movups	%xmm0, 104(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movq	64(%rsp), %rdi
+	movl	40(%rsp), %eax
+	movq	%rdi, 104(%rbp)
+	testl	%eax, %eax
+	jne	.L1186
+	movq	%rbx, %xmm0
+	leaq	(%rbx,%r12), %rdx
+	movq	%rsp, %rdi
+	movq	%rbx, %rsi
+	punpcklqdq	%xmm0, %xmm0
+	movups	%xmm0, 88(%rsp)
+	call	parseAll.isra.0
+	movl	40(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1196
+	subq	$-128, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.L1196:
+	.cfi_restore_state
+	movq	64(%rsp), %rdi
+.L1186:
+	movq	16(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 16(%rsp)
+	movups	%xmm0, 24(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	40(%rsp), %eax
+	subq	$-128, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1188:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	movl	$2, %eax
+	ret
+	.cfi_endproc
+.LFE56:
+	.size	parseWavefrontMTLFromString, .-parseWavefrontMTLFromString
+	.p2align 4
+	.globl	parseWavefrontMTLFromFile
+	.type	parseWavefrontMTLFromFile, @function
+parseWavefrontMTLFromFile:
+.LFB57:
+	.cfi_startproc
+	testq	%rsi, %rsi
+	je	.L1199
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 80
+	leaq	16(%rsp), %r12
+	movq	%r12, %rdi
+	call	wavefrontFileMap@PLT
+	testl	%eax, %eax
+	je	.L1204
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1204:
+	.cfi_restore_state
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	movq	%r13, %rcx
+	movq	%rbp, %rdi
+	call	parseWavefrontMTLFromBuffer
+	movq	%r12, %rdi
+	movl	%eax, 12(%rsp)
+	call	wavefrontFileUnmap@PLT
+	movl	12(%rsp), %eax
+	addq	$48, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1199:
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	movl	$2, %eax
+	ret
+	.cfi_endproc
+.LFE57:
+	.size	parseWavefrontMTLFromFile, .-parseWavefrontMTLFromFile
+	.p2align 4
+	.globl	parseWavefrontMTLBatch
+	.type	parseWavefrontMTLBatch, @function
+parseWavefrontMTLBatch:
+.LFB60:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movl	%esi, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%rdi, 8(%rsp)
+	movq	$0, 64(%rsp)
+	movl	$0, (%rsp)
+	movaps	%xmm0, 16(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	testq	%rdx, %rdx
+	je	.L1206
+	movdqu	(%rdx), %xmm1
+	movdqu	16(%rdx), %xmm2
+	movups	%xmm1, 40(%rsp)
+	movl	48(%rsp), %eax
+	movups	%xmm2, 56(%rsp)
+	movq	64(%rsp), %rbp
+	movl	%eax, (%rsp)
+.L1206:
+	movq	8(%rsp), %rbx
+	movl	%r13d, %r12d
+	movl	$24, %edx
+	movq	%rbp, %rdi
+	movq	%r12, %rsi
+	movl	$0, 48(%rsp)
+	movq	$0, 56(%rsp)
+	movq	$0, 72(%rsp)
+	movq	%rbx, 16(%rsp)
+	call	wavefrontAllocateZeroedWith@PLT
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	salq	$4, %rsi
+	movq	%rax, 24(%rsp)
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	testl	%r13d, %r13d
+	je	.L1207
+	addq	$24, %rbx
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	jmp	.L1218
+	.p2align 4,,10
+	.p2align 3
+.L1208:
+	testq	%rdi, %rdi
+	je	.L1250
+	movq	-24(%rbx), %rsi
+	testq	%rsi, %rsi
+	je	.L1212
+	leaq	(%rax,%r15), %rdi
+	call	wavefrontFileMap@PLT
+	movq	32(%rsp), %rdi
+	movl	%eax, 112(%rbx)
+	testq	%rdi, %rdi
+	je	.L1211
+.L1214:
+	cmpq	$0, -24(%rbx)
+	je	.L1216
+	movq	24(%rsp), %rax
+	movq	8(%rax,%r15), %rsi
+.L1217:
+	movq	%r14, %rax
+	salq	$4, %rax
+	addq	%rdi, %rax
+	movq	%rsi, (%rax)
+	movl	%r14d, 8(%rax)
+.L1215:
+	addq	$1, %r14
+	addq	$144, %rbx
+	addq	$24, %r15
+	cmpq	%r14, %r12
+	je	.L1251
+.L1218:
+	movq	%rbx, %rdi
+	call	wavefrontMTLCompose@PLT
+	movq	24(%rsp), %rax
+	movq	%rbp, 104(%rbx)
+	movl	$0, 112(%rbx)
+	movq	32(%rsp), %rdi
+	testq	%rax, %rax
+	jne	.L1208
+	movl	$1, 112(%rbx)
+	testq	%rdi, %rdi
+	jne	.L1214
+.L1211:
+	xorl	%edi, %edi
+	jmp	.L1215
+	.p2align 4,,10
+	.p2align 3
+.L1212:
+	cmpq	$0, -16(%rbx)
+	je	.L1252
+.L1216:
+	movq	-8(%rbx), %rsi
+	jmp	.L1217
+	.p2align 4,,10
+	.p2align 3
+.L1250:
+	movl	$1, 112(%rbx)
+	xorl	%edi, %edi
+	jmp	.L1215
+	.p2align 4,,10
+	.p2align 3
+.L1251:
+	movq	24(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1231
+	testq	%rdi, %rdi
+	je	.L1231
+.L1221:
+	leaq	compareBatchEntries(%rip), %rcx
+	movl	$16, %edx
+	movq	%r12, %rsi
+	call	qsort@PLT
+	movl	(%rsp), %ecx
+	leaq	16(%rsp), %rsi
+	movq	%rbp, %r8
+	movl	%r13d, %edx
+	leaq	parseBatchItem(%rip), %rdi
+	call	wavefrontRunParallel@PLT
+	movq	24(%rsp), %rax
+	testl	%r13d, %r13d
+	je	.L1234
+.L1231:
+	movq	8(%rsp), %r15
+	leal	-1(%r13), %r12d
+	xorl	%ebx, %ebx
+	xorl	%r14d, %r14d
+	xorl	%esi, %esi
+	testq	%rax, %rax
+	je	.L1223
+	.p2align 4,,10
+	.p2align 3
+.L1254:
+	cmpq	$0, (%r15)
+	movq	%rax, %rsi
+	je	.L1223
+	leaq	(%rbx,%rbx,2), %rcx
+	movq	%rax, (%rsp)
+	leaq	(%rax,%rcx,8), %rdi
+	call	wavefrontFileUnmap@PLT
+	movq	24(%rsp), %rsi
+	movq	(%rsp), %rax
+.L1223:
+	testl	%r14d, %r14d
+	jne	.L1224
+	movl	136(%r15), %r14d
+.L1224:
+	cmpq	%rbx, %r12
+	je	.L1220
+	leaq	1(%rbx), %rcx
+	addq	$144, %r15
+	testq	%rax, %rax
+	je	.L1253
+	movq	%rsi, %rax
+	movq	%rcx, %rbx
+	xorl	%esi, %esi
+	testq	%rax, %rax
+	jne	.L1254
+	jmp	.L1223
+	.p2align 4,,10
+	.p2align 3
+.L1253:
+	addl	$1, %ebx
+.L1230:
+	testl	%r14d, %r14d
+	jne	.L1227
+	movl	%ebx, %eax
+	movq	8(%rsp), %rdx
+	addl	$1, %ebx
+	leaq	(%rax,%rax,8), %rax
+	salq	$4, %rax
+	movl	136(%rdx,%rax), %r14d
+	cmpl	%r13d, %ebx
+	jb	.L1230
+.L1220:
+	movq	%rbp, %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	wavefrontFreeWith@PLT
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r14d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1227:
+	.cfi_restore_state
+	addl	$1, %ebx
+	cmpl	%r13d, %ebx
+	jb	.L1230
+	jmp	.L1220
+	.p2align 4,,10
+	.p2align 3
+.L1252:
+	movl	$2, 112(%rbx)
+	jmp	.L1216
+	.p2align 4,,10
+	.p2align 3
+.L1207:
+	movq	24(%rsp), %rsi
+	xorl	%r14d, %r14d
+	testq	%rsi, %rsi
+	je	.L1220
+	testq	%rax, %rax
+	jne	.L1221
+	jmp	.L1220
+.L1234:
+	movq	%rax, %rsi
+	xorl	%r14d, %r14d
+	jmp	.L1220
+	.cfi_endproc
+.LFE60:
+	.size	parseWavefrontMTLBatch, .-parseWavefrontMTLBatch
+	.p2align 4
+	.globl	wavefrontMTLReload
+	.type	wavefrontMTLReload, @function
+wavefrontMTLReload:
+.LFB61:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rcx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 304
+	testq	%rcx, %rcx
+	je	.L1256
+	movl	$56, %edx
+	xorl	%esi, %esi
+	movq	%rcx, %rdi
+	call	memset@PLT
+.L1256:
+	movl	92(%rbp), %r15d
+	movq	104(%rbp), %rax
+	testq	%rbx, %rbx
+	je	.L1266
+	movq	%rsp, %r12
+	pxor	%xmm0, %xmm0
+	movq	$0, 120(%rsp)
+	movq	%r12, %rdi
+	movq	%r12, 112(%rsp)
+	movq	$0, 128(%rsp)
+	movq	$0, 152(%rsp)
+	movq	%rax, 176(%rsp)
+	movq	$0, 184(%rsp)
+	movl	$0, 192(%rsp)
+	movups	%xmm0, 136(%rsp)
+	movaps	%xmm0, 160(%rsp)
+	movups	%xmm0, 200(%rsp)
+	movups	%xmm0, 216(%rsp)
+	call	wavefrontMTLCompose@PLT
+	movq	176(%rsp), %rdi
+	movl	%r15d, 92(%rsp)
+	movl	152(%rsp), %edx
+	movq	%rdi, 104(%rsp)
+	testl	%edx, %edx
+	jne	.L1259
+	movq	%rbx, %xmm0
+	leaq	(%rbx,%r14), %rdx
+	leaq	112(%rsp), %rdi
+	movq	%rbx, %rsi
+	punpcklqdq	%xmm0, %xmm0
+	movups	%xmm0, 200(%rsp)
+	call	parseAll.isra.0
+	movl	152(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1267
+.L1261:
+	movq	%rbp, %rdi
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	call	wavefrontMTLUpdate@PLT
+	movq	%r12, %rdi
+	movl	%eax, %ebx
+	call	wavefrontMTLRelease@PLT
+.L1255:
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L1267:
+	.cfi_restore_state
+	movq	176(%rsp), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L1259:
+	movq	128(%rsp), %rsi
+	call	wavefrontFreeWith@PLT
+	movq	112(%rsp), %rdi
+	pxor	%xmm0, %xmm0
+	movq	$0, 128(%rsp)
+	movups	%xmm0, 136(%rsp)
+	call	wavefrontMTLRelease@PLT
+	movl	152(%rsp), %ebx
+	testl	%ebx, %ebx
+	jne	.L1255
+	jmp	.L1261
+	.p2align 4,,10
+	.p2align 3
+.L1266:
+	movl	$2, %ebx
+	jmp	.L1255
+	.cfi_endproc
+.LFE61:
+	.size	wavefrontMTLReload, .-wavefrontMTLReload
+	.p2align 4
+	.globl	wavefrontMTLIndexCompose
+	.type	wavefrontMTLIndexCompose, @function
+wavefrontMTLIndexCompose:
+.LFB66:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdx, %r14
+	movl	$176, %edx
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12
+	xorl	%esi, %esi
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	leaq	64(%rbx), %r13
+	call	memset@PLT
+	movq	%r13, %rdi
+	call	wavefrontMTLCompose@PLT
+	testq	%rbp, %rbp
+	je	.L1269
+	movl	4(%rbp), %eax
+	movl	%eax, 156(%rbx)
+	movq	24(%rbp), %rax
+	movq	%rax, 168(%rbx)
+.L1269:
+	testq	%r12, %r12
+	je	.L1271
+	movq	%r12, (%rbx)
+	movq	%rbx, %rdi
+	movq	%r14, 8(%rbx)
+	call	indexScan
+	movl	%eax, %ebp
+	testl	%eax, %eax
+	jne	.L1279
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1279:
+	.cfi_restore_state
+	movq	16(%rbx), %rsi
+	movq	168(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%rbx), %rsi
+	movq	168(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	48(%rbx), %rsi
+	movq	168(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%r13, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	movl	$176, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	movq	%r13, %rdi
+	call	wavefrontMTLCompose@PLT
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1271:
+	.cfi_restore_state
+	movl	$2, %ebp
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE66:
+	.size	wavefrontMTLIndexCompose, .-wavefrontMTLIndexCompose
+	.p2align 4
+	.globl	wavefrontMTLIndexFind
+	.type	wavefrontMTLIndexFind, @function
+wavefrontMTLIndexFind:
+.LFB67:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$632, %rsp
+	.cfi_def_cfa_offset 688
+	movl	$-1, (%rdx)
+	movl	56(%rdi), %r15d
+	movq	%rsi, 16(%rsp)
+	movq	%rdx, 24(%rsp)
+	testl	%r15d, %r15d
+	jne	.L1303
+.L1282:
+	xorl	%eax, %eax
+.L1280:
+	addq	$632, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L1303:
+	.cfi_restore_state
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+	movq	%rsi, %r14
+	subl	$1, %r15d
+	call	strlen@PLT
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	movq	%rax, %rbp
+	call	wavefrontMTLHashName@PLT
+	movq	48(%rbx), %rcx
+	andl	%r15d, %eax
+	movl	%eax, %r13d
+	movl	(%rcx,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L1282
+	movq	16(%rbx), %r12
+	jmp	.L1286
+	.p2align 4,,10
+	.p2align 3
+.L1284:
+	addl	$1, %r13d
+	andl	%r15d, %r13d
+	movl	%r13d, %eax
+	movl	(%rcx,%rax,4), %eax
+	testl	%eax, %eax
+	je	.L1282
+.L1286:
+	salq	$5, %rax
+	leaq	-32(%r12,%rax), %r14
+	cmpq	8(%r14), %rbp
+	jne	.L1284
+	movq	(%r14), %rdi
+	movq	16(%rsp), %rsi
+	movq	%rbp, %rdx
+	movq	%rcx, 8(%rsp)
+	call	memcmp@PLT
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	jne	.L1284
+	movl	24(%r14), %eax
+	testl	%eax, %eax
+	js	.L1287
+	movq	24(%rsp), %rbx
+	movl	%eax, (%rbx)
+	jmp	.L1282
+	.p2align 4,,10
+	.p2align 3
+.L1287:
+	leaq	160(%rsp), %r13
+	leaq	32(%rsp), %rbp
+	movq	%r13, %rdi
+	leaq	64(%rbx), %r15
+	call	wavefrontMaterialCompose@PLT
+	movl	$120, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	memset@PLT
+	movq	168(%rbx), %rax
+	movl	16(%r14), %edx
+	movq	%r15, 32(%rsp)
+	movq	%r13, 40(%rsp)
+	movq	%rax, 96(%rsp)
+	testl	%edx, %edx
+	je	.L1302
+	.p2align 4,,10
+	.p2align 3
+.L1289:
+	movl	72(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1280
+	leal	-1(%rdx), %eax
+	movq	32(%rbx), %rdx
+	movq	%rbp, %rdi
+	leaq	(%rax,%rax,2), %rax
+	leaq	0(,%rax,8), %r12
+	addq	%r12, %rdx
+	movq	8(%rdx), %rcx
+	movq	(%rdx), %rsi
+	movq	%rcx, %rdx
+	call	parseAll.isra.0
+	movq	32(%rbx), %rdx
+	movl	16(%rdx,%r12), %edx
+	testl	%edx, %edx
+	jne	.L1289
+.L1302:
+	movl	72(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L1280
+	movq	(%r14), %rsi
+	movq	8(%r14), %rdx
+	movq	%r15, %rdi
+	call	wavefrontMTLCopyString@PLT
+	movq	%rax, %rsi
+	movq	%rax, 160(%rsp)
+	movl	$1, %eax
+	testq	%rsi, %rsi
+	je	.L1280
+	movq	%r15, %rdi
+	call	wavefrontMTLAddMaterial@PLT
+	testl	%eax, %eax
+	jne	.L1304
+	movl	72(%rbx), %eax
+	movl	$57, %ecx
+	movq	%r13, %rsi
+	subl	$1, %eax
+	movq	%rax, %rdx
+	imulq	$456, %rax, %rax
+	addq	64(%rbx), %rax
+	movq	%rax, %rdi
+	movq	24(%rsp), %rax
+	rep movsq
+	movl	%edx, (%rax)
+	movl	%edx, 24(%r14)
+	jmp	.L1282
+.L1304:
+	movq	160(%rsp), %rsi
+	movq	%r15, %rdi
+	movl	%eax, 8(%rsp)
+	call	wavefrontMTLFreeString@PLT
+	movl	8(%rsp), %eax
+	jmp	.L1280
+	.cfi_endproc
+.LFE67:
+	.size	wavefrontMTLIndexFind, .-wavefrontMTLIndexFind
+	.p2align 4
+	.globl	wavefrontMTLIndexRelease
+	.type	wavefrontMTLIndexRelease, @function
+wavefrontMTLIndexRelease:
+.LFB68:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	leaq	64(%rbx), %rbp
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	16(%rdi), %rsi
+	movq	168(%rdi), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	32(%rbx), %rsi
+	movq	168(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	48(%rbx), %rsi
+	movq	168(%rbx), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%rbp, %rdi
+	call	wavefrontMTLRelease@PLT
+	movq	%rbx, %rdi
+	movl	$176, %edx
+	xorl	%esi, %esi
+	call	memset@PLT
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	wavefrontMTLCompose@PLT
+	.cfi_endproc
+.LFE68:
+	.size	wavefrontMTLIndexRelease, .-wavefrontMTLIndexRelease
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	parsers, @object
+	.size	parsers, 512
+parsers:
+	.zero	32
+	.quad	parseColor
+	.quad	8
+	.quad	parseColor
+	.quad	24
+	.quad	parseColor
+	.quad	40
+	.quad	parseColor
+	.quad	72
+	.quad	parseColor
+	.quad	56
+	.quad	parseTransparency
+	.quad	92
+	.quad	parseInteger
+	.quad	128
+	.quad	parseFloat
+	.quad	88
+	.quad	parseFloat
+	.quad	96
+	.quad	parseFloat
+	.quad	92
+	.quad	parseFloat
+	.quad	100
+	.quad	parseFloat
+	.quad	104
+	.quad	parseFloat
+	.quad	108
+	.quad	parseFloat
+	.quad	112
+	.quad	parseFloat
+	.quad	116
+	.quad	parseFloat
+	.quad	120
+	.quad	parseFloat
+	.quad	124
+	.quad	parseMap
+	.quad	136
+	.quad	parseMap
+	.quad	152
+	.quad	parseMap
+	.quad	184
+	.quad	parseMap
+	.quad	440
+	.quad	parseMap
+	.quad	168
+	.quad	parseMap
+	.quad	200
+	.quad	parseMap
+	.quad	216
+	.quad	parseMap
+	.quad	392
+	.quad	parseMap
+	.quad	408
+	.quad	parseMap
+	.quad	424
+	.quad	parseMap
+	.quad	232
+	.quad	parseMap
+	.quad	248
+	.quad	parseMap
+	.quad	264
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC4:
+	.long	1065353216
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC39:
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.align 16
+.LC40:
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2526 @@
+	.file	"wavefront_material_writer.c"
+	.text
+	.p2align 4
+	.type	writeToBuffer, @function
+writeToBuffer:
+.LFB24:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	16(%rdi), %rdi
+	movq	8(%rbx), %rdx
+	cmpq	%rdx, %rdi
+	jb	.L5
+	addq	%rdi, %rbp
+	xorl	%eax, %eax
+	movq	%rbp, 16(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.cfi_restore_state
+	subq	%rdi, %rdx
+	cmpq	%rbp, %rdx
+	cmova	%rbp, %rdx
+	addq	(%rbx), %rdi
+	call	memcpy@PLT
+	movq	16(%rbx), %rdi
+	xorl	%eax, %eax
+	addq	%rdi, %rbp
+	movq	%rbp, 16(%rbx)
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	writeToBuffer, .-writeToBuffer
+	.p2align 4
+	.type	writeToFile, @function
+writeToFile:
+.LFB26:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rcx
+	movq	%rsi, %rdi
+	movl	$1, %esi
+	movq	%rdx, %rbx
+	call	fwrite@PLT
+	cmpq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	setne	%al
+	movzbl	%al, %eax
+	addl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	writeToFile, .-writeToFile
+	.p2align 4
+	.type	writeInteger, @function
+writeInteger:
+.LFB17:
+	.cfi_startproc
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movl	%esi, %ecx
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	negl	%ecx
+	cmovs	%esi, %ecx
+	movl	$3435973837, %esi
+	movl	%ecx, %eax
+	movl	%ecx, %r13d
+	imulq	%rsi, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %edx
+	addl	%edx, %edx
+	subl	%edx, %r13d
+	addl	$48, %r13d
+	movb	%r13b, 4(%rsp)
+	cmpl	$9, %ecx
+	jbe	.L17
+	movl	%eax, %edx
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %eax
+	addl	$48, %eax
+	movb	%al, 5(%rsp)
+	cmpl	$99, %ecx
+	jbe	.L18
+	movl	%edx, %eax
+	imulq	%rsi, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %edx
+	addl	$48, %edx
+	movb	%dl, 6(%rsp)
+	cmpl	$999, %ecx
+	jbe	.L19
+	movl	%eax, %edx
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %eax
+	addl	$48, %eax
+	movb	%al, 7(%rsp)
+	cmpl	$9999, %ecx
+	jbe	.L20
+	movl	%edx, %eax
+	imulq	%rsi, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %edx
+	addl	$48, %edx
+	movb	%dl, 8(%rsp)
+	cmpl	$99999, %ecx
+	jbe	.L21
+	movl	%eax, %edx
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %eax
+	addl	$48, %eax
+	movb	%al, 9(%rsp)
+	cmpl	$999999, %ecx
+	jbe	.L22
+	movl	%edx, %eax
+	imulq	%rsi, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %edx
+	addl	$48, %edx
+	movb	%dl, 10(%rsp)
+	cmpl	$9999999, %ecx
+	jbe	.L23
+	movl	%eax, %edx
+	imulq	%rsi, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %eax
+	addl	$48, %eax
+	movb	%al, 11(%rsp)
+	cmpl	$99999999, %ecx
+	jbe	.L24
+	movl	%edx, %eax
+	imulq	%rsi, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %esi
+	addl	%esi, %esi
+	subl	%esi, %edx
+	addl	$48, %edx
+	movb	%dl, 12(%rsp)
+	cmpl	$999999999, %ecx
+	jbe	.L25
+	addl	$48, %eax
+	movl	$10, %ebx
+	movb	%al, 13(%rsp)
+.L10:
+	movq	24(%rbp), %rdx
+	leaq	32(%rbp), %r14
+	leaq	14(%rdx), %rax
+	cmpq	$16384, %rax
+	ja	.L11
+	addq	%r14, %rdx
+.L12:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rax
+	testl	%r12d, %r12d
+	jns	.L15
+	movb	$45, 1(%rdx)
+	leaq	2(%rdx), %rax
+.L15:
+	leal	-1(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, (%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-2(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 1(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-3(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 2(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-4(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 3(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-5(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 4(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-6(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 5(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-7(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 6(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-8(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 7(%rax)
+	testl	%edx, %edx
+	je	.L16
+	leal	-9(%rbx), %edx
+	movslq	%edx, %rcx
+	movzbl	4(%rsp,%rcx), %ecx
+	movb	%cl, 8(%rax)
+	testl	%edx, %edx
+	je	.L16
+	movb	%r13b, 9(%rax)
+.L16:
+	addq	%rbx, %rax
+	subq	%r14, %rax
+	movq	%rax, 24(%rbp)
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+	movl	16(%rbp), %eax
+	testl	%eax, %eax
+	jne	.L13
+	movq	8(%rbp), %rdi
+	movq	%r14, %rsi
+	call	*0(%rbp)
+	movl	%eax, 16(%rbp)
+.L13:
+	movq	%r14, %rdx
+	jmp	.L12
+.L22:
+	movl	$6, %ebx
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	movl	$1, %ebx
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	movl	$2, %ebx
+	jmp	.L10
+.L19:
+	movl	$3, %ebx
+	jmp	.L10
+.L20:
+	movl	$4, %ebx
+	jmp	.L10
+.L21:
+	movl	$5, %ebx
+	jmp	.L10
+.L23:
+	movl	$7, %ebx
+	jmp	.L10
+.L24:
+	movl	$8, %ebx
+	jmp	.L10
+.L25:
+	movl	$9, %ebx
+	jmp	.L10
+	.cfi_endproc
+.LFE17:
+	.size	writeInteger, .-writeInteger
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"newmtl "
+.LC1:
+	.string	"illum"
+.LC2:
+	.string	" -blendu"
+.LC3:
+	.string	" on"
+.LC4:
+	.string	" off"
+.LC5:
+	.string	" -blendv"
+.LC6:
+	.string	" -cc"
+.LC7:
+	.string	" -clamp"
+.LC8:
+	.string	" -mm"
+.LC9:
+	.string	" -o"
+.LC10:
+	.string	" -s"
+.LC11:
+	.string	" -t"
+.LC12:
+	.string	" -texres"
+.LC13:
+	.string	" -bm"
+.LC14:
+	.string	" -boost"
+.LC15:
+	.string	" -imfchan "
+.LC16:
+	.string	"rgbmlz"
+	.text
+	.p2align 4
+	.globl	writeWavefrontMTL
+	.type	writeWavefrontMTL, @function
+writeWavefrontMTL:
+.LFB23:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$16552, %rsp
+	.cfi_def_cfa_offset 16608
+	movq	%rdi, 32(%rsp)
+	testq	%rsi, %rsi
+	je	.L277
+	movl	8(%rdi), %eax
+	movq	%rsi, 128(%rsp)
+	movq	%rdx, 136(%rsp)
+	movl	$0, 144(%rsp)
+	movq	$0, 152(%rsp)
+	testl	%eax, %eax
+	je	.L57
+	movl	$0, 60(%rsp)
+	movq	(%rdi), %rdx
+	movl	$1, %eax
+	movl	$16384, %r13d
+.L56:
+	movl	60(%rsp), %ebp
+	imulq	$456, %rbp, %r12
+	leaq	(%rdx,%r12), %rcx
+	cmpq	$0, (%rcx)
+	movq	%rcx, 16(%rsp)
+	je	.L397
+	movq	152(%rsp), %rbx
+	leaq	160(%rsp), %rbp
+	testl	%eax, %eax
+	je	.L398
+.L61:
+	leaq	.LC0(%rip), %rdi
+	call	strlen@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L64
+	leaq	.LC0(%rip), %r14
+	jmp	.L68
+	.p2align 4,,10
+	.p2align 3
+.L399:
+	movq	%r13, %r15
+	leaq	0(%rbp,%rbx), %rdi
+	subq	%rbx, %r15
+.L66:
+	cmpq	%r15, %r12
+	movq	%r14, %rsi
+	cmovbe	%r12, %r15
+	movq	%r15, %rdx
+	addq	%r15, %r14
+	call	memcpy@PLT
+	movq	152(%rsp), %rbx
+	addq	%r15, %rbx
+	movq	%rbx, 152(%rsp)
+	subq	%r15, %r12
+	je	.L64
+.L68:
+	cmpq	$16384, %rbx
+	jne	.L399
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L67
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L67:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r15d
+	movq	%rbp, %rdi
+	jmp	.L66
+.L64:
+	movq	16(%rsp), %rax
+	movq	(%rax), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L73
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	movq	%r13, %r15
+	leaq	0(%rbp,%rbx), %rdi
+	subq	%rbx, %r15
+.L71:
+	cmpq	%r12, %r15
+	movq	%r14, %rsi
+	cmova	%r12, %r15
+	movq	%r15, %rdx
+	addq	%r15, %r14
+	call	memcpy@PLT
+	movq	152(%rsp), %rbx
+	addq	%r15, %rbx
+	movq	%rbx, 152(%rsp)
+	subq	%r15, %r12
+	je	.L69
+.L73:
+	cmpq	$16384, %rbx
+	jne	.L400
+	movl	144(%rsp), %r15d
+	testl	%r15d, %r15d
+	jne	.L72
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L72:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r15d
+	movq	%rbp, %rdi
+	jmp	.L71
+.L69:
+	leaq	1(%rbx), %rax
+	cmpq	$16384, %rax
+	ja	.L74
+	addq	%rbp, %rbx
+.L75:
+	movb	$10, (%rbx)
+	leaq	colors(%rip), %rax
+	addq	$1, 152(%rsp)
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	movq	(%rsp), %rax
+	movq	16(%rsp), %r15
+	addq	8(%rax), %r15
+	cmpb	$0, (%r15)
+	jne	.L77
+	cmpb	$0, 1(%r15)
+	jne	.L77
+	cmpb	$0, 2(%r15)
+	jne	.L77
+	cmpb	$0, 3(%r15)
+	jne	.L77
+	cmpb	$0, 4(%r15)
+	jne	.L77
+	cmpb	$0, 5(%r15)
+	jne	.L77
+	cmpb	$0, 6(%r15)
+	jne	.L77
+	cmpb	$0, 7(%r15)
+	jne	.L77
+	cmpb	$0, 8(%r15)
+	jne	.L77
+	cmpb	$0, 9(%r15)
+	jne	.L77
+	cmpb	$0, 10(%r15)
+	jne	.L77
+	cmpb	$0, 11(%r15)
+	jne	.L77
+	cmpb	$0, 12(%r15)
+	jne	.L77
+	cmpb	$0, 13(%r15)
+	jne	.L77
+	cmpb	$0, 14(%r15)
+	jne	.L77
+	cmpb	$0, 15(%r15)
+	jne	.L77
+.L78:
+	addq	$16, (%rsp)
+	movq	(%rsp), %rax
+	leaq	80+colors(%rip), %rcx
+	cmpq	%rax, %rcx
+	jne	.L96
+	leaq	scalars(%rip), %rax
+	movq	%rax, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	movq	(%rsp), %rax
+	movq	16(%rsp), %r12
+	addq	8(%rax), %r12
+	cmpb	$0, (%r12)
+	jne	.L97
+	cmpb	$0, 1(%r12)
+	jne	.L97
+	cmpb	$0, 2(%r12)
+	jne	.L97
+	cmpb	$0, 3(%r12)
+	jne	.L97
+.L98:
+	addq	$16, (%rsp)
+	movq	(%rsp), %rax
+	leaq	160+scalars(%rip), %rcx
+	cmpq	%rax, %rcx
+	jne	.L110
+	movq	16(%rsp), %rax
+	movl	128(%rax), %ebx
+	testl	%ebx, %ebx
+	jne	.L401
+.L111:
+	movq	$0, (%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	movq	(%rsp), %rbx
+	movq	16(%rsp), %rdi
+	movl	%ebx, %esi
+	call	wavefrontMaterialMap@PLT
+	cmpq	$0, (%rax)
+	movq	%rax, 8(%rsp)
+	je	.L120
+	leaq	mapKeywords(%rip), %rax
+	movq	(%rax,%rbx,8), %r12
+	movq	%r12, %rdi
+	call	strlen@PLT
+	movq	%rax, %r15
+	movq	152(%rsp), %rax
+	testq	%r15, %r15
+	jne	.L127
+	jmp	.L128
+	.p2align 4,,10
+	.p2align 3
+.L402:
+	movq	%r13, %rbx
+	leaq	0(%rbp,%rax), %rdi
+	subq	%rax, %rbx
+.L125:
+	cmpq	%rbx, %r15
+	movq	%r12, %rsi
+	cmovbe	%r15, %rbx
+	movq	%rbx, %rdx
+	addq	%rbx, %r12
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	addq	%rbx, %rax
+	movq	%rax, 152(%rsp)
+	subq	%rbx, %r15
+	je	.L128
+.L127:
+	cmpq	$16384, %rax
+	jne	.L402
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L126
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L126:
+	movq	$0, 152(%rsp)
+	movl	$16384, %ebx
+	movq	%rbp, %rdi
+	jmp	.L125
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	leaq	1(%r15), %rax
+	cmpq	$16384, %rax
+	ja	.L271
+	addq	%rbp, %r15
+.L272:
+	movb	$10, (%r15)
+	addq	$1, 152(%rsp)
+.L120:
+	addq	$1, (%rsp)
+	movq	(%rsp), %rax
+	cmpq	$20, %rax
+	jne	.L274
+	movq	32(%rsp), %rsi
+	addl	$1, 60(%rsp)
+	movl	144(%rsp), %eax
+	movl	60(%rsp), %ecx
+	cmpl	8(%rsi), %ecx
+	jnb	.L60
+	testl	%eax, %eax
+	jne	.L54
+	movq	(%rsi), %rdx
+	jmp	.L56
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	movq	8(%rsp), %rsi
+	movq	32(%rsp), %rdi
+	leaq	64(%rsp), %r14
+	call	wavefrontMTLMapOptions@PLT
+	movq	%r14, %rdi
+	movq	%r14, 24(%rsp)
+	movq	%rax, %rbx
+	call	wavefrontMapOptionsCompose@PLT
+	movl	$64, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	je	.L403
+	movl	60(%rbx), %ecx
+	movl	124(%rsp), %r15d
+	xorl	%ecx, %r15d
+	testb	$1, %r15b
+	jne	.L130
+.L140:
+	testb	$2, %r15b
+	jne	.L404
+.L132:
+	testb	$4, %r15b
+	jne	.L405
+.L146:
+	andl	$8, %r15d
+	jne	.L406
+.L159:
+	leaq	108(%rsp), %rsi
+	leaq	44(%rbx), %rdi
+	movl	$8, %edx
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L407
+.L172:
+	movq	24(%rsp), %rsi
+	movl	$12, %edx
+	movq	%rbx, %rdi
+	leaq	12(%rbx), %r12
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L408
+.L185:
+	leaq	76(%rsp), %rsi
+	movl	$12, %edx
+	movq	%r12, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L195
+	leaq	24(%rbx), %r12
+.L196:
+	leaq	88(%rsp), %rsi
+	movl	$12, %edx
+	movq	%r12, %rdi
+	call	memcmp@PLT
+	testl	%eax, %eax
+	jne	.L206
+	leaq	36(%rbx), %r12
+.L207:
+	movl	52(%rbx), %r14d
+	testl	%r14d, %r14d
+	jne	.L409
+.L218:
+	leaq	100(%rsp), %rsi
+	movl	$4, %edx
+	movq	%r12, %rdi
+	call	memcmp@PLT
+	movq	152(%rsp), %r15
+	testl	%eax, %eax
+	jne	.L410
+.L233:
+	cmpb	$0, 40(%rbx)
+	jne	.L243
+	cmpb	$0, 41(%rbx)
+	jne	.L243
+	cmpb	$0, 42(%rbx)
+	jne	.L243
+	cmpb	$0, 43(%rbx)
+	jne	.L243
+.L244:
+	movl	56(%rbx), %r14d
+	leal	-1(%r14), %eax
+	cmpl	$126, %eax
+	ja	.L129
+	movl	$6, %edx
+	movl	%r14d, %esi
+	leaq	.LC16(%rip), %rdi
+	call	memchr@PLT
+	testq	%rax, %rax
+	je	.L129
+	leaq	.LC15(%rip), %r8
+	movq	%r8, %rdi
+	call	strlen@PLT
+	testq	%rax, %rax
+	je	.L255
+	leaq	.LC15(%rip), %r8
+	movq	%rbx, 24(%rsp)
+	movq	%rax, %r14
+	movq	%r8, %rbx
+	jmp	.L259
+	.p2align 4,,10
+	.p2align 3
+.L412:
+	movq	%r13, %r12
+	leaq	0(%rbp,%r15), %rdi
+	subq	%r15, %r12
+.L257:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %r15
+	addq	%r12, %r15
+	movq	%r15, 152(%rsp)
+	subq	%r12, %r14
+	je	.L411
+.L259:
+	cmpq	$16384, %r15
+	jne	.L412
+	movl	144(%rsp), %edi
+	testl	%edi, %edi
+	jne	.L258
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L258:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L257
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	movq	152(%rsp), %r15
+.L129:
+	leaq	1(%r15), %rax
+	cmpq	$16384, %rax
+	ja	.L263
+	addq	%rbp, %r15
+.L264:
+	movb	$32, (%r15)
+	movq	152(%rsp), %rax
+	leaq	1(%rax), %r15
+	movq	8(%rsp), %rax
+	movq	%r15, 152(%rsp)
+	movq	(%rax), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	%rax, %r12
+	testq	%rax, %rax
+	jne	.L270
+	jmp	.L266
+	.p2align 4,,10
+	.p2align 3
+.L413:
+	movq	%r13, %rbx
+	leaq	0(%rbp,%r15), %rdi
+	subq	%r15, %rbx
+.L268:
+	cmpq	%rbx, %r12
+	movq	%r14, %rsi
+	cmovbe	%r12, %rbx
+	movq	%rbx, %rdx
+	addq	%rbx, %r14
+	call	memcpy@PLT
+	movq	152(%rsp), %r15
+	addq	%rbx, %r15
+	movq	%r15, 152(%rsp)
+	subq	%rbx, %r12
+	je	.L266
+.L270:
+	cmpq	$16384, %r15
+	jne	.L413
+	movl	144(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L269
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L269:
+	movq	$0, 152(%rsp)
+	movl	$16384, %ebx
+	movq	%rbp, %rdi
+	jmp	.L268
+	.p2align 4,,10
+	.p2align 3
+.L263:
+	movl	144(%rsp), %ecx
+	testl	%ecx, %ecx
+	jne	.L265
+	movq	136(%rsp), %rdi
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L265:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %r15
+	jmp	.L264
+	.p2align 4,,10
+	.p2align 3
+.L271:
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L273
+	movq	136(%rsp), %rdi
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L273:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %r15
+	jmp	.L272
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	movq	(%rsp), %rax
+	movq	(%rax), %rbx
+	movq	%rbx, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdi
+	movq	%rax, %r15
+	testq	%rax, %rax
+	jne	.L103
+	jmp	.L99
+	.p2align 4,,10
+	.p2align 3
+.L414:
+	movq	%r13, %rdx
+	subq	%rdi, %rdx
+	addq	%rbp, %rdi
+.L101:
+	cmpq	%rdx, %r15
+	movq	%rbx, %rsi
+	cmovbe	%r15, %rdx
+	movq	%rdx, %r14
+	call	memcpy@PLT
+	movq	152(%rsp), %rdi
+	addq	%r14, %rbx
+	addq	%r14, %rdi
+	movq	%rdi, 152(%rsp)
+	subq	%r14, %r15
+	je	.L99
+.L103:
+	cmpq	$16384, %rdi
+	jne	.L414
+	movl	144(%rsp), %edi
+	testl	%edi, %edi
+	jne	.L102
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L102:
+	movq	$0, 152(%rsp)
+	movl	$16384, %edx
+	movq	%rbp, %rdi
+	jmp	.L101
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	leaq	17(%rdi), %rax
+	movss	(%r12), %xmm0
+	cmpq	$16384, %rax
+	ja	.L104
+	addq	%rbp, %rdi
+.L105:
+	movb	$32, (%rdi)
+	addq	$1, %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	leaq	1(%rdx), %rax
+	movq	%rdx, 152(%rsp)
+	cmpq	$16384, %rax
+	ja	.L107
+	addq	%rbp, %rdx
+.L108:
+	movb	$10, (%rdx)
+	addq	$1, 152(%rsp)
+	jmp	.L98
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	leaq	.LC2(%rip), %rdi
+	movl	%ecx, 40(%rsp)
+	leaq	.LC2(%rip), %r12
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	movl	40(%rsp), %ecx
+	testq	%rax, %rax
+	movq	%rax, %r14
+	je	.L139
+	movq	%rbx, 40(%rsp)
+	movq	%r12, %rbx
+	movl	%ecx, 48(%rsp)
+	jmp	.L138
+	.p2align 4,,10
+	.p2align 3
+.L416:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L136:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L415
+.L138:
+	cmpq	$16384, %rdx
+	jne	.L416
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L137
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L137:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L136
+	.p2align 4,,10
+	.p2align 3
+.L415:
+	movq	40(%rsp), %rbx
+	movl	48(%rsp), %ecx
+.L139:
+	andl	$1, %ecx
+	leaq	.LC4(%rip), %r8
+	leaq	.LC3(%rip), %rax
+	cmove	%r8, %rax
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	strlen@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L140
+	movq	%rbx, 40(%rsp)
+	movq	152(%rsp), %rdx
+	movq	%r12, %rbx
+	jmp	.L144
+	.p2align 4,,10
+	.p2align 3
+.L418:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L142:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L417
+.L144:
+	cmpq	$16384, %rdx
+	jne	.L418
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L143
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L143:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L142
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	leaq	.LC14(%rip), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	testq	%rax, %rax
+	je	.L245
+	movq	%rbx, 24(%rsp)
+	movq	%r14, %rbx
+	movq	%rax, %r14
+	jmp	.L249
+	.p2align 4,,10
+	.p2align 3
+.L420:
+	movq	%r13, %r12
+	leaq	0(%rbp,%r15), %rdi
+	subq	%r15, %r12
+.L247:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %r15
+	addq	%r12, %r15
+	movq	%r15, 152(%rsp)
+	subq	%r12, %r14
+	je	.L419
+.L249:
+	cmpq	$16384, %r15
+	jne	.L420
+	movl	144(%rsp), %r9d
+	testl	%r9d, %r9d
+	jne	.L248
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L248:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L247
+	.p2align 4,,10
+	.p2align 3
+.L419:
+	movq	24(%rsp), %rbx
+.L245:
+	leaq	17(%r15), %rax
+	movss	40(%rbx), %xmm0
+	leaq	0(%rbp,%r15), %rdi
+	cmpq	$16384, %rax
+	jbe	.L252
+	movl	144(%rsp), %r8d
+	testl	%r8d, %r8d
+	jne	.L253
+	movss	%xmm0, 24(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	24(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L253:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdi
+.L252:
+	movb	$32, (%rdi)
+	addq	$1, %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %r15
+	movq	%r15, 152(%rsp)
+	jmp	.L244
+	.p2align 4,,10
+	.p2align 3
+.L410:
+	leaq	.LC13(%rip), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	testq	%rax, %rax
+	je	.L234
+	movq	%rbx, 24(%rsp)
+	movq	%r14, %rbx
+	movq	%rax, %r14
+	jmp	.L238
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	movq	%r13, %r12
+	leaq	0(%rbp,%r15), %rdi
+	subq	%r15, %r12
+.L236:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %r15
+	addq	%r12, %r15
+	movq	%r15, 152(%rsp)
+	subq	%r12, %r14
+	je	.L421
+.L238:
+	cmpq	$16384, %r15
+	jne	.L422
+	movl	144(%rsp), %r11d
+	testl	%r11d, %r11d
+	jne	.L237
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L237:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L236
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	movq	24(%rsp), %rbx
+.L234:
+	leaq	17(%r15), %rax
+	movss	36(%rbx), %xmm0
+	leaq	0(%rbp,%r15), %rdi
+	cmpq	$16384, %rax
+	jbe	.L241
+	movl	144(%rsp), %r10d
+	testl	%r10d, %r10d
+	jne	.L242
+	movss	%xmm0, 24(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	24(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L242:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdi
+.L241:
+	movb	$32, (%rdi)
+	addq	$1, %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %r15
+	movq	%r15, 152(%rsp)
+	jmp	.L233
+	.p2align 4,,10
+	.p2align 3
+.L409:
+	leaq	.LC12(%rip), %r8
+	movq	%r8, %rdi
+	call	strlen@PLT
+	movq	%rax, %r15
+	testq	%rax, %rax
+	je	.L228
+	leaq	.LC12(%rip), %r8
+	movq	%rbx, 24(%rsp)
+	movq	152(%rsp), %rdx
+	movq	%r8, %rbx
+	jmp	.L232
+	.p2align 4,,10
+	.p2align 3
+.L424:
+	movq	%r13, %r14
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r14
+.L230:
+	cmpq	%r14, %r15
+	movq	%rbx, %rsi
+	cmovbe	%r15, %r14
+	movq	%r14, %rdx
+	addq	%r14, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r14, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r14, %r15
+	je	.L423
+.L232:
+	cmpq	$16384, %rdx
+	jne	.L424
+	movl	144(%rsp), %r14d
+	testl	%r14d, %r14d
+	jne	.L231
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L231:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r14d
+	movq	%rbp, %rdi
+	jmp	.L230
+	.p2align 4,,10
+	.p2align 3
+.L423:
+	movq	24(%rsp), %rbx
+	movl	52(%rbx), %r14d
+.L228:
+	leaq	128(%rsp), %rdi
+	movl	%r14d, %esi
+	call	writeInteger
+	jmp	.L218
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	leaq	.LC11(%rip), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	movq	%rax, %r15
+	testq	%rax, %rax
+	je	.L219
+	movq	%rbx, 24(%rsp)
+	movq	%r14, %rbx
+	jmp	.L223
+	.p2align 4,,10
+	.p2align 3
+.L426:
+	movq	%r13, %r14
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r14
+.L221:
+	cmpq	%r14, %r15
+	movq	%rbx, %rsi
+	cmovbe	%r15, %r14
+	movq	%r14, %rdx
+	addq	%r14, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r14, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r14, %r15
+	je	.L425
+.L223:
+	cmpq	$16384, %rdx
+	jne	.L426
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L222
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L222:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r14d
+	movq	%rbp, %rdi
+	jmp	.L221
+	.p2align 4,,10
+	.p2align 3
+.L425:
+	movq	24(%rsp), %rbx
+.L219:
+	movq	%r12, %r15
+	leaq	36(%rbx), %r12
+	jmp	.L227
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	addq	%rbp, %rdx
+.L225:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	addq	$4, %r15
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	movq	%rdx, 152(%rsp)
+	cmpq	%r12, %r15
+	je	.L207
+.L227:
+	leaq	17(%rdx), %rax
+	movss	(%r15), %xmm0
+	cmpq	$16384, %rax
+	jbe	.L427
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L226
+	movss	%xmm0, 24(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	24(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L226:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L225
+	.p2align 4,,10
+	.p2align 3
+.L195:
+	leaq	.LC10(%rip), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	movq	%rax, %r15
+	testq	%rax, %rax
+	je	.L208
+	movq	%rbx, 24(%rsp)
+	movq	%r14, %rbx
+	jmp	.L212
+	.p2align 4,,10
+	.p2align 3
+.L429:
+	movq	%r13, %r14
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r14
+.L210:
+	cmpq	%r14, %r15
+	movq	%rbx, %rsi
+	cmovbe	%r15, %r14
+	movq	%r14, %rdx
+	addq	%r14, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r14, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r14, %r15
+	je	.L428
+.L212:
+	cmpq	$16384, %rdx
+	jne	.L429
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L211
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L211:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r14d
+	movq	%rbp, %rdi
+	jmp	.L210
+	.p2align 4,,10
+	.p2align 3
+.L428:
+	movq	24(%rsp), %rbx
+.L208:
+	movq	%r12, %r15
+	leaq	24(%rbx), %r12
+	jmp	.L216
+	.p2align 4,,10
+	.p2align 3
+.L430:
+	addq	%rbp, %rdx
+.L214:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	addq	$4, %r15
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	movq	%rdx, 152(%rsp)
+	cmpq	%r15, %r12
+	je	.L196
+.L216:
+	leaq	17(%rdx), %rax
+	movss	(%r15), %xmm0
+	cmpq	$16384, %rax
+	jbe	.L430
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L215
+	movss	%xmm0, 24(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	24(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L215:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L214
+	.p2align 4,,10
+	.p2align 3
+.L408:
+	leaq	.LC9(%rip), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	testq	%rax, %rax
+	je	.L197
+	movq	%rax, %r15
+	jmp	.L201
+	.p2align 4,,10
+	.p2align 3
+.L431:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L199:
+	cmpq	%r12, %r15
+	movq	%r14, %rsi
+	cmovbe	%r15, %r12
+	movq	%r12, %rdx
+	addq	%r12, %r14
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r15
+	je	.L197
+.L201:
+	cmpq	$16384, %rdx
+	jne	.L431
+	movl	144(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L200
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L200:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L199
+	.p2align 4,,10
+	.p2align 3
+.L197:
+	movq	%rbx, %r14
+	leaq	12(%rbx), %r12
+	jmp	.L205
+	.p2align 4,,10
+	.p2align 3
+.L432:
+	addq	%rbp, %rdx
+.L203:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	addq	$4, %r14
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	movq	%rdx, 152(%rsp)
+	cmpq	%r14, %r12
+	je	.L185
+.L205:
+	leaq	17(%rdx), %rax
+	movss	(%r14), %xmm0
+	cmpq	$16384, %rax
+	jbe	.L432
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L204
+	movss	%xmm0, 24(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	24(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L204:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L203
+	.p2align 4,,10
+	.p2align 3
+.L407:
+	leaq	.LC8(%rip), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	testq	%rax, %rax
+	je	.L186
+	movq	%rax, %r15
+	jmp	.L190
+	.p2align 4,,10
+	.p2align 3
+.L433:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L188:
+	cmpq	%r12, %r15
+	movq	%r14, %rsi
+	cmovbe	%r15, %r12
+	movq	%r12, %rdx
+	addq	%r12, %r14
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r15
+	je	.L186
+.L190:
+	cmpq	$16384, %rdx
+	jne	.L433
+	movl	144(%rsp), %esi
+	testl	%esi, %esi
+	jne	.L189
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L189:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L188
+	.p2align 4,,10
+	.p2align 3
+.L186:
+	xorl	%r15d, %r15d
+	jmp	.L194
+	.p2align 4,,10
+	.p2align 3
+.L434:
+	addq	%rbp, %rdx
+.L192:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	movq	%rdx, 152(%rsp)
+	cmpq	$4, %r15
+	je	.L172
+	movl	$4, %r15d
+.L194:
+	leaq	17(%rdx), %rax
+	movss	44(%rbx,%r15), %xmm0
+	cmpq	$16384, %rax
+	jbe	.L434
+	movl	144(%rsp), %ecx
+	testl	%ecx, %ecx
+	jne	.L193
+	movss	%xmm0, 40(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	40(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L193:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L192
+	.p2align 4,,10
+	.p2align 3
+.L406:
+	leaq	.LC7(%rip), %r14
+	movl	60(%rbx), %r15d
+	movq	%r14, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	testq	%rax, %rax
+	je	.L179
+	movq	%rbx, 40(%rsp)
+	movq	%r14, %rbx
+	movq	%rax, %r14
+	jmp	.L178
+	.p2align 4,,10
+	.p2align 3
+.L436:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L176:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L435
+.L178:
+	cmpq	$16384, %rdx
+	jne	.L436
+	movl	144(%rsp), %r8d
+	testl	%r8d, %r8d
+	jne	.L177
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L177:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L435:
+	movq	40(%rsp), %rbx
+.L179:
+	andl	$8, %r15d
+	leaq	.LC4(%rip), %r8
+	leaq	.LC3(%rip), %rax
+	cmove	%r8, %rax
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	strlen@PLT
+	movq	%rax, %r14
+	movq	152(%rsp), %rax
+	testq	%r14, %r14
+	jne	.L183
+	jmp	.L159
+	.p2align 4,,10
+	.p2align 3
+.L437:
+	movq	%r13, %r15
+	leaq	0(%rbp,%rax), %rdi
+	subq	%rax, %r15
+.L181:
+	cmpq	%r15, %r14
+	movq	%r12, %rsi
+	cmovbe	%r14, %r15
+	movq	%r15, %rdx
+	addq	%r15, %r12
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	addq	%r15, %rax
+	movq	%rax, 152(%rsp)
+	subq	%r15, %r14
+	je	.L159
+.L183:
+	cmpq	$16384, %rax
+	jne	.L437
+	movl	144(%rsp), %edi
+	testl	%edi, %edi
+	jne	.L182
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L182:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r15d
+	movq	%rbp, %rdi
+	jmp	.L181
+	.p2align 4,,10
+	.p2align 3
+.L405:
+	movl	60(%rbx), %eax
+	leaq	.LC6(%rip), %r12
+	movq	%r12, %rdi
+	movl	%eax, 40(%rsp)
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L166
+	movq	%rbx, 48(%rsp)
+	movq	%r12, %rbx
+	jmp	.L165
+	.p2align 4,,10
+	.p2align 3
+.L439:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L163:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L438
+.L165:
+	cmpq	$16384, %rdx
+	jne	.L439
+	movl	144(%rsp), %r10d
+	testl	%r10d, %r10d
+	jne	.L164
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L164:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L163
+	.p2align 4,,10
+	.p2align 3
+.L438:
+	movq	48(%rsp), %rbx
+.L166:
+	testb	$4, 40(%rsp)
+	leaq	.LC4(%rip), %r8
+	leaq	.LC3(%rip), %rax
+	cmove	%r8, %rax
+	movq	%rax, %rdi
+	movq	%rax, %r14
+	call	strlen@PLT
+	testq	%rax, %rax
+	je	.L146
+	movq	%rbx, 40(%rsp)
+	movq	152(%rsp), %rdx
+	movq	%r14, %rbx
+	movq	%rax, %r14
+	jmp	.L170
+	.p2align 4,,10
+	.p2align 3
+.L441:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L168:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L440
+.L170:
+	cmpq	$16384, %rdx
+	jne	.L441
+	movl	144(%rsp), %r9d
+	testl	%r9d, %r9d
+	jne	.L169
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L169:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L168
+	.p2align 4,,10
+	.p2align 3
+.L404:
+	movl	60(%rbx), %eax
+	leaq	.LC5(%rip), %r12
+	movq	%r12, %rdi
+	movl	%eax, 40(%rsp)
+	call	strlen@PLT
+	movq	152(%rsp), %rdx
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L153
+	movq	%rbx, 48(%rsp)
+	movq	%r12, %rbx
+	jmp	.L152
+	.p2align 4,,10
+	.p2align 3
+.L443:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L150:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L442
+.L152:
+	cmpq	$16384, %rdx
+	jne	.L443
+	movl	144(%rsp), %r12d
+	testl	%r12d, %r12d
+	jne	.L151
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L151:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L442:
+	movq	48(%rsp), %rbx
+.L153:
+	testb	$2, 40(%rsp)
+	leaq	.LC4(%rip), %r8
+	leaq	.LC3(%rip), %rax
+	cmove	%r8, %rax
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	strlen@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L132
+	movq	%rbx, 40(%rsp)
+	movq	152(%rsp), %rdx
+	movq	%r12, %rbx
+	jmp	.L157
+	.p2align 4,,10
+	.p2align 3
+.L445:
+	movq	%r13, %r12
+	leaq	0(%rbp,%rdx), %rdi
+	subq	%rdx, %r12
+.L155:
+	cmpq	%r12, %r14
+	movq	%rbx, %rsi
+	cmovbe	%r14, %r12
+	movq	%r12, %rdx
+	addq	%r12, %rbx
+	call	memcpy@PLT
+	movq	152(%rsp), %rdx
+	addq	%r12, %rdx
+	movq	%rdx, 152(%rsp)
+	subq	%r12, %r14
+	je	.L444
+.L157:
+	cmpq	$16384, %rdx
+	jne	.L445
+	movl	144(%rsp), %r11d
+	testl	%r11d, %r11d
+	jne	.L156
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L156:
+	movq	$0, 152(%rsp)
+	movl	$16384, %r12d
+	movq	%rbp, %rdi
+	jmp	.L155
+	.p2align 4,,10
+	.p2align 3
+.L444:
+	movq	40(%rsp), %rbx
+	jmp	.L132
+	.p2align 4,,10
+	.p2align 3
+.L440:
+	movq	40(%rsp), %rbx
+	jmp	.L146
+	.p2align 4,,10
+	.p2align 3
+.L417:
+	movq	40(%rsp), %rbx
+	jmp	.L140
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	movl	144(%rsp), %ecx
+	testl	%ecx, %ecx
+	jne	.L109
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L109:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L108
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	movl	144(%rsp), %esi
+	testl	%esi, %esi
+	jne	.L106
+	movss	%xmm0, 8(%rsp)
+	movq	%rdi, %rdx
+	movq	%rbp, %rsi
+	movq	136(%rsp), %rdi
+	call	*128(%rsp)
+	movss	8(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L106:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdi
+	jmp	.L105
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	movq	(%rsp), %rax
+	movq	(%rax), %r12
+	movq	%r12, %rdi
+	call	strlen@PLT
+	movq	152(%rsp), %rdi
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L83
+	jmp	.L79
+	.p2align 4,,10
+	.p2align 3
+.L446:
+	movq	%r13, %rbx
+	subq	%rdi, %rbx
+	addq	%rbp, %rdi
+.L81:
+	cmpq	%rbx, %r14
+	movq	%r12, %rsi
+	cmovbe	%r14, %rbx
+	movq	%rbx, %rdx
+	addq	%rbx, %r12
+	call	memcpy@PLT
+	movq	152(%rsp), %rdi
+	addq	%rbx, %rdi
+	movq	%rdi, 152(%rsp)
+	subq	%rbx, %r14
+	je	.L79
+.L83:
+	cmpq	$16384, %rdi
+	jne	.L446
+	movl	144(%rsp), %ebx
+	testl	%ebx, %ebx
+	jne	.L82
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L82:
+	movq	$0, 152(%rsp)
+	movl	$16384, %ebx
+	movq	%rbp, %rdi
+	jmp	.L81
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	leaq	17(%rdi), %rax
+	movss	(%r15), %xmm0
+	leaq	0(%rbp,%rdi), %rdx
+	cmpq	$16384, %rax
+	jbe	.L85
+	movl	144(%rsp), %r11d
+	testl	%r11d, %r11d
+	jne	.L86
+	movss	%xmm0, 8(%rsp)
+	movq	%rdi, %rdx
+	movq	%rbp, %rsi
+	movq	136(%rsp), %rdi
+	call	*128(%rsp)
+	movss	8(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L86:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+.L85:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	movss	4(%r15), %xmm0
+	leaq	1(%rdx,%rax), %rdx
+	leaq	17(%rdx), %rax
+	movq	%rdx, 152(%rsp)
+	cmpq	$16384, %rax
+	ja	.L87
+	addq	%rbp, %rdx
+.L88:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	movss	8(%r15), %xmm0
+	leaq	1(%rdx,%rax), %rdx
+	leaq	17(%rdx), %rax
+	movq	%rdx, 152(%rsp)
+	cmpq	$16384, %rax
+	ja	.L90
+	addq	%rbp, %rdx
+.L91:
+	movb	$32, (%rdx)
+	leaq	1(%rdx), %rdi
+	call	formatWavefrontFloat@PLT
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	leaq	1(%rdx), %rax
+	movq	%rdx, 152(%rsp)
+	cmpq	$16384, %rax
+	ja	.L93
+	addq	%rbp, %rdx
+.L94:
+	movb	$10, (%rdx)
+	addq	$1, 152(%rsp)
+	jmp	.L78
+	.p2align 4,,10
+	.p2align 3
+.L411:
+	movq	24(%rsp), %rbx
+	movl	56(%rbx), %r14d
+.L255:
+	leaq	1(%r15), %rax
+	movl	%r14d, %ebx
+	cmpq	$16384, %rax
+	ja	.L260
+	addq	%rbp, %r15
+.L261:
+	movb	%bl, (%r15)
+	movq	152(%rsp), %rax
+	leaq	1(%rax), %r15
+	movq	%r15, 152(%rsp)
+	jmp	.L129
+.L93:
+	movl	144(%rsp), %r8d
+	testl	%r8d, %r8d
+	jne	.L95
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L95:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L94
+.L90:
+	movl	144(%rsp), %r9d
+	testl	%r9d, %r9d
+	jne	.L92
+	movss	%xmm0, 8(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	8(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L92:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L91
+.L87:
+	movl	144(%rsp), %r10d
+	testl	%r10d, %r10d
+	jne	.L89
+	movss	%xmm0, 8(%rsp)
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movss	8(%rsp), %xmm0
+	movl	%eax, 144(%rsp)
+.L89:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L88
+.L260:
+	movl	144(%rsp), %esi
+	testl	%esi, %esi
+	jne	.L262
+	movq	136(%rsp), %rdi
+	movq	%r15, %rdx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L262:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %r15
+	jmp	.L261
+.L74:
+	movl	144(%rsp), %r12d
+	testl	%r12d, %r12d
+	jne	.L76
+	movq	136(%rsp), %rdi
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L76:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rbx
+	jmp	.L75
+.L401:
+	leaq	.LC1(%rip), %r12
+	movq	%r12, %rdi
+	call	strlen@PLT
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L112
+	movq	152(%rsp), %rax
+	jmp	.L116
+	.p2align 4,,10
+	.p2align 3
+.L448:
+	movq	%r13, %rbx
+	leaq	0(%rbp,%rax), %rdi
+	subq	%rax, %rbx
+.L114:
+	cmpq	%rbx, %r14
+	movq	%r12, %rsi
+	cmovbe	%r14, %rbx
+	movq	%rbx, %rdx
+	addq	%rbx, %r12
+	call	memcpy@PLT
+	movq	152(%rsp), %rax
+	addq	%rbx, %rax
+	movq	%rax, 152(%rsp)
+	subq	%rbx, %r14
+	je	.L447
+.L116:
+	cmpq	$16384, %rax
+	jne	.L448
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L115
+	movq	136(%rsp), %rdi
+	movl	$16384, %edx
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L115:
+	movq	$0, 152(%rsp)
+	movl	$16384, %ebx
+	movq	%rbp, %rdi
+	jmp	.L114
+.L447:
+	movq	16(%rsp), %rax
+	movl	128(%rax), %ebx
+.L112:
+	leaq	128(%rsp), %rdi
+	movl	%ebx, %esi
+	call	writeInteger
+	movq	152(%rsp), %rdx
+	leaq	1(%rdx), %rax
+	cmpq	$16384, %rax
+	ja	.L117
+	addq	%rbp, %rdx
+.L118:
+	movb	$10, (%rdx)
+	addq	$1, 152(%rsp)
+	jmp	.L111
+.L398:
+	leaq	1(%rbx), %rax
+	cmpq	$16384, %rax
+	ja	.L62
+	addq	%rbp, %rbx
+.L63:
+	movb	$10, (%rbx)
+	movq	152(%rsp), %rax
+	leaq	1(%rax), %rbx
+	movq	%rbx, 152(%rsp)
+	jmp	.L61
+.L397:
+	movq	32(%rsp), %rsi
+	addl	$1, 60(%rsp)
+	movl	60(%rsp), %ecx
+	cmpl	8(%rsi), %ecx
+	jb	.L56
+	movq	152(%rsp), %rdx
+	testq	%rdx, %rdx
+	je	.L57
+.L276:
+	movq	136(%rsp), %rdi
+	leaq	160(%rsp), %rsi
+	call	*128(%rsp)
+.L54:
+	addq	$16552, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L117:
+	.cfi_restore_state
+	movl	144(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L119
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	*128(%rsp)
+	movl	%eax, 144(%rsp)
+.L119:
+	movq	$0, 152(%rsp)
+	movq	%rbp, %rdx
+	jmp	.L118
+.L62:
+	movq	%rbx, %rdx
+	movq	136(%rsp), %rdi
+	movq	%rbp, %rsi
+	movq	%rbp, %rbx
+	call	*128(%rsp)
+	movq	$0, 152(%rsp)
+	movl	%eax, 144(%rsp)
+	movq	32(%rsp), %rax
+	addq	(%rax), %r12
+	movq	%r12, 16(%rsp)
+	jmp	.L63
+.L60:
+	testl	%eax, %eax
+	jne	.L54
+	movq	152(%rsp), %rdx
+	testq	%rdx, %rdx
+	jne	.L276
+.L57:
+	xorl	%eax, %eax
+	jmp	.L54
+.L277:
+	movl	$2, %eax
+	jmp	.L54
+	.cfi_endproc
+.LFE23:
+	.size	writeWavefrontMTL, .-writeWavefrontMTL
+	.p2align 4
+	.globl	writeWavefrontMTLToBuffer
+	.type	writeWavefrontMTLToBuffer, @function
+writeWavefrontMTLToBuffer:
+.LFB25:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdx, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+	movq	%rsi, (%rsp)
+	leaq	writeToBuffer(%rip), %rsi
+	movq	%rdx, 8(%rsp)
+	movq	%rsp, %rdx
+	movq	$0, 16(%rsp)
+	call	writeWavefrontMTL
+	movq	16(%rsp), %rdx
+	movq	%rdx, 0(%rbp)
+	testl	%eax, %eax
+	jne	.L449
+	xorl	%eax, %eax
+	cmpq	%rdx, %rbx
+	setb	%al
+	addl	%eax, %eax
+.L449:
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	writeWavefrontMTLToBuffer, .-writeWavefrontMTLToBuffer
+	.section	.rodata.str1.1
+.LC17:
+	.string	"wb"
+	.text
+	.p2align 4
+	.globl	writeWavefrontMTLToFile
+	.type	writeWavefrontMTLToFile, @function
+writeWavefrontMTLToFile:
+.LFB27:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	testq	%rsi, %rsi
+	je	.L455
+	movq	%rdi, %rbp
+	movq	%rsi, %rdi
+	leaq	.LC17(%rip), %rsi
+	call	fopen@PLT
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L455
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	leaq	writeToFile(%rip), %rsi
+	call	writeWavefrontMTL
+	movq	%rbx, %rdi
+	movl	%eax, %ebp
+	call	fclose@PLT
+	testl	%eax, %eax
+	je	.L452
+	testl	%ebp, %ebp
+	jne	.L452
+.L455:
+	movl	$2, %ebp
+.L452:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movl	%ebp, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	writeWavefrontMTLToFile, .-writeWavefrontMTLToFile
+	.section	.rodata.str1.1
+.LC18:
+	.string	"map_Ka"
+.LC19:
+	.string	"map_Kd"
+.LC20:
+	.string	"norm"
+.LC21:
+	.string	"map_Ks"
+.LC22:
+	.string	"map_Ns"
+.LC23:
+	.string	"map_d"
+.LC24:
+	.string	"map_Bump"
+.LC25:
+	.string	"disp"
+.LC26:
+	.string	"decal"
+.LC27:
+	.string	"refl -type sphere"
+.LC28:
+	.string	"refl -type cube_top"
+.LC29:
+	.string	"refl -type cube_bottom"
+.LC30:
+	.string	"refl -type cube_front"
+.LC31:
+	.string	"refl -type cube_back"
+.LC32:
+	.string	"refl -type cube_left"
+.LC33:
+	.string	"refl -type cube_right"
+.LC34:
+	.string	"map_Pr"
+.LC35:
+	.string	"map_Pm"
+.LC36:
+	.string	"map_Ps"
+.LC37:
+	.string	"map_Ke"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	mapKeywords, @object
+	.size	mapKeywords, 160
+mapKeywords:
+	.quad	.LC18
+	.quad	.LC19
+	.quad	.LC20
+	.quad	.LC21
+	.quad	.LC22
+	.quad	.LC23
+	.quad	.LC24
+	.quad	.LC25
+	.quad	.LC26
+	.quad	.LC27
+	.quad	.LC28
+	.quad	.LC29
+	.quad	.LC30
+	.quad	.LC31
+	.quad	.LC32
+	.quad	.LC33
+	.quad	.LC34
+	.quad	.LC35
+	.quad	.LC36
+	.quad	.LC37
+	.section	.rodata.str1.1
+.LC38:
+	.string	"Ns"
+.LC39:
+	.string	"Ni"
+.LC40:
+	.string	"d"
+.LC41:
+	.string	"Pr"
+.LC42:
+	.string	"Pm"
+.LC43:
+	.string	"Ps"
+.LC44:
+	.string	"Pc"
+.LC45:
+	.string	"Pcr"
+.LC46:
+	.string	"aniso"
+.LC47:
+	.string	"anisor"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	scalars, @object
+	.size	scalars, 160
+scalars:
+	.quad	.LC38
+	.quad	88
+	.quad	.LC39
+	.quad	96
+	.quad	.LC40
+	.quad	92
+	.quad	.LC41
+	.quad	100
+	.quad	.LC42
+	.quad	104
+	.quad	.LC43
+	.quad	108
+	.quad	.LC44
+	.quad	112
+	.quad	.LC45
+	.quad	116
+	.quad	.LC46
+	.quad	120
+	.quad	.LC47
+	.quad	124
+	.section	.rodata.str1.1
+.LC48:
+	.string	"Ka"
+.LC49:
+	.string	"Kd"
+.LC50:
+	.string	"Ks"
+.LC51:
+	.string	"Ke"
+.LC52:
+	.string	"Tf"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	colors, @object
+	.size	colors, 80
+colors:
+	.quad	.LC48
+	.quad	8
+	.quad	.LC49
+	.quad	24
+	.quad	.LC50
+	.quad	40
+	.quad	.LC51
+	.quad	72
+	.quad	.LC52
+	.quad	56
+	.section	.note.GNU-stack,"",@progbits
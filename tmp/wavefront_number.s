@@ -0,0 +1,3430 @@
+	.file	"wavefront_number.c"
+	.text
+	.p2align 4
+	.type	bigMultiplyPow5, @function
+bigMultiplyPow5:
+.LFB7:
+	.cfi_startproc
+	movq	%rdi, %r9
+	movl	%esi, %edi
+	cmpl	$12, %esi
+	jle	.L2
+	movl	512(%r9), %r8d
+	testl	%r8d, %r8d
+	jle	.L3
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	movslq	%r8d, %r10
+	movq	%r9, %rdx
+	xorl	%eax, %eax
+	leaq	(%r9,%r10,4), %rsi
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movl	(%rdx), %ecx
+	addq	$4, %rdx
+	imulq	$1220703125, %rcx, %rcx
+	addq	%rcx, %rax
+	movl	%eax, -4(%rdx)
+	shrq	$32, %rax
+	cmpq	%rsi, %rdx
+	jne	.L4
+	cmpl	$128, %r8d
+	je	.L5
+	testq	%rax, %rax
+	je	.L5
+	addl	$1, %r8d
+	movl	%r8d, 512(%r9)
+	movl	%eax, (%r9,%r10,4)
+.L5:
+	subl	$13, %edi
+	cmpl	$12, %edi
+	jg	.L6
+.L2:
+	testl	%edi, %edi
+	jle	.L1
+	cmpl	$1, %edi
+	je	.L19
+	cmpl	$2, %edi
+	je	.L20
+	cmpl	$3, %edi
+	je	.L21
+	cmpl	$4, %edi
+	je	.L22
+	cmpl	$5, %edi
+	je	.L23
+	cmpl	$6, %edi
+	je	.L24
+	cmpl	$7, %edi
+	je	.L25
+	cmpl	$8, %edi
+	je	.L26
+	cmpl	$9, %edi
+	je	.L27
+	cmpl	$10, %edi
+	je	.L28
+	cmpl	$12, %edi
+	movl	$48828125, %esi
+	movl	$244140625, %eax
+	cmove	%rax, %rsi
+.L16:
+	movl	512(%r9), %r8d
+	testl	%r8d, %r8d
+	jle	.L1
+	movslq	%r8d, %r10
+	movq	%r9, %rdx
+	xorl	%eax, %eax
+	leaq	(%r9,%r10,4), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	movl	(%rdx), %ecx
+	addq	$4, %rdx
+	imulq	%rsi, %rcx
+	addq	%rcx, %rax
+	movl	%eax, -4(%rdx)
+	shrq	$32, %rax
+	cmpq	%rdx, %rdi
+	jne	.L18
+	testq	%rax, %rax
+	je	.L1
+	cmpl	$128, %r8d
+	je	.L1
+	addl	$1, %r8d
+	movl	%r8d, 512(%r9)
+	movl	%eax, (%r9,%r10,4)
+.L1:
+	ret
+.L3:
+	leal	-13(%rsi), %eax
+	cmpl	$12, %eax
+	jle	.L48
+	leal	-26(%rdi), %ecx
+	imulq	$1321528399, %rcx, %rcx
+	shrq	$34, %rcx
+	addl	$1, %ecx
+	cmpl	$51, %eax
+	jle	.L7
+	movd	%edi, %xmm3
+	movl	%ecx, %esi
+	movdqa	.LC1(%rip), %xmm2
+	xorl	%edx, %edx
+	pshufd	$0, %xmm3, %xmm0
+	paddd	.LC0(%rip), %xmm0
+	shrl	$2, %esi
+.L8:
+	addl	$1, %edx
+	movdqa	%xmm0, %xmm1
+	paddd	%xmm2, %xmm0
+	cmpl	%esi, %edx
+	jne	.L8
+	testb	$3, %cl
+	je	.L11
+	andl	$-4, %ecx
+	imull	$-13, %ecx, %edx
+	addl	%edx, %eax
+.L7:
+	leal	-13(%rax), %edi
+	cmpl	$12, %edi
+	jle	.L2
+	leal	-26(%rax), %edi
+	subl	$39, %eax
+	cmpl	$12, %edi
+	cmovg	%eax, %edi
+	jmp	.L2
+.L23:
+	movl	$3125, %esi
+	jmp	.L16
+.L19:
+	movl	$5, %esi
+	jmp	.L16
+.L20:
+	movl	$25, %esi
+	jmp	.L16
+.L48:
+	movl	%eax, %edi
+	jmp	.L2
+.L21:
+	movl	$125, %esi
+	jmp	.L16
+.L22:
+	movl	$625, %esi
+	jmp	.L16
+.L24:
+	movl	$15625, %esi
+	jmp	.L16
+.L25:
+	movl	$78125, %esi
+	jmp	.L16
+.L26:
+	movl	$390625, %esi
+	jmp	.L16
+.L28:
+	movl	$9765625, %esi
+	jmp	.L16
+.L27:
+	movl	$1953125, %esi
+	jmp	.L16
+.L11:
+	paddd	.LC2(%rip), %xmm1
+	pshufd	$255, %xmm1, %xmm0
+	movd	%xmm0, %edi
+	jmp	.L2
+	.cfi_endproc
+.LFE7:
+	.size	bigMultiplyPow5, .-bigMultiplyPow5
+	.p2align 4
+	.type	bigShiftLeft, @function
+bigShiftLeft:
+.LFB8:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	512(%rdi), %edx
+	testl	%edx, %edx
+	je	.L49
+	movl	%esi, %r10d
+	movl	%esi, %edi
+	andl	$31, %r10d
+	je	.L53
+	testl	%edx, %edx
+	jle	.L53
+	movl	$32, %r11d
+	movslq	%edx, %r12
+	movq	%rbp, %rsi
+	xorl	%r8d, %r8d
+	subl	%r10d, %r11d
+	leaq	0(%rbp,%r12,4), %rbx
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	movl	(%rsi), %eax
+	movl	%r8d, %r9d
+	movl	%r11d, %ecx
+	addq	$4, %rsi
+	movl	%eax, %r8d
+	shrl	%cl, %r8d
+	movl	%r10d, %ecx
+	sall	%cl, %eax
+	orl	%r9d, %eax
+	movl	%eax, -4(%rsi)
+	cmpq	%rsi, %rbx
+	jne	.L55
+	cmpl	$128, %edx
+	je	.L53
+	testl	%r8d, %r8d
+	je	.L53
+	addl	$1, %edx
+	movl	%edx, 512(%rbp)
+	movl	%r8d, 0(%rbp,%r12,4)
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	movl	%edi, %ebx
+	sarl	$5, %ebx
+	je	.L49
+	leal	(%rbx,%rdx), %ecx
+	movl	$128, %eax
+	movq	%rbp, %rsi
+	subl	%edx, %eax
+	cmpl	$128, %ecx
+	movslq	%edx, %rdx
+	cmovg	%eax, %ebx
+	salq	$2, %rdx
+	movslq	%ebx, %r12
+	salq	$2, %r12
+	leaq	0(%rbp,%r12), %rdi
+	call	memmove@PLT
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	memset@PLT
+	addl	%ebx, 512(%rbp)
+.L49:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	bigShiftLeft, .-bigShiftLeft
+	.p2align 4
+	.type	compareMidpoint, @function
+compareMidpoint:
+.LFB11:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$-150, %r11d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	andl	$8388607, %r12d
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$1064, %rsp
+	.cfi_def_cfa_offset 1120
+	shrl	$23, %esi
+	je	.L70
+	orl	$8388608, %r12d
+	leal	-151(%rsi), %r11d
+.L70:
+	movq	24(%rdi), %rcx
+	movq	32(%rdi), %r9
+	movl	$0, 512(%rsp)
+	movl	8(%rdi), %ebp
+	addl	12(%rdi), %ebp
+	cmpq	%r9, %rcx
+	jnb	.L104
+	xorl	%ebx, %ebx
+	movl	$1, %edi
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	movl	$1, %r13d
+	jmp	.L84
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	cmpb	$48, %dl
+	je	.L72
+.L74:
+	leal	(%rdi,%rdi,4), %edi
+	leal	(%rax,%rax,4), %eax
+	addl	$1, %esi
+	addl	%edi, %edi
+	leal	-48(%rdx,%rax,2), %eax
+	cmpl	$1000000000, %edi
+	je	.L135
+.L72:
+	addq	$1, %rcx
+	cmpq	%r9, %rcx
+	je	.L136
+.L84:
+	movsbl	(%rcx), %edx
+	leal	-48(%rdx), %r8d
+	cmpb	$9, %r8b
+	ja	.L72
+	testl	%esi, %esi
+	je	.L137
+	cmpl	$800, %esi
+	jne	.L74
+	cmpb	$48, %dl
+	cmovne	%r13d, %ebx
+	addq	$1, %rcx
+	cmpq	%r9, %rcx
+	jne	.L84
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	cmpl	$1, %edi
+	jbe	.L92
+	movl	512(%rsp), %ecx
+	testl	%ecx, %ecx
+	jle	.L90
+	movq	%rsp, %r8
+	movslq	%ecx, %r13
+	xorl	%edx, %edx
+	leaq	(%r8,%r13,4), %r10
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	movl	(%r8), %r9d
+	addq	$4, %r8
+	imulq	%rdi, %r9
+	addq	%r9, %rdx
+	movl	%edx, -4(%r8)
+	shrq	$32, %rdx
+	cmpq	%r8, %r10
+	jne	.L87
+	testq	%rdx, %rdx
+	je	.L90
+	cmpl	$128, %ecx
+	je	.L90
+	addl	$1, %ecx
+	movl	%edx, (%rsp,%r13,4)
+	movl	%ecx, 512(%rsp)
+.L90:
+	testl	%eax, %eax
+	je	.L92
+	movq	%rsp, %rdi
+	xorl	%r8d, %r8d
+	jmp	.L91
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	movl	(%rdi), %edx
+	addl	$1, %r8d
+	addq	$4, %rdi
+	leal	(%rdx,%rax), %r9d
+	addq	%rax, %rdx
+	movl	$1, %eax
+	movl	%r9d, -4(%rdi)
+	shrq	$32, %rdx
+	je	.L92
+.L91:
+	cmpl	%ecx, %r8d
+	jl	.L93
+	cmpl	$128, %ecx
+	jne	.L138
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	movl	%ebp, %r13d
+	subl	%esi, %r13d
+.L71:
+	movl	$1, 1040(%rsp)
+	leal	1(%r12,%r12), %eax
+	movl	%eax, 528(%rsp)
+	testl	%r13d, %r13d
+	js	.L94
+	movq	%rsp, %rdi
+	movl	%r13d, %esi
+	call	bigMultiplyPow5
+.L95:
+	cmpl	%r13d, %r11d
+	jge	.L96
+	movl	%r13d, %esi
+	movq	%rsp, %rdi
+	subl	%r11d, %esi
+	call	bigShiftLeft
+	movl	512(%rsp), %eax
+	cmpl	1040(%rsp), %eax
+	je	.L98
+.L139:
+	setg	%al
+	movzbl	%al, %eax
+	leal	-1(%rax,%rax), %eax
+.L69:
+	addq	$1064, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	.cfi_restore_state
+	movl	512(%rsp), %r10d
+	testl	%r10d, %r10d
+	jle	.L79
+	movq	%rsp, %rdi
+	movslq	%r10d, %r14
+	xorl	%r15d, %r15d
+	leaq	(%rdi,%r14,4), %r8
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	movl	(%rdi), %edx
+	addq	$4, %rdi
+	imulq	$1000000000, %rdx, %rdx
+	addq	%r15, %rdx
+	movl	%edx, -4(%rdi)
+	shrq	$32, %rdx
+	movq	%rdx, %r15
+	cmpq	%rdi, %r8
+	jne	.L76
+	cmpl	$128, %r10d
+	je	.L79
+	testq	%rdx, %rdx
+	je	.L79
+	addl	$1, %r10d
+	movl	%edx, (%rsp,%r14,4)
+	movl	%r10d, 512(%rsp)
+.L79:
+	testl	%eax, %eax
+	je	.L81
+	movq	%rsp, %rdi
+	xorl	%r8d, %r8d
+	jmp	.L80
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	movl	(%rdi), %edx
+	addl	$1, %r8d
+	addq	$4, %rdi
+	leal	(%rdx,%rax), %r14d
+	addq	%rax, %rdx
+	movl	$1, %eax
+	movl	%r14d, -4(%rdi)
+	shrq	$32, %rdx
+	je	.L81
+.L80:
+	cmpl	%r10d, %r8d
+	jl	.L82
+	cmpl	$128, %r10d
+	je	.L81
+	leal	1(%r10), %edx
+	movslq	%r10d, %r10
+	movl	%edx, 512(%rsp)
+	movl	%eax, (%rsp,%r10,4)
+.L81:
+	movl	$1, %edi
+	xorl	%eax, %eax
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	movl	%r11d, %esi
+	leaq	528(%rsp), %r8
+	subl	%r13d, %esi
+	movq	%r8, %rdi
+	call	bigShiftLeft
+	movl	512(%rsp), %eax
+	cmpl	1040(%rsp), %eax
+	jne	.L139
+.L98:
+	subl	$1, %eax
+	js	.L100
+	cltq
+	movq	%rsp, %rdi
+	leaq	528(%rsp), %r8
+	jmp	.L102
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	subq	$1, %rax
+	testl	%eax, %eax
+	js	.L100
+.L102:
+	movl	(%rdi,%rax,4), %edx
+	movl	(%r8,%rax,4), %ecx
+	cmpl	%ecx, %edx
+	je	.L101
+	cmpl	%edx, %ecx
+	sbbl	%eax, %eax
+	andl	$2, %eax
+	subl	$1, %eax
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	leaq	528(%rsp), %r8
+	subl	%ebp, %esi
+	movq	%r8, %rdi
+	call	bigMultiplyPow5
+	jmp	.L95
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	xorl	%eax, %eax
+	testl	%ebx, %ebx
+	setne	%al
+	jmp	.L69
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	leal	1(%rcx), %edx
+	movslq	%ecx, %rcx
+	movl	%edx, 512(%rsp)
+	movl	%eax, (%rsp,%rcx,4)
+	jmp	.L92
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	movl	%ebp, %r13d
+	xorl	%ebx, %ebx
+	xorl	%esi, %esi
+	jmp	.L71
+	.cfi_endproc
+.LFE11:
+	.size	compareMidpoint, .-compareMidpoint
+	.p2align 4
+	.type	eiselLemire, @function
+eiselLemire:
+.LFB4:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movq	%rdx, %rdi
+	testq	%rax, %rax
+	je	.L159
+	cmpl	$-65, %esi
+	jl	.L159
+	cmpl	$38, %esi
+	jle	.L142
+	movl	$2139095040, %eax
+	movl	%eax, (%rdi)
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	movq	%rax, %rcx
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rax, %rdx
+	shrq	$32, %rcx
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	je	.L168
+	movl	$16, %ecx
+	xorl	%r8d, %r8d
+.L144:
+	movq	%rdx, %rbx
+	shrq	$48, %rbx
+	jne	.L145
+	salq	$16, %rdx
+	movl	%ecx, %r8d
+.L145:
+	movq	%rdx, %rcx
+	shrq	$56, %rcx
+	jne	.L146
+	addl	$8, %r8d
+	salq	$8, %rdx
+.L146:
+	movq	%rdx, %rbx
+	shrq	$60, %rbx
+	jne	.L147
+	addl	$4, %r8d
+	salq	$4, %rdx
+.L147:
+	movq	%rdx, %rcx
+	shrq	$62, %rcx
+	jne	.L148
+	addl	$2, %r8d
+	salq	$2, %rdx
+.L148:
+	notq	%rdx
+	leal	65(%rsi), %r11d
+	shrq	$63, %rdx
+	movslq	%r11d, %r11
+	addl	%edx, %r8d
+	salq	$4, %r11
+	leaq	powersOfFive(%rip), %rdx
+	movl	%r8d, %ecx
+	addq	%rdx, %r11
+	movq	(%r11), %rbx
+	salq	%cl, %rax
+	movl	%eax, %ecx
+	shrq	$32, %rax
+	movl	%ebx, %ebp
+	movq	%rcx, %r12
+	shrq	$32, %rbx
+	movq	%rcx, %rdx
+	imulq	%rbp, %r12
+	imulq	%rbx, %rdx
+	imulq	%rax, %rbp
+	movq	%r12, %r10
+	imulq	%rax, %rbx
+	movl	%r12d, %r12d
+	movl	%edx, %r9d
+	shrq	$32, %r10
+	addq	%r9, %r10
+	shrq	$32, %rdx
+	movl	%ebp, %r9d
+	shrq	$32, %rbp
+	addq	%r9, %r10
+	addq	%rbp, %rdx
+	movq	%r10, %r9
+	shrq	$32, %r10
+	addq	%rbx, %rdx
+	salq	$32, %r9
+	addq	%r10, %rdx
+	orq	%r12, %r9
+	movabsq	$274877906943, %r10
+	movq	%rdx, %rbx
+	andq	%r10, %rbx
+	cmpq	%r10, %rbx
+	je	.L169
+.L150:
+	imull	$217706, %esi, %eax
+	movq	%rdx, %r11
+	movq	%rdx, %r10
+	shrq	$63, %r11
+	leal	38(%r11), %ecx
+	sarl	$16, %eax
+	shrq	%cl, %r10
+	leal	63(%rax,%r11), %eax
+	subl	%r8d, %eax
+	leal	127(%rax), %r8d
+	testl	%r8d, %r8d
+	jle	.L170
+	cmpq	$1, %r9
+	jbe	.L171
+.L156:
+	addq	$1, %r10
+	movq	%r10, %rdx
+	shrq	%rdx
+	andq	$-8388609, %rdx
+	cmpq	$33554431, %r10
+	jbe	.L158
+	leal	128(%rax), %r8d
+	xorl	%edx, %edx
+.L158:
+	movl	%r8d, %eax
+	sall	$23, %eax
+	orl	%edx, %eax
+	cmpl	$255, %r8d
+	movl	$2139095040, %edx
+	cmovge	%edx, %eax
+.L141:
+	movl	%eax, (%rdi)
+	movl	$1, %eax
+.L140:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L159:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	xorl	%eax, %eax
+	movl	%eax, (%rdi)
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L168:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	salq	$32, %rdx
+	movl	$48, %ecx
+	movl	$32, %r8d
+	jmp	.L144
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	movl	$1, %ecx
+	xorl	%eax, %eax
+	subl	%r8d, %ecx
+	cmpl	$63, %ecx
+	jg	.L141
+	shrq	%cl, %r10
+	xorl	%eax, %eax
+	addq	$1, %r10
+	movq	%r10, %rdx
+	shrq	%rdx
+	cmpq	$16777215, %r10
+	seta	%al
+	andl	$8388607, %edx
+	sall	$23, %eax
+	orl	%edx, %eax
+	jmp	.L141
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	addl	$17, %esi
+	cmpl	$27, %esi
+	ja	.L156
+	movq	%r10, %rsi
+	andl	$3, %esi
+	cmpq	$1, %rsi
+	jne	.L156
+	movq	%r10, %rsi
+	salq	%cl, %rsi
+	movq	%r10, %rcx
+	andq	$-2, %rcx
+	cmpq	%rdx, %rsi
+	cmove	%rcx, %r10
+	jmp	.L156
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	movq	8(%r11), %r11
+	movq	%rcx, %r10
+	movq	%rax, %rbx
+	movl	%r11d, %ebp
+	shrq	$32, %r11
+	imulq	%r11, %r10
+	imulq	%rbp, %rcx
+	imulq	%rbp, %rbx
+	imulq	%r11, %rax
+	movl	%r10d, %ebp
+	shrq	$32, %r10
+	shrq	$32, %rcx
+	addq	%rbp, %rcx
+	movl	%ebx, %ebp
+	shrq	$32, %rbx
+	addq	%rbp, %rcx
+	addq	%rbx, %r10
+	shrq	$32, %rcx
+	addq	%rax, %r10
+	leaq	(%rcx,%r10), %rax
+	addq	%r9, %rax
+	movq	%rax, %r9
+	jc	.L172
+	cmpq	$-1, %rax
+	jne	.L150
+	leal	27(%rsi), %ecx
+	xorl	%eax, %eax
+	cmpl	$82, %ecx
+	ja	.L140
+	imull	$217706, %esi, %esi
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	leal	38(%rax), %ecx
+	sarl	$16, %esi
+	shrq	%cl, %rdx
+	leal	63(%rsi,%rax), %eax
+	movq	%rdx, %r10
+	subl	%r8d, %eax
+	leal	127(%rax), %r8d
+	jmp	.L156
+	.p2align 4,,10
+	.p2align 3
+.L172:
+	addq	$1, %rdx
+	jmp	.L150
+	.cfi_endproc
+.LFE4:
+	.size	eiselLemire, .-eiselLemire
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"infinity"
+.LC4:
+	.string	"inf"
+.LC5:
+	.string	"nan"
+	.text
+	.p2align 4
+	.globl	parseWavefrontFloat
+	.type	parseWavefrontFloat, @function
+parseWavefrontFloat:
+.LFB15:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	movq	%rdi, %r10
+	movq	%rsi, %rcx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	movq	%rdx, (%rsp)
+	movq	$0, 64(%rsp)
+	movaps	%xmm0, 32(%rsp)
+	movaps	%xmm0, 48(%rsp)
+	cmpq	%rsi, %rdi
+	jb	.L353
+	movq	%rdi, 56(%rsp)
+	xorl	%r13d, %r13d
+.L259:
+	movq	%rdi, 64(%rsp)
+	cmpq	%rdi, %rcx
+	jne	.L262
+.L217:
+	movq	%r10, %rbx
+	jmp	.L173
+	.p2align 4,,10
+	.p2align 3
+.L353:
+	movzbl	(%rdi), %eax
+	leal	-43(%rax), %edx
+	andl	$253, %edx
+	jne	.L175
+	cmpb	$45, %al
+	leaq	1(%rdi), %rbx
+	sete	%r13b
+	movq	%rbx, 56(%rsp)
+	movq	%rbx, %rdi
+	movzbl	%r13b, %r13d
+	movl	%r13d, 52(%rsp)
+	sall	$31, %r13d
+	cmpq	%rsi, %rbx
+	jnb	.L259
+.L176:
+	xorl	%r9d, %r9d
+	xorl	%r12d, %r12d
+	xorl	%r14d, %r14d
+	xorl	%ebp, %ebp
+	xorl	%r11d, %r11d
+	xorl	%esi, %esi
+	xorl	%r8d, %r8d
+	movl	$1, %r15d
+	jmp	.L181
+	.p2align 4,,10
+	.p2align 3
+.L356:
+	leaq	(%r12,%r12,4), %rdx
+	cltq
+	addl	$1, %esi
+	movl	$1, %r11d
+	leaq	(%rax,%rdx,2), %r12
+.L179:
+	addq	$1, %rbx
+	movl	$1, %r8d
+	cmpq	%rbx, %rcx
+	je	.L354
+.L181:
+	movsbl	(%rbx), %eax
+	movl	%eax, %edx
+	subl	$48, %edx
+	cmpb	$9, %dl
+	ja	.L355
+	subl	$48, %eax
+	movl	%eax, %edx
+	orl	%esi, %edx
+	je	.L263
+	cmpl	$18, %esi
+	jle	.L356
+	addl	$1, %ebp
+	testl	%eax, %eax
+	movl	$1, %r14d
+	movl	$1, %r8d
+	cmovne	%r15d, %r9d
+	addq	$1, %rbx
+	cmpq	%rbx, %rcx
+	jne	.L181
+.L354:
+	testb	%r9b, %r9b
+	je	.L182
+	movl	$1, 48(%rsp)
+.L182:
+	testb	%r11b, %r11b
+	je	.L357
+	movq	%r12, 32(%rsp)
+	testb	%r14b, %r14b
+	je	.L266
+	movl	%ebp, 44(%rsp)
+.L185:
+	movl	%esi, 40(%rsp)
+.L201:
+	movq	%rbx, 64(%rsp)
+.L203:
+	testq	%r12, %r12
+	je	.L352
+	movl	40(%rsp), %eax
+	addl	%ebp, %eax
+	subl	$1, %eax
+	cmpl	$-46, %eax
+	jl	.L352
+	cmpl	$38, %eax
+	jg	.L358
+	movl	48(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L229
+	cmpq	$16777216, %r12
+	ja	.L230
+	cmpl	$-10, %ebp
+	jl	.L230
+	cmpl	$10, %ebp
+	jle	.L359
+	leaq	16(%rsp), %rdx
+	movl	%ebp, %esi
+	movq	%r12, %rdi
+	call	eiselLemire
+	testl	%eax, %eax
+	jne	.L350
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r12, %xmm0
+	cmpl	$22, %ebp
+	jg	.L257
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	movslq	%ebp, %rbp
+	leaq	doublePowersOfTen(%rip), %rax
+	mulsd	(%rax,%rbp,8), %xmm0
+.L245:
+	leaq	24(%rsp), %r14
+	leaq	28(%rsp), %r12
+	movl	$4, %edx
+	cvtsd2ss	%xmm0, %xmm0
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	movss	%xmm0, 24(%rsp)
+	leaq	32(%rsp), %rbp
+	call	memcpy@PLT
+	movl	28(%rsp), %esi
+	cmpl	$2139095039, %esi
+	jbe	.L251
+	jmp	.L255
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	movl	28(%rsp), %edi
+	leal	1(%rdi), %esi
+	je	.L360
+	movl	%esi, 28(%rsp)
+	cmpl	$2139095039, %esi
+	ja	.L248
+.L251:
+	movq	%rbp, %rdi
+	call	compareMidpoint
+	testl	%eax, %eax
+	jns	.L247
+	movl	28(%rsp), %esi
+.L248:
+	testl	%esi, %esi
+	jne	.L255
+.L256:
+	xorl	%esi, %esi
+.L250:
+	orl	%esi, %r13d
+	jmp	.L227
+	.p2align 4,,10
+	.p2align 3
+.L263:
+	xorl	%esi, %esi
+	jmp	.L179
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movq	%rdi, 56(%rsp)
+	movq	%rdi, %rbx
+	xorl	%r13d, %r13d
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L355:
+	testb	%r9b, %r9b
+	je	.L188
+	movl	$1, 48(%rsp)
+.L188:
+	testb	%r11b, %r11b
+	je	.L361
+	movq	%r12, 32(%rsp)
+	testb	%r14b, %r14b
+	je	.L268
+	movl	%ebp, 44(%rsp)
+.L191:
+	movl	%esi, 40(%rsp)
+.L190:
+	cmpq	%rcx, %rbx
+	jnb	.L192
+	cmpb	$46, (%rbx)
+	je	.L362
+	movq	%rbx, 64(%rsp)
+	testl	%r8d, %r8d
+	je	.L262
+.L260:
+	movzbl	(%rbx), %eax
+	andl	$-33, %eax
+	cmpb	$69, %al
+	jne	.L203
+	leaq	1(%rbx), %rax
+	cmpq	%rcx, %rax
+	jnb	.L203
+	movzbl	1(%rbx), %edx
+	leal	-43(%rdx), %esi
+	andl	$253, %esi
+	jne	.L274
+	leaq	2(%rbx), %rax
+	cmpq	%rcx, %rax
+	jnb	.L203
+	xorl	%r8d, %r8d
+	cmpb	$45, %dl
+	movzbl	2(%rbx), %edx
+	sete	%r8b
+.L221:
+	subl	$48, %edx
+	cmpb	$9, %dl
+	ja	.L203
+	xorl	%esi, %esi
+	cmpq	%rcx, %rax
+	jb	.L222
+	jmp	.L349
+	.p2align 4,,10
+	.p2align 3
+.L225:
+	cmpl	$99999, %esi
+	jg	.L224
+	leal	(%rsi,%rsi,4), %esi
+	leal	-48(%rdx,%rsi,2), %esi
+.L224:
+	addq	$1, %rax
+	cmpq	%rax, %rcx
+	je	.L276
+.L222:
+	movsbl	(%rax), %edx
+	leal	-48(%rdx), %edi
+	cmpb	$9, %dil
+	jbe	.L225
+.L349:
+	movq	%rax, %rbx
+.L223:
+	movl	%esi, %eax
+	negl	%eax
+	testl	%r8d, %r8d
+	cmovne	%eax, %esi
+	addl	%esi, %ebp
+	movl	%ebp, 44(%rsp)
+	jmp	.L203
+.L268:
+	xorl	%ebp, %ebp
+	jmp	.L191
+.L266:
+	xorl	%ebp, %ebp
+	jmp	.L185
+.L192:
+	movq	%rbx, 64(%rsp)
+	testl	%r8d, %r8d
+	jne	.L203
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	movq	%rdi, %rbp
+	leaq	.LC3(%rip), %rsi
+	movl	$105, %edx
+	jmp	.L211
+	.p2align 4,,10
+	.p2align 3
+.L364:
+	movzbl	1(%rsi), %edx
+	addq	$1, %rsi
+	addq	$1, %rdi
+	testb	%dl, %dl
+	je	.L363
+	cmpq	%rdi, %rcx
+	je	.L271
+.L211:
+	movzbl	(%rdi), %eax
+	orl	$32, %eax
+	cmpb	%dl, %al
+	je	.L364
+.L271:
+	movq	%rbp, %rbx
+	leaq	.LC4(%rip), %rsi
+	movl	$105, %edx
+	jmp	.L215
+	.p2align 4,,10
+	.p2align 3
+.L365:
+	movzbl	1(%rsi), %edx
+	addq	$1, %rsi
+	addq	$1, %rbx
+	testb	%dl, %dl
+	je	.L213
+	cmpq	%rbx, %rcx
+	je	.L273
+.L215:
+	movzbl	(%rbx), %eax
+	orl	$32, %eax
+	cmpb	%dl, %al
+	je	.L365
+.L273:
+	leaq	.LC5(%rip), %rsi
+	movl	$110, %edx
+	jmp	.L218
+	.p2align 4,,10
+	.p2align 3
+.L367:
+	movzbl	1(%rsi), %edx
+	addq	$1, %rsi
+	addq	$1, %rbp
+	testb	%dl, %dl
+	je	.L366
+	cmpq	%rbp, %rcx
+	je	.L217
+.L218:
+	movzbl	0(%rbp), %eax
+	orl	$32, %eax
+	cmpb	%dl, %al
+	je	.L367
+	jmp	.L217
+	.p2align 4,,10
+	.p2align 3
+.L363:
+	movq	%rdi, %rbx
+.L213:
+	leaq	24(%rsp), %rsi
+	leaq	28(%rsp), %rdi
+	movl	$4, %edx
+	orl	$2139095040, %r13d
+	movl	%r13d, 24(%rsp)
+	call	memcpy@PLT
+	movss	28(%rsp), %xmm0
+	movq	(%rsp), %rax
+	movss	%xmm0, (%rax)
+.L173:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L230:
+	.cfi_restore_state
+	leaq	16(%rsp), %rdx
+	movl	%ebp, %esi
+	movq	%r12, %rdi
+	call	eiselLemire
+	testl	%eax, %eax
+	je	.L236
+.L350:
+	movl	16(%rsp), %eax
+.L235:
+	orl	%eax, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L352:
+	leaq	24(%rsp), %r14
+	leaq	28(%rsp), %r12
+.L227:
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	movl	%r13d, 24(%rsp)
+	call	memcpy@PLT
+	movss	28(%rsp), %xmm0
+	movq	(%rsp), %rax
+	movss	%xmm0, (%rax)
+	jmp	.L173
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	addq	$1, %rbx
+	cmpq	%rcx, %rbx
+	jnb	.L192
+	movb	$0, 15(%rsp)
+	movl	40(%rsp), %esi
+	movq	%r12, %r11
+	movl	%ebp, %r9d
+	xorl	%r15d, %r15d
+	xorl	%r14d, %r14d
+	jmp	.L195
+	.p2align 4,,10
+	.p2align 3
+.L370:
+	subl	$1, %r9d
+	xorl	%esi, %esi
+	movl	$1, %r14d
+.L197:
+	addq	$1, %rbx
+	movl	$1, %r8d
+	cmpq	%rbx, %rcx
+	je	.L368
+.L195:
+	movsbl	(%rbx), %edx
+	movl	%edx, %eax
+	subl	$48, %eax
+	cmpb	$9, %al
+	ja	.L369
+	subl	$48, %edx
+	movl	%edx, %eax
+	orl	%esi, %eax
+	je	.L370
+	cmpl	$18, %esi
+	jg	.L198
+	leaq	(%r11,%r11,4), %rax
+	movslq	%edx, %rdx
+	movb	$1, 15(%rsp)
+	addl	$1, %esi
+	leaq	(%rdx,%rax,2), %r11
+	subl	$1, %r9d
+	movl	$1, %r14d
+	jmp	.L197
+	.p2align 4,,10
+	.p2align 3
+.L198:
+	testl	%edx, %edx
+	movl	$1, %eax
+	cmovne	%eax, %r15d
+	jmp	.L197
+	.p2align 4,,10
+	.p2align 3
+.L361:
+	testb	%r14b, %r14b
+	je	.L267
+	movl	%ebp, 44(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L190
+.L369:
+	testb	%r15b, %r15b
+	je	.L205
+	movl	$1, 48(%rsp)
+.L205:
+	cmpb	$0, 15(%rsp)
+	je	.L371
+	movq	%r11, 32(%rsp)
+	testb	%r14b, %r14b
+	je	.L208
+	movl	%r9d, 44(%rsp)
+	movl	%r9d, %ebp
+.L208:
+	movl	%esi, 40(%rsp)
+	movq	%r11, %r12
+.L207:
+	movq	%rbx, 64(%rsp)
+	testl	%r8d, %r8d
+	je	.L262
+	cmpq	%rcx, %rbx
+	jb	.L260
+	jmp	.L203
+	.p2align 4,,10
+	.p2align 3
+.L368:
+	testb	%r15b, %r15b
+	je	.L199
+	movl	$1, 48(%rsp)
+.L199:
+	cmpb	$0, 15(%rsp)
+	je	.L372
+	movq	%r11, 32(%rsp)
+	testb	%r14b, %r14b
+	je	.L202
+	movl	%r9d, 44(%rsp)
+	movl	%r9d, %ebp
+.L202:
+	movl	%esi, 40(%rsp)
+	movq	%r11, %r12
+	jmp	.L201
+.L366:
+	orl	$2143289344, %r13d
+	leaq	24(%rsp), %rsi
+	leaq	28(%rsp), %rdi
+	movq	%rbp, %rbx
+	movl	$4, %edx
+	movl	%r13d, 24(%rsp)
+	call	memcpy@PLT
+	movss	28(%rsp), %xmm0
+	movq	(%rsp), %rax
+	movss	%xmm0, (%rax)
+	jmp	.L173
+.L229:
+	leaq	16(%rsp), %rdx
+	movl	%ebp, %esi
+	movq	%r12, %rdi
+	call	eiselLemire
+	testl	%eax, %eax
+	je	.L236
+	leaq	20(%rsp), %rdx
+	leaq	1(%r12), %rdi
+	movl	%ebp, %esi
+	call	eiselLemire
+	testl	%eax, %eax
+	je	.L236
+	movl	16(%rsp), %eax
+	cmpl	%eax, 20(%rsp)
+	je	.L235
+.L236:
+	testq	%r12, %r12
+	js	.L237
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r12, %xmm0
+.L238:
+	cmpl	$22, %ebp
+	jle	.L239
+.L257:
+	movsd	.LC6(%rip), %xmm1
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	mulsd	%xmm1, %xmm0
+	subl	$22, %ebp
+	cmpl	$22, %ebp
+	jg	.L240
+	jmp	.L241
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	je	.L373
+	subl	$1, %esi
+	movl	%esi, 28(%rsp)
+	je	.L256
+.L255:
+	subl	$1, %esi
+	movq	%rbp, %rdi
+	call	compareMidpoint
+	movl	28(%rsp), %esi
+	testl	%eax, %eax
+	jle	.L252
+	jmp	.L250
+.L237:
+	movq	%r12, %rax
+	andl	$1, %r12d
+	pxor	%xmm0, %xmm0
+	shrq	%rax
+	orq	%r12, %rax
+	cvtsi2sdq	%rax, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L238
+.L274:
+	xorl	%r8d, %r8d
+	jmp	.L221
+.L359:
+	pxor	%xmm0, %xmm0
+	cvtsi2ssq	%r12, %xmm0
+	testl	%ebp, %ebp
+	js	.L374
+	movslq	%ebp, %rbp
+	leaq	floatPowersOfTen(%rip), %rax
+	mulss	(%rax,%rbp,4), %xmm0
+.L233:
+	leaq	24(%rsp), %r14
+	leaq	28(%rsp), %r12
+	movl	$4, %edx
+	movss	%xmm0, 24(%rsp)
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	call	memcpy@PLT
+	orl	28(%rsp), %r13d
+	jmp	.L227
+.L371:
+	testb	%r14b, %r14b
+	je	.L207
+	movl	%r9d, 44(%rsp)
+	movl	%r9d, %ebp
+	jmp	.L207
+.L372:
+	testb	%r14b, %r14b
+	je	.L201
+	movl	%r9d, 44(%rsp)
+	movl	%r9d, %ebp
+	jmp	.L201
+.L239:
+	cmpl	$-22, %ebp
+	jge	.L242
+	movsd	.LC6(%rip), %xmm1
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	divsd	%xmm1, %xmm0
+	addl	$22, %ebp
+	cmpl	$-22, %ebp
+	jl	.L243
+.L244:
+	negl	%ebp
+	leaq	doublePowersOfTen(%rip), %rdx
+	movslq	%ebp, %rax
+	divsd	(%rdx,%rax,8), %xmm0
+	jmp	.L245
+.L358:
+	orl	$2139095040, %r13d
+	leaq	24(%rsp), %r14
+	leaq	28(%rsp), %r12
+	jmp	.L227
+.L242:
+	testl	%ebp, %ebp
+	jns	.L241
+	jmp	.L244
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	jmp	.L190
+.L360:
+	andl	$-2, %esi
+	jmp	.L250
+.L373:
+	movl	%esi, %eax
+	andl	$1, %eax
+	cmpl	$1, %eax
+	adcl	$-1, %esi
+	jmp	.L250
+.L276:
+	movq	%rcx, %rbx
+	jmp	.L223
+.L374:
+	movl	%ebp, %eax
+	leaq	floatPowersOfTen(%rip), %rdx
+	negl	%eax
+	cltq
+	divss	(%rdx,%rax,4), %xmm0
+	jmp	.L233
+.L357:
+	testb	%r14b, %r14b
+	je	.L265
+	movl	%ebp, 44(%rsp)
+	xorl	%r12d, %r12d
+	jmp	.L201
+.L265:
+	xorl	%ebp, %ebp
+	xorl	%r12d, %r12d
+	jmp	.L201
+	.cfi_endproc
+.LFE15:
+	.size	parseWavefrontFloat, .-parseWavefrontFloat
+	.p2align 4
+	.globl	parseWavefrontInteger
+	.type	parseWavefrontInteger, @function
+parseWavefrontInteger:
+.LFB16:
+	.cfi_startproc
+	movq	%rdx, %r9
+	cmpq	%rsi, %rdi
+	jnb	.L384
+	movzbl	(%rdi), %eax
+	leal	-43(%rax), %edx
+	andl	$253, %edx
+	jne	.L385
+	xorl	%r10d, %r10d
+	leaq	1(%rdi), %rdx
+	cmpb	$45, %al
+	sete	%r10b
+	cmpq	%rsi, %rdx
+	jne	.L393
+.L387:
+	movq	%rdi, %rdx
+	movq	%rdx, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L384:
+	movq	%rdi, %rdx
+	xorl	%r10d, %r10d
+	cmpq	%rsi, %rdx
+	je	.L387
+.L393:
+	movzbl	(%rdx), %eax
+.L377:
+	subl	$48, %eax
+	cmpb	$9, %al
+	ja	.L387
+	xorl	%ecx, %ecx
+	movl	$2147483648, %r8d
+	cmpq	%rsi, %rdx
+	jb	.L379
+	jmp	.L380
+	.p2align 4,,10
+	.p2align 3
+.L382:
+	cmpq	%r8, %rcx
+	jg	.L381
+	subl	$48, %eax
+	leaq	(%rcx,%rcx,4), %rcx
+	cltq
+	leaq	(%rax,%rcx,2), %rcx
+.L381:
+	addq	$1, %rdx
+	cmpq	%rdx, %rsi
+	je	.L380
+.L379:
+	movsbl	(%rdx), %eax
+	leal	-48(%rax), %edi
+	cmpb	$9, %dil
+	jbe	.L382
+.L380:
+	movq	%rcx, %rax
+	negq	%rax
+	testl	%r10d, %r10d
+	cmovne	%rax, %rcx
+	movq	$-2147483648, %rax
+	cmpq	%rax, %rcx
+	cmovl	%rax, %rcx
+	movl	$2147483647, %eax
+	cmpq	%rax, %rcx
+	cmovg	%rax, %rcx
+	movq	%rdx, %rax
+	movl	%ecx, (%r9)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L385:
+	movq	%rdi, %rdx
+	xorl	%r10d, %r10d
+	jmp	.L377
+	.cfi_endproc
+.LFE16:
+	.size	parseWavefrontInteger, .-parseWavefrontInteger
+	.section	.rodata.str1.1
+.LC8:
+	.string	"0."
+	.text
+	.p2align 4
+	.globl	formatWavefrontFloat
+	.type	formatWavefrontFloat, @function
+formatWavefrontFloat:
+.LFB26:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$4, %edx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	leaq	44(%rsp), %rsi
+	leaq	60(%rsp), %rdi
+	movss	%xmm0, 44(%rsp)
+	call	memcpy@PLT
+	movl	60(%rsp), %edx
+	movl	%edx, %esi
+	movl	%edx, %r12d
+	shrl	$23, %esi
+	andl	$8388607, %r12d
+	movzbl	%sil, %ecx
+	setne	%dil
+	cmpl	$255, %ecx
+	jne	.L395
+	testb	%dil, %dil
+	je	.L395
+	movq	%rbx, %rax
+	movl	$110, %ecx
+	leaq	.LC5(%rip), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	addq	$1, %rdx
+	movb	%cl, (%rax)
+	addq	$1, %rax
+	movzbl	(%rdx), %ecx
+	testb	%cl, %cl
+	jne	.L396
+.L607:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	subq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L395:
+	.cfi_restore_state
+	movq	%rbx, %r10
+	testl	%edx, %edx
+	js	.L608
+	leaq	1(%r10), %rax
+	movq	%rax, %rbp
+	cmpl	$255, %ecx
+	je	.L609
+.L399:
+	movl	%r12d, %r14d
+	orl	%ecx, %r14d
+	jne	.L401
+	movb	$48, (%r10)
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	subq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L608:
+	.cfi_restore_state
+	leaq	1(%rbx), %r10
+	movb	$45, (%rbx)
+	leaq	1(%r10), %rax
+	movq	%rax, %rbp
+	cmpl	$255, %ecx
+	jne	.L399
+.L609:
+	movl	$105, %ecx
+	leaq	.LC4(%rip), %rdx
+	jmp	.L400
+	.p2align 4,,10
+	.p2align 3
+.L610:
+	addq	$1, %rax
+.L400:
+	addq	$1, %rdx
+	movb	%cl, -1(%rax)
+	movzbl	(%rdx), %ecx
+	testb	%cl, %cl
+	jne	.L610
+	jmp	.L607
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	andl	$254, %esi
+	sete	%sil
+	andl	$1, %edx
+	orl	%edi, %esi
+	movl	%edx, 20(%rsp)
+	movzbl	%sil, %r14d
+	testl	%ecx, %ecx
+	jne	.L611
+	leal	0(,%r12,4), %edi
+	movl	$46, 32(%rsp)
+	movl	$27, %ecx
+	movl	$470197740, %edx
+	movl	%edi, %r9d
+	leal	2(%rdi), %r11d
+	movl	$-46, (%rsp)
+	movl	$1412679181, %r8d
+	movl	%r11d, %r15d
+	leal	-1(%r9), %esi
+	movl	%r9d, 16(%rsp)
+	movl	$105, %edi
+	movl	$105, 24(%rsp)
+	movq	%r15, 8(%rsp)
+	movl	%esi, %r15d
+	subl	%r14d, %r15d
+.L487:
+	movq	%r9, %r13
+	movq	%r9, %rsi
+	movq	8(%rsp), %r11
+	imulq	%r8, %r13
+	imulq	%rdx, %rsi
+	shrq	$32, %r13
+	addq	%r13, %rsi
+	movq	%r11, %r13
+	imulq	%r8, %r13
+	shrq	%cl, %rsi
+	imulq	%r15, %r8
+	imulq	%rdx, %r11
+	imulq	%r15, %rdx
+	shrq	$32, %r13
+	shrq	$32, %r8
+	addq	%r13, %r11
+	movl	$3435973837, %r13d
+	addq	%r8, %rdx
+	shrq	%cl, %r11
+	shrq	%cl, %rdx
+	movq	%r11, 8(%rsp)
+	movl	%edx, %r8d
+	movl	%edx, %edx
+	movl	%r11d, 4(%rsp)
+	imulq	%r13, %rdx
+	shrq	$35, %rdx
+	testl	%edi, %edi
+	je	.L415
+	leal	-1(%r11), %ecx
+	xorl	%r11d, %r11d
+	imulq	%r13, %rcx
+	shrq	$35, %rcx
+	cmpl	%ecx, %edx
+	jb	.L416
+	movl	32(%rsp), %r15d
+	leaq	ryuPow5(%rip), %rcx
+	addl	$1, %r15d
+	movslq	%r15d, %r11
+	movq	(%rcx,%r11,8), %rcx
+	movl	%ecx, %r11d
+	shrq	$32, %rcx
+	imulq	%r9, %r11
+	imulq	%r9, %rcx
+	shrq	$32, %r11
+	leaq	(%r11,%rcx), %r9
+	movl	24(%rsp), %r11d
+	imull	$1217359, %r15d, %ecx
+	shrl	$19, %ecx
+	subl	%ecx, %r11d
+	leal	27(%r11), %ecx
+	shrq	%cl, %r9
+	movl	%r9d, %r11d
+	imulq	%r13, %r11
+	shrq	$35, %r11
+	leal	(%r11,%r11,4), %ecx
+	movl	%r9d, %r11d
+	addl	%ecx, %ecx
+	subl	%ecx, %r11d
+.L416:
+	cmpl	$1, %edi
+	je	.L612
+	cmpl	$30, %edi
+	ja	.L495
+	leal	-1(%rdi), %ecx
+	movl	$-1, %r9d
+	movl	%r11d, %edi
+	sall	%cl, %r9d
+	notl	%r9d
+	testl	%r9d, 16(%rsp)
+	sete	%r9b
+	xorl	%r14d, %r14d
+	movzbl	%r9b, %r9d
+	movl	%r9d, %ecx
+	jmp	.L409
+	.p2align 4,,10
+	.p2align 3
+.L611:
+	orl	$8388608, %r12d
+	leal	0(,%r12,4), %r9d
+	leal	-1(%r9), %edx
+	leal	2(%r9), %r11d
+	movl	%r9d, 16(%rsp)
+	movl	%edx, %esi
+	movl	%ecx, %edx
+	movl	%r11d, 40(%rsp)
+	subl	%r14d, %esi
+	movq	%r11, 8(%rsp)
+	movl	%esi, 36(%rsp)
+	movl	%esi, %r15d
+	subl	$152, %edx
+	js	.L403
+	imull	$78913, %edx, %r13d
+	leaq	ryuPow5Inverse(%rip), %rdi
+	shrl	$18, %r13d
+	movl	%r13d, %esi
+	imull	$1217359, %r13d, %ecx
+	movl	%r13d, (%rsp)
+	subl	%edx, %esi
+	movl	%r13d, %edx
+	movq	(%rdi,%rdx,8), %rdx
+	movl	%esi, 32(%rsp)
+	shrl	$19, %ecx
+	movl	%edx, %edi
+	shrq	$32, %rdx
+	leal	27(%rsi,%rcx), %ecx
+	movq	%rdi, %r8
+	movq	%rdx, %r14
+	imulq	%r9, %r14
+	imulq	%r9, %r8
+	movq	%r14, %rsi
+	movq	%rdi, %r14
+	shrq	$32, %r8
+	imulq	%r11, %r14
+	addq	%r8, %rsi
+	imulq	%r15, %rdi
+	movq	%rdx, %r8
+	imulq	%r11, %r8
+	movl	$3435973837, %r11d
+	shrq	%cl, %rsi
+	imulq	%r15, %rdx
+	shrq	$32, %r14
+	shrq	$32, %rdi
+	addq	%r14, %r8
+	addq	%rdi, %rdx
+	shrq	%cl, %r8
+	shrq	%cl, %rdx
+	movq	%r8, 24(%rsp)
+	movl	%r8d, 4(%rsp)
+	movl	%edx, %r8d
+	movl	%edx, %edx
+	imulq	%r11, %rdx
+	shrq	$35, %rdx
+	testl	%r13d, %r13d
+	je	.L491
+	movq	24(%rsp), %rdi
+	leal	-1(%rdi), %ecx
+	xorl	%edi, %edi
+	imulq	%r11, %rcx
+	shrq	$35, %rcx
+	cmpl	%ecx, %edx
+	jb	.L405
+	leal	-1(%r13), %ecx
+	leaq	ryuPow5Inverse(%rip), %r14
+	movq	%rcx, %rdi
+	movq	(%r14,%rcx,8), %rcx
+	movl	%ecx, %r14d
+	shrq	$32, %rcx
+	imulq	%r9, %r14
+	imulq	%r9, %rcx
+	shrq	$32, %r14
+	addq	%rcx, %r14
+	imull	$1217359, %edi, %ecx
+	movl	32(%rsp), %edi
+	shrl	$19, %ecx
+	leal	26(%rdi,%rcx), %ecx
+	shrq	%cl, %r14
+	movl	%r14d, %edi
+	movq	%r14, %rcx
+	imulq	%r11, %rdi
+	shrq	$35, %rdi
+	leal	(%rdi,%rdi,4), %r14d
+	movl	%ecx, %edi
+	addl	%r14d, %r14d
+	subl	%r14d, %edi
+.L405:
+	cmpl	$9, %r13d
+	ja	.L486
+.L404:
+	movl	$3435973837, %r14d
+	movq	%r9, %rcx
+	imulq	%r14, %rcx
+	shrq	$34, %rcx
+	leal	(%rcx,%rcx,4), %ecx
+	movl	%ecx, %r11d
+	movl	16(%rsp), %ecx
+	subl	%r11d, %ecx
+	je	.L408
+	movl	20(%rsp), %r9d
+	testl	%r9d, %r9d
+	jne	.L613
+	movq	%r15, %r9
+	imulq	%r14, %r9
+	shrq	$34, %r9
+	leal	(%r9,%r9,4), %ecx
+	movl	36(%rsp), %r9d
+	subl	%ecx, %r9d
+	jne	.L493
+	movq	%r15, %rcx
+	jmp	.L414
+	.p2align 4,,10
+	.p2align 3
+.L614:
+	movl	%ecx, %ecx
+.L414:
+	imulq	%r14, %rcx
+	addl	$1, %r9d
+	shrq	$34, %rcx
+	imull	$-858993459, %ecx, %r11d
+	cmpl	$858993459, %r11d
+	jbe	.L614
+.L413:
+	xorl	%r14d, %r14d
+	cmpl	%r13d, %r9d
+	setnb	%r14b
+	xorl	%r9d, %r9d
+	movl	%r14d, %ecx
+	jmp	.L409
+.L613:
+	movq	8(%rsp), %rcx
+	imulq	%r14, %rcx
+	shrq	$34, %rcx
+	leal	(%rcx,%rcx,4), %r9d
+	movl	40(%rsp), %ecx
+	subl	%r9d, %ecx
+	movq	8(%rsp), %r9
+	je	.L411
+	jmp	.L615
+	.p2align 4,,10
+	.p2align 3
+.L616:
+	movl	%r9d, %r9d
+.L411:
+	imulq	%r14, %r9
+	addl	$1, %ecx
+	shrq	$34, %r9
+	imull	$-858993459, %r9d, %r11d
+	cmpl	$858993459, %r11d
+	jbe	.L616
+.L412:
+	cmpl	%r13d, %ecx
+	movl	24(%rsp), %ecx
+	adcl	$-1, %ecx
+	movl	%ecx, 4(%rsp)
+.L486:
+	movl	4(%rsp), %ecx
+	movl	$3435973837, %r9d
+	xorl	%r11d, %r11d
+	imulq	%r9, %rcx
+	shrq	$35, %rcx
+	cmpl	%ecx, %edx
+	jnb	.L422
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	movl	%edx, %edx
+	movl	%ecx, %ecx
+	movl	%esi, %esi
+	addl	$1, %r11d
+	imulq	%r9, %rcx
+	movq	%rdx, %r8
+	movq	%rsi, %r12
+	imulq	%r9, %rdx
+	imulq	%r9, %rsi
+	shrq	$35, %rcx
+	shrq	$35, %rdx
+	shrq	$35, %rsi
+	cmpl	%ecx, %edx
+	jb	.L421
+	addl	%r11d, (%rsp)
+	leal	(%rsi,%rsi,4), %edx
+	movl	%r12d, %edi
+	addl	%edx, %edx
+	subl	%edx, %edi
+.L422:
+	cmpl	%r8d, %esi
+	sete	%dl
+	cmpl	$4, %edi
+	seta	%cl
+	orl	%ecx, %edx
+	movzbl	%dl, %edx
+	addl	%edx, %esi
+.L432:
+	cmpl	$9, %esi
+	jbe	.L433
+	movl	%esi, %edx
+	movl	$1, %ecx
+	movl	$3435973837, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L434:
+	movl	%edx, %edx
+	movl	%ecx, %r8d
+	addl	$1, %ecx
+	movq	%rdx, %rdi
+	imulq	%r9, %rdx
+	shrq	$35, %rdx
+	cmpl	$99, %edi
+	ja	.L434
+	movl	%esi, %edx
+	movslq	%r8d, %r11
+	imulq	%r9, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edi
+	addl	%edi, %edi
+	subl	%edi, %esi
+	leal	-1(%r8), %edi
+	addl	$48, %esi
+	movslq	%edi, %r12
+	movb	%sil, 64(%rsp,%r11)
+	movl	%edx, %esi
+	imulq	%r9, %rsi
+	shrq	$35, %rsi
+	leal	(%rsi,%rsi,4), %r11d
+	addl	%r11d, %r11d
+	subl	%r11d, %edx
+	leal	-2(%r8), %r11d
+	addl	$48, %edx
+	movb	%dl, 64(%rsp,%r12)
+	cmpl	$1, %r8d
+	je	.L438
+	movl	%esi, %edx
+	movslq	%r11d, %r11
+	imulq	%r9, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %r12d
+	addl	%r12d, %r12d
+	subl	%r12d, %esi
+	addl	$48, %esi
+	movb	%sil, 64(%rsp,%r11)
+	leal	-3(%r8), %r11d
+	cmpl	$2, %r8d
+	je	.L438
+	movl	%edx, %esi
+	movslq	%r11d, %r11
+	imulq	%r9, %rsi
+	shrq	$35, %rsi
+	leal	(%rsi,%rsi,4), %r12d
+	addl	%r12d, %r12d
+	subl	%r12d, %edx
+	addl	$48, %edx
+	movb	%dl, 64(%rsp,%r11)
+	leal	-4(%r8), %r11d
+	cmpl	$3, %r8d
+	je	.L438
+	movl	%esi, %edx
+	movslq	%r11d, %r11
+	imulq	%r9, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %r12d
+	addl	%r12d, %r12d
+	subl	%r12d, %esi
+	addl	$48, %esi
+	movb	%sil, 64(%rsp,%r11)
+	leal	-5(%r8), %r11d
+	cmpl	$4, %r8d
+	je	.L438
+	movl	%edx, %esi
+	movslq	%r11d, %r11
+	imulq	%r9, %rsi
+	shrq	$35, %rsi
+	leal	(%rsi,%rsi,4), %r12d
+	addl	%r12d, %r12d
+	subl	%r12d, %edx
+	addl	$48, %edx
+	movb	%dl, 64(%rsp,%r11)
+	leal	-6(%r8), %r11d
+	cmpl	$5, %r8d
+	je	.L438
+	movl	%esi, %edx
+	movslq	%r11d, %r11
+	imulq	%r9, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %r12d
+	addl	%r12d, %r12d
+	subl	%r12d, %esi
+	addl	$48, %esi
+	movb	%sil, 64(%rsp,%r11)
+	leal	-7(%r8), %r11d
+	cmpl	$6, %r8d
+	je	.L438
+	movl	%edx, %esi
+	movslq	%r11d, %r11
+	imulq	%r9, %rsi
+	shrq	$35, %rsi
+	leal	(%rsi,%rsi,4), %r12d
+	addl	%r12d, %r12d
+	subl	%r12d, %edx
+	addl	$48, %edx
+	movb	%dl, 64(%rsp,%r11)
+	leal	-8(%r8), %r11d
+	cmpl	$7, %r8d
+	je	.L438
+	movl	%esi, %edx
+	movslq	%r11d, %r11
+	imulq	%r9, %rdx
+	shrq	$35, %rdx
+	leal	(%rdx,%rdx,4), %edx
+	addl	%edx, %edx
+	subl	%edx, %esi
+	addl	$48, %esi
+	movb	%sil, 64(%rsp,%r11)
+.L438:
+	movl	(%rsp), %r9d
+	addl	%ecx, %r9d
+	leal	3(%r9), %edx
+	cmpl	$12, %edx
+	ja	.L617
+.L436:
+	testl	%r9d, %r9d
+	jle	.L499
+	movzbl	64(%rsp), %edx
+	cmpl	%r9d, %ecx
+	movl	%r9d, %eax
+	cmovge	%ecx, %eax
+	movb	%dl, (%r10)
+	cmpl	$1, %ecx
+	jne	.L618
+.L441:
+	cmpl	%ecx, %eax
+	jle	.L446
+	movq	%rbp, %r10
+	cmpl	%r9d, %ecx
+	jne	.L449
+	movb	$46, 0(%rbp)
+	addq	$1, %r10
+.L449:
+	leal	1(%rcx), %edx
+	movb	$48, (%r10)
+	leaq	1(%r10), %rbp
+	cmpl	%edx, %eax
+	jle	.L446
+	cmpl	%r9d, %edx
+	jne	.L451
+	movb	$46, 1(%r10)
+	leaq	2(%r10), %rbp
+.L451:
+	leal	2(%rcx), %esi
+	movb	$48, 0(%rbp)
+	leaq	1(%rbp), %rdx
+	cmpl	%esi, %eax
+	jle	.L505
+	cmpl	%r9d, %esi
+	jne	.L452
+	movb	$46, 1(%rbp)
+	leaq	2(%rbp), %rdx
+.L452:
+	leal	3(%rcx), %esi
+	movb	$48, (%rdx)
+	leaq	1(%rdx), %rbp
+	cmpl	%esi, %eax
+	jle	.L446
+	cmpl	%r9d, %esi
+	jne	.L453
+	movb	$46, 1(%rdx)
+	leaq	2(%rdx), %rbp
+.L453:
+	leal	4(%rcx), %esi
+	movb	$48, 0(%rbp)
+	leaq	1(%rbp), %rdx
+	cmpl	%esi, %eax
+	jle	.L505
+	cmpl	%r9d, %esi
+	jne	.L454
+	movb	$46, 1(%rbp)
+	leaq	2(%rbp), %rdx
+.L454:
+	leal	5(%rcx), %esi
+	movb	$48, (%rdx)
+	leaq	1(%rdx), %rbp
+	cmpl	%esi, %eax
+	jle	.L446
+	cmpl	%r9d, %esi
+	jne	.L455
+	movb	$46, 1(%rdx)
+	leaq	2(%rdx), %rbp
+.L455:
+	leal	6(%rcx), %esi
+	movb	$48, 0(%rbp)
+	leaq	1(%rbp), %rdx
+	cmpl	%esi, %eax
+	jle	.L505
+	cmpl	%r9d, %esi
+	jne	.L456
+	movb	$46, 1(%rbp)
+	leaq	2(%rbp), %rdx
+.L456:
+	leal	7(%rcx), %esi
+	movb	$48, (%rdx)
+	leaq	1(%rdx), %rbp
+	cmpl	%esi, %eax
+	jle	.L446
+	cmpl	%r9d, %esi
+	jne	.L457
+	movb	$46, 1(%rdx)
+	leaq	2(%rdx), %rbp
+.L457:
+	leal	8(%rcx), %esi
+	movb	$48, 0(%rbp)
+	leaq	1(%rbp), %rdx
+	cmpl	%esi, %eax
+	jle	.L505
+	cmpl	%r9d, %esi
+	jne	.L458
+	movb	$46, 1(%rbp)
+	leaq	2(%rbp), %rdx
+.L458:
+	leal	9(%rcx), %esi
+	movb	$48, (%rdx)
+	leaq	1(%rdx), %rbp
+	cmpl	%esi, %eax
+	jle	.L446
+	addl	$10, %ecx
+	movb	$48, 1(%rdx)
+	leaq	2(%rdx), %rbp
+	cmpl	%ecx, %eax
+	jle	.L446
+.L460:
+	movq	%rbp, %rdx
+	addl	$1, %ecx
+	addq	$1, %rbp
+	movb	$48, (%rdx)
+	cmpl	%ecx, %eax
+	jne	.L460
+	.p2align 4,,10
+	.p2align 3
+.L446:
+	movq	%rbp, %rax
+	jmp	.L607
+	.p2align 4,,10
+	.p2align 3
+.L619:
+	movl	%r9d, %r9d
+.L408:
+	imulq	%r14, %r9
+	addl	$1, %ecx
+	shrq	$34, %r9
+	imull	$-858993459, %r9d, %r11d
+	cmpl	$858993459, %r11d
+	jbe	.L619
+	xorl	%r9d, %r9d
+	cmpl	%r13d, %ecx
+	setnb	%r9b
+	xorl	%r14d, %r14d
+	movl	%r9d, %ecx
+.L409:
+	testl	%ecx, %ecx
+	je	.L486
+.L420:
+	movl	4(%rsp), %ecx
+	movl	$3435973837, %r11d
+	xorl	%r13d, %r13d
+	imulq	%r11, %rcx
+	shrq	$35, %rcx
+	cmpl	%ecx, %edx
+	jnb	.L423
+	.p2align 4,,10
+	.p2align 3
+.L424:
+	imull	$-858993459, %r8d, %r8d
+	movl	%edx, %edx
+	movl	%ecx, %ecx
+	rorl	%r8d
+	cmpl	$429496729, %r8d
+	setbe	%r8b
+	movzbl	%r8b, %r8d
+	andl	%r8d, %r14d
+	testl	%edi, %edi
+	sete	%dil
+	imulq	%r11, %rcx
+	addl	$1, %r13d
+	movzbl	%dil, %edi
+	andl	%edi, %r9d
+	movl	%esi, %edi
+	imulq	%r11, %rdi
+	shrq	$35, %rcx
+	shrq	$35, %rdi
+	leal	(%rdi,%rdi,4), %r15d
+	movl	%edi, %r8d
+	addl	%r15d, %r15d
+	subl	%r15d, %esi
+	movl	%esi, %edi
+	movl	%r8d, %esi
+	movq	%rdx, %r8
+	imulq	%r11, %rdx
+	shrq	$35, %rdx
+	cmpl	%ecx, %edx
+	jb	.L424
+.L423:
+	testl	%r14d, %r14d
+	je	.L425
+	imull	$-858993459, %r8d, %edx
+	rorl	%edx
+	cmpl	$429496729, %edx
+	ja	.L425
+	movl	$3435973837, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L426:
+	xorl	%edx, %edx
+	testl	%edi, %edi
+	movl	%esi, %edi
+	movl	%r8d, %r8d
+	sete	%dl
+	imulq	%rcx, %rdi
+	addl	$1, %r13d
+	imulq	%rcx, %r8
+	andl	%edx, %r9d
+	shrq	$35, %rdi
+	movl	%edi, %edx
+	shrq	$35, %r8
+	leal	(%rdi,%rdi,4), %r11d
+	movl	%esi, %edi
+	movl	%edx, %esi
+	imull	$-858993459, %r8d, %edx
+	addl	%r11d, %r11d
+	subl	%r11d, %edi
+	rorl	%edx
+	cmpl	$429496729, %edx
+	jbe	.L426
+.L425:
+	cmpl	$5, %edi
+	jne	.L427
+	testl	%r9d, %r9d
+	je	.L427
+	testb	$1, %sil
+	jne	.L515
+	cmpl	%r8d, %esi
+	jne	.L429
+	movl	%r14d, %edx
+	andl	$1, %r12d
+	xorl	$1, %edx
+	orl	%r12d, %edx
+	movzbl	%dl, %edx
+	addl	%edx, %esi
+	jmp	.L429
+	.p2align 4,,10
+	.p2align 3
+.L617:
+	movzbl	64(%rsp), %eax
+	movb	$46, 1(%r10)
+	leaq	2(%r10), %rbp
+	movb	%al, (%r10)
+	cmpl	$6, %edi
+	jbe	.L620
+	movq	65(%rsp), %rax
+	movq	%rax, 2(%r10)
+	movl	%r8d, %eax
+	andl	$-8, %eax
+	movl	%eax, %esi
+	leal	1(%rax), %edx
+	addq	%rbp, %rsi
+	cmpl	%eax, %r8d
+	je	.L478
+.L479:
+	movl	%ecx, %edi
+	subl	%eax, %edi
+	leal	-1(%rdi), %r11d
+	subl	$2, %edi
+	cmpl	$2, %edi
+	jbe	.L481
+	movl	65(%rsp,%rax), %edi
+	movl	%edi, 2(%r10,%rax)
+	movl	%r11d, %eax
+	andl	$-4, %eax
+	movl	%eax, %edi
+	addl	%eax, %edx
+	addq	%rdi, %rsi
+	andl	$3, %r11d
+	je	.L478
+.L481:
+	movslq	%edx, %rax
+	movzbl	64(%rsp,%rax), %eax
+	movb	%al, (%rsi)
+	leal	1(%rdx), %eax
+	cmpl	%edx, %r8d
+	jle	.L478
+	cltq
+	addl	$2, %edx
+	movzbl	64(%rsp,%rax), %eax
+	movb	%al, 1(%rsi)
+	cmpl	%edx, %ecx
+	jle	.L478
+	movslq	%edx, %rdx
+	movzbl	64(%rsp,%rdx), %eax
+	movb	%al, 2(%rsi)
+.L478:
+	movl	%r8d, %r8d
+	addq	%r8, %rbp
+.L480:
+	movl	%r9d, %edx
+	movb	$101, 0(%rbp)
+	leaq	1(%rbp), %rax
+	subl	$1, %edx
+	jns	.L484
+	movb	$45, 1(%rbp)
+	movl	$1, %edx
+	leaq	2(%rbp), %rax
+	subl	%r9d, %edx
+.L484:
+	movl	%edx, %ecx
+	cmpl	$9, %edx
+	jle	.L485
+	movl	$3435973837, %esi
+	addq	$1, %rax
+	imulq	%rcx, %rsi
+	shrq	$35, %rsi
+	addl	$48, %esi
+	movb	%sil, -1(%rax)
+.L485:
+	movl	$3435973837, %esi
+	addq	$1, %rax
+	imulq	%rsi, %rcx
+	shrq	$35, %rcx
+	leal	(%rcx,%rcx,4), %ecx
+	addl	%ecx, %ecx
+	subl	%ecx, %edx
+	addl	$48, %edx
+	movb	%dl, -1(%rax)
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	subq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L491:
+	.cfi_restore_state
+	xorl	%edi, %edi
+	jmp	.L404
+.L612:
+	movl	%r11d, %edi
+.L415:
+	movl	20(%rsp), %ecx
+	testl	%ecx, %ecx
+	jne	.L621
+.L419:
+	movl	$1, %r9d
+	jmp	.L420
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	cmpl	%r8d, %esi
+	je	.L622
+.L430:
+	xorl	%edx, %edx
+	cmpl	$4, %edi
+	seta	%dl
+	addl	%edx, %esi
+.L429:
+	addl	%r13d, (%rsp)
+	jmp	.L432
+	.p2align 4,,10
+	.p2align 3
+.L621:
+	movl	8(%rsp), %ecx
+	xorl	%r14d, %r14d
+	subl	$1, %ecx
+	movl	%ecx, 4(%rsp)
+	jmp	.L419
+.L622:
+	testl	%r14d, %r14d
+	je	.L515
+	andl	$1, %r12d
+	je	.L430
+	.p2align 4,,10
+	.p2align 3
+.L515:
+	addl	$1, %esi
+	jmp	.L429
+.L618:
+	cmpl	$1, %r9d
+	je	.L623
+	movzbl	65(%rsp), %edx
+	leaq	2(%r10), %rbp
+	movb	%dl, 1(%r10)
+	cmpl	$2, %ecx
+	je	.L441
+	cmpl	$2, %r9d
+	je	.L624
+	movzbl	66(%rsp), %edx
+	leaq	3(%r10), %rbp
+	movb	%dl, 2(%r10)
+	cmpl	$3, %ecx
+	je	.L441
+	cmpl	$3, %r9d
+	je	.L625
+.L466:
+	movzbl	67(%rsp), %edx
+	leaq	1(%rbp), %r10
+	movb	%dl, 0(%rbp)
+	cmpl	$4, %ecx
+	jg	.L626
+	movq	%r10, %rbp
+	movl	$4, %ecx
+	jmp	.L441
+	.p2align 4,,10
+	.p2align 3
+.L499:
+	movl	$48, %esi
+	leaq	.LC8(%rip), %rdx
+	jmp	.L439
+	.p2align 4,,10
+	.p2align 3
+.L627:
+	addq	$1, %rax
+.L439:
+	addq	$1, %rdx
+	movb	%sil, -1(%rax)
+	movq	%rax, %r10
+	movzbl	(%rdx), %esi
+	testb	%sil, %sil
+	jne	.L627
+	testl	%r9d, %r9d
+	je	.L442
+	movb	$48, (%rax)
+	cmpl	$-1, %r9d
+	je	.L443
+	movb	$48, 1(%rax)
+	cmpl	$-3, %r9d
+	jne	.L443
+	movb	$48, 2(%rax)
+.L443:
+	negl	%r9d
+	leaq	(%rax,%r9), %r10
+.L442:
+	leal	-1(%rcx), %eax
+	cmpl	$6, %eax
+	jbe	.L500
+	movq	64(%rsp), %rax
+	movq	%rax, (%r10)
+	movl	%ecx, %eax
+	andl	$-8, %eax
+	movl	%eax, %edx
+	movl	%eax, %esi
+	addq	%r10, %rdx
+	cmpl	%eax, %ecx
+	je	.L445
+.L444:
+	movl	%ecx, %edi
+	subl	%esi, %edi
+	leal	-1(%rdi), %r8d
+	cmpl	$2, %r8d
+	jbe	.L447
+	movl	64(%rsp,%rsi), %r8d
+	movl	%r8d, (%r10,%rsi)
+	movl	%edi, %esi
+	andl	$-4, %esi
+	movl	%esi, %r8d
+	addl	%esi, %eax
+	addq	%r8, %rdx
+	andl	$3, %edi
+	je	.L445
+.L447:
+	movslq	%eax, %rsi
+	movzbl	64(%rsp,%rsi), %esi
+	movb	%sil, (%rdx)
+	leal	1(%rax), %esi
+	cmpl	%ecx, %esi
+	jge	.L445
+	movslq	%esi, %rsi
+	addl	$2, %eax
+	movzbl	64(%rsp,%rsi), %esi
+	movb	%sil, 1(%rdx)
+	cmpl	%ecx, %eax
+	jge	.L445
+	cltq
+	movzbl	64(%rsp,%rax), %eax
+	movb	%al, 2(%rdx)
+.L445:
+	leaq	(%r10,%rcx), %rbp
+	jmp	.L446
+.L433:
+	movl	(%rsp), %edi
+	addl	$48, %esi
+	movb	%sil, 64(%rsp)
+	leal	4(%rdi), %edx
+	leal	1(%rdi), %r9d
+	cmpl	$12, %edx
+	jbe	.L628
+	movb	%sil, (%r10)
+	jmp	.L480
+.L495:
+	movl	%r11d, %edi
+	jmp	.L486
+.L505:
+	movq	%rdx, %rbp
+	jmp	.L446
+.L626:
+	cmpl	$4, %r9d
+	je	.L629
+.L468:
+	movzbl	68(%rsp), %edx
+	leaq	1(%r10), %rbp
+	movb	%dl, (%r10)
+	cmpl	$5, %ecx
+	jg	.L630
+	movl	$5, %ecx
+	jmp	.L441
+.L620:
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	movl	$1, %edx
+	jmp	.L479
+.L630:
+	cmpl	$5, %r9d
+	je	.L631
+.L470:
+	movzbl	69(%rsp), %esi
+	leaq	1(%rbp), %rdx
+	movb	%sil, 0(%rbp)
+	cmpl	$6, %ecx
+	jg	.L632
+	movq	%rdx, %rbp
+	movl	$6, %ecx
+	jmp	.L441
+.L632:
+	cmpl	$6, %r9d
+	je	.L633
+.L472:
+	movzbl	70(%rsp), %esi
+	leaq	1(%rdx), %rbp
+	movb	%sil, (%rdx)
+	cmpl	$7, %ecx
+	jg	.L634
+	movl	$7, %ecx
+	jmp	.L441
+.L634:
+	cmpl	$7, %r9d
+	je	.L635
+.L474:
+	movzbl	71(%rsp), %esi
+	leaq	1(%rbp), %rdx
+	movb	%sil, 0(%rbp)
+	cmpl	$8, %ecx
+	jg	.L636
+	movq	%rdx, %rbp
+	movl	$8, %ecx
+	jmp	.L441
+.L623:
+	movzbl	65(%rsp), %edx
+	movb	$46, 1(%r10)
+	movb	%dl, 2(%r10)
+	cmpl	$2, %ecx
+	jne	.L462
+	addq	$3, %r10
+	cmpl	$2, %eax
+	jne	.L449
+.L606:
+	movq	%r10, %rbp
+	jmp	.L446
+.L636:
+	cmpl	$8, %r9d
+	je	.L637
+.L476:
+	movzbl	72(%rsp), %ecx
+	leaq	1(%rdx), %rbp
+	movb	%cl, (%rdx)
+	movl	$9, %ecx
+	jmp	.L441
+.L624:
+	movzbl	66(%rsp), %edx
+	movb	$46, 2(%r10)
+	movb	%dl, 3(%r10)
+	cmpl	$3, %ecx
+	jne	.L465
+	addq	$4, %r10
+	cmpl	$3, %eax
+	jne	.L449
+	jmp	.L606
+.L625:
+	movzbl	67(%rsp), %edx
+	movb	$46, 3(%r10)
+	movb	%dl, 4(%r10)
+	cmpl	$4, %ecx
+	jne	.L467
+	addq	$5, %r10
+	cmpl	$4, %eax
+	jne	.L449
+	jmp	.L606
+.L629:
+	movzbl	68(%rsp), %edx
+	movb	$46, 1(%rbp)
+	movb	%dl, 2(%rbp)
+	cmpl	$5, %ecx
+	jne	.L469
+	leaq	3(%rbp), %r10
+	cmpl	$5, %eax
+	jne	.L449
+	jmp	.L606
+.L631:
+	movzbl	69(%rsp), %edx
+	movb	$46, 1(%r10)
+	movb	%dl, 2(%r10)
+	cmpl	$6, %ecx
+	jne	.L471
+	addq	$3, %r10
+	cmpl	$6, %eax
+	jne	.L449
+	jmp	.L606
+.L633:
+	movzbl	70(%rsp), %edx
+	movb	$46, 1(%rbp)
+	movb	%dl, 2(%rbp)
+	cmpl	$7, %ecx
+	jne	.L473
+	leaq	3(%rbp), %r10
+	cmpl	$7, %eax
+	jne	.L449
+	jmp	.L606
+.L635:
+	movzbl	71(%rsp), %esi
+	movb	$46, 1(%rdx)
+	movb	%sil, 2(%rdx)
+	cmpl	$8, %ecx
+	jne	.L638
+	leaq	3(%rdx), %r10
+	cmpl	$9, %eax
+	je	.L449
+	jmp	.L606
+.L637:
+	movzbl	72(%rsp), %edx
+	movb	$46, 1(%rbp)
+	leaq	3(%rbp), %r10
+	movl	$9, %ecx
+	movb	%dl, 2(%rbp)
+	cmpl	$9, %eax
+	jne	.L449
+	jmp	.L606
+.L462:
+	movzbl	66(%rsp), %edx
+	leaq	4(%r10), %rbp
+	movb	%dl, 3(%r10)
+	cmpl	$3, %ecx
+	je	.L441
+	jmp	.L466
+.L465:
+	movzbl	67(%rsp), %edx
+	leaq	5(%r10), %rbp
+	movb	%dl, 4(%r10)
+	cmpl	$4, %ecx
+	je	.L441
+	movq	%rbp, %r10
+	jmp	.L468
+.L500:
+	movq	%r10, %rdx
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	jmp	.L444
+.L493:
+	xorl	%r9d, %r9d
+	jmp	.L413
+.L615:
+	xorl	%ecx, %ecx
+	jmp	.L412
+.L467:
+	movzbl	68(%rsp), %edx
+	leaq	6(%r10), %rbp
+	movb	%dl, 5(%r10)
+	cmpl	$5, %ecx
+	je	.L441
+	jmp	.L470
+.L469:
+	movzbl	69(%rsp), %esi
+	leaq	4(%rbp), %rdx
+	movb	%sil, 3(%rbp)
+	cmpl	$6, %ecx
+	jne	.L472
+.L604:
+	movq	%rdx, %rbp
+	jmp	.L441
+.L471:
+	movzbl	70(%rsp), %edx
+	leaq	4(%r10), %rbp
+	movb	%dl, 3(%r10)
+	cmpl	$7, %ecx
+	je	.L441
+	jmp	.L474
+.L638:
+	movzbl	72(%rsp), %ecx
+	leaq	4(%rdx), %r10
+	movb	%cl, 3(%rdx)
+	movl	$9, %ecx
+	cmpl	$9, %eax
+	jne	.L449
+	jmp	.L606
+.L473:
+	movzbl	71(%rsp), %esi
+	leaq	4(%rbp), %rdx
+	movb	%sil, 3(%rbp)
+	cmpl	$8, %ecx
+	je	.L604
+	jmp	.L476
+.L403:
+	imull	$-732923, %edx, %edi
+	shrl	$20, %edi
+	leal	(%rdx,%rdi), %esi
+	movl	$152, %edx
+	movl	%edi, 24(%rsp)
+	subl	%ecx, %edx
+	movl	%esi, (%rsp)
+	movl	%edx, %esi
+	leaq	ryuPow5(%rip), %rdx
+	subl	%edi, %esi
+	movslq	%esi, %rcx
+	movl	%esi, 32(%rsp)
+	movq	(%rdx,%rcx,8), %rdx
+	imull	$1217359, %esi, %ecx
+	movl	%edi, %esi
+	movl	%edx, %r8d
+	shrq	$32, %rdx
+	shrl	$19, %ecx
+	subl	%ecx, %esi
+	leal	28(%rsi), %ecx
+	jmp	.L487
+.L628:
+	movl	$1, %ecx
+	jmp	.L436
+	.cfi_endproc
+.LFE26:
+	.size	formatWavefrontFloat, .-formatWavefrontFloat
+	.p2align 4
+	.globl	wavefrontFloatToHalf
+	.type	wavefrontFloatToHalf, @function
+wavefrontFloatToHalf:
+.LFB27:
+	.cfi_startproc
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	movl	$4, %edx
+	leaq	12(%rsp), %rsi
+	leaq	28(%rsp), %rdi
+	movss	%xmm0, 12(%rsp)
+	call	memcpy@PLT
+	movl	28(%rsp), %esi
+	movl	%esi, %edi
+	movl	%esi, %edx
+	shrl	$16, %edi
+	andl	$2147483647, %edx
+	andl	$32768, %edi
+	cmpl	$2139095040, %edx
+	ja	.L652
+	movl	%edi, %eax
+	cmpl	$1199566847, %edx
+	ja	.L653
+	cmpl	$947912703, %edx
+	ja	.L643
+	cmpl	$855638015, %edx
+	jbe	.L639
+	andl	$8388607, %esi
+	shrl	$23, %edx
+	movl	$126, %ecx
+	movl	$-1, %r8d
+	orl	$8388608, %esi
+	subl	%edx, %ecx
+	movl	%esi, %eax
+	sall	%cl, %r8d
+	shrl	%cl, %eax
+	movl	$125, %ecx
+	notl	%r8d
+	subl	%edx, %ecx
+	movl	$1, %edx
+	andl	%r8d, %esi
+	sall	%cl, %edx
+	cmpl	%esi, %edx
+	jb	.L645
+.L654:
+	cmpl	%edx, %esi
+	jne	.L646
+	testb	$1, %al
+	je	.L646
+.L645:
+	addl	$1, %eax
+.L646:
+	orl	%edi, %eax
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L653:
+	.cfi_restore_state
+	orb	$124, %ah
+.L639:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L652:
+	.cfi_restore_state
+	shrl	$13, %edx
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	andw	$1023, %dx
+	orl	%edi, %edx
+	movl	%edx, %eax
+	orb	$126, %ah
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L643:
+	.cfi_restore_state
+	leal	-939524096(%rdx), %eax
+	andl	$8191, %esi
+	movl	$4096, %edx
+	shrl	$13, %eax
+	cmpl	%esi, %edx
+	jnb	.L654
+	addl	$1, %eax
+	jmp	.L646
+	.cfi_endproc
+.LFE27:
+	.size	wavefrontFloatToHalf, .-wavefrontFloatToHalf
+	.p2align 4
+	.globl	wavefrontHalfToFloat
+	.type	wavefrontHalfToFloat, @function
+wavefrontHalfToFloat:
+.LFB28:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%edi, %edx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	sall	$16, %eax
+	andw	$1023, %dx
+	andl	$-2147483648, %eax
+	movl	%eax, %ecx
+	movl	%edi, %eax
+	andl	$1023, %edi
+	shrw	$10, %ax
+	andl	$31, %eax
+	cmpw	$31, %ax
+	je	.L667
+	testw	%ax, %ax
+	jne	.L668
+	movl	$113, %eax
+	testw	%dx, %dx
+	je	.L669
+	.p2align 4,,10
+	.p2align 3
+.L659:
+	movl	%edi, %edx
+	addl	%edi, %edi
+	subl	$1, %eax
+	testl	$1024, %edi
+	je	.L659
+	sall	$23, %eax
+	sall	$14, %edx
+	orl	%ecx, %eax
+	andl	$8380416, %edx
+	orl	%edx, %eax
+.L665:
+	movl	%eax, 8(%rsp)
+.L666:
+	leaq	8(%rsp), %rsi
+	leaq	12(%rsp), %rdi
+	movl	$4, %edx
+	call	memcpy@PLT
+	movss	12(%rsp), %xmm0
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L668:
+	.cfi_restore_state
+	addl	$112, %eax
+	sall	$13, %edi
+	sall	$23, %eax
+	orl	%ecx, %edi
+	orl	%edi, %eax
+	jmp	.L665
+	.p2align 4,,10
+	.p2align 3
+.L669:
+	movl	%ecx, 8(%rsp)
+	jmp	.L666
+	.p2align 4,,10
+	.p2align 3
+.L667:
+	sall	$13, %edi
+	orl	%ecx, %edi
+	orl	$2139095040, %edi
+	movl	%edi, 8(%rsp)
+	jmp	.L666
+	.cfi_endproc
+.LFE28:
+	.size	wavefrontHalfToFloat, .-wavefrontHalfToFloat
+	.section	.rodata
+	.align 32
+	.type	ryuPow5, @object
+	.size	ryuPow5, 384
+ryuPow5:
+	.quad	1152921504606846976
+	.quad	1441151880758558720
+	.quad	1801439850948198400
+	.quad	2251799813685248000
+	.quad	1407374883553280000
+	.quad	1759218604441600000
+	.quad	2199023255552000000
+	.quad	1374389534720000000
+	.quad	1717986918400000000
+	.quad	2147483648000000000
+	.quad	1342177280000000000
+	.quad	1677721600000000000
+	.quad	2097152000000000000
+	.quad	1310720000000000000
+	.quad	1638400000000000000
+	.quad	2048000000000000000
+	.quad	1280000000000000000
+	.quad	1600000000000000000
+	.quad	2000000000000000000
+	.quad	1250000000000000000
+	.quad	1562500000000000000
+	.quad	1953125000000000000
+	.quad	1220703125000000000
+	.quad	1525878906250000000
+	.quad	1907348632812500000
+	.quad	1192092895507812500
+	.quad	1490116119384765625
+	.quad	1862645149230957031
+	.quad	1164153218269348144
+	.quad	1455191522836685180
+	.quad	1818989403545856475
+	.quad	2273736754432320594
+	.quad	1421085471520200371
+	.quad	1776356839400250464
+	.quad	2220446049250313080
+	.quad	1387778780781445675
+	.quad	1734723475976807094
+	.quad	2168404344971008868
+	.quad	1355252715606880542
+	.quad	1694065894508600678
+	.quad	2117582368135750847
+	.quad	1323488980084844279
+	.quad	1654361225106055349
+	.quad	2067951531382569187
+	.quad	1292469707114105741
+	.quad	1615587133892632177
+	.quad	2019483917365790221
+	.quad	1262177448353618888
+	.align 32
+	.type	ryuPow5Inverse, @object
+	.size	ryuPow5Inverse, 248
+ryuPow5Inverse:
+	.quad	576460752303423489
+	.quad	461168601842738791
+	.quad	368934881474191033
+	.quad	295147905179352826
+	.quad	472236648286964522
+	.quad	377789318629571618
+	.quad	302231454903657294
+	.quad	483570327845851670
+	.quad	386856262276681336
+	.quad	309485009821345069
+	.quad	495176015714152110
+	.quad	396140812571321688
+	.quad	316912650057057351
+	.quad	507060240091291761
+	.quad	405648192073033409
+	.quad	324518553658426727
+	.quad	519229685853482763
+	.quad	415383748682786211
+	.quad	332306998946228969
+	.quad	531691198313966350
+	.quad	425352958651173080
+	.quad	340282366920938464
+	.quad	544451787073501542
+	.quad	435561429658801234
+	.quad	348449143727040987
+	.quad	557518629963265579
+	.quad	446014903970612463
+	.quad	356811923176489971
+	.quad	570899077082383953
+	.quad	456719261665907162
+	.quad	365375409332725730
+	.align 32
+	.type	doublePowersOfTen, @object
+	.size	doublePowersOfTen, 184
+doublePowersOfTen:
+	.long	0
+	.long	1072693248
+	.long	0
+	.long	1076101120
+	.long	0
+	.long	1079574528
+	.long	0
+	.long	1083129856
+	.long	0
+	.long	1086556160
+	.long	0
+	.long	1090021888
+	.long	0
+	.long	1093567616
+	.long	0
+	.long	1097011920
+	.long	0
+	.long	1100470148
+	.long	0
+	.long	1104006501
+	.long	536870912
+	.long	1107468383
+	.long	-402653184
+	.long	1110919286
+	.long	-1577058304
+	.long	1114446484
+	.long	-448790528
+	.long	1117925532
+	.long	512753664
+	.long	1121369284
+	.long	640942080
+	.long	1124887541
+	.long	937459712
+	.long	1128383353
+	.long	-2049400832
+	.long	1131820119
+	.long	1733216256
+	.long	1135329645
+	.long	1620131072
+	.long	1138841828
+	.long	2025163840
+	.long	1142271773
+	.long	-689770672
+	.long	1145772772
+	.long	105764242
+	.long	1149300943
+	.align 32
+	.type	floatPowersOfTen, @object
+	.size	floatPowersOfTen, 44
+floatPowersOfTen:
+	.long	1065353216
+	.long	1092616192
+	.long	1120403456
+	.long	1148846080
+	.long	1176256512
+	.long	1203982336
+	.long	1232348160
+	.long	1259902592
+	.long	1287568416
+	.long	1315859240
+	.long	1343554297
+	.align 32
+	.type	powersOfFive, @object
+	.size	powersOfFive, 1664
+powersOfFive:
+	.quad	-8733399612580906262
+	.quad	-7428327965055601431
+	.quad	-6305063497298744923
+	.quad	4549648098962661924
+	.quad	-3269643353196043250
+	.quad	-8147997931578836307
+	.quad	-8961056123388608887
+	.quad	1825030320404309164
+	.quad	-6589634135808373205
+	.quad	6892973918932774359
+	.quad	-3625356651333078602
+	.quad	4004531380238580045
+	.quad	-9183376934724255983
+	.quad	-2108853905778275376
+	.quad	-6867535149977932074
+	.quad	6587304654631931588
+	.quad	-3972732919045027189
+	.quad	-989241218564861323
+	.quad	-354230130378896082
+	.quad	-1236551523206076654
+	.quad	-7138922859127891907
+	.quad	6144684325637283947
+	.quad	-4311967555482476980
+	.quad	-6154202648235558778
+	.quad	-778273425925708321
+	.quad	-3081067291867060568
+	.quad	-7403949918844649557
+	.quad	-1925667057416912855
+	.quad	-4643251380128424042
+	.quad	-2407083821771141069
+	.quad	-1192378206733142148
+	.quad	-7620540795641314240
+	.quad	-7662765406849295699
+	.quad	-2456994988062127448
+	.quad	-4966770740134231719
+	.quad	6152128301777116498
+	.quad	-1596777406740401745
+	.quad	-6144897678060768090
+	.quad	-7915514906853832947
+	.quad	-3840561048787980056
+	.quad	-5282707615139903279
+	.quad	4422670725869800738
+	.quad	-1991698500497491195
+	.quad	-8306719647944912790
+	.quad	-8162340590452013853
+	.quad	8643358275316593218
+	.quad	-5591239719637629412
+	.quad	6192511825718353619
+	.quad	-2377363631119648861
+	.quad	7740639782147942024
+	.quad	-8403381297090862394
+	.quad	2532056854628769813
+	.quad	-5892540602936190089
+	.quad	-6058300968568813542
+	.quad	-2753989735242849707
+	.quad	-7572876210711016927
+	.quad	-8638772612167862923
+	.quad	9102010423587778132
+	.quad	-6186779746782440750
+	.quad	-2457545025797441047
+	.quad	-3121788665050663033
+	.quad	-7683617300674189212
+	.quad	-8868646943297746252
+	.quad	-4802260812921368258
+	.quad	-6474122660694794911
+	.quad	-1391139997724322418
+	.quad	-3480967307441105734
+	.quad	7484447039699372786
+	.quad	-9093133594791772940
+	.quad	-9157278655470055721
+	.quad	-6754730975062328271
+	.quad	-6834912300910181747
+	.quad	-3831727700400522434
+	.quad	679731660717048624
+	.quad	-177973607073265139
+	.quad	-8373707460958465028
+	.quad	-7028762532061872568
+	.quad	8601490892183123070
+	.quad	-4174267146649952806
+	.quad	-7694880458480647778
+	.quad	-606147914885053103
+	.quad	4216457482181353989
+	.quad	-7296371474444240046
+	.quad	-4282243101277735613
+	.quad	-4508778324627912153
+	.quad	8482254178684994196
+	.quad	-1024286887357502287
+	.quad	5991131704928854841
+	.quad	-7557708332239520786
+	.quad	-3173071712060547580
+	.quad	-4835449396872013078
+	.quad	-8578025658503072379
+	.quad	-1432625727662628443
+	.quad	3112525982153323238
+	.quad	-7812920107430224633
+	.quad	4251171748059520976
+	.quad	-5154464115860392887
+	.quad	702278666647013315
+	.quad	-1831394126398103205
+	.quad	5489534351736154548
+	.quad	-8062150356639896359
+	.quad	1125115960621402641
+	.quad	-5466001927372482545
+	.quad	6018080969204141205
+	.quad	-2220816390788215277
+	.quad	2910915193077788602
+	.quad	-8305539271883716405
+	.quad	-486521013540076076
+	.quad	-5770238071427257602
+	.quad	-608151266925095095
+	.quad	-2601111570856684098
+	.quad	-5371875102083756772
+	.quad	-8543223759426509417
+	.quad	3560107088838733873
+	.quad	-6067343680855748868
+	.quad	-161552157378970562
+	.quad	-2972493582642298180
+	.quad	4409745821703674701
+	.quad	-8775337516792518219
+	.quad	-6467280898289979120
+	.quad	-6357485877563259869
+	.quad	1139270913992301908
+	.quad	-3335171328526686933
+	.quad	-3187597375937010519
+	.quad	-9002011107970261189
+	.quad	7231123676894144234
+	.quad	-6640827866535438582
+	.quad	4427218577690292388
+	.quad	-3689348814741910324
+	.quad	-3689348814741910323
+	.quad	-9223372036854775808
+	.quad	0
+	.quad	-6917529027641081856
+	.quad	0
+	.quad	-4035225266123964416
+	.quad	0
+	.quad	-432345564227567616
+	.quad	0
+	.quad	-7187745005283311616
+	.quad	0
+	.quad	-4372995238176751616
+	.quad	0
+	.quad	-854558029293551616
+	.quad	0
+	.quad	-7451627795949551616
+	.quad	0
+	.quad	-4702848726509551616
+	.quad	0
+	.quad	-1266874889709551616
+	.quad	0
+	.quad	-7709325833709551616
+	.quad	0
+	.quad	-5024971273709551616
+	.quad	0
+	.quad	-1669528073709551616
+	.quad	0
+	.quad	-7960984073709551616
+	.quad	0
+	.quad	-5339544073709551616
+	.quad	0
+	.quad	-2062744073709551616
+	.quad	0
+	.quad	-8206744073709551616
+	.quad	0
+	.quad	-5646744073709551616
+	.quad	0
+	.quad	-2446744073709551616
+	.quad	0
+	.quad	-8446744073709551616
+	.quad	0
+	.quad	-5946744073709551616
+	.quad	0
+	.quad	-2821744073709551616
+	.quad	0
+	.quad	-8681119073709551616
+	.quad	0
+	.quad	-6239712823709551616
+	.quad	0
+	.quad	-3187955011209551616
+	.quad	0
+	.quad	-8910000909647051616
+	.quad	0
+	.quad	-6525815118631426616
+	.quad	0
+	.quad	-3545582879861895366
+	.quad	0
+	.quad	-9133518327554766460
+	.quad	4611686018427387904
+	.quad	-6805211891016070171
+	.quad	5764607523034234880
+	.quad	-3894828845342699810
+	.quad	-6629298651489370112
+	.quad	-256850038250986858
+	.quad	5548434740920451072
+	.quad	-7078060301547948643
+	.quad	-1143914305352105984
+	.quad	-4235889358507547899
+	.quad	7793479155164643328
+	.quad	-683175679707046970
+	.quad	-4093209111326359552
+	.quad	-7344513827457986212
+	.quad	4359273333062107136
+	.quad	-4568956265895094861
+	.quad	5449091666327633920
+	.quad	-1099509313941480672
+	.quad	2199678564482154496
+	.quad	-7604722348854507276
+	.quad	1374799102801346560
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	-13
+	.long	-26
+	.long	-39
+	.long	-52
+	.align 16
+.LC1:
+	.long	-52
+	.long	-52
+	.long	-52
+	.long	-52
+	.align 16
+.LC2:
+	.long	-13
+	.long	-13
+	.long	-13
+	.long	-13
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC6:
+	.long	105764242
+	.long	1149300943
+	.section	.note.GNU-stack,"",@progbits
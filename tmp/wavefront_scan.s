@@ -0,0 +1,292 @@
+	.file	"wavefront_scan.c"
+	.text
+	.p2align 4
+	.type	findLineEndsSSE2, @function
+findLineEndsSSE2:
+.LFB6393:
+	.cfi_startproc
+	leaq	16(%rsi), %r11
+	movq	%rsi, %rax
+	movq	%rdx, %r10
+	cmpq	%r11, %rdx
+	jb	.L31
+	movdqa	.LC0(%rip), %xmm3
+	movdqa	.LC1(%rip), %xmm2
+.L7:
+	movdqu	-16(%rdi,%r11), %xmm1
+	movdqu	-16(%rdi,%r11), %xmm0
+	pcmpeqb	%xmm3, %xmm1
+	pcmpeqb	%xmm2, %xmm0
+	por	%xmm1, %xmm0
+	pmovmskb	%xmm0, %eax
+	testl	%eax, %eax
+	je	.L3
+	cmpq	%r8, %r9
+	je	.L4
+	leal	-16(%r11), %esi
+	jmp	.L5
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	cmpq	%r8, %r9
+	je	.L4
+.L5:
+	xorl	%edx, %edx
+	addq	$1, %r8
+	rep bsfl	%eax, %edx
+	addl	%esi, %edx
+	movl	%edx, -4(%rcx,%r8,4)
+	leal	-1(%rax), %edx
+	andl	%edx, %eax
+	jne	.L6
+.L3:
+	leaq	16(%r11), %rax
+	cmpq	%rax, %r10
+	jb	.L34
+	movq	%rax, %r11
+	jmp	.L7
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	movl	%eax, (%rcx,%r8,4)
+	addq	$1, %r8
+	addq	$1, %rax
+.L31:
+	cmpq	%r10, %rax
+	jnb	.L4
+	cmpq	%r9, %r8
+	jnb	.L4
+	movzbl	(%rdi,%rax), %edx
+	cmpb	$10, %dl
+	je	.L13
+	cmpb	$13, %dl
+	je	.L13
+	addq	$1, %rax
+	jmp	.L31
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	movq	%r8, %rax
+	ret
+.L34:
+	movq	%r11, %rax
+	jmp	.L31
+	.cfi_endproc
+.LFE6393:
+	.size	findLineEndsSSE2, .-findLineEndsSSE2
+	.p2align 4
+	.type	findLineEndsAVX2.constprop.0, @function
+findLineEndsAVX2.constprop.0:
+.LFB6397:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %r10
+	movq	%rsi, %r11
+	movq	%rdx, %rdi
+	xorl	%eax, %eax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	.cfi_offset 3, -24
+	cmpq	$31, %rsi
+	jbe	.L42
+	movl	$10, %edx
+	movl	$32, %ebx
+	vmovd	%edx, %xmm3
+	movl	$13, %edx
+	vmovd	%edx, %xmm2
+	vpbroadcastb	%xmm3, %ymm3
+	vpbroadcastb	%xmm2, %ymm2
+.L41:
+	vpcmpeqb	-32(%r10,%rbx), %ymm3, %ymm1
+	vpcmpeqb	-32(%r10,%rbx), %ymm2, %ymm0
+	vpor	%ymm0, %ymm1, %ymm0
+	vpmovmskb	%ymm0, %edx
+	testl	%edx, %edx
+	je	.L37
+	cmpq	%rax, %rcx
+	je	.L35
+	leal	-32(%rbx), %r8d
+	jmp	.L39
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	cmpq	%rax, %rcx
+	je	.L35
+.L39:
+	xorl	%esi, %esi
+	addq	$1, %rax
+	rep bsfl	%edx, %esi
+	addl	%r8d, %esi
+	movl	%esi, -4(%rdi,%rax,4)
+	leal	-1(%rdx), %esi
+	andl	%esi, %edx
+	jne	.L40
+.L37:
+	leaq	32(%rbx), %rdx
+	cmpq	%rdx, %r11
+	jb	.L36
+	movq	%rdx, %rbx
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	vzeroupper
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.L42:
+	.cfi_restore_state
+	xorl	%ebx, %ebx
+.L36:
+	movq	%rbx, %rsi
+	movq	-8(%rbp), %rbx
+	movq	%rcx, %r9
+	movq	%rax, %r8
+	leave
+	.cfi_def_cfa 7, 8
+	movq	%rdi, %rcx
+	movq	%r11, %rdx
+	movq	%r10, %rdi
+	jmp	findLineEndsSSE2
+	.cfi_endproc
+.LFE6397:
+	.size	findLineEndsAVX2.constprop.0, .-findLineEndsAVX2.constprop.0
+	.p2align 4
+	.globl	wavefrontScanKernel
+	.type	wavefrontScanKernel, @function
+wavefrontScanKernel:
+.LFB6395:
+	.cfi_startproc
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %edx
+	movl	%edx, %eax
+	shrl	$4, %eax
+	andl	$1, %eax
+	andb	$4, %dh
+	movl	$2, %edx
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE6395:
+	.size	wavefrontScanKernel, .-wavefrontScanKernel
+	.p2align 4
+	.globl	wavefrontFindLineEnds
+	.type	wavefrontFindLineEnds, @function
+wavefrontFindLineEnds:
+.LFB6396:
+	.cfi_startproc
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movq	%rdx, %r10
+	movq	%rsi, %r11
+	movq	%rcx, %rdx
+	movl	12(%rax), %eax
+	testb	$4, %ah
+	jne	.L53
+	testb	$16, %al
+	jne	.L54
+.L59:
+	testq	%r10, %r10
+	je	.L64
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	testq	%r8, %r8
+	jne	.L55
+	jmp	.L64
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	addq	$1, %rax
+	cmpq	%r10, %rax
+	jnb	.L52
+.L80:
+	cmpq	%r8, %rsi
+	jnb	.L52
+.L55:
+	movzbl	(%r11,%rax), %edi
+	cmpb	$10, %dil
+	je	.L65
+	cmpb	$13, %dil
+	jne	.L60
+.L65:
+	movl	%eax, (%rdx,%rsi,4)
+	addq	$1, %rax
+	addq	$1, %rsi
+	cmpq	%r10, %rax
+	jb	.L80
+.L52:
+	movq	%rsi, %rax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	testl	%edi, %edi
+	jle	.L59
+.L58:
+	movq	%r8, %r9
+	movq	%rdx, %rcx
+	xorl	%r8d, %r8d
+	movq	%r10, %rdx
+	xorl	%esi, %esi
+	movq	%r11, %rdi
+	jmp	findLineEndsSSE2
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	cmpl	$1, %edi
+	je	.L58
+	jle	.L59
+	movq	%r8, %rcx
+	movq	%r10, %rsi
+	movq	%r11, %rdi
+	jmp	findLineEndsAVX2.constprop.0
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	xorl	%esi, %esi
+	jmp	.L52
+	.cfi_endproc
+.LFE6396:
+	.size	wavefrontFindLineEnds, .-wavefrontFindLineEnds
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.byte	10
+	.align 16
+.LC1:
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.byte	13
+	.section	.note.GNU-stack,"",@progbits
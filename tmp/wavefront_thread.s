@@ -0,0 +1,213 @@
+	.file	"wavefront_thread.c"
+	.text
+	.p2align 4
+	.type	worker, @function
+worker:
+.LFB12:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	24(%rdi), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	jmp	.L3
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	movq	8(%rbx), %rdi
+	movl	%ebp, %esi
+	call	*(%rbx)
+.L3:
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+	movl	20(%rbx), %ebp
+	movq	%r12, %rdi
+	leal	1(%rbp), %eax
+	movl	%eax, 20(%rbx)
+	call	pthread_mutex_unlock@PLT
+	cmpl	16(%rbx), %ebp
+	jb	.L6
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	xorl	%eax, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	worker, .-worker
+	.p2align 4
+	.globl	wavefrontRunParallel
+	.type	wavefrontRunParallel, @function
+wavefrontRunParallel:
+.LFB13:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	cmpl	%ecx, %edx
+	cmovbe	%edx, %ecx
+	movq	%r8, (%rsp)
+	movq	%rdi, 16(%rsp)
+	movq	%rsi, 24(%rsp)
+	movl	%edx, 32(%rsp)
+	movl	$0, 36(%rsp)
+	cmpl	$1, %ecx
+	jbe	.L11
+	leaq	40(%rsp), %r14
+	xorl	%esi, %esi
+	movl	%ecx, %ebx
+	movq	%r14, %rdi
+	call	pthread_mutex_init@PLT
+	testl	%eax, %eax
+	je	.L31
+.L11:
+	xorl	%ebx, %ebx
+	testl	%ebp, %ebp
+	je	.L7
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	movl	%ebx, %esi
+	addl	$1, %ebx
+	movq	%r13, %rdi
+	call	*%r12
+	cmpl	%ebx, %ebp
+	jne	.L9
+.L7:
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+	movq	(%rsp), %rdi
+	leal	-1(%rbx), %esi
+	salq	$3, %rsi
+	call	wavefrontAllocateWith@PLT
+	movq	%rax, 8(%rsp)
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L23
+	xorl	%r15d, %r15d
+	leaq	worker(%rip), %r12
+	jmp	.L16
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	movq	%r13, %rdi
+	leaq	16(%rsp), %rcx
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	call	pthread_create@PLT
+	addq	$8, %r13
+	testl	%eax, %eax
+	jne	.L20
+.L16:
+	movl	%r15d, %ebp
+	addl	$1, %r15d
+	cmpl	%ebx, %r15d
+	jne	.L32
+	jmp	.L20
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	movq	24(%rsp), %rdi
+	movl	%ebx, %esi
+	call	*16(%rsp)
+.L20:
+	movq	%r14, %rdi
+	call	pthread_mutex_lock@PLT
+	movl	36(%rsp), %ebx
+	movq	%r14, %rdi
+	leal	1(%rbx), %eax
+	movl	%eax, 36(%rsp)
+	call	pthread_mutex_unlock@PLT
+	cmpl	32(%rsp), %ebx
+	jb	.L17
+	testl	%ebp, %ebp
+	je	.L19
+	movq	8(%rsp), %rax
+	movq	%rax, %rbx
+	leaq	(%rax,%rbp,8), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	movq	(%rbx), %rdi
+	xorl	%esi, %esi
+	addq	$8, %rbx
+	call	pthread_join@PLT
+	cmpq	%rbp, %rbx
+	jne	.L21
+.L19:
+	movq	8(%rsp), %rsi
+	movq	(%rsp), %rdi
+	call	wavefrontFreeWith@PLT
+	movq	%r14, %rdi
+	call	pthread_mutex_destroy@PLT
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.L23:
+	.cfi_restore_state
+	xorl	%ebp, %ebp
+	jmp	.L20
+	.cfi_endproc
+.LFE13:
+	.size	wavefrontRunParallel, .-wavefrontRunParallel
+	.section	.note.GNU-stack,"",@progbits